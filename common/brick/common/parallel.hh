@@ -0,0 +1,140 @@
+/**
+***************************************************************************
+* @file brick/common/parallel.hh
+*
+* Header file declaring simple routines for spreading work across
+* threads.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_COMMON_PARALLEL_HH
+#define BRICK_COMMON_PARALLEL_HH
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace brick {
+
+  namespace common {
+
+    /**
+     * This function returns the number of threads that
+     * executeInParallel() will use if its numberOfThreads argument is
+     * zero.  It is a thin wrapper around
+     * std::thread::hardware_concurrency() that never returns zero.
+     *
+     * @return The return value is the number of hardware threads
+     * available, or 1 if this can't be determined.
+     */
+    inline std::size_t
+    getDefaultNumberOfThreads()
+    {
+      std::size_t numberOfThreads = std::thread::hardware_concurrency();
+      return (numberOfThreads == 0) ? 1 : numberOfThreads;
+    }
+
+
+    /**
+     * This function calls functor(taskIndex) once for each taskIndex
+     * in the range [0, numberOfTasks), spreading the calls across a
+     * group of threads.  Tasks are handed out dynamically, so there
+     * is no guarantee about which thread runs which task, or about
+     * the order in which tasks are started.  The function does not
+     * return until all tasks have completed.  If any call to functor
+     * throws, the remaining tasks are abandoned and the first
+     * exception is rethrown in the calling thread.
+     *
+     * Here's an example of how you might use it:
+     *
+     * @code
+     *   std::vector<double> results(bands.size());
+     *   executeInParallel(
+     *     bands.size(),
+     *     [&](std::size_t ii) {results[ii] = processBand(bands[ii]);});
+     * @endcode
+     *
+     * @param numberOfTasks This argument specifies how many times
+     * functor should be called.
+     *
+     * @param functor This argument is the callable to be run.  It
+     * must be safe to call concurrently from several threads.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  Setting it to zero selects
+     * getDefaultNumberOfThreads().  If it is 1, or if there is only
+     * one task, all work is done in the calling thread.
+     */
+    template <class Functor>
+    void
+    executeInParallel(std::size_t numberOfTasks,
+                      Functor const& functor,
+                      std::size_t numberOfThreads = 0)
+    {
+      if(numberOfThreads == 0) {
+        numberOfThreads = getDefaultNumberOfThreads();
+      }
+      if(numberOfThreads > numberOfTasks) {
+        numberOfThreads = numberOfTasks;
+      }
+
+      // Trivial case is easy, and avoids thread startup cost.
+      if(numberOfThreads <= 1) {
+        for(std::size_t taskIndex = 0; taskIndex < numberOfTasks;
+            ++taskIndex) {
+          functor(taskIndex);
+        }
+        return;
+      }
+
+      // Each worker repeatedly grabs the next unclaimed task.
+      std::atomic<std::size_t> nextTask(0);
+      std::atomic<bool> isAborted(false);
+      std::exception_ptr firstException;
+      std::mutex exceptionMutex;
+      auto worker = [&]() {
+        while(!isAborted.load()) {
+          std::size_t taskIndex = nextTask.fetch_add(1);
+          if(taskIndex >= numberOfTasks) {
+            break;
+          }
+          try {
+            functor(taskIndex);
+          } catch(...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if(!firstException) {
+              firstException = std::current_exception();
+            }
+            isAborted.store(true);
+          }
+        }
+      };
+
+      // The calling thread does its share of the work, too.
+      std::vector<std::thread> threads;
+      threads.reserve(numberOfThreads - 1);
+      for(std::size_t ii = 1; ii < numberOfThreads; ++ii) {
+        threads.push_back(std::thread(worker));
+      }
+      worker();
+      for(std::size_t ii = 0; ii < threads.size(); ++ii) {
+        threads[ii].join();
+      }
+
+      if(firstException) {
+        std::rethrow_exception(firstException);
+      }
+    }
+
+  } // namespace common
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMMON_PARALLEL_HH */
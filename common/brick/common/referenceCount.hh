@@ -13,6 +13,7 @@
 #ifndef BRICK_COMMON_REFERENCECOUNT_HH
 #define BRICK_COMMON_REFERENCECOUNT_HH
 
+#include <atomic>
 #include <cstddef>
 
 namespace brick {
@@ -73,7 +74,7 @@ namespace brick {
      **         m_referenceCount() {}
      **
      **     ~MyVector() {
-     **       if(!m_referenceCount.isShared()) {
+     **       if(m_referenceCount.release()) {
      **         delete m_vectorPtr;
      **       }
      **     }
@@ -98,21 +99,17 @@ namespace brick {
      ** this count until, when the very last copy is destroyed,
      ** m_vectorPtr will be deleted.
      **
-     ** One note regarding thread safety: if you use ReferenceCount as
-     ** a member of a class that is shared between threads, and this
-     ** class manages its own mutex locking (such as
-     ** brick::thread::Monitor), construction and destruction of the
-     ** members of the containing class will most likely happen
-     ** outside of the locked sections of code.  This means that the
-     ** ReferenceCount copy constructor and destructor will be called
-     ** without protection, which is not thread-safe.  To solve this,
-     ** you can dynamically allocate the ReferenceCount instance using
-     ** new, keep a pointer to the ReferenceCount as a member of the
-     ** class, and explicitly manage copying, incrementing, and
-     ** decrementing of the ReferenceCount inside the locked sections
-     ** of code.  Alternatively, you could do the locking outside the
-     ** class (perhaps using brick::thread::Monitor) so that
-     ** constructor and destructor calls are protected.
+     ** One note regarding thread safety: the shared count is
+     ** atomic, so distinct ReferenceCount instances that share a
+     ** count may be copied and destroyed concurrently from different
+     ** threads.  This is what lets reference counted arrays be handed
+     ** from one thread to another (for example, through
+     ** brick::utilities::RingBufferSPSC).  Use release() rather than
+     ** isShared() followed by a decrement to decide whether to delete
+     ** the shared resource, since another thread may release its
+     ** reference between those two calls.  A single ReferenceCount
+     ** instance must still not be modified by two threads at once,
+     ** and of course the shared resource itself is not protected.
      **/
     class ReferenceCount
     {
@@ -157,8 +154,7 @@ namespace brick {
        * the counted state) and destroys the ReferenceCount instance.
        */
       ~ReferenceCount() {
-        --(*this);
-        this->deleteIfNecessary();
+        this->release();
       }
 
 
@@ -256,8 +252,7 @@ namespace brick {
         // Check for self-assignment.
         if (this != &source) {
           // Release the count that was previously tracked by *this.
-          --(*this);
-          this->deleteIfNecessary();
+          this->release();
 
           // Adopt the new count and increment it.
           m_countPtr = source.m_countPtr;
@@ -304,6 +299,32 @@ namespace brick {
       isShared() const {return (this->getCount() > 1);}
 
 
+      /**
+       * This member function atomically decrements the count,
+       * abandons it, and leaves *this in the uncounted state.  It
+       * reports whether the reference just released was the last
+       * one, in which case the caller is responsible for deleting
+       * the shared resource.  Unlike calling isShared() and then
+       * decrementing, this is safe when other threads are releasing
+       * references to the same resource at the same time.
+       *
+       * @return true if *this was in the counted state and no other
+       * ReferenceCount instances share the count, false otherwise.
+       */
+      bool
+      release() {
+        bool isLastReference = false;
+        if(m_countPtr != 0) {
+          isLastReference = (m_countPtr->fetch_sub(1) <= 1);
+          if(isLastReference) {
+            delete m_countPtr;
+          }
+          m_countPtr = 0;
+        }
+        return isLastReference;
+      }
+
+
       /**
        * This member function decrements the count and releases the
        * reference, then reinitializes with a fresh count.  Use this
@@ -316,33 +337,16 @@ namespace brick {
        */
       void
       reset(size_t count=1) {
-        --(*this);
-        this->deleteIfNecessary();
+        this->release();
         if(count != 0) {
-          m_countPtr = new int;
-          *m_countPtr = count;
+          m_countPtr = new std::atomic<int>(static_cast<int>(count));
         }
       }
 
 
     private:
 
-      /**
-       * This member function deletes the internal count pointer
-       * pointer if no references remain, and (always) resets the
-       * pointer to 0.
-       */
-      void deleteIfNecessary() {
-        if(m_countPtr != 0) {
-          if((*m_countPtr) <= 0) {
-            delete m_countPtr;
-          }
-          m_countPtr = 0;
-        }
-      }
-
-
-      int* m_countPtr;
+      std::atomic<int>* m_countPtr;
     };
 
   } // namespace common
@@ -12,6 +12,7 @@
 
 #include <iostream>
 #include <limits>
+#include <thread>
 #include <vector>
 #include <brick/common/referenceCount.hh>
 #include <brick/common/types.hh>
@@ -150,6 +151,75 @@ namespace brick {
       return true;
     }
 
+
+    bool
+    testRelease()
+    {
+      std::cout << "Testing ReferenceCount::release()..." << std::endl;
+
+      ReferenceCount count0(0);
+      if(count0.release()) {
+        return false;
+      }
+
+      ReferenceCount count1(1);
+      {
+        ReferenceCount count2(count1);
+        if(count2.release()) {
+          return false;
+        }
+        if(!checkState(count2, false, false, 0)) {
+          return false;
+        }
+        if(!checkState(count1, true, false, 1)) {
+          return false;
+        }
+      }
+      if(!count1.release()) {
+        return false;
+      }
+      if(!checkState(count1, false, false, 0)) {
+        return false;
+      }
+
+      // Copies destroyed concurrently in several threads must leave
+      // exactly one of them responsible for the shared resource.
+      const size_t numberOfThreads = 4;
+      const size_t copiesPerThread = 10000;
+      for(size_t trial = 0; trial < 20; ++trial) {
+        ReferenceCount original(1);
+        std::vector< std::vector<ReferenceCount> > copies(numberOfThreads);
+        for(size_t ii = 0; ii < numberOfThreads; ++ii) {
+          copies[ii].assign(copiesPerThread, original);
+        }
+        if(original.release()) {
+          return false;
+        }
+        std::vector<int> lastCounts(numberOfThreads, 0);
+        std::vector<std::thread> threads;
+        for(size_t ii = 0; ii < numberOfThreads; ++ii) {
+          threads.push_back(std::thread([&copies, &lastCounts, ii]() {
+                for(size_t jj = 0; jj < copies[ii].size(); ++jj) {
+                  if(copies[ii][jj].release()) {
+                    ++(lastCounts[ii]);
+                  }
+                }
+              }));
+        }
+        int totalLast = 0;
+        for(size_t ii = 0; ii < numberOfThreads; ++ii) {
+          threads[ii].join();
+          totalLast += lastCounts[ii];
+        }
+        if(totalLast != 1) {
+          return false;
+        }
+      }
+
+      // If we get this far, then all is well.
+      return true;
+    }
+
   } // namespace common
 
 } // namespace brick
@@ -162,5 +232,6 @@ int main(int, char**)
   result &= brick::common::testConstructor();
   result &= brick::common::testCopyConstructor();
   result &= brick::common::testDestructor();
+  result &= brick::common::testRelease();
   return (result ? 0 : 1);
 }
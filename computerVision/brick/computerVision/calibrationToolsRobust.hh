@@ -14,6 +14,7 @@
 #ifndef BRICK_COMPUTERVISION_CALIBRATIONTOOLSROBUST_HH
 #define BRICK_COMPUTERVISION_CALIBRATIONTOOLSROBUST_HH
 
+#include <cstddef>
 #include <brick/computerVision/cameraIntrinsicsPinhole.hh>
 #include <brick/numeric/transform3D.hh>
 
@@ -115,6 +116,123 @@ namespace brick {
       unsigned int verbosity = 0);
 
 
+    /**
+     ** This struct reports what estimateCameraParametersRobustParallel()
+     ** did, and how long each stage took, so that calibration of
+     ** large camera rigs can be profiled.  Times are in seconds.
+     **/
+    struct RobustCalibrationStatistics {
+      /// Number of minimal-sample hypotheses fitted and scored.
+      std::size_t numberOfHypotheses;
+
+      /// Number of top hypotheses that were refined.
+      std::size_t numberOfCandidates;
+
+      /// Number of inliers supporting the returned calibration.
+      std::size_t consensusSetSize;
+
+      /// Time spent fitting and scoring hypotheses.
+      double hypothesisTime;
+
+      /// Time spent refining candidates on their consensus sets.
+      double refinementTime;
+
+      /// Total time, including setup.
+      double totalTime;
+
+      RobustCalibrationStatistics()
+        : numberOfHypotheses(0), numberOfCandidates(0), consensusSetSize(0),
+          hypothesisTime(0.0), refinementTime(0.0), totalTime(0.0) {}
+    };
+
+
+    /**
+     * This function does the same job as
+     * estimateCameraParametersRobust(), but is organized to use
+     * multiple threads.  Rather than fitting and refining one RANSAC
+     * hypothesis at a time, it draws hypotheses in batches and fits
+     * and scores each batch in parallel, stopping early as soon as
+     * a batch produces a large enough consensus set.  The best few
+     * hypotheses are then refined concurrently, each by repeatedly
+     * refitting to its consensus set, and the refined result with the
+     * most inliers (breaking ties by residual) is returned.  Each
+     * thread reuses its own scratch buffers for every hypothesis it
+     * handles.
+     *
+     * Unlike estimateCameraParametersRobust(), a hypothesis for
+     * which estimateCameraParameters() throws ValueException (for
+     * example, because the random sample was degenerate) is simply
+     * discarded.
+     *
+     * @param intrinsics This reference argument is used to return the
+     * estimated camera intrinsics.
+     *
+     * @param cameraTworld This reference argument is used to return
+     * the estimated coordinate transformation that takes world
+     * coordinates and returns the corresponding camera coordinates.
+     *
+     * @param statistics This reference argument is used to return
+     * hypothesis counts and per-stage timings.
+     *
+     * @param numPixelsX This argument specifies the number of columns
+     * in images generated by the camera.
+     *
+     * @param numPixelsY This argument specifies the number of rows
+     * in images generated by the camera.
+     *
+     * @param points3DBegin This argument is an iterator pointing to
+     * the beginning of a sequence of 3D points in world coordinates.
+     *
+     * @param points3DEnd This argument is an iterator pointing one
+     * element past the end of the sequence of 3D points.
+     *
+     * @param points2DBegin This argument is an iterator pointing to
+     * the beginning of a sequence of 2D points, in pixel
+     * coordinates, corresponding to the sequence of 3D points.
+     *
+     * @param maxResidual This argument specifies, in pixels, the
+     * largest residual for which a point is considered an inlier.
+     *
+     * @param inlierProbability This argument indicates the likelihood
+     * that any particular pair of corresponding points is not an
+     * outlier.  It controls the number of hypotheses.
+     *
+     * @param requiredConfidence This argument indicates how confident
+     * we need to be that we've found the right calibration.  It
+     * controls the number of hypotheses, and the automatically
+     * computed value of minConsensusSetSize.
+     *
+     * @param minConsensusSetSize This argument specifies how many
+     * inliers a hypothesis needs in order to stop drawing more
+     * hypotheses.  Setting it to zero selects a value based on
+     * requiredConfidence, as estimateCameraParametersRobust() does.
+     *
+     * @param numberOfCandidates This argument specifies how many of
+     * the best hypotheses are refined.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  Setting it to zero selects a
+     * sensible default.
+     */
+    template <class Intrinsics, class Iter3D, class Iter2D>
+    void
+    estimateCameraParametersRobustParallel(
+      Intrinsics& intrinsics,
+      numeric::Transform3D<typename Intrinsics::FloatType>& cameraTworld,
+      RobustCalibrationStatistics& statistics,
+      unsigned int numPixelsX,
+      unsigned int numPixelsY,
+      Iter3D points3DBegin,
+      Iter3D points3DEnd,
+      Iter2D points2DBegin,
+      typename Intrinsics::FloatType maxResidual,
+      typename Intrinsics::FloatType inlierProbability,
+      typename Intrinsics::FloatType requiredConfidence = 0.999,
+      unsigned int minConsensusSetSize = 0,
+      std::size_t numberOfCandidates = 4,
+      std::size_t numberOfThreads = 0);
+
+
     /**
      * This function estimates pinhole camera intrinsic and extrinsic
      * parameters based on corresponding points in 2D image
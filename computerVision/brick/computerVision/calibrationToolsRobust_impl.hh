@@ -21,9 +21,14 @@
 // #include <brick/computerVision/calibrationToolsRobust.hh>
 
 
+#include <algorithm>
+#include <cmath>
+#include <brick/common/parallel.hh>
 #include <brick/computerVision/calibrationTools.hh>
 #include <brick/computerVision/cameraIntrinsicsPlumbBob.hh>
 #include <brick/computerVision/ransacClassInterface.hh>
+#include <brick/portability/timeUtilities.hh>
+#include <brick/random/pseudoRandom.hh>
 
 namespace brick {
 
@@ -303,6 +308,318 @@ namespace brick {
         intrinsics = result.intrinsics;
       }
 
+
+      // One hypothesis (or refined candidate) of the parallel robust
+      // calibration, along with its score.
+      template <class Intrinsics>
+      struct CTRHypothesis {
+        typedef typename Intrinsics::FloatType FloatType;
+
+        CTRResult<Intrinsics> model;
+        std::vector<std::size_t> sampleIndices;
+        std::vector<unsigned char> inlierFlags;
+        std::size_t consensusSetSize;
+        FloatType inlierError;
+        bool isValid;
+
+        CTRHypothesis()
+          : model(), sampleIndices(), inlierFlags(), consensusSetSize(0),
+            inlierError(0), isValid(false) {}
+
+        // Orders hypotheses from best to worst.
+        bool
+        isBetterThan(CTRHypothesis const& other) const {
+          if(isValid != other.isValid) {
+            return isValid;
+          }
+          if(consensusSetSize != other.consensusSetSize) {
+            return consensusSetSize > other.consensusSetSize;
+          }
+          return inlierError < other.inlierError;
+        }
+      };
+
+
+      // Scratch space for fitting, reused from one hypothesis to the
+      // next so that each fit doesn't reallocate.
+      template <class FloatType>
+      struct CTRWorkspace {
+        std::vector< brick::numeric::Vector3D<FloatType> > worldPoints;
+        std::vector< brick::numeric::Vector2D<FloatType> > imagePoints;
+        std::vector<std::size_t> indices;
+      };
+
+
+      // Fits hypothesis.model to the samples listed in
+      // workspace.indices, then scores it against every sample.  If
+      // the fit fails, the hypothesis is marked invalid.
+      template <class Intrinsics>
+      void
+      fitAndScoreHypothesis(
+        CTRHypothesis<Intrinsics>& hypothesis,
+        CTRWorkspace<typename Intrinsics::FloatType>& workspace,
+        std::vector< CTRSamplePair<typename Intrinsics::FloatType> > const&
+          samples,
+        Intrinsics const& initialIntrinsics,
+        typename Intrinsics::FloatType maxResidual)
+      {
+        typedef typename Intrinsics::FloatType FloatType;
+        std::size_t const numberOfIndices = workspace.indices.size();
+        workspace.worldPoints.resize(numberOfIndices);
+        workspace.imagePoints.resize(numberOfIndices);
+        for(std::size_t ii = 0; ii < numberOfIndices; ++ii) {
+          workspace.worldPoints[ii] = samples[workspace.indices[ii]].point3D;
+          workspace.imagePoints[ii] = samples[workspace.indices[ii]].point2D;
+        }
+
+        hypothesis.model.intrinsics = initialIntrinsics;
+        try {
+          estimateCameraParameters(
+            hypothesis.model.intrinsics, hypothesis.model.cameraTworld,
+            hypothesis.model.statistics,
+            initialIntrinsics.getNumPixelsX(),
+            initialIntrinsics.getNumPixelsY(),
+            workspace.worldPoints.begin(), workspace.worldPoints.end(),
+            workspace.imagePoints.begin());
+        } catch(brick::common::ValueException const&) {
+          hypothesis.isValid = false;
+          hypothesis.consensusSetSize = 0;
+          return;
+        }
+
+        // Compare squared residuals, so there's no square root per
+        // sample.
+        FloatType const threshold = maxResidual * maxResidual;
+        hypothesis.inlierFlags.resize(samples.size());
+        hypothesis.consensusSetSize = 0;
+        hypothesis.inlierError = FloatType(0);
+        for(std::size_t ii = 0; ii < samples.size(); ++ii) {
+          brick::numeric::Vector2D<FloatType> difference =
+            hypothesis.model.intrinsics.project(
+              hypothesis.model.cameraTworld * samples[ii].point3D)
+            - samples[ii].point2D;
+          FloatType const squaredResidual =
+            difference.x() * difference.x() + difference.y() * difference.y();
+          bool const isInlier = squaredResidual < threshold;
+          hypothesis.inlierFlags[ii] = isInlier;
+          if(isInlier) {
+            ++hypothesis.consensusSetSize;
+            hypothesis.inlierError += squaredResidual;
+          }
+        }
+        hypothesis.isValid = true;
+      }
+
+
+      // Repeatedly refits a hypothesis to its own consensus set,
+      // until the consensus set stops growing.
+      template <class Intrinsics>
+      void
+      refineHypothesis(
+        CTRHypothesis<Intrinsics>& hypothesis,
+        CTRWorkspace<typename Intrinsics::FloatType>& workspace,
+        std::vector< CTRSamplePair<typename Intrinsics::FloatType> > const&
+          samples,
+        Intrinsics const& initialIntrinsics,
+        typename Intrinsics::FloatType maxResidual,
+        std::size_t sampleSize)
+      {
+        std::size_t const maximumIterations = 10;
+        CTRHypothesis<Intrinsics> trial;
+        for(std::size_t iteration = 0; iteration < maximumIterations;
+            ++iteration) {
+          if(hypothesis.consensusSetSize < sampleSize) {
+            return;
+          }
+          workspace.indices.clear();
+          for(std::size_t ii = 0; ii < samples.size(); ++ii) {
+            if(hypothesis.inlierFlags[ii]) {
+              workspace.indices.push_back(ii);
+            }
+          }
+          fitAndScoreHypothesis(trial, workspace, samples,
+                                initialIntrinsics, maxResidual);
+          if(!trial.isBetterThan(hypothesis)) {
+            return;
+          }
+          bool const isConverged =
+            (trial.inlierFlags == hypothesis.inlierFlags);
+          std::swap(hypothesis.model, trial.model);
+          std::swap(hypothesis.inlierFlags, trial.inlierFlags);
+          hypothesis.consensusSetSize = trial.consensusSetSize;
+          hypothesis.inlierError = trial.inlierError;
+          if(isConverged) {
+            return;
+          }
+        }
+      }
+
+
+      template <class Intrinsics, class Iter3D, class Iter2D>
+      void
+      estimateCameraParametersGeneralRobustParallel(
+        Intrinsics& intrinsics,
+        brick::numeric::Transform3D<typename Intrinsics::FloatType>&
+          cameraTworld,
+        RobustCalibrationStatistics& statistics,
+        unsigned int numPixelsX,
+        unsigned int numPixelsY,
+        unsigned int numSamplesRequired,
+        Iter3D points3DBegin,
+        Iter3D points3DEnd,
+        Iter2D points2DBegin,
+        typename Intrinsics::FloatType maxResidual,
+        typename Intrinsics::FloatType inlierProbability,
+        typename Intrinsics::FloatType requiredConfidence,
+        unsigned int minConsensusSetSize,
+        std::size_t numberOfCandidates,
+        std::size_t numberOfThreads)
+      {
+        typedef typename Intrinsics::FloatType FloatType;
+        double const startTime = brick::portability::getCurrentTime();
+
+        if((requiredConfidence < 0.0) || (requiredConfidence >= 1.0)) {
+          BRICK_THROW(common::ValueException,
+                      "estimateCameraParametersRobustParallel()",
+                      "Probability value requiredConfidence is out of range.");
+        }
+        if((inlierProbability <= 0.0) || (inlierProbability >= 1.0)) {
+          BRICK_THROW(common::ValueException,
+                      "estimateCameraParametersRobustParallel()",
+                      "Probability value inlierProbability is out of range.");
+        }
+        std::vector< CTRSamplePair<FloatType> > samples =
+          buildSampleVector<FloatType>(points3DBegin, points3DEnd,
+                                       points2DBegin);
+        if(samples.size() < numSamplesRequired) {
+          BRICK_THROW(common::ValueException,
+                      "estimateCameraParametersRobustParallel()",
+                      "Not enough points to estimate camera parameters.");
+        }
+        if(numberOfThreads == 0) {
+          numberOfThreads = brick::common::getDefaultNumberOfThreads();
+        }
+        numberOfCandidates = std::max(numberOfCandidates, std::size_t(1));
+
+        // Number of hypotheses and minimum consensus size are chosen
+        // exactly as class Ransac chooses them.
+        double const singlePickDisconfidence = 1.0 - std::pow(
+          static_cast<double>(inlierProbability),
+          static_cast<double>(numSamplesRequired));
+        std::size_t const numberOfHypotheses = std::max(
+          static_cast<std::size_t>(
+            std::ceil(std::log(1.0 - requiredConfidence)
+                      / std::log(singlePickDisconfidence)) + 0.5),
+          std::size_t(1));
+        if(minConsensusSetSize == 0) {
+          int extraSamples = static_cast<int>(
+            std::log(1.0 - requiredConfidence) / std::log(0.5) + 0.5);
+          minConsensusSetSize =
+            numSamplesRequired + static_cast<unsigned int>(
+              std::max(extraSamples, 0));
+        }
+
+        intrinsics.setNumPixelsX(numPixelsX);
+        intrinsics.setNumPixelsY(numPixelsY);
+
+        // Draw, fit, and score hypotheses one batch at a time.  Each
+        // worker handles every numberOfThreads-th hypothesis of the
+        // batch, using its own workspace.  Random samples are drawn
+        // serially, so results don't depend on thread timing.
+        std::size_t const batchSize = 4 * numberOfThreads;
+        std::vector< CTRHypothesis<Intrinsics> > hypotheses;
+        hypotheses.reserve(numberOfHypotheses);
+        std::vector< CTRWorkspace<FloatType> > workspaces(
+          std::max(numberOfThreads, numberOfCandidates));
+        std::vector<std::size_t> shuffledIndices(samples.size());
+        for(std::size_t ii = 0; ii < shuffledIndices.size(); ++ii) {
+          shuffledIndices[ii] = ii;
+        }
+        brick::random::PseudoRandom pseudoRandom;
+        std::size_t bestConsensusSetSize = 0;
+        while(hypotheses.size() < numberOfHypotheses
+              && bestConsensusSetSize <= minConsensusSetSize) {
+          std::size_t const firstHypothesis = hypotheses.size();
+          std::size_t const endHypothesis =
+            std::min(firstHypothesis + batchSize, numberOfHypotheses);
+          hypotheses.resize(endHypothesis);
+          for(std::size_t hh = firstHypothesis; hh < endHypothesis; ++hh) {
+            for(std::size_t ii = 0; ii < numSamplesRequired; ++ii) {
+              int jj = pseudoRandom.uniformInt(
+                static_cast<int>(ii), static_cast<int>(samples.size()));
+              std::swap(shuffledIndices[ii], shuffledIndices[jj]);
+            }
+            hypotheses[hh].sampleIndices.assign(
+              shuffledIndices.begin(),
+              shuffledIndices.begin() + numSamplesRequired);
+          }
+
+          std::size_t const numberOfWorkers =
+            std::min(numberOfThreads, endHypothesis - firstHypothesis);
+          brick::common::executeInParallel(
+            numberOfWorkers,
+            [&](std::size_t workerIndex) {
+              CTRWorkspace<FloatType>& workspace = workspaces[workerIndex];
+              for(std::size_t hh = firstHypothesis + workerIndex;
+                  hh < endHypothesis; hh += numberOfWorkers) {
+                workspace.indices = hypotheses[hh].sampleIndices;
+                fitAndScoreHypothesis(hypotheses[hh], workspace, samples,
+                                      intrinsics, maxResidual);
+              }
+            },
+            numberOfThreads);
+
+          for(std::size_t hh = firstHypothesis; hh < endHypothesis; ++hh) {
+            bestConsensusSetSize = std::max(bestConsensusSetSize,
+                                            hypotheses[hh].consensusSetSize);
+          }
+        }
+        double const hypothesisEndTime = brick::portability::getCurrentTime();
+
+        // Refine the best few hypotheses concurrently.
+        numberOfCandidates = std::min(numberOfCandidates, hypotheses.size());
+        std::partial_sort(
+          hypotheses.begin(), hypotheses.begin() + numberOfCandidates,
+          hypotheses.end(),
+          [](CTRHypothesis<Intrinsics> const& hypothesis0,
+             CTRHypothesis<Intrinsics> const& hypothesis1) {
+            return hypothesis0.isBetterThan(hypothesis1);
+          });
+        if(!hypotheses[0].isValid) {
+          BRICK_THROW(common::ValueException,
+                      "estimateCameraParametersRobustParallel()",
+                      "Unable to estimate camera parameters from any "
+                      "random sample.");
+        }
+        brick::common::executeInParallel(
+          numberOfCandidates,
+          [&](std::size_t candidateIndex) {
+            if(hypotheses[candidateIndex].isValid) {
+              refineHypothesis(hypotheses[candidateIndex],
+                               workspaces[candidateIndex], samples,
+                               intrinsics, maxResidual, numSamplesRequired);
+            }
+          },
+          numberOfThreads);
+
+        std::size_t bestIndex = 0;
+        for(std::size_t cc = 1; cc < numberOfCandidates; ++cc) {
+          if(hypotheses[cc].isBetterThan(hypotheses[bestIndex])) {
+            bestIndex = cc;
+          }
+        }
+        cameraTworld = hypotheses[bestIndex].model.cameraTworld;
+        intrinsics = hypotheses[bestIndex].model.intrinsics;
+
+        double const endTime = brick::portability::getCurrentTime();
+        statistics.numberOfHypotheses = hypotheses.size();
+        statistics.numberOfCandidates = numberOfCandidates;
+        statistics.consensusSetSize = hypotheses[bestIndex].consensusSetSize;
+        statistics.hypothesisTime = hypothesisEndTime - startTime;
+        statistics.refinementTime = endTime - hypothesisEndTime;
+        statistics.totalTime = endTime - startTime;
+      }
+
     } // namespace privateCode
 
 
@@ -353,6 +670,57 @@ namespace brick {
         verbosity);
     }
 
+    // The general case is not implemented.
+    template <class Intrinsics, class Iter3D, class Iter2D>
+    void
+    estimateCameraParametersRobustParallel(
+      Intrinsics& /* intrinsics */,
+      brick::numeric::Transform3D<typename Intrinsics::FloatType>&
+        /* cameraTworld */,
+      RobustCalibrationStatistics& /* statistics */,
+      unsigned int /* numPixelsX */,
+      unsigned int /* numPixelsY */,
+      Iter3D /* points3DBegin */,
+      Iter3D /* points3DEnd */,
+      Iter2D /* points2DBegin */,
+      typename Intrinsics::FloatType /* maxResidual */,
+      typename Intrinsics::FloatType /* inlierProbability */,
+      typename Intrinsics::FloatType /* requiredConfidence */,
+      unsigned int /* minConsensusSetSize */,
+      std::size_t /* numberOfCandidates */,
+      std::size_t /* numberOfThreads */)
+    {
+      BRICK_THROW(common::NotImplementedException,
+                "estimateCameraParametersRobustParallel()",
+                "This function template must be further specialized before "
+                "you use it with this type, however specializing it is very "
+                "easy to do.");
+    }
+
+
+    template <class Iter3D, class Iter2D>
+    void
+    estimateCameraParametersRobustParallel(
+      CameraIntrinsicsPlumbBob<double>& intrinsics,
+      brick::numeric::Transform3D<double>& cameraTworld,
+      RobustCalibrationStatistics& statistics,
+      unsigned int numPixelsX, unsigned int numPixelsY,
+      Iter3D points3DBegin, Iter3D points3DEnd,
+      Iter2D points2DBegin,
+      double maxResidual,
+      double inlierProbability,
+      double requiredConfidence,
+      unsigned int minConsensusSetSize = 0,
+      std::size_t numberOfCandidates = 4,
+      std::size_t numberOfThreads = 0)
+    {
+      privateCode::estimateCameraParametersGeneralRobustParallel(
+        intrinsics, cameraTworld, statistics, numPixelsX, numPixelsY, 8,
+        points3DBegin, points3DEnd, points2DBegin, maxResidual,
+        inlierProbability, requiredConfidence, minConsensusSetSize,
+        numberOfCandidates, numberOfThreads);
+    }
+
 
     template <class FloatType, class Iter3D, class Iter2D>
     void
@@ -124,6 +124,56 @@ namespace brick {
                FloatType autoUpperThresholdFactor = 3.0,
                FloatType autoLowerThresholdFactor = 0.0);
 
+
+    /**
+     * This function applies the canny edge detector to the input
+     * image, producing exactly the same result as applyCanny(), but
+     * without allocating full-size intermediate images for the
+     * gradient components, gradient magnitude, and non-maximum
+     * suppression result.  Sobel filtering, magnitude computation,
+     * direction quantization, and non-maximum suppression are fused
+     * into a single sweep over a three-row rolling window, and the
+     * surviving edge candidates are collected into a compact list on
+     * which the hysteresis step operates.  If the input image is
+     * GRAY8 and gaussianSize is zero, the gradient computation is
+     * carried out in 16-bit integer arithmetic, which the compiler is
+     * able to vectorize.
+     *
+     * The sweep can optionally be split into horizontal bands that
+     * are processed concurrently.  The result does not depend on the
+     * number of bands.
+     *
+     * @param inputImage This argument is the image to be edge-detected.
+     *
+     * @param gaussianSize See applyCanny().
+     *
+     * @param upperThreshold See applyCanny().
+     *
+     * @param lowerThreshold See applyCanny().
+     *
+     * @param autoUpperThresholdFactor See applyCanny().
+     *
+     * @param autoLowerThresholdFactor See applyCanny().
+     *
+     * @param numberOfBands This argument specifies how many
+     * horizontal bands the image should be divided into for parallel
+     * processing.  Setting it to 1 processes the whole image in the
+     * calling thread.  Setting it to 0 selects one band per hardware
+     * thread.
+     *
+     * @return The return value is a binary image in which all edge
+     * pixels are true, and all non-edge pixels are false.
+     */
+    template <class FloatType, ImageFormat FORMAT>
+    Image<GRAY1>
+    applyCannyFused(const Image<FORMAT>& inputImage,
+                    unsigned int gaussianSize = 5,
+                    FloatType upperThreshold = 0.0,
+                    FloatType lowerThreshold = 0.0,
+                    FloatType autoUpperThresholdFactor = 3.0,
+                    FloatType autoLowerThresholdFactor = 0.0,
+                    unsigned int numberOfBands = 1);
+
   } // namespace computerVision
 
 } // namespace brick
@@ -18,8 +18,11 @@
 //
 // #include <brick/computerVision/canny.hh>
 
+#include <algorithm>
 #include <limits>
 #include <list>
+#include <vector>
+#include <brick/common/parallel.hh>
 #include <brick/computerVision/imageFilter.hh>
 #include <brick/computerVision/kernels.hh>
 #include <brick/computerVision/nonMaximumSuppress.hh>
@@ -141,6 +144,439 @@ namespace brick {
         return edgeImage;
       }
 
+
+      // This struct records one pixel that survived non-maximum
+      // suppression in applyCannyFused().
+      template <class FloatType>
+      struct CannyCandidate {
+        size_t index;
+        FloatType magnitude;
+      };
+
+
+      // This function computes one row of sobel gradients for
+      // applyCannyFused(), exactly reproducing the border handling
+      // of applySobelX() and applySobelY().  Argument previousRow
+      // should be null for the first image row, and argument nextRow
+      // should be null for the last image row.
+      template <class SourceType, class GradientType>
+      void
+      cannyGradientRow(SourceType const* previousRow,
+                       SourceType const* currentRow,
+                       SourceType const* nextRow,
+                       size_t columns,
+                       GradientType* gradX,
+                       GradientType* gradY)
+      {
+        const size_t last = columns - 1;
+
+        // Horizontal gradient.
+        if(previousRow == 0 || nextRow == 0) {
+          gradX[0] = static_cast<GradientType>(
+            8 * (currentRow[1] - currentRow[0]));
+          for(size_t column = 1; column < last; ++column) {
+            gradX[column] = static_cast<GradientType>(
+              4 * (currentRow[column + 1] - currentRow[column - 1]));
+          }
+          gradX[last] = static_cast<GradientType>(
+            8 * (currentRow[last] - currentRow[last - 1]));
+        } else {
+          gradX[0] = static_cast<GradientType>(
+            2 * (previousRow[1] - previousRow[0])
+            + 4 * (currentRow[1] - currentRow[0])
+            + 2 * (nextRow[1] - nextRow[0]));
+          for(size_t column = 1; column < last; ++column) {
+            gradX[column] = static_cast<GradientType>(
+              (previousRow[column + 1] - previousRow[column - 1])
+              + 2 * (currentRow[column + 1] - currentRow[column - 1])
+              + (nextRow[column + 1] - nextRow[column - 1]));
+          }
+          gradX[last] = static_cast<GradientType>(
+            2 * (previousRow[last] - previousRow[last - 1])
+            + 4 * (currentRow[last] - currentRow[last - 1])
+            + 2 * (nextRow[last] - nextRow[last - 1]));
+        }
+
+        // Vertical gradient.  At the top and bottom of the image we
+        // difference against the current row, just like applySobelY().
+        if(previousRow == 0 || nextRow == 0) {
+          SourceType const* upperRow = (previousRow == 0) ? currentRow : previousRow;
+          SourceType const* lowerRow = (nextRow == 0) ? currentRow : nextRow;
+          gradY[0] = static_cast<GradientType>(
+            8 * (lowerRow[0] - upperRow[0]));
+          for(size_t column = 1; column < last; ++column) {
+            gradY[column] = static_cast<GradientType>(
+              2 * (lowerRow[column - 1] - upperRow[column - 1])
+              + 4 * (lowerRow[column] - upperRow[column])
+              + 2 * (lowerRow[column + 1] - upperRow[column + 1]));
+          }
+          gradY[last] = static_cast<GradientType>(
+            8 * (lowerRow[last] - upperRow[last]));
+        } else {
+          gradY[0] = static_cast<GradientType>(
+            4 * (nextRow[0] - previousRow[0]));
+          for(size_t column = 1; column < last; ++column) {
+            gradY[column] = static_cast<GradientType>(
+              (nextRow[column - 1] - previousRow[column - 1])
+              + 2 * (nextRow[column] - previousRow[column])
+              + (nextRow[column + 1] - previousRow[column + 1]));
+          }
+          gradY[last] = static_cast<GradientType>(
+            4 * (nextRow[last] - previousRow[last]));
+        }
+      }
+
+
+      // This function computes one row of gradient magnitudes from
+      // floating point gradients.
+      template <class FloatType>
+      void
+      cannyMagnitudeRow(FloatType const* gradX, FloatType const* gradY,
+                        size_t columns, FloatType* magnitude)
+      {
+        for(size_t column = 0; column < columns; ++column) {
+          magnitude[column] = brick::common::squareRoot(
+            gradX[column] * gradX[column] + gradY[column] * gradY[column]);
+        }
+      }
+
+
+      // This function computes one row of gradient magnitudes from
+      // integer gradients.  The sum of squares is exact in 32 bits,
+      // and is exactly representable as a float or double, so the
+      // result matches the floating point computation bit for bit.
+      template <class FloatType>
+      void
+      cannyMagnitudeRow(brick::common::Int16 const* gradX,
+                        brick::common::Int16 const* gradY,
+                        size_t columns, FloatType* magnitude)
+      {
+        for(size_t column = 0; column < columns; ++column) {
+          brick::common::Int32 sumOfSquares =
+            static_cast<brick::common::Int32>(gradX[column]) * gradX[column]
+            + static_cast<brick::common::Int32>(gradY[column]) * gradY[column];
+          magnitude[column] = brick::common::squareRoot(
+            static_cast<FloatType>(sumOfSquares));
+        }
+      }
+
+
+      // This function does non-maximum suppression on one row for
+      // applyCannyFused(), appending surviving pixels to the
+      // candidate list.  Direction quantization follows
+      // nonMaximumSuppress() exactly.
+      template <class FloatType, class GradientType>
+      void
+      cannySuppressRow(FloatType const* magnitudeAbove,
+                       FloatType const* magnitude,
+                       FloatType const* magnitudeBelow,
+                       GradientType const* gradX,
+                       GradientType const* gradY,
+                       size_t columns,
+                       size_t rowStartIndex,
+                       FloatType minimumMagnitude,
+                       std::vector< CannyCandidate<FloatType> >& candidates)
+      {
+        const size_t columnsMinusOne = columns - 1;
+        for(size_t column = 1; column < columnsMinusOne; ++column) {
+          FloatType centerValue = magnitude[column];
+          if(!(centerValue > minimumMagnitude)) {
+            continue;
+          }
+          double gradXComponent = static_cast<double>(gradX[column]);
+          double gradYComponent = static_cast<double>(gradY[column]);
+          FloatType neighbor0;
+          FloatType neighbor1;
+          if(gradXComponent == 0.0) {
+            neighbor0 = magnitudeBelow[column];
+            neighbor1 = magnitudeAbove[column];
+          } else if(brick::common::absoluteValue(gradXComponent)
+                    >= brick::common::absoluteValue(gradYComponent)) {
+            double indicator = gradYComponent / gradXComponent;
+            if(indicator >= 0.5) {
+              neighbor0 = magnitudeBelow[column + 1];
+              neighbor1 = magnitudeAbove[column - 1];
+            } else if(indicator < -0.5) {
+              neighbor0 = magnitudeBelow[column - 1];
+              neighbor1 = magnitudeAbove[column + 1];
+            } else {
+              neighbor0 = magnitude[column + 1];
+              neighbor1 = magnitude[column - 1];
+            }
+          } else {
+            double indicator = gradXComponent / gradYComponent;
+            if(indicator >= 0.5) {
+              neighbor0 = magnitudeBelow[column + 1];
+              neighbor1 = magnitudeAbove[column - 1];
+            } else if(indicator < -0.5) {
+              neighbor0 = magnitudeBelow[column - 1];
+              neighbor1 = magnitudeAbove[column + 1];
+            } else {
+              neighbor0 = magnitudeBelow[column];
+              neighbor1 = magnitudeAbove[column];
+            }
+          }
+          if(centerValue > neighbor0 && centerValue > neighbor1) {
+            CannyCandidate<FloatType> candidate;
+            candidate.index = rowStartIndex + column;
+            candidate.magnitude = centerValue;
+            candidates.push_back(candidate);
+          }
+        }
+      }
+
+
+      // This function does the row-pipelined part of
+      // applyCannyFused() for one horizontal band of the image.  It
+      // computes gradient magnitudes for rows [firstRow, endRow),
+      // accumulates per-row statistics for the automatic threshold
+      // calculation, and records non-maximum suppression survivors
+      // for those of rows [firstRow, endRow) that are not on the
+      // image border.  Only three rows of gradient data are held in
+      // memory at any time.
+      template <class FloatType, class SourceType, class GradientType>
+      void
+      cannySweepBand(SourceType const* sourceData,
+                     size_t sourceRowStep,
+                     size_t rows,
+                     size_t columns,
+                     size_t firstRow,
+                     size_t endRow,
+                     bool isAutoThreshold,
+                     size_t startRow,
+                     size_t stopRow,
+                     size_t startColumn,
+                     size_t stopColumn,
+                     FloatType minimumMagnitude,
+                     FloatType* rowSums,
+                     FloatType* rowSumsOfSquares,
+                     std::vector< CannyCandidate<FloatType> >& candidates)
+      {
+        // Rolling window of three rows.
+        std::vector<GradientType> gradXBuffer(3 * columns);
+        std::vector<GradientType> gradYBuffer(3 * columns);
+        std::vector<FloatType> magnitudeBuffer(3 * columns);
+
+        // Suppression at row r needs magnitudes from rows r - 1 and
+        // r + 1, so we have to start one row early and finish one
+        // row late.
+        size_t computeBegin = (firstRow == 0) ? 0 : firstRow - 1;
+        size_t computeEnd = std::min(endRow + 1, rows);
+        for(size_t row = computeBegin; row < computeEnd; ++row) {
+          size_t slot = (row % 3) * columns;
+          SourceType const* currentRow = sourceData + row * sourceRowStep;
+          SourceType const* previousRow =
+            (row == 0) ? 0 : currentRow - sourceRowStep;
+          SourceType const* nextRow =
+            (row + 1 == rows) ? 0 : currentRow + sourceRowStep;
+          GradientType* gradX = &(gradXBuffer[slot]);
+          GradientType* gradY = &(gradYBuffer[slot]);
+          FloatType* magnitude = &(magnitudeBuffer[slot]);
+
+          cannyGradientRow(previousRow, currentRow, nextRow, columns,
+                           gradX, gradY);
+          cannyMagnitudeRow(gradX, gradY, columns, magnitude);
+
+          if(isAutoThreshold) {
+            // Zero out borders of images to avoid spurious edges.
+            if(row < startRow || row >= stopRow) {
+              std::fill(magnitude, magnitude + columns, FloatType(0.0));
+            } else {
+              std::fill(magnitude, magnitude + startColumn, FloatType(0.0));
+              std::fill(magnitude + stopColumn, magnitude + columns,
+                        FloatType(0.0));
+
+              // Accumulate statistics for threshold selection, but
+              // only for rows this band is responsible for.
+              if(row >= firstRow && row < endRow) {
+                FloatType subSum = 0.0;
+                FloatType subSumOfSquares = 0.0;
+                for(size_t column = startColumn; column < stopColumn;
+                    ++column) {
+                  FloatType testValue = magnitude[column];
+                  subSum += testValue;
+                  subSumOfSquares += testValue * testValue;
+                }
+                rowSums[row] = subSum;
+                rowSumsOfSquares[row] = subSumOfSquares;
+              }
+            }
+          }
+
+          // Now that this row is available, we can suppress the row
+          // above it.
+          if(row >= 2) {
+            size_t centerRow = row - 1;
+            if(centerRow >= firstRow && centerRow < endRow) {
+              size_t aboveSlot = ((centerRow - 1) % 3) * columns;
+              size_t centerSlot = (centerRow % 3) * columns;
+              cannySuppressRow(
+                &(magnitudeBuffer[aboveSlot]), &(magnitudeBuffer[centerSlot]),
+                magnitude, &(gradXBuffer[centerSlot]),
+                &(gradYBuffer[centerSlot]), columns, centerRow * columns,
+                minimumMagnitude, candidates);
+            }
+          }
+        }
+      }
+
+
+      // This function does the hysteresis step of applyCannyFused().
+      // It is equivalent to traceEdges(), but visits only pixels
+      // that survived non-maximum suppression.
+      template <class FloatType>
+      Image<GRAY1>
+      traceEdgeCandidates(
+        std::vector< CannyCandidate<FloatType> > const& candidates,
+        size_t rows, size_t columns,
+        FloatType lowerThreshold, FloatType upperThreshold)
+      {
+        Image<GRAY1> edgeImage(rows, columns);
+        edgeImage = false;
+
+        // Mark every candidate that is strong enough to be part of an
+        // edge, and collect the seeds from which edges are grown.
+        brick::numeric::Array2D<brick::common::UnsignedInt8> isCandidate(
+          rows, columns);
+        isCandidate = 0;
+        std::vector<size_t> stack;
+        for(size_t ii = 0; ii < candidates.size(); ++ii) {
+          if(candidates[ii].magnitude > lowerThreshold) {
+            size_t index0 = candidates[ii].index;
+            if(candidates[ii].magnitude > upperThreshold) {
+              edgeImage[index0] = true;
+              stack.push_back(index0);
+            } else {
+              isCandidate[index0] = 1;
+            }
+          }
+        }
+
+        // Grow edges outward from the seeds.  Candidates are never on
+        // the image border, so all neighbors are in bounds.
+        const std::ptrdiff_t stride = static_cast<std::ptrdiff_t>(columns);
+        const std::ptrdiff_t neighborOffsets[8] = {
+          -stride - 1, -stride, -stride + 1, -1,
+          1, stride - 1, stride, stride + 1};
+        while(!stack.empty()) {
+          size_t index0 = stack.back();
+          stack.pop_back();
+          for(size_t ii = 0; ii < 8; ++ii) {
+            size_t neighborIndex = static_cast<size_t>(
+              static_cast<std::ptrdiff_t>(index0) + neighborOffsets[ii]);
+            if(isCandidate[neighborIndex]) {
+              isCandidate[neighborIndex] = 0;
+              edgeImage[neighborIndex] = true;
+              stack.push_back(neighborIndex);
+            }
+          }
+        }
+        return edgeImage;
+      }
+
+
+      // This function runs the banded sweep of applyCannyFused(),
+      // optionally in parallel, and concatenates the results.
+      template <class FloatType, class SourceType, class GradientType>
+      void
+      cannySweep(SourceType const* sourceData,
+                 size_t sourceRowStep,
+                 size_t rows,
+                 size_t columns,
+                 unsigned int numberOfBands,
+                 bool isAutoThreshold,
+                 size_t startRow,
+                 size_t stopRow,
+                 size_t startColumn,
+                 size_t stopColumn,
+                 FloatType minimumMagnitude,
+                 std::vector<FloatType>& rowSums,
+                 std::vector<FloatType>& rowSumsOfSquares,
+                 std::vector< CannyCandidate<FloatType> >& candidates)
+      {
+        if(numberOfBands == 0) {
+          numberOfBands = static_cast<unsigned int>(
+            brick::common::getDefaultNumberOfThreads());
+        }
+        numberOfBands = static_cast<unsigned int>(
+          std::min(static_cast<size_t>(numberOfBands), rows));
+
+        rowSums.assign(rows, FloatType(0.0));
+        rowSumsOfSquares.assign(rows, FloatType(0.0));
+        std::vector< std::vector< CannyCandidate<FloatType> > > bandCandidates(
+          numberOfBands);
+        brick::common::executeInParallel(
+          numberOfBands,
+          [&](size_t band) {
+            size_t firstRow = (band * rows) / numberOfBands;
+            size_t endRow = ((band + 1) * rows) / numberOfBands;
+            cannySweepBand<FloatType, SourceType, GradientType>(
+              sourceData, sourceRowStep, rows, columns, firstRow, endRow,
+              isAutoThreshold, startRow, stopRow, startColumn, stopColumn,
+              minimumMagnitude, &(rowSums[0]), &(rowSumsOfSquares[0]),
+              bandCandidates[band]);
+          },
+          numberOfBands);
+
+        size_t numberOfCandidates = 0;
+        for(size_t band = 0; band < numberOfBands; ++band) {
+          numberOfCandidates += bandCandidates[band].size();
+        }
+        candidates.clear();
+        candidates.reserve(numberOfCandidates);
+        for(size_t band = 0; band < numberOfBands; ++band) {
+          candidates.insert(candidates.end(), bandCandidates[band].begin(),
+                            bandCandidates[band].end());
+        }
+      }
+
+
+      // This function runs the sweep of applyCannyFused() directly on
+      // the input image using integer gradients, if the input format
+      // allows.  This generic version handles formats that don't
+      // allow, and simply returns false.
+      template <class FloatType, ImageFormat FORMAT>
+      bool
+      cannySweepInteger(
+        const Image<FORMAT>& /* inputImage */,
+        unsigned int /* numberOfBands */,
+        bool /* isAutoThreshold */,
+        size_t /* startRow */, size_t /* stopRow */,
+        size_t /* startColumn */, size_t /* stopColumn */,
+        FloatType /* minimumMagnitude */,
+        std::vector<FloatType>& /* rowSums */,
+        std::vector<FloatType>& /* rowSumsOfSquares */,
+        std::vector< CannyCandidate<FloatType> >& /* candidates */)
+      {
+        return false;
+      }
+
+
+      // This overload handles 8-bit input.  Gradients of 8-bit pixels
+      // fit comfortably in 16 bits, and are exactly representable in
+      // FloatType, so the result matches the floating point path.
+      template <class FloatType>
+      bool
+      cannySweepInteger(
+        const Image<GRAY8>& inputImage,
+        unsigned int numberOfBands,
+        bool isAutoThreshold,
+        size_t startRow, size_t stopRow,
+        size_t startColumn, size_t stopColumn,
+        FloatType minimumMagnitude,
+        std::vector<FloatType>& rowSums,
+        std::vector<FloatType>& rowSumsOfSquares,
+        std::vector< CannyCandidate<FloatType> >& candidates)
+      {
+        cannySweep<FloatType, brick::common::UnsignedInt8,
+                   brick::common::Int16>(
+          inputImage.data(), inputImage.getRowStep(),
+          inputImage.rows(), inputImage.columns(), numberOfBands,
+          isAutoThreshold, startRow, stopRow, startColumn, stopColumn,
+          minimumMagnitude, rowSums, rowSumsOfSquares, candidates);
+        return true;
+      }
+
     } // namespace privateCode
     /// @endcond
 
@@ -155,11 +591,12 @@ namespace brick {
                FloatType autoUpperThresholdFactor,
                FloatType autoLowerThresholdFactor)
     {
-      brick::numeric::Array2D<FloatType> gradientX;
-      brick::numeric::Array2D<FloatType> gradientY;
-      return applyCanny(inputImage, gradientX, gradientY, gaussianSize,
-                        upperThreshold, lowerThreshold,
-                        autoUpperThresholdFactor, autoLowerThresholdFactor);
+      // The caller doesn't want gradient images, so we can avoid
+      // computing them.
+      return applyCannyFused(inputImage, gaussianSize,
+                             upperThreshold, lowerThreshold,
+                             autoUpperThresholdFactor,
+                             autoLowerThresholdFactor, 1);
     }
 
 
@@ -303,13 +740,13 @@ namespace brick {
         if(upperThreshold <= 0.0) {
           upperThreshold =
             gradientMean + autoUpperThresholdFactor * gradientSigma;
-          upperThreshold = std::max(upperThreshold, 0.0);
+          upperThreshold = std::max(upperThreshold, FloatType(0.0));
         }
         if(lowerThreshold <= 0.0) {
           lowerThreshold =
             gradientMean + autoLowerThresholdFactor * gradientSigma;
           lowerThreshold = std::min(lowerThreshold, upperThreshold);
-          lowerThreshold = std::max(lowerThreshold, 0.0);
+          lowerThreshold = std::max(lowerThreshold, FloatType(0.0));
         }
 
         // Now zero out gradients that for sure can never be edges.
@@ -329,6 +766,128 @@ namespace brick {
       return edgeImage;
     }
 
+
+    // This function applies the canny edge operator without
+    // allocating full-size intermediate images.
+    template <class FloatType, ImageFormat FORMAT>
+    Image<GRAY1>
+    applyCannyFused(const Image<FORMAT>& inputImage,
+                    unsigned int gaussianSize,
+                    FloatType upperThreshold,
+                    FloatType lowerThreshold,
+                    FloatType autoUpperThresholdFactor,
+                    FloatType autoLowerThresholdFactor,
+                    unsigned int numberOfBands)
+    {
+      // Argument checking.
+      if(inputImage.rows() < gaussianSize + 3
+         || inputImage.columns() < gaussianSize + 3) {
+        BRICK_THROW(brick::common::ValueException, "applyCannyFused()",
+                  "Argument inputImage has insufficient size, or argument "
+                  "gaussianSize is too large.");
+      }
+      if(lowerThreshold > upperThreshold) {
+        BRICK_THROW(brick::common::ValueException, "applyCannyFused()",
+                  "Argument lowerThreshold must be less than or equal to "
+                  "Arguments upperThreshold.");
+      }
+      autoLowerThresholdFactor =
+        std::min(autoLowerThresholdFactor, autoUpperThresholdFactor);
+
+      // Thresholds are scaled to match our non-normalized gradient
+      // kernels.  See applyCanny() for details.
+      FloatType scaleFactor = static_cast<FloatType>(std::sqrt(2.0) * 8.0);
+      lowerThreshold *= scaleFactor;
+      upperThreshold *= scaleFactor;
+
+      const size_t rows = inputImage.rows();
+      const size_t columns = inputImage.columns();
+      const bool isAutoThreshold =
+        !(lowerThreshold > 0.0 && upperThreshold > 0.0);
+
+      // Region over which automatic thresholds are computed.  Outside
+      // of this region, gradients are ignored.
+      size_t startRow = (gaussianSize + 1) / 2;
+      size_t stopRow = rows - startRow;
+      size_t startColumn = startRow;
+      size_t stopColumn = columns - startColumn;
+      if(isAutoThreshold
+         && ((startRow >= stopRow) || (startColumn >= stopColumn))) {
+        BRICK_THROW(brick::common::ValueException, "applyCannyFused()",
+                  "Filter kernel is too large for image.");
+      }
+
+      // If thresholds are known in advance, we can discard weak
+      // gradients during the sweep.  Otherwise keep everything until
+      // the statistics are in.
+      FloatType minimumMagnitude =
+        isAutoThreshold ? FloatType(0.0) : lowerThreshold;
+
+      // Step 1: Blur with a gaussian kernel to reduce noise.  Steps
+      // 2 and 3 (gradient, magnitude, and non-maximum suppression)
+      // happen in a single sweep.
+      std::vector<FloatType> rowSums;
+      std::vector<FloatType> rowSumsOfSquares;
+      std::vector< privateCode::CannyCandidate<FloatType> > candidates;
+      if(gaussianSize != 0
+         || !privateCode::cannySweepInteger(
+           inputImage, numberOfBands, isAutoThreshold, startRow, stopRow,
+           startColumn, stopColumn, minimumMagnitude,
+           rowSums, rowSumsOfSquares, candidates)) {
+        Image<ImageFormatIdentifierGray<FloatType>::Format> blurredImage;
+        if(gaussianSize == 0) {
+          blurredImage = convertColorspace<
+            ImageFormatIdentifierGray<FloatType>::Format>(inputImage);
+        } else {
+          Kernel<FloatType> gaussian =
+            getGaussianKernelBySize<FloatType>(gaussianSize, gaussianSize);
+          blurredImage =
+            filter2D<ImageFormatIdentifierGray<FloatType>::Format, FORMAT,
+                     FloatType>(
+                       gaussian, inputImage, 0.0);
+        }
+        privateCode::cannySweep<FloatType, FloatType, FloatType>(
+          blurredImage.data(), blurredImage.getRowStep(), rows, columns,
+          numberOfBands, isAutoThreshold, startRow, stopRow,
+          startColumn, stopColumn, minimumMagnitude,
+          rowSums, rowSumsOfSquares, candidates);
+      }
+
+      // Pick edge thresholds, if necessary.  Row sums are combined in
+      // the same order as in applyCanny() so that the results match
+      // exactly.
+      if(isAutoThreshold) {
+        size_t numberOfPixels =
+          (stopRow - startRow) * (stopColumn - startColumn);
+        FloatType sumOfGradient = 0.0;
+        FloatType sumOfGradientSquared = 0.0;
+        for(size_t row = startRow; row < stopRow; ++row) {
+          sumOfGradient += rowSums[row];
+          sumOfGradientSquared += rowSumsOfSquares[row];
+        }
+        FloatType gradientMean = sumOfGradient / numberOfPixels;
+        FloatType gradientVariance =
+          sumOfGradientSquared / numberOfPixels - gradientMean * gradientMean;
+        FloatType gradientSigma = brick::common::squareRoot(gradientVariance);
+
+        if(upperThreshold <= 0.0) {
+          upperThreshold =
+            gradientMean + autoUpperThresholdFactor * gradientSigma;
+          upperThreshold = std::max(upperThreshold, FloatType(0.0));
+        }
+        if(lowerThreshold <= 0.0) {
+          lowerThreshold =
+            gradientMean + autoLowerThresholdFactor * gradientSigma;
+          lowerThreshold = std::min(lowerThreshold, upperThreshold);
+          lowerThreshold = std::max(lowerThreshold, FloatType(0.0));
+        }
+      }
+
+      // Step 4: Threshold with hysteresis.
+      return privateCode::traceEdgeCandidates(
+        candidates, rows, columns, lowerThreshold, upperThreshold);
+    }
+
   } // namespace computerVision
 
 } // namespace brick
@@ -20,8 +20,10 @@
 //
 // #include <brick/computerVision/eightPointAlgorithm.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <brick/linearAlgebra/linearAlgebra.hh>
+#include <brick/linearAlgebra/staticLinearAlgebra.hh>
 #include <brick/numeric/utilities.hh>
 
 namespace brick {
@@ -109,14 +111,17 @@ namespace brick {
       //
       // With the matrix A as specified in the code below.
 
-      brick::numeric::Array2D<FloatType> AMatrix(numberOfCorrespondences, 9);
+      // Rather than building the Nx9 matrix A and multiplying it by
+      // its transpose, we accumulate the upper triangle of the 9x9
+      // matrix A^T * A directly.  This keeps everything on the stack.
+      brick::numeric::StaticArray2D<FloatType, 9, 9> ATA(
+        static_cast<FloatType>(0.0));
       for(size_t rowIndex = 0; rowIndex < numberOfCorrespondences; ++rowIndex) {
-        brick::numeric::Array1D<FloatType> currentRow =
-          AMatrix.getRow(rowIndex);
         const brick::numeric::Array1D<FloatType>& uu =
           normalizedPoints.getRow(rowIndex);
         const brick::numeric::Array1D<FloatType>& uPrime =
           normalizedPrimePoints.getRow(rowIndex);
+        FloatType currentRow[9];
         currentRow[0] = uu[0] * uPrime[0];
         currentRow[1] = uu[1] * uPrime[0];
         currentRow[2] = uu[2] * uPrime[0];
@@ -126,40 +131,44 @@ namespace brick {
         currentRow[6] = uu[0] * uPrime[2];
         currentRow[7] = uu[1] * uPrime[2];
         currentRow[8] = uu[2] * uPrime[2];
+        for(size_t ii = 0; ii < 9; ++ii) {
+          FloatType* ataRow = ATA.rowBegin(ii);
+          for(size_t jj = ii; jj < 9; ++jj) {
+            ataRow[jj] += currentRow[ii] * currentRow[jj];
+          }
+        }
       }
 
       // Solve for the F that minimizes the residual in the least
-      // squares sense.
-      brick::numeric::Array2D<FloatType> ATA =
-        brick::numeric::matrixMultiply<FloatType>(
-          AMatrix.transpose(), AMatrix);
-      brick::numeric::Array2D<FloatType> eigenvectors;
+      // squares sense.  This is the eigenvector of A^T * A with the
+      // smallest eigenvalue.
+      brick::numeric::StaticArray1D<FloatType, 9> staticEigenvalues;
+      brick::numeric::StaticArray2D<FloatType, 9, 9> eigenvectors;
       brick::linearAlgebra::eigenvectorsSymmetric(
-        ATA, eigenvalues, eigenvectors);
-      brick::numeric::Array2D<FloatType> FMatrix(3, 3);
-      FMatrix[0] = eigenvectors(0, 8);
-      FMatrix[1] = eigenvectors(1, 8);
-      FMatrix[2] = eigenvectors(2, 8);
-      FMatrix[3] = eigenvectors(3, 8);
-      FMatrix[4] = eigenvectors(4, 8);
-      FMatrix[5] = eigenvectors(5, 8);
-      FMatrix[6] = eigenvectors(6, 8);
-      FMatrix[7] = eigenvectors(7, 8);
-      FMatrix[8] = eigenvectors(8, 8);
+        ATA, staticEigenvalues, eigenvectors);
+      eigenvalues.reinit(9);
+      std::copy(staticEigenvalues.begin(), staticEigenvalues.end(),
+                eigenvalues.begin());
+      brick::numeric::StaticArray2D<FloatType, 3, 3> FStatic;
+      for(size_t ii = 0; ii < 9; ++ii) {
+        FStatic[ii] = eigenvectors(ii, 8);
+      }
 
       // Good.  Now we have an estimate for F.  Here we enforce that F
       // must not be full rank.
-      brick::numeric::Array2D<FloatType> uArray;
-      brick::numeric::Array1D<FloatType> sigmaArray;
-      brick::numeric::Array2D<FloatType> vTransposeArray;
+      brick::numeric::StaticArray2D<FloatType, 3, 3> uArray;
+      brick::numeric::StaticArray1D<FloatType, 3> sigmaArray;
+      brick::numeric::StaticArray2D<FloatType, 3, 3> vTransposeArray;
       brick::linearAlgebra::singularValueDecomposition(
-        FMatrix, uArray, sigmaArray, vTransposeArray);
-      uArray[2] = 0.0;
-      for(size_t ii = 0; ii < sigmaArray.size(); ++ii) {
-        vTransposeArray.getRow(ii) *= sigmaArray(ii);
+        FStatic, uArray, sigmaArray, vTransposeArray);
+      sigmaArray[2] = 0.0;
+      brick::numeric::Array2D<FloatType> FMatrix(3, 3);
+      for(size_t rr = 0; rr < 3; ++rr) {
+        for(size_t cc = 0; cc < 3; ++cc) {
+          FMatrix(rr, cc) = (uArray(rr, 0) * sigmaArray[0] * vTransposeArray(0, cc)
+                             + uArray(rr, 1) * sigmaArray[1] * vTransposeArray(1, cc));
+        }
       }
-      FMatrix = brick::numeric::matrixMultiply<FloatType>(
-        uArray, vTransposeArray);
 
       // Transform back to unnormalized coordinates.
       FMatrix =
@@ -29,6 +29,7 @@
 #include <brick/geometry/utilities2D.hh>
 #include <brick/geometry/utilities3D.hh>
 #include <brick/linearAlgebra/linearAlgebra.hh>
+#include <brick/linearAlgebra/staticLinearAlgebra.hh>
 #include <brick/numeric/subArray2D.hh>
 #include <brick/numeric/utilities.hh>
 
@@ -36,6 +37,39 @@ namespace brick {
 
   namespace computerVision {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // This function is used internally by fivePointAlgorithm() to
+      // update an upper triangular matrix R so that R^T * R gains
+      // the term newRow^T * newRow.  It uses one Givens rotation per
+      // non-zero element of newRow, which is overwritten.
+      template <class FloatType, size_t Size>
+      void
+      foldRowIntoTriangle(
+        brick::numeric::StaticArray2D<FloatType, Size, Size>& triangle,
+        FloatType* newRow)
+      {
+        for(size_t jj = 0; jj < Size; ++jj) {
+          if(newRow[jj] == FloatType(0.0)) {
+            continue;
+          }
+          FloatType* triangleRow = triangle.rowBegin(jj);
+          FloatType radius = std::hypot(triangleRow[jj], newRow[jj]);
+          FloatType cosine = triangleRow[jj] / radius;
+          FloatType sine = newRow[jj] / radius;
+          for(size_t kk = jj; kk < Size; ++kk) {
+            FloatType gg = triangleRow[kk];
+            FloatType hh = newRow[kk];
+            triangleRow[kk] = cosine * gg + sine * hh;
+            newRow[kk] = cosine * hh - sine * gg;
+          }
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
 
     template<class FloatType, class Iterator>
     std::vector< brick::numeric::Array2D<FloatType> >
@@ -72,12 +106,21 @@ namespace brick {
       //   ||A * vec(E)|| = 0
       //
       // With the matrix A as specified in the code below.
-      size_t numberOfCorrespondences = sequence0End - sequence0Begin;
-      brick::numeric::Array2D<FloatType> AMatrix(numberOfCorrespondences, 9);
-      for(size_t rowIndex = 0; rowIndex < numberOfCorrespondences; ++rowIndex) {
-        brick::numeric::Array1D<FloatType> currentRow = AMatrix.getRow(rowIndex);
+      // We never form A explicitly.  Instead, we maintain a 9x9
+      // matrix whose rows span the same space as the rows of A: the
+      // first nine constraints are copied in directly, and each
+      // additional constraint is folded into the (by then upper
+      // triangular) matrix using Givens rotations.  This leaves the
+      // singular values and right singular vectors unchanged, and
+      // keeps everything on the stack regardless of the number of
+      // input points.
+      brick::numeric::StaticArray2D<FloatType, 9, 9> AMatrix(
+        static_cast<FloatType>(0.0));
+      size_t rowIndex = 0;
+      while(sequence0Begin != sequence0End) {
         const brick::numeric::Vector2D<FloatType>& qq = *sequence0Begin;
         const brick::numeric::Vector2D<FloatType>& qPrime = *sequence1Begin;
+        FloatType currentRow[9];
         currentRow[0] = qq.x() * qPrime.x();
         currentRow[1] = qq.y() * qPrime.x();
         currentRow[2] = qPrime.x();
@@ -87,32 +130,41 @@ namespace brick {
         currentRow[6] = qq.x();
         currentRow[7] = qq.y();
         currentRow[8] = 1.0;
+        if(rowIndex < 9) {
+          std::copy(currentRow, currentRow + 9, AMatrix.rowBegin(rowIndex));
+          if(rowIndex == 8) {
+            // Triangularize so that later rows can be folded in.
+            brick::numeric::StaticArray2D<FloatType, 9, 9> qArray;
+            brick::numeric::StaticArray2D<FloatType, 9, 9> rArray;
+            brick::linearAlgebra::qrFactorization(AMatrix, qArray, rArray);
+            AMatrix = rArray;
+          }
+        } else {
+          privateCode::foldRowIntoTriangle(AMatrix, currentRow);
+        }
+        ++rowIndex;
         ++sequence0Begin;
         ++sequence1Begin;
       }
 
       // Following [1], we solve for the four dimensional null space
       // using SVD.
-      brick::numeric::Array2D<FloatType> uArray;
-      brick::numeric::Array1D<FloatType> sigmaArray;
-      brick::numeric::Array2D<FloatType> vTransposeArray;
+      brick::numeric::StaticArray2D<FloatType, 9, 9> uArray;
+      brick::numeric::StaticArray1D<FloatType, 9> sigmaArray;
+      brick::numeric::StaticArray2D<FloatType, 9, 9> vTransposeArray;
       brick::linearAlgebra::singularValueDecomposition(
-        AMatrix, uArray, sigmaArray, vTransposeArray, true);
+        AMatrix, uArray, sigmaArray, vTransposeArray);
       brick::numeric::Array2D<FloatType> E0Array(3, 3);
       brick::numeric::Array2D<FloatType> E1Array(3, 3);
       brick::numeric::Array2D<FloatType> E2Array(3, 3);
       brick::numeric::Array2D<FloatType> E3Array(3, 3);
-      std::copy(vTransposeArray.getRow(5).begin(),
-                vTransposeArray.getRow(5).end(),
+      std::copy(vTransposeArray.rowBegin(5), vTransposeArray.rowBegin(5) + 9,
                 E0Array.begin());
-      std::copy(vTransposeArray.getRow(6).begin(),
-                vTransposeArray.getRow(6).end(),
+      std::copy(vTransposeArray.rowBegin(6), vTransposeArray.rowBegin(6) + 9,
                 E1Array.begin());
-      std::copy(vTransposeArray.getRow(7).begin(),
-                vTransposeArray.getRow(7).end(),
+      std::copy(vTransposeArray.rowBegin(7), vTransposeArray.rowBegin(7) + 9,
                 E2Array.begin());
-      std::copy(vTransposeArray.getRow(8).begin(),
-                vTransposeArray.getRow(8).end(),
+      std::copy(vTransposeArray.rowBegin(8), vTransposeArray.rowBegin(8) + 9,
                 E3Array.begin());
 
       // Let E = x*E0 + y*E1 + z*E2 + w*E3, and assume w == 1 (Yuck.
@@ -170,27 +222,27 @@ namespace brick {
       // in general).  We don't have a Gauss-Jordan elimination
       // routine coded up, so we use what we have available.
 
-      // Extract the first 10 columns of M.
-      brick::numeric::Array2D<FloatType> M0 = brick::numeric::subArray(
-        M, brick::numeric::Slice(), brick::numeric::Slice(0, 10));
-
-      // Invert them (presumably using Gauss-Jordan elimination.
-      brick::numeric::Array2D<FloatType> M0Inv =
-        brick::linearAlgebra::inverse(M0);
-
-      // Extract the 10th through 20th columns of M.
-      brick::numeric::Array2D<FloatType> M1 = brick::numeric::subArray(
-        M, brick::numeric::Slice(), brick::numeric::Slice(10, 0));
+      // Extract the first 10 columns of M, and the 10th through
+      // 20th columns of M.
+      brick::numeric::StaticArray2D<FloatType, 10, 10> M0;
+      brick::numeric::StaticArray2D<FloatType, 10, 10> B;
+      for(size_t rr = 0; rr < 10; ++rr) {
+        for(size_t cc = 0; cc < 10; ++cc) {
+          M0(rr, cc) = M(rr, cc);
+          B(rr, cc) = M(rr, cc + 10);
+        }
+      }
 
-      // And manipulate them so that they look like they went through
-      // the same elimination process.  Following the paper, we call
-      // the result of this manipulation B, although the real Brobner
-      // basis is the set of polynomials whose coefficients are drawn
-      // from the 10x20 matrix resulting from the elimination (first
-      // 10 columns are 10x10 identity matrix, remaining columns equal
-      // to our 10x10 matrix B.
-      brick::numeric::Array2D<FloatType> B =
-        brick::numeric::matrixMultiply<FloatType>(M0Inv, M1);
+      // Now manipulate the right half so that it looks like it went
+      // through the same elimination process that reduces M0 to the
+      // identity.  That is, compute inverse(M0) * M1, which we do by
+      // solving rather than by explicitly inverting.  Following the
+      // paper, we call the result of this manipulation B, although
+      // the real Groebner basis is the set of polynomials whose
+      // coefficients are drawn from the 10x20 matrix resulting from
+      // the elimination (first 10 columns are 10x10 identity matrix,
+      // remaining columns equal to our 10x10 matrix B.
+      brick::linearAlgebra::linearSolveInPlace(M0, B);
 
       // Since we eliminated the left half of M, we're safe to assume
       // that the leading terms of the Groebner basis we just computed
@@ -541,11 +593,13 @@ namespace brick {
       // and Estimation of Three-Dimensional Motion Parameters of
       // Rigid Objects with Curved Surfaces, IEEE Transactions on
       // Pattern Analysis and Machine Intelligence, 6(1):13-27, 1984.
-      brick::numeric::Array2D<FloatType> uArray;
-      brick::numeric::Array1D<FloatType> sigmaArray;
-      brick::numeric::Array2D<FloatType> vTransposeArray;
+      brick::numeric::StaticArray2D<FloatType, 3, 3> EStatic;
+      std::copy(EE.begin(), EE.begin() + 9, EStatic.begin());
+      brick::numeric::StaticArray2D<FloatType, 3, 3> uArray;
+      brick::numeric::StaticArray1D<FloatType, 3> sigmaArray;
+      brick::numeric::StaticArray2D<FloatType, 3, 3> vTransposeArray;
       brick::linearAlgebra::singularValueDecomposition(
-        EE, uArray, sigmaArray, vTransposeArray);
+        EStatic, uArray, sigmaArray, vTransposeArray);
 
 #if 0
       // Nister's paper outlines the following steps, which are faster
@@ -604,19 +658,20 @@ namespace brick {
       // Here's a bonehead version of the above.
 
       // Multiply by D == [[0, 1, 0], [-1, 0, 0], [0, 0, 1]].
-      vTransposeArray.getRow(0) *= -1.0;
-      std::swap(vTransposeArray[0], vTransposeArray[3]);
-      std::swap(vTransposeArray[1], vTransposeArray[4]);
-      std::swap(vTransposeArray[2], vTransposeArray[5]);
-      brick::numeric::Array2D<FloatType> rotation0 =
-        matrixMultiply<FloatType>(uArray, vTransposeArray);
+      for(size_t ii = 0; ii < 3; ++ii) {
+        vTransposeArray(0, ii) *= -1.0;
+        std::swap(vTransposeArray(0, ii), vTransposeArray(1, ii));
+      }
+      brick::numeric::StaticArray2D<FloatType, 3, 3> rotation0 =
+        brick::numeric::matrixMultiply(uArray, vTransposeArray);
 
       // Undo previous contortion, and multiply by D == [[0, -1, 0],
       // [1, 0, 0], [0, 0, 1]].
-      vTransposeArray.getRow(0) *= -1.0;
-      vTransposeArray.getRow(1) *= -1.0;
-      brick::numeric::Array2D<FloatType> rotation1 =
-        matrixMultiply<FloatType>(uArray, vTransposeArray);
+      for(size_t ii = 0; ii < 6; ++ii) {
+        vTransposeArray[ii] *= -1.0;
+      }
+      brick::numeric::StaticArray2D<FloatType, 3, 3> rotation1 =
+        brick::numeric::matrixMultiply(uArray, vTransposeArray);
 
       // SVD could easily return -1 * the rotatin we want.  Of course, this
       // would make the resulting coordinate system left handed.  Check for
@@ -626,8 +681,8 @@ namespace brick {
       brick::numeric::Vector3D<FloatType> e2(rotation0(0, 2), rotation0(1, 2), rotation0(2, 2));
       bool isRightHanded = brick::numeric::dot<FloatType>(brick::numeric::cross(e0, e1), e2) > 0.0;
       if(!isRightHanded) {
-        rotation0 *= -1.0;
-        rotation1 *= -1.0;
+        rotation0 *= FloatType(-1.0);
+        rotation1 *= FloatType(-1.0);
       }
 
       // Now we have some candidates for rotation.  We'll test them
@@ -10,33 +10,333 @@
 ***************************************************************************
 */
 
+#include <algorithm>
 #include <limits>
 #include <numeric>
 #include <sstream>
+#include <vector>
+#include <brick/common/parallel.hh>
 #include <brick/computerVision/histogramEqualize.hh>
 
 namespace brick {
 
   namespace computerVision {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Counts pixel values into NumberOfTables consecutive histograms,
+      // each numberOfBins long.  Neighboring pixels go to different
+      // tables, so that runs of identical values (which are common)
+      // don't serialize on a single counter, waiting for each
+      // increment to be stored before the next can load it.
+      template <std::size_t NumberOfTables, class PixelType>
+      inline void
+      accumulateHistograms(PixelType const* pixelPtr,
+                           std::size_t numberOfPixels,
+                           brick::common::UInt32* tablesPtr,
+                           std::size_t numberOfBins)
+      {
+        std::size_t const stopIndex =
+          numberOfPixels - numberOfPixels % NumberOfTables;
+        std::size_t index = 0;
+        for(; index < stopIndex; index += NumberOfTables) {
+          for(std::size_t table = 0; table < NumberOfTables; ++table) {
+            ++tablesPtr[table * numberOfBins + pixelPtr[index + table]];
+          }
+        }
+        for(; index < numberOfPixels; ++index) {
+          ++tablesPtr[pixelPtr[index]];
+        }
+      }
+
+
+      // Sums the tables filled by accumulateHistograms() into the
+      // first one.
+      template <std::size_t NumberOfTables>
+      inline void
+      mergeHistograms(brick::common::UInt32* tablesPtr,
+                      std::size_t numberOfBins)
+      {
+        for(std::size_t table = 1; table < NumberOfTables; ++table) {
+          brick::common::UInt32 const* sourcePtr =
+            tablesPtr + table * numberOfBins;
+          for(std::size_t bin = 0; bin < numberOfBins; ++bin) {
+            tablesPtr[bin] += sourcePtr[bin];
+          }
+        }
+      }
+
+
+      // Histograms every pixel of an image.
+      template <std::size_t NumberOfTables, ImageFormat Format>
+      brick::numeric::Array1D<brick::common::UInt32>
+      getHistogram(const Image<Format>& inputImage)
+      {
+        typedef typename Image<Format>::PixelType PixelType;
+        if(inputImage.size()
+           > std::numeric_limits<brick::common::UInt32>::max()) {
+          std::ostringstream message;
+          message << "Currently, we can only equalize images with "
+                  << std::numeric_limits<int>::max() << " or fewer pixels.";
+          BRICK_THROW(brick::common::ValueException, "histogramEqualize()",
+                      message.str().c_str());
+        }
+
+        std::size_t const numberOfBins =
+          static_cast<std::size_t>(std::numeric_limits<PixelType>::max()) + 1;
+        std::vector<brick::common::UInt32> tables(
+          NumberOfTables * numberOfBins, 0);
+        for(std::size_t row = 0; row < inputImage.rows(); ++row) {
+          accumulateHistograms<NumberOfTables>(
+            inputImage.rowBegin(row), inputImage.columns(), &(tables[0]),
+            numberOfBins);
+        }
+        mergeHistograms<NumberOfTables>(&(tables[0]), numberOfBins);
+
+        brick::numeric::Array1D<brick::common::UInt32> histogram(
+          numberOfBins);
+        std::copy(tables.begin(), tables.begin() + numberOfBins,
+                  histogram.begin());
+        return histogram;
+      }
+
+
+      // Computes the CLAHE lookup table for one tile, writing
+      // numberOfBins elements to lutPtr.
+      template <std::size_t NumberOfTables, ImageFormat Format>
+      void
+      computeClaheLookupTable(
+        const Image<Format>& inputImage,
+        std::size_t firstRow, std::size_t endRow,
+        std::size_t firstColumn, std::size_t endColumn,
+        double clipLimit,
+        typename Image<Format>::PixelType* lutPtr)
+      {
+        typedef typename Image<Format>::PixelType PixelType;
+        std::size_t const numberOfBins =
+          static_cast<std::size_t>(std::numeric_limits<PixelType>::max()) + 1;
+
+        std::vector<brick::common::UInt32> tables(
+          NumberOfTables * numberOfBins, 0);
+        brick::common::UInt32* histogramPtr = &(tables[0]);
+        for(std::size_t row = firstRow; row < endRow; ++row) {
+          accumulateHistograms<NumberOfTables>(
+            inputImage.rowBegin(row) + firstColumn, endColumn - firstColumn,
+            histogramPtr, numberOfBins);
+        }
+        mergeHistograms<NumberOfTables>(histogramPtr, numberOfBins);
+
+        std::size_t const tilePixels =
+          (endRow - firstRow) * (endColumn - firstColumn);
+        if(clipLimit > 0.0) {
+          // Clip each bin, and spread the excess evenly over all the
+          // bins.  Any remainder is spread at regular intervals.
+          brick::common::UInt32 const limit = std::max(
+            static_cast<brick::common::UInt32>(
+              clipLimit * tilePixels / numberOfBins),
+            brick::common::UInt32(1));
+          std::size_t excess = 0;
+          for(std::size_t bin = 0; bin < numberOfBins; ++bin) {
+            if(histogramPtr[bin] > limit) {
+              excess += histogramPtr[bin] - limit;
+              histogramPtr[bin] = limit;
+            }
+          }
+          brick::common::UInt32 const increment =
+            static_cast<brick::common::UInt32>(excess / numberOfBins);
+          std::size_t remainder = excess - increment * numberOfBins;
+          for(std::size_t bin = 0; bin < numberOfBins; ++bin) {
+            histogramPtr[bin] += increment;
+          }
+          if(remainder != 0) {
+            std::size_t const step = std::max(numberOfBins / remainder,
+                                              std::size_t(1));
+            for(std::size_t bin = 0; bin < numberOfBins && remainder != 0;
+                bin += step, --remainder) {
+              ++histogramPtr[bin];
+            }
+          }
+        }
+
+        // The lookup table is the scaled CDF.
+        double const scaleFactor =
+          static_cast<double>(numberOfBins - 1) / tilePixels;
+        std::size_t cumulativeCount = 0;
+        for(std::size_t bin = 0; bin < numberOfBins; ++bin) {
+          cumulativeCount += histogramPtr[bin];
+          lutPtr[bin] = static_cast<PixelType>(
+            scaleFactor * cumulativeCount + 0.5);
+        }
+      }
+
+
+      // For each pixel coordinate along one axis, finds the two tiles
+      // whose centers bracket it, and the interpolation weight of the
+      // second.  Coordinates outside the outermost tile centers use
+      // that tile only.
+      void
+      getClaheInterpolation(std::vector<std::size_t> const& tileBounds,
+                            std::vector<std::size_t>& lowerTiles,
+                            std::vector<std::size_t>& upperTiles,
+                            std::vector<float>& upperWeights)
+      {
+        std::size_t const numberOfTiles = tileBounds.size() - 1;
+        std::size_t const size = tileBounds.back();
+        lowerTiles.resize(size);
+        upperTiles.resize(size);
+        upperWeights.resize(size);
+
+        std::size_t tile = 0;
+        for(std::size_t index = 0; index < size; ++index) {
+          double const position = static_cast<double>(index);
+          while(tile + 1 < numberOfTiles
+                && position >= 0.5 * (tileBounds[tile + 1]
+                                      + tileBounds[tile + 2] - 1)) {
+            ++tile;
+          }
+          double const lowerCenter =
+            0.5 * (tileBounds[tile] + tileBounds[tile + 1] - 1);
+          if(position <= lowerCenter || tile + 1 == numberOfTiles) {
+            lowerTiles[index] = tile;
+            upperTiles[index] = tile;
+            upperWeights[index] = 0.0f;
+          } else {
+            double const upperCenter =
+              0.5 * (tileBounds[tile + 1] + tileBounds[tile + 2] - 1);
+            lowerTiles[index] = tile;
+            upperTiles[index] = tile + 1;
+            upperWeights[index] = static_cast<float>(
+              (position - lowerCenter) / (upperCenter - lowerCenter));
+          }
+        }
+      }
+
+
+      // Shared implementation of the Image<GRAY8> and Image<GRAY16>
+      // versions of histogramEqualizeAdaptive().
+      template <std::size_t NumberOfTables, ImageFormat Format>
+      Image<Format>
+      histogramEqualizeAdaptive(
+        const Image<Format>& inputImage,
+        std::size_t gridRows, std::size_t gridColumns,
+        double clipLimit, std::size_t numberOfThreads)
+      {
+        typedef typename Image<Format>::PixelType PixelType;
+        std::size_t const rows = inputImage.rows();
+        std::size_t const columns = inputImage.columns();
+        if(gridRows == 0 || gridColumns == 0
+           || gridRows > rows || gridColumns > columns) {
+          BRICK_THROW(brick::common::ValueException,
+                      "histogramEqualizeAdaptive()",
+                      "Tile grid must be at least 1x1, and no larger than "
+                      "the input image.");
+        }
+        if(numberOfThreads == 0) {
+          numberOfThreads = brick::common::getDefaultNumberOfThreads();
+        }
+        std::size_t const numberOfBins =
+          static_cast<std::size_t>(std::numeric_limits<PixelType>::max()) + 1;
+
+        // Tile boundaries, chosen so that tile sizes differ by at most
+        // one pixel.
+        std::vector<std::size_t> rowBounds(gridRows + 1);
+        for(std::size_t tile = 0; tile <= gridRows; ++tile) {
+          rowBounds[tile] = (tile * rows) / gridRows;
+        }
+        std::vector<std::size_t> columnBounds(gridColumns + 1);
+        for(std::size_t tile = 0; tile <= gridColumns; ++tile) {
+          columnBounds[tile] = (tile * columns) / gridColumns;
+        }
+
+        // One lookup table per tile, computed independently.
+        brick::numeric::Array2D<PixelType> lookupTables(
+          gridRows * gridColumns, numberOfBins);
+        brick::common::executeInParallel(
+          gridRows * gridColumns,
+          [&](std::size_t tileIndex) {
+            std::size_t const tileRow = tileIndex / gridColumns;
+            std::size_t const tileColumn = tileIndex % gridColumns;
+            computeClaheLookupTable<NumberOfTables>(
+              inputImage, rowBounds[tileRow], rowBounds[tileRow + 1],
+              columnBounds[tileColumn], columnBounds[tileColumn + 1],
+              clipLimit, lookupTables.rowBegin(tileIndex));
+          },
+          numberOfThreads);
+
+        // Interpolation coefficients are shared by every row (and
+        // every column), so compute them once.  Column tiles are
+        // stored as offsets into the lookup tables of a tile row.
+        std::vector<std::size_t> lowerRowTiles;
+        std::vector<std::size_t> upperRowTiles;
+        std::vector<float> rowWeights;
+        getClaheInterpolation(rowBounds, lowerRowTiles, upperRowTiles,
+                              rowWeights);
+        std::vector<std::size_t> leftOffsets;
+        std::vector<std::size_t> rightOffsets;
+        std::vector<float> columnWeights;
+        getClaheInterpolation(columnBounds, leftOffsets, rightOffsets,
+                              columnWeights);
+        for(std::size_t column = 0; column < columns; ++column) {
+          leftOffsets[column] *= numberOfBins;
+          rightOffsets[column] *= numberOfBins;
+        }
+
+        // Blend the four nearest lookup tables for each pixel.
+        Image<Format> outputImage(rows, columns);
+        std::size_t const numberOfBands = std::min(rows, 4 * numberOfThreads);
+        brick::common::executeInParallel(
+          numberOfBands,
+          [&](std::size_t bandIndex) {
+            std::size_t const firstRow = (bandIndex * rows) / numberOfBands;
+            std::size_t const endRow =
+              ((bandIndex + 1) * rows) / numberOfBands;
+            for(std::size_t row = firstRow; row < endRow; ++row) {
+              PixelType const* topPtr =
+                lookupTables.rowBegin(lowerRowTiles[row] * gridColumns);
+              PixelType const* bottomPtr =
+                lookupTables.rowBegin(upperRowTiles[row] * gridColumns);
+              float const rowWeight = rowWeights[row];
+              PixelType const* inputPtr = inputImage.rowBegin(row);
+              PixelType* outputPtr = outputImage.rowBegin(row);
+              for(std::size_t column = 0; column < columns; ++column) {
+                std::size_t const value = inputPtr[column];
+                std::size_t const left = leftOffsets[column] + value;
+                std::size_t const right = rightOffsets[column] + value;
+                float const columnWeight = columnWeights[column];
+                float const top = topPtr[left] + columnWeight
+                  * (static_cast<float>(topPtr[right]) - topPtr[left]);
+                float const bottom = bottomPtr[left] + columnWeight
+                  * (static_cast<float>(bottomPtr[right]) - bottomPtr[left]);
+                outputPtr[column] = static_cast<PixelType>(
+                  top + rowWeight * (bottom - top) + 0.5f);
+              }
+            }
+          },
+          numberOfThreads);
+        return outputImage;
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
     // This function computes the histogram of an image.
     numeric::Array1D<brick::common::UInt32>
     getHistogram(const Image<GRAY8>& inputImage)
     {
-      if(inputImage.size() > std::numeric_limits<brick::common::UInt32>::max()) {
-        std::ostringstream message;
-        message << "Currently, we can only equalize images with "
-                << std::numeric_limits<int>::max() << " or fewer pixels.";
-        BRICK_THROW(common::ValueException, "histogramEqualize()", message.str().c_str());
-      }
+      return privateCode::getHistogram<4>(inputImage);
+    }
 
-      numeric::Array1D<brick::common::UInt32> histogram(
-        std::numeric_limits<Image<GRAY8>::PixelType>::max() + 1);
-      histogram = 0;
-      for(size_t pixelIndex = 0; pixelIndex < inputImage.size(); ++pixelIndex) {
-        ++(histogram[inputImage[pixelIndex]]);
-      }
-      return histogram;
+
+    // This function computes the histogram of a 16 bit image.
+    numeric::Array1D<brick::common::UInt32>
+    getHistogram(const Image<GRAY16>& inputImage)
+    {
+      // Four 65536-bin tables would no longer fit in L1 cache, and
+      // repeated values are less frequent at this bit depth, so we
+      // use a single table.
+      return privateCode::getHistogram<1>(inputImage);
     }
 
 
@@ -53,16 +353,54 @@ namespace brick {
       std::partial_sum(histogram.begin(), histogram.end(), cdf.begin(),
                        std::plus<brick::common::UInt32>());
 
-      // Rescale the image according to the CDF.
-      Image<GRAY8> outputImage(inputImage.rows(), inputImage.columns());
+      // Rescale the image according to the CDF, using a lookup table
+      // so that the floating point arithmetic is done once per gray
+      // level, rather than once per pixel.
       double scaleFactor = 256.0 / (inputImage.size() + 1);
-      for(size_t pixelIndex = 0; pixelIndex < inputImage.size(); ++pixelIndex) {
-        outputImage[pixelIndex] =
-          static_cast<common::Int8>(scaleFactor * cdf[inputImage[pixelIndex]]);
+      common::UInt8 lookupTable[256];
+      for(size_t grayLevel = 0; grayLevel < 256; ++grayLevel) {
+        lookupTable[grayLevel] =
+          static_cast<common::UInt8>(scaleFactor * cdf[grayLevel]);
+      }
+      Image<GRAY8> outputImage(inputImage.rows(), inputImage.columns());
+      for(size_t row = 0; row < inputImage.rows(); ++row) {
+        common::UInt8 const* inputPtr = inputImage.rowBegin(row);
+        common::UInt8* outputPtr = outputImage.rowBegin(row);
+        for(size_t column = 0; column < inputImage.columns(); ++column) {
+          outputPtr[column] = lookupTable[inputPtr[column]];
+        }
       }
       return outputImage;
     }
 
+
+    // This function implements contrast-limited adaptive histogram
+    // equalization.
+    Image<GRAY8>
+    histogramEqualizeAdaptive(const Image<GRAY8>& inputImage,
+                              std::size_t gridRows,
+                              std::size_t gridColumns,
+                              double clipLimit,
+                              std::size_t numberOfThreads)
+    {
+      return privateCode::histogramEqualizeAdaptive<4>(
+        inputImage, gridRows, gridColumns, clipLimit, numberOfThreads);
+    }
+
+
+    // This function implements contrast-limited adaptive histogram
+    // equalization for 16 bit images.
+    Image<GRAY16>
+    histogramEqualizeAdaptive(const Image<GRAY16>& inputImage,
+                              std::size_t gridRows,
+                              std::size_t gridColumns,
+                              double clipLimit,
+                              std::size_t numberOfThreads)
+    {
+      return privateCode::histogramEqualizeAdaptive<1>(
+        inputImage, gridRows, gridColumns, clipLimit, numberOfThreads);
+    }
+
   } // namespace computerVision
 
 } // namespace brick
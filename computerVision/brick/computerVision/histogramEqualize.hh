@@ -13,6 +13,7 @@
 #ifndef BRICK_COMPUTERVISION_HHISTOGRAMEQUALIZE_H
 #define BRICK_COMPUTERVISION_HHISTOGRAMEQUALIZE_H
 
+#include <cstddef>
 #include <brick/common/types.hh>
 #include <brick/computerVision/image.hh>
 
@@ -37,6 +38,20 @@ namespace brick {
     getHistogram(const Image<GRAY8>& inputImage);
 
 
+    /**
+     * This function computes the histogram of a 16 bit image.  It
+     * works just like the Image<GRAY8> version, but the returned
+     * array has 65536 elements.
+     *
+     * @param inputImage This argument is the image to be histogrammed.
+     *
+     * @return The return value is a 1D array of pixel counts, indexed
+     * by pixel value.
+     */
+    brick::numeric::Array1D<brick::common::UInt32>
+    getHistogram(const Image<GRAY16>& inputImage);
+
+
     /**
      * This function remaps the pixel values of the input image in such
      * a way that output pixel value increases monotonically with input
@@ -50,6 +65,84 @@ namespace brick {
     Image<GRAY8>
     histogramEqualize(const Image<GRAY8>& inputImage);
 
+
+    /**
+     * This function implements contrast-limited adaptive histogram
+     * equalization (CLAHE).  The image is divided into a grid of
+     * tiles, and a separate equalization lookup table is computed
+     * for each tile from that tile's histogram.  Before computing
+     * each table, histogram bins are clipped at a limit proportional
+     * to the mean bin count, and the clipped counts are spread evenly
+     * over all bins, so that nearly uniform regions don't have their
+     * noise amplified.  Each output pixel blends the lookup tables
+     * of the four nearest tile centers bilinearly, so there are no
+     * seams at tile boundaries.
+     *
+     * Tiles are histogrammed in parallel, and the blending pass is
+     * divided into bands of rows that are also processed in
+     * parallel.
+     *
+     * @param inputImage This argument is the image to be equalized.
+     *
+     * @param gridRows This argument specifies how many tiles the
+     * image is divided into vertically.  It must be at least 1, and
+     * no greater than inputImage.rows().
+     *
+     * @param gridColumns This argument specifies how many tiles the
+     * image is divided into horizontally.  It must be at least 1, and
+     * no greater than inputImage.columns().
+     *
+     * @param clipLimit This argument specifies the maximum count of
+     * each histogram bin, as a multiple of the tile's mean bin count.
+     * Values between 2.0 and 4.0 are typical.  Setting it to zero or
+     * less disables clipping, giving ordinary adaptive histogram
+     * equalization.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  Setting it to zero selects a
+     * sensible default.
+     *
+     * @return The return value is the equalized image.
+     */
+    Image<GRAY8>
+    histogramEqualizeAdaptive(const Image<GRAY8>& inputImage,
+                              std::size_t gridRows = 8,
+                              std::size_t gridColumns = 8,
+                              double clipLimit = 2.0,
+                              std::size_t numberOfThreads = 0);
+
+
+    /**
+     * This function implements contrast-limited adaptive histogram
+     * equalization for 16 bit images.  It works just like the
+     * Image<GRAY8> version, with 65536 histogram bins per tile.
+     * Because the mean bin count is correspondingly smaller, larger
+     * tiles or larger values of clipLimit are usually needed.
+     *
+     * @param inputImage This argument is the image to be equalized.
+     *
+     * @param gridRows This argument specifies how many tiles the
+     * image is divided into vertically.
+     *
+     * @param gridColumns This argument specifies how many tiles the
+     * image is divided into horizontally.
+     *
+     * @param clipLimit This argument specifies the maximum count of
+     * each histogram bin, as a multiple of the tile's mean bin count.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  Setting it to zero selects a
+     * sensible default.
+     *
+     * @return The return value is the equalized image.
+     */
+    Image<GRAY16>
+    histogramEqualizeAdaptive(const Image<GRAY16>& inputImage,
+                              std::size_t gridRows = 8,
+                              std::size_t gridColumns = 8,
+                              double clipLimit = 2.0,
+                              std::size_t numberOfThreads = 0);
+
   } // namespace computerVision
 
 } // namespace brick
@@ -14,6 +14,7 @@
 #define BRICK_COMPUTERVISION_IMAGEIO_HH
 
 #include <string>
+#include <vector>
 #include <brick/computerVision/image.hh>
 
 namespace brick {
@@ -134,6 +135,44 @@ namespace brick {
             std::string& commentString);
 
 
+    /**
+     * This function reads a PNG file into a caller-supplied image,
+     * reusing its memory if it already has the right shape.  This
+     * avoids reallocating when many same-sized files are read in a
+     * loop.
+     *
+     * @param fileName This argument is the name of the file to read.
+     *
+     * @param outputImage This argument is the image into which to
+     * decode.  It is reinitialized if its shape doesn't match the
+     * file.
+     */
+    template <ImageFormat FORMAT>
+    void
+    readPNG(const std::string& fileName,
+            Image<FORMAT>& outputImage);
+
+
+    /**
+     * This function decodes several PNG files concurrently.  Each
+     * file is decoded by a single thread, so this is most useful
+     * when there are at least as many files as threads.
+     *
+     * @param fileNames This argument lists the files to read.
+     *
+     * @param numberOfThreads This argument specifies how many
+     * threads to use.  If it is zero, a sensible default is chosen.
+     *
+     * @return The return value holds the decoded images, in the same
+     * order as fileNames.  If any file can't be read, the first
+     * exception is rethrown after all threads have finished.
+     */
+    template <ImageFormat FORMAT>
+    std::vector< Image<FORMAT> >
+    readPNGBatch(const std::vector<std::string>& fileNames,
+                 std::size_t numberOfThreads = 0);
+
+
     /**
      * WARNING: This routine may not stick around for long.
      *
@@ -159,6 +198,10 @@ namespace brick {
      * @param outputImage This argument ...
      *
      * @param comment This argument is currently ignored.
+     *
+     * Rows are handed to libpng directly from outputImage.  Use
+     * PngWriter instead if you need to trade file size for
+     * encoding speed.
      */
     template<ImageFormat Format>
     void
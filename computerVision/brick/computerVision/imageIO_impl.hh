@@ -211,19 +211,14 @@ namespace brick {
 
 #if HAVE_LIBPNG
 
-#include <png++/png.hpp>
+#include <brick/common/parallel.hh>
 #include <brick/computerVision/pngReader.hh>
+#include <brick/computerVision/pngWriter.hh>
 
 namespace brick {
 
   namespace computerVision {
 
-    namespace privateCode {
-
-
-    } // namespace privateCode
-
-
     template <ImageFormat Format>
     Image<Format>
     readPNG(const std::string& fileName,
@@ -234,41 +229,44 @@ namespace brick {
     }
 
 
-    template<ImageFormat Format>
+    // This function reads a PNG file into a caller-supplied image.
+    template <ImageFormat Format>
     void
-    writePNG(const std::string& fileName,
-             const Image<Format>& outputImage,
-             const std::string& /* comment */)
+    readPNG(const std::string& fileName,
+            Image<Format>& outputImage)
     {
-      BRICK_THROW(brick::common::NotImplementedException, "writePNG()",
-                  "This function template has not been specialized for the "
-                  "requested image format yet.");
+      PngReader pngReader(fileName);
+      pngReader.readImage(outputImage);
     }
 
-    // Definitions of these specializations are found in ImageIO.cc.
-    template<>
-    void
-    writePNG<GRAY8>(const std::string& fileName,
-                    const Image<GRAY8>& outputImage,
-                    const std::string& /* comment */);
 
-    template<>
-    void
-    writePNG<GRAY16>(const std::string& fileName,
-                     const Image<GRAY16>& outputImage,
-                     const std::string& /* comment */);
+    // This function decodes several PNG files concurrently.
+    template <ImageFormat Format>
+    std::vector< Image<Format> >
+    readPNGBatch(const std::vector<std::string>& fileNames,
+                 std::size_t numberOfThreads)
+    {
+      std::vector< Image<Format> > result(fileNames.size());
+      brick::common::executeInParallel(
+        fileNames.size(),
+        [&fileNames, &result](std::size_t index) {
+          PngReader pngReader(fileNames[index]);
+          pngReader.readImage(result[index]);
+        },
+        numberOfThreads);
+      return result;
+    }
 
-    template<>
-    void
-    writePNG<RGB8>(const std::string& fileName,
-                   const Image<RGB8>& outputImage,
-                   const std::string& /* comment */);
 
-    template<>
+    template<ImageFormat Format>
     void
-    writePNG<RGB16>(const std::string& fileName,
-                    const Image<RGB16>& outputImage,
-                    const std::string& /* comment */);
+    writePNG(const std::string& fileName,
+             const Image<Format>& outputImage,
+             const std::string& /* comment */)
+    {
+      PngWriter pngWriter;
+      pngWriter.write(fileName, outputImage);
+    }
 
   } // namespace computerVision
 
@@ -98,6 +98,30 @@ namespace brick {
       warpImage(Image<InputFormat> const& inputImage,
                 typename Image<OutputFormat>::PixelType defaultValue) const;
 
+
+      /**
+       * Warps a single image using the pre-computed lookup table,
+       * writing the result into an existing image rather than
+       * allocating a new one.  This is useful in streaming pipelines,
+       * where the output image can come from a
+       * brick::utilities::FramePool.
+       *
+       * @param inputImage This argument is the image to be warped.
+       *
+       * @param outputImage This argument is the image into which the
+       * result will be written.  It must already have the size of the
+       * output image, and is never reallocated.
+       *
+       * @param defaultValue This argument specifies what pixel value
+       * to use for pixels in the output image that map to input-image
+       * pixels that lie outside the boundaries of the input image.
+       */
+      template <ImageFormat InputFormat, ImageFormat OutputFormat>
+      void
+      warpImage(Image<InputFormat> const& inputImage,
+                Image<OutputFormat>& outputImage,
+                typename Image<OutputFormat>::PixelType defaultValue) const;
+
     private:
 
       struct SampleInfo {
@@ -101,6 +101,21 @@ namespace brick {
     ImageWarper<NumericType, TransformFunctor>::
     warpImage(Image<InputFormat> const& inputImage,
               typename Image<OutputFormat>::PixelType defaultValue) const
+    {
+      Image<OutputFormat> outputImage(
+        m_lookupTable.rows(), m_lookupTable.columns());
+      this->warpImage(inputImage, outputImage, defaultValue);
+      return outputImage;
+    }
+
+
+    template<class NumericType, class TransformFunctor>
+    template <ImageFormat InputFormat, ImageFormat OutputFormat>
+    void
+    ImageWarper<NumericType, TransformFunctor>::
+    warpImage(Image<InputFormat> const& inputImage,
+              Image<OutputFormat>& outputImage,
+              typename Image<OutputFormat>::PixelType defaultValue) const
     {
       if((inputImage.rows() != m_inputRows)
          || (inputImage.columns() != m_inputColumns)) {
@@ -112,27 +127,40 @@ namespace brick {
         BRICK_THROW(brick::common::ValueException, "ImageWarper::warpImage()",
                     message.str().c_str());
       }
-      Image<OutputFormat> outputImage(
-        m_lookupTable.rows(), m_lookupTable.columns());
-      for(size_t ii = 0; ii < m_lookupTable.size(); ++ii) {
-        SampleInfo const& sampleInfo = m_lookupTable(ii);
-        if(sampleInfo.isInBounds) {
-          typename Image<OutputFormat>::PixelType& outputPixel =
-            outputImage[ii];
-          size_t inputIndex = sampleInfo.index00;
-
-          outputPixel = sampleInfo.c00 * inputImage[inputIndex];
-          ++inputIndex;
-          outputPixel += sampleInfo.c01 * inputImage[inputIndex];
-          inputIndex += m_inputColumns;
-          outputPixel += sampleInfo.c11 * inputImage[inputIndex];
-          --inputIndex;
-          outputPixel += sampleInfo.c10 * inputImage[inputIndex];
-        } else {
-          outputImage[ii] = defaultValue;
+      if((outputImage.rows() != m_lookupTable.rows())
+         || (outputImage.columns() != m_lookupTable.columns())) {
+        std::ostringstream message;
+        message
+          << "OutputImage (" << outputImage.rows() << "x"
+          << outputImage.columns() << ") doesn't match expected dimensions ("
+          << m_lookupTable.rows() << "x" << m_lookupTable.columns() << ").";
+        BRICK_THROW(brick::common::ValueException, "ImageWarper::warpImage()",
+                    message.str().c_str());
+      }
+      size_t const outputColumns = m_lookupTable.columns();
+      for(size_t row = 0; row < m_lookupTable.rows(); ++row) {
+        SampleInfo const* sampleInfoPtr = m_lookupTable.rowBegin(row);
+        typename Image<OutputFormat>::PixelType* outputPtr =
+          outputImage.rowBegin(row);
+        for(size_t column = 0; column < outputColumns; ++column) {
+          SampleInfo const& sampleInfo = sampleInfoPtr[column];
+          if(sampleInfo.isInBounds) {
+            typename Image<OutputFormat>::PixelType& outputPixel =
+              outputPtr[column];
+            size_t inputIndex = sampleInfo.index00;
+
+            outputPixel = sampleInfo.c00 * inputImage[inputIndex];
+            ++inputIndex;
+            outputPixel += sampleInfo.c01 * inputImage[inputIndex];
+            inputIndex += m_inputColumns;
+            outputPixel += sampleInfo.c11 * inputImage[inputIndex];
+            --inputIndex;
+            outputPixel += sampleInfo.c10 * inputImage[inputIndex];
+          } else {
+            outputPtr[column] = defaultValue;
+          }
         }
       }
-      return outputImage;
     }
 
   } // namespace computerVision
@@ -14,6 +14,7 @@
 #ifndef BRICK_COMPUTERVISION_KEYPOINTSELECTORHARRIS_HH
 #define BRICK_COMPUTERVISION_KEYPOINTSELECTORHARRIS_HH
 
+#include <cstddef>
 #include <limits>
 #include <vector>
 #include <brick/computerVision/image.hh>
@@ -23,6 +24,16 @@ namespace brick {
 
   namespace computerVision {
 
+    /**
+     ** This enum lists the corner strength measures supported by
+     ** KeypointSelectorHarris.
+     **/
+    enum HarrisResponseType {
+      BRICK_HARRIS_RESPONSE,     ///< det(M) - kappa * trace(M)^2.
+      BRICK_SHI_TOMASI_RESPONSE  ///< Smaller eigenvalue of M.
+    };
+
+
     template <class CoordinateType>
     struct KeypointHarris {
       CoordinateType row;
@@ -61,9 +72,20 @@ namespace brick {
      ** keypoint selectors in this library, it does not use a scale
      ** space, and operates directly on the input image.
      **
+     ** Blurring, gradient computation, structure tensor windowing,
+     ** and the corner response are fused into a single sweep over
+     ** horizontal strips of the image, using 16 bit and 32 bit
+     ** integer intermediates held in a few rows of scratch space.
+     ** Strips are processed in parallel.  The Shi-Tomasi "good
+     ** features to track" response [2] may be selected in place of
+     ** the Harris response using setResponseType().
+     **
      ** [1] C. Harris and M. Stephens, "A combined corner and edge
      ** detector", Proceedings of the 4th Alvey Vision Conference,
      ** pp. 147–151, 1988.
+     **
+     ** [2] J. Shi and C. Tomasi, "Good Features to Track",
+     ** Proceedings of CVPR, pp. 593-600, 1994.
      **/
     template <class FloatType>
     class KeypointSelectorHarris {
@@ -136,6 +158,69 @@ namespace brick {
       getKeypointsGeneralPosition(Iter iterator) const;
 
 
+      /**
+       * Return at most maxKeypoints of the strongest keypoints
+       * detected during the most recent call to member function
+       * setImage().  The search region is divided into a grid of
+       * gridRows x gridColumns cells, and no cell contributes more
+       * than its share of the total, so that keypoints are spread
+       * across the image.  Keypoints are returned strongest first.
+       *
+       * @param iterator This argument must be a writable iterator
+       * pointing to KeypointHarris<brick::common::Int32>.
+       *
+       * @param maxKeypoints This argument specifies the largest
+       * number of keypoints to return.
+       *
+       * @param gridRows This argument specifies how many rows of
+       * cells the search region should be divided into.
+       *
+       * @param gridColumns This argument specifies how many columns
+       * of cells the search region should be divided into.
+       *
+       * @param threshold Only keypoints whose response is greater
+       * than this threshold are returned.
+       */
+      template <class Iter>
+      void
+      getKeypointsBucketed(Iter iterator,
+                           std::size_t maxKeypoints,
+                           std::size_t gridRows = 1,
+                           std::size_t gridColumns = 1,
+                           FloatType threshold = 0.0) const;
+
+
+      /**
+       * This member function works just like getKeypointsBucketed(),
+       * except that the returned keypoints are refined using
+       * subpixel interpolation.  Only the keypoints that survive
+       * bucketing are interpolated, so this is much cheaper than
+       * filtering the output of getKeypointsGeneralPosition().
+       *
+       * @param iterator This argument must be a writable iterator
+       * pointing to KeypointHarris<FloatType>.
+       *
+       * @param maxKeypoints This argument specifies the largest
+       * number of keypoints to return.
+       *
+       * @param gridRows This argument specifies how many rows of
+       * cells the search region should be divided into.
+       *
+       * @param gridColumns This argument specifies how many columns
+       * of cells the search region should be divided into.
+       *
+       * @param threshold Only keypoints whose response is greater
+       * than this threshold are returned.
+       */
+      template <class Iter>
+      void
+      getKeypointsGeneralPositionBucketed(Iter iterator,
+                                          std::size_t maxKeypoints,
+                                          std::size_t gridRows = 1,
+                                          std::size_t gridColumns = 1,
+                                          FloatType threshold = 0.0) const;
+
+
       /**
        * Process an image to find keypoints.
        *
@@ -146,36 +231,80 @@ namespace brick {
       setImage(Image<GRAY8> const& inImage);
 
 
+      /**
+       * Sets the number of threads used by setImage().
+       *
+       * @param numberOfThreads This argument specifies the number of
+       * threads.  If it is zero (the default), a sensible default is
+       * chosen.
+       */
+      void
+      setNumberOfThreads(std::size_t numberOfThreads) {
+        m_numberOfThreads = numberOfThreads;
+      }
+
+
+      /**
+       * Selects the corner strength measure computed by subsequent
+       * calls to setImage().
+       *
+       * @param responseType This argument specifies the measure.
+       * The default is BRICK_HARRIS_RESPONSE.
+       */
+      void
+      setResponseType(HarrisResponseType responseType) {
+        m_responseType = responseType;
+      }
+
+
     private:
 
       typedef brick::common::Int32 AccumulatedType;
 
 
-      // Slight misnomer.  This actually computes products of
-      // gradients within the region defined by corner0 and corner1.
-      // Also updates corner0 and corner1 to reflect the region over
-      // which the gradient calculation is valid.
+      // A local maximum of the corner response, as gathered by
+      // selectCandidates().
+      struct Candidate {
+        FloatType value;
+        unsigned int row;
+        unsigned int column;
+      };
+
+
+      // Runs the fused blur / gradient / window / response pipeline
+      // for output rows [firstRow, endRow), reading whatever rows of
+      // inImage are needed above and below the strip.
       void
-      computeGradients(
-        Image<GRAY_SIGNED32> const& inImage,
-        brick::numeric::Array2D<AccumulatedType>& gradientXX,
-        brick::numeric::Array2D<AccumulatedType>& gradientXY,
-        brick::numeric::Array2D<AccumulatedType>& gradientYY,
-        brick::numeric::Index2D& corner0,
-        brick::numeric::Index2D& corner1);
-
-
-      // Give products of gradients, compute the Harris corner
-      // indicator at each pixel within the region defined by corner0
-      // and corner1.
+      computeStrip(Image<GRAY8> const& inImage,
+                   std::size_t firstRow,
+                   std::size_t endRow);
+
+
+      // Returns true if the response at the specified pixel is
+      // strictly greater than that of each of its eight neighbors.
+      bool
+      isLocalMaximum(unsigned int row, unsigned int column) const;
+
+
+      // If subpixel interpolation of the response around (row,
+      // column) succeeds, writes the refined keypoint to iterator
+      // and advances it.
+      template <class Iter>
+      void
+      refineKeypoint(unsigned int row, unsigned int column,
+                     Iter& iterator) const;
+
+
+      // Collects the strongest local maxima that lie at least margin
+      // pixels inside the search region, subject to the bucketing
+      // rules described in getKeypointsBucketed().
       void
-      computeHarrisIndicators(
-        brick::numeric::Array2D<AccumulatedType> const& gradientXX,
-        brick::numeric::Array2D<AccumulatedType> const& gradientXY,
-        brick::numeric::Array2D<AccumulatedType> const& gradientYY,
-        brick::numeric::Array2D<FloatType>& harrisIndicators,
-        brick::numeric::Index2D const& corner0,
-        brick::numeric::Index2D const& corner1);
+      selectCandidates(std::vector<Candidate>& candidates,
+                       unsigned int margin,
+                       std::size_t maxKeypoints,
+                       std::size_t gridRows,
+                       std::size_t gridColumns,
+                       FloatType threshold) const;
 
 
       /* ======== Data members ========= */
@@ -192,8 +321,14 @@ namespace brick {
       brick::numeric::Index2D m_searchRegionCorner0;
       brick::numeric::Index2D m_searchRegionCorner1;
 
-      // Parameters of the algorithm itself.
+      // Parameters of the algorithm itself.  The pre-blur and
+      // integration window are separable and symmetric, so each is
+      // stored as a single 1D kernel, applied along both axes.
+      brick::numeric::Array1D<brick::common::Int32> m_blurKernel;
+      brick::numeric::Array1D<brick::common::Int32> m_windowKernel;
       FloatType m_kappa;
+      std::size_t m_numberOfThreads;
+      HarrisResponseType m_responseType;
       FloatType m_sigma;
     };
 
@@ -19,8 +19,12 @@
 //
 // #include <brick/computerVision/keypointSelectorHarris.hh>
 
+#include <algorithm>
+#include <brick/common/exception.hh>
 #include <brick/common/mathFunctions.hh>
+#include <brick/common/parallel.hh>
 #include <brick/computerVision/imageFilter.hh>
+#include <brick/computerVision/kernels.hh>
 #include <brick/numeric/bilinearInterpolator.hh>
 #include <brick/numeric/filter.hh>
 #include <brick/numeric/subpixelInterpolate.hh>
@@ -40,10 +44,13 @@ namespace brick {
     KeypointHarris<CoordinateType>::
     getCovariance(FloatType& c00, FloatType& c01, FloatType& c11)
     {
-      brick::common::Int32 determinant = m_xx * m_yy - m_xy * m_xy;
+      // Window sums are large enough that the determinant must be
+      // computed in floating point to avoid overflow.
+      FloatType determinant =
+        FloatType(m_xx) * FloatType(m_yy) - FloatType(m_xy) * FloatType(m_xy);
       c00 = FloatType(m_yy) / determinant;
       c01 = -FloatType(m_xy) / determinant;
-      c11 = FloatType(m_yy) / determinant;
+      c11 = FloatType(m_xx) / determinant;
     }
 
 
@@ -57,10 +64,39 @@ namespace brick {
         m_gradientYY(),
         m_searchRegionCorner0(0, 0),
         m_searchRegionCorner1(0, 0),
+        m_blurKernel(),
+        m_windowKernel(),
         m_kappa(kappa),
+        m_numberOfThreads(0),
+        m_responseType(BRICK_HARRIS_RESPONSE),
         m_sigma(sigma)
     {
-      // Empty.
+      // The pre-blur is an integer valued approximation to a 2D
+      // Gaussian kernel, normalized so that it integrates to
+      // approximately 256 * 256 = 65536.
+      m_blurKernel = getGaussianKernelBySize<brick::common::Int32>(
+        size_t(5), size_t(5), -1.0, -1.0, true, 256, 256).getRowComponent();
+
+      // To get rotation independent Harris corners, the integration
+      // for each pixel needs to be weighted with a circularly
+      // symmetric window.  Remember that we're convolving with the
+      // squares of gradients.  To avoid risk of overflow, this kernel
+      // is normalized so it integrates to a smaller value (45 * 45 =
+      // 2025).
+      m_windowKernel = getGaussianKernelBySize<brick::common::Int32>(
+        size_t(11), size_t(11), -1.0, -1.0, true, 45, 45).getRowComponent();
+
+      // computeStrip() keeps the output of the horizontal blur pass
+      // in 16 bits.
+      brick::common::Int32 blurSum = 0;
+      for(std::size_t ii = 0; ii < m_blurKernel.size(); ++ii) {
+        blurSum += m_blurKernel[ii];
+      }
+      if(blurSum * 255 > std::numeric_limits<brick::common::UInt16>::max()) {
+        BRICK_THROW(brick::common::LogicException,
+                    "KeypointSelectorHarris::KeypointSelectorHarris()",
+                    "Blur kernel is too large for 16 bit intermediates.");
+      }
     }
 
 
@@ -118,7 +154,7 @@ namespace brick {
              && (*candidatePtr > *(candidatePtr - rowStep + 1))) {
             *(iterator++) = KeypointHarris<brick::common::Int32>(
               row, column, *candidatePtr,
-              xxRow[column], yyRow[column], xyRow[column]);
+              xxRow[column], xyRow[column], yyRow[column]);
           }
         }
       }
@@ -161,332 +197,516 @@ namespace brick {
       unsigned int const startColumn = m_searchRegionCorner0.getColumn() + 1;
       unsigned int const stopColumn  = m_searchRegionCorner1.getColumn() - 1;
 
-      // These interpolators will make things easy on us later when
-      // trying to gather information about keypoints in non-integral
-      // positions.
-      brick::numeric::BilinearInterpolator<AccumulatedType, FloatType>
-        xxInterpolator(m_gradientXX);
-      brick::numeric::BilinearInterpolator<AccumulatedType, FloatType>
-        xyInterpolator(m_gradientXY);
-      brick::numeric::BilinearInterpolator<AccumulatedType, FloatType>
-        yyInterpolator(m_gradientYY);
-
       // Iterate over all pixels in the valid region.
-      unsigned int rowStep = m_harrisIndicators.getRowStep();
       for(unsigned int row = stopRow - 1; row >= startRow; --row) {
-        brick::numeric::Array1D<AccumulatedType> xxRow =
-          m_gradientXX.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> xyRow =
-          m_gradientXY.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> yyRow =
-          m_gradientYY.getRow(row);
-        brick::numeric::Array1D<FloatType> harrisRow =
-          m_harrisIndicators.getRow(row);
         for(unsigned int column = stopColumn - 1; column >= startColumn;
             --column) {
-          FloatType* candidatePtr = &(harrisRow[column]);
-          if((*candidatePtr > *(candidatePtr + 1))
-             && (*candidatePtr > *(candidatePtr - 1))
-             && (*candidatePtr > *(candidatePtr + rowStep))
-             && (*candidatePtr > *(candidatePtr - rowStep))
-             && (*candidatePtr > *(candidatePtr + rowStep + 1))
-             && (*candidatePtr > *(candidatePtr - rowStep - 1))
-             && (*candidatePtr > *(candidatePtr + rowStep - 1))
-             && (*candidatePtr > *(candidatePtr - rowStep + 1))) {
-
-            FloatType rowCoordinate;
-            FloatType columnCoordinate;
-            FloatType extremeValue;
-            if(brick::numeric::subpixelInterpolate(
-                 FloatType(row), FloatType(column),
-                 *(candidatePtr - rowStep - 1), *(candidatePtr - rowStep),
-                 *(candidatePtr - rowStep + 1),
-                 *(candidatePtr - 1), *candidatePtr, *(candidatePtr + 1),
-                 *(candidatePtr + rowStep - 1), *(candidatePtr + rowStep),
-                 *(candidatePtr + rowStep + 1),
-                 rowCoordinate, columnCoordinate, extremeValue)) {
-
-              // Sanity check interpolation result, as subpixelInterpolate()
-              // does not do so.
-              if(common::absoluteValue(rowCoordinate - row) < 1.0
-                 && common::absoluteValue(columnCoordinate - column) < 1.0) {
-
-                *(iterator++) = KeypointHarris<FloatType>(
-                  rowCoordinate, columnCoordinate, extremeValue,
-                  xxInterpolator(rowCoordinate, columnCoordinate),
-                  xyInterpolator(rowCoordinate, columnCoordinate),
-                  yyInterpolator(rowCoordinate, columnCoordinate));
-
-              }
-            }
+          if(this->isLocalMaximum(row, column)) {
+            this->refineKeypoint(row, column, iterator);
           }
         }
       }
     }
 
 
+    template <class FloatType>
+    template <class Iter>
+    void
+    KeypointSelectorHarris<FloatType>::
+    getKeypointsBucketed(Iter iterator,
+                         std::size_t maxKeypoints,
+                         std::size_t gridRows,
+                         std::size_t gridColumns,
+                         FloatType threshold) const
+    {
+      std::vector<Candidate> candidates;
+      this->selectCandidates(candidates, 0, maxKeypoints,
+                             gridRows, gridColumns, threshold);
+      for(std::size_t ii = 0; ii < candidates.size(); ++ii) {
+        unsigned int const row = candidates[ii].row;
+        unsigned int const column = candidates[ii].column;
+        *(iterator++) = KeypointHarris<brick::common::Int32>(
+          row, column, candidates[ii].value,
+          m_gradientXX(row, column), m_gradientXY(row, column),
+          m_gradientYY(row, column));
+      }
+    }
+
+
+    template <class FloatType>
+    template <class Iter>
+    void
+    KeypointSelectorHarris<FloatType>::
+    getKeypointsGeneralPositionBucketed(Iter iterator,
+                                        std::size_t maxKeypoints,
+                                        std::size_t gridRows,
+                                        std::size_t gridColumns,
+                                        FloatType threshold) const
+    {
+      // Shrink the search region by one pixel, as in
+      // getKeypointsGeneralPosition(), so that interpolation never
+      // reaches outside of the valid region.
+      std::vector<Candidate> candidates;
+      this->selectCandidates(candidates, 1, maxKeypoints,
+                             gridRows, gridColumns, threshold);
+      for(std::size_t ii = 0; ii < candidates.size(); ++ii) {
+        this->refineKeypoint(
+          candidates[ii].row, candidates[ii].column, iterator);
+      }
+    }
+
+
     template <class FloatType>
     void
     KeypointSelectorHarris<FloatType>::
     setImage(Image<GRAY8> const& inImage)
     {
-      // Start by blurring the image slightly.  This should be
-      // optional in future implementations.  This call makes an
-      // integer valued approximation to a 2D Gaussian kernel,
-      // normalized so that it integrates to approximately 256 * 256 =
-      // 65536.  The size of this filter affects the region of the
-      // image for which the Harris corner metric will be valid, so we
-      // update the search region here as well.
-      Kernel<brick::common::Int32> gaussian =
-        getGaussianKernelBySize<brick::common::Int32>(
-          size_t(5), size_t(5), -1.0, -1.0, true, 256, 256);
-      m_searchRegionCorner0.setValue(2, 2);
-      m_searchRegionCorner1.setValue(inImage.rows() - 2, inImage.columns() - 2);
-
-      // Here we do the convolution.  Fortunately, 2D Gaussians are
-      // separable, so we can do the row and column convolutions
-      // separately.  In a more cache-coherent implementation, we'd
-      // combine these operations.
-      brick::numeric::Array2D<brick::common::Int32> workspace(
-        inImage.rows(), inImage.columns());
-      workspace = 0;
-      Image<GRAY_SIGNED32> blurredImage(inImage.rows(), inImage.columns());
-      brick::numeric::filterRows(
-        workspace, inImage, gaussian.getRowComponent());
-      brick::numeric::filterColumns(
-        blurredImage, workspace, gaussian.getColumnComponent());
-
-      // The convolution has increased the average value of the image
-      // by a factor of about 65536.  If we proceed without scaling
-      // down, we'll overflow our 32 bit ints!  Fix this here.
-      blurredImage >>= 16;
-
-      // Now compute products of gradients at each pixel.  Note that
-      // the gradient calculation is not valid at the very edge of the
-      // window (where the gradient filter extends into no-mans-land)
-      // so search region will be reduced slightly by this call.
-      this->computeGradients(
-        blurredImage, m_gradientXX, m_gradientXY, m_gradientYY,
-        m_searchRegionCorner0, m_searchRegionCorner1);
+      // Each stage of the pipeline leaves a little deadspace at the
+      // edges of the image: the pre-blur, the 3x3 gradient filter,
+      // and the integration window.  Only the interior region has
+      // valid corner responses.
+      std::size_t const rows = inImage.rows();
+      std::size_t const columns = inImage.columns();
+      std::size_t const border =
+        m_blurKernel.size() / 2 + 1 + m_windowKernel.size() / 2;
+
+      // Adjust array sizes, if necessary.  The response array is
+      // zeroed so that non-max suppression just inside the search
+      // region compares against something sensible.  Pixels outside
+      // the search region are never written, so this only has to
+      // happen when the image size changes.
+      if((m_harrisIndicators.rows() != rows)
+         || (m_harrisIndicators.columns() != columns)) {
+        m_harrisIndicators.reinit(rows, columns);
+        m_gradientXX.reinit(rows, columns);
+        m_gradientXY.reinit(rows, columns);
+        m_gradientYY.reinit(rows, columns);
+        m_harrisIndicators = FloatType(0);
+#if BRICK_COMPUTERVISION_HARRIS_PEDANTIC
+        // Zero out untouched (and unused) pixels.
+        m_gradientXX = 0;
+        m_gradientXY = 0;
+        m_gradientYY = 0;
+#endif /* #if BRICK_COMPUTERVISION_HARRIS_PEDANTIC */
+      }
 
-      // To get rotation independent Harris corners, the integration
-      // for each pixel needs to be weighted with a circularly
-      // symmetric window.  We'll use another gaussian blur.  Remember
-      // that we're convolving with the squares of gradients.  To
-      // avoid risk of overflow, this kernel is normalized so it
-      // integrates to a smaller value (45 * 45 = 2025).
-      gaussian = getGaussianKernelBySize<brick::common::Int32>(
-        size_t(11), size_t(11), -1.0, -1.0, true, 45, 45);
-      unsigned int radius = 5;
-
-      // Do the weighted integration by means of separable convolution.
-      brick::numeric::Array2D<AccumulatedType> proxyArray0;
-      brick::numeric::Array2D<AccumulatedType> proxyArray1;
-
-      // We need these proxies because otherwise g++ complains about
-      // passing an rvalue to initialize non-const reference in the
-      // filter*() calls.
-      proxyArray0 = workspace.getRegion(m_searchRegionCorner0,
-                                        m_searchRegionCorner1);
-      proxyArray1 = m_gradientXX.getRegion(m_searchRegionCorner0,
-                                           m_searchRegionCorner1),
-      brick::numeric::filterRows(
-        proxyArray0, proxyArray1, gaussian.getRowComponent());
-      brick::numeric::filterColumns(
-        proxyArray1, proxyArray0, gaussian.getColumnComponent());
-
-      proxyArray1 = m_gradientXY.getRegion(m_searchRegionCorner0,
-                                           m_searchRegionCorner1),
-      brick::numeric::filterRows(
-        proxyArray0, proxyArray1, gaussian.getRowComponent());
-      brick::numeric::filterColumns(
-        proxyArray1, proxyArray0, gaussian.getColumnComponent());
-
-      proxyArray1 = m_gradientYY.getRegion(m_searchRegionCorner0,
-                                           m_searchRegionCorner1),
-      brick::numeric::filterRows(
-        proxyArray0, proxyArray1, gaussian.getRowComponent());
-      brick::numeric::filterColumns(
-        proxyArray1, proxyArray0, gaussian.getColumnComponent());
-
-      // The size of this filter affects the region of the image for
-      // which the Harris corner metric will be valid, so we update
-      // the search region here as well.
-      m_searchRegionCorner0.setValue(
-        m_searchRegionCorner0.getRow() + radius,
-        m_searchRegionCorner0.getColumn() + radius);
-      m_searchRegionCorner1.setValue(
-        m_searchRegionCorner1.getRow() - radius,
-        m_searchRegionCorner1.getColumn() - radius);
-
-      // Again we have to worry about overflow.  Rather than guessing,
-      // just search to find the max value, and rescale based on that.
-      // Ideally, this search would be done during the convolution
-      // above.
-      brick::common::Int32 maxVal =
-        brick::numeric::maximum(
-          m_gradientXX.getRegion(m_searchRegionCorner0,
-                                 m_searchRegionCorner1));
-      maxVal = std::max(
-        maxVal, brick::numeric::maximum(
-          m_gradientXY.getRegion(m_searchRegionCorner0,
-                                 m_searchRegionCorner1)));
-      maxVal = std::max(
-        maxVal, brick::numeric::maximum(
-          m_gradientYY.getRegion(m_searchRegionCorner0,
-                                 m_searchRegionCorner1)));
-      brick::common::Int32 divisor = maxVal / 65535 + 1;
-
-      // Rescale each of the images.  The exact rescaling factor
-      // doesn't matter too much here, as all of the processing
-      // downstream from here is theoretically scale-independent.  The
-      // bigger divisor is, however, the more precision we lose, so we
-      // want divisor to be small.
-      m_gradientXX.getRegion(m_searchRegionCorner0, m_searchRegionCorner1)
-        /= divisor;
-      m_gradientXY.getRegion(m_searchRegionCorner0, m_searchRegionCorner1)
-        /= divisor;
-      m_gradientYY.getRegion(m_searchRegionCorner0, m_searchRegionCorner1)
-        /= divisor;
-
-      // Compute the Harris indicator for each pixel in the region.
-      this->computeHarrisIndicators(
-        m_gradientXX, m_gradientXY, m_gradientYY, m_harrisIndicators,
-        m_searchRegionCorner0, m_searchRegionCorner1);
+      m_searchRegionCorner0.setValue(border, border);
+      if(rows <= 2 * border || columns <= 2 * border) {
+        // Image is too small to contain any valid responses.
+        m_searchRegionCorner1.setValue(border, border);
+        return;
+      }
+      m_searchRegionCorner1.setValue(rows - border, columns - border);
+
+      std::size_t numberOfThreads = m_numberOfThreads;
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
+      }
+
+      // Each strip recomputes a few rows of halo above and below, so
+      // we don't split the image any finer than necessary to keep
+      // the threads busy.
+      std::size_t const minimumStripRows = 64;
+      std::size_t const validRows = rows - 2 * border;
+      std::size_t numberOfStrips =
+        std::min(numberOfThreads, validRows / minimumStripRows);
+      if(numberOfStrips == 0) {
+        numberOfStrips = 1;
+      }
+
+      brick::common::executeInParallel(
+        numberOfStrips,
+        [&](std::size_t stripIndex) {
+          std::size_t const firstRow =
+            border + (stripIndex * validRows) / numberOfStrips;
+          std::size_t const endRow =
+            border + ((stripIndex + 1) * validRows) / numberOfStrips;
+          this->computeStrip(inImage, firstRow, endRow);
+        },
+        numberOfThreads);
     }
 
 
     // ============== Private member functions below this line ==============
 
+    // This member function runs the whole detector for one strip of
+    // output rows.
     template <class FloatType>
     void
     KeypointSelectorHarris<FloatType>::
-    computeGradients(
-      Image<GRAY_SIGNED32> const& inImage,
-      brick::numeric::Array2D<AccumulatedType>& gradientXX,
-      brick::numeric::Array2D<AccumulatedType>& gradientXY,
-      brick::numeric::Array2D<AccumulatedType>& gradientYY,
-      brick::numeric::Index2D& corner0,
-      brick::numeric::Index2D& corner1)
+    computeStrip(Image<GRAY8> const& inImage,
+                 std::size_t firstRow,
+                 std::size_t endRow)
     {
-      int const rowStep     = inImage.getRowStep();
-      int const startRow    = corner0.getRow();
-      int const stopRow     = corner1.getRow();
-      int const startColumn = corner0.getColumn();
-      int const stopColumn  = corner1.getColumn();
-
-      // Adjust array sizes, if necessary.
-      if((gradientXX.rows() != inImage.rows())
-         || (gradientXX.columns() != inImage.columns())) {
-        gradientXX.reinit(inImage.rows(), inImage.columns());
-        gradientXY.reinit(inImage.rows(), inImage.columns());
-        gradientYY.reinit(inImage.rows(), inImage.columns());
+      std::size_t const columns = inImage.columns();
+      std::size_t const blurSize = m_blurKernel.size();
+      std::size_t const windowSize = m_windowKernel.size();
+      std::size_t const blurRadius = blurSize / 2;
+      std::size_t const windowRadius = windowSize / 2;
+      brick::common::Int32 const* const blurKernel = m_blurKernel.data();
+      brick::common::Int32 const* const windowKernel = m_windowKernel.data();
+
+      // Column ranges over which each stage produces valid output.
+      std::size_t const blurStart = blurRadius;
+      std::size_t const blurStop = columns - blurRadius;
+      std::size_t const gradientStart = blurStart + 1;
+      std::size_t const gradientStop = blurStop - 1;
+      std::size_t const windowStart = gradientStart + windowRadius;
+      std::size_t const windowStop = gradientStop - windowRadius;
+
+      // Row ranges required from each stage to produce output rows
+      // [firstRow, endRow).
+      std::size_t const firstProductRow = firstRow - windowRadius;
+      std::size_t const firstBlurredRow = firstProductRow - 1;
+      std::size_t const firstInputRow = firstBlurredRow - blurRadius;
+      std::size_t const endInputRow = endRow + windowRadius + 1 + blurRadius;
+
+      // Ring buffers hold the most recent few rows of each
+      // intermediate result, so that no full-sized intermediate
+      // image is ever written.  The row-filtered input fits in 16
+      // bits because the blur kernel sums to at most 257 (checked in
+      // the constructor), and the blurred image and its gradients fit
+      // in 16 bits because the blur output is rescaled to [0, 255].
+      // Products of gradients and window sums need 32 bits.
+      std::vector<brick::common::UInt16> rowFiltered(blurSize * columns);
+      std::vector<brick::common::Int16> blurred(3 * columns);
+      std::vector<AccumulatedType> products(3 * columns);
+      std::vector<AccumulatedType> windowed(3 * windowSize * columns);
+      std::vector<AccumulatedType> accumulator(columns);
+
+      // The responses are computed from the structure tensor divided
+      // by the gain of the Sobel filter (4 * 4) and of the
+      // integration window, so that they are in units of squared
+      // gray levels, independent of image content.  This keeps
+      // thresholds meaningful from one image to the next.
+      AccumulatedType windowSum = 0;
+      for(std::size_t tap = 0; tap < windowSize; ++tap) {
+        windowSum += windowKernel[tap];
       }
+      FloatType const scale =
+        FloatType(1) / (FloatType(16) * FloatType(windowSum * windowSum));
+
+      for(std::size_t inputRow = firstInputRow; inputRow < endInputRow;
+          ++inputRow) {
+
+        // Horizontal pass of the pre-blur.
+        {
+          brick::common::UInt8 const* inPtr = inImage.data(inputRow, 0);
+          brick::common::UInt16* outPtr =
+            &(rowFiltered[(inputRow % blurSize) * columns]);
+          std::fill(accumulator.begin() + blurStart,
+                    accumulator.begin() + blurStop, 0);
+          for(std::size_t tap = 0; tap < blurSize; ++tap) {
+            brick::common::Int32 const weight = blurKernel[tap];
+            brick::common::UInt8 const* tapPtr = inPtr + tap;
+            for(std::size_t column = blurStart; column < blurStop;
+                ++column) {
+              accumulator[column] += weight * tapPtr[column - blurStart];
+            }
+          }
+          for(std::size_t column = blurStart; column < blurStop; ++column) {
+            outPtr[column] =
+              static_cast<brick::common::UInt16>(accumulator[column]);
+          }
+        }
+        if(inputRow < firstInputRow + 2 * blurRadius) {
+          continue;
+        }
 
-#if BRICK_COMPUTERVISION_HARRIS_PEDANTIC
-      // Zero out untouched (and unused) pixels.
-      gradientXX = 0;
-      gradientXY = 0;
-      gradientYY = 0;
-#endif /* #if BRICK_COMPUTERVISION_HARRIS_PEDANTIC */
+        // Vertical pass of the pre-blur.  The 2D kernel integrates
+        // to approximately 65536, so shift back down to [0, 255].
+        std::size_t const blurredRow = inputRow - blurRadius;
+        {
+          std::fill(accumulator.begin() + blurStart,
+                    accumulator.begin() + blurStop, 0);
+          for(std::size_t tap = 0; tap < blurSize; ++tap) {
+            brick::common::Int32 const weight = blurKernel[tap];
+            brick::common::UInt16 const* tapPtr = &(rowFiltered[
+                ((blurredRow - blurRadius + tap) % blurSize) * columns]);
+            for(std::size_t column = blurStart; column < blurStop;
+                ++column) {
+              accumulator[column] += weight * tapPtr[column];
+            }
+          }
+          brick::common::Int16* outPtr =
+            &(blurred[(blurredRow % 3) * columns]);
+          for(std::size_t column = blurStart; column < blurStop; ++column) {
+            outPtr[column] =
+              static_cast<brick::common::Int16>(accumulator[column] >> 16);
+          }
+        }
+        if(blurredRow < firstBlurredRow + 2) {
+          continue;
+        }
 
-      for(int row = stopRow - 1; row >= startRow; --row) {
-        brick::numeric::Array1D<brick::common::Int32> imageRow =
-          inImage.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> xxRow =
-          gradientXX.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> xyRow =
-          gradientXY.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> yyRow =
-          gradientYY.getRow(row);
-
-        // Note that in the filter code below, we actually index
-        // _outside_ of the data pointed to by imageRow.  This is "ok"
-        // because we know that imageRow points into inImage (and we
-        // know the memory layout of inImage), so we're sure there's
-        // valid data, even past the end or beginning of the row.
-        for(int column = stopColumn - 1; column >= startColumn;
-            --column) {
-          brick::common::Int32 gradientX =
-            (((static_cast<brick::common::Int32>(imageRow[column + 1])
-               - static_cast<brick::common::Int32>(imageRow[column - 1])) << 1)
-             + (static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) + rowStep + 1))
-                - static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) + rowStep - 1)))
-             + (static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) - rowStep + 1))
-                - static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) - rowStep - 1)))); /* >> 2; */
-          brick::common::Int32 gradientY =
-            (((static_cast<brick::common::Int32>(
-                 *(imageRow.getData(column) + rowStep))
-               - static_cast<brick::common::Int32>(
-                 *(imageRow.getData(column) - rowStep))) << 1)
-             + (static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) + rowStep - 1))
-                - static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) - rowStep - 1)))
-             + (static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) + rowStep + 1))
-                - static_cast<brick::common::Int32>(
-                  *(imageRow.getData(column) - rowStep + 1)))); /* >> 2 */;
-          xxRow[column] = (gradientX * gradientX); /* >> 4; */
-          xyRow[column] = (gradientX * gradientY); /* >> 4; */
-          yyRow[column] = (gradientY * gradientY); /* >> 4; */
+        // Sobel gradients and their products.
+        std::size_t const productRow = blurredRow - 1;
+        {
+          brick::common::Int16 const* upPtr =
+            &(blurred[((productRow - 1) % 3) * columns]);
+          brick::common::Int16 const* midPtr =
+            &(blurred[(productRow % 3) * columns]);
+          brick::common::Int16 const* downPtr =
+            &(blurred[((productRow + 1) % 3) * columns]);
+          AccumulatedType* xxPtr = &(products[0]);
+          AccumulatedType* xyPtr = &(products[columns]);
+          AccumulatedType* yyPtr = &(products[2 * columns]);
+          for(std::size_t column = gradientStart; column < gradientStop;
+              ++column) {
+            AccumulatedType const gradientX =
+              ((AccumulatedType(midPtr[column + 1])
+                - AccumulatedType(midPtr[column - 1])) << 1)
+              + (AccumulatedType(downPtr[column + 1])
+                 - AccumulatedType(downPtr[column - 1]))
+              + (AccumulatedType(upPtr[column + 1])
+                 - AccumulatedType(upPtr[column - 1]));
+            AccumulatedType const gradientY =
+              ((AccumulatedType(downPtr[column])
+                - AccumulatedType(upPtr[column])) << 1)
+              + (AccumulatedType(downPtr[column - 1])
+                 - AccumulatedType(upPtr[column - 1]))
+              + (AccumulatedType(downPtr[column + 1])
+                 - AccumulatedType(upPtr[column + 1]));
+            xxPtr[column] = gradientX * gradientX;
+            xyPtr[column] = gradientX * gradientY;
+            yyPtr[column] = gradientY * gradientY;
+          }
+        }
+
+        // Horizontal pass of the integration window, for each of the
+        // three products.
+        std::size_t const windowSlot = productRow % windowSize;
+        for(std::size_t channel = 0; channel < 3; ++channel) {
+          AccumulatedType const* inPtr = &(products[channel * columns]);
+          AccumulatedType* outPtr =
+            &(windowed[(channel * windowSize + windowSlot) * columns]);
+          std::fill(outPtr + windowStart, outPtr + windowStop, 0);
+          for(std::size_t tap = 0; tap < windowSize; ++tap) {
+            AccumulatedType const weight = windowKernel[tap];
+            if(weight == 0) {
+              continue;
+            }
+            AccumulatedType const* tapPtr = inPtr + tap;
+            for(std::size_t column = windowStart; column < windowStop;
+                ++column) {
+              outPtr[column] += weight * tapPtr[column - windowRadius];
+            }
+          }
+        }
+        if(productRow < firstProductRow + 2 * windowRadius) {
+          continue;
+        }
+
+        // Vertical pass of the integration window.
+        std::size_t const row = productRow - windowRadius;
+        AccumulatedType* const outputRows[3] = {
+          m_gradientXX.rowBegin(row),
+          m_gradientXY.rowBegin(row),
+          m_gradientYY.rowBegin(row)
+        };
+        for(std::size_t channel = 0; channel < 3; ++channel) {
+          AccumulatedType* outPtr = outputRows[channel];
+          std::fill(outPtr + windowStart, outPtr + windowStop, 0);
+          for(std::size_t tap = 0; tap < windowSize; ++tap) {
+            AccumulatedType const weight = windowKernel[tap];
+            if(weight == 0) {
+              continue;
+            }
+            AccumulatedType const* tapPtr = &(windowed[
+                (channel * windowSize + (row - windowRadius + tap) % windowSize)
+                * columns]);
+            for(std::size_t column = windowStart; column < windowStop;
+                ++column) {
+              outPtr[column] += weight * tapPtr[column];
+            }
+          }
+        }
+
+        // Corner response.  This is computed in floating point,
+        // since the determinant of the window sums easily overflows
+        // 32 bits.
+        AccumulatedType const* xxPtr = outputRows[0];
+        AccumulatedType const* xyPtr = outputRows[1];
+        AccumulatedType const* yyPtr = outputRows[2];
+        FloatType* responsePtr = m_harrisIndicators.rowBegin(row);
+        if(m_responseType == BRICK_SHI_TOMASI_RESPONSE) {
+          for(std::size_t column = windowStart; column < windowStop;
+              ++column) {
+            FloatType const xx = scale * xxPtr[column];
+            FloatType const xy = scale * xyPtr[column];
+            FloatType const yy = scale * yyPtr[column];
+            FloatType const difference = xx - yy;
+            responsePtr[column] =
+              FloatType(0.5) * (xx + yy - brick::common::squareRoot(
+                                  difference * difference
+                                  + FloatType(4) * xy * xy));
+          }
+        } else {
+          for(std::size_t column = windowStart; column < windowStop;
+              ++column) {
+            FloatType const xx = scale * xxPtr[column];
+            FloatType const xy = scale * xyPtr[column];
+            FloatType const yy = scale * yyPtr[column];
+            FloatType const trace = xx + yy;
+            responsePtr[column] = xx * yy - xy * xy - m_kappa * trace * trace;
+          }
         }
       }
+    }
+
 
-      // Adjust search region to reflect the fact that the gradient
-      // result is not valid on border pixels.
-      corner0.setValue(startRow + 1, startColumn + 1);
-      corner1.setValue(stopRow  - 1, stopColumn  - 1);
+    // This member function is the 8-neighbor non-max suppression
+    // test shared by the bucketed keypoint accessors.
+    template <class FloatType>
+    bool
+    KeypointSelectorHarris<FloatType>::
+    isLocalMaximum(unsigned int row, unsigned int column) const
+    {
+      std::size_t const rowStep = m_harrisIndicators.getRowStep();
+      FloatType const* candidatePtr = m_harrisIndicators.data(row, column);
+      return ((*candidatePtr > *(candidatePtr + 1))
+              && (*candidatePtr > *(candidatePtr - 1))
+              && (*candidatePtr > *(candidatePtr + rowStep))
+              && (*candidatePtr > *(candidatePtr - rowStep))
+              && (*candidatePtr > *(candidatePtr + rowStep + 1))
+              && (*candidatePtr > *(candidatePtr - rowStep - 1))
+              && (*candidatePtr > *(candidatePtr + rowStep - 1))
+              && (*candidatePtr > *(candidatePtr - rowStep + 1)));
     }
 
 
+    // This member function does the subpixel refinement for
+    // getKeypointsGeneralPosition() and
+    // getKeypointsGeneralPositionBucketed().
     template <class FloatType>
+    template <class Iter>
     void
     KeypointSelectorHarris<FloatType>::
-    computeHarrisIndicators(
-      brick::numeric::Array2D<AccumulatedType> const& gradientXX,
-      brick::numeric::Array2D<AccumulatedType> const& gradientXY,
-      brick::numeric::Array2D<AccumulatedType> const& gradientYY,
-      brick::numeric::Array2D<FloatType>& harrisIndicators,
-      brick::numeric::Index2D const& corner0,
-      brick::numeric::Index2D const& corner1)
+    refineKeypoint(unsigned int row, unsigned int column,
+                   Iter& iterator) const
     {
-      // Get bounds on the region of valid pixels for this calculation.
-      unsigned int const startRow    = corner0.getRow();
-      unsigned int const stopRow     = corner1.getRow();
-      unsigned int const startColumn = corner0.getColumn();
-      unsigned int const stopColumn  = corner1.getColumn();
-
-      // Adjust array size, if necessary.
-      if((harrisIndicators.rows() != gradientXX.rows())
-         || (harrisIndicators.columns() != gradientXX.columns())) {
-        harrisIndicators.reinit(gradientXX.rows(), gradientXX.columns());
+      std::size_t const rowStep = m_harrisIndicators.getRowStep();
+      FloatType const* candidatePtr = m_harrisIndicators.data(row, column);
+      FloatType rowCoordinate;
+      FloatType columnCoordinate;
+      FloatType extremeValue;
+      if(brick::numeric::subpixelInterpolate(
+           FloatType(row), FloatType(column),
+           *(candidatePtr - rowStep - 1), *(candidatePtr - rowStep),
+           *(candidatePtr - rowStep + 1),
+           *(candidatePtr - 1), *candidatePtr, *(candidatePtr + 1),
+           *(candidatePtr + rowStep - 1), *(candidatePtr + rowStep),
+           *(candidatePtr + rowStep + 1),
+           rowCoordinate, columnCoordinate, extremeValue)) {
+
+        // Sanity check interpolation result, as subpixelInterpolate()
+        // does not do so.
+        if(common::absoluteValue(rowCoordinate - row) < 1.0
+           && common::absoluteValue(columnCoordinate - column) < 1.0) {
+
+          // These interpolators will make things easy on us when
+          // gathering information about keypoints in non-integral
+          // positions.  They're cheap to construct, since they just
+          // reference the arrays.
+          brick::numeric::BilinearInterpolator<AccumulatedType, FloatType>
+            xxInterpolator(m_gradientXX);
+          brick::numeric::BilinearInterpolator<AccumulatedType, FloatType>
+            xyInterpolator(m_gradientXY);
+          brick::numeric::BilinearInterpolator<AccumulatedType, FloatType>
+            yyInterpolator(m_gradientYY);
+
+          *(iterator++) = KeypointHarris<FloatType>(
+            rowCoordinate, columnCoordinate, extremeValue,
+            xxInterpolator(rowCoordinate, columnCoordinate),
+            xyInterpolator(rowCoordinate, columnCoordinate),
+            yyInterpolator(rowCoordinate, columnCoordinate));
+        }
       }
+    }
 
-      // Iterate over all pixels in the valid region.
-      for(unsigned int row = stopRow - 1; row >= startRow; --row) {
-        brick::numeric::Array1D<AccumulatedType> xxRow =
-          gradientXX.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> xyRow =
-          gradientXY.getRow(row);
-        brick::numeric::Array1D<AccumulatedType> yyRow =
-          gradientYY.getRow(row);
-        brick::numeric::Array1D<FloatType> harrisRow =
-          harrisIndicators.getRow(row);
-        for(unsigned int column = stopColumn - 1; column >= startColumn;
-            --column) {
-          AccumulatedType determinant = (xxRow[column] * yyRow[column]
-                                - xyRow[column] * xyRow[column]);
-          AccumulatedType trace = xxRow[column] + yyRow[column];
-          harrisRow[column] = determinant - m_kappa * trace * trace;
+
+    // This member function finds local maxima, keeps the strongest
+    // few in each grid cell, and then the strongest maxKeypoints
+    // overall.
+    template <class FloatType>
+    void
+    KeypointSelectorHarris<FloatType>::
+    selectCandidates(std::vector<Candidate>& candidates,
+                     unsigned int margin,
+                     std::size_t maxKeypoints,
+                     std::size_t gridRows,
+                     std::size_t gridColumns,
+                     FloatType threshold) const
+    {
+      candidates.clear();
+      if(gridRows == 0 || gridColumns == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "KeypointSelectorHarris::selectCandidates()",
+                    "Arguments gridRows and gridColumns must be nonzero.");
+      }
+
+      unsigned int const startRow    = m_searchRegionCorner0.getRow() + margin;
+      unsigned int const startColumn =
+        m_searchRegionCorner0.getColumn() + margin;
+      unsigned int const stopRow     = m_searchRegionCorner1.getRow();
+      unsigned int const stopColumn  = m_searchRegionCorner1.getColumn();
+      if(maxKeypoints == 0
+         || stopRow < startRow + margin + 1
+         || stopColumn < startColumn + margin + 1) {
+        return;
+      }
+      std::size_t const height = (stopRow - margin) - startRow;
+      std::size_t const width = (stopColumn - margin) - startColumn;
+
+      // Sort local maxima into grid cells.
+      std::vector< std::vector<Candidate> > cells(gridRows * gridColumns);
+      for(unsigned int row = startRow; row < stopRow - margin; ++row) {
+        std::size_t const cellRow = ((row - startRow) * gridRows) / height;
+        FloatType const* responseRow = m_harrisIndicators.rowBegin(row);
+        for(unsigned int column = startColumn; column < stopColumn - margin;
+            ++column) {
+          if(responseRow[column] > threshold
+             && this->isLocalMaximum(row, column)) {
+            std::size_t const cellColumn =
+              ((column - startColumn) * gridColumns) / width;
+            Candidate candidate = {responseRow[column], row, column};
+            cells[cellRow * gridColumns + cellColumn].push_back(candidate);
+          }
+        }
+      }
+
+      // Ties are broken by position so that results don't depend on
+      // the order in which std::nth_element() leaves things.
+      auto isStronger = [](Candidate const& arg0, Candidate const& arg1) {
+        if(arg0.value != arg1.value) {return arg0.value > arg1.value;}
+        if(arg0.row != arg1.row) {return arg0.row < arg1.row;}
+        return arg0.column < arg1.column;
+      };
+
+      // Keep each cell's share of the strongest candidates.
+      std::size_t const cellQuota =
+        (maxKeypoints + cells.size() - 1) / cells.size();
+      for(std::size_t ii = 0; ii < cells.size(); ++ii) {
+        std::vector<Candidate>& cell = cells[ii];
+        if(cell.size() > cellQuota) {
+          std::nth_element(cell.begin(), cell.begin() + cellQuota,
+                           cell.end(), isStronger);
+          cell.resize(cellQuota);
         }
+        candidates.insert(candidates.end(), cell.begin(), cell.end());
       }
+
+      // Rounding the quota up may have left us with a few too many.
+      if(candidates.size() > maxKeypoints) {
+        std::nth_element(candidates.begin(),
+                         candidates.begin() + maxKeypoints,
+                         candidates.end(), isStronger);
+        candidates.resize(maxKeypoints);
+      }
+      std::sort(candidates.begin(), candidates.end(), isStronger);
     }
 
+
   } // namespace computerVision
 
 } // namespace brick
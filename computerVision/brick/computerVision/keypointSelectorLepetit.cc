@@ -21,6 +21,7 @@ namespace brick {
     KeypointSelectorLepetit()
       : m_levelVector(),
         m_locationVector(),
+        m_numberOfThreads(0),
         m_thresholdLaplacianMagnitude(0.0),
         m_thresholdPixelSimilarity(0.0)
     {
@@ -36,6 +37,14 @@ namespace brick {
     }
 
 
+    std::vector<unsigned int>
+    KeypointSelectorLepetit::
+    getKeypointLevels()
+    {
+      return m_levelVector;
+    }
+
+
     float
     KeypointSelectorLepetit::
     getLaplacianMagnitudeThreshold()
@@ -14,8 +14,10 @@
 #ifndef BRICK_COMPUTERVISION_KEYPOINTSELECTORLEPETIT_HH
 #define BRICK_COMPUTERVISION_KEYPOINTSELECTORLEPETIT_HH
 
+#include <cstddef>
 #include <vector>
 #include <brick/computerVision/image.hh>
+#include <brick/computerVision/imagePyramid.hh>
 #include <brick/numeric/index2D.hh>
 
 namespace brick {
@@ -30,8 +32,12 @@ namespace brick {
      ** have low contrast, or are poorly localized due to lying on
      ** intensity edges in the image.
      **
-     ** Template argument Format specifies the format of the input
-     ** image.
+     ** The scale space may be supplied by the caller, using
+     ** setImagePyramid(), so that one pyramid can be shared between
+     ** several keypoint selectors.  Pixel tests run a row at a time
+     ** in integer arithmetic for GRAY8 pyramids, and in single
+     ** precision floating point otherwise.  Pyramid levels are split
+     ** into bands of rows, which are processed in parallel.
      **/
     class KeypointSelectorLepetit {
     public:
@@ -43,9 +49,12 @@ namespace brick {
       std::vector<numeric::Index2D> getKeypoints();
 
 
-      Image<GRAY_FLOAT32> getImageLevel(unsigned int level);
-
-
+      /**
+       * Returns the pyramid level at which each of the keypoints
+       * returned by getKeypoints() was detected.
+       *
+       * @return The return value has one element for each keypoint.
+       */
       std::vector<unsigned int> getKeypointLevels();
 
 
@@ -55,33 +64,81 @@ namespace brick {
       float getPixelSimilarityThreshold();
 
 
+      /**
+       * Builds a three level, single precision, low-pass image
+       * pyramid from the input image, and then searches it for
+       * keypoints, as if by setImagePyramid().
+       *
+       * @param image This argument is the image to be searched.
+       */
       template <ImageFormat Format>
       void
       setImage(Image<Format> const& image);
 
+
+      /**
+       * Searches an existing image pyramid for keypoints.  This lets
+       * several keypoint selectors share one scale space.  The
+       * pyramid should be built with constructor argument isBandPass
+       * set to false, so that each level is low-pass filtered rather
+       * than a Difference-of-Gaussians image.  Detection thresholds
+       * are estimated from level 0.  Keypoint coordinates are
+       * reported in level 0 coordinates.
+       *
+       * @code
+       *   ImagePyramid<GRAY8, GRAY8, common::Float32> pyramid(
+       *     inputImage, 2.0, 3, false);
+       *   lepetitSelector.setImagePyramid(pyramid);
+       *   harrisSelector.setImage(pyramid.getLevel(1));
+       * @endcode
+       *
+       * @param pyramid This argument is the pyramid to be searched.
+       * GRAY8 pyramids are searched using integer arithmetic.
+       *
+       * @param maximumNumberOfLevels This argument specifies how many
+       * pyramid levels, starting from level 0, should be searched.
+       * Setting it to zero searches all levels.
+       */
+      template <ImageFormat Format, ImageFormat InternalFormat,
+                class KernelType>
+      void
+      setImagePyramid(
+        ImagePyramid<Format, InternalFormat, KernelType>& pyramid,
+        unsigned int maximumNumberOfLevels = 3);
+
+
+      /**
+       * Sets the number of threads used by setImage() and
+       * setImagePyramid().
+       *
+       * @param numberOfThreads This argument specifies the number of
+       * threads.  If it is zero (the default), a sensible default is
+       * chosen.
+       */
+      void
+      setNumberOfThreads(std::size_t numberOfThreads) {
+        m_numberOfThreads = numberOfThreads;
+      }
+
     private:
 
+      template <ImageFormat Format>
       void
-      estimateThresholds(Image<GRAY_FLOAT32> const& image,
+      estimateThresholds(Image<Format> const& image,
                          float& pixelSimilarityThreshold,
                          float& laplacianMagnitudeThreshold);
 
+      template <ImageFormat Format>
       void
       measurePixelThresholds(unsigned int row, unsigned int column,
-                             Image<GRAY_FLOAT32> const& image,
+                             Image<Format> const& image,
                              float& pixelSimilarity,
                              float& laplacianMagnitude);
 
-      bool
-      testPixel(unsigned int row, unsigned int column,
-                Image<GRAY_FLOAT32> const& image,
-                float pixelSimilarityThreshold,
-                float laplacianMagnitudeThreshold);
-
-
 
-      std::vector<float> m_levelVector;
+      std::vector<unsigned int> m_levelVector;
       std::vector<brick::numeric::Index2D> m_locationVector;
+      std::size_t m_numberOfThreads;
       float m_thresholdLaplacianMagnitude;
       float m_thresholdPixelSimilarity;
     };
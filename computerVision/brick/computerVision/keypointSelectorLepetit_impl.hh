@@ -20,14 +20,159 @@
 // #include <brick/computerVision/keypointSelectorLepetit.hh>
 
 #include <algorithm>
+#include <cmath>
 #include <brick/common/mathFunctions.hh>
-#include <brick/computerVision/imagePyramid.hh>
+#include <brick/common/parallel.hh>
+#include <brick/computerVision/utilities.hh>
 
 
 namespace brick {
 
   namespace computerVision {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // This traits class specifies the arithmetic used to test the
+      // pixels of each type.  Thresholds are converted so that the
+      // tests below give the same answers as the floating point
+      // comparisons in Lepetit's description.
+      template <class PixelType>
+      struct LepetitArithmetic {
+        typedef float WorkType;
+
+        static WorkType
+        getSimilarityThreshold(float threshold) {return threshold;}
+
+        // Compared against 16 times the Laplacian approximation.
+        static WorkType
+        getLaplacianThreshold(float threshold) {return 16.0f * threshold;}
+      };
+
+
+      // For integer pixels, |a - b| < t if and only if |a - b| <
+      // ceil(t), and |d| > 16 * t if and only if |d| > floor(16 * t).
+      template <>
+      struct LepetitArithmetic<brick::common::UInt8> {
+        typedef brick::common::Int32 WorkType;
+
+        static WorkType
+        getSimilarityThreshold(float threshold) {
+          return static_cast<WorkType>(std::ceil(threshold));
+        }
+
+        static WorkType
+        getLaplacianThreshold(float threshold) {
+          return static_cast<WorkType>(std::floor(16.0f * threshold));
+        }
+      };
+
+
+      // Branch-free absolute value, so that the loop in
+      // testLepetitRow() can be vectorized.
+      template <class Type>
+      inline Type
+      lepetitAbs(Type value) {return (value < Type(0)) ? -value : value;}
+
+
+      // Returns 1 if the gray levels of center and pixel differ by
+      // less than threshold, and 0 otherwise.
+      template <class Type>
+      inline int
+      isLepetitSimilar(Type center, Type pixel, Type threshold)
+      {
+        return int(lepetitAbs(center - pixel) < threshold);
+      }
+
+
+      // This function applies Lepetit's stability and Laplacian
+      // tests to each pixel in columns [startColumn, stopColumn) of
+      // one image row, setting passFlags[column] to 1 for pixels
+      // that pass and 0 otherwise.  The tests use a Bresenham circle
+      // of radius 3, following Rosten's FAST detector.  Each test is
+      // evaluated for every pixel without short-circuiting, which
+      // lets the compiler process several pixels at once.
+      template <class PixelType>
+      void
+      testLepetitRow(PixelType const* rowPtr,
+                     std::ptrdiff_t rowStep,
+                     std::size_t startColumn,
+                     std::size_t stopColumn,
+                     typename LepetitArithmetic<PixelType>::WorkType
+                       similarityThreshold,
+                     typename LepetitArithmetic<PixelType>::WorkType
+                       laplacianThreshold,
+                     brick::common::UInt8* passFlags)
+      {
+        typedef typename LepetitArithmetic<PixelType>::WorkType WorkType;
+        PixelType const* r0 = rowPtr - 3 * rowStep;
+        PixelType const* r1 = rowPtr - 2 * rowStep;
+        PixelType const* r2 = rowPtr - rowStep;
+        PixelType const* r3 = rowPtr;
+        PixelType const* r4 = rowPtr + rowStep;
+        PixelType const* r5 = rowPtr + 2 * rowStep;
+        PixelType const* r6 = rowPtr + 3 * rowStep;
+        WorkType const t = similarityThreshold;
+        for(std::size_t column = startColumn; column < stopColumn; ++column) {
+          WorkType const center = r3[column];
+
+          // The 16 pixels of the circle, in the order used to sum
+          // them for the Laplacian approximation.
+          WorkType const p00 = r0[column - 1];
+          WorkType const p01 = r0[column];
+          WorkType const p02 = r0[column + 1];
+          WorkType const p03 = r1[column - 2];
+          WorkType const p04 = r1[column + 2];
+          WorkType const p05 = r2[column - 3];
+          WorkType const p06 = r2[column + 3];
+          WorkType const p07 = r3[column - 3];
+          WorkType const p08 = r3[column + 3];
+          WorkType const p09 = r4[column - 3];
+          WorkType const p10 = r4[column + 3];
+          WorkType const p11 = r5[column - 2];
+          WorkType const p12 = r5[column + 2];
+          WorkType const p13 = r6[column - 1];
+          WorkType const p14 = r6[column];
+          WorkType const p15 = r6[column + 1];
+
+          // A pixel is unstable if its gray level is "...close to
+          // those of any two diametrically opposed pixels on ... [the
+          // discretized circle surrounding the current pixel]...".
+          int const isUnstable =
+            (isLepetitSimilar(center, p07, t)
+               & isLepetitSimilar(center, p08, t))
+            | (isLepetitSimilar(center, p01, t)
+                 & isLepetitSimilar(center, p14, t))
+            | (isLepetitSimilar(center, p12, t)
+                 & isLepetitSimilar(center, p03, t))
+            | (isLepetitSimilar(center, p04, t)
+                 & isLepetitSimilar(center, p11, t))
+            | (isLepetitSimilar(center, p10, t)
+                 & isLepetitSimilar(center, p05, t))
+            | (isLepetitSimilar(center, p02, t)
+                 & isLepetitSimilar(center, p13, t))
+            | (isLepetitSimilar(center, p15, t)
+                 & isLepetitSimilar(center, p00, t))
+            | (isLepetitSimilar(center, p06, t)
+                 & isLepetitSimilar(center, p09, t));
+
+          // Approximate Laplacian of Gaussian, scaled by 16 so that
+          // integer pixels need no division.
+          WorkType const borderSum =
+            p00 + p01 + p02 + p03 + p04 + p05 + p06 + p07
+            + p08 + p09 + p10 + p11 + p12 + p13 + p14 + p15;
+          int const isStrong = int(
+            lepetitAbs(WorkType(16) * center - borderSum) > laplacianThreshold);
+
+          passFlags[column] =
+            static_cast<brick::common::UInt8>((1 - isUnstable) & isStrong);
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
     template <ImageFormat Format>
     void
     KeypointSelectorLepetit::
@@ -39,13 +184,6 @@ namespace brick {
       // floating point.
       Image<GRAY_FLOAT32> floatImage = convertColorspace<GRAY_FLOAT32>(image);
 
-      // Lepetit's paper suggests that they've simply hard-coded some
-      // constants in their keypoint selection algorithm.  Here we try
-      // to estimate appropriate values for those constants
-      // automatically.
-      this->estimateThresholds(
-        floatImage, m_thresholdPixelSimilarity, m_thresholdLaplacianMagnitude);
-
       // Create an image pyramid, one image per octave, computing only
       // the low-pass filtered images (no need to generate
       // difference-of-Gaussian images).  For now, we'll just run on
@@ -53,43 +191,124 @@ namespace brick {
       // pyramid levels.
       ImagePyramid<GRAY_FLOAT32, GRAY_FLOAT32, common::Float32> pyramid(
         floatImage, 2.0, 3, false);
+      this->setImagePyramid(pyramid, 3);
+    }
+
+
+    template <ImageFormat Format, ImageFormat InternalFormat, class KernelType>
+    void
+    KeypointSelectorLepetit::
+    setImagePyramid(ImagePyramid<Format, InternalFormat, KernelType>& pyramid,
+                    unsigned int maximumNumberOfLevels)
+    {
+      typedef typename ImageFormatTraits<Format>::PixelType PixelType;
+      typedef privateCode::LepetitArithmetic<PixelType> Arithmetic;
+
+      m_locationVector.clear();
+      m_levelVector.clear();
+
+      unsigned int numberOfLevels = pyramid.getNumberOfLevels();
+      if(maximumNumberOfLevels != 0) {
+        numberOfLevels = std::min(numberOfLevels, maximumNumberOfLevels);
+      }
 
-      // Iterate over all pyramid levels looking for keypoints.
-      for(unsigned int level = 0; level < pyramid.getNumberOfLevels();
-          ++level) {
-        Image<GRAY_FLOAT32> currentLevel = pyramid.getLevel(level);
-
-        // We will iterate over all pixels that have a complete set of
-        // valid neighbors.  This means we need to stay at least one
-        // pixel away from the borders of the image, where the
-        // filtered image data is no longer valid.
-        unsigned int startRow = pyramid.getBorderSizeTopBottom() + 1;
-        unsigned int stopRow = (currentLevel.rows()
-                                - pyramid.getBorderSizeTopBottom() - 1);
-        unsigned int startColumn = pyramid.getBorderSizeLeftRight() + 1;
-        unsigned int stopColumn = (currentLevel.columns()
-                                   - pyramid.getBorderSizeLeftRight() - 1);
-        for(unsigned int row = startRow; row < stopRow; ++row) {
-          for(unsigned int column = startColumn; column < stopColumn;
-              ++column) {
-            if(this->testPixel(
-                 row, column, currentLevel, m_thresholdPixelSimilarity,
-                 m_thresholdLaplacianMagnitude)) {
-              brick::numeric::Index2D localKeypoint(row, column);
-              brick::numeric::Index2D keyPoint =
-                pyramid.convertImageCoordinates(localKeypoint, level, 0);
-              m_locationVector.push_back(keyPoint);
-              m_levelVector.push_back(level);
+      // Lepetit's paper suggests that they've simply hard-coded some
+      // constants in their keypoint selection algorithm.  Here we try
+      // to estimate appropriate values for those constants
+      // automatically.
+      this->estimateThresholds(
+        pyramid.getLevel(0), m_thresholdPixelSimilarity,
+        m_thresholdLaplacianMagnitude);
+      typename Arithmetic::WorkType const similarityThreshold =
+        Arithmetic::getSimilarityThreshold(m_thresholdPixelSimilarity);
+      typename Arithmetic::WorkType const laplacianThreshold =
+        Arithmetic::getLaplacianThreshold(m_thresholdLaplacianMagnitude);
+
+      // We will iterate over all pixels that have a complete set of
+      // valid neighbors.  This means we need to stay at least one
+      // pixel away from the borders of the image, where the filtered
+      // image data is no longer valid.  The circle test reaches
+      // three pixels out, so that's a lower bound on the margin.
+      unsigned int const marginRows =
+        std::max(pyramid.getBorderSizeTopBottom() + 1, 3u);
+      unsigned int const marginColumns =
+        std::max(pyramid.getBorderSizeLeftRight() + 1, 3u);
+
+      // Split every level into bands of rows, so that the work is
+      // spread evenly across threads even though the levels differ
+      // in size.
+      struct Band {
+        unsigned int level;
+        unsigned int startRow;
+        unsigned int stopRow;
+      };
+      unsigned int const bandRows = 32;
+      std::vector<Band> bands;
+      for(unsigned int level = 0; level < numberOfLevels; ++level) {
+        Image<Format> const& currentLevel = pyramid.getLevel(level);
+        if(currentLevel.rows() <= 2 * marginRows
+           || currentLevel.columns() <= 2 * marginColumns) {
+          continue;
+        }
+        unsigned int const stopRow = currentLevel.rows() - marginRows;
+        for(unsigned int row = marginRows; row < stopRow; row += bandRows) {
+          Band band = {level, row, std::min(row + bandRows, stopRow)};
+          bands.push_back(band);
+        }
+      }
+
+      // Levels are accessed through references to the pyramid's own
+      // images, so pyramid itself is not touched by the threads.
+      std::vector< Image<Format> > levels;
+      for(unsigned int level = 0; level < numberOfLevels; ++level) {
+        levels.push_back(pyramid.getLevel(level));
+      }
+
+      std::vector< std::vector<brick::numeric::Index2D> > bandKeypoints(
+        bands.size());
+      brick::common::executeInParallel(
+        bands.size(),
+        [&](std::size_t bandIndex) {
+          Band const& band = bands[bandIndex];
+          Image<Format> const& currentLevel = levels[band.level];
+          std::size_t const stopColumn =
+            currentLevel.columns() - marginColumns;
+          std::vector<brick::common::UInt8> passFlags(currentLevel.columns());
+          for(unsigned int row = band.startRow; row < band.stopRow; ++row) {
+            privateCode::testLepetitRow<PixelType>(
+              currentLevel.rowBegin(row), currentLevel.getRowStep(),
+              marginColumns, stopColumn, similarityThreshold,
+              laplacianThreshold, &(passFlags[0]));
+            for(std::size_t column = marginColumns; column < stopColumn;
+                ++column) {
+              if(passFlags[column]) {
+                bandKeypoints[bandIndex].push_back(
+                  brick::numeric::Index2D(row, column));
+              }
             }
           }
+        },
+        m_numberOfThreads);
+
+      // Bands are in level-major, row-major order, so the keypoints
+      // come out in the same order as a serial scan would produce.
+      for(std::size_t bandIndex = 0; bandIndex < bands.size(); ++bandIndex) {
+        unsigned int const level = bands[bandIndex].level;
+        std::vector<brick::numeric::Index2D> const& localKeypoints =
+          bandKeypoints[bandIndex];
+        for(std::size_t ii = 0; ii < localKeypoints.size(); ++ii) {
+          m_locationVector.push_back(
+            pyramid.convertImageCoordinates(localKeypoints[ii], level, 0));
+          m_levelVector.push_back(level);
         }
       }
     }
 
 
+    template <ImageFormat Format>
     void
     KeypointSelectorLepetit::
-    estimateThresholds(Image<GRAY_FLOAT32> const& image,
+    estimateThresholds(Image<Format> const& image,
                        float& pixelSimilarityThreshold,
                        float& laplacianMagnitudeThreshold)
     {
@@ -178,10 +397,11 @@ namespace brick {
     }
 
 
+    template <ImageFormat Format>
     void
     KeypointSelectorLepetit::
     measurePixelThresholds(unsigned int row, unsigned int column,
-                           Image<GRAY_FLOAT32> const& image,
+                           Image<Format> const& image,
                            float& pixelSimilarity,
                            float& laplacianMagnitude)
     {
@@ -190,7 +410,7 @@ namespace brick {
       // Find the value of pixelSimilarity at which this
       // pixel makes the transition from failing to passing.  That is,
       // find the highest threshold at which this pixel still passes the
-      // test.  For more information, see member function testPixel().
+      // test.  For more information, see privateCode::testLepetitRow().
       float similarityValues[8];
       similarityValues[0] = std::max(
         common::absoluteValue(testValue - image(row, column - 3)),
@@ -241,87 +461,6 @@ namespace brick {
     }
 
 
-    bool
-    KeypointSelectorLepetit::
-    testPixel(unsigned int row, unsigned int column,
-              Image<GRAY_FLOAT32> const& image,
-              float pixelSimilarityThreshold,
-              float laplacianMagnitudeThreshold)
-    {
-      float testValue = image(row, column);
-
-      // Counting on short-circuit evaluation to save us time here.
-      // This giant if clause passes wnen the current pixel's gray
-      // level is "...close to those of any two diametrically opposed
-      // pixels on ... [the discretized circle surrounding the current
-      // pixel, and is] ... therefore unlikely to be stable ..."
-      //
-      // Following Rosten's FAST feature detector (ICCV '05), we use a
-      // Bresenham circle of radius 3 for the "discretized circle" of
-      // Lepetit's description.
-      if(((common::absoluteValue(testValue - image(row, column - 3))
-           < pixelSimilarityThreshold)
-          && (common::absoluteValue(testValue - image(row, column + 3))
-              < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row - 3, column))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row + 3, column))
-                 < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row + 2, column + 2))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row - 2, column - 2))
-                 < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row - 2, column + 2))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row + 2, column - 2))
-                 < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row + 1, column + 3))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row - 1, column - 3))
-                 < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row - 3, column + 1))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row + 3, column - 1))
-                 < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row + 3, column + 1))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row - 3, column - 1))
-                 < pixelSimilarityThreshold))
-         || ((common::absoluteValue(testValue - image(row - 1, column + 3))
-              < pixelSimilarityThreshold)
-             && (common::absoluteValue(testValue - image(row + 1, column -3))
-                 < pixelSimilarityThreshold))) {
-        // Unstable keypoint.  Discard it!
-        return false;
-      }
-
-      // Candidate keypoint passed the "likely to be stable" test.
-      // Now let's see if it's at a location with sufficiently high
-      // approximate LoG value.
-      float averageBorderValue = (
-        image(row - 3, column - 1) + image(row - 3, column)
-        + image(row - 3, column + 1)
-        + image(row - 2, column - 2) + image(row - 2, column + 2)
-        + image(row - 1, column - 3) + image(row - 1, column + 3)
-        + image(row, column - 3) + image(row, column + 3)
-        + image(row + 1, column - 3) + image(row + 1, column + 3)
-        + image(row + 2, column - 2) + image(row + 2, column + 2)
-        + image(row + 3, column - 1) + image(row + 3, column)
-        + image(row + 3, column + 1)) / 16.0;
-      float logApproximation = brick::common::absoluteValue(
-        testValue - averageBorderValue);
-      if(logApproximation <= laplacianMagnitudeThreshold) {
-        // Nope!  Laplacian of Gaussian approximation is too small.
-        // Discard this keypoint candidate.
-        return false;
-      }
-
-      // All tests passed!  Return true to indicate that a new
-      // keypoint should be added at (row, column).
-      return true;
-    }
-
-
     // ============== Private member functions below this line ==============
 
   } // namespace computerVision
@@ -0,0 +1,266 @@
+/**
+***************************************************************************
+* @file brick/computerVision/morphologyFilter.hh
+*
+* Header file declaring the MorphologyFilter class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_COMPUTERVISION_MORPHOLOGYFILTER_HH
+#define BRICK_COMPUTERVISION_MORPHOLOGYFILTER_HH
+
+#include <cstddef>
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/computerVision/image.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /**
+     ** This class implements grayscale and binary morphology using
+     ** rectangular structuring elements of arbitrary size.  Dilation
+     ** and erosion are computed as separable max and min filters,
+     ** with one pass along the columns and one along the rows, using
+     ** the algorithm of van Herk [1] and Gil and Werman [2].  The
+     ** cost per pixel is constant, regardless of window size, so a
+     ** 31x31 closing costs about the same as a 3x3 closing.
+     **
+     ** Pixels outside the image are ignored, so that, for example,
+     ** dilate() of a binary image is the same as the result of
+     ** dilateUsingBoxIntegrator().  Note that this differs from the
+     ** 3x3 erode() function, which sets border pixels to zero.
+     **
+     ** Both passes operate on whole rows at a time (the row pass
+     ** works on a transposed copy of the image), so the inner loops
+     ** are simple elementwise min/max operations over contiguous
+     ** memory that the compiler can vectorize.  For Image<GRAY1>,
+     ** rows are packed into 64-bit words before filtering, so each
+     ** operation handles 64 pixels at a time.
+     **
+     ** Intermediate buffers are kept between calls, so reusing a
+     ** MorphologyFilter instance avoids repeated allocation.  This
+     ** also means that a single instance should not be used from
+     ** more than one thread at a time.
+     **
+     ** Use this class as follows:
+     **
+     ** @code
+     **   MorphologyFilter<GRAY8> filter(31, 31);
+     **   Image<GRAY8> closedImage = filter.close(binaryImage);
+     ** @endcode
+     **
+     ** [1] M. van Herk, "A fast algorithm for local minimum and
+     ** maximum filters on rectangular and octagonal kernels,"
+     ** Pattern Recognition Letters 13(7), pp. 517-521, 1992.
+     **
+     ** [2] J. Gil and M. Werman, "Computing 2-D min, median, and max
+     ** filters," IEEE Transactions on Pattern Analysis and Machine
+     ** Intelligence 15(5), pp. 504-507, 1993.
+     **/
+    template <ImageFormat Format>
+    class MorphologyFilter {
+    public:
+
+      typedef typename ImageFormatTraits<Format>::PixelType PixelType;
+
+
+      /**
+       * Constructor.
+       *
+       * @param windowWidth This argument specifies the width of the
+       * structuring element, in pixels.  Even values are silently
+       * increased by one, so that the window is centered on each
+       * pixel.
+       *
+       * @param windowHeight This argument specifies the height of
+       * the structuring element, in pixels.  Even values are
+       * silently increased by one.
+       */
+      MorphologyFilter(std::size_t windowWidth = 3,
+                       std::size_t windowHeight = 3);
+
+
+      /**
+       * Destructor.
+       */
+      virtual
+      ~MorphologyFilter() {}
+
+
+      /**
+       * This member function computes the black top-hat (also known
+       * as bottom-hat) transform of an image, which is close(image)
+       * minus image.  It highlights dark features that are smaller
+       * than the structuring element.  For Image<GRAY1>, this is
+       * close(image) && !image.
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      bottomHat(Image<Format> const& inputImage);
+
+
+      /**
+       * This member function computes the morphological closing of
+       * an image, which is a dilation followed by an erosion.
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      close(Image<Format> const& inputImage);
+
+
+      /**
+       * This member function computes the dilation of an image, in
+       * which each output pixel is the maximum of the input pixels
+       * in the window centered on it.
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      dilate(Image<Format> const& inputImage);
+
+
+      /**
+       * This member function computes the erosion of an image, in
+       * which each output pixel is the minimum of the input pixels
+       * in the window centered on it.
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      erode(Image<Format> const& inputImage);
+
+
+      /**
+       * This member function returns the height of the structuring
+       * element.
+       *
+       * @return The return value is the window height, which is
+       * always odd.
+       */
+      std::size_t
+      getWindowHeight() const {return m_windowHeight;}
+
+
+      /**
+       * This member function returns the width of the structuring
+       * element.
+       *
+       * @return The return value is the window width, which is
+       * always odd.
+       */
+      std::size_t
+      getWindowWidth() const {return m_windowWidth;}
+
+
+      /**
+       * This member function computes the morphological gradient of
+       * an image, which is dilate(image) minus erode(image).  For
+       * Image<GRAY1>, this is dilate(image) && !erode(image).
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      gradient(Image<Format> const& inputImage);
+
+
+      /**
+       * This member function computes the morphological opening of
+       * an image, which is an erosion followed by a dilation.
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      open(Image<Format> const& inputImage);
+
+
+      /**
+       * This member function changes the size of the structuring
+       * element, overriding the constructor arguments.
+       *
+       * @param windowWidth This argument specifies the width of the
+       * structuring element, in pixels.  Even values are silently
+       * increased by one.
+       *
+       * @param windowHeight This argument specifies the height of
+       * the structuring element, in pixels.  Even values are
+       * silently increased by one.
+       */
+      void
+      setWindowSize(std::size_t windowWidth, std::size_t windowHeight);
+
+
+      /**
+       * This member function computes the white top-hat transform
+       * of an image, which is image minus open(image).  It
+       * highlights bright features that are smaller than the
+       * structuring element.  For Image<GRAY1>, this is image &&
+       * !open(image).
+       *
+       * @param inputImage This argument is the image to be filtered.
+       *
+       * @return The return value is the filtered image.
+       */
+      Image<Format>
+      topHat(Image<Format> const& inputImage);
+
+    private:
+
+      // Dilates (if isDilate is true) or erodes inputImage, putting
+      // the result in outputImage, which must already have the same
+      // shape as inputImage, and must not be the same image.
+      void
+      applyFilter(Image<Format> const& inputImage, Image<Format>& outputImage,
+                  bool isDilate);
+
+      std::size_t m_windowHeight;
+      std::size_t m_windowWidth;
+
+      // Scratch space for the composite operations.
+      Image<Format> m_intermediateImage;
+
+      // Scratch space for the row pass, which filters a transposed
+      // copy of the image.
+      brick::numeric::Array2D<PixelType> m_transposedImage;
+
+      // Running max/min buffers for the van Herk algorithm.
+      std::vector<PixelType> m_prefixBuffer;
+      std::vector<PixelType> m_suffixBuffer;
+
+      // Buffers used only by the bit-packed Image<GRAY1> code.
+      std::vector<brick::common::UInt64> m_packedImage;
+      std::vector<brick::common::UInt64> m_packedPrefixBuffer;
+      std::vector<brick::common::UInt64> m_packedSuffixBuffer;
+      std::vector<brick::common::UInt64> m_packedRowBuffer0;
+      std::vector<brick::common::UInt64> m_packedRowBuffer1;
+    };
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/computerVision/morphologyFilter_impl.hh>
+
+#endif /* #ifndef BRICK_COMPUTERVISION_MORPHOLOGYFILTER_HH */
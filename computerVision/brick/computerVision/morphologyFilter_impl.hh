@@ -0,0 +1,520 @@
+/**
+***************************************************************************
+* @file brick/computerVision/morphologyFilter_impl.hh
+*
+* Header file defining inline and template functions declared in
+* morphologyFilter.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_COMPUTERVISION_MORPHOLOGYFILTER_IMPL_HH
+#define BRICK_COMPUTERVISION_MORPHOLOGYFILTER_IMPL_HH
+
+// This file is included by morphologyFilter.hh, and should not be
+// directly included by user code, so no need to include
+// morphologyFilter.hh here.
+//
+// #include <brick/computerVision/morphologyFilter.hh>
+
+#include <algorithm>
+#include <brick/numeric/array2DView.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Functors for combining pixels in the van Herk passes.
+      template <class Type>
+      struct MorphologyMaxFunctor {
+        Type operator()(Type arg0, Type arg1) const {
+          return (arg0 < arg1) ? arg1 : arg0;
+        }
+      };
+
+
+      template <class Type>
+      struct MorphologyMinFunctor {
+        Type operator()(Type arg0, Type arg1) const {
+          return (arg1 < arg0) ? arg1 : arg0;
+        }
+      };
+
+
+      struct MorphologyOrFunctor {
+        brick::common::UInt64
+        operator()(brick::common::UInt64 arg0,
+                   brick::common::UInt64 arg1) const {
+          return arg0 | arg1;
+        }
+      };
+
+
+      // Computes the difference used by the top-hat and gradient
+      // operations.  The morphology guarantees that arg0 >= arg1,
+      // so unsigned pixel types don't underflow.
+      template <class Type>
+      inline Type
+      morphologyDifference(Type arg0, Type arg1)
+      {
+        return static_cast<Type>(arg0 - arg1);
+      }
+
+
+      inline bool
+      morphologyDifference(bool arg0, bool arg1)
+      {
+        return arg0 && !arg1;
+      }
+
+
+      // This function applies a 1D van Herk/Gil-Werman filter along
+      // the columns of a 2D array, so that output row r is
+      // functor() applied to input rows r - radius through
+      // r + radius (clipped to the array).  Rows are processed
+      // whole, so the inner loops are elementwise over contiguous
+      // memory.  Output may be the same array as input, provided
+      // inputRowStep == rowLength.
+      template <class Type, class Functor>
+      void
+      morphologyColumnPass(Type const* inputPtr, Type* outputPtr,
+                           std::size_t rows, std::size_t rowLength,
+                           std::size_t inputRowStep, std::size_t radius,
+                           std::vector<Type>& prefixBuffer,
+                           std::vector<Type>& suffixBuffer,
+                           Functor functor)
+      {
+        std::size_t const windowSize = 2 * radius + 1;
+        prefixBuffer.resize(rows * rowLength);
+        suffixBuffer.resize(rows * rowLength);
+        Type* const prefixPtr = &(prefixBuffer[0]);
+        Type* const suffixPtr = &(suffixBuffer[0]);
+
+        // Within each block of windowSize rows, prefix row r holds
+        // the running result from the start of the block through
+        // row r, and suffix row r holds the running result from row
+        // r through the end of the block.
+        for(std::size_t blockStart = 0; blockStart < rows;
+            blockStart += windowSize) {
+          std::size_t const blockStop =
+            std::min(blockStart + windowSize, rows);
+
+          Type const* inRow = inputPtr + blockStart * inputRowStep;
+          Type* prefixRow = prefixPtr + blockStart * rowLength;
+          std::copy(inRow, inRow + rowLength, prefixRow);
+          for(std::size_t row = blockStart + 1; row < blockStop; ++row) {
+            inRow += inputRowStep;
+            Type const* previousRow = prefixRow;
+            prefixRow += rowLength;
+            for(std::size_t ii = 0; ii < rowLength; ++ii) {
+              prefixRow[ii] = functor(previousRow[ii], inRow[ii]);
+            }
+          }
+
+          inRow = inputPtr + (blockStop - 1) * inputRowStep;
+          Type* suffixRow = suffixPtr + (blockStop - 1) * rowLength;
+          std::copy(inRow, inRow + rowLength, suffixRow);
+          for(std::size_t row = blockStop - 1; row > blockStart; --row) {
+            inRow -= inputRowStep;
+            Type const* nextRow = suffixRow;
+            suffixRow -= rowLength;
+            for(std::size_t ii = 0; ii < rowLength; ++ii) {
+              suffixRow[ii] = functor(nextRow[ii], inRow[ii]);
+            }
+          }
+        }
+
+        // A window of windowSize rows touches at most two blocks, so
+        // each output row combines one suffix row with one prefix
+        // row.  Windows clipped by the edge of the array can lie
+        // within a single block, in which case one of the two
+        // running results covers exactly the right rows.
+        for(std::size_t row = 0; row < rows; ++row) {
+          std::size_t const firstRow = (row >= radius) ? row - radius : 0;
+          std::size_t const lastRow = std::min(row + radius, rows - 1);
+          Type* outRow = outputPtr + row * rowLength;
+          Type const* suffixRow = suffixPtr + firstRow * rowLength;
+          Type const* prefixRow = prefixPtr + lastRow * rowLength;
+          if(firstRow / windowSize != lastRow / windowSize) {
+            for(std::size_t ii = 0; ii < rowLength; ++ii) {
+              outRow[ii] = functor(suffixRow[ii], prefixRow[ii]);
+            }
+          } else if(firstRow % windowSize == 0) {
+            std::copy(prefixRow, prefixRow + rowLength, outRow);
+          } else {
+            std::copy(suffixRow, suffixRow + rowLength, outRow);
+          }
+        }
+      }
+
+
+      // Sets column c of a bit-packed row to column (c + shift) of
+      // inputPtr, filling with zeros.
+      inline void
+      morphologyShiftLeft(brick::common::UInt64 const* inputPtr,
+                          brick::common::UInt64* outputPtr,
+                          std::size_t numberOfWords, std::size_t shift)
+      {
+        std::size_t const wordShift = shift / 64;
+        std::size_t const bitShift = shift % 64;
+        for(std::size_t ii = 0; ii < numberOfWords; ++ii) {
+          brick::common::UInt64 const lowWord =
+            (ii + wordShift < numberOfWords) ? inputPtr[ii + wordShift] : 0;
+          brick::common::UInt64 const highWord =
+            (ii + wordShift + 1 < numberOfWords)
+            ? inputPtr[ii + wordShift + 1] : 0;
+          outputPtr[ii] = ((bitShift == 0) ? lowWord
+                           : ((lowWord >> bitShift)
+                              | (highWord << (64 - bitShift))));
+        }
+      }
+
+
+      // Sets column c of a bit-packed row to column (c - shift) of
+      // inputPtr, filling with zeros.
+      inline void
+      morphologyShiftRight(brick::common::UInt64 const* inputPtr,
+                           brick::common::UInt64* outputPtr,
+                           std::size_t numberOfWords, std::size_t shift)
+      {
+        std::size_t const wordShift = shift / 64;
+        std::size_t const bitShift = shift % 64;
+        for(std::size_t ii = 0; ii < numberOfWords; ++ii) {
+          brick::common::UInt64 const highWord =
+            (ii >= wordShift) ? inputPtr[ii - wordShift] : 0;
+          brick::common::UInt64 const lowWord =
+            (ii >= wordShift + 1) ? inputPtr[ii - wordShift - 1] : 0;
+          outputPtr[ii] = ((bitShift == 0) ? highWord
+                           : ((highWord << bitShift)
+                              | (lowWord >> (64 - bitShift))));
+        }
+      }
+
+
+      // ORs each column c of a bit-packed row with the following
+      // (if isForward is true) or preceding length - 1 columns,
+      // using bufferPtr as scratch space.  Each step doubles (at
+      // most) the run covered, so this takes log2(length)
+      // operations per word.
+      inline void
+      morphologySpan(brick::common::UInt64* rowPtr,
+                     brick::common::UInt64* bufferPtr,
+                     std::size_t numberOfWords, std::size_t length,
+                     bool isForward)
+      {
+        std::size_t coveredLength = 1;
+        while(coveredLength < length) {
+          std::size_t const shift =
+            std::min(coveredLength, length - coveredLength);
+          if(isForward) {
+            morphologyShiftLeft(rowPtr, bufferPtr, numberOfWords, shift);
+          } else {
+            morphologyShiftRight(rowPtr, bufferPtr, numberOfWords, shift);
+          }
+          for(std::size_t ii = 0; ii < numberOfWords; ++ii) {
+            rowPtr[ii] |= bufferPtr[ii];
+          }
+          coveredLength += shift;
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+/* ============ Definitions of inline & template functions ============ */
+
+
+namespace brick {
+
+  namespace computerVision {
+
+    // Constructor.
+    template <ImageFormat Format>
+    MorphologyFilter<Format>::
+    MorphologyFilter(std::size_t windowWidth, std::size_t windowHeight)
+      : m_windowHeight(0),
+        m_windowWidth(0),
+        m_intermediateImage(),
+        m_transposedImage(),
+        m_prefixBuffer(),
+        m_suffixBuffer(),
+        m_packedImage(),
+        m_packedPrefixBuffer(),
+        m_packedSuffixBuffer(),
+        m_packedRowBuffer0(),
+        m_packedRowBuffer1()
+    {
+      this->setWindowSize(windowWidth, windowHeight);
+    }
+
+
+    // This member function computes the black top-hat transform.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    bottomHat(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage = this->close(inputImage);
+      for(std::size_t row = 0; row < inputImage.rows(); ++row) {
+        for(std::size_t column = 0; column < inputImage.columns();
+            ++column) {
+          outputImage(row, column) = privateCode::morphologyDifference(
+            outputImage(row, column), inputImage(row, column));
+        }
+      }
+      return outputImage;
+    }
+
+
+    // This member function computes the morphological closing.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    close(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage(inputImage.rows(), inputImage.columns());
+      m_intermediateImage.reinitIfNecessary(
+        inputImage.rows(), inputImage.columns());
+      this->applyFilter(inputImage, m_intermediateImage, true);
+      this->applyFilter(m_intermediateImage, outputImage, false);
+      return outputImage;
+    }
+
+
+    // This member function computes the dilation of an image.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    dilate(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage(inputImage.rows(), inputImage.columns());
+      this->applyFilter(inputImage, outputImage, true);
+      return outputImage;
+    }
+
+
+    // This member function computes the erosion of an image.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    erode(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage(inputImage.rows(), inputImage.columns());
+      this->applyFilter(inputImage, outputImage, false);
+      return outputImage;
+    }
+
+
+    // This member function computes the morphological gradient.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    gradient(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage(inputImage.rows(), inputImage.columns());
+      m_intermediateImage.reinitIfNecessary(
+        inputImage.rows(), inputImage.columns());
+      this->applyFilter(inputImage, outputImage, true);
+      this->applyFilter(inputImage, m_intermediateImage, false);
+      for(std::size_t ii = 0; ii < outputImage.size(); ++ii) {
+        outputImage[ii] = privateCode::morphologyDifference(
+          outputImage[ii], m_intermediateImage[ii]);
+      }
+      return outputImage;
+    }
+
+
+    // This member function computes the morphological opening.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    open(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage(inputImage.rows(), inputImage.columns());
+      m_intermediateImage.reinitIfNecessary(
+        inputImage.rows(), inputImage.columns());
+      this->applyFilter(inputImage, m_intermediateImage, false);
+      this->applyFilter(m_intermediateImage, outputImage, true);
+      return outputImage;
+    }
+
+
+    // This member function changes the size of the structuring
+    // element.
+    template <ImageFormat Format>
+    void
+    MorphologyFilter<Format>::
+    setWindowSize(std::size_t windowWidth, std::size_t windowHeight)
+    {
+      // The code assumes odd window sizes.  Silently arrange for
+      // that to be true, as dilateUsingBoxIntegrator() does.
+      m_windowWidth = (windowWidth % 2 == 0) ? windowWidth + 1 : windowWidth;
+      m_windowHeight =
+        (windowHeight % 2 == 0) ? windowHeight + 1 : windowHeight;
+    }
+
+
+    // This member function computes the white top-hat transform.
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilter<Format>::
+    topHat(Image<Format> const& inputImage)
+    {
+      Image<Format> outputImage = this->open(inputImage);
+      for(std::size_t row = 0; row < inputImage.rows(); ++row) {
+        for(std::size_t column = 0; column < inputImage.columns();
+            ++column) {
+          outputImage(row, column) = privateCode::morphologyDifference(
+            inputImage(row, column), outputImage(row, column));
+        }
+      }
+      return outputImage;
+    }
+
+
+    // This private member function does the real work of dilate()
+    // and erode() for non-binary images.  The column pass goes
+    // straight from inputImage to outputImage.  The row pass is done
+    // as a column pass on a transposed copy, so that both passes
+    // work on whole rows of contiguous memory.
+    template <ImageFormat Format>
+    void
+    MorphologyFilter<Format>::
+    applyFilter(Image<Format> const& inputImage, Image<Format>& outputImage,
+                bool isDilate)
+    {
+      std::size_t const rows = inputImage.rows();
+      std::size_t const columns = inputImage.columns();
+      if(rows == 0 || columns == 0) {
+        return;
+      }
+
+      if(isDilate) {
+        privateCode::morphologyColumnPass(
+          inputImage.data(), outputImage.data(), rows, columns,
+          inputImage.getRowStep(), m_windowHeight / 2,
+          m_prefixBuffer, m_suffixBuffer,
+          privateCode::MorphologyMaxFunctor<PixelType>());
+      } else {
+        privateCode::morphologyColumnPass(
+          inputImage.data(), outputImage.data(), rows, columns,
+          inputImage.getRowStep(), m_windowHeight / 2,
+          m_prefixBuffer, m_suffixBuffer,
+          privateCode::MorphologyMinFunctor<PixelType>());
+      }
+
+      m_transposedImage.reinitIfNecessary(columns, rows);
+      brick::numeric::Array2DView<PixelType const>(
+        outputImage).transpose().copyTo(m_transposedImage);
+
+      if(isDilate) {
+        privateCode::morphologyColumnPass(
+          m_transposedImage.data(), m_transposedImage.data(), columns, rows,
+          rows, m_windowWidth / 2, m_prefixBuffer, m_suffixBuffer,
+          privateCode::MorphologyMaxFunctor<PixelType>());
+      } else {
+        privateCode::morphologyColumnPass(
+          m_transposedImage.data(), m_transposedImage.data(), columns, rows,
+          rows, m_windowWidth / 2, m_prefixBuffer, m_suffixBuffer,
+          privateCode::MorphologyMinFunctor<PixelType>());
+      }
+
+      brick::numeric::Array2DView<PixelType const>(
+        m_transposedImage).transpose().copyTo(outputImage);
+    }
+
+
+    // Binary images are packed 64 pixels to a word.  Erosion is done
+    // as dilation of the complement, so only the OR operation is
+    // needed.  Since pixels outside the image are zero in the
+    // complement, they are ignored in the erosion, just as in the
+    // dilation.
+    template <>
+    inline void
+    MorphologyFilter<GRAY1>::
+    applyFilter(Image<GRAY1> const& inputImage, Image<GRAY1>& outputImage,
+                bool isDilate)
+    {
+      typedef brick::common::UInt64 WordType;
+
+      std::size_t const rows = inputImage.rows();
+      std::size_t const columns = inputImage.columns();
+      if(rows == 0 || columns == 0) {
+        return;
+      }
+
+      std::size_t const wordsPerRow = (columns + 63) / 64;
+      WordType const lastWordMask =
+        ((columns % 64 == 0) ? ~WordType(0)
+         : ((WordType(1) << (columns % 64)) - 1));
+      WordType const flipMask = isDilate ? WordType(0) : ~WordType(0);
+
+      m_packedImage.resize(rows * wordsPerRow);
+      m_packedRowBuffer0.resize(wordsPerRow);
+      m_packedRowBuffer1.resize(wordsPerRow);
+      WordType* const bufferPtr0 = &(m_packedRowBuffer0[0]);
+      WordType* const bufferPtr1 = &(m_packedRowBuffer1[0]);
+
+      // Pack each row, then do the row pass by ORing together a
+      // span looking forward and a span looking backward.  Zeros
+      // shifted in from outside the row take care of clipping the
+      // window at the edges of the image.
+      std::size_t const spanLength = m_windowWidth / 2 + 1;
+      for(std::size_t row = 0; row < rows; ++row) {
+        WordType* const packedRow = &(m_packedImage[row * wordsPerRow]);
+        for(std::size_t word = 0; word < wordsPerRow; ++word) {
+          std::size_t const column0 = word * 64;
+          std::size_t const numberOfBits = std::min(
+            static_cast<std::size_t>(64), columns - column0);
+          WordType packedWord = 0;
+          for(std::size_t bit = 0; bit < numberOfBits; ++bit) {
+            if(inputImage(row, column0 + bit)) {
+              packedWord |= (WordType(1) << bit);
+            }
+          }
+          packedRow[word] = packedWord ^ flipMask;
+        }
+        packedRow[wordsPerRow - 1] &= lastWordMask;
+
+        std::copy(packedRow, packedRow + wordsPerRow, bufferPtr0);
+        privateCode::morphologySpan(
+          packedRow, bufferPtr1, wordsPerRow, spanLength, true);
+        privateCode::morphologySpan(
+          bufferPtr0, bufferPtr1, wordsPerRow, spanLength, false);
+        for(std::size_t word = 0; word < wordsPerRow; ++word) {
+          packedRow[word] |= bufferPtr0[word];
+        }
+        packedRow[wordsPerRow - 1] &= lastWordMask;
+      }
+
+      privateCode::morphologyColumnPass(
+        &(m_packedImage[0]), &(m_packedImage[0]), rows, wordsPerRow,
+        wordsPerRow, m_windowHeight / 2,
+        m_packedPrefixBuffer, m_packedSuffixBuffer,
+        privateCode::MorphologyOrFunctor());
+
+      for(std::size_t row = 0; row < rows; ++row) {
+        WordType const* const packedRow = &(m_packedImage[row * wordsPerRow]);
+        for(std::size_t column = 0; column < columns; ++column) {
+          WordType const packedWord = packedRow[column / 64] ^ flipMask;
+          outputImage(row, column) = ((packedWord >> (column % 64)) & 1) != 0;
+        }
+      }
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMPUTERVISION_MORPHOLOGYFILTER_IMPL_HH */
@@ -15,6 +15,7 @@
 
 #include <vector>
 #include <brick/computerVision/image.hh>
+#include <brick/linearAlgebra/bandedLU.hh>
 #include <brick/numeric/vector2D.hh>
 
 namespace brick {
@@ -44,6 +45,10 @@ namespace brick {
       getBetaVector() {return m_betaVector;}
 
 
+      std::vector< brick::numeric::Vector2D<FloatType> >
+      getSnake() const {return m_snake;}
+
+
       bool
       isConverged() {return m_isConverged;}
 
@@ -143,6 +148,8 @@ namespace brick {
                   std::vector<FloatType>& betaVector);
 
 
+      // Returns the force balance matrix in the compact band form
+      // used by linearAlgebra::BandedLU.
       brick::numeric::Array2D<FloatType>
       buildForceBalanceMatrix(size_t numberOfSnakePoints);
 
@@ -173,7 +180,8 @@ namespace brick {
       FloatType m_cornerDeletionThreshold;
       brick::numeric::Array2D<FloatType> m_externalForceGradientX;
       brick::numeric::Array2D<FloatType> m_externalForceGradientY;
-      brick::numeric::Array2D<FloatType> m_forceBalanceMatrix;
+      brick::numeric::Array2D<FloatType> m_forceBalanceBands;
+      brick::linearAlgebra::BandedLU<FloatType> m_forceBalanceFactorization;
       FloatType m_gamma;
       bool m_isClosed;
       bool m_isConverged;
@@ -186,6 +194,27 @@ namespace brick {
       std::vector< brick::numeric::Vector2D<FloatType> > m_snake;
     };
 
+
+    /**
+     * This function calls run() on each of several snakes, spreading
+     * the work across threads.  To track many contours in the same
+     * image, configure one Snake (including setInterestImage()),
+     * copy it, and call setSeedPoints() on each copy.  The copies
+     * share external force arrays, rather than recomputing them.
+     *
+     * @param snakes This argument is the snakes to be run.  On
+     * return, call getSnake() on each to recover the result.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  Setting it to zero selects a
+     * sensible default.  If any snake throws, one of the exceptions
+     * is rethrown after all threads have finished.
+     */
+    template <class FloatType>
+    void
+    runSnakes(std::vector< Snake<FloatType> >& snakes,
+              std::size_t numberOfThreads = 0);
+
   } // namespace computerVision
 
 } // namespace brick
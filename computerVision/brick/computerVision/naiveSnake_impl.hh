@@ -19,6 +19,8 @@
 //
 // #include <brick/computerVision/naiveSnake.hh>
 
+#include <algorithm>
+#include <brick/common/parallel.hh>
 #include <brick/computerVision/getEuclideanDistance.hh>
 #include <brick/computerVision/naiveSnake.hh>
 #include <brick/computerVision/sobel.hh>
@@ -41,7 +43,8 @@ namespace brick {
         m_cornerDeletionThreshold(2.0),
         m_externalForceGradientX(),
         m_externalForceGradientY(),
-        m_forceBalanceMatrix(),
+        m_forceBalanceBands(),
+        m_forceBalanceFactorization(),
         m_gamma(1.0),
         m_isClosed(true),
         m_isConverged(false),
@@ -461,25 +464,26 @@ namespace brick {
       // = N - 2, etc.
       //
       // These equations, which we'll call the force balance equations,
-      // are reflected in AMatrix and the vectors returned by
-      // buildForceBalanceRHS().  We invert AMatrix because we want to
-      // solve for x_j, y_j.
+      // are reflected in the band matrix returned here and the
+      // vectors returned by buildForceBalanceRHS().  Each row has
+      // only five nonzero elements, at columns j-2 through j+2
+      // (wrapping around for closed snakes), so rather than
+      // inverting a dense NxN matrix, we return it in the compact
+      // band form used by linearAlgebra::BandedLU: column k of row j
+      // holds the coefficient of x_(j+k-2).
 
       // We use the single letter variable N because we'll be indexing
       // with it many times below.
       size_t N = numberOfSnakePoints;
-
-      // Argh!  It hurts to make (& invert) such a big matrix, knowing
-      // that it'll be mostly zeros.
-      brick::numeric::Array2D<FloatType> AMatrix(N, N);
-      AMatrix = 0.0;
+      brick::numeric::Array2D<FloatType> bands(N, 5);
+      bands = 0.0;
 
       // Handle the special case of a non-closed, fixed endpoints snake.
       size_t loopStartRow = 0;
       size_t loopStopRow = N;
       if((!m_isClosed) && m_isFixed) {
-        AMatrix(0, 0) = 1.0;
-        AMatrix(N - 1, N - 1) = 1.0;
+        bands(0, 2) = 1.0;
+        bands(N - 1, 2) = 1.0;
         loopStartRow = 1;
         loopStopRow = N - 1;
       }
@@ -490,9 +494,7 @@ namespace brick {
         // Sort out the indices.
         size_t currentJ = rowIndex;
         size_t previousJ = (rowIndex == 0) ? (N - 1) : (rowIndex - 1);
-        size_t prepreviousJ = (previousJ == 0) ? (N - 1) : (previousJ - 1);
         size_t nextJ = (rowIndex == N - 1) ? 0 : (rowIndex + 1);
-        size_t nextnextJ = (nextJ == N - 1) ? 0 : (nextJ + 1);
 
         // We allow different betas for each node so that some nodes
         // can be stiff and others can be corners.
@@ -501,19 +503,17 @@ namespace brick {
         FloatType nextBeta = m_betaVector[nextJ];
 
         // Assign matrix elements as described in the comments above.
-        AMatrix(currentJ, prepreviousJ) = 2.0 * previousBeta;
-        AMatrix(currentJ, previousJ) = (
+        bands(rowIndex, 0) = 2.0 * previousBeta;
+        bands(rowIndex, 1) = (
           -2.0 * m_alpha - 4.0 * currentBeta - 4.0 * previousBeta);
-        AMatrix(currentJ, currentJ) = (
+        bands(rowIndex, 2) = (
           4.0 * m_alpha + 8.0 * currentBeta + 2.0 * previousBeta
           + 2.0 * nextBeta + m_gamma);
-        AMatrix(currentJ, nextJ) = (
+        bands(rowIndex, 3) = (
           -2.0 * m_alpha - 4.0 * currentBeta - 4.0 * nextBeta);
-        AMatrix(currentJ, nextnextJ) = 2.0 * nextBeta;
+        bands(rowIndex, 4) = 2.0 * nextBeta;
       }
-
-      // Invert AMatrix and return.
-      return brick::linearAlgebra::inverse(AMatrix);
+      return bands;
     }
 
 
@@ -620,19 +620,71 @@ namespace brick {
     Snake<FloatType>::
     updateSnakePosition(std::vector< brick::numeric::Vector2D<FloatType> >& snake)
     {
-      if(snake.size() != m_forceBalanceMatrix.size()) {
-        m_forceBalanceMatrix = this->buildForceBalanceMatrix(snake.size());
-      }
-      brick::numeric::Array1D<FloatType> xRHS;
-      brick::numeric::Array1D<FloatType> yRHS;
-      this->buildForceBalanceRHS(snake, xRHS, yRHS);
-      brick::numeric::Array1D<FloatType> newX = brick::numeric::matrixMultiply<FloatType>(m_forceBalanceMatrix, xRHS);
-      brick::numeric::Array1D<FloatType> newY = brick::numeric::matrixMultiply<FloatType>(m_forceBalanceMatrix, yRHS);
-      for(size_t pointNum = 0; pointNum < snake.size(); ++pointNum) {
+      brick::numeric::Array2D<FloatType> bands =
+        this->buildForceBalanceMatrix(snake.size());
+      brick::numeric::Array1D<FloatType> newX;
+      brick::numeric::Array1D<FloatType> newY;
+      this->buildForceBalanceRHS(snake, newX, newY);
+
+      // The cyclic band solver needs at least five points, so that
+      // the wrapped-around diagonals don't land on top of each
+      // other.  runOneIteration() accepts four-point snakes, and
+      // resampling can leave us with even fewer, so for these tiny
+      // snakes we expand the bands into a dense matrix and solve
+      // that instead.  Where two band entries wrap around to the same
+      // column, their coefficients add.
+      size_t N = snake.size();
+      if(N < 5) {
+        brick::numeric::Array2D<FloatType> AMatrix(N, N);
+        AMatrix = 0.0;
+        for(size_t rowIndex = 0; rowIndex < N; ++rowIndex) {
+          for(size_t bandIndex = 0; bandIndex < 5; ++bandIndex) {
+            size_t columnIndex = (rowIndex + 2 * N + bandIndex - 2) % N;
+            AMatrix(rowIndex, columnIndex) += bands(rowIndex, bandIndex);
+          }
+        }
+        brick::numeric::Array2D<FloatType> AInverse =
+          brick::linearAlgebra::inverse(AMatrix);
+        newX = brick::numeric::matrixMultiply<FloatType>(AInverse, newX);
+        newY = brick::numeric::matrixMultiply<FloatType>(AInverse, newY);
+        for(size_t pointNum = 0; pointNum < N; ++pointNum) {
+          snake[pointNum].setValue(newX[pointNum], newY[pointNum]);
+        }
+        return;
+      }
+
+      // The force balance matrix changes only when the snake is
+      // resampled or its constants change, so we keep its
+      // factorization around between steps.  Rows 1 and N-2 of a
+      // non-closed snake still reach around to the fixed endpoints,
+      // so we always use the cyclic solver.
+      if(bands.size() != m_forceBalanceBands.size()
+         || !std::equal(bands.begin(), bands.end(),
+                        m_forceBalanceBands.begin())) {
+        m_forceBalanceFactorization.factor(bands, true);
+        m_forceBalanceBands = bands;
+      }
+      m_forceBalanceFactorization.solveInPlace(newX);
+      m_forceBalanceFactorization.solveInPlace(newY);
+      for(size_t pointNum = 0; pointNum < N; ++pointNum) {
         snake[pointNum].setValue(newX[pointNum], newY[pointNum]);
       }
     }
 
+
+    // This function calls run() on each of several snakes, spreading
+    // the work across threads.
+    template <class FloatType>
+    void
+    runSnakes(std::vector< Snake<FloatType> >& snakes,
+              std::size_t numberOfThreads)
+    {
+      brick::common::executeInParallel(
+        snakes.size(),
+        [&](std::size_t snakeIndex) {snakes[snakeIndex].run();},
+        numberOfThreads);
+    }
+
   } // namespace computerVision
 
 } // namespace brick
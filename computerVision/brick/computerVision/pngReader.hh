@@ -11,6 +11,7 @@
 */
 
 #ifndef BRICK_COMPUTERVISION_PNGREADER_HH
+#define BRICK_COMPUTERVISION_PNGREADER_HH
 
 #ifndef HAVE_LIBPNG
 #define HAVE_LIBPNG 1
@@ -18,6 +19,8 @@
 
 #if HAVE_LIBPNG
 
+#include <cstdio>
+#include <string>
 #include <png.h>
 
 #include <brick/computerVision/image.hh>
@@ -28,12 +31,30 @@ namespace brick {
 
     /**
      ** Wrapper class to make it easy to interact with libpng.
+     **
+     ** The constructor reads only the file header.  Pixels are
+     ** decoded row by row (using png_read_rows()) when getImage(),
+     ** readImage(), or readRows() is called, so there is never more
+     ** than one copy of the decoded image in memory.  When the
+     ** requested image format matches the native format of the
+     ** file, rows are decoded directly into the destination image.
+     **
+     ** Here's an example of how you might use this class to process
+     ** a large image in bands as it is decoded:
+     **
+     ** @code
+     **   PngReader reader(fileName);
+     **   auto callback = [&](Image<GRAY8> const& band, std::size_t row0) {
+     **     processBand(band, row0);
+     **   };
+     **   reader.readRows<GRAY8>(callback, 32);
+     ** @endcode
      **/
     class PngReader {
     public:
 
       /**
-       * The constructor opens a png image file and reads its contents.
+       * The constructor opens a png image file and reads its header.
        *
        * @param fileName This argument is the name of the file to be
        * opened.
@@ -48,9 +69,20 @@ namespace brick {
       ~PngReader();
 
 
+      /**
+       * Returns the width of the image.
+       *
+       * @return The return value is the number of columns in the
+       * image.
+       */
+      std::size_t
+      getColumns() const {return this->m_width;}
+
+
       /**
        * Returns the contents of the the image file in the requested
-       * image format.
+       * image format.  This member function may be called more than
+       * once, in which case the file is decoded again.
        *
        * @return The return value is an image reflecting the
        * contents of the .png file.
@@ -70,6 +102,15 @@ namespace brick {
       getNativeImageFormat();
 
 
+      /**
+       * Returns the height of the image.
+       *
+       * @return The return value is the number of rows in the image.
+       */
+      std::size_t
+      getRows() const {return this->m_height;}
+
+
       /**
        * Indicates whether the image data in the file is interlaced.
        *
@@ -79,18 +120,90 @@ namespace brick {
       bool
       isInterlaced();
 
+
+      /**
+       * Decodes the image into a caller-supplied image.  If
+       * outputImage already has the right shape, its memory is
+       * reused, even if it is a region of a larger image.  Otherwise
+       * it is reinitialized.  If Format is the same as the native
+       * format of the file, rows are decoded directly into
+       * outputImage without any intermediate copy.
+       *
+       * @param outputImage This argument is the image into which to
+       * decode.
+       */
+      template <ImageFormat Format>
+      void
+      readImage(Image<Format>& outputImage);
+
+
+      /**
+       * Decodes the image in horizontal bands, handing each band to
+       * a callback as soon as it is ready.  This lets processing
+       * overlap with decoding, and keeps only one band in memory.
+       * Interlaced files can't be decoded incrementally, so for
+       * them the whole image is decoded before the first callback.
+       *
+       * @param callback This argument is called as callback(band,
+       * firstRow) for each band, where band is a const
+       * Image<Format>& holding rows [firstRow, firstRow +
+       * band.rows()) of the image.  The band's memory is reused for
+       * the next call, so callback must copy anything it wants to
+       * keep.
+       *
+       * @param bandRows This argument specifies how many rows to
+       * decode between calls.  The last band may be shorter.
+       */
+      template <ImageFormat Format, class Functor>
+      void
+      readRows(Functor& callback, std::size_t bandRows = 16);
+
     private:
 
-      // Helper function for getImage().
+      // Releases libpng resources and closes the file.
+      void
+      closeFile();
+
+
+      // Opens the file, reads the header, and sets up the libpng
+      // transformations we need.
+      void
+      openFile();
+
+
+      // Decodes the next numberOfRows rows of the current pass into
+      // the memory pointed to by rowPointers.
+      void
+      readNativeRows(png_bytepp rowPointers, std::size_t numberOfRows);
+
+
+      // Makes sure that the next row decoded will be the first row
+      // of the first pass, reopening the file if necessary.
+      void
+      rewind();
+
+
+      // Helper for readImage() when Format is the native format.
       template <ImageFormat Format>
-      Image<Format>
-      convertImage();
+      void
+      readNativeImage(Image<Format>& outputImage);
+
+
+      // Helper for readRows() that is instantiated for the native
+      // format of the file.
+      template <ImageFormat NativeFormat, ImageFormat Format, class Functor>
+      void
+      readRowsFromNative(Functor& callback, std::size_t bandRows);
 
 
       // ---- Data members below this line ----
 
+      std::string m_fileName;
+      FILE* m_filePtr;
       png_structp m_pngPtr;
       png_infop m_infoPtr;
+      bool m_isRewound;
+      int m_numberOfPasses;
 
       png_uint_32 m_width;
       png_uint_32 m_height;
@@ -102,35 +215,14 @@ namespace brick {
 
     };
 
-
-    // Declare template specializations.
-    template <>
-    Image<GRAY8>
-    PngReader::
-    getImage<GRAY8>();
-
-
-    template <>
-    Image<GRAY16>
-    PngReader::
-    getImage<GRAY16>();
-
-
-    template <>
-    Image<RGB8>
-    PngReader::
-    getImage<RGB8>();
-
-
-    template <>
-    Image<RGB16>
-    PngReader::
-    getImage<RGB16>();
-
   } // namespace computerVision
 
 } // namespace brick
 
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/computerVision/pngReader_impl.hh>
+
 #endif /* #if HAVE_LIBPNG */
 
 #endif /* #ifndef BRICK_COMPUTERVISION_PNGREADER_HH */
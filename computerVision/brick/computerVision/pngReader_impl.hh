@@ -0,0 +1,215 @@
+/**
+***************************************************************************
+* @file brick/computerVision/pngReader_impl.hh
+*
+* Header file defining inline and template functions declared in
+* pngReader.hh.
+*
+* Copyright (C) 2014,2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_PNGREADER_IMPL_HH
+#define BRICK_COMPUTERVISION_PNGREADER_IMPL_HH
+
+// This file is included by pngReader.hh, and should not be directly
+// included by user code, so no need to include pngReader.hh here.
+//
+// #include <brick/computerVision/pngReader.hh>
+
+#include <algorithm>
+#include <vector>
+#include <brick/common/exception.hh>
+#include <brick/computerVision/utilities.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // When a band is already in the requested format, readRows()
+      // hands it to the callback directly.
+      template <ImageFormat Format>
+      inline Image<Format> const&
+      convertPngBand(Image<Format> const& band, Image<Format>& /* buffer */)
+      {
+        return band;
+      }
+
+
+      // Otherwise, it's converted into a reusable buffer.
+      template <ImageFormat Format, ImageFormat NativeFormat>
+      inline Image<Format> const&
+      convertPngBand(Image<NativeFormat> const& band, Image<Format>& buffer)
+      {
+        buffer.reinitIfNecessary(band.rows(), band.columns());
+        convertColorspace(band, buffer);
+        return buffer;
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // Returns the contents of the the image file in the requested
+    // image format.
+    template <ImageFormat Format>
+    Image<Format>
+    PngReader::
+    getImage()
+    {
+      Image<Format> result;
+      this->readImage(result);
+      return result;
+    }
+
+
+    // Decodes the image into a caller-supplied image.
+    template <ImageFormat Format>
+    void
+    PngReader::
+    readImage(Image<Format>& outputImage)
+    {
+      if(outputImage.rows() != this->m_height
+         || outputImage.columns() != this->m_width) {
+        outputImage.reinit(this->m_height, this->m_width);
+      }
+
+      std::size_t const pixelSize =
+        sizeof(typename Image<Format>::PixelType);
+      if(this->getNativeImageFormat() == Format
+         && pixelSize * this->m_width
+         == png_get_rowbytes(this->m_pngPtr, this->m_infoPtr)) {
+        this->readNativeImage(outputImage);
+        return;
+      }
+
+      auto copyBand = [&outputImage](Image<Format> const& band,
+                                     std::size_t firstRow) {
+        for(std::size_t row = 0; row < band.rows(); ++row) {
+          std::copy(band.rowBegin(row), band.rowEnd(row),
+                    outputImage.rowBegin(firstRow + row));
+        }
+      };
+      this->readRows<Format>(copyBand);
+    }
+
+
+    // Decodes the image in horizontal bands, handing each band to a
+    // callback.
+    template <ImageFormat Format, class Functor>
+    void
+    PngReader::
+    readRows(Functor& callback, std::size_t bandRows)
+    {
+      if(bandRows == 0) {
+        bandRows = 1;
+      }
+      switch(this->getNativeImageFormat()) {
+      case GRAY8:
+        this->readRowsFromNative<GRAY8, Format>(callback, bandRows);
+        break;
+      case GRAY16:
+        this->readRowsFromNative<GRAY16, Format>(callback, bandRows);
+        break;
+      case RGB8:
+        this->readRowsFromNative<RGB8, Format>(callback, bandRows);
+        break;
+      case RGB16:
+        this->readRowsFromNative<RGB16, Format>(callback, bandRows);
+        break;
+      default:
+        BRICK_THROW(brick::common::NotImplementedException,
+                    "PngReader::readRows()",
+                    "Unsupported image format.");
+        break;
+      }
+    }
+
+
+    // ---- Private members below this line. ----
+
+    // Helper for readImage() when Format is the native format.
+    // Rows are decoded straight into outputImage.  For interlaced
+    // files, each pass fills in more of the same rows.
+    template <ImageFormat Format>
+    void
+    PngReader::
+    readNativeImage(Image<Format>& outputImage)
+    {
+      this->rewind();
+      std::vector<png_bytep> rowPointers(this->m_height);
+      for(std::size_t row = 0; row < this->m_height; ++row) {
+        rowPointers[row] = reinterpret_cast<png_bytep>(
+          outputImage.rowBegin(row));
+      }
+      for(int pass = 0; pass < this->m_numberOfPasses; ++pass) {
+        this->readNativeRows(&(rowPointers[0]), this->m_height);
+      }
+    }
+
+
+    // Helper for readRows() that is instantiated for the native
+    // format of the file.
+    template <ImageFormat NativeFormat, ImageFormat Format, class Functor>
+    void
+    PngReader::
+    readRowsFromNative(Functor& callback, std::size_t bandRows)
+    {
+      typedef typename Image<NativeFormat>::PixelType NativePixelType;
+      if(sizeof(NativePixelType) * this->m_width
+         != png_get_rowbytes(this->m_pngPtr, this->m_infoPtr)) {
+        BRICK_THROW(brick::common::NotImplementedException,
+                    "PngReader::readRows()",
+                    "This function currently only works with compilers that "
+                    "don't add padding to the pixel memory layout.");
+      }
+
+      Image<Format> convertedBand;
+
+      // Interlaced images aren't complete until the last pass, so
+      // decode the whole thing before handing out bands.
+      if(this->m_numberOfPasses > 1) {
+        Image<NativeFormat> nativeImage(this->m_height, this->m_width);
+        this->readNativeImage(nativeImage);
+        for(std::size_t firstRow = 0; firstRow < this->m_height;
+            firstRow += bandRows) {
+          std::size_t const numberOfRows =
+            std::min(bandRows, this->m_height - firstRow);
+          Image<NativeFormat> band(numberOfRows, this->m_width,
+                                   nativeImage.rowBegin(firstRow));
+          callback(privateCode::convertPngBand(band, convertedBand),
+                   firstRow);
+        }
+        return;
+      }
+
+      this->rewind();
+      Image<NativeFormat> nativeBand(
+        std::min(bandRows, static_cast<std::size_t>(this->m_height)),
+        this->m_width);
+      std::vector<png_bytep> rowPointers(nativeBand.rows());
+      for(std::size_t row = 0; row < nativeBand.rows(); ++row) {
+        rowPointers[row] = reinterpret_cast<png_bytep>(
+          nativeBand.rowBegin(row));
+      }
+      for(std::size_t firstRow = 0; firstRow < this->m_height;
+          firstRow += bandRows) {
+        std::size_t const numberOfRows =
+          std::min(bandRows, this->m_height - firstRow);
+        this->readNativeRows(&(rowPointers[0]), numberOfRows);
+        Image<NativeFormat> band(numberOfRows, this->m_width,
+                                 nativeBand.data());
+        callback(privateCode::convertPngBand(band, convertedBand), firstRow);
+      }
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMPUTERVISION_PNGREADER_IMPL_HH */
@@ -0,0 +1,215 @@
+/**
+***************************************************************************
+* @file brick/computerVision/pngWriter.cc
+*
+* Source file defining a class for writing PNG files using libpng.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#include <sstream>
+#include <brick/common/byteOrder.hh>
+#include <brick/computerVision/pngWriter.hh>
+
+#if HAVE_LIBPNG
+
+namespace brick {
+
+  namespace computerVision {
+
+    // The constructor specifies how the file should be compressed.
+    PngWriter::
+    PngWriter(int compressionLevel, unsigned int filters)
+      : m_compressionLevel(6),
+        m_fileName(),
+        m_filePtr(0),
+        m_filters(BRICK_PNG_FILTER_ALL),
+        m_pngPtr(0),
+        m_infoPtr(0)
+    {
+      this->setCompressionLevel(compressionLevel);
+      this->setFilters(filters);
+    }
+
+
+    // Destructor.
+    PngWriter::
+    ~PngWriter()
+    {
+      this->closeFile();
+    }
+
+
+    // Sets the zlib compression level.
+    void
+    PngWriter::
+    setCompressionLevel(int compressionLevel)
+    {
+      if(compressionLevel < 0 || compressionLevel > 9) {
+        std::ostringstream message;
+        message << "Compression level must be in the range [0, 9], but got "
+                << compressionLevel << ".";
+        BRICK_THROW(brick::common::ValueException,
+                    "PngWriter::setCompressionLevel()",
+                    message.str().c_str());
+      }
+      this->m_compressionLevel = compressionLevel;
+    }
+
+
+    // Sets the filters that libpng may use.
+    void
+    PngWriter::
+    setFilters(unsigned int filters)
+    {
+      if(filters == 0
+         || (filters & ~static_cast<unsigned int>(BRICK_PNG_FILTER_ALL)) != 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "PngWriter::setFilters()",
+                    "Argument must be a nonzero combination of "
+                    "PngWriter::FilterFlag values.");
+      }
+      this->m_filters = filters;
+    }
+
+
+    // ---- Private members below this line. ----
+
+    // Releases libpng resources and closes the file.
+    void
+    PngWriter::
+    closeFile()
+    {
+      if(this->m_pngPtr != 0) {
+        png_destroy_write_struct(&(this->m_pngPtr), &(this->m_infoPtr));
+        this->m_pngPtr = 0;
+        this->m_infoPtr = 0;
+      }
+      if(this->m_filePtr != 0) {
+        fclose(this->m_filePtr);
+        this->m_filePtr = 0;
+      }
+    }
+
+
+    // Finishes writing the file, and closes it.
+    void
+    PngWriter::
+    finishFile()
+    {
+      if(setjmp(png_jmpbuf(this->m_pngPtr))) {
+        std::ostringstream message;
+        message << "Trouble writing to file: " << this->m_fileName;
+        BRICK_THROW(brick::common::IOException,
+                    "PngWriter::finishFile()",
+                    message.str().c_str());
+      }
+      png_write_end(this->m_pngPtr, this->m_infoPtr);
+
+      // Make sure buffered data actually made it to disk.
+      png_destroy_write_struct(&(this->m_pngPtr), &(this->m_infoPtr));
+      this->m_pngPtr = 0;
+      this->m_infoPtr = 0;
+      int const result = fclose(this->m_filePtr);
+      this->m_filePtr = 0;
+      if(result != 0) {
+        std::ostringstream message;
+        message << "Trouble closing file: " << this->m_fileName;
+        BRICK_THROW(brick::common::IOException,
+                    "PngWriter::finishFile()",
+                    message.str().c_str());
+      }
+    }
+
+
+    // Opens the file and writes the header.
+    void
+    PngWriter::
+    openFile(std::string const& fileName, std::size_t rows,
+             std::size_t columns, int bitDepth, int colorType)
+    {
+      this->closeFile();
+      this->m_fileName = fileName;
+      this->m_filePtr = fopen(fileName.c_str(), "wb");
+      if(this->m_filePtr == 0) {
+        std::ostringstream message;
+        message << "Couldn't open output file: " << fileName;
+        BRICK_THROW(brick::common::IOException,
+                    "PngWriter::openFile()",
+                    message.str().c_str());
+      }
+
+      // Be sure to clean up the open file and libpng structures.
+      try {
+        this->m_pngPtr = png_create_write_struct(
+          PNG_LIBPNG_VER_STRING, 0, 0, 0);
+        if(this->m_pngPtr == 0) {
+          BRICK_THROW(brick::common::RunTimeException,
+                      "PngWriter::openFile()",
+                      "Couldn't initialize png_structp.");
+        }
+
+        this->m_infoPtr = png_create_info_struct(this->m_pngPtr);
+        if(this->m_infoPtr == 0) {
+          BRICK_THROW(brick::common::RunTimeException,
+                      "PngWriter::openFile()",
+                      "Couldn't initialize png_infop.");
+        }
+
+        // Set error handling in case libpng calls longjmp().
+        if(setjmp(png_jmpbuf(this->m_pngPtr))) {
+          std::ostringstream message;
+          message << "Trouble writing to file: " << this->m_fileName;
+          BRICK_THROW(brick::common::IOException,
+                      "PngWriter::openFile()",
+                      message.str().c_str());
+        }
+
+        png_init_io(this->m_pngPtr, this->m_filePtr);
+        png_set_compression_level(this->m_pngPtr, this->m_compressionLevel);
+        png_set_filter(this->m_pngPtr, PNG_FILTER_TYPE_BASE,
+                       static_cast<int>(this->m_filters));
+        png_set_IHDR(this->m_pngPtr, this->m_infoPtr,
+                     static_cast<png_uint_32>(columns),
+                     static_cast<png_uint_32>(rows),
+                     bitDepth, colorType, PNG_INTERLACE_NONE,
+                     PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+        png_write_info(this->m_pngPtr, this->m_infoPtr);
+
+        // PNG files are natively big-endian.
+        if(bitDepth == 16
+           && (brick::common::getByteOrder()
+               == brick::common::BRICK_LITTLE_ENDIAN)) {
+          png_set_swap(this->m_pngPtr);
+        }
+      } catch(...) {
+        this->closeFile();
+        throw;
+      }
+    }
+
+
+    // Compresses and writes numberOfRows rows.
+    void
+    PngWriter::
+    writeNativeRows(png_bytepp rowPointers, std::size_t numberOfRows)
+    {
+      if(setjmp(png_jmpbuf(this->m_pngPtr))) {
+        std::ostringstream message;
+        message << "Trouble writing to file: " << this->m_fileName;
+        BRICK_THROW(brick::common::IOException,
+                    "PngWriter::writeNativeRows()",
+                    message.str().c_str());
+      }
+      png_write_rows(this->m_pngPtr, rowPointers,
+                     static_cast<png_uint_32>(numberOfRows));
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #if HAVE_LIBPNG */
@@ -0,0 +1,229 @@
+/**
+***************************************************************************
+* @file brick/computerVision/pngWriter.hh
+*
+* Header file declaring a class for writing PNG files using libpng.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_PNGWRITER_HH
+#define BRICK_COMPUTERVISION_PNGWRITER_HH
+
+#ifndef HAVE_LIBPNG
+#define HAVE_LIBPNG 1
+#endif
+
+#if HAVE_LIBPNG
+
+#include <cstdio>
+#include <string>
+#include <png.h>
+
+#include <brick/computerVision/image.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /**
+     ** Wrapper class to make it easy to write PNG files with libpng,
+     ** with control over the speed/size tradeoff.
+     **
+     ** Rows are handed to libpng straight from the image being
+     ** written, without an intermediate copy.  Alternatively,
+     ** writeRows() asks a callback to fill in one band of rows at a
+     ** time, so that images can be encoded as they are produced.
+     **
+     ** Before compressing each row, libpng applies one of five
+     ** prediction filters.  By default it tries all five and keeps
+     ** the one that looks most compressible.  Restricting the set
+     ** of filters (for example, to BRICK_PNG_FILTER_SUB) makes
+     ** encoding much faster, usually at some cost in file size.
+     ** Note that libpng 1.6 and later no longer implement weighted
+     ** filter heuristics, so the filter set is the only filter
+     ** selection control.
+     **
+     ** Currently supported formats are GRAY8, GRAY16, RGB8, and
+     ** RGB16.
+     **
+     ** @code
+     **   PngWriter writer(1, PngWriter::BRICK_PNG_FILTER_SUB);
+     **   writer.write(fileName, image);
+     ** @endcode
+     **/
+    class PngWriter {
+    public:
+
+      /**
+       ** These flags may be combined using bitwise-or to specify which
+       ** filters libpng should consider for each row.
+       **/
+      enum FilterFlag {
+        BRICK_PNG_FILTER_NONE = PNG_FILTER_NONE,
+        BRICK_PNG_FILTER_SUB = PNG_FILTER_SUB,
+        BRICK_PNG_FILTER_UP = PNG_FILTER_UP,
+        BRICK_PNG_FILTER_AVERAGE = PNG_FILTER_AVG,
+        BRICK_PNG_FILTER_PAETH = PNG_FILTER_PAETH,
+        BRICK_PNG_FILTER_ALL = PNG_ALL_FILTERS
+      };
+
+
+      /**
+       * The constructor specifies how the file should be compressed.
+       *
+       * @param compressionLevel This argument specifies the zlib
+       * compression level, from 0 (no compression, fastest) to 9
+       * (smallest files, slowest).
+       *
+       * @param filters This argument is a bitwise-or of FilterFlag
+       * values specifying which filters libpng may use.
+       */
+      PngWriter(int compressionLevel = 6,
+                unsigned int filters = BRICK_PNG_FILTER_ALL);
+
+
+      /**
+       * Destructor.
+       */
+      virtual
+      ~PngWriter();
+
+
+      /**
+       * Returns the zlib compression level.
+       *
+       * @return The return value is in the range [0, 9].
+       */
+      int
+      getCompressionLevel() const {return this->m_compressionLevel;}
+
+
+      /**
+       * Returns the set of filters libpng may use.
+       *
+       * @return The return value is a bitwise-or of FilterFlag
+       * values.
+       */
+      unsigned int
+      getFilters() const {return this->m_filters;}
+
+
+      /**
+       * Sets the zlib compression level.
+       *
+       * @param compressionLevel This argument specifies the
+       * compression level, from 0 to 9.  Values outside this range
+       * cause a ValueException.
+       */
+      void
+      setCompressionLevel(int compressionLevel);
+
+
+      /**
+       * Sets the filters that libpng may use.
+       *
+       * @param filters This argument is a nonzero bitwise-or of
+       * FilterFlag values.  Other values cause a ValueException.
+       */
+      void
+      setFilters(unsigned int filters);
+
+
+      /**
+       * Writes an image to a PNG file.
+       *
+       * @param fileName This argument is the name of the file to be
+       * written.
+       *
+       * @param outputImage This argument is the image to be written.
+       * It must not be empty.
+       */
+      template <ImageFormat Format>
+      void
+      write(std::string const& fileName, Image<Format> const& outputImage);
+
+
+      /**
+       * Writes a PNG file band by band, asking a callback to
+       * provide the pixels for each band just before it is
+       * compressed.
+       *
+       * @param fileName This argument is the name of the file to be
+       * written.
+       *
+       * @param rows This argument specifies the height of the image.
+       *
+       * @param columns This argument specifies the width of the
+       * image.
+       *
+       * @param callback This argument is called as callback(band,
+       * firstRow) for each band, where band is an Image<Format>&
+       * that must be filled with rows [firstRow, firstRow +
+       * band.rows()) of the image.
+       *
+       * @param bandRows This argument specifies how many rows to
+       * request at a time.  The last band may be shorter.
+       */
+      template <ImageFormat Format, class Functor>
+      void
+      writeRows(std::string const& fileName, std::size_t rows,
+                std::size_t columns, Functor& callback,
+                std::size_t bandRows = 16);
+
+    private:
+
+      // Checks that Format is supported, and returns the
+      // corresponding libpng bit depth and color type.
+      template <ImageFormat Format>
+      void
+      getPngFormat(std::size_t rows, std::size_t columns,
+                   int& bitDepth, int& colorType);
+
+
+      // Releases libpng resources and closes the file.
+      void
+      closeFile();
+
+
+      // Finishes writing the file, and closes it.
+      void
+      finishFile();
+
+
+      // Opens the file and writes the header.
+      void
+      openFile(std::string const& fileName, std::size_t rows,
+               std::size_t columns, int bitDepth, int colorType);
+
+
+      // Compresses and writes numberOfRows rows.
+      void
+      writeNativeRows(png_bytepp rowPointers, std::size_t numberOfRows);
+
+
+      // ---- Data members below this line ----
+
+      int m_compressionLevel;
+      std::string m_fileName;
+      FILE* m_filePtr;
+      unsigned int m_filters;
+      png_structp m_pngPtr;
+      png_infop m_infoPtr;
+
+    };
+
+  } // namespace computerVision
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/computerVision/pngWriter_impl.hh>
+
+#endif /* #if HAVE_LIBPNG */
+
+#endif /* #ifndef BRICK_COMPUTERVISION_PNGWRITER_HH */
@@ -0,0 +1,188 @@
+/**
+***************************************************************************
+* @file brick/computerVision/pngWriter_impl.hh
+*
+* Header file defining inline and template functions declared in
+* pngWriter.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_PNGWRITER_IMPL_HH
+#define BRICK_COMPUTERVISION_PNGWRITER_IMPL_HH
+
+// This file is included by pngWriter.hh, and should not be directly
+// included by user code, so no need to include pngWriter.hh here.
+//
+// #include <brick/computerVision/pngWriter.hh>
+
+#include <algorithm>
+#include <vector>
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // This traits class maps image formats to libpng's
+      // description of pixels.
+      template <ImageFormat Format>
+      struct PngFormatTraits {
+        static bool isSupported() {return false;}
+        static int getBitDepth() {return 0;}
+        static int getColorType() {return 0;}
+      };
+
+
+      template <>
+      struct PngFormatTraits<GRAY8> {
+        static bool isSupported() {return true;}
+        static int getBitDepth() {return 8;}
+        static int getColorType() {return PNG_COLOR_TYPE_GRAY;}
+      };
+
+
+      template <>
+      struct PngFormatTraits<GRAY16> {
+        static bool isSupported() {return true;}
+        static int getBitDepth() {return 16;}
+        static int getColorType() {return PNG_COLOR_TYPE_GRAY;}
+      };
+
+
+      template <>
+      struct PngFormatTraits<RGB8> {
+        static bool isSupported() {return true;}
+        static int getBitDepth() {return 8;}
+        static int getColorType() {return PNG_COLOR_TYPE_RGB;}
+      };
+
+
+      template <>
+      struct PngFormatTraits<RGB16> {
+        static bool isSupported() {return true;}
+        static int getBitDepth() {return 16;}
+        static int getColorType() {return PNG_COLOR_TYPE_RGB;}
+      };
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // Writes an image to a PNG file.  Rows are passed to libpng
+    // directly from outputImage.
+    template <ImageFormat Format>
+    void
+    PngWriter::
+    write(std::string const& fileName, Image<Format> const& outputImage)
+    {
+      int bitDepth;
+      int colorType;
+      this->getPngFormat<Format>(
+        outputImage.rows(), outputImage.columns(), bitDepth, colorType);
+
+      // libpng doesn't modify the rows it's given (byte swapping is
+      // done on its own copy), so casting away const is safe.
+      std::vector<png_bytep> rowPointers(outputImage.rows());
+      for(std::size_t row = 0; row < outputImage.rows(); ++row) {
+        rowPointers[row] = reinterpret_cast<png_bytep>(
+          const_cast<typename Image<Format>::PixelType*>(
+            outputImage.rowBegin(row)));
+      }
+
+      this->openFile(fileName, outputImage.rows(), outputImage.columns(),
+                     bitDepth, colorType);
+      try {
+        this->writeNativeRows(&(rowPointers[0]), outputImage.rows());
+        this->finishFile();
+      } catch(...) {
+        this->closeFile();
+        throw;
+      }
+    }
+
+
+    // Writes a PNG file band by band.
+    template <ImageFormat Format, class Functor>
+    void
+    PngWriter::
+    writeRows(std::string const& fileName, std::size_t rows,
+              std::size_t columns, Functor& callback, std::size_t bandRows)
+    {
+      int bitDepth;
+      int colorType;
+      this->getPngFormat<Format>(rows, columns, bitDepth, colorType);
+      if(bandRows == 0) {
+        bandRows = 1;
+      }
+
+      Image<Format> bandBuffer(std::min(bandRows, rows), columns);
+      std::vector<png_bytep> rowPointers(bandBuffer.rows());
+      for(std::size_t row = 0; row < bandBuffer.rows(); ++row) {
+        rowPointers[row] = reinterpret_cast<png_bytep>(
+          bandBuffer.rowBegin(row));
+      }
+
+      this->openFile(fileName, rows, columns, bitDepth, colorType);
+      try {
+        for(std::size_t firstRow = 0; firstRow < rows;
+            firstRow += bandRows) {
+          std::size_t const numberOfRows = std::min(bandRows, rows - firstRow);
+          Image<Format> band(numberOfRows, columns, bandBuffer.data());
+          callback(band, firstRow);
+          this->writeNativeRows(&(rowPointers[0]), numberOfRows);
+        }
+        this->finishFile();
+      } catch(...) {
+        this->closeFile();
+        throw;
+      }
+    }
+
+
+    // ---- Private members below this line. ----
+
+    // Checks that Format is supported, and returns the corresponding
+    // libpng bit depth and color type.
+    template <ImageFormat Format>
+    void
+    PngWriter::
+    getPngFormat(std::size_t rows, std::size_t columns,
+                 int& bitDepth, int& colorType)
+    {
+      typedef privateCode::PngFormatTraits<Format> Traits;
+      if(!Traits::isSupported()) {
+        BRICK_THROW(brick::common::NotImplementedException,
+                    "PngWriter::getPngFormat()",
+                    "Unsupported image format.");
+      }
+      bitDepth = Traits::getBitDepth();
+      colorType = Traits::getColorType();
+
+      std::size_t const numberOfChannels =
+        (colorType == PNG_COLOR_TYPE_RGB) ? 3 : 1;
+      if(sizeof(typename Image<Format>::PixelType)
+         != numberOfChannels * static_cast<std::size_t>(bitDepth / 8)) {
+        BRICK_THROW(brick::common::NotImplementedException,
+                    "PngWriter::getPngFormat()",
+                    "This function currently only works with compilers that "
+                    "don't add padding to the pixel memory layout.");
+      }
+      if(rows == 0 || columns == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "PngWriter::getPngFormat()",
+                    "PNG files can't hold empty images.");
+      }
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMPUTERVISION_PNGWRITER_IMPL_HH */
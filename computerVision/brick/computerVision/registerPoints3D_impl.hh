@@ -27,9 +27,10 @@
 #include <brick/numeric/array2D.hh>
 #include <brick/numeric/quaternion.hh>
 #include <brick/numeric/rotations.hh>
+#include <brick/numeric/staticArray2D.hh>
 #include <brick/numeric/utilities.hh>
 #include <brick/numeric/vector3D.hh>
-#include <brick/linearAlgebra/linearAlgebra.hh>
+#include <brick/linearAlgebra/staticLinearAlgebra.hh>
 
 namespace brick {
 
@@ -38,76 +39,68 @@ namespace brick {
     /// @cond privateCode
     namespace privateCode {
 
-      // Private routine to generate the element selection array
-      // proposed in Horn's paper.
+      // Private routine to add the outer product of two vectors to a
+      // 3x3 matrix.
       template <class FloatType>
-      inline const Array2D<FloatType>&
-      getHornNCoefficientMatrix()
+      inline void
+      accumulateOuterProduct(brick::numeric::StaticArray2D<FloatType, 3, 3>& sum,
+                             Vector3D<FloatType> const& vector0,
+                             Vector3D<FloatType> const& vector1)
       {
-        static Array2D<FloatType> NCoefficients(
-          "[[1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0], "
-          " [0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, -1.0, 0.0], "
-          " [0.0, 0.0, -1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0], "
-          " [0.0, 1.0, 0.0, -1.0, 0.0, 0.0, 0.0, 0.0, 0.0], "
-          " [0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, -1.0, 0.0], "
-          " [1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 0.0, -1.0], "
-          " [0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0], "
-          " [0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0], "
-          " [0.0, 0.0, -1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0], "
-          " [0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0], "
-          " [-1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, -1.0], "
-          " [0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0], "
-          " [0.0, 1.0, 0.0, -1.0, 0.0, 0.0, 0.0, 0.0, 0.0], "
-          " [0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0], "
-          " [0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0], "
-          " [-1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 0.0, 1.0]]");
-        return NCoefficients;
+        FloatType const v1[3] = {vector1.x(), vector1.y(), vector1.z()};
+        FloatType const v0[3] = {vector0.x(), vector0.y(), vector0.z()};
+        for(size_t rr = 0; rr < 3; ++rr) {
+          FloatType* sumRow = sum.rowBegin(rr);
+          for(size_t cc = 0; cc < 3; ++cc) {
+            sumRow[cc] += v0[rr] * v1[cc];
+          }
+        }
       }
 
 
       // Private routine containing code that is common to all flavors
-      // of estimateTransform3D().
+      // of estimateTransform3D().  Argument matrixM is the (not
+      // quite) covariance matrix between the two zero-mean point
+      // clouds, sum(fromPoint_i * transpose(toPoint_i)).
       template <class FloatType>
       brick::numeric::Transform3D<FloatType>
-      estimateTransformFromZeroMeanPointArrays(
-        Array2D<FloatType> const& translatedFromPoints,
-        Array2D<FloatType> const& translatedToPoints,
+      estimateTransformFromCrossCovariance(
+        brick::numeric::StaticArray2D<FloatType, 3, 3> const& matrixM,
         Vector3D<FloatType> const& fromMean,
         Vector3D<FloatType> const& toMean)
       {
-        // Compute the (not quite) covariance matrix between the two point
-        // clouds.  This is a  3x3 matrix.
-        Array2D<FloatType> matrixM = matrixMultiply<FloatType>(
-          translatedFromPoints.transpose(), translatedToPoints);
-
-        // Select elements as describe by Horn.  The member function
-        // ravel() simply returns a flattened (1D) array referencing the
-        // elements of the Array2D instance in row-major order.
-        Array1D<FloatType> vectorN = matrixMultiply<FloatType>(
-          privateCode::getHornNCoefficientMatrix<FloatType>(), matrixM.ravel());
-        Array2D<FloatType> matrixN(
-          4, 4, vectorN.data(), vectorN.getReferenceCount());
+        // Select elements as describe by Horn to build the symmetric
+        // 4x4 matrix N.  Only the upper triangle is examined by the
+        // eigensolver.
+        FloatType const sxx = matrixM(0, 0);
+        FloatType const sxy = matrixM(0, 1);
+        FloatType const sxz = matrixM(0, 2);
+        FloatType const syx = matrixM(1, 0);
+        FloatType const syy = matrixM(1, 1);
+        FloatType const syz = matrixM(1, 2);
+        FloatType const szx = matrixM(2, 0);
+        FloatType const szy = matrixM(2, 1);
+        FloatType const szz = matrixM(2, 2);
+        brick::numeric::StaticArray2D<FloatType, 4, 4> matrixN;
+        matrixN(0, 0) = sxx + syy + szz;
+        matrixN(0, 1) = syz - szy;
+        matrixN(0, 2) = szx - sxz;
+        matrixN(0, 3) = sxy - syx;
+        matrixN(1, 1) = sxx - syy - szz;
+        matrixN(1, 2) = sxy + syx;
+        matrixN(1, 3) = szx + sxz;
+        matrixN(2, 2) = -sxx + syy - szz;
+        matrixN(2, 3) = syz + szy;
+        matrixN(3, 3) = -sxx - syy + szz;
 
         // Find the largest eigenvector of matrixN.  This is a unit
-        // quaternion describing the best fit rotation.
-        Array1D<brick::common::Float64> eValues;
-        Array2D<brick::common::Float64> eVectors;
-
-        // // Note(xxx): Need to implement more versions of
-        // // eigenvectorsSymmetric()!
-        //
-        // Array2D<Float64> tempArray(matrixN.rows(), matrixN.columns());
-        // tempArray.copy(matrixN);
-        // eigenvectorsSymmetric(matrixN, eValues, eVectors);
+        // quaternion describing the best fit rotation.  Eigenvalues
+        // are sorted in descending order, so it's the first column.
+        brick::numeric::StaticArray1D<FloatType, 4> eValues;
+        brick::numeric::StaticArray2D<FloatType, 4, 4> eVectors;
         brick::linearAlgebra::eigenvectorsSymmetric(matrixN, eValues, eVectors);
-
-        // The function argmax returns the index of the largest element of
-        // eValues.
-        size_t index0 = argmax(eValues);
-        Quaternion<FloatType> q0(static_cast<FloatType>(eVectors(0, index0)),
-                                 static_cast<FloatType>(eVectors(1, index0)),
-                                 static_cast<FloatType>(eVectors(2, index0)),
-                                 static_cast<FloatType>(eVectors(3, index0)));
+        Quaternion<FloatType> q0(eVectors(0, 0), eVectors(1, 0),
+                                 eVectors(2, 0), eVectors(3, 0));
 
         // Convert the unit quaternion to a rotation matrix.
         brick::numeric::Transform3D<FloatType> xf = quaternionToTransform3D(q0);
@@ -165,38 +158,20 @@ namespace brick {
       fromMean /= static_cast<FloatType>(count);
       toMean /= static_cast<FloatType>(count);
 
-      // Now translate each point cloud so that its center of mass is at
-      // the origin.  We'll use these translated point clouds to compute
-      // the best fit rotation.  We use Nx3 arrays to represent these
-      // translated ponits so that we'll be able to conveniently do
-      // linear algebra later.
+      // Now translate each point cloud so that its center of mass is
+      // at the origin, and accumulate the (not quite) covariance
+      // matrix between the two point clouds.  This is a 3x3 matrix,
+      // so there's no need to store the translated points.
       fromIter = fromPointsBegin;
       toIter = toPointsBegin;
       flagsIter = flagsBegin;
-      Array2D<FloatType> translatedFromPoints(count, 3);
-      Array2D<FloatType> translatedToPoints(count, 3);
-      size_t arrayIndex = 0;
+      brick::numeric::StaticArray2D<FloatType, 3, 3> matrixM(
+        static_cast<FloatType>(0.0));
       while(fromIter != fromPointsEnd) {
         if(*flagsIter) {
-          Vector3D<FloatType>& fromPoint = *fromIter;
-          Vector3D<FloatType>& toPoint = *toIter;
-
-          // Copy the first element in the current row.
-          translatedFromPoints[arrayIndex] = fromPoint.x() - fromMean.x();
-          translatedToPoints[arrayIndex] = toPoint.x() - toMean.x();
-
-          // Advance to next element in the current row.
-          ++arrayIndex;
-          translatedFromPoints[arrayIndex] = fromPoint.y() - fromMean.y();
-          translatedToPoints[arrayIndex] = toPoint.y() - toMean.y();
-
-          // Advance to next element in the current row.
-          ++arrayIndex;
-          translatedFromPoints[arrayIndex] = fromPoint.z() - fromMean.z();
-          translatedToPoints[arrayIndex] = toPoint.z() - toMean.z();
-
-          // Wrap around to next row.
-          ++arrayIndex;
+          Vector3D<FloatType> fromPoint = *fromIter - fromMean;
+          Vector3D<FloatType> toPoint = *toIter - toMean;
+          privateCode::accumulateOuterProduct(matrixM, fromPoint, toPoint);
         }
         // Advance to next point.
         ++fromIter;
@@ -204,10 +179,10 @@ namespace brick {
         ++flagsIter;
       }
 
-      // Now that the input matrices are constructed, dispatch to a
+      // Now that the covariance is computed, dispatch to a
       // subroutine for the actual transform estimation.
-      return privateCode::estimateTransformFromZeroMeanPointArrays(
-        translatedFromPoints, translatedToPoints, fromMean, toMean);
+      return privateCode::estimateTransformFromCrossCovariance(
+        matrixM, fromMean, toMean);
     }
 
 
@@ -243,48 +218,25 @@ namespace brick {
       fromMean /= totalWeight;
       toMean /= totalWeight;
 
-      // Now translate each point cloud so that its center of mass is at
-      // the origin.  We'll use these translated point clouds to compute
-      // the best fit rotation.  We use Nx3 arrays to represent these
-      // translated ponits so that we'll be able to conveniently do
-      // linear algebra later.
+      // Now translate each point cloud so that its center of mass is
+      // at the origin, and accumulate the weighted (not quite)
+      // covariance matrix between the two point clouds.  We know
+      // that the thing we care about is the sum of outer products of
+      // from and to points.  This means that, after subtracting out
+      // the mean, we can multiply fromPoint and toPoint by the
+      // square root of the weight.  Equivalently, we can multiply
+      // only one of fromPoint and toPoint by weight, and achieve the
+      // same effect without doing a sqrt operation.
       fromIter = fromPointsBegin;
       toIter = toPointsBegin;
       weightsIter = weightsBegin;
-      Array2D<FloatType> translatedFromPoints(count, 3);
-      Array2D<FloatType> translatedToPoints(count, 3);
-      size_t arrayIndex = 0;
+      brick::numeric::StaticArray2D<FloatType, 3, 3> matrixM(
+        static_cast<FloatType>(0.0));
       while(fromIter != fromPointsEnd) {
         FloatType weight = *weightsIter;
-        Vector3D<FloatType> const& fromPoint = *fromIter;
-        Vector3D<FloatType> const& toPoint = *toIter;
-
-        // Copy the first element in the current row.  We know that,
-        // later on, the thing we care about is the matrix product of
-        // translatedFromPoints.transpose() and translatedToPoints.
-        // This means that, after subtracting out the mean, we can
-        // multiply fromPoint and toPoint by the square root of the
-        // weight.  Equivalently, we can multiply only one of
-        // fromPoint and toPoint by weight, and achieve the same
-        // effect without doing a sqrt operation.
-        translatedFromPoints[arrayIndex] =
-          weight * (fromPoint.x() - fromMean.x());
-        translatedToPoints[arrayIndex] = toPoint.x() - toMean.x();
-
-        // Advance to next element in the current row.
-        ++arrayIndex;
-        translatedFromPoints[arrayIndex] =
-          weight * (fromPoint.y() - fromMean.y());
-        translatedToPoints[arrayIndex] = toPoint.y() - toMean.y();
-
-        // Advance to next element in the current row.
-        ++arrayIndex;
-        translatedFromPoints[arrayIndex] =
-          weight * (fromPoint.z() - fromMean.z());
-        translatedToPoints[arrayIndex] = toPoint.z() - toMean.z();
-
-        // Wrap around to next row.
-        ++arrayIndex;
+        Vector3D<FloatType> fromPoint = weight * (*fromIter - fromMean);
+        Vector3D<FloatType> toPoint = *toIter - toMean;
+        privateCode::accumulateOuterProduct(matrixM, fromPoint, toPoint);
 
         // Advance to next point.
         ++fromIter;
@@ -292,10 +244,10 @@ namespace brick {
         ++weightsIter;
       }
 
-      // Now that the input matrices are constructed, dispatch to a
+      // Now that the covariance is computed, dispatch to a
       // subroutine for the actual transform estimation.
-      return privateCode::estimateTransformFromZeroMeanPointArrays(
-        translatedFromPoints, translatedToPoints, fromMean, toMean);
+      return privateCode::estimateTransformFromCrossCovariance(
+        matrixM, fromMean, toMean);
     }
 
 
@@ -0,0 +1,280 @@
+/**
+***************************************************************************
+* @file brick/computerVision/staticExtendedKalmanFilter.hh
+*
+* Header file declaring a fixed-size, square-root Extended Kalman
+* Filter implementation.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_STATICEXTENDEDKALMANFILTER_HH
+#define BRICK_COMPUTERVISION_STATICEXTENDEDKALMANFILTER_HH
+
+#include <brick/numeric/staticArray1D.hh>
+#include <brick/numeric/staticArray2D.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+
+    /**
+     ** This class template implements an Extended Kalman Filter whose
+     ** state dimension is fixed at compile time.  All storage lives
+     ** in StaticArray1D and StaticArray2D instances, so prediction and
+     ** measurement updates never touch the heap.  This makes it
+     ** suitable for high-rate applications such as IMU fusion, where
+     ** ExtendedKalmanFilter spends much of its time allocating
+     ** Jacobians and intermediate matrices.
+     **
+     ** Rather than the state covariance P itself, the filter stores a
+     ** square root S such that P = S * S^T.  Prediction
+     ** re-triangularizes S using Householder reflections, and
+     ** measurements are folded in one scalar at a time using Potter's
+     ** square-root update.  Vector measurements with correlated noise
+     ** are first whitened using the Cholesky factor of the measurement
+     ** noise covariance.  No matrices are inverted, and the implied
+     ** covariance stays symmetric and positive semidefinite regardless
+     ** of roundoff.
+     **
+     ** Unlike ExtendedKalmanFilter, this class does not call virtual
+     ** process and measurement models.  Instead, the calling context
+     ** evaluates its models and passes the results in directly.
+     ** Here's an example of how it might be used:
+     **
+     ** @code
+     **   StaticExtendedKalmanFilter<double, 15> filter(
+     **     initialState, initialCovariance);
+     **   while(running) {
+     **     // Predict using the IMU model.
+     **     StaticArray1D<double, 15> predictedState =
+     **       applyImuModel(filter.getState(), imuSample, dt);
+     **     StaticArray2D<double, 15, 15> F = getImuJacobian(...);
+     **     filter.doPredictionStep(predictedState, F, processNoiseVariances);
+     **
+     **     // Fold in a 3D position fix.
+     **     StaticArray1D<double, 3> innovation =
+     **       gpsPosition - getPosition(filter.getState());
+     **     filter.doMeasurementUpdate(innovation, H, gpsCovariance);
+     **   }
+     ** @endcode
+     **/
+    template <class FloatType, size_t StateSize>
+    class StaticExtendedKalmanFilter {
+    public:
+
+      /* ======== Public typedefs ======== */
+
+      typedef brick::numeric::StaticArray1D<FloatType, StateSize> StateVector;
+      typedef brick::numeric::StaticArray2D<FloatType, StateSize, StateSize>
+        StateMatrix;
+
+
+      /**
+       * The default constructor initializes the state to zero, with
+       * zero covariance.  You'll almost certainly want to call
+       * setStateEstimate() before using the filter.
+       */
+      StaticExtendedKalmanFilter();
+
+
+      /**
+       * This constructor sets the initial state and covariance.
+       *
+       * @param state This argument specifies the initial state estimate.
+       *
+       * @param covariance This argument specifies the covariance of
+       * the initial state estimate.  It must be symmetric and
+       * positive semidefinite.
+       */
+      StaticExtendedKalmanFilter(StateVector const& state,
+                                 StateMatrix const& covariance);
+
+
+      /**
+       * This member function propagates the state estimate forward
+       * in time.  The caller evaluates the (possibly nonlinear)
+       * process model and its Jacobians at the current state, and
+       * passes the results in.  The covariance is updated as
+       *
+       *   P = F * P * F^T + G * Q * G^T
+       *
+       * but computed in square-root form.
+       *
+       * @param predictedState This argument is the result of applying
+       * the process model to the current state, as returned by
+       * getState().
+       *
+       * @param stateJacobian This argument is the Jacobian, F, of the
+       * process model with respect to state.
+       *
+       * @param noiseJacobian This argument is the Jacobian, G, of the
+       * process model with respect to the process noise.
+       *
+       * @param processNoiseCovariance This argument is the
+       * covariance, Q, of the process noise.  It must be symmetric
+       * and positive semidefinite.
+       */
+      template <size_t NoiseSize>
+      void
+      doPredictionStep(
+        StateVector const& predictedState,
+        StateMatrix const& stateJacobian,
+        brick::numeric::StaticArray2D<FloatType, StateSize, NoiseSize> const&
+          noiseJacobian,
+        brick::numeric::StaticArray2D<FloatType, NoiseSize, NoiseSize> const&
+          processNoiseCovariance);
+
+
+      /**
+       * This member function is just like the four-argument version
+       * of doPredictionStep(), except that the process noise is
+       * assumed to be additive and uncorrelated, so that G is the
+       * identity and Q is diagonal.  This is the common case, and is
+       * cheaper to compute.
+       *
+       * @param predictedState This argument is the result of applying
+       * the process model to the current state.
+       *
+       * @param stateJacobian This argument is the Jacobian, F, of the
+       * process model with respect to state.
+       *
+       * @param processNoiseVariances This argument holds the diagonal
+       * elements of Q.  Zero elements are permitted.
+       */
+      void
+      doPredictionStep(StateVector const& predictedState,
+                       StateMatrix const& stateJacobian,
+                       StateVector const& processNoiseVariances);
+
+
+      /**
+       * This member function updates the state estimate to reflect a
+       * vector measurement.  The measurement is whitened using the
+       * Cholesky factor of measurementNoiseCovariance, and then
+       * folded in one element at a time.  The result is identical (up
+       * to roundoff) to the textbook update using the Kalman gain
+       * P * H^T * (H * P * H^T + R)^(-1), but involves no matrix
+       * inversion.
+       *
+       * @param innovation This argument is the difference between the
+       * actual measurement and the measurement predicted from the
+       * current state.
+       *
+       * @param measurementJacobian This argument is the Jacobian, H,
+       * of the measurement model with respect to state, evaluated at
+       * the current state.
+       *
+       * @param measurementNoiseCovariance This argument is the
+       * covariance, R, of the measurement noise.  It must be
+       * symmetric and positive definite.
+       */
+      template <size_t MeasurementSize>
+      void
+      doMeasurementUpdate(
+        brick::numeric::StaticArray1D<FloatType, MeasurementSize> const&
+          innovation,
+        brick::numeric::StaticArray2D<FloatType, MeasurementSize, StateSize>
+          const& measurementJacobian,
+        brick::numeric::StaticArray2D<FloatType, MeasurementSize,
+                                      MeasurementSize> const&
+          measurementNoiseCovariance);
+
+
+      /**
+       * This member function updates the state estimate to reflect a
+       * single scalar measurement.  When measurement noise is
+       * uncorrelated, calling this once for each element of a vector
+       * measurement is the cheapest way to do the update.
+       *
+       * @param innovation This argument is the difference between the
+       * actual measurement and the measurement predicted from the
+       * current state.
+       *
+       * @param measurementJacobian This argument is the gradient of
+       * the measurement model with respect to state (one row of H).
+       *
+       * @param measurementVariance This argument is the variance of
+       * the measurement noise.  It must be positive.
+       */
+      void
+      doScalarMeasurementUpdate(FloatType innovation,
+                                StateVector const& measurementJacobian,
+                                FloatType measurementVariance);
+
+
+      /**
+       * This member function returns the covariance of the current
+       * state estimate, computed from its square root.
+       *
+       * @return The return value is S * S^T.
+       */
+      StateMatrix
+      getCovariance() const;
+
+
+      /**
+       * This member function returns the square root of the
+       * covariance of the current state estimate.  It is not
+       * necessarily triangular.
+       *
+       * @return The return value is S, where P = S * S^T.
+       */
+      StateMatrix const&
+      getCovarianceSquareRoot() const {return m_covarianceSquareRoot;}
+
+
+      /**
+       * This member function returns the current state estimate.
+       *
+       * @return The return value is the state estimate.
+       */
+      StateVector const&
+      getState() const {return m_state;}
+
+
+      /**
+       * This member function sets the state estimate and its
+       * covariance.
+       *
+       * @param state This argument specifies the state estimate.
+       *
+       * @param covariance This argument specifies the covariance
+       * associated with the state estimate.  It must be symmetric and
+       * positive semidefinite.
+       */
+      void
+      setStateEstimate(StateVector const& state,
+                       StateMatrix const& covariance);
+
+
+      /**
+       * This member function lets the caller correct the state
+       * estimate without changing its covariance, for example to
+       * renormalize a quaternion after an update.
+       *
+       * @param state This argument specifies the new state estimate.
+       */
+      void
+      setState(StateVector const& state) {m_state = state;}
+
+    private:
+
+      StateMatrix m_covarianceSquareRoot;
+      StateVector m_state;
+    };
+
+
+  } // namespace computerVision
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/computerVision/staticExtendedKalmanFilter_impl.hh>
+
+#endif /* #ifndef BRICK_COMPUTERVISION_STATICEXTENDEDKALMANFILTER_HH */
@@ -0,0 +1,424 @@
+/**
+***************************************************************************
+* @file brick/computerVision/staticExtendedKalmanFilter_impl.hh
+*
+* Header file defining inline and template functions declared in
+* staticExtendedKalmanFilter.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_STATICEXTENDEDKALMANFILTER_IMPL_HH
+#define BRICK_COMPUTERVISION_STATICEXTENDEDKALMANFILTER_IMPL_HH
+
+// This file is included by staticExtendedKalmanFilter.hh, and should
+// not be directly included by user code, so no need to include
+// staticExtendedKalmanFilter.hh here.
+//
+// #include <brick/computerVision/staticExtendedKalmanFilter.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Compute lower triangular L such that L * L^T == matrix.  If
+      // allowSingular is true, matrix may be positive semidefinite,
+      // and columns of L corresponding to (numerically) zero pivots
+      // are set to zero.  Returns false if matrix is not positive
+      // definite and allowSingular is false.
+      template <class FloatType, size_t Size>
+      bool
+      staticCholesky(
+        brick::numeric::StaticArray2D<FloatType, Size, Size> const& matrix,
+        brick::numeric::StaticArray2D<FloatType, Size, Size>& lowerFactor,
+        bool allowSingular)
+      {
+        FloatType maximumDiagonal = FloatType(0);
+        for(size_t ii = 0; ii < Size; ++ii) {
+          maximumDiagonal = std::max(maximumDiagonal, matrix(ii, ii));
+        }
+        FloatType const threshold =
+          maximumDiagonal * Size * std::numeric_limits<FloatType>::epsilon();
+
+        lowerFactor = FloatType(0);
+        for(size_t jj = 0; jj < Size; ++jj) {
+          FloatType pivot = matrix(jj, jj);
+          for(size_t kk = 0; kk < jj; ++kk) {
+            pivot -= lowerFactor(jj, kk) * lowerFactor(jj, kk);
+          }
+          if(pivot <= threshold) {
+            if(!allowSingular || pivot < -threshold) {
+              return false;
+            }
+            // Leave column jj at zero.
+            continue;
+          }
+          FloatType const diagonal = std::sqrt(pivot);
+          lowerFactor(jj, jj) = diagonal;
+          for(size_t ii = jj + 1; ii < Size; ++ii) {
+            FloatType element = matrix(ii, jj);
+            for(size_t kk = 0; kk < jj; ++kk) {
+              element -= lowerFactor(ii, kk) * lowerFactor(jj, kk);
+            }
+            lowerFactor(ii, jj) = element / diagonal;
+          }
+        }
+        return true;
+      }
+
+
+      // Given a (Rows x Columns) matrix A, with Columns >= Rows,
+      // find lower triangular L such that L * L^T == A * A^T.  This
+      // is done by applying Householder reflections from the right,
+      // which amounts to an LQ factorization of A, and is
+      // numerically much better behaved than forming A * A^T.  The
+      // contents of workspace are destroyed.
+      template <class FloatType, size_t Rows, size_t Columns>
+      void
+      staticTriangularize(
+        brick::numeric::StaticArray2D<FloatType, Rows, Columns>& workspace,
+        brick::numeric::StaticArray2D<FloatType, Rows, Rows>& lowerFactor)
+      {
+        for(size_t ii = 0; ii < Rows; ++ii) {
+          FloatType* pivotRow = workspace.rowBegin(ii);
+          FloatType squaredNorm = FloatType(0);
+          for(size_t jj = ii; jj < Columns; ++jj) {
+            squaredNorm += pivotRow[jj] * pivotRow[jj];
+          }
+          FloatType const norm = std::sqrt(squaredNorm);
+          if(norm == FloatType(0)) {
+            continue;
+          }
+
+          // Reflection vector is v = x - alpha * e_ii, which we
+          // store in place of the pivot row.  Choosing the sign of
+          // alpha opposite that of x_ii avoids cancellation.
+          FloatType const leadingElement = pivotRow[ii];
+          FloatType const alpha =
+            (leadingElement > FloatType(0)) ? -norm : norm;
+          FloatType const vTv =
+            FloatType(2) * norm * (norm + std::fabs(leadingElement));
+          pivotRow[ii] -= alpha;
+
+          // Apply (I - 2 v v^T / v^T v) to each remaining row.
+          for(size_t rr = ii + 1; rr < Rows; ++rr) {
+            FloatType* currentRow = workspace.rowBegin(rr);
+            FloatType dotProduct = FloatType(0);
+            for(size_t jj = ii; jj < Columns; ++jj) {
+              dotProduct += currentRow[jj] * pivotRow[jj];
+            }
+            FloatType const scale = FloatType(2) * dotProduct / vTv;
+            for(size_t jj = ii; jj < Columns; ++jj) {
+              currentRow[jj] -= scale * pivotRow[jj];
+            }
+          }
+
+          pivotRow[ii] = alpha;
+          for(size_t jj = ii + 1; jj < Columns; ++jj) {
+            pivotRow[jj] = FloatType(0);
+          }
+        }
+
+        // Copy out the result, flipping column signs so that the
+        // diagonal is nonnegative.  This doesn't change L * L^T.
+        for(size_t jj = 0; jj < Rows; ++jj) {
+          FloatType const sign =
+            (workspace(jj, jj) < FloatType(0)) ? FloatType(-1) : FloatType(1);
+          for(size_t ii = 0; ii < Rows; ++ii) {
+            lowerFactor(ii, jj) =
+              (ii < jj) ? FloatType(0) : sign * workspace(ii, jj);
+          }
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // Default constructor.
+    template <class FloatType, size_t StateSize>
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    StaticExtendedKalmanFilter()
+      : m_covarianceSquareRoot(),
+        m_state()
+    {
+      // Empty.
+    }
+
+
+    // Constructor.
+    template <class FloatType, size_t StateSize>
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    StaticExtendedKalmanFilter(StateVector const& state,
+                               StateMatrix const& covariance)
+      : m_covarianceSquareRoot(),
+        m_state()
+    {
+      this->setStateEstimate(state, covariance);
+    }
+
+
+    // This member function propagates the state estimate forward in
+    // time, with arbitrary process noise.
+    template <class FloatType, size_t StateSize>
+    template <size_t NoiseSize>
+    void
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    doPredictionStep(
+      StateVector const& predictedState,
+      StateMatrix const& stateJacobian,
+      brick::numeric::StaticArray2D<FloatType, StateSize, NoiseSize> const&
+        noiseJacobian,
+      brick::numeric::StaticArray2D<FloatType, NoiseSize, NoiseSize> const&
+        processNoiseCovariance)
+    {
+      brick::numeric::StaticArray2D<FloatType, NoiseSize, NoiseSize> noiseRoot;
+      if(!privateCode::staticCholesky(
+           processNoiseCovariance, noiseRoot, true)) {
+        BRICK_THROW(common::ValueException,
+                    "StaticExtendedKalmanFilter::doPredictionStep()",
+                    "Process noise covariance is not positive semidefinite.");
+      }
+
+      // Build [F * S | G * sqrt(Q)], whose outer product is the
+      // predicted covariance.
+      brick::numeric::StaticArray2D<FloatType, StateSize,
+                                    StateSize + NoiseSize> workspace;
+      for(size_t ii = 0; ii < StateSize; ++ii) {
+        FloatType* outputRow = workspace.rowBegin(ii);
+        FloatType const* jacobianRow = stateJacobian.rowBegin(ii);
+        for(size_t jj = 0; jj < StateSize; ++jj) {
+          FloatType element = FloatType(0);
+          for(size_t kk = 0; kk < StateSize; ++kk) {
+            element += jacobianRow[kk] * m_covarianceSquareRoot(kk, jj);
+          }
+          outputRow[jj] = element;
+        }
+        FloatType const* noiseRow = noiseJacobian.rowBegin(ii);
+        for(size_t jj = 0; jj < NoiseSize; ++jj) {
+          FloatType element = FloatType(0);
+          for(size_t kk = jj; kk < NoiseSize; ++kk) {
+            element += noiseRow[kk] * noiseRoot(kk, jj);
+          }
+          outputRow[StateSize + jj] = element;
+        }
+      }
+
+      privateCode::staticTriangularize(workspace, m_covarianceSquareRoot);
+      m_state = predictedState;
+    }
+
+
+    // This member function propagates the state estimate forward in
+    // time, with additive, uncorrelated process noise.
+    template <class FloatType, size_t StateSize>
+    void
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    doPredictionStep(StateVector const& predictedState,
+                     StateMatrix const& stateJacobian,
+                     StateVector const& processNoiseVariances)
+    {
+      brick::numeric::StaticArray2D<FloatType, StateSize,
+                                    StateSize + StateSize> workspace(
+                                      FloatType(0));
+      for(size_t ii = 0; ii < StateSize; ++ii) {
+        if(processNoiseVariances[ii] < FloatType(0)) {
+          BRICK_THROW(common::ValueException,
+                      "StaticExtendedKalmanFilter::doPredictionStep()",
+                      "Process noise variances must be nonnegative.");
+        }
+        FloatType* outputRow = workspace.rowBegin(ii);
+        FloatType const* jacobianRow = stateJacobian.rowBegin(ii);
+        for(size_t jj = 0; jj < StateSize; ++jj) {
+          FloatType element = FloatType(0);
+          for(size_t kk = 0; kk < StateSize; ++kk) {
+            element += jacobianRow[kk] * m_covarianceSquareRoot(kk, jj);
+          }
+          outputRow[jj] = element;
+        }
+        outputRow[StateSize + ii] = std::sqrt(processNoiseVariances[ii]);
+      }
+
+      privateCode::staticTriangularize(workspace, m_covarianceSquareRoot);
+      m_state = predictedState;
+    }
+
+
+    // This member function updates the state estimate to reflect a
+    // vector measurement.
+    template <class FloatType, size_t StateSize>
+    template <size_t MeasurementSize>
+    void
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    doMeasurementUpdate(
+      brick::numeric::StaticArray1D<FloatType, MeasurementSize> const&
+        innovation,
+      brick::numeric::StaticArray2D<FloatType, MeasurementSize, StateSize>
+        const& measurementJacobian,
+      brick::numeric::StaticArray2D<FloatType, MeasurementSize,
+                                    MeasurementSize> const&
+        measurementNoiseCovariance)
+    {
+      brick::numeric::StaticArray2D<FloatType, MeasurementSize,
+                                    MeasurementSize> noiseRoot;
+      if(!privateCode::staticCholesky(
+           measurementNoiseCovariance, noiseRoot, false)) {
+        BRICK_THROW(common::ValueException,
+                    "StaticExtendedKalmanFilter::doMeasurementUpdate()",
+                    "Measurement noise covariance is not positive definite.");
+      }
+
+      // Whiten the measurement by forward substitution, so that
+      // L^(-1) * z has identity covariance.  Each whitened row can
+      // then be applied as an independent scalar measurement.
+      brick::numeric::StaticArray2D<FloatType, MeasurementSize, StateSize>
+        whitenedJacobian;
+      brick::numeric::StaticArray1D<FloatType, MeasurementSize>
+        whitenedInnovation;
+      for(size_t ii = 0; ii < MeasurementSize; ++ii) {
+        FloatType const reciprocal = FloatType(1) / noiseRoot(ii, ii);
+        FloatType element = innovation[ii];
+        for(size_t kk = 0; kk < ii; ++kk) {
+          element -= noiseRoot(ii, kk) * whitenedInnovation[kk];
+        }
+        whitenedInnovation[ii] = element * reciprocal;
+
+        for(size_t jj = 0; jj < StateSize; ++jj) {
+          FloatType jacobianElement = measurementJacobian(ii, jj);
+          for(size_t kk = 0; kk < ii; ++kk) {
+            jacobianElement -= noiseRoot(ii, kk) * whitenedJacobian(kk, jj);
+          }
+          whitenedJacobian(ii, jj) = jacobianElement * reciprocal;
+        }
+      }
+
+      // Note that the innovation was computed with respect to the
+      // prior state, so it must be corrected for each scalar update
+      // that has already been applied.
+      StateVector const priorState = m_state;
+      for(size_t ii = 0; ii < MeasurementSize; ++ii) {
+        StateVector jacobianRow;
+        FloatType correction = FloatType(0);
+        for(size_t jj = 0; jj < StateSize; ++jj) {
+          jacobianRow[jj] = whitenedJacobian(ii, jj);
+          correction += jacobianRow[jj] * (m_state[jj] - priorState[jj]);
+        }
+        this->doScalarMeasurementUpdate(
+          whitenedInnovation[ii] - correction, jacobianRow, FloatType(1));
+      }
+    }
+
+
+    // This member function updates the state estimate to reflect a
+    // single scalar measurement.
+    template <class FloatType, size_t StateSize>
+    void
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    doScalarMeasurementUpdate(FloatType innovation,
+                              StateVector const& measurementJacobian,
+                              FloatType measurementVariance)
+    {
+      if(measurementVariance <= FloatType(0)) {
+        BRICK_THROW(common::ValueException,
+                    "StaticExtendedKalmanFilter::doScalarMeasurementUpdate()",
+                    "Measurement variance must be positive.");
+      }
+
+      // This is Potter's square root update.  With phi = S^T * h and
+      // alpha = phi^T * phi + r (the innovation variance), the gain
+      // is S * phi / alpha, and the updated square root is
+      // S * (I - beta * phi * phi^T), with
+      // beta = 1 / (alpha + sqrt(r * alpha)).
+      StateVector phi;
+      FloatType alpha = measurementVariance;
+      for(size_t jj = 0; jj < StateSize; ++jj) {
+        FloatType element = FloatType(0);
+        for(size_t kk = 0; kk < StateSize; ++kk) {
+          element += m_covarianceSquareRoot(kk, jj) * measurementJacobian[kk];
+        }
+        phi[jj] = element;
+        alpha += element * element;
+      }
+
+      StateVector gainNumerator;
+      for(size_t ii = 0; ii < StateSize; ++ii) {
+        FloatType const* sqrtRow = m_covarianceSquareRoot.rowBegin(ii);
+        FloatType element = FloatType(0);
+        for(size_t kk = 0; kk < StateSize; ++kk) {
+          element += sqrtRow[kk] * phi[kk];
+        }
+        gainNumerator[ii] = element;
+      }
+
+      FloatType const stateScale = innovation / alpha;
+      FloatType const beta =
+        FloatType(1) / (alpha + std::sqrt(measurementVariance * alpha));
+      for(size_t ii = 0; ii < StateSize; ++ii) {
+        m_state[ii] += stateScale * gainNumerator[ii];
+        FloatType* sqrtRow = m_covarianceSquareRoot.rowBegin(ii);
+        FloatType const rowScale = beta * gainNumerator[ii];
+        for(size_t jj = 0; jj < StateSize; ++jj) {
+          sqrtRow[jj] -= rowScale * phi[jj];
+        }
+      }
+    }
+
+
+    // This member function returns the covariance of the current
+    // state estimate.
+    template <class FloatType, size_t StateSize>
+    typename StaticExtendedKalmanFilter<FloatType, StateSize>::StateMatrix
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    getCovariance() const
+    {
+      StateMatrix result;
+      for(size_t ii = 0; ii < StateSize; ++ii) {
+        FloatType const* row0 = m_covarianceSquareRoot.rowBegin(ii);
+        for(size_t jj = 0; jj <= ii; ++jj) {
+          FloatType const* row1 = m_covarianceSquareRoot.rowBegin(jj);
+          FloatType element = FloatType(0);
+          for(size_t kk = 0; kk < StateSize; ++kk) {
+            element += row0[kk] * row1[kk];
+          }
+          result(ii, jj) = element;
+          result(jj, ii) = element;
+        }
+      }
+      return result;
+    }
+
+
+    // This member function sets the state estimate and its
+    // covariance.
+    template <class FloatType, size_t StateSize>
+    void
+    StaticExtendedKalmanFilter<FloatType, StateSize>::
+    setStateEstimate(StateVector const& state,
+                     StateMatrix const& covariance)
+    {
+      StateMatrix covarianceRoot;
+      if(!privateCode::staticCholesky(covariance, covarianceRoot, true)) {
+        BRICK_THROW(common::ValueException,
+                    "StaticExtendedKalmanFilter::setStateEstimate()",
+                    "Covariance is not positive semidefinite.");
+      }
+      m_covarianceSquareRoot = covarianceRoot;
+      m_state = state;
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMPUTERVISION_STATICEXTENDEDKALMANFILTER_IMPL_HH */
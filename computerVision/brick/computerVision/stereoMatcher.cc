@@ -0,0 +1,714 @@
+/**
+***************************************************************************
+* @file brick/computerVision/stereoMatcher.cc
+*
+* Source file defining a dense stereo matcher for rectified images.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <brick/common/exception.hh>
+#include <brick/common/parallel.hh>
+#include <brick/computerVision/stereoMatcher.hh>
+#include <brick/numeric/subpixelInterpolate.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Minimum number of rows in each parallel task.
+      inline std::size_t
+      getStereoBandRows() {return 16;}
+
+
+      // Number of rows in each block matching task.  Each band has to
+      // prime blockSize rows of cost before producing its first row,
+      // so we use only a few bands per thread.
+      inline std::size_t
+      getStereoAggregationBandRows(std::size_t validRows,
+                                   std::size_t numberOfThreads)
+      {
+        std::size_t const numberOfBands = 4 * numberOfThreads;
+        return std::max(getStereoBandRows(),
+                        (validRows + numberOfBands - 1) / numberOfBands);
+      }
+
+
+      // Number of columns in each parallel task of the vertical
+      // semi-global matching passes.
+      inline std::size_t
+      getStereoStripColumns() {return 32;}
+
+
+      // Counts the set bits of a census code.  This is the usual
+      // shift-and-mask population count, rather than a popcount
+      // instruction, so that loops calling it can be vectorized.
+      inline unsigned int
+      countStereoBits(brick::common::UInt32 value)
+      {
+        value = value - ((value >> 1) & 0x55555555u);
+        value = (value & 0x33333333u) + ((value >> 2) & 0x33333333u);
+        value = (value + (value >> 4)) & 0x0f0f0f0fu;
+        return static_cast<unsigned int>((value * 0x01010101u) >> 24);
+      }
+
+
+      // Computes 24-bit 5x5 census codes for rows [firstRow, endRow).
+      // Each bit records whether a neighbor is darker than the
+      // center pixel.  Neighbors outside the image are clamped to
+      // the nearest edge pixel.
+      void
+      computeStereoCensus(Image<GRAY8> const& image,
+                          brick::numeric::Array2D<brick::common::UInt32>&
+                          census,
+                          std::size_t firstRow, std::size_t endRow)
+      {
+        int const rows = static_cast<int>(image.rows());
+        int const columns = static_cast<int>(image.columns());
+        for(int row = static_cast<int>(firstRow);
+            row < static_cast<int>(endRow); ++row) {
+          brick::common::UInt8 const* rowPtrs[5];
+          for(int dr = -2; dr <= 2; ++dr) {
+            int const neighborRow = std::min(std::max(row + dr, 0), rows - 1);
+            rowPtrs[dr + 2] = image.rowBegin(neighborRow);
+          }
+          brick::common::UInt32* outputPtr = census.rowBegin(row);
+          brick::common::UInt8 const* centerPtr = rowPtrs[2];
+          std::fill(outputPtr, outputPtr + columns, 0);
+
+          // Neighbors are visited in the outer loop so that the inner
+          // loop runs along the row, and can be vectorized.  Only
+          // the two columns at each end need clamping.
+          for(int ii = 0; ii < 5; ++ii) {
+            for(int jj = 0; jj < 5; ++jj) {
+              if(ii == 2 && jj == 2) {
+                continue;
+              }
+              brick::common::UInt8 const* neighborPtr = rowPtrs[ii];
+              int const offset = jj - 2;
+              for(int column = 2; column < columns - 2; ++column) {
+                outputPtr[column] = (outputPtr[column] << 1)
+                  | (neighborPtr[column + offset] < centerPtr[column]
+                     ? 1u : 0u);
+              }
+              for(int column = 0; column < columns; ++column) {
+                if(column >= 2 && column < columns - 2) {
+                  continue;
+                }
+                int const neighborColumn =
+                  std::min(std::max(column + offset, 0), columns - 1);
+                outputPtr[column] = (outputPtr[column] << 1)
+                  | (neighborPtr[neighborColumn] < centerPtr[column]
+                     ? 1u : 0u);
+              }
+            }
+          }
+        }
+      }
+
+
+      // Runs one step of a semi-global matching path: given the
+      // path costs at the previous pixel, computes path costs at
+      // the current pixel, and returns their minimum.
+      inline unsigned int
+      stepStereoPath(brick::common::UInt16 const* costs,
+                     brick::common::UInt16 const* previous,
+                     unsigned int previousMinimum,
+                     brick::common::UInt16* output,
+                     std::size_t numberOfDisparities,
+                     unsigned int penalty1, unsigned int penalty2)
+      {
+        unsigned int const jumpCost = previousMinimum + penalty2;
+        unsigned int minimum = 0xffffffffu;
+        std::size_t const last = numberOfDisparities - 1;
+        for(std::size_t dd = 0; dd < numberOfDisparities; ++dd) {
+          unsigned int best = previous[dd];
+          if(dd > 0) {
+            best = std::min(best, previous[dd - 1] + penalty1);
+          }
+          if(dd < last) {
+            best = std::min(best, previous[dd + 1] + penalty1);
+          }
+          best = std::min(best, jumpCost);
+          unsigned int const value = costs[dd] + best - previousMinimum;
+          output[dd] = static_cast<brick::common::UInt16>(value);
+          minimum = std::min(minimum, value);
+        }
+        return minimum;
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // The constructor specifies how matching should be done.
+    StereoMatcher::
+    StereoMatcher(std::size_t numberOfDisparities,
+                  std::size_t blockSize,
+                  CostType costType,
+                  AggregationType aggregationType)
+      : m_aggregationType(aggregationType),
+        m_blockSize(blockSize),
+        m_costType(costType),
+        m_maxLeftRightDifference(1),
+        m_numberOfDisparities(numberOfDisparities),
+        m_numberOfThreads(0),
+        m_penalty1(0),
+        m_penalty2(0),
+        m_uniquenessRatio(5)
+    {
+      if(numberOfDisparities < 2 || numberOfDisparities > 0xffff) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoMatcher::StereoMatcher()",
+                    "Argument numberOfDisparities must be in the range "
+                    "[2, 65535].");
+      }
+      if(blockSize % 2 == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoMatcher::StereoMatcher()",
+                    "Argument blockSize must be odd.");
+      }
+      if(this->getMaxBlockCost() > 0xffffu) {
+        std::ostringstream message;
+        message << "Block size " << blockSize << " is too large for "
+                << "16-bit costs.";
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoMatcher::StereoMatcher()",
+                    message.str().c_str());
+      }
+    }
+
+
+    // Computes the disparity map of a rectified stereo pair.
+    Image<GRAY_FLOAT32>
+    StereoMatcher::
+    computeDisparity(Image<GRAY8> const& leftImage,
+                     Image<GRAY8> const& rightImage) const
+    {
+      Image<GRAY_FLOAT32> disparityImage;
+      this->computeDisparity(leftImage, rightImage, disparityImage);
+      return disparityImage;
+    }
+
+
+    // Computes the disparity map of a rectified stereo pair into an
+    // existing image.
+    void
+    StereoMatcher::
+    computeDisparity(Image<GRAY8> const& leftImage,
+                     Image<GRAY8> const& rightImage,
+                     Image<GRAY_FLOAT32>& disparityImage) const
+    {
+      if(leftImage.rows() != rightImage.rows()
+         || leftImage.columns() != rightImage.columns()) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoMatcher::computeDisparity()",
+                    "Left and right images must be the same size.");
+      }
+      if(disparityImage.rows() != leftImage.rows()
+         || disparityImage.columns() != leftImage.columns()) {
+        disparityImage.reinit(leftImage.rows(), leftImage.columns());
+      }
+      disparityImage = getInvalidDisparity();
+
+      std::size_t const rows = leftImage.rows();
+      std::size_t const columns = leftImage.columns();
+      std::size_t const radius = m_blockSize / 2;
+      if(rows < m_blockSize || columns < m_blockSize) {
+        return;
+      }
+      std::size_t numberOfThreads = m_numberOfThreads;
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
+      }
+
+      // Census codes are computed once per image, rather than once
+      // per disparity.
+      brick::numeric::Array2D<brick::common::UInt32> leftCensus;
+      brick::numeric::Array2D<brick::common::UInt32> rightCensus;
+      std::size_t const bandRows = privateCode::getStereoBandRows();
+      if(m_costType == BRICK_STEREO_CENSUS) {
+        leftCensus.reinit(rows, columns);
+        rightCensus.reinit(rows, columns);
+        std::size_t const numberOfBands = (rows + bandRows - 1) / bandRows;
+        brick::common::executeInParallel(
+          2 * numberOfBands,
+          [&](std::size_t taskIndex) {
+            std::size_t const firstRow = (taskIndex / 2) * bandRows;
+            std::size_t const endRow = std::min(firstRow + bandRows, rows);
+            if(taskIndex % 2 == 0) {
+              privateCode::computeStereoCensus(
+                leftImage, leftCensus, firstRow, endRow);
+            } else {
+              privateCode::computeStereoCensus(
+                rightImage, rightCensus, firstRow, endRow);
+            }
+          },
+          numberOfThreads);
+      }
+
+      if(m_aggregationType == BRICK_STEREO_SEMI_GLOBAL) {
+        this->semiGlobalMatch(leftImage, rightImage, leftCensus, rightCensus,
+                              disparityImage, numberOfThreads);
+        return;
+      }
+
+      // Block matching: each band of rows is aggregated and
+      // resolved independently.
+      std::size_t const validRows = rows - 2 * radius;
+      std::size_t const aggregationRows =
+        privateCode::getStereoAggregationBandRows(validRows, numberOfThreads);
+      std::size_t const numberOfBands =
+        (validRows + aggregationRows - 1) / aggregationRows;
+      brick::common::executeInParallel(
+        numberOfBands,
+        [&](std::size_t bandIndex) {
+          std::size_t const firstRow = radius + bandIndex * aggregationRows;
+          std::size_t const endRow =
+            std::min(firstRow + aggregationRows, rows - radius);
+          std::vector<brick::common::UInt32> rightMatches;
+          auto consumer = [&](std::size_t row, CostValue const* costs) {
+            this->selectDisparities(costs, columns,
+                                    disparityImage.rowBegin(row),
+                                    rightMatches);
+          };
+          this->aggregateBlockCosts(leftImage, rightImage,
+                                    leftCensus, rightCensus,
+                                    firstRow, endRow, consumer);
+        },
+        numberOfThreads);
+    }
+
+
+    // Sets the smoothness penalties used by semi-global matching.
+    void
+    StereoMatcher::
+    setSemiGlobalPenalties(unsigned int penalty1, unsigned int penalty2)
+    {
+      if(penalty2 < penalty1) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoMatcher::setSemiGlobalPenalties()",
+                    "Argument penalty2 must be at least penalty1.");
+      }
+      m_penalty1 = penalty1;
+      m_penalty2 = penalty2;
+    }
+
+
+    // ---- Private members below this line. ----
+
+    // Computes block-summed costs for rows [firstRow, endRow).
+    // Pixel costs for the blockSize rows under the block are kept in
+    // a ring buffer, and their column sums are updated as the block
+    // slides down, so that each pixel cost is computed only once.
+    template <class Consumer>
+    void
+    StereoMatcher::
+    aggregateBlockCosts(Image<GRAY8> const& leftImage,
+                        Image<GRAY8> const& rightImage,
+                        brick::numeric::Array2D<brick::common::UInt32>
+                        const& leftCensus,
+                        brick::numeric::Array2D<brick::common::UInt32>
+                        const& rightCensus,
+                        std::size_t firstRow, std::size_t endRow,
+                        Consumer& consumer) const
+    {
+      std::size_t const columns = leftImage.columns();
+      std::size_t const numberOfDisparities = m_numberOfDisparities;
+      std::size_t const blockSize = m_blockSize;
+      std::size_t const radius = blockSize / 2;
+      std::size_t const rowLength = columns * numberOfDisparities;
+      brick::common::UInt8 const maxPixelCost =
+        (m_costType == BRICK_STEREO_CENSUS) ? 24 : 255;
+
+      std::vector<brick::common::UInt8> pixelCosts(blockSize * rowLength);
+      std::vector<CostValue> columnSums(rowLength, 0);
+      std::vector<CostValue> blockCosts(rowLength, 0);
+
+      // Costs of matching each pixel of one row at each disparity.
+      // Right image pixels off the left edge get the worst cost.  The
+      // right image row is copied in reverse order first, so that the
+      // inner loops read it forward, which helps the compiler
+      // vectorize them.
+      std::vector<brick::common::UInt32> reversedRight(columns);
+      auto computePixelCosts = [&](std::size_t row,
+                                   brick::common::UInt8* outputPtr) {
+        if(m_costType == BRICK_STEREO_CENSUS) {
+          std::reverse_copy(rightCensus.rowBegin(row),
+                            rightCensus.rowBegin(row) + columns,
+                            reversedRight.begin());
+        } else {
+          std::reverse_copy(rightImage.rowBegin(row),
+                            rightImage.rowBegin(row) + columns,
+                            reversedRight.begin());
+        }
+        for(std::size_t column = 0; column < columns; ++column) {
+          brick::common::UInt8* costPtr =
+            outputPtr + column * numberOfDisparities;
+          std::size_t const numberOfValid =
+            std::min(numberOfDisparities, column + 1);
+          brick::common::UInt32 const* rightPtr =
+            &(reversedRight[columns - 1 - column]);
+          if(m_costType == BRICK_STEREO_CENSUS) {
+            brick::common::UInt32 const leftCode = leftCensus(row, column);
+            for(std::size_t dd = 0; dd < numberOfValid; ++dd) {
+              costPtr[dd] = static_cast<brick::common::UInt8>(
+                privateCode::countStereoBits(leftCode ^ rightPtr[dd]));
+            }
+          } else {
+            int const leftValue = leftImage(row, column);
+            for(std::size_t dd = 0; dd < numberOfValid; ++dd) {
+              costPtr[dd] = static_cast<brick::common::UInt8>(
+                std::abs(leftValue - static_cast<int>(rightPtr[dd])));
+            }
+          }
+          std::fill(costPtr + numberOfValid, costPtr + numberOfDisparities,
+                    maxPixelCost);
+        }
+      };
+
+      // Prime the column sums with the rows under the first block.
+      for(std::size_t row = firstRow - radius; row <= firstRow + radius;
+          ++row) {
+        brick::common::UInt8* slotPtr =
+          &(pixelCosts[(row % blockSize) * rowLength]);
+        computePixelCosts(row, slotPtr);
+        for(std::size_t ii = 0; ii < rowLength; ++ii) {
+          columnSums[ii] = static_cast<CostValue>(columnSums[ii] + slotPtr[ii]);
+        }
+      }
+
+      for(std::size_t row = firstRow; row < endRow; ++row) {
+        if(row != firstRow) {
+          // The row leaving the block and the row entering it share
+          // a ring buffer slot.
+          brick::common::UInt8* slotPtr =
+            &(pixelCosts[((row + radius) % blockSize) * rowLength]);
+          for(std::size_t ii = 0; ii < rowLength; ++ii) {
+            columnSums[ii] =
+              static_cast<CostValue>(columnSums[ii] - slotPtr[ii]);
+          }
+          computePixelCosts(row + radius, slotPtr);
+          for(std::size_t ii = 0; ii < rowLength; ++ii) {
+            columnSums[ii] =
+              static_cast<CostValue>(columnSums[ii] + slotPtr[ii]);
+          }
+        }
+
+        // Slide the block horizontally.  Only columns [radius,
+        // columns - radius) are filled in.
+        CostValue* firstPtr = &(blockCosts[radius * numberOfDisparities]);
+        std::fill(firstPtr, firstPtr + numberOfDisparities, 0);
+        for(std::size_t column = 0; column < blockSize; ++column) {
+          CostValue const* sumPtr = &(columnSums[column * numberOfDisparities]);
+          for(std::size_t dd = 0; dd < numberOfDisparities; ++dd) {
+            firstPtr[dd] = static_cast<CostValue>(firstPtr[dd] + sumPtr[dd]);
+          }
+        }
+        for(std::size_t column = radius + 1; column < columns - radius;
+            ++column) {
+          CostValue const* previousPtr =
+            &(blockCosts[(column - 1) * numberOfDisparities]);
+          CostValue const* enteringPtr =
+            &(columnSums[(column + radius) * numberOfDisparities]);
+          CostValue const* leavingPtr =
+            &(columnSums[(column - radius - 1) * numberOfDisparities]);
+          CostValue* outputPtr = &(blockCosts[column * numberOfDisparities]);
+          for(std::size_t dd = 0; dd < numberOfDisparities; ++dd) {
+            outputPtr[dd] = static_cast<CostValue>(
+              previousPtr[dd] + enteringPtr[dd] - leavingPtr[dd]);
+          }
+        }
+        consumer(row, &(blockCosts[0]));
+      }
+    }
+
+
+    // Returns the largest possible aggregated block cost.
+    unsigned int
+    StereoMatcher::
+    getMaxBlockCost() const
+    {
+      unsigned int const maxPixelCost =
+        (m_costType == BRICK_STEREO_CENSUS) ? 24 : 255;
+      return maxPixelCost * static_cast<unsigned int>(m_blockSize * m_blockSize);
+    }
+
+
+    // Picks disparities for one row given its aggregated costs.
+    void
+    StereoMatcher::
+    selectDisparities(CostValue const* costs, std::size_t columns,
+                      float* disparityRow,
+                      std::vector<brick::common::UInt32>& rightMatches)
+      const
+    {
+      std::size_t const numberOfDisparities = m_numberOfDisparities;
+      std::size_t const radius = m_blockSize / 2;
+      std::size_t const endColumn = columns - radius;
+
+      // The right image disparity of column xr is the best
+      // disparity among left image pixels (xr + d, d), which we
+      // accumulate while finding left image disparities.  Costs and
+      // disparities are packed into one word, cost in the high bits,
+      // so that each search is a plain minimum, which the compiler
+      // can vectorize.
+      rightMatches.assign(columns, 0xffffffffu);
+      brick::common::UInt32* rightPtr = &(rightMatches[0]);
+      std::vector<brick::common::UInt32> matchBuffer(numberOfDisparities);
+      brick::common::UInt32* matches = &(matchBuffer[0]);
+
+      for(std::size_t column = radius; column < endColumn; ++column) {
+        CostValue const* costPtr = costs + column * numberOfDisparities;
+
+        // Only consider disparities that keep the whole block inside
+        // the right image.
+        std::size_t const numberOfCandidates =
+          std::min(numberOfDisparities, column - radius + 1);
+        brick::common::UInt32 const numberOfCandidates32 =
+          static_cast<brick::common::UInt32>(numberOfCandidates);
+        brick::common::UInt32* matchPtr = rightPtr + column;
+        brick::common::UInt32 bestMatch = 0xffffffffu;
+        for(brick::common::UInt32 dd = 0; dd < numberOfCandidates32; ++dd) {
+          matches[dd] = (brick::common::UInt32(costPtr[dd]) << 16) | dd;
+          bestMatch = std::min(bestMatch, matches[dd]);
+        }
+        for(int dd = 0; dd < static_cast<int>(numberOfCandidates); ++dd) {
+          matchPtr[-dd] = std::min(matchPtr[-dd], matches[dd]);
+        }
+        unsigned int const bestCost = bestMatch >> 16;
+        std::size_t const bestDisparity = bestMatch & 0xffffu;
+
+        // Reject ambiguous matches.
+        if(m_uniquenessRatio != 0) {
+          unsigned int secondCost = 0xffffffffu;
+          std::size_t const lowEnd =
+            (bestDisparity > 1) ? (bestDisparity - 1) : 0;
+          for(std::size_t dd = 0; dd < lowEnd; ++dd) {
+            secondCost = std::min(secondCost,
+                                  static_cast<unsigned int>(costPtr[dd]));
+          }
+          for(std::size_t dd = bestDisparity + 2; dd < numberOfCandidates;
+              ++dd) {
+            secondCost = std::min(secondCost,
+                                  static_cast<unsigned int>(costPtr[dd]));
+          }
+          if(secondCost != 0xffffffffu
+             && secondCost * 100 <= bestCost * (100 + m_uniquenessRatio)) {
+            continue;
+          }
+        }
+
+        float disparity = static_cast<float>(bestDisparity);
+        if(bestDisparity > 0 && bestDisparity + 1 < numberOfCandidates) {
+          double position;
+          double value;
+          if(brick::numeric::subpixelInterpolate(
+               static_cast<double>(bestDisparity),
+               static_cast<double>(costPtr[bestDisparity - 1]),
+               static_cast<double>(costPtr[bestDisparity]),
+               static_cast<double>(costPtr[bestDisparity + 1]),
+               position, value)
+             && position > bestDisparity - 1.0
+             && position < bestDisparity + 1.0) {
+            disparity = static_cast<float>(position);
+          }
+        }
+        disparityRow[column] = disparity;
+      }
+
+      // Left-right consistency check.
+      if(m_maxLeftRightDifference >= 0) {
+        for(std::size_t column = radius; column < endColumn; ++column) {
+          float const disparity = disparityRow[column];
+          if(disparity < 0.0f) {
+            continue;
+          }
+          int const integerDisparity = static_cast<int>(disparity + 0.5f);
+          int const rightColumn = static_cast<int>(column) - integerDisparity;
+          if(rightColumn < 0
+             || rightMatches[rightColumn] == 0xffffffffu
+             || std::abs(static_cast<int>(rightMatches[rightColumn] & 0xffffu)
+                         - integerDisparity) > m_maxLeftRightDifference) {
+            disparityRow[column] = getInvalidDisparity();
+          }
+        }
+      }
+    }
+
+
+    // Runs semi-global matching.  Path costs along rows are summed
+    // with rows divided among threads, then path costs along columns
+    // are added with columns divided among threads.
+    void
+    StereoMatcher::
+    semiGlobalMatch(Image<GRAY8> const& leftImage,
+                    Image<GRAY8> const& rightImage,
+                    brick::numeric::Array2D<brick::common::UInt32>
+                    const& leftCensus,
+                    brick::numeric::Array2D<brick::common::UInt32>
+                    const& rightCensus,
+                    Image<GRAY_FLOAT32>& disparityImage,
+                    std::size_t numberOfThreads) const
+    {
+      std::size_t const rows = leftImage.rows();
+      std::size_t const columns = leftImage.columns();
+      std::size_t const numberOfDisparities = m_numberOfDisparities;
+      std::size_t const radius = m_blockSize / 2;
+      std::size_t const rowLength = columns * numberOfDisparities;
+
+      unsigned int penalty1 = m_penalty1;
+      unsigned int penalty2 = m_penalty2;
+      if(penalty1 == 0 || penalty2 == 0) {
+        unsigned int const blockArea =
+          static_cast<unsigned int>(m_blockSize * m_blockSize);
+        bool const isCensus = (m_costType == BRICK_STEREO_CENSUS);
+        penalty1 = (isCensus ? 2 : 8) * blockArea;
+        penalty2 = (isCensus ? 8 : 32) * blockArea;
+      }
+
+      // Path costs never exceed maxBlockCost + penalty2, and four
+      // of them are summed.
+      if(4 * (this->getMaxBlockCost() + penalty2) > 0xffffu) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoMatcher::computeDisparity()",
+                    "Block size and penalties are too large for 16-bit "
+                    "semi-global matching.  Try a smaller block, or "
+                    "census cost.");
+      }
+
+      // Pixels that can't be block matched get uniform (zero) cost,
+      // so that paths carry their disparities straight through.
+      std::vector<CostValue> costVolume(rows * rowLength, 0);
+      std::vector<CostValue> sumVolume(rows * rowLength, 0);
+
+      std::size_t const validRows = rows - 2 * radius;
+      std::size_t const aggregationRows =
+        privateCode::getStereoAggregationBandRows(validRows, numberOfThreads);
+      std::size_t const numberOfBands =
+        (validRows + aggregationRows - 1) / aggregationRows;
+      brick::common::executeInParallel(
+        numberOfBands,
+        [&](std::size_t bandIndex) {
+          std::size_t const firstRow = radius + bandIndex * aggregationRows;
+          std::size_t const endRow =
+            std::min(firstRow + aggregationRows, rows - radius);
+          auto consumer = [&](std::size_t row, CostValue const* costs) {
+            std::copy(costs + radius * numberOfDisparities,
+                      costs + (columns - radius) * numberOfDisparities,
+                      &(costVolume[row * rowLength
+                                   + radius * numberOfDisparities]));
+          };
+          this->aggregateBlockCosts(leftImage, rightImage,
+                                    leftCensus, rightCensus,
+                                    firstRow, endRow, consumer);
+        },
+        numberOfThreads);
+
+      // Horizontal paths, left to right and right to left.
+      brick::common::executeInParallel(
+        rows,
+        [&](std::size_t row) {
+          std::vector<CostValue> previous(numberOfDisparities);
+          std::vector<CostValue> current(numberOfDisparities);
+          CostValue const* costRow = &(costVolume[row * rowLength]);
+          CostValue* sumRow = &(sumVolume[row * rowLength]);
+          for(int direction = 0; direction < 2; ++direction) {
+            unsigned int previousMinimum = 0;
+            for(std::size_t ii = 0; ii < columns; ++ii) {
+              std::size_t const column =
+                (direction == 0) ? ii : (columns - 1 - ii);
+              CostValue const* costPtr = costRow + column * numberOfDisparities;
+              if(ii == 0) {
+                std::copy(costPtr, costPtr + numberOfDisparities,
+                          current.begin());
+                previousMinimum = *std::min_element(
+                  current.begin(), current.end());
+              } else {
+                previousMinimum = privateCode::stepStereoPath(
+                  costPtr, &(previous[0]), previousMinimum, &(current[0]),
+                  numberOfDisparities, penalty1, penalty2);
+              }
+              CostValue* sumPtr = sumRow + column * numberOfDisparities;
+              for(std::size_t dd = 0; dd < numberOfDisparities; ++dd) {
+                sumPtr[dd] = static_cast<CostValue>(sumPtr[dd] + current[dd]);
+              }
+              previous.swap(current);
+            }
+          }
+        },
+        numberOfThreads);
+
+      // Vertical paths, top to bottom and bottom to top.  Each task
+      // handles a strip of columns, a row at a time.
+      std::size_t const stripColumns = privateCode::getStereoStripColumns();
+      std::size_t const numberOfStrips =
+        (columns + stripColumns - 1) / stripColumns;
+      brick::common::executeInParallel(
+        numberOfStrips,
+        [&](std::size_t stripIndex) {
+          std::size_t const firstColumn = stripIndex * stripColumns;
+          std::size_t const endColumn =
+            std::min(firstColumn + stripColumns, columns);
+          std::size_t const stripLength =
+            (endColumn - firstColumn) * numberOfDisparities;
+          std::vector<CostValue> previous(stripLength);
+          std::vector<CostValue> current(stripLength);
+          std::vector<unsigned int> previousMinima(endColumn - firstColumn);
+          for(int direction = 0; direction < 2; ++direction) {
+            for(std::size_t ii = 0; ii < rows; ++ii) {
+              std::size_t const row = (direction == 0) ? ii : (rows - 1 - ii);
+              std::size_t const offset =
+                row * rowLength + firstColumn * numberOfDisparities;
+              CostValue const* costPtr = &(costVolume[offset]);
+              CostValue* sumPtr = &(sumVolume[offset]);
+              for(std::size_t jj = 0; jj < endColumn - firstColumn; ++jj) {
+                std::size_t const start = jj * numberOfDisparities;
+                if(ii == 0) {
+                  std::copy(costPtr + start,
+                            costPtr + start + numberOfDisparities,
+                            current.begin() + start);
+                  previousMinima[jj] = *std::min_element(
+                    current.begin() + start,
+                    current.begin() + start + numberOfDisparities);
+                } else {
+                  previousMinima[jj] = privateCode::stepStereoPath(
+                    costPtr + start, &(previous[start]), previousMinima[jj],
+                    &(current[start]), numberOfDisparities,
+                    penalty1, penalty2);
+                }
+              }
+              for(std::size_t kk = 0; kk < stripLength; ++kk) {
+                sumPtr[kk] = static_cast<CostValue>(sumPtr[kk] + current[kk]);
+              }
+              previous.swap(current);
+            }
+          }
+        },
+        numberOfThreads);
+
+      // Pick disparities from the summed path costs.
+      brick::common::executeInParallel(
+        validRows,
+        [&](std::size_t index) {
+          std::size_t const row = radius + index;
+          std::vector<brick::common::UInt32> rightMatches;
+          this->selectDisparities(&(sumVolume[row * rowLength]), columns,
+                                  disparityImage.rowBegin(row),
+                                  rightMatches);
+        },
+        numberOfThreads);
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
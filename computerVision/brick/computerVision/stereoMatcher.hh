@@ -0,0 +1,315 @@
+/**
+***************************************************************************
+* @file brick/computerVision/stereoMatcher.hh
+*
+* Header file declaring a dense stereo matcher for rectified images.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_STEREOMATCHER_HH
+#define BRICK_COMPUTERVISION_STEREOMATCHER_HH
+
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/computerVision/image.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/numeric/transform3D.hh>
+#include <brick/numeric/vector3D.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /**
+     ** This class computes dense disparity maps from rectified
+     ** stereo pairs, such as those produced by StereoRectifier.
+     **
+     ** Matching cost is either the sum of absolute differences
+     ** (SAD) of pixel values, or the Hamming distance between 5x5
+     ** census transforms, summed over a square block.  Costs are then
+     ** either minimized independently at each pixel (block
+     ** matching), or first smoothed along four scanline directions
+     ** (semi-global matching, after Hirschmuller [1]).  The winning
+     ** disparity is refined to subpixel precision with
+     ** brick::numeric::subpixelInterpolate(), and rejected if it
+     ** isn't sufficiently better than the runners up, or if it fails
+     ** a left-right consistency check.
+     **
+     ** Disparity is the column of a point in the left image minus its
+     ** column in the right image, so it has the same sign convention
+     ** as getReprojectionMatrix().  Pixels with no valid disparity
+     ** are set to getInvalidDisparity().  Use reprojectDisparity() to
+     ** convert a disparity map to 3D points.
+     **
+     ** Work is divided among threads by rows.  Costs are held in
+     ** 16-bit integers, laid out so that the inner loops run over
+     ** contiguous disparities, which lets the compiler vectorize
+     ** them.  Block matching needs only a few rows of cost at a time,
+     ** but semi-global matching stores two full cost volumes of
+     ** rows x columns x numberOfDisparities 16-bit values.
+     **
+     ** [1] H. Hirschmuller, "Stereo Processing by Semiglobal
+     ** Matching and Mutual Information," IEEE Transactions on
+     ** Pattern Analysis and Machine Intelligence, 30(2), 2008.
+     **
+     ** @code
+     **   StereoMatcher matcher(128, 7);
+     **   Image<GRAY_FLOAT32> disparity =
+     **     matcher.computeDisparity(leftImage, rightImage);
+     **   Array2D<bool> isValid;
+     **   Array2D< Vector3D<double> > points = reprojectDisparity(
+     **     disparity, getReprojectionMatrix(intrinsics0, intrinsics1, b),
+     **     isValid);
+     ** @endcode
+     **/
+    class StereoMatcher {
+    public:
+
+      /**
+       ** This enum lists the available matching costs.
+       **/
+      enum CostType {
+        BRICK_STEREO_CENSUS,
+        BRICK_STEREO_SAD
+      };
+
+
+      /**
+       ** This enum lists the available ways of combining costs.
+       **/
+      enum AggregationType {
+        BRICK_STEREO_BLOCK_MATCHING,
+        BRICK_STEREO_SEMI_GLOBAL
+      };
+
+
+      /**
+       * The constructor specifies how matching should be done.
+       *
+       * @param numberOfDisparities This argument specifies how many
+       * disparities (0 through numberOfDisparities - 1) to search.
+       *
+       * @param blockSize This argument specifies the width and height
+       * of the square block over which matching costs are summed.
+       * It must be odd.  For semi-global matching, small blocks
+       * (3 or 5) are usual.
+       *
+       * @param costType This argument specifies how pixels are
+       * compared.
+       *
+       * @param aggregationType This argument specifies whether to
+       * use block matching or semi-global matching.
+       */
+      StereoMatcher(
+        std::size_t numberOfDisparities = 64,
+        std::size_t blockSize = 9,
+        CostType costType = BRICK_STEREO_CENSUS,
+        AggregationType aggregationType = BRICK_STEREO_BLOCK_MATCHING);
+
+
+      /**
+       * Destructor.
+       */
+      virtual
+      ~StereoMatcher() {}
+
+
+      /**
+       * Computes the disparity map of a rectified stereo pair.
+       *
+       * @param leftImage This argument is the rectified left image.
+       *
+       * @param rightImage This argument is the rectified right image.
+       * It must be the same size as leftImage.
+       *
+       * @return The return value holds the disparity of each pixel
+       * of leftImage, or getInvalidDisparity().
+       */
+      Image<GRAY_FLOAT32>
+      computeDisparity(Image<GRAY8> const& leftImage,
+                       Image<GRAY8> const& rightImage) const;
+
+
+      /**
+       * Computes the disparity map of a rectified stereo pair into
+       * an existing image.
+       *
+       * @param leftImage This argument is the rectified left image.
+       *
+       * @param rightImage This argument is the rectified right image.
+       *
+       * @param disparityImage This argument returns the disparity
+       * map.  It is reinitialized only if its size doesn't match
+       * leftImage.
+       */
+      void
+      computeDisparity(Image<GRAY8> const& leftImage,
+                       Image<GRAY8> const& rightImage,
+                       Image<GRAY_FLOAT32>& disparityImage) const;
+
+
+      /**
+       * Returns the value used to mark pixels with no disparity.
+       *
+       * @return The return value is negative.
+       */
+      static float
+      getInvalidDisparity() {return -1.0f;}
+
+
+      /**
+       * Returns the number of disparities searched.
+       *
+       * @return The return value is the numberOfDisparities
+       * constructor argument.
+       */
+      std::size_t
+      getNumberOfDisparities() const {return m_numberOfDisparities;}
+
+
+      /**
+       * Sets the maximum allowable difference between the disparity
+       * of a left image pixel and the disparity of the matching
+       * right image pixel.  The default is 1.
+       *
+       * @param maxDifference This argument is the tolerance in
+       * pixels.  Negative values disable the check.
+       */
+      void
+      setMaxLeftRightDifference(int maxDifference) {
+        m_maxLeftRightDifference = maxDifference;
+      }
+
+
+      /**
+       * Sets the number of threads used by computeDisparity().
+       *
+       * @param numberOfThreads This argument specifies the number of
+       * threads.  If it is zero (the default), a sensible default is
+       * chosen.
+       */
+      void
+      setNumberOfThreads(std::size_t numberOfThreads) {
+        m_numberOfThreads = numberOfThreads;
+      }
+
+
+      /**
+       * Sets the smoothness penalties used by semi-global matching.
+       * If either is zero (the default), both are chosen based on
+       * cost type and block size.
+       *
+       * @param penalty1 This argument is the cost of a one pixel
+       * disparity change between neighbors.
+       *
+       * @param penalty2 This argument is the cost of a larger
+       * disparity change.  It must be at least penalty1.
+       */
+      void
+      setSemiGlobalPenalties(unsigned int penalty1, unsigned int penalty2);
+
+
+      /**
+       * Sets how distinct the best match must be.  The best cost
+       * must be lower than the best cost at any disparity more than
+       * one pixel away by at least this percentage.  The default is
+       * 5.
+       *
+       * @param uniquenessRatio This argument is the margin in
+       * percent.  Zero disables the check.
+       */
+      void
+      setUniquenessRatio(unsigned int uniquenessRatio) {
+        m_uniquenessRatio = uniquenessRatio;
+      }
+
+    private:
+
+      typedef brick::common::UInt16 CostValue;
+
+      // Computes one row of aggregated (block-summed) cost for every
+      // row in [firstRow, endRow), handing each to consumer.
+      template <class Consumer>
+      void
+      aggregateBlockCosts(Image<GRAY8> const& leftImage,
+                          Image<GRAY8> const& rightImage,
+                          brick::numeric::Array2D<brick::common::UInt32>
+                          const& leftCensus,
+                          brick::numeric::Array2D<brick::common::UInt32>
+                          const& rightCensus,
+                          std::size_t firstRow, std::size_t endRow,
+                          Consumer& consumer) const;
+
+      // Returns the largest possible aggregated block cost.
+      unsigned int
+      getMaxBlockCost() const;
+
+      // Picks disparities for one row given its aggregated costs.
+      void
+      selectDisparities(CostValue const* costs, std::size_t columns,
+                        float* disparityRow,
+                        std::vector<brick::common::UInt32>& rightMatches)
+        const;
+
+      // Runs semi-global matching.
+      void
+      semiGlobalMatch(Image<GRAY8> const& leftImage,
+                      Image<GRAY8> const& rightImage,
+                      brick::numeric::Array2D<brick::common::UInt32>
+                      const& leftCensus,
+                      brick::numeric::Array2D<brick::common::UInt32>
+                      const& rightCensus,
+                      Image<GRAY_FLOAT32>& disparityImage,
+                      std::size_t numberOfThreads) const;
+
+
+      AggregationType m_aggregationType;
+      std::size_t m_blockSize;
+      CostType m_costType;
+      int m_maxLeftRightDifference;
+      std::size_t m_numberOfDisparities;
+      std::size_t m_numberOfThreads;
+      unsigned int m_penalty1;
+      unsigned int m_penalty2;
+      unsigned int m_uniquenessRatio;
+    };
+
+
+    /**
+     * This function converts a disparity map into 3D points using
+     * the reprojection matrix returned by getReprojectionMatrix().
+     *
+     * @param disparityImage This argument is a disparity map, such as
+     * is returned by StereoMatcher::computeDisparity().
+     *
+     * @param reprojectionMatrix This argument is the matrix Q that
+     * takes [u, v, d, 1] to homogeneous 3D coordinates.
+     *
+     * @param isValid This argument returns an array that is true
+     * for each pixel that has a valid disparity.
+     *
+     * @return The return value holds the 3D point corresponding to
+     * each pixel, in the coordinate system of the rectified left
+     * camera.  Points for invalid pixels are set to (0, 0, 0).
+     */
+    template <class FloatType>
+    brick::numeric::Array2D< brick::numeric::Vector3D<FloatType> >
+    reprojectDisparity(
+      Image<GRAY_FLOAT32> const& disparityImage,
+      brick::numeric::Transform3D<FloatType> const& reprojectionMatrix,
+      brick::numeric::Array2D<bool>& isValid);
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/computerVision/stereoMatcher_impl.hh>
+
+#endif /* #ifndef BRICK_COMPUTERVISION_STEREOMATCHER_HH */
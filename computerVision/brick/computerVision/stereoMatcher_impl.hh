@@ -0,0 +1,73 @@
+/**
+***************************************************************************
+* @file brick/computerVision/stereoMatcher_impl.hh
+*
+* Header file defining inline and template functions declared in
+* stereoMatcher.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_STEREOMATCHER_IMPL_HH
+#define BRICK_COMPUTERVISION_STEREOMATCHER_IMPL_HH
+
+// This file is included by stereoMatcher.hh, and should not be
+// directly included by user code, so no need to include
+// stereoMatcher.hh here.
+//
+// #include <brick/computerVision/stereoMatcher.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    // This function converts a disparity map into 3D points.
+    template <class FloatType>
+    brick::numeric::Array2D< brick::numeric::Vector3D<FloatType> >
+    reprojectDisparity(
+      Image<GRAY_FLOAT32> const& disparityImage,
+      brick::numeric::Transform3D<FloatType> const& reprojectionMatrix,
+      brick::numeric::Array2D<bool>& isValid)
+    {
+      brick::numeric::Array2D< brick::numeric::Vector3D<FloatType> > result(
+        disparityImage.rows(), disparityImage.columns());
+      isValid.reinit(disparityImage.rows(), disparityImage.columns());
+
+      // Only the disparity term changes from pixel to pixel along a
+      // row, so hoist everything else out of the inner loop.
+      brick::numeric::Transform3D<FloatType> const& QQ = reprojectionMatrix;
+      for(std::size_t row = 0; row < disparityImage.rows(); ++row) {
+        FloatType const vv = static_cast<FloatType>(row);
+        FloatType const xRow = QQ(0, 1) * vv + QQ(0, 3);
+        FloatType const yRow = QQ(1, 1) * vv + QQ(1, 3);
+        FloatType const zRow = QQ(2, 1) * vv + QQ(2, 3);
+        FloatType const wRow = QQ(3, 1) * vv + QQ(3, 3);
+        for(std::size_t column = 0; column < disparityImage.columns();
+            ++column) {
+          float const disparity = disparityImage(row, column);
+          FloatType const uu = static_cast<FloatType>(column);
+          FloatType const dd = static_cast<FloatType>(disparity);
+          FloatType const ww = QQ(3, 0) * uu + QQ(3, 2) * dd + wRow;
+          if(disparity < 0.0f || ww == FloatType(0)) {
+            result(row, column).setValue(0.0, 0.0, 0.0);
+            isValid(row, column) = false;
+            continue;
+          }
+          result(row, column).setValue(
+            (QQ(0, 0) * uu + QQ(0, 2) * dd + xRow) / ww,
+            (QQ(1, 0) * uu + QQ(1, 2) * dd + yRow) / ww,
+            (QQ(2, 0) * uu + QQ(2, 2) * dd + zRow) / ww);
+          isValid(row, column) = true;
+        }
+      }
+      return result;
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMPUTERVISION_STEREOMATCHER_IMPL_HH */
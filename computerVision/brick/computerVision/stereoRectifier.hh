@@ -0,0 +1,281 @@
+/**
+***************************************************************************
+* @file brick/computerVision/stereoRectifier.hh
+*
+* Header file declaring the StereoRectifier class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_STEREORECTIFIER_HH
+#define BRICK_COMPUTERVISION_STEREORECTIFIER_HH
+
+#include <brick/common/types.hh>
+#include <brick/computerVision/cameraIntrinsicsPinhole.hh>
+#include <brick/computerVision/image.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/numeric/transform3D.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // One bilinear interpolation tap of a stereo rectification
+      // lookup table.  Row and column locate the upper left of the
+      // four input pixels.  Row is -1 if the output pixel falls
+      // outside the input image.
+      struct StereoRectifierSample {
+        brick::common::Int32 row;
+        brick::common::Int32 column;
+        float xFraction;
+        float yFraction;
+      };
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    /**
+     ** This class precomputes the lookup tables that take a stereo
+     ** pair of raw camera images to rectified images, and then
+     ** applies them to any number of image pairs.  It is intended to
+     ** be used with the output of stereoRectify().
+     **
+     ** Building the tables doesn't call reverseProject() for each
+     ** pixel.  Because the rectified cameras are pinhole cameras
+     ** that share their optical centers with the raw cameras, the
+     ** ray through each rectified pixel is an affine function of
+     ** pixel column, so each row of rays is generated incrementally
+     ** and passed straight to IntrinsicsType::project().  Rows are
+     ** divided among threads.
+     **
+     ** If the decimation argument of the constructor is greater than
+     ** one, the rectified images are produced at reduced resolution,
+     ** with each output pixel averaging decimation x decimation
+     ** bilinear samples.  This gives the same result as rectifying
+     ** at full resolution and then block averaging, but without the
+     ** intermediate image.  Use getRectifiedIntrinsics0() and
+     ** getRectifiedIntrinsics1() to get intrinsics that describe the
+     ** reduced-resolution images (for example, to pass to
+     ** getReprojectionMatrix()).
+     **
+     ** Template argument IntrinsicsType specifies the camera model
+     ** of the raw images, for example CameraIntrinsicsPinhole<double>
+     ** or CameraIntrinsicsPlumbBob<double>.  It must provide
+     ** project(Vector3D<FloatType>), getNumPixelsX(), and
+     ** getNumPixelsY().
+     **
+     ** Here's an example of how you might use this class:
+     **
+     ** @code
+     **   stereoRectify(intrinsics0, intrinsics1,
+     **                 camera0FromWorld, camera1FromWorld,
+     **                 rectifiedIntrinsics0, rectifiedIntrinsics1,
+     **                 rcamera0FromWorld, rcamera1FromWorld,
+     **                 image0FromRImage0, image1FromRImage1);
+     **   StereoRectifier< CameraIntrinsicsPinhole<double> > rectifier(
+     **     intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+     **     rectifiedIntrinsics0, rectifiedIntrinsics1,
+     **     rcamera0FromWorld, rcamera1FromWorld, 2);
+     **   for(...) {
+     **     rectifier.rectify(image0, image1, rectified0, rectified1);
+     **     ...
+     **   }
+     ** @endcode
+     **/
+    template <class IntrinsicsType, class FloatType = double>
+    class StereoRectifier {
+    public:
+
+      /**
+       * The default constructor makes a StereoRectifier that can't
+       * rectify anything.
+       */
+      StereoRectifier();
+
+
+      /**
+       * This constructor builds the lookup tables.
+       *
+       * @param intrinsics0 This argument specifies the intrinsics of
+       * the raw left camera.
+       *
+       * @param intrinsics1 This argument specifies the intrinsics of
+       * the raw right camera.
+       *
+       * @param camera0FromWorld This argument specifies the
+       * extrinsics of the raw left camera.
+       *
+       * @param camera1FromWorld This argument specifies the
+       * extrinsics of the raw right camera.
+       *
+       * @param rectifiedIntrinsics0 This argument specifies the
+       * intrinsics of the rectified left camera, as returned by
+       * stereoRectify().  Its image size sets the (undecimated)
+       * size of the rectified images.
+       *
+       * @param rectifiedIntrinsics1 This argument specifies the
+       * intrinsics of the rectified right camera.
+       *
+       * @param rcamera0FromWorld This argument specifies the
+       * extrinsics of the rectified left camera, as returned by
+       * stereoRectify().
+       *
+       * @param rcamera1FromWorld This argument specifies the
+       * extrinsics of the rectified right camera.
+       *
+       * @param decimation This argument specifies how much smaller
+       * (in each dimension) the rectified images should be.  It must
+       * be at least 1.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use, both here and in rectify().  If it is zero,
+       * a sensible default is chosen.
+       */
+      StereoRectifier(
+        IntrinsicsType const& intrinsics0,
+        IntrinsicsType const& intrinsics1,
+        brick::numeric::Transform3D<FloatType> const& camera0FromWorld,
+        brick::numeric::Transform3D<FloatType> const& camera1FromWorld,
+        CameraIntrinsicsPinhole<FloatType> const& rectifiedIntrinsics0,
+        CameraIntrinsicsPinhole<FloatType> const& rectifiedIntrinsics1,
+        brick::numeric::Transform3D<FloatType> const& rcamera0FromWorld,
+        brick::numeric::Transform3D<FloatType> const& rcamera1FromWorld,
+        std::size_t decimation = 1,
+        std::size_t numberOfThreads = 0);
+
+
+      /**
+       * Returns the decimation factor passed to the constructor.
+       *
+       * @return The return value is the ratio of full rectified
+       * resolution to output resolution.
+       */
+      std::size_t
+      getDecimation() const {return m_decimation;}
+
+
+      /**
+       * Returns the number of columns in the rectified images.
+       *
+       * @return The return value is the output image width.
+       */
+      std::size_t
+      getOutputColumns() const {return m_outputColumns;}
+
+
+      /**
+       * Returns the number of rows in the rectified images.
+       *
+       * @return The return value is the output image height.
+       */
+      std::size_t
+      getOutputRows() const {return m_outputRows;}
+
+
+      /**
+       * Returns intrinsics describing the rectified left images.  If
+       * decimation is greater than one, these differ from the
+       * rectifiedIntrinsics0 constructor argument.
+       *
+       * @return The return value describes the output images.
+       */
+      CameraIntrinsicsPinhole<FloatType> const&
+      getRectifiedIntrinsics0() const {return m_rectifiedIntrinsics0;}
+
+
+      /**
+       * Returns intrinsics describing the rectified right images.
+       *
+       * @return The return value describes the output images.
+       */
+      CameraIntrinsicsPinhole<FloatType> const&
+      getRectifiedIntrinsics1() const {return m_rectifiedIntrinsics1;}
+
+
+      /**
+       * Rectifies a stereo pair.  Both images are processed in one
+       * parallel pass.
+       *
+       * @param image0 This argument is the raw left image.  Its size
+       * must match intrinsics0.
+       *
+       * @param image1 This argument is the raw right image.  Its
+       * size must match intrinsics1.
+       *
+       * @param rectified0 This argument returns the rectified left
+       * image.  It is reinitialized only if it doesn't already have
+       * the output size.
+       *
+       * @param rectified1 This argument returns the rectified right
+       * image.
+       *
+       * @param defaultValue This argument specifies the value of
+       * output pixels that don't see the raw image.
+       */
+      template <ImageFormat Format>
+      void
+      rectify(Image<Format> const& image0, Image<Format> const& image1,
+              Image<Format>& rectified0, Image<Format>& rectified1,
+              typename Image<Format>::PixelType defaultValue
+              = typename Image<Format>::PixelType()) const;
+
+    private:
+
+      typedef privateCode::StereoRectifierSample Sample;
+
+      void
+      buildTable(
+        brick::numeric::Array2D<Sample>& table,
+        IntrinsicsType const& intrinsics,
+        brick::numeric::Transform3D<FloatType> const& cameraFromWorld,
+        CameraIntrinsicsPinhole<FloatType> const& rectifiedIntrinsics,
+        brick::numeric::Transform3D<FloatType> const& rcameraFromWorld,
+        std::size_t firstRow, std::size_t endRow) const;
+
+      CameraIntrinsicsPinhole<FloatType>
+      decimateIntrinsics(
+        CameraIntrinsicsPinhole<FloatType> const& intrinsics) const;
+
+      template <ImageFormat Format>
+      void
+      rectifyRows(brick::numeric::Array2D<Sample> const& table,
+                  Image<Format> const& inputImage,
+                  Image<Format>& outputImage,
+                  typename Image<Format>::PixelType const& defaultValue,
+                  std::size_t firstRow, std::size_t endRow) const;
+
+
+      std::size_t m_decimation;
+      std::size_t m_inputColumns0;
+      std::size_t m_inputColumns1;
+      std::size_t m_inputRows0;
+      std::size_t m_inputRows1;
+      std::size_t m_numberOfThreads;
+      std::size_t m_outputColumns;
+      std::size_t m_outputRows;
+      CameraIntrinsicsPinhole<FloatType> m_rectifiedIntrinsics0;
+      CameraIntrinsicsPinhole<FloatType> m_rectifiedIntrinsics1;
+
+      // Each row of each table holds decimation^2 samples for each
+      // output pixel, one decimated row at a time.
+      brick::numeric::Array2D<Sample> m_table0;
+      brick::numeric::Array2D<Sample> m_table1;
+    };
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/computerVision/stereoRectifier_impl.hh>
+
+#endif /* #ifndef BRICK_COMPUTERVISION_STEREORECTIFIER_HH */
@@ -0,0 +1,424 @@
+/**
+***************************************************************************
+* @file brick/computerVision/stereoRectifier_impl.hh
+*
+* Header file defining inline and template functions declared in
+* stereoRectifier.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#ifndef BRICK_COMPUTERVISION_STEREORECTIFIER_IMPL_HH
+#define BRICK_COMPUTERVISION_STEREORECTIFIER_IMPL_HH
+
+// This file is included by stereoRectifier.hh, and should not be
+// directly included by user code, so no need to include
+// stereoRectifier.hh here.
+//
+// #include <brick/computerVision/stereoRectifier.hh>
+
+#include <algorithm>
+#include <sstream>
+#include <brick/common/exception.hh>
+#include <brick/common/parallel.hh>
+#include <brick/computerVision/imageFormatTraits.hh>
+#include <brick/numeric/vector2D.hh>
+#include <brick/numeric/vector3D.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Number of decimated output rows handled by each task.
+      inline std::size_t
+      getStereoRectifierBandRows() {return 16;}
+
+
+      // Converts an interpolated value back to a pixel component,
+      // rounding if the component type is integral.
+      template <class ComponentType>
+      inline ComponentType
+      roundStereoRectifierComponent(float value, bool isIntegral)
+      {
+        if(isIntegral) {
+          value += (value < 0.0f) ? -0.5f : 0.5f;
+        }
+        return static_cast<ComponentType>(value);
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // The default constructor makes a StereoRectifier that can't
+    // rectify anything.
+    template <class IntrinsicsType, class FloatType>
+    StereoRectifier<IntrinsicsType, FloatType>::
+    StereoRectifier()
+      : m_decimation(1),
+        m_inputColumns0(0),
+        m_inputColumns1(0),
+        m_inputRows0(0),
+        m_inputRows1(0),
+        m_numberOfThreads(0),
+        m_outputColumns(0),
+        m_outputRows(0),
+        m_rectifiedIntrinsics0(),
+        m_rectifiedIntrinsics1(),
+        m_table0(),
+        m_table1()
+    {
+      // Empty.
+    }
+
+
+    // This constructor builds the lookup tables.
+    template <class IntrinsicsType, class FloatType>
+    StereoRectifier<IntrinsicsType, FloatType>::
+    StereoRectifier(
+      IntrinsicsType const& intrinsics0,
+      IntrinsicsType const& intrinsics1,
+      brick::numeric::Transform3D<FloatType> const& camera0FromWorld,
+      brick::numeric::Transform3D<FloatType> const& camera1FromWorld,
+      CameraIntrinsicsPinhole<FloatType> const& rectifiedIntrinsics0,
+      CameraIntrinsicsPinhole<FloatType> const& rectifiedIntrinsics1,
+      brick::numeric::Transform3D<FloatType> const& rcamera0FromWorld,
+      brick::numeric::Transform3D<FloatType> const& rcamera1FromWorld,
+      std::size_t decimation,
+      std::size_t numberOfThreads)
+      : m_decimation(decimation),
+        m_inputColumns0(intrinsics0.getNumPixelsX()),
+        m_inputColumns1(intrinsics1.getNumPixelsX()),
+        m_inputRows0(intrinsics0.getNumPixelsY()),
+        m_inputRows1(intrinsics1.getNumPixelsY()),
+        m_numberOfThreads(numberOfThreads),
+        m_outputColumns(0),
+        m_outputRows(0),
+        m_rectifiedIntrinsics0(),
+        m_rectifiedIntrinsics1(),
+        m_table0(),
+        m_table1()
+    {
+      if(decimation == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoRectifier::StereoRectifier()",
+                    "Argument decimation must be at least 1.");
+      }
+      if(rectifiedIntrinsics0.getNumPixelsX()
+         != rectifiedIntrinsics1.getNumPixelsX()
+         || rectifiedIntrinsics0.getNumPixelsY()
+         != rectifiedIntrinsics1.getNumPixelsY()) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoRectifier::StereoRectifier()",
+                    "Rectified intrinsics must have the same image size.");
+      }
+
+      m_outputColumns = rectifiedIntrinsics0.getNumPixelsX() / decimation;
+      m_outputRows = rectifiedIntrinsics0.getNumPixelsY() / decimation;
+      m_rectifiedIntrinsics0 = this->decimateIntrinsics(rectifiedIntrinsics0);
+      m_rectifiedIntrinsics1 = this->decimateIntrinsics(rectifiedIntrinsics1);
+      m_table0.reinit(m_outputRows,
+                      m_outputColumns * decimation * decimation);
+      m_table1.reinit(m_outputRows,
+                      m_outputColumns * decimation * decimation);
+
+      // Even-numbered tasks fill in m_table0, odd-numbered tasks
+      // fill in m_table1.
+      std::size_t const bandRows = privateCode::getStereoRectifierBandRows();
+      std::size_t const numberOfBands = (m_outputRows + bandRows - 1) / bandRows;
+      brick::common::executeInParallel(
+        2 * numberOfBands,
+        [&](std::size_t taskIndex) {
+          std::size_t const firstRow = (taskIndex / 2) * bandRows;
+          std::size_t const endRow = std::min(firstRow + bandRows,
+                                              this->m_outputRows);
+          if(taskIndex % 2 == 0) {
+            this->buildTable(this->m_table0, intrinsics0, camera0FromWorld,
+                             rectifiedIntrinsics0, rcamera0FromWorld,
+                             firstRow, endRow);
+          } else {
+            this->buildTable(this->m_table1, intrinsics1, camera1FromWorld,
+                             rectifiedIntrinsics1, rcamera1FromWorld,
+                             firstRow, endRow);
+          }
+        },
+        m_numberOfThreads);
+    }
+
+
+    // Rectifies a stereo pair.
+    template <class IntrinsicsType, class FloatType>
+    template <ImageFormat Format>
+    void
+    StereoRectifier<IntrinsicsType, FloatType>::
+    rectify(Image<Format> const& image0, Image<Format> const& image1,
+            Image<Format>& rectified0, Image<Format>& rectified1,
+            typename Image<Format>::PixelType defaultValue) const
+    {
+      typedef typename ImageFormatTraits<Format>::ComponentType ComponentType;
+      if(sizeof(typename Image<Format>::PixelType)
+         != (ImageFormatTraits<Format>::getNumberOfComponents()
+             * sizeof(ComponentType))) {
+        BRICK_THROW(brick::common::NotImplementedException,
+                    "StereoRectifier::rectify()",
+                    "This function currently only works with pixel types "
+                    "that have no padding.");
+      }
+      if(image0.rows() != m_inputRows0 || image0.columns() != m_inputColumns0
+         || image1.rows() != m_inputRows1
+         || image1.columns() != m_inputColumns1) {
+        std::ostringstream message;
+        message << "Input images (" << image0.rows() << "x"
+                << image0.columns() << " and " << image1.rows() << "x"
+                << image1.columns() << ") don't match expected dimensions ("
+                << m_inputRows0 << "x" << m_inputColumns0 << " and "
+                << m_inputRows1 << "x" << m_inputColumns1 << ").";
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoRectifier::rectify()",
+                    message.str().c_str());
+      }
+      if(&image0 == &rectified0 || &image1 == &rectified1
+         || &image0 == &rectified1 || &image1 == &rectified0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "StereoRectifier::rectify()",
+                    "Rectification can't be done in place.");
+      }
+      if(rectified0.rows() != m_outputRows
+         || rectified0.columns() != m_outputColumns) {
+        rectified0.reinit(m_outputRows, m_outputColumns);
+      }
+      if(rectified1.rows() != m_outputRows
+         || rectified1.columns() != m_outputColumns) {
+        rectified1.reinit(m_outputRows, m_outputColumns);
+      }
+
+      std::size_t const bandRows = privateCode::getStereoRectifierBandRows();
+      std::size_t const numberOfBands = (m_outputRows + bandRows - 1) / bandRows;
+      brick::common::executeInParallel(
+        2 * numberOfBands,
+        [&](std::size_t taskIndex) {
+          std::size_t const firstRow = (taskIndex / 2) * bandRows;
+          std::size_t const endRow = std::min(firstRow + bandRows,
+                                              this->m_outputRows);
+          if(taskIndex % 2 == 0) {
+            this->rectifyRows(this->m_table0, image0, rectified0,
+                              defaultValue, firstRow, endRow);
+          } else {
+            this->rectifyRows(this->m_table1, image1, rectified1,
+                              defaultValue, firstRow, endRow);
+          }
+        },
+        m_numberOfThreads);
+    }
+
+
+    // ---- Private members below this line. ----
+
+    // This member function fills in rows [firstRow, endRow) of a
+    // lookup table.
+    template <class IntrinsicsType, class FloatType>
+    void
+    StereoRectifier<IntrinsicsType, FloatType>::
+    buildTable(
+      brick::numeric::Array2D<Sample>& table,
+      IntrinsicsType const& intrinsics,
+      brick::numeric::Transform3D<FloatType> const& cameraFromWorld,
+      CameraIntrinsicsPinhole<FloatType> const& rectifiedIntrinsics,
+      brick::numeric::Transform3D<FloatType> const& rcameraFromWorld,
+      std::size_t firstRow, std::size_t endRow) const
+    {
+      // The raw and rectified cameras share an optical center, so
+      // only the rotation between them matters.
+      brick::numeric::Transform3D<FloatType> cameraFromRCamera =
+        cameraFromWorld * rcameraFromWorld.invert();
+
+      // In rectified camera coordinates, the ray through pixel (u,
+      // v) is [(u - c_u) / k_x, (v - c_v) / k_y, 1].  Rotated into
+      // raw camera coordinates, that's rowStart + u * columnStep.
+      FloatType const kX = rectifiedIntrinsics.getKx();
+      FloatType const kY = rectifiedIntrinsics.getKy();
+      FloatType const centerU = rectifiedIntrinsics.getCenterU();
+      FloatType const centerV = rectifiedIntrinsics.getCenterV();
+      brick::numeric::Vector3D<FloatType> columnStep(
+        cameraFromRCamera(0, 0) / kX,
+        cameraFromRCamera(1, 0) / kX,
+        cameraFromRCamera(2, 0) / kX);
+
+      std::size_t const inputColumns = intrinsics.getNumPixelsX();
+      std::size_t const inputRows = intrinsics.getNumPixelsY();
+      FloatType const maxX = static_cast<FloatType>(inputColumns) - 1.0;
+      FloatType const maxY = static_cast<FloatType>(inputRows) - 1.0;
+      std::size_t const decimation = m_decimation;
+      std::size_t const samplesPerPixel = decimation * decimation;
+
+      for(std::size_t row = firstRow; row < endRow; ++row) {
+        Sample* rowPtr = table.rowBegin(row);
+        for(std::size_t subRow = 0; subRow < decimation; ++subRow) {
+          FloatType const yNorm =
+            (static_cast<FloatType>(row * decimation + subRow) - centerV) / kY;
+          FloatType const xNorm0 = -centerU / kX;
+          brick::numeric::Vector3D<FloatType> rowStart(
+            cameraFromRCamera(0, 0) * xNorm0 + cameraFromRCamera(0, 1) * yNorm
+            + cameraFromRCamera(0, 2),
+            cameraFromRCamera(1, 0) * xNorm0 + cameraFromRCamera(1, 1) * yNorm
+            + cameraFromRCamera(1, 2),
+            cameraFromRCamera(2, 0) * xNorm0 + cameraFromRCamera(2, 1) * yNorm
+            + cameraFromRCamera(2, 2));
+
+          for(std::size_t column = 0; column < m_outputColumns; ++column) {
+            Sample* samplePtr =
+              rowPtr + column * samplesPerPixel + subRow * decimation;
+            for(std::size_t subColumn = 0; subColumn < decimation;
+                ++subColumn, ++samplePtr) {
+              FloatType const uu =
+                static_cast<FloatType>(column * decimation + subColumn);
+              brick::numeric::Vector3D<FloatType> ray =
+                rowStart + uu * columnStep;
+              samplePtr->row = -1;
+              if(ray.z() <= 0.0) {
+                continue;
+              }
+              brick::numeric::Vector2D<FloatType> inputCoord =
+                intrinsics.project(ray);
+              if(inputCoord.x() >= 0.0 && inputCoord.y() >= 0.0
+                 && inputCoord.x() < maxX && inputCoord.y() < maxY) {
+                brick::common::Int32 const i0 =
+                  static_cast<brick::common::Int32>(inputCoord.x());
+                brick::common::Int32 const j0 =
+                  static_cast<brick::common::Int32>(inputCoord.y());
+                samplePtr->row = j0;
+                samplePtr->column = i0;
+                samplePtr->xFraction = static_cast<float>(inputCoord.x() - i0);
+                samplePtr->yFraction = static_cast<float>(inputCoord.y() - j0);
+              }
+            }
+          }
+        }
+
+        // An output pixel is valid only if all of its samples are,
+        // so that decimated pixels at the edge of the raw image
+        // aren't biased toward the default value.  We flag invalid
+        // pixels by setting the row of their first sample to -1.
+        for(std::size_t column = 0; column < m_outputColumns; ++column) {
+          Sample* pixelPtr = rowPtr + column * samplesPerPixel;
+          for(std::size_t ii = 1; ii < samplesPerPixel; ++ii) {
+            if(pixelPtr[ii].row < 0) {
+              pixelPtr->row = -1;
+              break;
+            }
+          }
+        }
+      }
+    }
+
+
+    // This member function returns intrinsics that describe
+    // decimated rectified images.  Output pixel (u', v') averages
+    // full resolution pixels [d * u', d * u' + d - 1], so its center
+    // is at u = d * u' + (d - 1) / 2.
+    template <class IntrinsicsType, class FloatType>
+    CameraIntrinsicsPinhole<FloatType>
+    StereoRectifier<IntrinsicsType, FloatType>::
+    decimateIntrinsics(
+      CameraIntrinsicsPinhole<FloatType> const& intrinsics) const
+    {
+      FloatType const decimation = static_cast<FloatType>(m_decimation);
+      FloatType const offset = (decimation - 1.0) / 2.0;
+      return CameraIntrinsicsPinhole<FloatType>(
+        static_cast<unsigned int>(m_outputColumns),
+        static_cast<unsigned int>(m_outputRows),
+        intrinsics.getFocalLength(),
+        intrinsics.getPixelSizeX() * decimation,
+        intrinsics.getPixelSizeY() * decimation,
+        (intrinsics.getCenterU() - offset) / decimation,
+        (intrinsics.getCenterV() - offset) / decimation);
+    }
+
+
+    // This member function applies rows [firstRow, endRow) of a
+    // lookup table.
+    template <class IntrinsicsType, class FloatType>
+    template <ImageFormat Format>
+    void
+    StereoRectifier<IntrinsicsType, FloatType>::
+    rectifyRows(brick::numeric::Array2D<Sample> const& table,
+                Image<Format> const& inputImage,
+                Image<Format>& outputImage,
+                typename Image<Format>::PixelType const& defaultValue,
+                std::size_t firstRow, std::size_t endRow) const
+    {
+      typedef typename ImageFormatTraits<Format>::ComponentType ComponentType;
+      std::size_t const numberOfComponents =
+        ImageFormatTraits<Format>::getNumberOfComponents();
+      bool const isIntegral = ImageFormatTraits<Format>::isIntegral();
+      std::size_t const samplesPerPixel = m_decimation * m_decimation;
+      float const sampleWeight = 1.0f / static_cast<float>(samplesPerPixel);
+
+      // Work on pixel components, so that every format is handled
+      // the same way, and so that integer pixels aren't truncated
+      // before the samples are summed.
+      std::size_t const inputRowStep =
+        inputImage.getRowStep() * numberOfComponents;
+      ComponentType const* inputPtr =
+        reinterpret_cast<ComponentType const*>(inputImage.data());
+      float accumulator[4];
+      if(numberOfComponents > 4) {
+        BRICK_THROW(brick::common::NotImplementedException,
+                    "StereoRectifier::rectify()",
+                    "Pixels with more than four components aren't "
+                    "supported.");
+      }
+
+      for(std::size_t row = firstRow; row < endRow; ++row) {
+        Sample const* samplePtr = table.rowBegin(row);
+        typename Image<Format>::PixelType* outputPixelPtr =
+          outputImage.rowBegin(row);
+        for(std::size_t column = 0; column < m_outputColumns;
+            ++column, samplePtr += samplesPerPixel, ++outputPixelPtr) {
+          if(samplePtr->row < 0) {
+            *outputPixelPtr = defaultValue;
+            continue;
+          }
+          std::fill(accumulator, accumulator + numberOfComponents, 0.0f);
+          for(std::size_t ii = 0; ii < samplesPerPixel; ++ii) {
+            Sample const& sample = samplePtr[ii];
+            float const xFrac = sample.xFraction;
+            float const yFrac = sample.yFraction;
+            float const c00 = (1.0f - xFrac) * (1.0f - yFrac);
+            float const c01 = xFrac * (1.0f - yFrac);
+            float const c10 = (1.0f - xFrac) * yFrac;
+            float const c11 = xFrac * yFrac;
+            ComponentType const* p00 =
+              inputPtr + sample.row * inputRowStep
+              + sample.column * numberOfComponents;
+            ComponentType const* p10 = p00 + inputRowStep;
+            for(std::size_t kk = 0; kk < numberOfComponents; ++kk) {
+              accumulator[kk] += (
+                c00 * static_cast<float>(p00[kk])
+                + c01 * static_cast<float>(p00[kk + numberOfComponents])
+                + c10 * static_cast<float>(p10[kk])
+                + c11 * static_cast<float>(p10[kk + numberOfComponents]));
+            }
+          }
+          ComponentType* outputPtr =
+            reinterpret_cast<ComponentType*>(outputPixelPtr);
+          for(std::size_t kk = 0; kk < numberOfComponents; ++kk) {
+            outputPtr[kk] =
+              privateCode::roundStereoRectifierComponent<ComponentType>(
+                accumulator[kk] * sampleWeight, isIntegral);
+          }
+        }
+      }
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_COMPUTERVISION_STEREORECTIFIER_IMPL_HH */
@@ -40,6 +40,7 @@ public:
 
   // Tests.
   void testEstimateCameraParametersRobust();
+  void testEstimateCameraParametersRobustParallel();
   void testEstimateCameraParametersPinholeRobust();
 
 private:
@@ -98,6 +99,7 @@ CalibrationToolsRobustTest()
     m_stringentTolerance(1.0E-13)
 {
   BRICK_TEST_REGISTER_MEMBER(testEstimateCameraParametersRobust);
+  BRICK_TEST_REGISTER_MEMBER(testEstimateCameraParametersRobustParallel);
   BRICK_TEST_REGISTER_MEMBER(testEstimateCameraParametersPinholeRobust);
 }
 
@@ -147,6 +149,74 @@ testEstimateCameraParametersRobust()
 }
 
 
+void
+CalibrationToolsRobustTest::
+testEstimateCameraParametersRobustParallel()
+{
+  CameraIntrinsicsPlumbBob<double> referenceIntrinsics;
+  this->getTestIntrinsicsPlumbBob(referenceIntrinsics);
+
+  std::vector< Vector3D<double> > points3D_world;
+  std::vector< Vector3D<double> > points3D_camera;
+  std::vector< Vector2D<double> > points2D;
+  Transform3D<double> cameraTworld;
+  this->get3DTestData(points3D_world, points3D_camera, cameraTworld);
+  this->compute2DTestData(points2D, points3D_camera, referenceIntrinsics);
+
+  // Corrupt the test data with a few outliers.
+  points3D_world[3] = points3D_world[5];
+  points3D_world[40] = points3D_world[80];
+  points2D[100] = points2D[120];
+
+  double maxResidual = 0.01;
+  double inlierProbability = (static_cast<double>(points2D.size() - 3)
+                              / static_cast<double>(points2D.size()));
+  double requiredConfidence = 0.9999999;
+
+  // Try serial and parallel execution.
+  for(size_t numberOfThreads = 1; numberOfThreads <= 3;
+      numberOfThreads += 2) {
+    CameraIntrinsicsPlumbBob<double> recoveredIntrinsics;
+    Transform3D<double> recoveredCameraTworld;
+    RobustCalibrationStatistics statistics;
+    estimateCameraParametersRobustParallel(
+      recoveredIntrinsics, recoveredCameraTworld, statistics,
+      referenceIntrinsics.getNumPixelsX(), referenceIntrinsics.getNumPixelsY(),
+      points3D_world.begin(), points3D_world.end(), points2D.begin(),
+      maxResidual, inlierProbability, requiredConfidence, 0, 3,
+      numberOfThreads);
+
+    BRICK_TEST_ASSERT(
+      this->checkIntrinsicsEqual(
+        recoveredIntrinsics, referenceIntrinsics, m_relaxedTolerance));
+    BRICK_TEST_ASSERT(this->checkTransformEqual(
+                        recoveredCameraTworld, cameraTworld,
+                        m_relaxedTolerance));
+    BRICK_TEST_ASSERT(statistics.consensusSetSize == points2D.size() - 3);
+    BRICK_TEST_ASSERT(statistics.numberOfHypotheses >= 1);
+    BRICK_TEST_ASSERT(statistics.numberOfCandidates >= 1);
+    BRICK_TEST_ASSERT(statistics.numberOfCandidates <= 3);
+    BRICK_TEST_ASSERT(statistics.hypothesisTime >= 0.0);
+    BRICK_TEST_ASSERT(statistics.refinementTime >= 0.0);
+    BRICK_TEST_ASSERT(statistics.totalTime
+                      >= statistics.hypothesisTime
+                      + statistics.refinementTime - 1.0E-9);
+  }
+
+  // Bad probabilities should be caught.
+  CameraIntrinsicsPlumbBob<double> recoveredIntrinsics;
+  Transform3D<double> recoveredCameraTworld;
+  RobustCalibrationStatistics statistics;
+  BRICK_TEST_ASSERT_EXCEPTION(
+    ValueException,
+    estimateCameraParametersRobustParallel(
+      recoveredIntrinsics, recoveredCameraTworld, statistics,
+      referenceIntrinsics.getNumPixelsX(), referenceIntrinsics.getNumPixelsY(),
+      points3D_world.begin(), points3D_world.end(), points2D.begin(),
+      maxResidual, 1.0, requiredConfidence));
+}
+
+
 void
 CalibrationToolsRobustTest::
 testEstimateCameraParametersPinholeRobust()
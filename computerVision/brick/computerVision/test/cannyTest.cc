@@ -35,6 +35,7 @@ namespace brick {
 
       // Tests.
       void testCanny();
+      void testCannyFused();
 
     private:
 
@@ -48,6 +49,7 @@ namespace brick {
       : brick::test::TestFixture<CannyTest>("CannyTest")
     {
       BRICK_TEST_REGISTER_MEMBER(testCanny);
+      BRICK_TEST_REGISTER_MEMBER(testCannyFused);
     }
 
 
@@ -67,6 +69,83 @@ namespace brick {
       }
     }
 
+
+
+    void
+    CannyTest::
+    testCannyFused()
+    {
+      Image<GRAY8> inputImage0 = readPGM8(getTestImageFileNamePGM0());
+      Image<GRAY8> referenceImage = readPGM8(getEdgeImageFileNamePGM0());
+
+      // Fused implementation should reproduce the reference result,
+      // regardless of how many bands it uses.
+      for(unsigned int numberOfBands = 1; numberOfBands < 5;
+          ++numberOfBands) {
+        Image<GRAY1> binaryImage = applyCannyFused<double>(
+          inputImage0, 5, 5.0, 1.0, 3.0, 0.0, numberOfBands);
+        Image<GRAY8> edgeImage = convertColorspace<GRAY8>(binaryImage);
+        BRICK_TEST_ASSERT(edgeImage.rows() == referenceImage.rows());
+        BRICK_TEST_ASSERT(edgeImage.columns() == referenceImage.columns());
+        for(size_t index0 = 0; index0 < edgeImage.size(); ++index0) {
+          BRICK_TEST_ASSERT(edgeImage[index0] == referenceImage[index0]);
+        }
+      }
+
+      // It should also match the unfused implementation exactly for
+      // automatic thresholds, for the integer (unblurred GRAY8) code
+      // path, and for single precision.
+      unsigned int gaussianSizes[] = {0, 3, 5};
+      double upperThresholds[] = {0.0, 5.0, 10.0};
+      double lowerThresholds[] = {0.0, 0.0, 2.0};
+      for(size_t ii = 0; ii < 3; ++ii) {
+        for(size_t jj = 0; jj < 3; ++jj) {
+          brick::numeric::Array2D<double> gradX;
+          brick::numeric::Array2D<double> gradY;
+          Image<GRAY1> referenceEdges = applyCanny<double>(
+            inputImage0, gradX, gradY, gaussianSizes[ii],
+            upperThresholds[jj], lowerThresholds[jj]);
+
+          brick::numeric::Array2D<float> gradXFloat;
+          brick::numeric::Array2D<float> gradYFloat;
+          Image<GRAY1> referenceEdgesFloat = applyCanny<float>(
+            inputImage0, gradXFloat, gradYFloat, gaussianSizes[ii],
+            static_cast<float>(upperThresholds[jj]),
+            static_cast<float>(lowerThresholds[jj]), 3.0f, 0.0f);
+
+          for(unsigned int numberOfBands = 1; numberOfBands < 4;
+              numberOfBands += 2) {
+            Image<GRAY1> edges = applyCannyFused<double>(
+              inputImage0, gaussianSizes[ii], upperThresholds[jj],
+              lowerThresholds[jj], 3.0, 0.0, numberOfBands);
+            Image<GRAY1> edgesFloat = applyCannyFused<float>(
+              inputImage0, gaussianSizes[ii],
+              static_cast<float>(upperThresholds[jj]),
+              static_cast<float>(lowerThresholds[jj]), 3.0f, 0.0f,
+              numberOfBands);
+            for(size_t index0 = 0; index0 < edges.size(); ++index0) {
+              BRICK_TEST_ASSERT(edges[index0] == referenceEdges[index0]);
+              BRICK_TEST_ASSERT(
+                edgesFloat[index0] == referenceEdgesFloat[index0]);
+            }
+          }
+        }
+      }
+
+      // Non-GRAY8 input without blurring goes through the floating
+      // point path.
+      Image<GRAY_FLOAT64> floatImage =
+        convertColorspace<GRAY_FLOAT64>(inputImage0);
+      brick::numeric::Array2D<double> gradX;
+      brick::numeric::Array2D<double> gradY;
+      Image<GRAY1> referenceEdges =
+        applyCanny<double>(floatImage, gradX, gradY, 0);
+      Image<GRAY1> edges = applyCannyFused<double>(floatImage, 0);
+      for(size_t index0 = 0; index0 < edges.size(); ++index0) {
+        BRICK_TEST_ASSERT(edges[index0] == referenceEdges[index0]);
+      }
+    }
+
   } // namespace computerVision
 
 } // namespace brick
@@ -0,0 +1,345 @@
+/**
+***************************************************************************
+* @file brick/computerVision/test/histogramEqualizeTest.cc
+*
+* Source file defining tests for histogram equalization routines.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <limits>
+#include <brick/computerVision/histogramEqualize.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace computerVision {
+
+    class HistogramEqualizeTest
+      : public brick::test::TestFixture<HistogramEqualizeTest> {
+
+    public:
+
+      HistogramEqualizeTest();
+      ~HistogramEqualizeTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testGetHistogram();
+      void testHistogramEqualize();
+      void testHistogramEqualizeAdaptive();
+      void testHistogramEqualizeAdaptive16();
+      void testHistogramEqualizeAdaptiveClipping();
+      void testHistogramEqualizeAdaptiveExceptions();
+
+    private:
+
+      template <ImageFormat Format>
+      numeric::Array1D<common::UInt32>
+      getBruteForceHistogram(Image<Format> const& inputImage);
+
+      template <ImageFormat Format>
+      Image<Format>
+      getRandomImage(std::size_t rows, std::size_t columns,
+                     unsigned int modulus, unsigned int offset = 0);
+
+      template <ImageFormat Format>
+      bool
+      isEqual(Image<Format> const& image0, Image<Format> const& image1);
+
+    }; // class HistogramEqualizeTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    HistogramEqualizeTest::
+    HistogramEqualizeTest()
+      : brick::test::TestFixture<HistogramEqualizeTest>("HistogramEqualizeTest")
+    {
+      BRICK_TEST_REGISTER_MEMBER(testGetHistogram);
+      BRICK_TEST_REGISTER_MEMBER(testHistogramEqualize);
+      BRICK_TEST_REGISTER_MEMBER(testHistogramEqualizeAdaptive);
+      BRICK_TEST_REGISTER_MEMBER(testHistogramEqualizeAdaptive16);
+      BRICK_TEST_REGISTER_MEMBER(testHistogramEqualizeAdaptiveClipping);
+      BRICK_TEST_REGISTER_MEMBER(testHistogramEqualizeAdaptiveExceptions);
+    }
+
+
+    void
+    HistogramEqualizeTest::
+    testGetHistogram()
+    {
+      // Odd sizes exercise the leftover pixels of each row, and a
+      // small modulus gives lots of repeated values.
+      for(unsigned int modulus = 5; modulus <= 256; modulus += 251) {
+        Image<GRAY8> inputImage =
+          this->getRandomImage<GRAY8>(37, 53, modulus);
+        numeric::Array1D<common::UInt32> histogram = getHistogram(inputImage);
+        numeric::Array1D<common::UInt32> referenceHistogram =
+          this->getBruteForceHistogram(inputImage);
+        BRICK_TEST_ASSERT(histogram.size() == 256);
+        BRICK_TEST_ASSERT(std::equal(histogram.begin(), histogram.end(),
+                                     referenceHistogram.begin()));
+      }
+
+      Image<GRAY16> inputImage16 =
+        this->getRandomImage<GRAY16>(41, 29, 65536);
+      numeric::Array1D<common::UInt32> histogram16 =
+        getHistogram(inputImage16);
+      numeric::Array1D<common::UInt32> referenceHistogram16 =
+        this->getBruteForceHistogram(inputImage16);
+      BRICK_TEST_ASSERT(histogram16.size() == 65536);
+      BRICK_TEST_ASSERT(std::equal(histogram16.begin(), histogram16.end(),
+                                   referenceHistogram16.begin()));
+    }
+
+
+    void
+    HistogramEqualizeTest::
+    testHistogramEqualize()
+    {
+      Image<GRAY8> inputImage = this->getRandomImage<GRAY8>(30, 45, 100, 50);
+      Image<GRAY8> outputImage = histogramEqualize(inputImage);
+      BRICK_TEST_ASSERT(outputImage.rows() == inputImage.rows());
+      BRICK_TEST_ASSERT(outputImage.columns() == inputImage.columns());
+
+      numeric::Array1D<common::UInt32> histogram =
+        this->getBruteForceHistogram(inputImage);
+      double scaleFactor = 256.0 / (inputImage.size() + 1);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        common::UInt32 count = 0;
+        for(std::size_t bin = 0; bin <= inputImage[ii]; ++bin) {
+          count += histogram[bin];
+        }
+        BRICK_TEST_ASSERT(
+          outputImage[ii] == static_cast<common::UInt8>(scaleFactor * count));
+      }
+    }
+
+
+    void
+    HistogramEqualizeTest::
+    testHistogramEqualizeAdaptive()
+    {
+      // With a single tile and no clipping, every pixel uses the
+      // same lookup table, which is the scaled CDF of the image.
+      Image<GRAY8> inputImage = this->getRandomImage<GRAY8>(30, 45, 100, 50);
+      Image<GRAY8> outputImage =
+        histogramEqualizeAdaptive(inputImage, 1, 1, 0.0);
+      numeric::Array1D<common::UInt32> histogram =
+        this->getBruteForceHistogram(inputImage);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        common::UInt32 count = 0;
+        for(std::size_t bin = 0; bin <= inputImage[ii]; ++bin) {
+          count += histogram[bin];
+        }
+        common::UInt8 expectedValue = static_cast<common::UInt8>(
+          (255.0 * count) / inputImage.size() + 0.5);
+        BRICK_TEST_ASSERT(outputImage[ii] == expectedValue);
+      }
+
+      // Results shouldn't depend on the number of threads.
+      Image<GRAY8> largeImage = this->getRandomImage<GRAY8>(123, 157, 256);
+      Image<GRAY8> serialImage =
+        histogramEqualizeAdaptive(largeImage, 8, 8, 2.0, 1);
+      Image<GRAY8> parallelImage =
+        histogramEqualizeAdaptive(largeImage, 8, 8, 2.0, 4);
+      BRICK_TEST_ASSERT(this->isEqual(serialImage, parallelImage));
+
+      // A dark top half and a bright bottom half should each be
+      // stretched over most of the output range.  Rows outside the
+      // tile centers see only their own tile.
+      Image<GRAY8> splitImage(40, 50);
+      Image<GRAY8> darkImage = this->getRandomImage<GRAY8>(20, 50, 16);
+      Image<GRAY8> brightImage =
+        this->getRandomImage<GRAY8>(20, 50, 16, 200);
+      std::copy(darkImage.begin(), darkImage.end(), splitImage.begin());
+      std::copy(brightImage.begin(), brightImage.end(),
+                splitImage.begin() + darkImage.size());
+      Image<GRAY8> splitResult =
+        histogramEqualizeAdaptive(splitImage, 2, 1, 0.0);
+      std::size_t const checkRows[] = {0, 39};
+      for(std::size_t ii = 0; ii < 2; ++ii) {
+        common::UInt8 const* rowBegin = splitResult.rowBegin(checkRows[ii]);
+        common::UInt8 const* rowEnd = splitResult.rowEnd(checkRows[ii]);
+        BRICK_TEST_ASSERT(*std::max_element(rowBegin, rowEnd)
+                          - *std::min_element(rowBegin, rowEnd) > 200);
+      }
+
+      // Uniformly distributed noise is already equalized, so every
+      // tile's lookup table, and any blend of them, should be close
+      // to the identity.
+      Image<GRAY8> noiseImage = this->getRandomImage<GRAY8>(128, 128, 256);
+      Image<GRAY8> noiseResult =
+        histogramEqualizeAdaptive(noiseImage, 2, 2, 0.0);
+      for(std::size_t ii = 0; ii < noiseImage.size(); ++ii) {
+        int difference = int(noiseResult[ii]) - int(noiseImage[ii]);
+        BRICK_TEST_ASSERT(difference < 12 && difference > -12);
+      }
+    }
+
+
+    void
+    HistogramEqualizeTest::
+    testHistogramEqualizeAdaptive16()
+    {
+      Image<GRAY16> inputImage =
+        this->getRandomImage<GRAY16>(35, 40, 1000, 30000);
+      Image<GRAY16> outputImage =
+        histogramEqualizeAdaptive(inputImage, 1, 1, 0.0);
+      numeric::Array1D<common::UInt32> histogram =
+        this->getBruteForceHistogram(inputImage);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        common::UInt32 count = 0;
+        for(std::size_t bin = 0; bin <= inputImage[ii]; ++bin) {
+          count += histogram[bin];
+        }
+        common::UInt16 expectedValue = static_cast<common::UInt16>(
+          (65535.0 * count) / inputImage.size() + 0.5);
+        BRICK_TEST_ASSERT(outputImage[ii] == expectedValue);
+      }
+
+      Image<GRAY16> serialImage =
+        histogramEqualizeAdaptive(inputImage, 3, 4, 40.0, 1);
+      Image<GRAY16> parallelImage =
+        histogramEqualizeAdaptive(inputImage, 3, 4, 40.0, 3);
+      BRICK_TEST_ASSERT(this->isEqual(serialImage, parallelImage));
+    }
+
+
+    void
+    HistogramEqualizeTest::
+    testHistogramEqualizeAdaptiveClipping()
+    {
+      // Without clipping, a flat image maps to white.  With
+      // clipping, most of its histogram is spread over the other
+      // bins, so the contrast gain is limited.
+      Image<GRAY8> flatImage(32, 32);
+      flatImage = common::UInt8(128);
+      Image<GRAY8> unclippedImage =
+        histogramEqualizeAdaptive(flatImage, 2, 2, 0.0);
+      Image<GRAY8> clippedImage =
+        histogramEqualizeAdaptive(flatImage, 2, 2, 2.0);
+      for(std::size_t ii = 0; ii < flatImage.size(); ++ii) {
+        BRICK_TEST_ASSERT(unclippedImage[ii] == 255);
+        BRICK_TEST_ASSERT(clippedImage[ii] > 120);
+        BRICK_TEST_ASSERT(clippedImage[ii] < 140);
+      }
+
+      // Clipping should never reverse the order of gray levels.
+      Image<GRAY8> inputImage = this->getRandomImage<GRAY8>(50, 50, 40, 100);
+      Image<GRAY8> outputImage =
+        histogramEqualizeAdaptive(inputImage, 1, 1, 1.5);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        for(std::size_t jj = 0; jj < inputImage.size(); jj += 97) {
+          if(inputImage[ii] < inputImage[jj]) {
+            BRICK_TEST_ASSERT(outputImage[ii] <= outputImage[jj]);
+          }
+        }
+      }
+    }
+
+
+    void
+    HistogramEqualizeTest::
+    testHistogramEqualizeAdaptiveExceptions()
+    {
+      Image<GRAY8> inputImage = this->getRandomImage<GRAY8>(10, 20, 256);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        histogramEqualizeAdaptive(inputImage, 0, 4));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        histogramEqualizeAdaptive(inputImage, 4, 0));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        histogramEqualizeAdaptive(inputImage, 11, 4));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        histogramEqualizeAdaptive(inputImage, 4, 21));
+
+      // One-pixel tiles are fine.
+      Image<GRAY8> outputImage = histogramEqualizeAdaptive(inputImage, 10, 20);
+      BRICK_TEST_ASSERT(outputImage.rows() == 10);
+      BRICK_TEST_ASSERT(outputImage.columns() == 20);
+    }
+
+
+    template <ImageFormat Format>
+    numeric::Array1D<common::UInt32>
+    HistogramEqualizeTest::
+    getBruteForceHistogram(Image<Format> const& inputImage)
+    {
+      typedef typename Image<Format>::PixelType PixelType;
+      numeric::Array1D<common::UInt32> histogram(
+        std::size_t(std::numeric_limits<PixelType>::max()) + 1);
+      histogram = 0;
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        ++histogram[inputImage[ii]];
+      }
+      return histogram;
+    }
+
+
+    template <ImageFormat Format>
+    Image<Format>
+    HistogramEqualizeTest::
+    getRandomImage(std::size_t rows, std::size_t columns,
+                   unsigned int modulus, unsigned int offset)
+    {
+      typedef typename Image<Format>::PixelType PixelType;
+
+      // A simple linear congruential generator keeps the test
+      // repeatable.
+      unsigned int state = 12345;
+      Image<Format> result(rows, columns);
+      for(std::size_t ii = 0; ii < result.size(); ++ii) {
+        state = state * 1103515245u + 12345u;
+        result[ii] = static_cast<PixelType>((state >> 8) % modulus + offset);
+      }
+      return result;
+    }
+
+
+    template <ImageFormat Format>
+    bool
+    HistogramEqualizeTest::
+    isEqual(Image<Format> const& image0, Image<Format> const& image1)
+    {
+      if(image0.rows() != image1.rows()
+         || image0.columns() != image1.columns()) {
+        return false;
+      }
+      return std::equal(image0.begin(), image0.end(), image1.begin());
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+#if 0
+
+int main(int /* argc */, char** /* argv */)
+{
+  brick::computerVision::HistogramEqualizeTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::computerVision::HistogramEqualizeTest currentTest;
+
+}
+
+#endif
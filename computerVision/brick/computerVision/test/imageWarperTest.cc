@@ -197,6 +197,22 @@ namespace brick {
           }
         }
       }
+
+      // Warping into a preallocated image should give the same
+      // result, and must not reallocate the output.
+      Image<GRAY_FLOAT64> preallocatedImage(outputRows, outputColumns);
+      common::Float64* dataPtr = preallocatedImage.data();
+      shiftWarper.warpImage<GRAY_FLOAT64, GRAY_FLOAT64>(
+        xImage, preallocatedImage, defaultValue);
+      BRICK_TEST_ASSERT(preallocatedImage.data() == dataPtr);
+      for(size_t ii = 0; ii < preallocatedImage.size(); ++ii) {
+        BRICK_TEST_ASSERT(preallocatedImage[ii] == shiftedXImage[ii]);
+      }
+      Image<GRAY_FLOAT64> wrongSizeImage(outputRows + 1, outputColumns);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        (shiftWarper.warpImage<GRAY_FLOAT64, GRAY_FLOAT64>(
+          xImage, wrongSizeImage, defaultValue)));
     }
 
 
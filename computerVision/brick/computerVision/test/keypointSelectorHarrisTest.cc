@@ -43,6 +43,10 @@ namespace brick {
 
       // Tests.
       void testKeypointSelectorHarris();
+      void testGetKeypointsBucketed();
+      void testSetImageSmall();
+      void testSetNumberOfThreads();
+      void testSetResponseType();
 
       // Legacy functions.
       void exerciseKeypointSelectorHarris(std::string const& fileName,
@@ -50,6 +54,9 @@ namespace brick {
 
     private:
 
+      Image<GRAY8>
+      getCheckerboardImage(std::size_t rows, std::size_t columns);
+
       double m_defaultTolerance;
 
     }; // class KeypointSelectorHarrisTest
@@ -63,6 +70,10 @@ namespace brick {
         m_defaultTolerance(1.0E-8)
     {
       BRICK_TEST_REGISTER_MEMBER(testKeypointSelectorHarris);
+      BRICK_TEST_REGISTER_MEMBER(testGetKeypointsBucketed);
+      BRICK_TEST_REGISTER_MEMBER(testSetImageSmall);
+      BRICK_TEST_REGISTER_MEMBER(testSetNumberOfThreads);
+      BRICK_TEST_REGISTER_MEMBER(testSetResponseType);
     }
 
 
@@ -121,6 +132,195 @@ namespace brick {
     }
 
 
+    void
+    KeypointSelectorHarrisTest::
+    testGetKeypointsBucketed()
+    {
+      Image<GRAY8> inputImage = this->getCheckerboardImage(240, 320);
+      KeypointSelectorHarris<double> selector;
+      selector.setImage(inputImage);
+
+      // With a single cell and no limit to speak of, we should get
+      // exactly the keypoints returned by getKeypoints(), strongest
+      // first.
+      std::vector< KeypointHarris<common::Int32> > allKeypoints =
+        selector.getKeypoints();
+      std::vector< KeypointHarris<common::Int32> > keypoints;
+      selector.getKeypointsBucketed(
+        std::back_inserter(keypoints), allKeypoints.size() + 10);
+      BRICK_TEST_ASSERT(keypoints.size() == allKeypoints.size());
+      for(std::size_t ii = 1; ii < keypoints.size(); ++ii) {
+        BRICK_TEST_ASSERT(keypoints[ii - 1].value >= keypoints[ii].value);
+      }
+      for(std::size_t ii = 0; ii < allKeypoints.size(); ++ii) {
+        bool isFound = false;
+        for(std::size_t jj = 0; jj < keypoints.size(); ++jj) {
+          if(keypoints[jj].row == allKeypoints[ii].row
+             && keypoints[jj].column == allKeypoints[ii].column) {
+            isFound = true;
+          }
+        }
+        BRICK_TEST_ASSERT(isFound);
+      }
+
+      // Limiting the number of keypoints should keep the strongest.
+      std::size_t const maxKeypoints = 12;
+      std::vector< KeypointHarris<common::Int32> > bestKeypoints;
+      selector.getKeypointsBucketed(
+        std::back_inserter(bestKeypoints), maxKeypoints);
+      BRICK_TEST_ASSERT(bestKeypoints.size() == maxKeypoints);
+      for(std::size_t ii = 0; ii < maxKeypoints; ++ii) {
+        BRICK_TEST_ASSERT(bestKeypoints[ii].row == keypoints[ii].row);
+        BRICK_TEST_ASSERT(bestKeypoints[ii].column == keypoints[ii].column);
+      }
+
+      // With a grid, each cell gets its share.  The search region
+      // starts 8 pixels in from each edge of the image.
+      std::size_t const gridRows = 2;
+      std::size_t const gridColumns = 3;
+      std::vector< KeypointHarris<common::Int32> > bucketedKeypoints;
+      selector.getKeypointsBucketed(
+        std::back_inserter(bucketedKeypoints), maxKeypoints,
+        gridRows, gridColumns);
+      BRICK_TEST_ASSERT(bucketedKeypoints.size() == maxKeypoints);
+      std::vector<std::size_t> counts(gridRows * gridColumns, 0);
+      for(std::size_t ii = 0; ii < bucketedKeypoints.size(); ++ii) {
+        std::size_t cellRow =
+          ((bucketedKeypoints[ii].row - 8) * gridRows) / (240 - 16);
+        std::size_t cellColumn =
+          ((bucketedKeypoints[ii].column - 8) * gridColumns) / (320 - 16);
+        ++(counts[cellRow * gridColumns + cellColumn]);
+      }
+      for(std::size_t ii = 0; ii < counts.size(); ++ii) {
+        BRICK_TEST_ASSERT(counts[ii] == maxKeypoints / counts.size());
+      }
+
+      // Thresholding.  Integer keypoint values are truncated, hence
+      // the offset.
+      double const threshold = keypoints[maxKeypoints].value + 1.0;
+      std::vector< KeypointHarris<common::Int32> > strongKeypoints;
+      selector.getKeypointsBucketed(
+        std::back_inserter(strongKeypoints), keypoints.size(),
+        1, 1, threshold);
+      BRICK_TEST_ASSERT(strongKeypoints.size() <= maxKeypoints);
+      for(std::size_t ii = 0; ii < strongKeypoints.size(); ++ii) {
+        BRICK_TEST_ASSERT(strongKeypoints[ii].value >= threshold);
+      }
+
+      // The subpixel version should agree with the integer version,
+      // to within a pixel.
+      std::vector< KeypointHarris<double> > keypointsGP;
+      selector.getKeypointsGeneralPositionBucketed(
+        std::back_inserter(keypointsGP), maxKeypoints,
+        gridRows, gridColumns);
+      BRICK_TEST_ASSERT(keypointsGP.size() <= maxKeypoints);
+      BRICK_TEST_ASSERT(!keypointsGP.empty());
+      for(std::size_t ii = 0; ii < keypointsGP.size(); ++ii) {
+        bool isFound = false;
+        for(std::size_t jj = 0; jj < bucketedKeypoints.size(); ++jj) {
+          if(brick::test::approximatelyEqual(
+               keypointsGP[ii].row, double(bucketedKeypoints[jj].row), 1.0)
+             && brick::test::approximatelyEqual(
+               keypointsGP[ii].column,
+               double(bucketedKeypoints[jj].column), 1.0)) {
+            isFound = true;
+          }
+        }
+        BRICK_TEST_ASSERT(isFound);
+      }
+
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        selector.getKeypointsBucketed(
+          std::back_inserter(keypoints), maxKeypoints, 0, 1));
+    }
+
+
+    void
+    KeypointSelectorHarrisTest::
+    testSetImageSmall()
+    {
+      // Images too small to have any valid pixels should simply
+      // produce no keypoints.
+      for(std::size_t size = 1; size < 20; size += 3) {
+        Image<GRAY8> inputImage(size, size + 2);
+        inputImage = common::UInt8(0);
+        inputImage(size / 2, size / 2) = common::UInt8(255);
+        KeypointSelectorHarris<double> selector;
+        selector.setImage(inputImage);
+        std::vector< KeypointHarris<common::Int32> > keypoints =
+          selector.getKeypoints();
+        std::vector< KeypointHarris<double> > keypointsGP =
+          selector.getKeypointsGeneralPosition();
+        selector.getKeypointsBucketed(std::back_inserter(keypoints), 10);
+        BRICK_TEST_ASSERT(size > 16 || keypoints.empty());
+        BRICK_TEST_ASSERT(size > 16 || keypointsGP.empty());
+      }
+    }
+
+
+    void
+    KeypointSelectorHarrisTest::
+    testSetNumberOfThreads()
+    {
+      // Results should not depend on how the image is split into
+      // strips.
+      Image<GRAY8> inputImage = this->getCheckerboardImage(333, 150);
+      KeypointSelectorHarris<double> referenceSelector;
+      referenceSelector.setNumberOfThreads(1);
+      referenceSelector.setImage(inputImage);
+      std::vector< KeypointHarris<common::Int32> > referenceKeypoints =
+        referenceSelector.getKeypoints();
+      BRICK_TEST_ASSERT(!referenceKeypoints.empty());
+
+      for(std::size_t numberOfThreads = 0; numberOfThreads < 6;
+          ++numberOfThreads) {
+        KeypointSelectorHarris<double> selector;
+        selector.setNumberOfThreads(numberOfThreads);
+        selector.setImage(inputImage);
+        std::vector< KeypointHarris<common::Int32> > keypoints =
+          selector.getKeypoints();
+        BRICK_TEST_ASSERT(keypoints.size() == referenceKeypoints.size());
+        for(std::size_t ii = 0; ii < keypoints.size(); ++ii) {
+          BRICK_TEST_ASSERT(keypoints[ii].row == referenceKeypoints[ii].row);
+          BRICK_TEST_ASSERT(
+            keypoints[ii].column == referenceKeypoints[ii].column);
+          BRICK_TEST_ASSERT(
+            keypoints[ii].value == referenceKeypoints[ii].value);
+        }
+      }
+    }
+
+
+    void
+    KeypointSelectorHarrisTest::
+    testSetResponseType()
+    {
+      // Same image as testKeypointSelectorHarris().
+      Image<GRAY8> inputImage(100, 120);
+      inputImage = brick::common::UInt8(60);
+      inputImage.getROI(numeric::Index2D(20, 30), numeric::Index2D(60, 70)) =
+        common::UInt8(128);
+
+      // The Shi-Tomasi response should find the same four corners,
+      // and nothing else.
+      KeypointSelectorHarris<double> selector;
+      selector.setResponseType(BRICK_SHI_TOMASI_RESPONSE);
+      selector.setImage(inputImage);
+      std::vector< KeypointHarris<int> > keypoints = selector.getKeypoints();
+      BRICK_TEST_ASSERT(keypoints.size() == 4);
+      for(std::size_t ii = 0; ii < keypoints.size(); ++ii) {
+        int const cornerRow = (keypoints[ii].row < 40) ? 20 : 60;
+        int const cornerColumn = (keypoints[ii].column < 50) ? 30 : 70;
+        BRICK_TEST_ASSERT(
+          common::absoluteValue(keypoints[ii].row - cornerRow) <= 3);
+        BRICK_TEST_ASSERT(
+          common::absoluteValue(keypoints[ii].column - cornerColumn) <= 3);
+        BRICK_TEST_ASSERT(keypoints[ii].value > 0);
+      }
+    }
+
+
     void
     KeypointSelectorHarrisTest::
     exerciseKeypointSelectorHarris(std::string const& fileName,
@@ -186,6 +386,29 @@ namespace brick {
                inputImage.rows(), inputImage.columns(), false);
     }
 
+
+    Image<GRAY8>
+    KeypointSelectorHarrisTest::
+    getCheckerboardImage(std::size_t rows, std::size_t columns)
+    {
+      // Checkerboard squares of varying brightness, so that corner
+      // strengths differ, plus a little noise to break ties.
+      Image<GRAY8> inputImage(rows, columns);
+      common::UInt32 state = 1;
+      for(std::size_t row = 0; row < rows; ++row) {
+        for(std::size_t column = 0; column < columns; ++column) {
+          std::size_t const squareRow = row / 23;
+          std::size_t const squareColumn = column / 29;
+          state = state * 1103515245u + 12345u;
+          int value = ((squareRow + squareColumn) % 2 == 0) ? 40 : 180;
+          value += int((squareRow * 7 + squareColumn * 13) % 40);
+          value += int((state >> 16) % 5);
+          inputImage(row, column) = common::UInt8(value);
+        }
+      }
+      return inputImage;
+    }
+
   } // namespace computerVision
 
 } // namespace brick
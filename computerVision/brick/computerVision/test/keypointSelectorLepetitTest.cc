@@ -12,6 +12,7 @@
 
 #include <brick/computerVision/imageIO.hh>
 #include <brick/computerVision/keypointSelectorLepetit.hh>
+#include <brick/computerVision/utilities.hh>
 #include <brick/computerVision/test/testImages.hh>
 #include <brick/test/testFixture.hh>
 
@@ -36,9 +37,33 @@ namespace brick {
 
       // Tests.
       void testKeypointSelectorLepetit();
+      void testSetImagePyramid();
+      void testSetImagePyramidGray8();
+      void testSetNumberOfThreads();
 
     private:
 
+      // Straightforward per-pixel search, against which the
+      // row-at-a-time implementation is checked.
+      template <ImageFormat Format, ImageFormat InternalFormat>
+      void
+      findKeypointsReference(
+        ImagePyramid<Format, InternalFormat, common::Float32>& pyramid,
+        float pixelSimilarityThreshold,
+        float laplacianMagnitudeThreshold,
+        std::vector<numeric::Index2D>& keypoints,
+        std::vector<unsigned int>& levels);
+
+      bool
+      testPixelReference(unsigned int row, unsigned int column,
+                         Image<GRAY_FLOAT32> const& image,
+                         float pixelSimilarityThreshold,
+                         float laplacianMagnitudeThreshold);
+
+      bool
+      isEqual(std::vector<numeric::Index2D> const& keypoints0,
+              std::vector<numeric::Index2D> const& keypoints1);
+
       double m_defaultTolerance;
 
     }; // class KeypointSelectorLepetitTest
@@ -52,6 +77,9 @@ namespace brick {
         m_defaultTolerance(1.0E-8)
     {
       BRICK_TEST_REGISTER_MEMBER(testKeypointSelectorLepetit);
+      BRICK_TEST_REGISTER_MEMBER(testSetImagePyramid);
+      BRICK_TEST_REGISTER_MEMBER(testSetImagePyramidGray8);
+      BRICK_TEST_REGISTER_MEMBER(testSetNumberOfThreads);
     }
 
 
@@ -74,6 +102,9 @@ namespace brick {
                 << selector.getLaplacianMagnitudeThreshold() << std::endl;
 
       std::vector<brick::numeric::Index2D> keyPoints = selector.getKeypoints();
+      BRICK_TEST_ASSERT(!keyPoints.empty());
+      BRICK_TEST_ASSERT(
+        selector.getKeypointLevels().size() == keyPoints.size());
       for(unsigned int ii = 0; ii < keyPoints.size(); ++ii) {
         brick::numeric::Index2D keyPoint = keyPoints[ii];
         inputImage(keyPoint.getRow() - 2, keyPoint.getColumn() - 1) = 255;
@@ -94,6 +125,215 @@ namespace brick {
                inputImage.rows(), inputImage.columns(), false);
     }
 
+
+    void
+    KeypointSelectorLepetitTest::
+    testSetImagePyramid()
+    {
+      Image<GRAY8> inputImage = readPGM8(getTestImageFileNamePGM0());
+      Image<GRAY_FLOAT32> floatImage =
+        convertColorspace<GRAY_FLOAT32>(inputImage);
+      ImagePyramid<GRAY_FLOAT32, GRAY_FLOAT32, common::Float32> pyramid(
+        floatImage, 2.0, 4, false);
+
+      // Searching a shared pyramid should give the same answer as
+      // letting the selector build its own.
+      KeypointSelectorLepetit selector;
+      selector.setImage(inputImage);
+      KeypointSelectorLepetit pyramidSelector;
+      pyramidSelector.setImagePyramid(pyramid);
+      BRICK_TEST_ASSERT(
+        this->isEqual(selector.getKeypoints(),
+                      pyramidSelector.getKeypoints()));
+      BRICK_TEST_ASSERT(selector.getKeypointLevels()
+                        == pyramidSelector.getKeypointLevels());
+
+      // ...which should match a pixel-by-pixel search exactly.
+      std::vector<numeric::Index2D> referenceKeypoints;
+      std::vector<unsigned int> referenceLevels;
+      this->findKeypointsReference(
+        pyramid, selector.getPixelSimilarityThreshold(),
+        selector.getLaplacianMagnitudeThreshold(),
+        referenceKeypoints, referenceLevels);
+      BRICK_TEST_ASSERT(!referenceKeypoints.empty());
+      BRICK_TEST_ASSERT(
+        this->isEqual(referenceKeypoints, selector.getKeypoints()));
+      BRICK_TEST_ASSERT(referenceLevels == selector.getKeypointLevels());
+
+      // Searching all four levels should add some keypoints from
+      // level 3.
+      pyramidSelector.setImagePyramid(pyramid, 0);
+      std::vector<unsigned int> allLevels =
+        pyramidSelector.getKeypointLevels();
+      BRICK_TEST_ASSERT(allLevels.size() > referenceLevels.size());
+      BRICK_TEST_ASSERT(allLevels.back() == 3);
+    }
+
+
+    void
+    KeypointSelectorLepetitTest::
+    testSetImagePyramidGray8()
+    {
+      // A GRAY8 pyramid, as might be shared with KeypointSelectorFast
+      // or KeypointSelectorHarris, is searched in integer
+      // arithmetic.  The result should match a floating point search
+      // of the same levels.
+      Image<GRAY8> inputImage = readPGM8(getTestImageFileNamePGM0());
+      ImagePyramid<GRAY8, GRAY8, common::Float32> pyramid(
+        inputImage, 2.0, 3, false);
+      KeypointSelectorLepetit selector;
+      selector.setImagePyramid(pyramid);
+
+      std::vector<numeric::Index2D> referenceKeypoints;
+      std::vector<unsigned int> referenceLevels;
+      this->findKeypointsReference(
+        pyramid, selector.getPixelSimilarityThreshold(),
+        selector.getLaplacianMagnitudeThreshold(),
+        referenceKeypoints, referenceLevels);
+      BRICK_TEST_ASSERT(!referenceKeypoints.empty());
+      BRICK_TEST_ASSERT(
+        this->isEqual(referenceKeypoints, selector.getKeypoints()));
+      BRICK_TEST_ASSERT(referenceLevels == selector.getKeypointLevels());
+
+      // At level 0, the GRAY8 pyramid holds the same pixel values as
+      // a floating point one, so thresholds and keypoints should
+      // agree.
+      ImagePyramid<GRAY_FLOAT32, GRAY_FLOAT32, common::Float32> floatPyramid(
+        convertColorspace<GRAY_FLOAT32>(inputImage), 2.0, 1, false);
+      KeypointSelectorLepetit floatSelector;
+      floatSelector.setImagePyramid(floatPyramid, 1);
+      selector.setImagePyramid(pyramid, 1);
+      BRICK_TEST_ASSERT(selector.getPixelSimilarityThreshold()
+                        == floatSelector.getPixelSimilarityThreshold());
+      BRICK_TEST_ASSERT(selector.getLaplacianMagnitudeThreshold()
+                        == floatSelector.getLaplacianMagnitudeThreshold());
+      BRICK_TEST_ASSERT(
+        this->isEqual(selector.getKeypoints(), floatSelector.getKeypoints()));
+    }
+
+
+    void
+    KeypointSelectorLepetitTest::
+    testSetNumberOfThreads()
+    {
+      Image<GRAY8> inputImage = readPGM8(getTestImageFileNamePGM0());
+      KeypointSelectorLepetit referenceSelector;
+      referenceSelector.setNumberOfThreads(1);
+      referenceSelector.setImage(inputImage);
+
+      for(std::size_t numberOfThreads = 0; numberOfThreads < 5;
+          ++numberOfThreads) {
+        KeypointSelectorLepetit selector;
+        selector.setNumberOfThreads(numberOfThreads);
+
+        // Calling setImage() twice should not accumulate keypoints.
+        selector.setImage(inputImage);
+        selector.setImage(inputImage);
+        BRICK_TEST_ASSERT(
+          this->isEqual(selector.getKeypoints(),
+                        referenceSelector.getKeypoints()));
+        BRICK_TEST_ASSERT(selector.getKeypointLevels()
+                          == referenceSelector.getKeypointLevels());
+      }
+    }
+
+
+    template <ImageFormat Format, ImageFormat InternalFormat>
+    void
+    KeypointSelectorLepetitTest::
+    findKeypointsReference(
+      ImagePyramid<Format, InternalFormat, common::Float32>& pyramid,
+      float pixelSimilarityThreshold,
+      float laplacianMagnitudeThreshold,
+      std::vector<numeric::Index2D>& keypoints,
+      std::vector<unsigned int>& levels)
+    {
+      keypoints.clear();
+      levels.clear();
+      unsigned int const numberOfLevels =
+        std::min(pyramid.getNumberOfLevels(), 3u);
+      for(unsigned int level = 0; level < numberOfLevels; ++level) {
+        Image<GRAY_FLOAT32> currentLevel =
+          convertColorspace<GRAY_FLOAT32>(pyramid.getLevel(level));
+        unsigned int startRow = pyramid.getBorderSizeTopBottom() + 1;
+        unsigned int stopRow = (currentLevel.rows()
+                                - pyramid.getBorderSizeTopBottom() - 1);
+        unsigned int startColumn = pyramid.getBorderSizeLeftRight() + 1;
+        unsigned int stopColumn = (currentLevel.columns()
+                                   - pyramid.getBorderSizeLeftRight() - 1);
+        for(unsigned int row = startRow; row < stopRow; ++row) {
+          for(unsigned int column = startColumn; column < stopColumn;
+              ++column) {
+            if(this->testPixelReference(
+                 row, column, currentLevel, pixelSimilarityThreshold,
+                 laplacianMagnitudeThreshold)) {
+              keypoints.push_back(
+                pyramid.convertImageCoordinates(
+                  numeric::Index2D(row, column), level, 0));
+              levels.push_back(level);
+            }
+          }
+        }
+      }
+    }
+
+
+    bool
+    KeypointSelectorLepetitTest::
+    testPixelReference(unsigned int row, unsigned int column,
+                       Image<GRAY_FLOAT32> const& image,
+                       float pixelSimilarityThreshold,
+                       float laplacianMagnitudeThreshold)
+    {
+      // Offsets of diametrically opposed pairs on the Bresenham
+      // circle of radius 3.
+      int const pairs[8][4] = {
+        {0, -3, 0, 3}, {-3, 0, 3, 0}, {2, 2, -2, -2}, {-2, 2, 2, -2},
+        {1, 3, -1, -3}, {-3, 1, 3, -1}, {3, 1, -3, -1}, {-1, 3, 1, -3}
+      };
+      float testValue = image(row, column);
+      for(unsigned int ii = 0; ii < 8; ++ii) {
+        if((common::absoluteValue(
+              testValue - image(row + pairs[ii][0], column + pairs[ii][1]))
+            < pixelSimilarityThreshold)
+           && (common::absoluteValue(
+                 testValue - image(row + pairs[ii][2], column + pairs[ii][3]))
+               < pixelSimilarityThreshold)) {
+          return false;
+        }
+      }
+      float averageBorderValue = (
+        image(row - 3, column - 1) + image(row - 3, column)
+        + image(row - 3, column + 1)
+        + image(row - 2, column - 2) + image(row - 2, column + 2)
+        + image(row - 1, column - 3) + image(row - 1, column + 3)
+        + image(row, column - 3) + image(row, column + 3)
+        + image(row + 1, column - 3) + image(row + 1, column + 3)
+        + image(row + 2, column - 2) + image(row + 2, column + 2)
+        + image(row + 3, column - 1) + image(row + 3, column)
+        + image(row + 3, column + 1)) / 16.0;
+      return (common::absoluteValue(testValue - averageBorderValue)
+              > laplacianMagnitudeThreshold);
+    }
+
+
+    bool
+    KeypointSelectorLepetitTest::
+    isEqual(std::vector<numeric::Index2D> const& keypoints0,
+            std::vector<numeric::Index2D> const& keypoints1)
+    {
+      if(keypoints0.size() != keypoints1.size()) {
+        return false;
+      }
+      for(std::size_t ii = 0; ii < keypoints0.size(); ++ii) {
+        if(keypoints0[ii].getRow() != keypoints1[ii].getRow()
+           || keypoints0[ii].getColumn() != keypoints1[ii].getColumn()) {
+          return false;
+        }
+      }
+      return true;
+    }
+
   } // namespace computerVision
 
 } // namespace brick
@@ -0,0 +1,348 @@
+/**
+***************************************************************************
+* @file brick/computerVision/test/morphologyFilterTest.cc
+*
+* Source file defining tests for the MorphologyFilter class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <brick/computerVision/test/testImages.hh>
+#include <brick/computerVision/dilate.hh>
+#include <brick/computerVision/erode.hh>
+#include <brick/computerVision/imageIO.hh>
+#include <brick/computerVision/morphologyFilter.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace computerVision {
+
+    class MorphologyFilterTest
+      : public brick::test::TestFixture<MorphologyFilterTest> {
+
+    public:
+
+      MorphologyFilterTest();
+      ~MorphologyFilterTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testBinary();
+      void testCompositeOperations();
+      void testDilateErode();
+      void testMatchesDilateErode();
+
+    private:
+
+      template <ImageFormat Format>
+      Image<Format>
+      getBruteForceResult(Image<Format> const& inputImage,
+                          std::size_t windowWidth, std::size_t windowHeight,
+                          bool isDilate);
+
+      template <ImageFormat Format>
+      Image<Format>
+      getRandomImage(std::size_t rows, std::size_t columns,
+                     unsigned int modulus);
+
+      template <ImageFormat Format>
+      bool
+      isEqual(Image<Format> const& image0, Image<Format> const& image1);
+
+    }; // class MorphologyFilterTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    MorphologyFilterTest::
+    MorphologyFilterTest()
+      : brick::test::TestFixture<MorphologyFilterTest>("MorphologyFilterTest")
+    {
+      BRICK_TEST_REGISTER_MEMBER(testBinary);
+      BRICK_TEST_REGISTER_MEMBER(testCompositeOperations);
+      BRICK_TEST_REGISTER_MEMBER(testDilateErode);
+      BRICK_TEST_REGISTER_MEMBER(testMatchesDilateErode);
+    }
+
+
+    void
+    MorphologyFilterTest::
+    testBinary()
+    {
+      // Use more than two words per row, with a partial last word,
+      // so that shifts cross word boundaries.
+      Image<GRAY1> inputImage = this->getRandomImage<GRAY1>(37, 150, 7);
+      std::size_t const windowSizes[][2] = {
+        {1, 1}, {3, 3}, {5, 1}, {1, 9}, {31, 31}, {65, 5}, {129, 3},
+        {301, 81}
+      };
+      std::size_t const numberOfSizes =
+        sizeof(windowSizes) / sizeof(windowSizes[0]);
+      for(std::size_t ii = 0; ii < numberOfSizes; ++ii) {
+        MorphologyFilter<GRAY1> filter(windowSizes[ii][0], windowSizes[ii][1]);
+        BRICK_TEST_ASSERT(
+          this->isEqual(filter.dilate(inputImage),
+                        this->getBruteForceResult(
+                          inputImage, windowSizes[ii][0], windowSizes[ii][1],
+                          true)));
+        BRICK_TEST_ASSERT(
+          this->isEqual(filter.erode(inputImage),
+                        this->getBruteForceResult(
+                          inputImage, windowSizes[ii][0], windowSizes[ii][1],
+                          false)));
+      }
+
+      // A row exactly one word wide.
+      Image<GRAY1> narrowImage = this->getRandomImage<GRAY1>(20, 64, 5);
+      MorphologyFilter<GRAY1> filter(7, 7);
+      BRICK_TEST_ASSERT(
+        this->isEqual(filter.dilate(narrowImage),
+                      this->getBruteForceResult(narrowImage, 7, 7, true)));
+      BRICK_TEST_ASSERT(
+        this->isEqual(filter.erode(narrowImage),
+                      this->getBruteForceResult(narrowImage, 7, 7, false)));
+    }
+
+
+    void
+    MorphologyFilterTest::
+    testCompositeOperations()
+    {
+      Image<GRAY8> inputImage = this->getRandomImage<GRAY8>(40, 53, 256);
+      MorphologyFilter<GRAY8> filter(5, 9);
+      Image<GRAY8> dilatedImage = filter.dilate(inputImage);
+      Image<GRAY8> erodedImage = filter.erode(inputImage);
+      Image<GRAY8> openedImage = filter.dilate(erodedImage);
+      Image<GRAY8> closedImage = filter.erode(dilatedImage);
+
+      BRICK_TEST_ASSERT(this->isEqual(filter.open(inputImage), openedImage));
+      BRICK_TEST_ASSERT(this->isEqual(filter.close(inputImage), closedImage));
+
+      Image<GRAY8> topHatImage = filter.topHat(inputImage);
+      Image<GRAY8> bottomHatImage = filter.bottomHat(inputImage);
+      Image<GRAY8> gradientImage = filter.gradient(inputImage);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        BRICK_TEST_ASSERT(openedImage[ii] <= inputImage[ii]);
+        BRICK_TEST_ASSERT(closedImage[ii] >= inputImage[ii]);
+        BRICK_TEST_ASSERT(topHatImage[ii] == inputImage[ii] - openedImage[ii]);
+        BRICK_TEST_ASSERT(
+          bottomHatImage[ii] == closedImage[ii] - inputImage[ii]);
+        BRICK_TEST_ASSERT(
+          gradientImage[ii] == dilatedImage[ii] - erodedImage[ii]);
+      }
+
+      // Binary versions use logical operations.
+      Image<GRAY1> binaryImage = this->getRandomImage<GRAY1>(40, 70, 3);
+      MorphologyFilter<GRAY1> binaryFilter(3, 5);
+      Image<GRAY1> binaryDilated = binaryFilter.dilate(binaryImage);
+      Image<GRAY1> binaryEroded = binaryFilter.erode(binaryImage);
+      Image<GRAY1> binaryOpened = binaryFilter.open(binaryImage);
+      Image<GRAY1> binaryClosed = binaryFilter.close(binaryImage);
+      BRICK_TEST_ASSERT(
+        this->isEqual(binaryOpened, binaryFilter.dilate(binaryEroded)));
+      BRICK_TEST_ASSERT(
+        this->isEqual(binaryClosed, binaryFilter.erode(binaryDilated)));
+
+      Image<GRAY1> binaryTopHat = binaryFilter.topHat(binaryImage);
+      Image<GRAY1> binaryBottomHat = binaryFilter.bottomHat(binaryImage);
+      Image<GRAY1> binaryGradient = binaryFilter.gradient(binaryImage);
+      for(std::size_t ii = 0; ii < binaryImage.size(); ++ii) {
+        BRICK_TEST_ASSERT(
+          binaryTopHat[ii] == (binaryImage[ii] && !binaryOpened[ii]));
+        BRICK_TEST_ASSERT(
+          binaryBottomHat[ii] == (binaryClosed[ii] && !binaryImage[ii]));
+        BRICK_TEST_ASSERT(
+          binaryGradient[ii] == (binaryDilated[ii] && !binaryEroded[ii]));
+      }
+    }
+
+
+    void
+    MorphologyFilterTest::
+    testDilateErode()
+    {
+      Image<GRAY8> inputImage = this->getRandomImage<GRAY8>(45, 61, 256);
+      std::size_t const windowSizes[][2] = {
+        {1, 1}, {3, 3}, {4, 6}, {7, 1}, {1, 11}, {31, 31}, {99, 3}
+      };
+      std::size_t const numberOfSizes =
+        sizeof(windowSizes) / sizeof(windowSizes[0]);
+      for(std::size_t ii = 0; ii < numberOfSizes; ++ii) {
+        MorphologyFilter<GRAY8> filter(windowSizes[ii][0], windowSizes[ii][1]);
+        BRICK_TEST_ASSERT(filter.getWindowWidth() % 2 == 1);
+        BRICK_TEST_ASSERT(filter.getWindowHeight() % 2 == 1);
+        BRICK_TEST_ASSERT(
+          this->isEqual(filter.dilate(inputImage),
+                        this->getBruteForceResult(
+                          inputImage, windowSizes[ii][0], windowSizes[ii][1],
+                          true)));
+        BRICK_TEST_ASSERT(
+          this->isEqual(filter.erode(inputImage),
+                        this->getBruteForceResult(
+                          inputImage, windowSizes[ii][0], windowSizes[ii][1],
+                          false)));
+      }
+
+      // Floating point images, and an input image that is a region
+      // of a larger image.
+      Image<GRAY_FLOAT32> floatImage =
+        this->getRandomImage<GRAY_FLOAT32>(50, 40, 1000);
+      Image<GRAY_FLOAT32> floatRegion = floatImage.getRegion(
+        brick::numeric::Index2D(5, 7), brick::numeric::Index2D(45, 33));
+      MorphologyFilter<GRAY_FLOAT32> floatFilter(9, 5);
+      BRICK_TEST_ASSERT(
+        this->isEqual(floatFilter.dilate(floatRegion),
+                      this->getBruteForceResult(floatRegion, 9, 5, true)));
+      BRICK_TEST_ASSERT(
+        this->isEqual(floatFilter.erode(floatRegion),
+                      this->getBruteForceResult(floatRegion, 9, 5, false)));
+    }
+
+
+    void
+    MorphologyFilterTest::
+    testMatchesDilateErode()
+    {
+      Image<GRAY8> inputImage = readPGM8(getDilateErodeFileNamePGM0());
+      MorphologyFilter<GRAY8> filter(3, 3);
+
+      // The hardcoded routines return 0 or 1, while MorphologyFilter
+      // returns pixel values from the input image.
+      Image<GRAY8> referenceImage = dilate<GRAY8>(inputImage);
+      Image<GRAY8> dilatedImage = filter.dilate(inputImage);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        BRICK_TEST_ASSERT((dilatedImage[ii] != 0) == (referenceImage[ii] != 0));
+      }
+
+      // The hardcoded erode() sets border pixels to zero, rather than
+      // ignoring pixels outside the image, so compare only the
+      // interior.
+      referenceImage = erode<GRAY8>(inputImage);
+      Image<GRAY8> erodedImage = filter.erode(inputImage);
+      for(std::size_t row = 1; row < inputImage.rows() - 1; ++row) {
+        for(std::size_t column = 1; column < inputImage.columns() - 1;
+            ++column) {
+          BRICK_TEST_ASSERT((erodedImage(row, column) != 0)
+                            == (referenceImage(row, column) != 0));
+        }
+      }
+
+      // Larger windows should match dilateUsingBoxIntegrator().
+      filter.setWindowSize(7, 5);
+      referenceImage = dilateUsingBoxIntegrator<GRAY8>(inputImage, 7, 5);
+      dilatedImage = filter.dilate(inputImage);
+      for(std::size_t ii = 0; ii < inputImage.size(); ++ii) {
+        BRICK_TEST_ASSERT((dilatedImage[ii] != 0) == (referenceImage[ii] != 0));
+      }
+    }
+
+
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilterTest::
+    getBruteForceResult(Image<Format> const& inputImage,
+                        std::size_t windowWidth, std::size_t windowHeight,
+                        bool isDilate)
+    {
+      int const radiusW = static_cast<int>(windowWidth / 2);
+      int const radiusH = static_cast<int>(windowHeight / 2);
+      int const rows = static_cast<int>(inputImage.rows());
+      int const columns = static_cast<int>(inputImage.columns());
+      Image<Format> outputImage(inputImage.rows(), inputImage.columns());
+      for(int row = 0; row < rows; ++row) {
+        for(int column = 0; column < columns; ++column) {
+          typename Image<Format>::PixelType result = inputImage(row, column);
+          for(int rr = std::max(row - radiusH, 0);
+              rr <= std::min(row + radiusH, rows - 1); ++rr) {
+            for(int cc = std::max(column - radiusW, 0);
+                cc <= std::min(column + radiusW, columns - 1); ++cc) {
+              if(isDilate) {
+                result = std::max(result, inputImage(rr, cc));
+              } else {
+                result = std::min(result, inputImage(rr, cc));
+              }
+            }
+          }
+          outputImage(row, column) = result;
+        }
+      }
+      return outputImage;
+    }
+
+
+    template <ImageFormat Format>
+    Image<Format>
+    MorphologyFilterTest::
+    getRandomImage(std::size_t rows, std::size_t columns,
+                   unsigned int modulus)
+    {
+      typedef typename Image<Format>::PixelType PixelType;
+
+      // A simple linear congruential generator keeps the test
+      // repeatable.
+      unsigned int state = 12345;
+      Image<Format> result(rows, columns);
+      for(std::size_t ii = 0; ii < result.size(); ++ii) {
+        state = state * 1103515245u + 12345u;
+        unsigned int value = (state >> 16) % modulus;
+        if(Format == GRAY1) {
+          // Mostly background, with some foreground.
+          result[ii] = static_cast<PixelType>(value == 0);
+        } else {
+          result[ii] = static_cast<PixelType>(value);
+        }
+      }
+      return result;
+    }
+
+
+    template <ImageFormat Format>
+    bool
+    MorphologyFilterTest::
+    isEqual(Image<Format> const& image0, Image<Format> const& image1)
+    {
+      if(image0.rows() != image1.rows()
+         || image0.columns() != image1.columns()) {
+        return false;
+      }
+      for(std::size_t row = 0; row < image0.rows(); ++row) {
+        for(std::size_t column = 0; column < image0.columns(); ++column) {
+          if(image0(row, column) != image1(row, column)) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::computerVision::MorphologyFilterTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::computerVision::MorphologyFilterTest currentTest;
+
+}
+
+#endif
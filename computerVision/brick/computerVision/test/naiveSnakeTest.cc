@@ -10,6 +10,7 @@
 ***************************************************************************
 **/
 
+#include <cmath>
 #include <brick/computerVision/naiveSnake.hh>
 #include <brick/numeric/subArray2D.hh>
 #include <brick/test/testFixture.hh>
@@ -37,6 +38,8 @@ namespace brick {
 
       // Tests.
       void testExternalForce();
+      void testRunSnakes();
+      void testShortSnake();
       void testStretchingAndBendingForces();
 
     private:
@@ -72,6 +75,8 @@ namespace brick {
         m_verbose(false)
     {
       BRICK_TEST_REGISTER_MEMBER(testExternalForce);
+      BRICK_TEST_REGISTER_MEMBER(testRunSnakes);
+      BRICK_TEST_REGISTER_MEMBER(testShortSnake);
       BRICK_TEST_REGISTER_MEMBER(testStretchingAndBendingForces);
 
       // Build an interest image.
@@ -142,6 +147,74 @@ namespace brick {
     }
 
 
+    void
+    NaiveSnakeTest::
+    testRunSnakes()
+    {
+      Snake<double> prototype;
+      prototype.setInterestImage(m_interestImage0.copy());
+      prototype.setStretchingConstant(0.0);
+      prototype.setBendingConstant(0.0);
+
+      std::vector< Snake<double> > snakes(3, prototype);
+      snakes[0].setSeedPoints(m_seedPoints0);
+      snakes[1].setSeedPoints(m_seedPoints1);
+      snakes[2].setSeedPoints(m_seedPoints2);
+      std::vector< Snake<double> > serialSnakes = snakes;
+      runSnakes(snakes, 3);
+
+      // Running in parallel should match running one at a time.
+      for(size_t index0 = 0; index0 < snakes.size(); ++index0) {
+        std::vector< numeric::Vector2D<double> > referencePoints =
+          serialSnakes[index0].run();
+        std::vector< numeric::Vector2D<double> > snakePoints =
+          snakes[index0].getSnake();
+        BRICK_TEST_ASSERT(snakePoints.size() == referencePoints.size());
+        for(size_t index1 = 0; index1 < snakePoints.size(); ++index1) {
+          BRICK_TEST_ASSERT(snakePoints[index1] == referencePoints[index1]);
+        }
+      }
+    }
+
+
+    void
+    NaiveSnakeTest::
+    testShortSnake()
+    {
+      // With a long maximum span length, resampling adds no points,
+      // so this snake keeps only its four seed points.  That's too
+      // few for the banded solver, but runOneIteration() accepts it,
+      // so it must run without complaint.
+      Snake<double> snake;
+      snake.setInterestImage(m_interestImage0.copy());
+      snake.setSeedPoints(m_seedPoints0);
+      snake.setMinimumSpanLength(1);
+      snake.setMaximumSpanLength(1000);
+      snake.setBendingConstant(1.0);
+
+      std::vector< numeric::Vector2D<double> > snakePoints =
+        snake.runOneIteration();
+      BRICK_TEST_ASSERT(snakePoints.size() == 4);
+      for(size_t index0 = 0; index0 < snakePoints.size(); ++index0) {
+        BRICK_TEST_ASSERT(snakePoints[index0].x() >= 0.0);
+        BRICK_TEST_ASSERT(snakePoints[index0].x() < m_testImageColumns);
+        BRICK_TEST_ASSERT(snakePoints[index0].y() >= 0.0);
+        BRICK_TEST_ASSERT(snakePoints[index0].y() < m_testImageRows);
+      }
+
+      // Stretching pulls each corner of the square towards its
+      // neighbors, so the snake should shrink.
+      double startArea = 160.0 * 120.0;
+      double area = 0.0;
+      for(size_t index0 = 0; index0 < snakePoints.size(); ++index0) {
+        numeric::Vector2D<double> const& point0 = snakePoints[index0];
+        numeric::Vector2D<double> const& point1 =
+          snakePoints[(index0 + 1) % snakePoints.size()];
+        area += 0.5 * (point0.x() * point1.y() - point1.x() * point0.y());
+      }
+      BRICK_TEST_ASSERT(std::fabs(area) < startArea);
+    }
+
 
     void
     NaiveSnakeTest::
@@ -0,0 +1,339 @@
+/**
+***************************************************************************
+* @file brick/computerVision/test/pngReaderTest.cc
+*
+* Source file defining tests for streaming PNG reading and writing.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <brick/computerVision/image.hh>
+#include <brick/computerVision/imageIO.hh>
+#include <brick/computerVision/pngReader.hh>
+#include <brick/computerVision/pngWriter.hh>
+#include <brick/computerVision/utilities.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    class PngReaderTest : public brick::test::TestFixture<PngReaderTest> {
+
+    public:
+
+      PngReaderTest();
+      ~PngReaderTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+#if HAVE_LIBPNG
+      void testReadImagePreallocated();
+      void testReadPNGBatch();
+      void testReadRows();
+      void testReadRowsConverted();
+      void testWriterSettings();
+      void testWriteRows16();
+#endif
+
+    private:
+
+      template <ImageFormat Format>
+      Image<Format>
+      buildTestImage(std::size_t rows, std::size_t columns);
+
+      std::string
+      getFileName(std::string const& baseName);
+
+    }; // class PngReaderTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    PngReaderTest::
+    PngReaderTest()
+      : brick::test::TestFixture<PngReaderTest>("PngReaderTest")
+    {
+#if HAVE_LIBPNG
+      BRICK_TEST_REGISTER_MEMBER(testReadImagePreallocated);
+      BRICK_TEST_REGISTER_MEMBER(testReadPNGBatch);
+      BRICK_TEST_REGISTER_MEMBER(testReadRows);
+      BRICK_TEST_REGISTER_MEMBER(testReadRowsConverted);
+      BRICK_TEST_REGISTER_MEMBER(testWriterSettings);
+      BRICK_TEST_REGISTER_MEMBER(testWriteRows16);
+#endif
+    }
+
+
+#if HAVE_LIBPNG
+
+    void
+    PngReaderTest::
+    testReadImagePreallocated()
+    {
+      Image<GRAY8> referenceImage = this->buildTestImage<GRAY8>(37, 53);
+      std::string fileName = this->getFileName("Preallocated");
+      writePNG(fileName, referenceImage);
+
+      // Decoding into a correctly sized image must reuse its memory.
+      Image<GRAY8> resultImage(37, 53);
+      common::UInt8* dataPtr = resultImage.data();
+      readPNG(fileName, resultImage);
+      BRICK_TEST_ASSERT(resultImage.data() == dataPtr);
+      BRICK_TEST_ASSERT(std::equal(resultImage.begin(), resultImage.end(),
+                                   referenceImage.begin()));
+
+      // ... even if it's a region of a larger image.
+      Image<GRAY8> bigImage(50, 60);
+      bigImage = 0;
+      Image<GRAY8> region = bigImage.getROI(
+        brick::numeric::Index2D(2, 3), brick::numeric::Index2D(39, 56));
+      PngReader reader(fileName);
+      reader.readImage(region);
+      for(std::size_t row = 0; row < 37; ++row) {
+        for(std::size_t column = 0; column < 53; ++column) {
+          BRICK_TEST_ASSERT(bigImage(row + 2, column + 3)
+                            == referenceImage(row, column));
+        }
+      }
+      BRICK_TEST_ASSERT(bigImage(1, 3) == 0);
+      BRICK_TEST_ASSERT(bigImage(2, 2) == 0);
+
+      // Wrongly shaped images are reinitialized.
+      Image<GRAY8> wrongImage(3, 4);
+      readPNG(fileName, wrongImage);
+      BRICK_TEST_ASSERT(wrongImage.rows() == 37);
+      BRICK_TEST_ASSERT(wrongImage.columns() == 53);
+
+      // The reader can be used more than once.
+      Image<GRAY8> secondImage = reader.getImage<GRAY8>();
+      BRICK_TEST_ASSERT(std::equal(secondImage.begin(), secondImage.end(),
+                                   referenceImage.begin()));
+    }
+
+
+    void
+    PngReaderTest::
+    testReadPNGBatch()
+    {
+      std::vector<std::string> fileNames;
+      std::vector< Image<RGB8> > referenceImages;
+      for(std::size_t ii = 0; ii < 5; ++ii) {
+        referenceImages.push_back(
+          this->buildTestImage<RGB8>(10 + ii, 20 + 3 * ii));
+        fileNames.push_back(
+          this->getFileName(std::string("Batch") + char('0' + ii)));
+        writePNG(fileNames.back(), referenceImages.back());
+      }
+
+      std::vector< Image<RGB8> > resultImages =
+        readPNGBatch<RGB8>(fileNames, 3);
+      BRICK_TEST_ASSERT(resultImages.size() == referenceImages.size());
+      for(std::size_t ii = 0; ii < resultImages.size(); ++ii) {
+        BRICK_TEST_ASSERT(
+          resultImages[ii].rows() == referenceImages[ii].rows());
+        BRICK_TEST_ASSERT(
+          resultImages[ii].columns() == referenceImages[ii].columns());
+        BRICK_TEST_ASSERT(
+          std::equal(resultImages[ii].begin(), resultImages[ii].end(),
+                     referenceImages[ii].begin()));
+      }
+
+      // Errors in worker threads make it back to the caller.
+      fileNames.push_back("/nonexistent/brickPngReaderTest.png");
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::IOException,
+        readPNGBatch<RGB8>(fileNames, 3));
+    }
+
+
+    void
+    PngReaderTest::
+    testReadRows()
+    {
+      Image<RGB8> referenceImage = this->buildTestImage<RGB8>(45, 31);
+      std::string fileName = this->getFileName("ReadRows");
+      writePNG(fileName, referenceImage);
+
+      PngReader reader(fileName);
+      BRICK_TEST_ASSERT(reader.getRows() == 45);
+      BRICK_TEST_ASSERT(reader.getColumns() == 31);
+      BRICK_TEST_ASSERT(reader.getNativeImageFormat() == RGB8);
+
+      std::size_t numberOfCalls = 0;
+      std::size_t nextRow = 0;
+      bool isOk = true;
+      auto callback = [&](Image<RGB8> const& band, std::size_t firstRow) {
+        ++numberOfCalls;
+        isOk = isOk && (firstRow == nextRow) && (band.columns() == 31);
+        for(std::size_t row = 0; row < band.rows(); ++row) {
+          isOk = isOk && std::equal(band.rowBegin(row), band.rowEnd(row),
+                                    referenceImage.rowBegin(firstRow + row));
+        }
+        nextRow += band.rows();
+      };
+      reader.readRows<RGB8>(callback, 10);
+      BRICK_TEST_ASSERT(isOk);
+      BRICK_TEST_ASSERT(numberOfCalls == 5);
+      BRICK_TEST_ASSERT(nextRow == 45);
+    }
+
+
+    void
+    PngReaderTest::
+    testReadRowsConverted()
+    {
+      Image<GRAY8> referenceImage = this->buildTestImage<GRAY8>(20, 17);
+      std::string fileName = this->getFileName("Converted");
+      writePNG(fileName, referenceImage);
+
+      Image<RGB8> referenceRGB = convertColorspace<RGB8>(referenceImage);
+      Image<RGB8> resultImage;
+      PngReader reader(fileName);
+      reader.readImage(resultImage);
+      BRICK_TEST_ASSERT(resultImage.rows() == 20);
+      BRICK_TEST_ASSERT(resultImage.columns() == 17);
+      BRICK_TEST_ASSERT(std::equal(resultImage.begin(), resultImage.end(),
+                                   referenceRGB.begin()));
+    }
+
+
+    void
+    PngReaderTest::
+    testWriterSettings()
+    {
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                  PngWriter(10));
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                  PngWriter(6, 0));
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                  PngWriter(6, 0x01));
+
+      Image<GRAY8> referenceImage = this->buildTestImage<GRAY8>(64, 64);
+      Image<GRAY8> emptyImage;
+      unsigned int filterSets[] = {
+        PngWriter::BRICK_PNG_FILTER_NONE,
+        PngWriter::BRICK_PNG_FILTER_SUB,
+        PngWriter::BRICK_PNG_FILTER_UP | PngWriter::BRICK_PNG_FILTER_PAETH,
+        PngWriter::BRICK_PNG_FILTER_AVERAGE,
+        PngWriter::BRICK_PNG_FILTER_ALL
+      };
+      std::string fileName = this->getFileName("Settings");
+      for(int level = 0; level <= 9; level += 3) {
+        for(unsigned int filters : filterSets) {
+          PngWriter writer(level, filters);
+          BRICK_TEST_ASSERT(writer.getCompressionLevel() == level);
+          BRICK_TEST_ASSERT(writer.getFilters() == filters);
+          writer.write(fileName, referenceImage);
+          Image<GRAY8> resultImage;
+          readPNG(fileName, resultImage);
+          BRICK_TEST_ASSERT(
+            std::equal(resultImage.begin(), resultImage.end(),
+                       referenceImage.begin()));
+
+          BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                      writer.write(fileName, emptyImage));
+        }
+      }
+    }
+
+
+    void
+    PngReaderTest::
+    testWriteRows16()
+    {
+      // Use values that don't survive if the byte order is wrong.
+      Image<GRAY16> referenceImage = this->buildTestImage<GRAY16>(33, 19);
+      std::string fileName = this->getFileName("WriteRows16");
+
+      std::size_t numberOfCalls = 0;
+      auto callback = [&](Image<GRAY16>& band, std::size_t firstRow) {
+        ++numberOfCalls;
+        for(std::size_t row = 0; row < band.rows(); ++row) {
+          std::copy(referenceImage.rowBegin(firstRow + row),
+                    referenceImage.rowEnd(firstRow + row),
+                    band.rowBegin(row));
+        }
+      };
+      PngWriter writer(1, PngWriter::BRICK_PNG_FILTER_SUB);
+      writer.writeRows<GRAY16>(fileName, 33, 19, callback, 8);
+      BRICK_TEST_ASSERT(numberOfCalls == 5);
+
+      Image<GRAY16> resultImage;
+      readPNG(fileName, resultImage);
+      BRICK_TEST_ASSERT(resultImage.rows() == 33);
+      BRICK_TEST_ASSERT(resultImage.columns() == 19);
+      BRICK_TEST_ASSERT(std::equal(resultImage.begin(), resultImage.end(),
+                                   referenceImage.begin()));
+
+      // Reading 16-bit data as 8-bit goes through convertColorspace().
+      Image<GRAY8> resultImage8;
+      readPNG(fileName, resultImage8);
+      Image<GRAY8> referenceImage8 =
+        convertColorspace<GRAY8>(referenceImage);
+      BRICK_TEST_ASSERT(std::equal(resultImage8.begin(), resultImage8.end(),
+                                   referenceImage8.begin()));
+    }
+
+#endif /* #if HAVE_LIBPNG */
+
+
+    template <ImageFormat Format>
+    Image<Format>
+    PngReaderTest::
+    buildTestImage(std::size_t rows, std::size_t columns)
+    {
+      typedef typename ImageFormatTraits<Format>::ComponentType ComponentType;
+      Image<Format> result(rows, columns);
+      ComponentType* componentPtr =
+        reinterpret_cast<ComponentType*>(result.data());
+      std::size_t const numberOfComponents =
+        result.size() * ImageFormatTraits<Format>::getNumberOfComponents();
+      for(std::size_t ii = 0; ii < numberOfComponents; ++ii) {
+        componentPtr[ii] = static_cast<ComponentType>(
+          (ii * 7919 + (ii / 13) * 104729) ^ (ii >> 3));
+      }
+      return result;
+    }
+
+
+    std::string
+    PngReaderTest::
+    getFileName(std::string const& baseName)
+    {
+      // TBD(xxx): get a real temp file name.
+      return std::string("/var/tmp/brickPngReaderTest") + baseName + ".png";
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::computerVision::PngReaderTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::computerVision::PngReaderTest currentTest;
+
+}
+
+#endif
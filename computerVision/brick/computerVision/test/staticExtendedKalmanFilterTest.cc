@@ -0,0 +1,371 @@
+/**
+***************************************************************************
+* @file brick/computerVision/test/staticExtendedKalmanFilterTest.cc
+*
+* Source file defining tests for StaticExtendedKalmanFilter class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <cmath>
+
+#include <brick/computerVision/staticExtendedKalmanFilter.hh>
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace computerVision {
+
+    class StaticExtendedKalmanFilterTest
+      : public brick::test::TestFixture<StaticExtendedKalmanFilterTest> {
+
+    public:
+
+      StaticExtendedKalmanFilterTest();
+      ~StaticExtendedKalmanFilterTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testAgainstStandardFilter();
+      void testCorrelatedProcessNoise();
+      void testSequentialEqualsBatch();
+      void testExceptions();
+
+    private:
+
+      typedef StaticExtendedKalmanFilter<double, 4> FilterType;
+      typedef FilterType::StateVector StateVector;
+      typedef FilterType::StateMatrix StateMatrix;
+      typedef numeric::StaticArray2D<double, 2, 4> MeasurementMatrix;
+      typedef numeric::StaticArray2D<double, 2, 2> MeasurementCovariance;
+      typedef numeric::StaticArray1D<double, 2> MeasurementVector;
+
+      // Constant velocity model in 2D: state is [x, y, dx, dy].
+      StateMatrix
+      getProcessMatrix(double deltaT);
+
+      // Observes a linear combination of position and velocity.
+      MeasurementMatrix
+      getMeasurementMatrix();
+
+      bool
+      isApproximatelyEqual(StateMatrix const& matrix0,
+                           StateMatrix const& matrix1);
+
+      bool
+      isApproximatelyEqual(StateVector const& vector0,
+                           StateVector const& vector1);
+
+      double m_defaultTolerance;
+
+    }; // class StaticExtendedKalmanFilterTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    StaticExtendedKalmanFilterTest::
+    StaticExtendedKalmanFilterTest()
+      : brick::test::TestFixture<StaticExtendedKalmanFilterTest>(
+          "StaticExtendedKalmanFilterTest"),
+        m_defaultTolerance(1.0E-10)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testAgainstStandardFilter);
+      BRICK_TEST_REGISTER_MEMBER(testCorrelatedProcessNoise);
+      BRICK_TEST_REGISTER_MEMBER(testSequentialEqualsBatch);
+      BRICK_TEST_REGISTER_MEMBER(testExceptions);
+    }
+
+
+    void
+    StaticExtendedKalmanFilterTest::
+    testAgainstStandardFilter()
+    {
+      StateMatrix const AA = this->getProcessMatrix(0.1);
+      MeasurementMatrix const HH = this->getMeasurementMatrix();
+      StateVector QQ;
+      QQ[0] = 0.0;
+      QQ[1] = 0.0;
+      QQ[2] = 0.01;
+      QQ[3] = 0.02;
+      MeasurementCovariance RR;
+      RR(0, 0) = 0.5;
+      RR(0, 1) = 0.2;
+      RR(1, 0) = 0.2;
+      RR(1, 1) = 0.3;
+
+      StateVector state;
+      state[0] = 1.0;
+      state[1] = -2.0;
+      state[2] = 0.5;
+      state[3] = 0.25;
+      StateMatrix covariance = numeric::identityStatic<double, 4>();
+      covariance(0, 2) = covariance(2, 0) = 0.3;
+
+      FilterType filter(state, covariance);
+      BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                          filter.getCovariance(), covariance));
+
+      for(size_t step = 0; step < 20; ++step) {
+        // Reference prediction: x = A x, P = A P A^T + Q.
+        state = numeric::matrixMultiply(AA, state);
+        covariance = numeric::matrixMultiply(
+          numeric::matrixMultiply(AA, covariance), AA.transpose());
+        for(size_t ii = 0; ii < 4; ++ii) {
+          covariance(ii, ii) += QQ[ii];
+        }
+        filter.doPredictionStep(
+          numeric::matrixMultiply(AA, filter.getState()), AA, QQ);
+        BRICK_TEST_ASSERT(this->isApproximatelyEqual(filter.getState(), state));
+        BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                            filter.getCovariance(), covariance));
+
+        // Lower triangular square root with nonnegative diagonal.
+        StateMatrix const& root = filter.getCovarianceSquareRoot();
+        for(size_t ii = 0; ii < 4; ++ii) {
+          BRICK_TEST_ASSERT(root(ii, ii) >= 0.0);
+          for(size_t jj = ii + 1; jj < 4; ++jj) {
+            BRICK_TEST_ASSERT(root(ii, jj) == 0.0);
+          }
+        }
+
+        // Reference update using the textbook Kalman gain.
+        MeasurementVector measurement;
+        measurement[0] = std::sin(0.3 * step);
+        measurement[1] = std::cos(0.2 * step) + 0.1 * step;
+        MeasurementVector innovation =
+          measurement - numeric::matrixMultiply(HH, state);
+        MeasurementCovariance SS = numeric::matrixMultiply(
+          numeric::matrixMultiply(HH, covariance), HH.transpose()) + RR;
+        double determinant = SS(0, 0) * SS(1, 1) - SS(0, 1) * SS(1, 0);
+        MeasurementCovariance SInverse;
+        SInverse(0, 0) = SS(1, 1) / determinant;
+        SInverse(0, 1) = -SS(0, 1) / determinant;
+        SInverse(1, 0) = -SS(1, 0) / determinant;
+        SInverse(1, 1) = SS(0, 0) / determinant;
+        numeric::StaticArray2D<double, 4, 2> gain = numeric::matrixMultiply(
+          numeric::matrixMultiply(covariance, HH.transpose()), SInverse);
+        state += numeric::matrixMultiply(gain, innovation);
+        covariance -= numeric::matrixMultiply(
+          numeric::matrixMultiply(gain, HH), covariance);
+
+        filter.doMeasurementUpdate(
+          measurement - numeric::matrixMultiply(HH, filter.getState()),
+          HH, RR);
+        BRICK_TEST_ASSERT(this->isApproximatelyEqual(filter.getState(), state));
+        BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                            filter.getCovariance(), covariance));
+      }
+    }
+
+
+    void
+    StaticExtendedKalmanFilterTest::
+    testCorrelatedProcessNoise()
+    {
+      // Noise enters as acceleration, so G maps a 2D noise vector
+      // onto both position and velocity.
+      double const deltaT = 0.05;
+      StateMatrix const AA = this->getProcessMatrix(deltaT);
+      numeric::StaticArray2D<double, 4, 2> GG;
+      GG(0, 0) = GG(1, 1) = 0.5 * deltaT * deltaT;
+      GG(2, 0) = GG(3, 1) = deltaT;
+      numeric::StaticArray2D<double, 2, 2> QQ;
+      QQ(0, 0) = 4.0;
+      QQ(0, 1) = QQ(1, 0) = 1.0;
+      QQ(1, 1) = 2.0;
+
+      StateVector state;
+      state[2] = 1.0;
+      StateMatrix covariance = numeric::identityStatic<double, 4>() * 0.1;
+      FilterType filter(state, covariance);
+
+      for(size_t step = 0; step < 10; ++step) {
+        covariance =
+          numeric::matrixMultiply(
+            numeric::matrixMultiply(AA, covariance), AA.transpose())
+          + numeric::matrixMultiply(
+            numeric::matrixMultiply(GG, QQ), GG.transpose());
+        filter.doPredictionStep(
+          numeric::matrixMultiply(AA, filter.getState()), AA, GG, QQ);
+        BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                            filter.getCovariance(), covariance));
+      }
+
+      // A singular (but positive semidefinite) Q is legal.
+      QQ(0, 0) = QQ(0, 1) = QQ(1, 0) = QQ(1, 1) = 1.0;
+      covariance =
+        numeric::matrixMultiply(
+          numeric::matrixMultiply(AA, covariance), AA.transpose())
+        + numeric::matrixMultiply(
+          numeric::matrixMultiply(GG, QQ), GG.transpose());
+      filter.doPredictionStep(
+        numeric::matrixMultiply(AA, filter.getState()), AA, GG, QQ);
+      BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                          filter.getCovariance(), covariance));
+    }
+
+
+    void
+    StaticExtendedKalmanFilterTest::
+    testSequentialEqualsBatch()
+    {
+      MeasurementMatrix const HH = this->getMeasurementMatrix();
+      MeasurementCovariance RR;
+      RR(0, 0) = 0.4;
+      RR(1, 1) = 0.7;
+
+      StateVector state;
+      state[0] = 3.0;
+      state[1] = 1.0;
+      state[2] = -1.0;
+      state[3] = 2.0;
+      StateMatrix covariance = numeric::identityStatic<double, 4>() * 2.0;
+      covariance(1, 3) = covariance(3, 1) = 0.5;
+
+      FilterType batchFilter(state, covariance);
+      FilterType sequentialFilter(state, covariance);
+
+      MeasurementVector measurement;
+      measurement[0] = 2.0;
+      measurement[1] = 5.0;
+      batchFilter.doMeasurementUpdate(
+        measurement - numeric::matrixMultiply(HH, state), HH, RR);
+
+      for(size_t ii = 0; ii < 2; ++ii) {
+        StateVector jacobianRow;
+        double prediction = 0.0;
+        for(size_t jj = 0; jj < 4; ++jj) {
+          jacobianRow[jj] = HH(ii, jj);
+          prediction += HH(ii, jj) * sequentialFilter.getState()[jj];
+        }
+        sequentialFilter.doScalarMeasurementUpdate(
+          measurement[ii] - prediction, jacobianRow, RR(ii, ii));
+      }
+
+      BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                          batchFilter.getState(), sequentialFilter.getState()));
+      BRICK_TEST_ASSERT(this->isApproximatelyEqual(
+                          batchFilter.getCovariance(),
+                          sequentialFilter.getCovariance()));
+
+      // Covariance must remain symmetric positive semidefinite, even
+      // after many very precise measurements.
+      for(size_t step = 0; step < 1000; ++step) {
+        StateVector jacobianRow;
+        jacobianRow[step % 4] = 1.0;
+        jacobianRow[(step + 1) % 4] = 1.0;
+        sequentialFilter.doScalarMeasurementUpdate(0.0, jacobianRow, 1.0E-12);
+      }
+      StateMatrix const finalCovariance = sequentialFilter.getCovariance();
+      for(size_t ii = 0; ii < 4; ++ii) {
+        BRICK_TEST_ASSERT(finalCovariance(ii, ii) >= 0.0);
+      }
+    }
+
+
+    void
+    StaticExtendedKalmanFilterTest::
+    testExceptions()
+    {
+      StateMatrix covariance = numeric::identityStatic<double, 4>();
+      covariance(2, 2) = -1.0;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException, FilterType(StateVector(), covariance));
+
+      FilterType filter(StateVector(), numeric::identityStatic<double, 4>());
+      MeasurementCovariance RR;
+      RR(0, 0) = 1.0;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        filter.doMeasurementUpdate(
+          MeasurementVector(), this->getMeasurementMatrix(), RR));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        filter.doScalarMeasurementUpdate(1.0, StateVector(), 0.0));
+    }
+
+
+    StaticExtendedKalmanFilterTest::StateMatrix
+    StaticExtendedKalmanFilterTest::
+    getProcessMatrix(double deltaT)
+    {
+      StateMatrix AA = numeric::identityStatic<double, 4>();
+      AA(0, 2) = deltaT;
+      AA(1, 3) = deltaT;
+      return AA;
+    }
+
+
+    StaticExtendedKalmanFilterTest::MeasurementMatrix
+    StaticExtendedKalmanFilterTest::
+    getMeasurementMatrix()
+    {
+      MeasurementMatrix HH;
+      HH(0, 0) = 1.0;
+      HH(0, 2) = 0.1;
+      HH(1, 1) = 1.0;
+      HH(1, 0) = 0.5;
+      return HH;
+    }
+
+
+    bool
+    StaticExtendedKalmanFilterTest::
+    isApproximatelyEqual(StateMatrix const& matrix0,
+                         StateMatrix const& matrix1)
+    {
+      for(size_t ii = 0; ii < matrix0.size(); ++ii) {
+        if(!test::approximatelyEqual(
+             matrix0[ii], matrix1[ii], m_defaultTolerance)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    bool
+    StaticExtendedKalmanFilterTest::
+    isApproximatelyEqual(StateVector const& vector0,
+                         StateVector const& vector1)
+    {
+      for(size_t ii = 0; ii < vector0.size(); ++ii) {
+        if(!test::approximatelyEqual(
+             vector0[ii], vector1[ii], m_defaultTolerance)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::computerVision::StaticExtendedKalmanFilterTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::computerVision::StaticExtendedKalmanFilterTest currentTest;
+
+}
+
+#endif
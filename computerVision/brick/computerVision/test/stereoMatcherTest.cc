@@ -0,0 +1,378 @@
+/**
+***************************************************************************
+* @file brick/computerVision/test/stereoMatcherTest.cc
+*
+* Source file defining tests for the StereoMatcher class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <cmath>
+#include <brick/computerVision/stereoMatcher.hh>
+#include <brick/computerVision/stereoRectify.hh>
+#include <brick/random/pseudoRandom.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    class StereoMatcherTest
+      : public brick::test::TestFixture<StereoMatcherTest> {
+
+    public:
+
+      StereoMatcherTest();
+      ~StereoMatcherTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testBlockMatching();
+      void testExceptions();
+      void testLeftRightCheck();
+      void testReprojectDisparity();
+      void testSemiGlobalMatching();
+
+    private:
+
+      Image<GRAY8>
+      getTexture(std::size_t rows, std::size_t columns, int seed);
+
+      void
+      getShiftedPair(std::size_t rows, std::size_t columns,
+                     std::size_t disparity,
+                     Image<GRAY8>& leftImage, Image<GRAY8>& rightImage);
+
+      void
+      checkConstantDisparity(StereoMatcher const& matcher,
+                             std::size_t blockSize, std::size_t disparity);
+
+      double m_defaultTolerance;
+
+    }; // class StereoMatcherTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    StereoMatcherTest::
+    StereoMatcherTest()
+      : brick::test::TestFixture<StereoMatcherTest>("StereoMatcherTest"),
+        m_defaultTolerance(1.0E-6)
+    {
+      BRICK_TEST_REGISTER_MEMBER(testBlockMatching);
+      BRICK_TEST_REGISTER_MEMBER(testExceptions);
+      BRICK_TEST_REGISTER_MEMBER(testLeftRightCheck);
+      BRICK_TEST_REGISTER_MEMBER(testReprojectDisparity);
+      BRICK_TEST_REGISTER_MEMBER(testSemiGlobalMatching);
+    }
+
+
+    void
+    StereoMatcherTest::
+    testBlockMatching()
+    {
+      std::size_t const blockSize = 7;
+      StereoMatcher sadMatcher(
+        32, blockSize, StereoMatcher::BRICK_STEREO_SAD,
+        StereoMatcher::BRICK_STEREO_BLOCK_MATCHING);
+      this->checkConstantDisparity(sadMatcher, blockSize, 11);
+
+      StereoMatcher censusMatcher(
+        32, blockSize, StereoMatcher::BRICK_STEREO_CENSUS,
+        StereoMatcher::BRICK_STEREO_BLOCK_MATCHING);
+      censusMatcher.setNumberOfThreads(1);
+      this->checkConstantDisparity(censusMatcher, blockSize, 11);
+
+      // Disparity zero is a legitimate answer.
+      this->checkConstantDisparity(censusMatcher, blockSize, 0);
+    }
+
+
+    void
+    StereoMatcherTest::
+    testExceptions()
+    {
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                  StereoMatcher(64, 8));
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                  StereoMatcher(1, 7));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        StereoMatcher(64, 17, StereoMatcher::BRICK_STEREO_SAD));
+
+      StereoMatcher matcher(16, 5);
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::ValueException,
+                                  matcher.setSemiGlobalPenalties(10, 5));
+      Image<GRAY8> leftImage(40, 50);
+      Image<GRAY8> rightImage(40, 51);
+      leftImage = brick::common::UInt8(0);
+      rightImage = brick::common::UInt8(0);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        matcher.computeDisparity(leftImage, rightImage));
+
+      // Big SAD blocks don't leave room for semi-global path costs.
+      StereoMatcher sgmMatcher(
+        16, 11, StereoMatcher::BRICK_STEREO_SAD,
+        StereoMatcher::BRICK_STEREO_SEMI_GLOBAL);
+      rightImage.reinit(40, 50);
+      rightImage = brick::common::UInt8(0);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        sgmMatcher.computeDisparity(leftImage, rightImage));
+    }
+
+
+    void
+    StereoMatcherTest::
+    testLeftRightCheck()
+    {
+      // A foreground plane at disparity 20 covers the right half of
+      // the left image, in front of a background at disparity 5.
+      // Background just left of the foreground edge is hidden in the
+      // right image.
+      std::size_t const rows = 60;
+      std::size_t const columns = 120;
+      std::size_t const edge = columns / 2;
+      std::size_t const foreground = 20;
+      std::size_t const background = 5;
+      Image<GRAY8> backTexture = this->getTexture(rows, columns + 32, 3);
+      Image<GRAY8> foreTexture = this->getTexture(rows, columns + 32, 4);
+      Image<GRAY8> leftImage(rows, columns);
+      Image<GRAY8> rightImage(rows, columns);
+      for(std::size_t row = 0; row < rows; ++row) {
+        for(std::size_t column = 0; column < columns; ++column) {
+          leftImage(row, column) = (column < edge)
+            ? backTexture(row, column) : foreTexture(row, column);
+          rightImage(row, column) = (column + foreground >= edge)
+            ? foreTexture(row, column + foreground)
+            : backTexture(row, column + background);
+        }
+      }
+
+      std::size_t const blockSize = 5;
+      std::size_t const radius = blockSize / 2;
+      StereoMatcher matcher(32, blockSize);
+      Image<GRAY_FLOAT32> disparity =
+        matcher.computeDisparity(leftImage, rightImage);
+
+      std::size_t numberOfOccluded = 0;
+      std::size_t numberOfRejected = 0;
+      for(std::size_t row = radius; row < rows - radius; ++row) {
+        for(std::size_t column = edge - (foreground - background) + radius;
+            column < edge - radius; ++column) {
+          ++numberOfOccluded;
+          if(disparity(row, column) < 0.0f) {
+            ++numberOfRejected;
+          }
+        }
+        for(std::size_t column = edge + radius; column < columns - radius;
+            ++column) {
+          float const value = disparity(row, column);
+          if(value >= 0.0f) {
+            BRICK_TEST_ASSERT(std::fabs(value - float(foreground)) < 0.5f);
+          }
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfRejected * 10 >= numberOfOccluded * 8);
+
+      // Without the checks, occluded pixels get (wrong) disparities.
+      matcher.setMaxLeftRightDifference(-1);
+      matcher.setUniquenessRatio(0);
+      matcher.computeDisparity(leftImage, rightImage, disparity);
+      for(std::size_t row = radius; row < rows - radius; ++row) {
+        for(std::size_t column = radius + 32; column < columns - radius;
+            ++column) {
+          BRICK_TEST_ASSERT(disparity(row, column) >= 0.0f);
+        }
+      }
+    }
+
+
+    void
+    StereoMatcherTest::
+    testReprojectDisparity()
+    {
+      double const focalLength = 500.0;
+      double const baseline = 0.12;
+      CameraIntrinsicsPinhole<double> intrinsics0(
+        80, 60, focalLength, focalLength, 41.0, 29.0);
+      CameraIntrinsicsPinhole<double> intrinsics1(
+        80, 60, focalLength, focalLength, 43.0, 29.0);
+      brick::numeric::Transform3D<double> reprojectionMatrix =
+        getReprojectionMatrix(intrinsics0, intrinsics1, baseline);
+
+      Image<GRAY_FLOAT32> disparity(60, 80);
+      for(std::size_t row = 0; row < disparity.rows(); ++row) {
+        for(std::size_t column = 0; column < disparity.columns(); ++column) {
+          disparity(row, column) = 2.0f + 0.25f * float(column % 40);
+        }
+      }
+      disparity(7, 9) = StereoMatcher::getInvalidDisparity();
+
+      brick::numeric::Array2D<bool> isValid;
+      brick::numeric::Array2D< brick::numeric::Vector3D<double> > points =
+        reprojectDisparity(disparity, reprojectionMatrix, isValid);
+      BRICK_TEST_ASSERT(points.rows() == disparity.rows());
+      BRICK_TEST_ASSERT(points.columns() == disparity.columns());
+      BRICK_TEST_ASSERT(!isValid(7, 9));
+
+      // Projecting into each camera should recover the pixel and the
+      // disparity.
+      for(std::size_t row = 0; row < disparity.rows(); ++row) {
+        for(std::size_t column = 0; column < disparity.columns(); ++column) {
+          if(row == 7 && column == 9) {
+            continue;
+          }
+          BRICK_TEST_ASSERT(isValid(row, column));
+          brick::numeric::Vector3D<double> const& point = points(row, column);
+          brick::numeric::Vector2D<double> uv0 = intrinsics0.project(point);
+          brick::numeric::Vector2D<double> uv1 = intrinsics1.project(
+            point - brick::numeric::Vector3D<double>(baseline, 0.0, 0.0));
+          BRICK_TEST_ASSERT(
+            std::fabs(uv0.x() - double(column)) < m_defaultTolerance);
+          BRICK_TEST_ASSERT(
+            std::fabs(uv0.y() - double(row)) < m_defaultTolerance);
+          BRICK_TEST_ASSERT(
+            std::fabs(uv0.x() - uv1.x() - disparity(row, column))
+            < m_defaultTolerance);
+        }
+      }
+    }
+
+
+    void
+    StereoMatcherTest::
+    testSemiGlobalMatching()
+    {
+      std::size_t const blockSize = 3;
+      StereoMatcher censusMatcher(
+        32, blockSize, StereoMatcher::BRICK_STEREO_CENSUS,
+        StereoMatcher::BRICK_STEREO_SEMI_GLOBAL);
+      this->checkConstantDisparity(censusMatcher, blockSize, 13);
+
+      StereoMatcher sadMatcher(
+        32, blockSize, StereoMatcher::BRICK_STEREO_SAD,
+        StereoMatcher::BRICK_STEREO_SEMI_GLOBAL);
+      sadMatcher.setSemiGlobalPenalties(40, 200);
+      this->checkConstantDisparity(sadMatcher, blockSize, 13);
+    }
+
+
+    // ---- Private members below this line. ----
+
+    // Matches a shifted pair, and checks that nearly all pixels that
+    // can be matched are, with the right disparity.
+    void
+    StereoMatcherTest::
+    checkConstantDisparity(StereoMatcher const& matcher,
+                           std::size_t blockSize, std::size_t disparity)
+    {
+      std::size_t const rows = 50;
+      std::size_t const columns = 90;
+      Image<GRAY8> leftImage;
+      Image<GRAY8> rightImage;
+      this->getShiftedPair(rows, columns, disparity, leftImage, rightImage);
+      Image<GRAY_FLOAT32> result =
+        matcher.computeDisparity(leftImage, rightImage);
+      BRICK_TEST_ASSERT(result.rows() == rows);
+      BRICK_TEST_ASSERT(result.columns() == columns);
+
+      std::size_t const radius = blockSize / 2;
+      std::size_t numberOfPixels = 0;
+      std::size_t numberOfValid = 0;
+      for(std::size_t row = 0; row < rows; ++row) {
+        for(std::size_t column = 0; column < columns; ++column) {
+          float const value = result(row, column);
+          bool const isInterior =
+            (row >= radius && row < rows - radius
+             && column >= radius + disparity && column < columns - radius);
+          if(!isInterior) {
+            if(row < radius || row >= rows - radius
+               || column < radius || column >= columns - radius) {
+              BRICK_TEST_ASSERT(
+                value == StereoMatcher::getInvalidDisparity());
+            }
+            continue;
+          }
+          ++numberOfPixels;
+          if(value >= 0.0f) {
+            ++numberOfValid;
+            BRICK_TEST_ASSERT(std::fabs(value - float(disparity)) < 0.5f);
+          }
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfValid * 100 >= numberOfPixels * 95);
+    }
+
+
+    // Builds a pair in which every left image pixel appears in the
+    // right image, shifted left by disparity.
+    void
+    StereoMatcherTest::
+    getShiftedPair(std::size_t rows, std::size_t columns,
+                   std::size_t disparity,
+                   Image<GRAY8>& leftImage, Image<GRAY8>& rightImage)
+    {
+      Image<GRAY8> texture = this->getTexture(rows, columns + disparity, 1);
+      leftImage.reinit(rows, columns);
+      rightImage.reinit(rows, columns);
+      for(std::size_t row = 0; row < rows; ++row) {
+        for(std::size_t column = 0; column < columns; ++column) {
+          leftImage(row, column) = texture(row, column);
+          rightImage(row, column) = texture(row, column + disparity);
+        }
+      }
+    }
+
+
+    // Random texture, smoothed a little so that costs vary smoothly
+    // with disparity.
+    Image<GRAY8>
+    StereoMatcherTest::
+    getTexture(std::size_t rows, std::size_t columns, int seed)
+    {
+      brick::random::PseudoRandom pseudoRandom(seed);
+      Image<GRAY8> noise(rows, columns + 1);
+      for(std::size_t ii = 0; ii < noise.size(); ++ii) {
+        noise[ii] = static_cast<brick::common::UInt8>(
+          pseudoRandom.uniformInt(0, 256));
+      }
+      Image<GRAY8> texture(rows, columns);
+      for(std::size_t row = 0; row < rows; ++row) {
+        for(std::size_t column = 0; column < columns; ++column) {
+          texture(row, column) = static_cast<brick::common::UInt8>(
+            (int(noise(row, column)) + int(noise(row, column + 1))) / 2);
+        }
+      }
+      return texture;
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::computerVision::StereoMatcherTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::computerVision::StereoMatcherTest currentTest;
+
+}
+
+#endif
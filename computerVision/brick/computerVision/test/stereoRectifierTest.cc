@@ -0,0 +1,387 @@
+/**
+***************************************************************************
+* @file brick/computerVision/test/stereoRectifierTest.cc
+*
+* Source file defining tests for the StereoRectifier class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <cmath>
+#include <brick/computerVision/cameraIntrinsicsPlumbBob.hh>
+#include <brick/computerVision/stereoRectifier.hh>
+#include <brick/computerVision/stereoRectify.hh>
+#include <brick/numeric/rotations.hh>
+#include <brick/random/pseudoRandom.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    class StereoRectifierTest
+      : public brick::test::TestFixture<StereoRectifierTest> {
+
+    public:
+
+      StereoRectifierTest();
+      ~StereoRectifierTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testDecimation();
+      void testRectifyConstant();
+      void testRectifyMatchesReference();
+
+    private:
+
+      template <ImageFormat Format>
+      Image<Format>
+      getRandomImage(std::size_t rows, std::size_t columns, int seed);
+
+      void
+      getStereoRig(CameraIntrinsicsPlumbBob<double>& intrinsics0,
+                   CameraIntrinsicsPlumbBob<double>& intrinsics1,
+                   brick::numeric::Transform3D<double>& camera0FromWorld,
+                   brick::numeric::Transform3D<double>& camera1FromWorld,
+                   CameraIntrinsicsPinhole<double>& rectifiedIntrinsics0,
+                   CameraIntrinsicsPinhole<double>& rectifiedIntrinsics1,
+                   brick::numeric::Transform3D<double>& rcamera0FromWorld,
+                   brick::numeric::Transform3D<double>& rcamera1FromWorld);
+
+      double m_defaultTolerance;
+
+    }; // class StereoRectifierTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    StereoRectifierTest::
+    StereoRectifierTest()
+      : brick::test::TestFixture<StereoRectifierTest>("StereoRectifierTest"),
+        m_defaultTolerance(1.0E-3)
+    {
+      BRICK_TEST_REGISTER_MEMBER(testDecimation);
+      BRICK_TEST_REGISTER_MEMBER(testRectifyConstant);
+      BRICK_TEST_REGISTER_MEMBER(testRectifyMatchesReference);
+    }
+
+
+    void
+    StereoRectifierTest::
+    testDecimation()
+    {
+      CameraIntrinsicsPlumbBob<double> intrinsics0;
+      CameraIntrinsicsPlumbBob<double> intrinsics1;
+      brick::numeric::Transform3D<double> camera0FromWorld;
+      brick::numeric::Transform3D<double> camera1FromWorld;
+      CameraIntrinsicsPinhole<double> rectifiedIntrinsics0;
+      CameraIntrinsicsPinhole<double> rectifiedIntrinsics1;
+      brick::numeric::Transform3D<double> rcamera0FromWorld;
+      brick::numeric::Transform3D<double> rcamera1FromWorld;
+      this->getStereoRig(intrinsics0, intrinsics1,
+                         camera0FromWorld, camera1FromWorld,
+                         rectifiedIntrinsics0, rectifiedIntrinsics1,
+                         rcamera0FromWorld, rcamera1FromWorld);
+
+      StereoRectifier< CameraIntrinsicsPlumbBob<double> > fullRectifier(
+        intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+        rectifiedIntrinsics0, rectifiedIntrinsics1,
+        rcamera0FromWorld, rcamera1FromWorld, 1);
+      StereoRectifier< CameraIntrinsicsPlumbBob<double> > halfRectifier(
+        intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+        rectifiedIntrinsics0, rectifiedIntrinsics1,
+        rcamera0FromWorld, rcamera1FromWorld, 2);
+      BRICK_TEST_ASSERT(halfRectifier.getDecimation() == 2);
+      BRICK_TEST_ASSERT(halfRectifier.getOutputRows()
+                        == rectifiedIntrinsics0.getNumPixelsY() / 2);
+      BRICK_TEST_ASSERT(halfRectifier.getOutputColumns()
+                        == rectifiedIntrinsics0.getNumPixelsX() / 2);
+
+      // The decimated intrinsics must describe the decimated images.
+      brick::numeric::Vector3D<double> point(0.3, -0.2, 4.0);
+      brick::numeric::Vector2D<double> fullPixel =
+        fullRectifier.getRectifiedIntrinsics1().project(point);
+      brick::numeric::Vector2D<double> halfPixel =
+        halfRectifier.getRectifiedIntrinsics1().project(point);
+      BRICK_TEST_ASSERT(
+        std::fabs(halfPixel.x() - (fullPixel.x() - 0.5) / 2.0) < 1.0E-9);
+      BRICK_TEST_ASSERT(
+        std::fabs(halfPixel.y() - (fullPixel.y() - 0.5) / 2.0) < 1.0E-9);
+
+      // Decimated output must be the block average of full
+      // resolution output.
+      Image<GRAY_FLOAT32> image0 = this->getRandomImage<GRAY_FLOAT32>(
+        intrinsics0.getNumPixelsY(), intrinsics0.getNumPixelsX(), 1);
+      Image<GRAY_FLOAT32> image1 = this->getRandomImage<GRAY_FLOAT32>(
+        intrinsics1.getNumPixelsY(), intrinsics1.getNumPixelsX(), 2);
+      Image<GRAY_FLOAT32> full0;
+      Image<GRAY_FLOAT32> full1;
+      Image<GRAY_FLOAT32> half0;
+      Image<GRAY_FLOAT32> half1;
+      fullRectifier.rectify(image0, image1, full0, full1, -1.0f);
+      halfRectifier.rectify(image0, image1, half0, half1, -1.0f);
+
+      std::size_t numberOfValidPixels = 0;
+      for(std::size_t row = 0; row < half1.rows(); ++row) {
+        for(std::size_t column = 0; column < half1.columns(); ++column) {
+          float samples[4] = {
+            full1(2 * row, 2 * column), full1(2 * row, 2 * column + 1),
+            full1(2 * row + 1, 2 * column), full1(2 * row + 1, 2 * column + 1)
+          };
+          bool isValid = (samples[0] >= 0.0f && samples[1] >= 0.0f
+                          && samples[2] >= 0.0f && samples[3] >= 0.0f);
+          BRICK_TEST_ASSERT(isValid == (half1(row, column) >= 0.0f));
+          if(isValid) {
+            float average =
+              (samples[0] + samples[1] + samples[2] + samples[3]) / 4.0f;
+            BRICK_TEST_ASSERT(
+              std::fabs(half1(row, column) - average) < m_defaultTolerance);
+            ++numberOfValidPixels;
+          }
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfValidPixels > half1.size() / 2);
+    }
+
+
+    void
+    StereoRectifierTest::
+    testRectifyConstant()
+    {
+      CameraIntrinsicsPlumbBob<double> intrinsics0;
+      CameraIntrinsicsPlumbBob<double> intrinsics1;
+      brick::numeric::Transform3D<double> camera0FromWorld;
+      brick::numeric::Transform3D<double> camera1FromWorld;
+      CameraIntrinsicsPinhole<double> rectifiedIntrinsics0;
+      CameraIntrinsicsPinhole<double> rectifiedIntrinsics1;
+      brick::numeric::Transform3D<double> rcamera0FromWorld;
+      brick::numeric::Transform3D<double> rcamera1FromWorld;
+      this->getStereoRig(intrinsics0, intrinsics1,
+                         camera0FromWorld, camera1FromWorld,
+                         rectifiedIntrinsics0, rectifiedIntrinsics1,
+                         rcamera0FromWorld, rcamera1FromWorld);
+
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        (StereoRectifier< CameraIntrinsicsPlumbBob<double> >(
+          intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+          rectifiedIntrinsics0, rectifiedIntrinsics1,
+          rcamera0FromWorld, rcamera1FromWorld, 0)));
+
+      StereoRectifier< CameraIntrinsicsPlumbBob<double> > rectifier(
+        intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+        rectifiedIntrinsics0, rectifiedIntrinsics1,
+        rcamera0FromWorld, rcamera1FromWorld, 3, 4);
+
+      // Constant images stay constant, with no rounding drift.
+      PixelRGB8 color(77, 128, 255);
+      PixelRGB8 defaultColor(1, 2, 3);
+      Image<RGB8> image0(intrinsics0.getNumPixelsY(),
+                         intrinsics0.getNumPixelsX());
+      Image<RGB8> image1(intrinsics1.getNumPixelsY(),
+                         intrinsics1.getNumPixelsX());
+      image0 = color;
+      image1 = color;
+      Image<RGB8> rectified0;
+      Image<RGB8> rectified1;
+      rectifier.rectify(image0, image1, rectified0, rectified1, defaultColor);
+      BRICK_TEST_ASSERT(rectified0.rows() == rectifier.getOutputRows());
+      BRICK_TEST_ASSERT(rectified0.columns() == rectifier.getOutputColumns());
+      std::size_t numberOfValidPixels = 0;
+      for(std::size_t ii = 0; ii < rectified0.size(); ++ii) {
+        BRICK_TEST_ASSERT(rectified0[ii] == color
+                          || rectified0[ii] == defaultColor);
+        BRICK_TEST_ASSERT(rectified1[ii] == color
+                          || rectified1[ii] == defaultColor);
+        if(rectified0[ii] == color) {
+          ++numberOfValidPixels;
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfValidPixels > rectified0.size() / 2);
+      BRICK_TEST_ASSERT(numberOfValidPixels < rectified0.size());
+
+      // Thread count mustn't change the result.
+      StereoRectifier< CameraIntrinsicsPlumbBob<double> > serialRectifier(
+        intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+        rectifiedIntrinsics0, rectifiedIntrinsics1,
+        rcamera0FromWorld, rcamera1FromWorld, 3, 1);
+      Image<GRAY8> gray0 = this->getRandomImage<GRAY8>(
+        image0.rows(), image0.columns(), 3);
+      Image<GRAY8> gray1 = this->getRandomImage<GRAY8>(
+        image1.rows(), image1.columns(), 4);
+      Image<GRAY8> parallel0;
+      Image<GRAY8> parallel1;
+      Image<GRAY8> serial0;
+      Image<GRAY8> serial1;
+      rectifier.rectify(gray0, gray1, parallel0, parallel1);
+      serialRectifier.rectify(gray0, gray1, serial0, serial1);
+      BRICK_TEST_ASSERT(
+        std::equal(parallel0.begin(), parallel0.end(), serial0.begin()));
+      BRICK_TEST_ASSERT(
+        std::equal(parallel1.begin(), parallel1.end(), serial1.begin()));
+
+      // Wrongly sized input is an error.
+      Image<GRAY8> smallImage(10, 10);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        rectifier.rectify(smallImage, gray1, parallel0, parallel1));
+    }
+
+
+    void
+    StereoRectifierTest::
+    testRectifyMatchesReference()
+    {
+      CameraIntrinsicsPlumbBob<double> intrinsics0;
+      CameraIntrinsicsPlumbBob<double> intrinsics1;
+      brick::numeric::Transform3D<double> camera0FromWorld;
+      brick::numeric::Transform3D<double> camera1FromWorld;
+      CameraIntrinsicsPinhole<double> rectifiedIntrinsics0;
+      CameraIntrinsicsPinhole<double> rectifiedIntrinsics1;
+      brick::numeric::Transform3D<double> rcamera0FromWorld;
+      brick::numeric::Transform3D<double> rcamera1FromWorld;
+      this->getStereoRig(intrinsics0, intrinsics1,
+                         camera0FromWorld, camera1FromWorld,
+                         rectifiedIntrinsics0, rectifiedIntrinsics1,
+                         rcamera0FromWorld, rcamera1FromWorld);
+
+      StereoRectifier< CameraIntrinsicsPlumbBob<double> > rectifier(
+        intrinsics0, intrinsics1, camera0FromWorld, camera1FromWorld,
+        rectifiedIntrinsics0, rectifiedIntrinsics1,
+        rcamera0FromWorld, rcamera1FromWorld);
+
+      Image<GRAY_FLOAT64> image0 = this->getRandomImage<GRAY_FLOAT64>(
+        intrinsics0.getNumPixelsY(), intrinsics0.getNumPixelsX(), 5);
+      Image<GRAY_FLOAT64> image1 = this->getRandomImage<GRAY_FLOAT64>(
+        intrinsics1.getNumPixelsY(), intrinsics1.getNumPixelsX(), 6);
+      Image<GRAY_FLOAT64> rectified0;
+      Image<GRAY_FLOAT64> rectified1;
+      rectifier.rectify(image0, image1, rectified0, rectified1, -1.0);
+
+      // Compare with per-pixel reverseProject()/project().
+      brick::numeric::Transform3D<double> worldFromRCamera1 =
+        rcamera1FromWorld.invert();
+      std::size_t numberOfValidPixels = 0;
+      for(std::size_t row = 0; row < rectified1.rows(); ++row) {
+        for(std::size_t column = 0; column < rectified1.columns(); ++column) {
+          brick::geometry::Ray3D<double> ray =
+            rectifiedIntrinsics1.reverseProject(
+              brick::numeric::Vector2D<double>(column, row));
+          brick::numeric::Vector3D<double> point =
+            camera1FromWorld * (worldFromRCamera1 * ray.getDirectionVector());
+          brick::numeric::Vector3D<double> origin =
+            camera1FromWorld * (worldFromRCamera1 * ray.getOrigin());
+          brick::numeric::Vector2D<double> inputCoord =
+            intrinsics1.project(point - origin);
+          if(inputCoord.x() < 0.001 || inputCoord.y() < 0.001
+             || inputCoord.x() > image1.columns() - 1.001
+             || inputCoord.y() > image1.rows() - 1.001) {
+            continue;
+          }
+          std::size_t i0 = static_cast<std::size_t>(inputCoord.x());
+          std::size_t j0 = static_cast<std::size_t>(inputCoord.y());
+          double xFrac = inputCoord.x() - i0;
+          double yFrac = inputCoord.y() - j0;
+          double reference =
+            ((1.0 - xFrac) * (1.0 - yFrac) * image1(j0, i0)
+             + xFrac * (1.0 - yFrac) * image1(j0, i0 + 1)
+             + (1.0 - xFrac) * yFrac * image1(j0 + 1, i0)
+             + xFrac * yFrac * image1(j0 + 1, i0 + 1));
+          BRICK_TEST_ASSERT(
+            std::fabs(rectified1(row, column) - reference)
+            < m_defaultTolerance);
+          ++numberOfValidPixels;
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfValidPixels > rectified1.size() / 2);
+    }
+
+
+    template <ImageFormat Format>
+    Image<Format>
+    StereoRectifierTest::
+    getRandomImage(std::size_t rows, std::size_t columns, int seed)
+    {
+      brick::random::PseudoRandom pseudoRandom(seed);
+      Image<Format> result(rows, columns);
+      for(std::size_t ii = 0; ii < result.size(); ++ii) {
+        result[ii] = static_cast<typename Image<Format>::PixelType>(
+          pseudoRandom.uniformInt(0, 256));
+      }
+      return result;
+    }
+
+
+    void
+    StereoRectifierTest::
+    getStereoRig(CameraIntrinsicsPlumbBob<double>& intrinsics0,
+                 CameraIntrinsicsPlumbBob<double>& intrinsics1,
+                 brick::numeric::Transform3D<double>& camera0FromWorld,
+                 brick::numeric::Transform3D<double>& camera1FromWorld,
+                 CameraIntrinsicsPinhole<double>& rectifiedIntrinsics0,
+                 CameraIntrinsicsPinhole<double>& rectifiedIntrinsics1,
+                 brick::numeric::Transform3D<double>& rcamera0FromWorld,
+                 brick::numeric::Transform3D<double>& rcamera1FromWorld)
+    {
+      // Slightly different, mildly distorted cameras.
+      intrinsics0 = CameraIntrinsicsPlumbBob<double>(
+        160, 120, 150.0, 155.0, 82.0, 57.0, 0.0, -0.05, 0.01, 0.0,
+        0.001, -0.002);
+      intrinsics1 = CameraIntrinsicsPlumbBob<double>(
+        160, 120, 148.0, 152.0, 78.0, 61.0, 0.0, -0.04, 0.005, 0.0,
+        -0.001, 0.001);
+
+      // Camera1 is 10cm to the right of camera0, and both are
+      // rotated slightly.
+      camera0FromWorld = brick::numeric::rollPitchYawToTransform3D(
+        brick::numeric::Vector3D<double>(0.02, -0.03, 0.01));
+      camera1FromWorld = brick::numeric::rollPitchYawToTransform3D(
+        brick::numeric::Vector3D<double>(-0.01, 0.02, -0.02));
+      camera1FromWorld = camera1FromWorld * brick::numeric::Transform3D<double>(
+        1.0, 0.0, 0.0, -0.1,
+        0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 1.0);
+
+      // stereoRectify() needs pinhole approximations of the cameras.
+      CameraIntrinsicsPinhole<double> pinhole0(
+        160, 120, 150.0, 155.0, 82.0, 57.0);
+      CameraIntrinsicsPinhole<double> pinhole1(
+        160, 120, 148.0, 152.0, 78.0, 61.0);
+      brick::numeric::Transform2D<double> image0FromRImage0;
+      brick::numeric::Transform2D<double> image1FromRImage1;
+      stereoRectify(pinhole0, pinhole1, camera0FromWorld, camera1FromWorld,
+                    rectifiedIntrinsics0, rectifiedIntrinsics1,
+                    rcamera0FromWorld, rcamera1FromWorld,
+                    image0FromRImage0, image1FromRImage1);
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::computerVision::StereoRectifierTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::computerVision::StereoRectifierTest currentTest;
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 ***************************************************************************
 **/
 
+#include <algorithm>
 #include <brick/computerVision/test/testImages.hh>
 #include <brick/computerVision/colorspaceConverter.hh>
 #include <brick/computerVision/image.hh>
@@ -17,6 +18,7 @@
 #include <brick/computerVision/utilities.hh>
 #include <brick/numeric/transform2D.hh>
 #include <brick/numeric/vector2D.hh>
+#include <brick/test/functors.hh>
 #include <brick/test/testFixture.hh>
 
 
@@ -37,6 +39,8 @@ namespace brick {
       // Tests.
       void testAssociateColorComponents();
       void testConvertColorspace();
+      void testConvertColorspaceFixedPoint();
+      void testConvertColorspaceYUV420();
       void testDissociateColorComponents();
       void testEstimateAffineTransform();
       void testSubsample();
@@ -56,6 +60,8 @@ namespace brick {
     {
       BRICK_TEST_REGISTER_MEMBER(testAssociateColorComponents);
       BRICK_TEST_REGISTER_MEMBER(testConvertColorspace);
+      BRICK_TEST_REGISTER_MEMBER(testConvertColorspaceFixedPoint);
+      BRICK_TEST_REGISTER_MEMBER(testConvertColorspaceYUV420);
       BRICK_TEST_REGISTER_MEMBER(testDissociateColorComponents);
       BRICK_TEST_REGISTER_MEMBER(testEstimateAffineTransform);
       BRICK_TEST_REGISTER_MEMBER(testSubsample);
@@ -115,6 +121,144 @@ namespace brick {
             rgbaImage[pixelIndex] == converter(inputImage2[pixelIndex]));
         }
       }
+
+      // The into-buffer version should give identical results, and
+      // should write into the buffer it's given.
+      {
+        Image<GRAY8> referenceImage = convertColorspace<GRAY8>(inputImage2);
+        Image<GRAY8> grayImage(inputImage2.rows(), inputImage2.columns());
+        brick::common::UInt8* dataPtr = grayImage.data();
+        convertColorspace(inputImage2, grayImage);
+        BRICK_TEST_ASSERT(grayImage.data() == dataPtr);
+        for(size_t pixelIndex = 0; pixelIndex < inputImage2.size();
+            ++pixelIndex) {
+          BRICK_TEST_ASSERT(grayImage[pixelIndex] == referenceImage[pixelIndex]);
+        }
+
+        Image<GRAY8> badImage(inputImage2.rows() + 1, inputImage2.columns());
+        BRICK_TEST_ASSERT_EXCEPTION(
+          brick::common::ValueException,
+          convertColorspace(inputImage2, badImage));
+      }
+    }
+
+
+    void
+    UtilitiesTest::
+    testConvertColorspaceFixedPoint()
+    {
+      Image<RGB8> rgbImage = readPPM8(getTestImageFileNamePPM0());
+      Image<RGBA8> rgbaImage = convertColorspace<RGBA8>(rgbImage);
+      Image<BGRA8> bgraImage = convertColorspace<BGRA8>(rgbImage);
+      Image<GRAY8> grayImage(rgbImage.rows(), rgbImage.columns());
+      Image<GRAY8> grayImage1(rgbImage.rows(), rgbImage.columns());
+      Image<GRAY8> grayImage2(rgbImage.rows(), rgbImage.columns());
+
+      double const weights[2][3] = {
+        {0.299, 0.587, 0.114}, {0.2126, 0.7152, 0.0722}};
+      ColorStandard const standards[2] = {
+        COLOR_STANDARD_BT601, COLOR_STANDARD_BT709};
+      for(size_t ii = 0; ii < 2; ++ii) {
+        convertColorspace(rgbImage, grayImage, standards[ii]);
+        convertColorspace(rgbaImage, grayImage1, standards[ii]);
+        convertColorspace(bgraImage, grayImage2, standards[ii]);
+        for(size_t pixelIndex = 0; pixelIndex < rgbImage.size();
+            ++pixelIndex) {
+          PixelRGB8 const& pixel = rgbImage[pixelIndex];
+          double expected = (weights[ii][0] * pixel.red
+                             + weights[ii][1] * pixel.green
+                             + weights[ii][2] * pixel.blue);
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(
+              double(grayImage[pixelIndex]), expected, 1.0));
+          BRICK_TEST_ASSERT(grayImage1[pixelIndex] == grayImage[pixelIndex]);
+          BRICK_TEST_ASSERT(grayImage2[pixelIndex] == grayImage[pixelIndex]);
+        }
+      }
+
+      // Saturated inputs should map to the ends of the range.
+      Image<RGB8> whiteImage(3, 5);
+      whiteImage = PixelRGB8(255, 255, 255);
+      Image<GRAY8> whiteGrayImage(3, 5);
+      convertColorspace(whiteImage, whiteGrayImage, COLOR_STANDARD_BT709);
+      for(size_t pixelIndex = 0; pixelIndex < whiteGrayImage.size();
+          ++pixelIndex) {
+        BRICK_TEST_ASSERT(whiteGrayImage[pixelIndex] == 255);
+      }
+
+      Image<GRAY8> badImage(rgbImage.rows(), rgbImage.columns() + 1);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        convertColorspace(rgbImage, badImage, COLOR_STANDARD_BT601));
+    }
+
+
+    void
+    UtilitiesTest::
+    testConvertColorspaceYUV420()
+    {
+      // Odd sizes exercise the partial chroma blocks at the edges.
+      size_t const rows = 7;
+      size_t const columns = 11;
+      Image<GRAY8> yPlane(rows, columns);
+      Image<GRAY8> uPlane((rows + 1) / 2, (columns + 1) / 2);
+      Image<GRAY8> vPlane((rows + 1) / 2, (columns + 1) / 2);
+      for(size_t pixelIndex = 0; pixelIndex < yPlane.size(); ++pixelIndex) {
+        yPlane[pixelIndex] =
+          static_cast<brick::common::UInt8>((pixelIndex * 37) % 256);
+      }
+      for(size_t pixelIndex = 0; pixelIndex < uPlane.size(); ++pixelIndex) {
+        uPlane[pixelIndex] =
+          static_cast<brick::common::UInt8>((pixelIndex * 53 + 7) % 256);
+        vPlane[pixelIndex] =
+          static_cast<brick::common::UInt8>((pixelIndex * 91 + 200) % 256);
+      }
+
+      // Reference coefficients: Kr, Kb for each standard.
+      double const kr[2] = {0.299, 0.2126};
+      double const kb[2] = {0.114, 0.0722};
+      ColorStandard const standards[2] = {
+        COLOR_STANDARD_BT601, COLOR_STANDARD_BT709};
+      Image<RGB8> rgbImage(rows, columns);
+      for(size_t ii = 0; ii < 2; ++ii) {
+        for(int fullRange = 0; fullRange < 2; ++fullRange) {
+          convertColorspace(yPlane, uPlane, vPlane, rgbImage, standards[ii],
+                            fullRange != 0);
+          double kg = 1.0 - kr[ii] - kb[ii];
+          double yScale = fullRange ? 1.0 : 255.0 / 219.0;
+          double cScale = fullRange ? 1.0 : 255.0 / 224.0;
+          double yOffset = fullRange ? 0.0 : 16.0;
+          for(size_t row = 0; row < rows; ++row) {
+            for(size_t column = 0; column < columns; ++column) {
+              double yy = yScale * (yPlane(row, column) - yOffset);
+              double uu = cScale * (uPlane(row / 2, column / 2) - 128.0);
+              double vv = cScale * (vPlane(row / 2, column / 2) - 128.0);
+              double red = yy + 2.0 * (1.0 - kr[ii]) * vv;
+              double blue = yy + 2.0 * (1.0 - kb[ii]) * uu;
+              double green = (yy - kr[ii] * red - kb[ii] * blue) / kg;
+              red = std::max(0.0, std::min(255.0, red));
+              green = std::max(0.0, std::min(255.0, green));
+              blue = std::max(0.0, std::min(255.0, blue));
+              PixelRGB8 const& pixel = rgbImage(row, column);
+              BRICK_TEST_ASSERT(
+                test::approximatelyEqual(double(pixel.red), red, 1.0));
+              BRICK_TEST_ASSERT(
+                test::approximatelyEqual(double(pixel.green), green, 1.0));
+              BRICK_TEST_ASSERT(
+                test::approximatelyEqual(double(pixel.blue), blue, 1.0));
+            }
+          }
+        }
+      }
+
+      Image<GRAY8> badPlane(rows / 2, columns / 2);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        convertColorspace(yPlane, badPlane, vPlane, rgbImage));
+      Image<RGB8> badImage(rows, columns + 1);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        convertColorspace(yPlane, uPlane, vPlane, badImage));
     }
 
 
@@ -0,0 +1,227 @@
+/**
+***************************************************************************
+* @file brick/computerVision/utilities.cc
+*
+* Source file defining fixed point colorspace conversion routines.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+*/
+
+#include <brick/computerVision/utilities.hh>
+
+namespace brick {
+
+  namespace computerVision {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Luma weights, scaled by 2^16 so that they sum to exactly 65536.
+      struct LumaCoefficients {
+        common::Int32 red;
+        common::Int32 green;
+        common::Int32 blue;
+      };
+
+
+      // Coefficients for converting YCbCr to RGB, scaled by 2^14.
+      struct ChromaCoefficients {
+        common::Int32 yOffset;
+        common::Int32 yScale;
+        common::Int32 redFromV;
+        common::Int32 greenFromU;
+        common::Int32 greenFromV;
+        common::Int32 blueFromU;
+      };
+
+
+      inline LumaCoefficients
+      getLumaCoefficients(ColorStandard standard)
+      {
+        LumaCoefficients result;
+        if(standard == COLOR_STANDARD_BT709) {
+          result.red = 13933;     // 0.2126
+          result.green = 46871;   // 0.7152
+          result.blue = 4732;     // 0.0722
+        } else {
+          result.red = 19595;     // 0.299
+          result.green = 38470;   // 0.587
+          result.blue = 7471;     // 0.114
+        }
+        return result;
+      }
+
+
+      inline ChromaCoefficients
+      getChromaCoefficients(ColorStandard standard, bool isFullRange)
+      {
+        ChromaCoefficients result;
+        if(isFullRange) {
+          result.yOffset = 0;
+          result.yScale = 16384;
+          if(standard == COLOR_STANDARD_BT709) {
+            result.redFromV = 25802;    // 1.5748
+            result.greenFromU = 3069;   // 0.1873
+            result.greenFromV = 7670;   // 0.4681
+            result.blueFromU = 30402;   // 1.8556
+          } else {
+            result.redFromV = 22970;    // 1.402
+            result.greenFromU = 5638;   // 0.3441
+            result.greenFromV = 11700;  // 0.7141
+            result.blueFromU = 29032;   // 1.772
+          }
+        } else {
+          // Studio swing: luma is expanded by 255/219, and chroma by
+          // 255/224.
+          result.yOffset = 16;
+          result.yScale = 19077;        // 1.1644
+          if(standard == COLOR_STANDARD_BT709) {
+            result.redFromV = 29372;    // 1.7927
+            result.greenFromU = 3494;   // 0.2132
+            result.greenFromV = 8731;   // 0.5329
+            result.blueFromU = 34610;   // 2.1124
+          } else {
+            result.redFromV = 26149;    // 1.5960
+            result.greenFromU = 6419;   // 0.3918
+            result.greenFromV = 13320;  // 0.8130
+            result.blueFromU = 33050;   // 2.0172
+          }
+        }
+        return result;
+      }
+
+
+      // Round a 14-bit fixed point value and saturate it to [0, 255].
+      inline common::UInt8
+      roundAndClamp14(common::Int32 value)
+      {
+        value += (1 << 13);
+        value = (value < 0) ? 0 : value;
+        value >>= 14;
+        return static_cast<common::UInt8>((value > 255) ? 255 : value);
+      }
+
+
+      // All of the 8-bit color pixel types name their members red,
+      // green, and blue, so one kernel serves RGB8, BGRA8, and RGBA8.
+      template <ImageFormat FORMAT>
+      void
+      convertToLuma(const Image<FORMAT>& inputImage,
+                    Image<GRAY8>& outputImage,
+                    ColorStandard standard)
+      {
+        if(outputImage.rows() != inputImage.rows()
+           || outputImage.columns() != inputImage.columns()) {
+          BRICK_THROW(common::ValueException, "convertColorspace()",
+                      "Input and output images must have the same shape.");
+        }
+        LumaCoefficients const coefficients = getLumaCoefficients(standard);
+        size_t const columns = inputImage.columns();
+        for(size_t row = 0; row < inputImage.rows(); ++row) {
+          typename Image<FORMAT>::PixelType const* inputPtr =
+            inputImage.rowBegin(row);
+          common::UInt8* outputPtr = outputImage.rowBegin(row);
+
+          // Weights sum to 2^16, so the result can't exceed 255 and
+          // no clamping is needed.  This loop has no branches, and
+          // vectorizes well.
+          for(size_t column = 0; column < columns; ++column) {
+            common::UInt32 luma =
+              coefficients.red * common::UInt32(inputPtr[column].red)
+              + coefficients.green * common::UInt32(inputPtr[column].green)
+              + coefficients.blue * common::UInt32(inputPtr[column].blue)
+              + (1u << 15);
+            outputPtr[column] = static_cast<common::UInt8>(luma >> 16);
+          }
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // This function computes the fixed point luma of an RGB8 image.
+    void
+    convertColorspace(const Image<RGB8>& inputImage,
+                      Image<GRAY8>& outputImage,
+                      ColorStandard standard)
+    {
+      privateCode::convertToLuma(inputImage, outputImage, standard);
+    }
+
+
+    // This function computes the fixed point luma of a BGRA8 image.
+    void
+    convertColorspace(const Image<BGRA8>& inputImage,
+                      Image<GRAY8>& outputImage,
+                      ColorStandard standard)
+    {
+      privateCode::convertToLuma(inputImage, outputImage, standard);
+    }
+
+
+    // This function computes the fixed point luma of an RGBA8 image.
+    void
+    convertColorspace(const Image<RGBA8>& inputImage,
+                      Image<GRAY8>& outputImage,
+                      ColorStandard standard)
+    {
+      privateCode::convertToLuma(inputImage, outputImage, standard);
+    }
+
+
+    // This function converts planar YUV 4:2:0 data to RGB8.
+    void
+    convertColorspace(const Image<GRAY8>& yPlane,
+                      const Image<GRAY8>& uPlane,
+                      const Image<GRAY8>& vPlane,
+                      Image<RGB8>& outputImage,
+                      ColorStandard standard,
+                      bool isFullRange)
+    {
+      size_t const rows = yPlane.rows();
+      size_t const columns = yPlane.columns();
+      size_t const chromaRows = (rows + 1) / 2;
+      size_t const chromaColumns = (columns + 1) / 2;
+      if(uPlane.rows() != chromaRows || uPlane.columns() != chromaColumns
+         || vPlane.rows() != chromaRows || vPlane.columns() != chromaColumns) {
+        BRICK_THROW(common::ValueException, "convertColorspace()",
+                    "Chroma planes must be half the size of the luma plane, "
+                    "rounded up.");
+      }
+      if(outputImage.rows() != rows || outputImage.columns() != columns) {
+        BRICK_THROW(common::ValueException, "convertColorspace()",
+                    "Output image must have the same shape as the luma "
+                    "plane.");
+      }
+
+      privateCode::ChromaCoefficients const coefficients =
+        privateCode::getChromaCoefficients(standard, isFullRange);
+      for(size_t row = 0; row < rows; ++row) {
+        common::UInt8 const* yPtr = yPlane.rowBegin(row);
+        common::UInt8 const* uPtr = uPlane.rowBegin(row / 2);
+        common::UInt8 const* vPtr = vPlane.rowBegin(row / 2);
+        PixelRGB8* outputPtr = outputImage.rowBegin(row);
+        for(size_t column = 0; column < columns; ++column) {
+          common::Int32 luma =
+            coefficients.yScale
+            * (common::Int32(yPtr[column]) - coefficients.yOffset);
+          common::Int32 uu = common::Int32(uPtr[column >> 1]) - 128;
+          common::Int32 vv = common::Int32(vPtr[column >> 1]) - 128;
+          outputPtr[column].red = privateCode::roundAndClamp14(
+            luma + coefficients.redFromV * vv);
+          outputPtr[column].green = privateCode::roundAndClamp14(
+            luma - coefficients.greenFromU * uu
+            - coefficients.greenFromV * vv);
+          outputPtr[column].blue = privateCode::roundAndClamp14(
+            luma + coefficients.blueFromU * uu);
+        }
+      }
+    }
+
+  } // namespace computerVision
+
+} // namespace brick
@@ -116,7 +116,8 @@ namespace brick {
      * one-to-one mapping between input and output pixel types.  When
      * converting between formats which don't match this requirement,
      * such as when converting from RGB8 to YUV420, please use a
-     * different routine.
+     * different routine.  To avoid allocating a new image for each
+     * call, use the two-argument overload below.
      *
      * @param inputImage This argument is the image to be converted.
      *
@@ -127,6 +128,144 @@ namespace brick {
     convertColorspace(const Image<INPUT_FORMAT>& inputImage);
 
 
+    /**
+     * This function is just like convertColorspace(const
+     * Image<INPUT_FORMAT>&), except that it writes into an existing
+     * image rather than allocating a new one, and converts a row at a
+     * time without going through std::transform().  The results are
+     * identical.  Use it as follows:
+     *
+     *   convertColorspace(myRGB8Image, myPreallocatedHSVImage);
+     *
+     * @param inputImage This argument is the image to be converted.
+     *
+     * @param outputImage This argument is the image into which the
+     * result will be written.  It must have the same number of rows
+     * and columns as inputImage, and will not be reallocated.
+     */
+    template<ImageFormat OUTPUT_FORMAT, ImageFormat INPUT_FORMAT>
+    void
+    convertColorspace(const Image<INPUT_FORMAT>& inputImage,
+                      Image<OUTPUT_FORMAT>& outputImage);
+
+
+    /**
+     ** This enum selects the set of luma and chroma coefficients used
+     ** by the fixed point color conversion routines below.  BT.601 is
+     ** the traditional standard definition television matrix, and is
+     ** also used by JPEG.  BT.709 is the high definition television
+     ** matrix, and is what most HD cameras and video encoders produce.
+     **/
+    enum ColorStandard {
+      COLOR_STANDARD_BT601,
+      COLOR_STANDARD_BT709
+    };
+
+
+    /**
+     * This function computes the luma of each pixel of an 8-bit color
+     * image using the weights from the specified standard.  It uses
+     * 16-bit fixed point arithmetic in a simple loop that the compiler
+     * can vectorize, so it is several times faster than the floating
+     * point ColorspaceConverter<RGB8, GRAY8>.  Note that
+     * ColorspaceConverter<RGB8, GRAY8> uses older weights (0.3, 0.59,
+     * 0.11), so results differ slightly from convertColorspace(const
+     * Image<RGB8>&, Image<GRAY8>&).  Overloads for BGRA8 and RGBA8
+     * input follow, and ignore the alpha channel.
+     *
+     * @param inputImage This argument is the image to be converted.
+     *
+     * @param outputImage This argument is the image into which the
+     * result will be written.  It must have the same number of rows
+     * and columns as inputImage, and will not be reallocated.
+     *
+     * @param standard This argument specifies which luma weights to
+     * use.
+     */
+    void
+    convertColorspace(const Image<RGB8>& inputImage,
+                      Image<GRAY8>& outputImage,
+                      ColorStandard standard);
+
+
+    /**
+     * This function is identical to convertColorspace(const
+     * Image<RGB8>&, Image<GRAY8>&, ColorStandard), except that it
+     * accepts BGRA8 input.
+     *
+     * @param inputImage This argument is the image to be converted.
+     *
+     * @param outputImage This argument is the image into which the
+     * result will be written.
+     *
+     * @param standard This argument specifies which luma weights to
+     * use.
+     */
+    void
+    convertColorspace(const Image<BGRA8>& inputImage,
+                      Image<GRAY8>& outputImage,
+                      ColorStandard standard);
+
+
+    /**
+     * This function is identical to convertColorspace(const
+     * Image<RGB8>&, Image<GRAY8>&, ColorStandard), except that it
+     * accepts RGBA8 input.
+     *
+     * @param inputImage This argument is the image to be converted.
+     *
+     * @param outputImage This argument is the image into which the
+     * result will be written.
+     *
+     * @param standard This argument specifies which luma weights to
+     * use.
+     */
+    void
+    convertColorspace(const Image<RGBA8>& inputImage,
+                      Image<GRAY8>& outputImage,
+                      ColorStandard standard);
+
+
+    /**
+     * This function converts planar YUV 4:2:0 data (as produced by
+     * most cameras and video decoders, and often called I420) to
+     * RGB8.  Each chroma sample covers a 2x2 block of luma samples,
+     * and is replicated to all four of them.  The arithmetic is 14-bit
+     * fixed point, and is arranged so that the compiler can vectorize
+     * the inner loop.  If your data is in NV12 or YV12 order, simply
+     * pass the appropriate planes as uPlane and vPlane.
+     *
+     * @param yPlane This argument is the luma plane, with the same
+     * number of rows and columns as the output image.
+     *
+     * @param uPlane This argument is the Cb plane.  It must have
+     * (rows + 1) / 2 rows and (columns + 1) / 2 columns, where rows
+     * and columns are the dimensions of yPlane.
+     *
+     * @param vPlane This argument is the Cr plane, with the same
+     * dimensions as uPlane.
+     *
+     * @param outputImage This argument is the image into which the
+     * result will be written.  It must have the same number of rows
+     * and columns as yPlane, and will not be reallocated.
+     *
+     * @param standard This argument specifies which conversion matrix
+     * to use.
+     *
+     * @param isFullRange This argument should be set to false if the
+     * input uses "studio swing" (luma in [16, 235] and chroma in [16,
+     * 240]), which is normal for video, or true if all three channels
+     * use the full range [0, 255], as in JPEG.
+     */
+    void
+    convertColorspace(const Image<GRAY8>& yPlane,
+                      const Image<GRAY8>& uPlane,
+                      const Image<GRAY8>& vPlane,
+                      Image<RGB8>& outputImage,
+                      ColorStandard standard = COLOR_STANDARD_BT601,
+                      bool isFullRange = false);
+
+
     /**
      * This function returns by reference an array which either shares
      * or copies the data from the input image.
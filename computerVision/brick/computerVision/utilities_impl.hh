@@ -352,13 +352,39 @@ namespace brick {
     {
       Image<OUTPUT_FORMAT> outputImage(
 	inputImage.rows(), inputImage.columns());
-      ColorspaceConverter<INPUT_FORMAT, OUTPUT_FORMAT> converter;
-      std::transform(inputImage.begin(), inputImage.end(),
-                     outputImage.begin(), converter);
+      convertColorspace(inputImage, outputImage);
       return outputImage;
     }
 
 
+    // This function converts an image from one colorspace to another,
+    // writing the result into an existing image.
+    template<ImageFormat OUTPUT_FORMAT, ImageFormat INPUT_FORMAT>
+    void
+    convertColorspace(const Image<INPUT_FORMAT>& inputImage,
+                      Image<OUTPUT_FORMAT>& outputImage)
+    {
+      if(outputImage.rows() != inputImage.rows()
+         || outputImage.columns() != inputImage.columns()) {
+        BRICK_THROW(brick::common::ValueException, "convertColorspace()",
+                    "Input and output images must have the same shape.");
+      }
+      // Note that the two-argument ColorspaceConverter::operator()()
+      // is not virtual, and will be inlined here.
+      ColorspaceConverter<INPUT_FORMAT, OUTPUT_FORMAT> converter;
+      size_t const columns = inputImage.columns();
+      for(size_t row = 0; row < inputImage.rows(); ++row) {
+        typename Image<INPUT_FORMAT>::PixelType const* inputPtr =
+          inputImage.rowBegin(row);
+        typename Image<OUTPUT_FORMAT>::PixelType* outputPtr =
+          outputImage.rowBegin(row);
+        for(size_t column = 0; column < columns; ++column) {
+          converter(inputPtr[column], outputPtr[column]);
+        }
+      }
+    }
+
+
     // This function returns by reference an array which either shares
     // or copies the data from the input image.
     template<ImageFormat FORMAT>
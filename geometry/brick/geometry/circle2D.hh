@@ -108,6 +108,7 @@ namespace brick {
 
     /* ======= Non-member functions. ======= */
 
+    template <class Type>
     std::ostream&
     operator<<(std::ostream& stream, Circle2D<Type> const& circle);
 
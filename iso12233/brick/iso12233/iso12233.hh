@@ -14,6 +14,7 @@
 #ifndef BRICK_ISO12233_ISO12233_HH
 #define BRICK_ISO12233_ISO12233_HH
 
+#include <vector>
 #include <brick/iso12233/symbolImports.hh>
 
 namespace brick {
@@ -78,6 +79,51 @@ namespace brick {
     };
 
 
+    /**
+     ** This struct specifies one slanted-edge patch within a larger
+     ** image, for use with iso12233Batch().  The patch includes
+     ** corner0, and extends up to, but not including, corner1.
+     **/
+    struct Iso12233Roi {
+
+      Iso12233Roi() : corner0(0, 0), corner1(0, 0) {}
+
+      Iso12233Roi(Index2D const& upperLeftCorner,
+                  Index2D const& lowerRightCorner)
+        : corner0(upperLeftCorner), corner1(lowerRightCorner) {}
+
+      // Upper left corner of the patch (row, column).
+      Index2D corner0;
+
+      // One past the lower right corner of the patch (row, column).
+      Index2D corner1;
+    };
+
+
+    /**
+     ** This struct reports the result of running the e-SFR algorithm
+     ** on one region of interest.  See iso12233Batch().
+     **/
+    template <class FloatType>
+    struct Iso12233Result {
+
+      // True if the e-SFR algorithm succeeded on this region.  If
+      // false, sfr is empty, and mtf50 and mtf10 are negative.
+      bool isValid = false;
+
+      // The computed MTF, exactly as returned by iso12233().
+      Array1D<FloatType> sfr;
+
+      // Spatial frequency, in cycles per pixel, at which the MTF
+      // first drops to 0.5.  Negative if it never does.
+      FloatType mtf50 = FloatType(-1);
+
+      // Spatial frequency, in cycles per pixel, at which the MTF
+      // first drops to 0.1.  Negative if it never does.
+      FloatType mtf10 = FloatType(-1);
+    };
+
+
     /**
      * This function implements the ISO-12233 e-SFR algorithm as
      * closely as possible.
@@ -120,6 +166,79 @@ namespace brick {
              ConversionFunction const& oecf,
              Iso12233Config const& config = Iso12233Config());
 
+
+    /**
+     * This function runs the e-SFR algorithm on many regions of a
+     * single image, such as the slanted edges of a resolution chart.
+     * It gives the same MTF for each region as would calling
+     * iso12233() on a copy of that region, but shares the
+     * windowSize-dependent setup and per-region scratch images
+     * between regions, and processes regions in parallel.
+     *
+     * A region for which the e-SFR algorithm fails (for example,
+     * because its edge is too close to the side of the region) does
+     * not stop the others from being processed; the corresponding
+     * result simply has its isValid member set to false.
+     *
+     * @param inputImage This argument is the image containing the
+     * regions to be analyzed.
+     *
+     * @param roiVector This argument lists the regions to be
+     * analyzed.  Each one must lie entirely within inputImage, and
+     * must satisfy the requirements on argument inputPatch of
+     * iso12233().
+     *
+     * @param windowSize This argument has the same meaning as the
+     * corresponding argument of iso12233().
+     *
+     * @param oecf This argument has the same meaning as the
+     * corresponding argument of iso12233().  It will be called
+     * concurrently from several threads, so it must be thread-safe.
+     *
+     * @param config This argument controls the operation of the
+     * e-SFR algorithm for every region.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  Setting it to zero uses one thread
+     * per hardware core.
+     *
+     * @return The return value has one element for each element of
+     * roiVector, in the same order.
+     */
+    template <class FloatType,
+              ImageFormat InputFormat,
+              class ConversionFunction>
+    std::vector< Iso12233Result<FloatType> >
+    iso12233Batch(Image<InputFormat> const& inputImage,
+                  std::vector<Iso12233Roi> const& roiVector,
+                  std::size_t windowSize,
+                  ConversionFunction const& oecf,
+                  Iso12233Config const& config = Iso12233Config(),
+                  std::size_t numberOfThreads = 0);
+
+
+    /**
+     * This function finds the spatial frequency at which an MTF
+     * (such as the one returned by iso12233()) first drops to a
+     * specified level, interpolating linearly between samples.  For
+     * example, setting threshold to 0.5 gives the commonly reported
+     * MTF50 figure.
+     *
+     * @param sfr This argument is the MTF to be searched.  Element k
+     * of sfr is assumed to correspond to a spatial frequency of (k /
+     * sfr.size()) cycles per pixel, as is the case for the output of
+     * iso12233().
+     *
+     * @param threshold This argument is the level being sought.
+     *
+     * @return The return value is the spatial frequency, in cycles
+     * per pixel, of the first crossing, or -1 if sfr never drops to
+     * threshold.
+     */
+    template <class FloatType>
+    FloatType
+    getSFRCrossing(Array1D<FloatType> const& sfr, FloatType threshold);
+
   } // namespace iso12233
 
 } // namespace brick
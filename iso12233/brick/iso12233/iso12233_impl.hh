@@ -19,8 +19,11 @@
 //
 // #include <brick/iso12233/iso12233.hh>
 
+#include <atomic>
 #include <complex>
+#include <vector>
 
+#include <brick/common/parallel.hh>
 // #include <brick/linearAlgebra/linearAlgebra.hh>
 #include <brick/computerVision/fitPolynomial.hh>
 #include <brick/numeric/fft.hh>
@@ -53,12 +56,37 @@ namespace brick {
       Array1D<FloatType>
       computeSFR(Array1D<FloatType> const& lineSpreadFunction);
 
+      // Run the format-independent part of the e-SFR algorithm
+      // (paragraphs 6.2.3 through 6.2.5 of the standard) on an
+      // OECF-corrected, correctly oriented patch.  Argument
+      // windowFunction is the Hamming window to be applied to the
+      // supersampled line spread function, and must have (4 *
+      // windowSize) elements.
+      template <class FloatType>
+      Array1D<FloatType>
+      computeSFRFromReflectance(Array2D<FloatType> const& reflectanceImage,
+                                std::size_t windowSize,
+                                Array1D<FloatType> const& windowFunction,
+                                Iso12233Config const& config);
+
       // Approximate the derivative along each row using [-1/2, 1/2]
       // FIR filter.
       template <class FloatType>
       Array2D<FloatType>
       computeTwoElementDerivative(Array2D<FloatType> const& inputImage);
 
+      // Apply the OECF to inputPatch, reorienting it first if
+      // config.reorientPatch is set.  Argument reflectanceImage must
+      // already have the same number of elements as inputPatch.
+      template <class FloatType,
+                ImageFormat InputFormat,
+                class ConversionFunction>
+      void
+      correctPatch(Array2D<FloatType>& reflectanceImage,
+                   Image<InputFormat> const& inputPatch,
+                   ConversionFunction const& oecf,
+                   Iso12233Config const& config);
+
       template <class FloatType>
       void
       estimateEdgeShape(brick::numeric::Polynomial<FloatType>& edgeShape,
@@ -141,58 +169,131 @@ namespace brick {
       // correction, etc.
       Array2D<FloatType> reflectanceImage(inputPatch.rows(),
                                           inputPatch.columns());
-      if(config.reorientPatch) {
-        // If requested, rotate/flip the patch so that it matches the
-        // canonical orientation of dark on the left, light on the
-        // right, with a nearly-vertical edge.
-        privateCode::reorientAndCorrectPatch(reflectanceImage, inputPatch,
-                                             oecf);
-      } else {
-        std::transform(inputPatch.begin(), inputPatch.end(),
-                       reflectanceImage.begin(), oecf);
+      privateCode::correctPatch(reflectanceImage, inputPatch, oecf, config);
+
+      // The remaining steps don't depend on the input pixel format.
+      Array1D<FloatType> windowFunction =
+        brick::numeric::getHammingWindow1D<FloatType>(windowSize << 2);
+      return privateCode::computeSFRFromReflectance(
+        reflectanceImage, windowSize, windowFunction, config);
+    }
+
+
+    // This function runs the e-SFR algorithm on many regions of a
+    // single image.
+    template <class FloatType,
+              ImageFormat InputFormat,
+              class ConversionFunction>
+    std::vector< Iso12233Result<FloatType> >
+    iso12233Batch(Image<InputFormat> const& inputImage,
+                  std::vector<Iso12233Roi> const& roiVector,
+                  std::size_t windowSize,
+                  ConversionFunction const& oecf,
+                  Iso12233Config const& config,
+                  std::size_t numberOfThreads)
+    {
+      // Argument checking.  Out-of-bounds regions are a programming
+      // error, rather than a property of the image data, so they
+      // abort the whole batch.
+      for(Iso12233Roi const& roi : roiVector) {
+        if(roi.corner0.getRow() < 0 || roi.corner0.getColumn() < 0
+           || roi.corner1.getRow() > static_cast<int>(inputImage.rows())
+           || roi.corner1.getColumn() > static_cast<int>(inputImage.columns())
+           || roi.corner1.getRow() <= roi.corner0.getRow()
+           || roi.corner1.getColumn() <= roi.corner0.getColumn()) {
+          BRICK_THROW(brick::common::ValueException, "iso12233Batch()",
+                      "Each element of argument roiVector must describe a "
+                      "non-empty region inside argument inputImage.");
+        }
       }
 
-      // Paragraph 6.2.3 of the standard.  We assume the edge is close
-      // to vertical in the image (nearly aligned with the image
-      // columns).  The standard calls for computing slope and offset
-      // so that y ~= slope*x + offset, where y is column location of
-      // the edge, and x is the row number.  This reverses the
-      // conventional meanings of x and y (which normally mean column
-      // and row, respectively), but is consistent with the variable
-      // definitions in the standard.  By representing slope and
-      // offset as a polynomial, we make it easy to use higher-order
-      // shapes (quadratics, cubics) if the lens has significant
-      // distortion.  The degree of this polynomial is controlled by
-      // the config member variable polynomialOrder.
-      brick::numeric::Polynomial<FloatType> edgeShape;
-      privateCode::estimateEdgeShape(
-        edgeShape, reflectanceImage, windowSize, config);
-
-      // Paragraph 6.2.4 of the standard: align the edges in all of (or a
-      // plurality of) the rows.  Because the line crosses each row at a
-      // different (non-integer) column location, this alignment gives us
-      // a bunch of differently-phased samplings of the edge.  The shifted
-      // pixel locations of each row are then projected into new pixel
-      // "bins," which are of finer pitch than the original pixel array,
-      // creating a supersampled estimate of the edge shape.  The array
-      // lineSpreadFunction is just the finite-differences derivative of
-      // edgeSpreadFunction.
-      Array1D<FloatType> edgeSpreadFunction = privateCode::shiftAndCombineRows(
-        reflectanceImage, windowSize, edgeShape);
-      Array1D<FloatType> lineSpreadFunction = privateCode::computeDerivative(
-        edgeSpreadFunction);
-
-      // Paragraph 6.2.5 of the standard: Compute spectral frequency response.
-      Array1D<FloatType> centeredLineSpreadFunction =
-        privateCode::centerMaximum(lineSpreadFunction);
+      // The Hamming window depends only on windowSize, so all
+      // regions can share it.
       Array1D<FloatType> windowFunction =
-        brick::numeric::getHammingWindow1D<FloatType>(
-          centeredLineSpreadFunction.size());
-      centeredLineSpreadFunction *= windowFunction;
-      Array1D<FloatType> sfr = privateCode::computeSFR(
-        centeredLineSpreadFunction);
+        brick::numeric::getHammingWindow1D<FloatType>(windowSize << 2);
+
+      // Rather than one task per region, we run one task per thread,
+      // and let each task claim regions until there are none left.
+      // This lets each task hold on to its scratch images, which are
+      // only reallocated when consecutive regions differ in size (in
+      // a typical resolution chart, all regions are the same size).
+      std::vector< Iso12233Result<FloatType> > resultVector(roiVector.size());
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
+      }
+      std::atomic<std::size_t> nextRoi(0);
+      brick::common::executeInParallel(
+        std::min(numberOfThreads, roiVector.size()),
+        [&](std::size_t /* taskIndex */) {
+          Image<InputFormat> patch;
+          Array2D<FloatType> reflectanceImage;
+          while(1) {
+            std::size_t const roiIndex = nextRoi.fetch_add(1);
+            if(roiIndex >= roiVector.size()) {
+              break;
+            }
+            Iso12233Roi const& roi = roiVector[roiIndex];
+            std::size_t const startRow = roi.corner0.getRow();
+            std::size_t const startColumn = roi.corner0.getColumn();
+            std::size_t const patchRows = roi.corner1.getRow() - startRow;
+            std::size_t const patchColumns =
+              roi.corner1.getColumn() - startColumn;
+
+            // Copy the region into this task's scratch patch.
+            patch.reinitIfNecessary(patchRows, patchColumns);
+            for(std::size_t rr = 0; rr < patchRows; ++rr) {
+              std::copy(inputImage.data(startRow + rr, startColumn),
+                        inputImage.data(startRow + rr, startColumn)
+                        + patchColumns,
+                        patch.data(rr, 0));
+            }
+            reflectanceImage.reinitIfNecessary(patchRows, patchColumns);
+
+            Iso12233Result<FloatType>& result = resultVector[roiIndex];
+            try {
+              privateCode::correctPatch(
+                reflectanceImage, patch, oecf, config);
+              result.sfr = privateCode::computeSFRFromReflectance(
+                reflectanceImage, windowSize, windowFunction, config);
+            } catch(brick::common::ValueException const&) {
+              // The e-SFR algorithm didn't like this region.  Leave
+              // the result marked as invalid, and move on.
+              continue;
+            }
+            result.mtf50 = getSFRCrossing(result.sfr, FloatType(0.5));
+            result.mtf10 = getSFRCrossing(result.sfr, FloatType(0.1));
+            result.isValid = true;
+          }
+        },
+        numberOfThreads);
+      return resultVector;
+    }
 
-      return sfr;
+
+    // This function finds the spatial frequency at which an MTF
+    // first drops to a specified level.
+    template <class FloatType>
+    FloatType
+    getSFRCrossing(Array1D<FloatType> const& sfr, FloatType threshold)
+    {
+      if(sfr.empty()) {
+        return FloatType(-1);
+      }
+      if(sfr[0] <= threshold) {
+        return FloatType(0);
+      }
+      FloatType const frequencyStep =
+        FloatType(1) / static_cast<FloatType>(sfr.size());
+      for(std::size_t kk = 1; kk < sfr.size(); ++kk) {
+        if(sfr[kk] <= threshold) {
+          // Interpolate between samples kk - 1 and kk.  We know that
+          // sfr[kk - 1] > threshold >= sfr[kk], so no divide by zero.
+          FloatType fraction = ((sfr[kk - 1] - threshold)
+                                / (sfr[kk - 1] - sfr[kk]));
+          return (static_cast<FloatType>(kk - 1) + fraction) * frequencyStep;
+        }
+      }
+      return FloatType(-1);
     }
 
   } // namespace iso12233
@@ -316,6 +417,53 @@ namespace brick {
       }
 
 
+      // Run paragraphs 6.2.3 through 6.2.5 of the standard on an
+      // OECF-corrected, correctly oriented patch.
+      template <class FloatType>
+      Array1D<FloatType>
+      computeSFRFromReflectance(Array2D<FloatType> const& reflectanceImage,
+                                std::size_t windowSize,
+                                Array1D<FloatType> const& windowFunction,
+                                Iso12233Config const& config)
+      {
+        // Paragraph 6.2.3 of the standard.  We assume the edge is close
+        // to vertical in the image (nearly aligned with the image
+        // columns).  The standard calls for computing slope and offset
+        // so that y ~= slope*x + offset, where y is column location of
+        // the edge, and x is the row number.  This reverses the
+        // conventional meanings of x and y (which normally mean column
+        // and row, respectively), but is consistent with the variable
+        // definitions in the standard.  By representing slope and
+        // offset as a polynomial, we make it easy to use higher-order
+        // shapes (quadratics, cubics) if the lens has significant
+        // distortion.  The degree of this polynomial is controlled by
+        // the config member variable polynomialOrder.
+        brick::numeric::Polynomial<FloatType> edgeShape;
+        estimateEdgeShape(edgeShape, reflectanceImage, windowSize, config);
+
+        // Paragraph 6.2.4 of the standard: align the edges in all of (or a
+        // plurality of) the rows.  Because the line crosses each row at a
+        // different (non-integer) column location, this alignment gives us
+        // a bunch of differently-phased samplings of the edge.  The shifted
+        // pixel locations of each row are then projected into new pixel
+        // "bins," which are of finer pitch than the original pixel array,
+        // creating a supersampled estimate of the edge shape.  The array
+        // lineSpreadFunction is just the finite-differences derivative of
+        // edgeSpreadFunction.
+        Array1D<FloatType> edgeSpreadFunction = shiftAndCombineRows(
+          reflectanceImage, windowSize, edgeShape);
+        Array1D<FloatType> lineSpreadFunction = computeDerivative(
+          edgeSpreadFunction);
+
+        // Paragraph 6.2.5 of the standard: Compute spectral frequency
+        // response.
+        Array1D<FloatType> centeredLineSpreadFunction =
+          centerMaximum(lineSpreadFunction);
+        centeredLineSpreadFunction *= windowFunction;
+        return computeSFR(centeredLineSpreadFunction);
+      }
+
+
       // Approximate the derivative along each row using [-1/2, 1/2]
       // FIR filter.
       template <class FloatType>
@@ -338,6 +486,29 @@ namespace brick {
       }
 
 
+      // Apply the OECF to inputPatch, reorienting it first if
+      // requested.
+      template <class FloatType,
+                ImageFormat InputFormat,
+                class ConversionFunction>
+      void
+      correctPatch(Array2D<FloatType>& reflectanceImage,
+                   Image<InputFormat> const& inputPatch,
+                   ConversionFunction const& oecf,
+                   Iso12233Config const& config)
+      {
+        if(config.reorientPatch) {
+          // If requested, rotate/flip the patch so that it matches the
+          // canonical orientation of dark on the left, light on the
+          // right, with a nearly-vertical edge.
+          reorientAndCorrectPatch(reflectanceImage, inputPatch, oecf);
+        } else {
+          std::transform(inputPatch.begin(), inputPatch.end(),
+                         reflectanceImage.begin(), oecf);
+        }
+      }
+
+
       template <class FloatType>
       void
       estimateEdgeShape(brick::numeric::Polynomial<FloatType>& edgeShape,
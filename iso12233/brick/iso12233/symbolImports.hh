@@ -19,6 +19,7 @@
 #include <brick/computerVision/imageFormatTraits.hh>
 #include <brick/numeric/array1D.hh>
 #include <brick/numeric/array2D.hh>
+#include <brick/numeric/index2D.hh>
 
 namespace brick {
 
@@ -30,6 +31,7 @@ namespace brick {
 
     using brick::numeric::Array1D;
     using brick::numeric::Array2D;
+    using brick::numeric::Index2D;
 
   } // namespace iso12233
 
@@ -40,6 +40,8 @@ namespace brick {
       void tearDown(const std::string& /* testName */) {}
 
       // Tests.
+      void testGetSFRCrossing();
+      void testIso12233Batch();
       void testLowPassEdge();
       void testVerticalEdge();
 #if HAVE_LIBPNG
@@ -68,6 +70,8 @@ namespace brick {
       : brick::test::TestFixture<Iso12233Test>("Iso12233Test"),
         m_defaultTolerance(1.0E-8)
     {
+      BRICK_TEST_REGISTER_MEMBER(testGetSFRCrossing);
+      BRICK_TEST_REGISTER_MEMBER(testIso12233Batch);
       BRICK_TEST_REGISTER_MEMBER(testLowPassEdge);
       BRICK_TEST_REGISTER_MEMBER(testVerticalEdge);
 #if HAVE_LIBPNG
@@ -76,6 +80,116 @@ namespace brick {
     }
 
 
+    void
+    Iso12233Test::
+    testGetSFRCrossing()
+    {
+      // Element k of the SFR corresponds to k / 8 cycles per pixel.
+      Array1D<double> sfr("[1.0, 0.9, 0.7, 0.4, 0.2, 0.1, 0.05, 0.0]");
+      BRICK_TEST_ASSERT(
+        std::fabs(getSFRCrossing(sfr, 0.5) - (2.0 + 2.0 / 3.0) / 8.0)
+        < m_defaultTolerance);
+      BRICK_TEST_ASSERT(
+        std::fabs(getSFRCrossing(sfr, 0.1) - 5.0 / 8.0) < m_defaultTolerance);
+      BRICK_TEST_ASSERT(getSFRCrossing(sfr, 1.0) == 0.0);
+      BRICK_TEST_ASSERT(getSFRCrossing(sfr, -0.5) < 0.0);
+      BRICK_TEST_ASSERT(getSFRCrossing(Array1D<double>(), 0.5) < 0.0);
+    }
+
+
+    void
+    Iso12233Test::
+    testIso12233Batch()
+    {
+      constexpr std::size_t patchWidth = 128;
+      constexpr std::size_t patchHeight = 100;
+      constexpr std::size_t windowSize = 64;
+      auto oecf = [](double arg){return arg;};
+
+      // Build a "chart" containing several copies of a slanted edge
+      // with different amounts of blur and different orientations,
+      // plus one flat region that the e-SFR algorithm must reject.
+      std::vector<double> sigmas = {0.7, 1.2, 0.9, 1.5};
+      Image<GRAY8> chart(2 * patchHeight + 10, 3 * patchWidth);
+      chart = 150;
+      std::vector<Iso12233Roi> roiVector;
+      std::vector< Image<GRAY8> > patches;
+      for(std::size_t ii = 0; ii < sigmas.size(); ++ii) {
+        Array1D<double> referenceMtf;
+        Image<GRAY8> patch = this->buildSlantedEdgeImage(
+          referenceMtf, patchHeight, patchWidth, windowSize, sigmas[ii]);
+        if(ii % 2 == 1) {
+          // Rotate 180 degrees so that the batch has to reorient.
+          Image<GRAY8> rotated(patchHeight, patchWidth);
+          for(std::size_t rr = 0; rr < patchHeight; ++rr) {
+            for(std::size_t cc = 0; cc < patchWidth; ++cc) {
+              rotated(rr, cc) =
+                patch(patchHeight - 1 - rr, patchWidth - 1 - cc);
+            }
+          }
+          patch = rotated;
+        }
+        std::size_t startRow = (ii / 2) * (patchHeight + 10);
+        std::size_t startColumn = (ii % 2) * patchWidth;
+        for(std::size_t rr = 0; rr < patchHeight; ++rr) {
+          for(std::size_t cc = 0; cc < patchWidth; ++cc) {
+            chart(startRow + rr, startColumn + cc) = patch(rr, cc);
+          }
+        }
+        roiVector.push_back(
+          Iso12233Roi(Index2D(startRow, startColumn),
+                      Index2D(startRow + patchHeight,
+                              startColumn + patchWidth)));
+        patches.push_back(patch);
+      }
+      roiVector.push_back(
+        Iso12233Roi(Index2D(0, 2 * patchWidth),
+                    Index2D(patchHeight, 3 * patchWidth)));
+
+      for(std::size_t numberOfThreads = 1; numberOfThreads <= 3;
+          ++numberOfThreads) {
+        std::vector< Iso12233Result<double> > resultVector =
+          iso12233Batch<double>(chart, roiVector, windowSize, oecf,
+                                Iso12233Config(), numberOfThreads);
+        BRICK_TEST_ASSERT(resultVector.size() == roiVector.size());
+
+        // Each edge should give exactly what the single-patch
+        // function gives.
+        for(std::size_t ii = 0; ii < patches.size(); ++ii) {
+          Array1D<double> mtf = iso12233<double>(patches[ii], windowSize,
+                                                 oecf);
+          Iso12233Result<double> const& result = resultVector[ii];
+          BRICK_TEST_ASSERT(result.isValid);
+          BRICK_TEST_ASSERT(result.sfr.size() == mtf.size());
+          for(std::size_t kk = 0; kk < mtf.size(); ++kk) {
+            BRICK_TEST_ASSERT(result.sfr[kk] == mtf[kk]);
+          }
+          BRICK_TEST_ASSERT(result.mtf50 == getSFRCrossing(mtf, 0.5));
+          BRICK_TEST_ASSERT(result.mtf10 == getSFRCrossing(mtf, 0.1));
+          BRICK_TEST_ASSERT(result.mtf50 > 0.0);
+          BRICK_TEST_ASSERT(result.mtf10 > result.mtf50);
+        }
+
+        // More blur means lower MTF50.
+        BRICK_TEST_ASSERT(resultVector[0].mtf50 > resultVector[2].mtf50);
+        BRICK_TEST_ASSERT(resultVector[2].mtf50 > resultVector[1].mtf50);
+        BRICK_TEST_ASSERT(resultVector[1].mtf50 > resultVector[3].mtf50);
+
+        // The flat region has no edge.
+        BRICK_TEST_ASSERT(!resultVector.back().isValid);
+        BRICK_TEST_ASSERT(resultVector.back().sfr.empty());
+        BRICK_TEST_ASSERT(resultVector.back().mtf50 < 0.0);
+      }
+
+      // Regions outside the image are an error.
+      std::vector<Iso12233Roi> badRoiVector(
+        1, Iso12233Roi(Index2D(0, 0), Index2D(10, 4 * patchWidth)));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        iso12233Batch<double>(chart, badRoiVector, windowSize, oecf));
+    }
+
+
     void
     Iso12233Test::
     testLowPassEdge()
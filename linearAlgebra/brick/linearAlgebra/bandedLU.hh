@@ -0,0 +1,205 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/bandedLU.hh
+*
+* Header file declaring a class template for LU factorization of
+* banded and cyclic banded matrices.  Like staticLinearAlgebra.hh,
+* this does not depend on LAPACK.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+***************************************************************************
+**/
+
+#ifndef BRICK_LINEARALGEBRA_BANDEDLU_HH
+#define BRICK_LINEARALGEBRA_BANDEDLU_HH
+
+#include <cstddef>
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/numeric/array1D.hh>
+#include <brick/numeric/array2D.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    /**
+     ** This class template factors a square banded matrix once, and
+     ** then solves linear systems involving that matrix in time
+     ** proportional to the number of rows times the bandwidth.  It
+     ** also handles cyclic banded matrices, in which the band wraps
+     ** around from the last column to the first (and from the last
+     ** row to the first), such as arise from finite differences on
+     ** closed curves.
+     **
+     ** The matrix is passed in compact band form: an N x (2p + 1)
+     ** array, B, in which B(i, k) holds element A(i, i + k - p), so
+     ** that column p of B is the diagonal.  For cyclic matrices, the
+     ** column index i + k - p is taken modulo N.
+     **
+     ** The band is factored without pivoting, so the matrix should
+     ** be diagonally dominant or symmetric positive definite.  For a
+     ** cyclic matrix, the last p rows and columns are eliminated
+     ** separately, through a p x p Schur complement that is factored
+     ** with partial pivoting.  Factoring takes O(N p^2) time, and
+     ** each solve takes O(N p) time.
+     **
+     ** Once factored, solve() and solveInPlace() don't modify the
+     ** instance, so one BandedLU can be shared between threads.
+     **
+     ** @code
+     **   // Pentadiagonal cyclic system.
+     **   Array2D<double> bands(N, 5);
+     **   ...
+     **   BandedLU<double> factorization(bands, true);
+     **   Array1D<double> xx = factorization.solve(bb);
+     ** @endcode
+     **/
+    template <class FloatType = brick::common::Float64>
+    class BandedLU {
+    public:
+
+      /**
+       * The default constructor creates an empty factorization.
+       * Call factor() before solving.
+       */
+      BandedLU();
+
+
+      /**
+       * This constructor factors the specified matrix.
+       *
+       * @param bands This argument is the matrix in compact band
+       * form, as described in the class comment.  It must have an
+       * odd number of columns.
+       *
+       * @param isCyclic This argument specifies whether the band
+       * wraps around.  If it is false, elements of bands that fall
+       * outside the matrix are ignored.  If it is true, the matrix
+       * must have more than bands.columns() - 1 rows.
+       */
+      explicit
+      BandedLU(brick::numeric::Array2D<FloatType> const& bands,
+               bool isCyclic = false);
+
+
+      /**
+       * Destructor.
+       */
+      virtual
+      ~BandedLU() {}
+
+
+      /**
+       * This member function discards any previous factorization
+       * and factors a new matrix.  A ValueException is thrown if the
+       * matrix can't be factored without pivoting.
+       *
+       * @param bands This argument is the matrix in compact band
+       * form, as described in the class comment.
+       *
+       * @param isCyclic This argument specifies whether the band
+       * wraps around.
+       */
+      void
+      factor(brick::numeric::Array2D<FloatType> const& bands,
+             bool isCyclic = false);
+
+
+      /**
+       * This member function returns p, the number of nonzero
+       * diagonals on each side of the main diagonal.
+       *
+       * @return The return value is the half bandwidth of the
+       * factored matrix.
+       */
+      std::size_t
+      getHalfBandwidth() const {return m_halfBandwidth;}
+
+
+      /**
+       * This member function returns the number of rows (and
+       * columns) of the factored matrix.
+       *
+       * @return The return value is the size of the factored matrix.
+       */
+      std::size_t
+      getSize() const {return m_size;}
+
+
+      /**
+       * This member function indicates whether the factored matrix
+       * is cyclic.
+       *
+       * @return The return value is the isCyclic argument of the
+       * most recent call to factor().
+       */
+      bool
+      isCyclic() const {return m_isCyclic;}
+
+
+      /**
+       * This member function solves A * x = b.
+       *
+       * @param bVector This argument is the vector b.  Its size must
+       * match getSize().
+       *
+       * @return The return value is the vector x.
+       */
+      brick::numeric::Array1D<FloatType>
+      solve(brick::numeric::Array1D<FloatType> const& bVector) const;
+
+
+      /**
+       * This member function solves A * x = b, overwriting b with x.
+       *
+       * @param bVector This argument is the vector b on input, and
+       * the vector x on return.  Its size must match getSize().
+       */
+      void
+      solveInPlace(brick::numeric::Array1D<FloatType>& bVector) const;
+
+    private:
+
+      // Forward and back substitution through the banded part of the
+      // factorization, operating on m_size - (number of tail rows)
+      // elements.
+      void
+      solveBandInPlace(FloatType* xPtr) const;
+
+
+      // Band part of the factorization, in the same layout as the
+      // input bands.  Multipliers (L) are left of column
+      // m_halfBandwidth, and U is at and right of it.
+      brick::numeric::Array2D<FloatType> m_bandLU;
+
+      // For cyclic matrices, row c holds column c of
+      // inverse(A_band) * A_border, where A_border is the block
+      // coupling the band to the last p columns.
+      brick::numeric::Array2D<FloatType> m_border;
+
+      // For cyclic matrices, the block coupling the last p rows to
+      // the band.
+      brick::numeric::Array2D<FloatType> m_bottom;
+
+      // LU factorization of the p x p Schur complement, and its row
+      // permutation.
+      brick::numeric::Array2D<FloatType> m_schurLU;
+      std::vector<std::size_t> m_schurPivots;
+
+      std::size_t m_halfBandwidth;
+      bool m_isCyclic;
+      std::size_t m_size;
+    };
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/linearAlgebra/bandedLU_impl.hh>
+
+#endif /* #ifndef BRICK_LINEARALGEBRA_BANDEDLU_HH */
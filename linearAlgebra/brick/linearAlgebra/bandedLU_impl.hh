@@ -0,0 +1,311 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/bandedLU_impl.hh
+*
+* Header file defining inline and template functions declared in
+* brick/linearAlgebra/bandedLU.hh
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+***************************************************************************
+**/
+
+#ifndef BRICK_LINEARALGEBRA_BANDEDLU_IMPL_HH
+#define BRICK_LINEARALGEBRA_BANDEDLU_IMPL_HH
+
+// This file is included by bandedLU.hh, and should not be directly
+// included by user code, so no need to include bandedLU.hh here.
+//
+// #include <brick/linearAlgebra/bandedLU.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    // The default constructor creates an empty factorization.
+    template <class FloatType>
+    BandedLU<FloatType>::
+    BandedLU()
+      : m_bandLU(),
+        m_border(),
+        m_bottom(),
+        m_schurLU(),
+        m_schurPivots(),
+        m_halfBandwidth(0),
+        m_isCyclic(false),
+        m_size(0)
+    {
+      // Empty.
+    }
+
+
+    // This constructor factors the specified matrix.
+    template <class FloatType>
+    BandedLU<FloatType>::
+    BandedLU(brick::numeric::Array2D<FloatType> const& bands, bool isCyclic)
+      : m_bandLU(),
+        m_border(),
+        m_bottom(),
+        m_schurLU(),
+        m_schurPivots(),
+        m_halfBandwidth(0),
+        m_isCyclic(false),
+        m_size(0)
+    {
+      this->factor(bands, isCyclic);
+    }
+
+
+    // This member function factors a new matrix.
+    template <class FloatType>
+    void
+    BandedLU<FloatType>::
+    factor(brick::numeric::Array2D<FloatType> const& bands, bool isCyclic)
+    {
+      // Argument checking.
+      if(bands.columns() % 2 != 1) {
+        BRICK_THROW(brick::common::ValueException, "BandedLU::factor()",
+                    "Argument bands must have an odd number of columns.");
+      }
+      std::size_t const size = bands.rows();
+      std::size_t const halfBandwidth = bands.columns() / 2;
+      if(isCyclic && size <= 2 * halfBandwidth) {
+        BRICK_THROW(brick::common::ValueException, "BandedLU::factor()",
+                    "Cyclic matrices must have more than "
+                    "bands.columns() - 1 rows.");
+      }
+
+      // Cyclic matrices are split into a banded block of
+      // bandSize rows, and a tail of tailSize rows and columns that
+      // absorbs the wrapped-around corners.
+      std::size_t const tailSize = isCyclic ? halfBandwidth : 0;
+      std::size_t const bandSize = size - tailSize;
+      std::size_t const bandWidth = 2 * halfBandwidth + 1;
+      long const longSize = static_cast<long>(size);
+      long const longBandSize = static_cast<long>(bandSize);
+      long const longHalfBandwidth = static_cast<long>(halfBandwidth);
+
+      m_bandLU.reinit(bandSize, bandWidth);
+      m_bandLU = FloatType(0);
+      m_border.reinit(tailSize, bandSize);
+      m_border = FloatType(0);
+      m_bottom.reinit(tailSize, bandSize);
+      m_bottom = FloatType(0);
+      m_schurLU.reinit(tailSize, tailSize);
+      m_schurLU = FloatType(0);
+      m_schurPivots.resize(tailSize);
+
+      // Sort input elements into the band, the border, the bottom,
+      // and the tail block.  Requiring size > 2 * halfBandwidth
+      // above ensures that no two elements land in the same place.
+      for(std::size_t row = 0; row < size; ++row) {
+        for(std::size_t kk = 0; kk < bandWidth; ++kk) {
+          long column = static_cast<long>(row) + static_cast<long>(kk)
+            - longHalfBandwidth;
+          if(column < 0 || column >= longSize) {
+            if(!isCyclic) {
+              continue;
+            }
+            column = (column + longSize) % longSize;
+          }
+          std::size_t const uColumn = static_cast<std::size_t>(column);
+          if(row < bandSize) {
+            if(column < longBandSize) {
+              m_bandLU(row, kk) = bands(row, kk);
+            } else {
+              m_border(uColumn - bandSize, row) = bands(row, kk);
+            }
+          } else {
+            if(column < longBandSize) {
+              m_bottom(row - bandSize, uColumn) = bands(row, kk);
+            } else {
+              m_schurLU(row - bandSize, uColumn - bandSize) = bands(row, kk);
+            }
+          }
+        }
+      }
+
+      // LU factorization of the band, without pivoting, so there's
+      // no fill outside the band.
+      for(std::size_t ii = 0; ii < bandSize; ++ii) {
+        FloatType const pivot = m_bandLU(ii, halfBandwidth);
+        if(pivot == FloatType(0)) {
+          BRICK_THROW(brick::common::ValueException, "BandedLU::factor()",
+                      "Zero pivot encountered.  The matrix must be "
+                      "factorable without pivoting.");
+        }
+        std::size_t const lastRow =
+          std::min(ii + halfBandwidth, bandSize - 1);
+        for(std::size_t row = ii + 1; row <= lastRow; ++row) {
+          FloatType& multiplier = m_bandLU(row, ii + halfBandwidth - row);
+          multiplier /= pivot;
+          if(multiplier == FloatType(0)) {
+            continue;
+          }
+          for(std::size_t column = ii + 1; column <= lastRow; ++column) {
+            m_bandLU(row, column + halfBandwidth - row) -=
+              multiplier * m_bandLU(ii, column + halfBandwidth - ii);
+          }
+        }
+      }
+
+      m_halfBandwidth = halfBandwidth;
+      m_isCyclic = isCyclic;
+      m_size = size;
+      if(tailSize == 0) {
+        return;
+      }
+
+      // Eliminate the border, and form the Schur complement of the
+      // band: S = A_tail - A_bottom * inverse(A_band) * A_border.
+      for(std::size_t cc = 0; cc < tailSize; ++cc) {
+        this->solveBandInPlace(m_border.rowBegin(cc));
+      }
+      for(std::size_t rr = 0; rr < tailSize; ++rr) {
+        for(std::size_t cc = 0; cc < tailSize; ++cc) {
+          FloatType sum = FloatType(0);
+          for(std::size_t ii = 0; ii < bandSize; ++ii) {
+            sum += m_bottom(rr, ii) * m_border(cc, ii);
+          }
+          m_schurLU(rr, cc) -= sum;
+        }
+      }
+
+      // The Schur complement is small, so factor it with partial
+      // pivoting.
+      for(std::size_t ii = 0; ii < tailSize; ++ii) {
+        std::size_t pivotRow = ii;
+        for(std::size_t row = ii + 1; row < tailSize; ++row) {
+          if(std::fabs(m_schurLU(row, ii))
+             > std::fabs(m_schurLU(pivotRow, ii))) {
+            pivotRow = row;
+          }
+        }
+        m_schurPivots[ii] = pivotRow;
+        if(pivotRow != ii) {
+          std::swap_ranges(m_schurLU.rowBegin(ii), m_schurLU.rowEnd(ii),
+                           m_schurLU.rowBegin(pivotRow));
+        }
+        FloatType const pivot = m_schurLU(ii, ii);
+        if(pivot == FloatType(0)) {
+          BRICK_THROW(brick::common::ValueException, "BandedLU::factor()",
+                      "Matrix is singular.");
+        }
+        for(std::size_t row = ii + 1; row < tailSize; ++row) {
+          FloatType const multiplier = m_schurLU(row, ii) / pivot;
+          m_schurLU(row, ii) = multiplier;
+          for(std::size_t column = ii + 1; column < tailSize; ++column) {
+            m_schurLU(row, column) -= multiplier * m_schurLU(ii, column);
+          }
+        }
+      }
+    }
+
+
+    // This member function solves A * x = b.
+    template <class FloatType>
+    brick::numeric::Array1D<FloatType>
+    BandedLU<FloatType>::
+    solve(brick::numeric::Array1D<FloatType> const& bVector) const
+    {
+      brick::numeric::Array1D<FloatType> xVector = bVector.copy();
+      this->solveInPlace(xVector);
+      return xVector;
+    }
+
+
+    // This member function solves A * x = b, overwriting b with x.
+    template <class FloatType>
+    void
+    BandedLU<FloatType>::
+    solveInPlace(brick::numeric::Array1D<FloatType>& bVector) const
+    {
+      if(bVector.size() != m_size) {
+        BRICK_THROW(brick::common::ValueException,
+                    "BandedLU::solveInPlace()",
+                    "Argument bVector has the wrong size.");
+      }
+      if(m_size == 0) {
+        return;
+      }
+      FloatType* xPtr = bVector.data();
+      this->solveBandInPlace(xPtr);
+
+      std::size_t const tailSize = m_schurLU.rows();
+      if(tailSize == 0) {
+        return;
+      }
+
+      // Solve for the tail through the Schur complement, then
+      // back-substitute its effect on the band.
+      std::size_t const bandSize = m_size - tailSize;
+      FloatType* tailPtr = xPtr + bandSize;
+      for(std::size_t rr = 0; rr < tailSize; ++rr) {
+        FloatType sum = FloatType(0);
+        for(std::size_t ii = 0; ii < bandSize; ++ii) {
+          sum += m_bottom(rr, ii) * xPtr[ii];
+        }
+        tailPtr[rr] -= sum;
+      }
+      for(std::size_t ii = 0; ii < tailSize; ++ii) {
+        std::swap(tailPtr[ii], tailPtr[m_schurPivots[ii]]);
+        for(std::size_t jj = 0; jj < ii; ++jj) {
+          tailPtr[ii] -= m_schurLU(ii, jj) * tailPtr[jj];
+        }
+      }
+      for(std::size_t ii = tailSize; ii-- > 0;) {
+        for(std::size_t jj = ii + 1; jj < tailSize; ++jj) {
+          tailPtr[ii] -= m_schurLU(ii, jj) * tailPtr[jj];
+        }
+        tailPtr[ii] /= m_schurLU(ii, ii);
+      }
+      for(std::size_t cc = 0; cc < tailSize; ++cc) {
+        FloatType const* borderPtr = m_border.rowBegin(cc);
+        FloatType const value = tailPtr[cc];
+        for(std::size_t ii = 0; ii < bandSize; ++ii) {
+          xPtr[ii] -= borderPtr[ii] * value;
+        }
+      }
+    }
+
+
+    // Forward and back substitution through the banded part of the
+    // factorization.
+    template <class FloatType>
+    void
+    BandedLU<FloatType>::
+    solveBandInPlace(FloatType* xPtr) const
+    {
+      std::size_t const bandSize = m_bandLU.rows();
+      std::size_t const halfBandwidth = (m_bandLU.columns() - 1) / 2;
+      for(std::size_t ii = 0; ii < bandSize; ++ii) {
+        FloatType const* luPtr = m_bandLU.rowBegin(ii);
+        FloatType sum = xPtr[ii];
+        std::size_t const firstK =
+          (ii < halfBandwidth) ? (halfBandwidth - ii) : 0;
+        for(std::size_t kk = firstK; kk < halfBandwidth; ++kk) {
+          sum -= luPtr[kk] * xPtr[ii + kk - halfBandwidth];
+        }
+        xPtr[ii] = sum;
+      }
+      for(std::size_t ii = bandSize; ii-- > 0;) {
+        FloatType const* luPtr = m_bandLU.rowBegin(ii);
+        FloatType sum = xPtr[ii];
+        std::size_t const endK =
+          std::min(2 * halfBandwidth + 1, bandSize - ii + halfBandwidth);
+        for(std::size_t kk = halfBandwidth + 1; kk < endK; ++kk) {
+          sum -= luPtr[kk] * xPtr[ii + kk - halfBandwidth];
+        }
+        xPtr[ii] = sum / luPtr[halfBandwidth];
+      }
+    }
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_LINEARALGEBRA_BANDEDLU_IMPL_HH */
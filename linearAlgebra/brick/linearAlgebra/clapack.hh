@@ -33,6 +33,16 @@ extern "C" {
               brick::common::Int32* INFO);
 
 
+  /**
+   * This is a declaration for the LAPACK routine dgelqf(), which
+   * computes the LQ factorization of a general MxN matrix.
+   */
+  void dgelqf_(brick::common::Int32* M, brick::common::Int32* N,
+               brick::common::Float64* A, brick::common::Int32* LDA,
+               brick::common::Float64* TAU, brick::common::Float64* WORK,
+               brick::common::Int32* LWORK, brick::common::Int32* INFO);
+
+
   /**
    * This is a declaration for the LAPACK routine dgels(), which
    * computes the solution of a general system of linear equations.
@@ -90,6 +100,30 @@ extern "C" {
                brick::common::Int32* IPIV, brick::common::Int32* INFO);
 
 
+  /**
+   * This is a declaration for the LAPACK routine dgetrs(), which
+   * solves a system of linear equations using the LU decomposition
+   * computed by dgetrf().
+   */
+  void dgetrs_(char* TRANS, brick::common::Int32* N,
+               brick::common::Int32* NRHS,
+               brick::common::Float64* A, brick::common::Int32* LDA,
+               brick::common::Int32* IPIV,
+               brick::common::Float64* B, brick::common::Int32* LDB,
+               brick::common::Int32* INFO);
+
+
+  /**
+   * This is a declaration for the LAPACK routine dgetri(), which
+   * computes the inverse of a matrix using the LU decomposition
+   * computed by dgetrf().
+   */
+  void dgetri_(brick::common::Int32* N,
+               brick::common::Float64* A, brick::common::Int32* LDA,
+               brick::common::Int32* IPIV, brick::common::Float64* WORK,
+               brick::common::Int32* LWORK, brick::common::Int32* INFO);
+
+
   /**
    * This is a declaration for the LAPACK routine dlarnv(), which
    * computes a vector of random real numbers from a uniform
@@ -99,6 +133,18 @@ extern "C" {
                brick::common::Int32* N, brick::common::Float64* X);
 
 
+  /**
+   * This is a declaration for the LAPACK routine dorglq(), which
+   * generates the orthogonal matrix Q of an LQ factorization
+   * computed by dgelqf().
+   */
+  void dorglq_(brick::common::Int32* M, brick::common::Int32* N,
+               brick::common::Int32* K,
+               brick::common::Float64* A, brick::common::Int32* LDA,
+               brick::common::Float64* TAU, brick::common::Float64* WORK,
+               brick::common::Int32* LWORK, brick::common::Int32* INFO);
+
+
   /**
    * This is a declaration for the LAPACK routine dgtsv(), which
    * computes the solution of a general tridiagonal system of linear
@@ -153,6 +199,28 @@ extern "C" {
               brick::common::Float32* B, brick::common::Int32* LDB,
               brick::common::Int32* INFO);
 
+
+  /**
+   * This is a declaration for the LAPACK routine sgetrf(), which
+   * computes LU decomposition of a general MxN matrix.
+   */
+  void sgetrf_(brick::common::Int32* M, brick::common::Int32* N,
+               brick::common::Float32* A, brick::common::Int32* LDA,
+               brick::common::Int32* IPIV, brick::common::Int32* INFO);
+
+
+  /**
+   * This is a declaration for the LAPACK routine sgetrs(), which
+   * solves a system of linear equations using the LU decomposition
+   * computed by sgetrf().
+   */
+  void sgetrs_(char* TRANS, brick::common::Int32* N,
+               brick::common::Int32* NRHS,
+               brick::common::Float32* A, brick::common::Int32* LDA,
+               brick::common::Int32* IPIV,
+               brick::common::Float32* B, brick::common::Int32* LDB,
+               brick::common::Int32* INFO);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,6 +13,7 @@
 #include <brick/common/exception.hh>
 #include <brick/linearAlgebra/linearAlgebra.hh>
 #include <brick/linearAlgebra/clapack.hh>
+#include <brick/numeric/array2DView.hh>
 #include <brick/numeric/utilities.hh>
 #include <brick/numeric/numericTraits.hh>
 
@@ -28,6 +29,89 @@ namespace brick {
    **/
   namespace linearAlgebra {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Overloads so that solveUsingTransposedLU() can be written
+      // once for both float and double.
+      inline void
+      getrf(Int32* M, Int32* N, Float32* A, Int32* LDA, Int32* IPIV,
+            Int32* INFO) {sgetrf_(M, N, A, LDA, IPIV, INFO);}
+
+      inline void
+      getrf(Int32* M, Int32* N, Float64* A, Int32* LDA, Int32* IPIV,
+            Int32* INFO) {dgetrf_(M, N, A, LDA, IPIV, INFO);}
+
+      inline void
+      getrs(char* TRANS, Int32* N, Int32* NRHS, Float32* A, Int32* LDA,
+            Int32* IPIV, Float32* B, Int32* LDB, Int32* INFO) {
+        sgetrs_(TRANS, N, NRHS, A, LDA, IPIV, B, LDB, INFO);
+      }
+
+      inline void
+      getrs(char* TRANS, Int32* N, Int32* NRHS, Float64* A, Int32* LDA,
+            Int32* IPIV, Float64* B, Int32* LDB, Int32* INFO) {
+        dgetrs_(TRANS, N, NRHS, A, LDA, IPIV, B, LDB, INFO);
+      }
+
+
+      // Solve AA * x = bb, overwriting both arguments, without
+      // transposing AA.  A row-major array looks to LAPACK like the
+      // column-major storage of its own transpose, so we LU factor
+      // that in place, and then ask LAPACK to solve the transposed
+      // system.  If bb is a single contiguous column (as it is when
+      // called through the Array1D interface), it is already
+      // column-major and is solved in place, too.
+      template <class FloatType>
+      void
+      solveUsingTransposedLU(Array2D<FloatType>& AA, Array2D<FloatType>& bb,
+                             char const* functionName)
+      {
+        Array2DView<FloatType> aTransposeView =
+          Array2DView<FloatType>(AA).transpose();
+        Array2DView<FloatType> bView(bb);
+        Int32 rows = static_cast<Int32>(AA.rows());
+        Int32 lda = static_cast<Int32>(
+          std::max(aTransposeView.getColumnStride(),
+                   static_cast<std::ptrdiff_t>(1)));
+        Array1D<Int32> iPiv(AA.rows());
+        Int32 info;
+        getrf(&rows, &rows, aTransposeView.data(), &lda, iPiv.data(), &info);
+        if(info != 0L) {
+          std::ostringstream message;
+          message << "Call to getrf_ returns " << info
+                  << ".  Something is wrong."
+                  << "  Perhaps the the input equations are poorly "
+                  << "conditioned or perhaps there is no solution.";
+          BRICK_THROW(brick::common::ValueException, functionName,
+                      message.str().c_str());
+        }
+
+        char trans = 'T';
+        Int32 xColumns = static_cast<Int32>(bb.columns());
+        if(bView.isColumnMajor()) {
+          Int32 ldb = rows;
+          getrs(&trans, &rows, &xColumns, aTransposeView.data(), &lda,
+                iPiv.data(), bView.data(), &ldb, &info);
+        } else {
+          Array2D<FloatType> bColumnMajor = bb.transpose();
+          getrs(&trans, &rows, &xColumns, aTransposeView.data(), &lda,
+                iPiv.data(), bColumnMajor.data(), &rows, &info);
+          Array2DView<FloatType>(bColumnMajor).transpose().copyTo(bb);
+        }
+        if(info != 0L) {
+          std::ostringstream message;
+          message << "Call to getrs_ returns " << info
+                  << ".  Something is wrong.";
+          BRICK_THROW(brick::common::ValueException, functionName,
+                      message.str().c_str());
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
     void
     choleskyFactorization(Array2D<Float64> const& inputArray,
                           Array2D<Float64>& kArray,
@@ -121,8 +205,11 @@ namespace brick {
       // determinant of a matrix is related to the product of the
       // diagonal elements of its LU factorization.
 
-      // Start by computing the LU factorization of A.
-      Array2D<Float64> AColumnMajor = A.transpose();
+      // Start by computing the LU factorization of A.  Since
+      // det(A) == det(transpose(A)), we don't bother transposing to
+      // match LAPACK's column-major layout.  A contiguous row-major
+      // copy is simply a column-major copy of transpose(A).
+      Array2D<Float64> AColumnMajor = A.copy();
       Int32 M = static_cast<Int32>(A.rows());
       Int32 N = static_cast<Int32>(A.columns());
       Int32 LDA = static_cast<Int32>(A.rows());
@@ -525,10 +612,14 @@ namespace brick {
                     "the same as the number of elements in bb.");
       }
 
-      // Set up scalar arguments for the LAPACK routine.
-      char trans = 'N';
-      Int32 rows = static_cast<Int32>(AA.rows());
-      Int32 columns = static_cast<Int32>(AA.columns());
+      // Set up scalar arguments for the LAPACK routine.  Rather
+      // than transposing AA into column-major order, we give LAPACK
+      // a row-major copy, which it sees as transpose(AA), and ask it
+      // to solve the transposed problem.  This makes rows and
+      // columns trade places in the LAPACK arguments.
+      char trans = 'T';
+      Int32 rows = static_cast<Int32>(AA.columns());
+      Int32 columns = static_cast<Int32>(AA.rows());
       Int32 nrhs = static_cast<Int32>(1);
       Int32 ldb = static_cast<Int32>(std::max(rows, columns));
       Float32 temporaryWorkspace;
@@ -536,7 +627,7 @@ namespace brick {
       Int32 info;
 
       // Set up array arguments for the LAPACK routine.
-      Array2D<Float32> AColumnMajor = AA.transpose();
+      Array2D<Float32> AColumnMajor = AA.copy();
       Array1D<Float32> bCopy(ldb);
       std::copy(bb.begin(), bb.end(), bCopy.begin());
 
@@ -606,10 +697,14 @@ namespace brick {
                     "the same as the number of elements in bb.");
       }
 
-      // Set up scalar arguments for the LAPACK routine.
-      char trans = 'N';
-      Int32 rows = static_cast<Int32>(AA.rows());
-      Int32 columns = static_cast<Int32>(AA.columns());
+      // Set up scalar arguments for the LAPACK routine.  Rather
+      // than transposing AA into column-major order, we give LAPACK
+      // a row-major copy, which it sees as transpose(AA), and ask it
+      // to solve the transposed problem.  This makes rows and
+      // columns trade places in the LAPACK arguments.
+      char trans = 'T';
+      Int32 rows = static_cast<Int32>(AA.columns());
+      Int32 columns = static_cast<Int32>(AA.rows());
       Int32 nrhs = static_cast<Int32>(1);
       Int32 ldb = static_cast<Int32>(std::max(rows, columns));
       Float64 temporaryWorkspace;
@@ -617,7 +712,7 @@ namespace brick {
       Int32 info;
 
       // Set up array arguments for the LAPACK routine.
-      Array2D<Float64> AColumnMajor = AA.transpose();
+      Array2D<Float64> AColumnMajor = AA.copy();
       Array1D<Float64> bCopy(ldb);
       std::copy(bb.begin(), bb.end(), bCopy.begin());
 
@@ -685,35 +780,8 @@ namespace brick {
                     "Input array AA must be square.");
       }
 
-      // Grr.  Have to transpose to match lapack.
-      Array2D<Float32> AColumnMajor = AA.transpose();
-      Array2D<Float32> bColumnMajor = bb.transpose();
-
-      // Now invoke the LAPACK routine.
-      Int32 rows = static_cast<Int32>(AA.rows());
-      Int32 xColumns = static_cast<Int32>(bb.columns());
-      Int32 *iPiv = new Int32[rows];
-      Int32 info;
-      sgesv_(&rows, &xColumns, AColumnMajor.data(), &rows, iPiv,
-             bColumnMajor.data(), &rows, &info );
-      // Clean up
-      delete[] iPiv;
-      // And do some error checking.
-      if(info != 0L) {
-        std::ostringstream message;
-        message << "Call to dgesv_ returns " << info << ".  Something is wrong."
-                << "  Perhaps the the input equations are poorly conditioned "
-                << "or perhaps there is no solution.";
-        BRICK_THROW(brick::common::ValueException,
-                    "linearSolveInPlace(Array2D<Float32>&, Array2D<Float32>&)",
-                    message.str().c_str());
-      }
-
-      for(std::size_t rr = 0; rr < bb.rows(); ++rr) {
-        for(std::size_t cc = 0; cc < bb.columns(); ++cc) {
-          bb(rr, cc) = bColumnMajor(cc, rr);
-        }
-      }
+      privateCode::solveUsingTransposedLU(
+        AA, bb, "linearSolveInPlace(Array2D<Float32>&, Array2D<Float32>&)");
     }
 
 
@@ -737,35 +805,8 @@ namespace brick {
                     "Input array AA must be square.");
       }
 
-      // Grr.  Have to transpose to match lapack.
-      Array2D<Float64> AColumnMajor = AA.transpose();
-      Array2D<Float64> bColumnMajor = bb.transpose();
-
-      // Now invoke the LAPACK routine.
-      Int32 rows = static_cast<Int32>(AA.rows());
-      Int32 xColumns = static_cast<Int32>(bb.columns());
-      Int32 *iPiv = new Int32[rows];
-      Int32 info;
-      dgesv_(&rows, &xColumns, AColumnMajor.data(), &rows, iPiv,
-             bColumnMajor.data(), &rows, &info );
-      // Clean up
-      delete[] iPiv;
-      // And do some error checking.
-      if(info != 0L) {
-        std::ostringstream message;
-        message << "Call to dgesv_ returns " << info << ".  Something is wrong."
-                << "  Perhaps the the input equations are poorly conditioned "
-                << "or perhaps there is no solution.";
-        BRICK_THROW(brick::common::ValueException,
-                    "linearSolveInPlace(Array2D<Float64>&, Array2D<Float64>&)",
-                    message.str().c_str());
-      }
-
-      for(std::size_t rr = 0; rr < bb.rows(); ++rr) {
-        for(std::size_t cc = 0; cc < bb.columns(); ++cc) {
-          bb(rr, cc) = bColumnMajor(cc, rr);
-        }
-      }
+      privateCode::solveUsingTransposedLU(
+        AA, bb, "linearSolveInPlace(Array2D<Float64>&, Array2D<Float64>&)");
     }
 
 
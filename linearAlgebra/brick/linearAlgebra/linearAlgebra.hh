@@ -220,11 +220,11 @@ namespace brick {
      * both arguments are modified as part of the process.  If the
      * solution fails, a ValueException will be generated.
      *
-     * TBD(xxx): The specializations of this function for Float32 and
-     * Float64 (float and double) currently do some extra copies in
-     * preparation for the underlying LAPACK calls.  These extra
-     * copies defeat the purpose (faster execution) of solving in
-     * place.  Ugh.
+     * The specializations of this function for Float32 and Float64
+     * (float and double) hand the memory of both arguments directly
+     * to LAPACK, without copying or transposing.  On return, AA
+     * holds the LU factorization of transpose(A).  Note that this is
+     * only true of the vector version; see below.
      *
      * @param AA This argument specifies the A matrix in the system "Ax =
      * b," and must be square.
@@ -242,7 +242,11 @@ namespace brick {
     /**
      * This function is identical to linearSolveInPlace(Array2D<Float32>,
      * Array1D<Float32>&), except that b (and therefore x) is not
-     * constrained to be a vector.
+     * constrained to be a vector.  AA is still factored in place
+     * without transposing, but if bb has more than one column, it is
+     * not column-major, so the Float32 and Float64 specializations
+     * transpose it into a temporary array for LAPACK, and copy the
+     * result back into bb afterward.
      *
      * @param AA This argument specifies the A matrix in the system "Ax =
      * b," and must be square.  Note that the contents of AA will be
@@ -258,6 +262,37 @@ namespace brick {
                        brick::numeric::Array2D<FloatType>& bb);
 
 
+    /**
+     * This function solves the system of equations A*x = b, where A is
+     * a known banded (or cyclic banded) matrix and b is a known
+     * vector.  It factors A using a BandedLU instance, which you
+     * should use directly if you need to solve more than one system
+     * with the same A.  Unlike linearSolveTridiagonal(), this does
+     * not pivot, so A should be diagonally dominant or symmetric
+     * positive definite.  If the solution fails, a ValueException
+     * will be generated.
+     *
+     * @param bands This argument specifies the A matrix in compact
+     * band form: for a matrix with p nonzero diagonals on each side
+     * of the main diagonal, it is an N x (2p + 1) array in which
+     * bands(i, k) holds A(i, i + k - p).
+     *
+     * @param bVector This argument specifies the b vector in the
+     * system "Ax = b."  It must have bands.rows() elements.
+     *
+     * @param isCyclic This argument specifies whether the band
+     * wraps around, so that column indices i + k - p are taken
+     * modulo N.
+     *
+     * @return The return value is the vector x.
+     */
+    template <class FloatType>
+    brick::numeric::Array1D<FloatType>
+    linearSolveBanded(brick::numeric::Array2D<FloatType> const& bands,
+                      brick::numeric::Array1D<FloatType> const& bVector,
+                      bool isCyclic = false);
+
+
     /**
      * This function solves the system of equations A*x = b, where A is
      * a known tridiagonal matrix and b is a known vector.  The contents
@@ -0,0 +1,741 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/linearAlgebraWorkspace.cc
+*
+* Source file defining a reusable LAPACK workspace, along with
+* workspace-aware and batched versions of some of the routines in
+* linearAlgebra.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <sstream>
+#include <brick/common/exception.hh>
+#include <brick/common/parallel.hh>
+#include <brick/linearAlgebra/clapack.hh>
+#include <brick/linearAlgebra/linearAlgebraWorkspace.hh>
+
+// Using directives for this source file only.
+using namespace brick::common;
+using namespace brick::numeric;
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Keys for LinearAlgebraWorkspace::getWorkSize().
+      enum WorkspaceRoutine {
+        BRICK_LA_DGELQF,
+        BRICK_LA_DGELS_T,
+        BRICK_LA_DGESDD_A,
+        BRICK_LA_DGESDD_S,
+        BRICK_LA_DGETRI,
+        BRICK_LA_DORGLQ,
+        BRICK_LA_DSYEV_V
+      };
+
+      // Indices for LinearAlgebraWorkspace::getFloatBuffer().
+      enum WorkspaceBuffer {
+        BRICK_LA_MATRIX_BUFFER,
+        BRICK_LA_WORK_BUFFER,
+        BRICK_LA_VECTOR_BUFFER,
+        BRICK_LA_Q_BUFFER
+      };
+
+
+      // Throws if a LAPACK routine reports failure.
+      inline void
+      checkInfo(Int32 info, char const* routineName, char const* functionName)
+      {
+        if(info != 0L) {
+          std::ostringstream message;
+          message << "Call to " << routineName << " returns " << info
+                  << ".  Something is wrong.";
+          BRICK_THROW(brick::common::ValueException, functionName,
+                      message.str().c_str());
+        }
+      }
+
+
+      // Converts the result of a LAPACK workspace query to a size,
+      // and remembers it for next time.
+      inline Int32
+      recordWorkSize(LinearAlgebraWorkspace& workspace, Int32 routine,
+                     Int32 rows, Int32 columns, Float64 queryResult)
+      {
+        Int32 workSize = std::max(static_cast<Int32>(queryResult),
+                                  static_cast<Int32>(1));
+        workspace.setWorkSize(routine, rows, columns, workSize);
+        return workSize;
+      }
+
+
+      // Makes sure an output array has the requested shape and that
+      // writing to it will not change any other array.  Since
+      // Array1D copies are shallow, an array that shares its data
+      // is given fresh memory rather than being written in place.
+      inline void
+      prepareOutput(Array1D<Float64>& array, std::size_t size)
+      {
+        if(array.size() != size || array.getReferenceCount().isShared()) {
+          array.reinit(size);
+        }
+      }
+
+
+      // Same as above, for Array2D.
+      inline void
+      prepareOutput(Array2D<Float64>& array, std::size_t rows,
+                    std::size_t columns)
+      {
+        if(array.rows() != rows || array.columns() != columns
+           || array.getReferenceCount().isShared()) {
+          array.reinit(rows, columns);
+        }
+      }
+
+
+      // Detaches batch outputs that share data with each other (for
+      // example, copies of a single array made by the std::vector
+      // fill constructor), or with arrays outside the batch.  This
+      // is done serially, before the batch starts, so that the
+      // worker threads never write to shared memory.
+      template <class ArrayType>
+      void
+      unshareOutputs(std::vector<ArrayType>& outputs)
+      {
+        for(std::size_t ii = 0; ii < outputs.size(); ++ii) {
+          if(outputs[ii].getReferenceCount().isShared()) {
+            outputs[ii] = ArrayType();
+          }
+        }
+      }
+
+
+      // Runs functor(index, workspace) for every index in
+      // [0, numberOfProblems).  The batch is cut into one contiguous
+      // run per thread so that each run can reuse a single
+      // workspace.
+      template <class Functor>
+      void
+      executeBatch(std::size_t numberOfProblems, Functor const& functor,
+                   std::size_t numberOfThreads)
+      {
+        if(numberOfThreads == 0) {
+          numberOfThreads = getDefaultNumberOfThreads();
+        }
+        numberOfThreads = std::min(numberOfThreads, numberOfProblems);
+        if(numberOfThreads == 0) {
+          return;
+        }
+        std::vector<LinearAlgebraWorkspace> workspaces(numberOfThreads);
+        executeInParallel(
+          numberOfThreads,
+          [&](std::size_t runIndex) {
+            std::size_t beginIndex =
+              (runIndex * numberOfProblems) / numberOfThreads;
+            std::size_t endIndex =
+              ((runIndex + 1) * numberOfProblems) / numberOfThreads;
+            for(std::size_t ii = beginIndex; ii < endIndex; ++ii) {
+              functor(ii, workspaces[runIndex]);
+            }
+          },
+          numberOfThreads);
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // The default constructor creates an empty workspace.
+    LinearAlgebraWorkspace::
+    LinearAlgebraWorkspace()
+      : m_floatBuffers(),
+        m_integerBuffer(),
+        m_workSizes()
+    {
+      // Empty.
+    }
+
+
+    // This member function releases all memory held by the
+    // workspace.
+    void
+    LinearAlgebraWorkspace::
+    clear()
+    {
+      std::vector< std::vector<Float64> >().swap(m_floatBuffers);
+      std::vector<Int32>().swap(m_integerBuffer);
+      m_workSizes.clear();
+    }
+
+
+    // This member function returns a pointer to one of the
+    // workspace's floating point buffers, growing it if necessary.
+    Float64*
+    LinearAlgebraWorkspace::
+    getFloatBuffer(std::size_t bufferIndex, std::size_t numberOfElements)
+    {
+      if(bufferIndex >= m_floatBuffers.size()) {
+        m_floatBuffers.resize(bufferIndex + 1);
+      }
+      std::vector<Float64>& buffer = m_floatBuffers[bufferIndex];
+      if(buffer.size() < numberOfElements) {
+        buffer.resize(numberOfElements);
+      }
+      return buffer.empty() ? 0 : &(buffer[0]);
+    }
+
+
+    // This member function returns a pointer to the workspace's
+    // integer buffer, growing it if necessary.
+    Int32*
+    LinearAlgebraWorkspace::
+    getIntegerBuffer(std::size_t numberOfElements)
+    {
+      if(m_integerBuffer.size() < numberOfElements) {
+        m_integerBuffer.resize(numberOfElements);
+      }
+      return m_integerBuffer.empty() ? 0 : &(m_integerBuffer[0]);
+    }
+
+
+    // This member function returns the total number of bytes
+    // currently held by the workspace.
+    std::size_t
+    LinearAlgebraWorkspace::
+    getNumberOfBytes() const
+    {
+      std::size_t numberOfBytes = m_integerBuffer.size() * sizeof(Int32);
+      for(std::size_t ii = 0; ii < m_floatBuffers.size(); ++ii) {
+        numberOfBytes += m_floatBuffers[ii].size() * sizeof(Float64);
+      }
+      return numberOfBytes;
+    }
+
+
+    // This member function looks up a previously recorded LAPACK
+    // workspace size.
+    Int32
+    LinearAlgebraWorkspace::
+    getWorkSize(Int32 routine, Int32 rows, Int32 columns) const
+    {
+      for(std::size_t ii = 0; ii < m_workSizes.size(); ++ii) {
+        WorkSizeEntry const& entry = m_workSizes[ii];
+        if(entry.routine == routine && entry.rows == rows
+           && entry.columns == columns) {
+          return entry.workSize;
+        }
+      }
+      return -1;
+    }
+
+
+    // This member function records a LAPACK workspace size.
+    void
+    LinearAlgebraWorkspace::
+    setWorkSize(Int32 routine, Int32 rows, Int32 columns, Int32 workSize)
+    {
+      for(std::size_t ii = 0; ii < m_workSizes.size(); ++ii) {
+        WorkSizeEntry& entry = m_workSizes[ii];
+        if(entry.routine == routine && entry.rows == rows
+           && entry.columns == columns) {
+          entry.workSize = workSize;
+          return;
+        }
+      }
+      WorkSizeEntry entry = {routine, rows, columns, workSize};
+      m_workSizes.push_back(entry);
+    }
+
+
+    // This function computes the eigenvalues and eigenvectors of a
+    // symmetric real matrix using a caller-supplied workspace.
+    void
+    eigenvectorsSymmetric(Array2D<Float64> const& inputArray,
+                          Array1D<Float64>& eigenvalues,
+                          Array2D<Float64>& eigenvectors,
+                          LinearAlgebraWorkspace& workspace)
+    {
+      // Argument checking.
+      if(inputArray.size() == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "eigenvectorsSymmetric()",
+                    "Argument inputArray cannot have zero size.");
+      }
+      if(inputArray.rows() != inputArray.columns()) {
+        BRICK_THROW(brick::common::ValueException,
+                    "eigenvectorsSymmetric()",
+                    "Argument inputArray must be square.");
+      }
+
+      // Since inputArray is symmetric, a straight copy is already
+      // column-major.  LAPACK reads only its lower triangle, which is
+      // the upper triangle of inputArray.
+      size_t dimension = inputArray.rows();
+      Float64* aColumnMajor = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_MATRIX_BUFFER, inputArray.size());
+      std::copy(inputArray.begin(), inputArray.end(), aColumnMajor);
+      Float64* eigenvaluesTmp = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_VECTOR_BUFFER, dimension);
+
+      char JOBZ = 'V';
+      char UPLO = 'L';
+      Int32 N = static_cast<Int32>(dimension);
+      Int32 INFO;
+      Int32 LWORK =
+        workspace.getWorkSize(privateCode::BRICK_LA_DSYEV_V, N, N);
+      if(LWORK < 0) {
+        Float64 WORK;
+        dsyev_(&JOBZ, &UPLO, &N, aColumnMajor, &N, eigenvaluesTmp,
+               &WORK, &LWORK, &INFO);
+        privateCode::checkInfo(INFO, "dsyev_", "eigenvectorsSymmetric()");
+        LWORK = privateCode::recordWorkSize(
+          workspace, privateCode::BRICK_LA_DSYEV_V, N, N, WORK);
+      }
+      Float64* WORK = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_WORK_BUFFER, static_cast<size_t>(LWORK));
+      dsyev_(&JOBZ, &UPLO, &N, aColumnMajor, &N, eigenvaluesTmp,
+             WORK, &LWORK, &INFO);
+      privateCode::checkInfo(INFO, "dsyev_", "eigenvectorsSymmetric()");
+
+      // LAPACK returns ascending eigenvalues, with one eigenvector
+      // per column-major column.  We want descending order, with one
+      // eigenvector per row-major column.
+      privateCode::prepareOutput(eigenvalues, dimension);
+      privateCode::prepareOutput(eigenvectors, dimension, dimension);
+      for(size_t index0 = 0; index0 < dimension; ++index0) {
+        size_t lapackIndex = dimension - index0 - 1;
+        eigenvalues[index0] = eigenvaluesTmp[lapackIndex];
+        Float64 const* inPtr = aColumnMajor + lapackIndex * dimension;
+        Float64* outPtr = eigenvectors.data(index0);
+        for(size_t index1 = 0; index1 < dimension; ++index1) {
+          *outPtr = *(inPtr++);
+          outPtr += dimension;
+        }
+      }
+    }
+
+
+    // This function computes the inverse of a square matrix using a
+    // caller-supplied workspace.
+    void
+    inverse(Array2D<Float64> const& AA,
+            Array2D<Float64>& AInverse,
+            LinearAlgebraWorkspace& workspace)
+    {
+      // First argument checking.
+      if(AA.columns() != AA.rows()) {
+        BRICK_THROW(brick::common::ValueException,
+                    "inverse(Array2D<Float64> const&, Array2D<Float64>&, "
+                    "LinearAlgebraWorkspace&)",
+                    "Input array is not square.");
+      }
+
+      // AInverse is inverted in place, so it must hold a private
+      // copy of AA.  If it already refers to AA's memory, and nothing
+      // else does, there's no need to copy.  Note that AInverse may
+      // be the same object as AA, so we copy into a fresh array
+      // before letting go of AInverse's old data.
+      bool isShared = AInverse.getReferenceCount().isShared();
+      if(isShared || AInverse.data() != AA.data()) {
+        if(isShared || AInverse.rows() != AA.rows()
+           || AInverse.columns() != AA.columns()) {
+          Array2D<Float64> freshArray(AA.rows(), AA.columns());
+          std::copy(AA.begin(), AA.end(), freshArray.begin());
+          AInverse = freshArray;
+        } else {
+          std::copy(AA.begin(), AA.end(), AInverse.begin());
+        }
+      }
+      if(AA.size() == 0) {
+        return;
+      }
+
+      // AInverse now holds transpose(A) in column-major order.
+      // Inverting it in place leaves transpose(inverse(A)) in
+      // column-major order, which is inverse(A) in row-major order.
+      Int32 N = static_cast<Int32>(AA.rows());
+      Int32* IPIV = workspace.getIntegerBuffer(AA.rows());
+      Int32 INFO;
+      dgetrf_(&N, &N, AInverse.data(), &N, IPIV, &INFO);
+      if(INFO > 0L) {
+        BRICK_THROW(brick::common::ValueException,
+                    "inverse(Array2D<Float64> const&, Array2D<Float64>&, "
+                    "LinearAlgebraWorkspace&)",
+                    "Input array is singular.");
+      }
+      privateCode::checkInfo(INFO, "dgetrf_", "inverse()");
+
+      Int32 LWORK = workspace.getWorkSize(privateCode::BRICK_LA_DGETRI, N, N);
+      if(LWORK < 0) {
+        Float64 WORK;
+        dgetri_(&N, AInverse.data(), &N, IPIV, &WORK, &LWORK, &INFO);
+        privateCode::checkInfo(INFO, "dgetri_", "inverse()");
+        LWORK = privateCode::recordWorkSize(
+          workspace, privateCode::BRICK_LA_DGETRI, N, N, WORK);
+      }
+      Float64* WORK = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_WORK_BUFFER, static_cast<size_t>(LWORK));
+      dgetri_(&N, AInverse.data(), &N, IPIV, WORK, &LWORK, &INFO);
+      privateCode::checkInfo(INFO, "dgetri_", "inverse()");
+    }
+
+
+    // This function solves the system of equations A*x = b using a
+    // caller-supplied workspace.
+    void
+    linearLeastSquares(Array2D<Float64> const& AA,
+                       Array1D<Float64> const& bb,
+                       Array1D<Float64>& xx,
+                       LinearAlgebraWorkspace& workspace)
+    {
+      // First some argument checking.
+      if(AA.size() == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "linearLeastSquares()",
+                    "Input array AA must have nonzero size.");
+      }
+      if(AA.rows() != bb.size()) {
+        BRICK_THROW(brick::common::ValueException,
+                    "linearLeastSquares()",
+                    "The number of rows in input array AA must be "
+                    "the same as the number of elements in bb.");
+      }
+
+      // As in linearLeastSquares(Array2D<Float64> const&,
+      // Array1D<Float64> const&), LAPACK sees the row-major copy as
+      // transpose(AA), so we ask it to solve the transposed problem.
+      char trans = 'T';
+      Int32 rows = static_cast<Int32>(AA.columns());
+      Int32 columns = static_cast<Int32>(AA.rows());
+      Int32 nrhs = 1;
+      Int32 ldb = std::max(rows, columns);
+      Int32 info;
+
+      Float64* aColumnMajor = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_MATRIX_BUFFER, AA.size());
+      std::copy(AA.begin(), AA.end(), aColumnMajor);
+      Float64* bCopy = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_VECTOR_BUFFER, static_cast<size_t>(ldb));
+      std::copy(bb.begin(), bb.end(), bCopy);
+
+      Int32 lwork = workspace.getWorkSize(
+        privateCode::BRICK_LA_DGELS_T, rows, columns);
+      if(lwork < 0) {
+        Float64 temporaryWorkspace;
+        dgels_(&trans, &rows, &columns, &nrhs, aColumnMajor, &rows,
+               bCopy, &ldb, &temporaryWorkspace, &lwork, &info);
+        privateCode::checkInfo(info, "dgels_", "linearLeastSquares()");
+        lwork = privateCode::recordWorkSize(
+          workspace, privateCode::BRICK_LA_DGELS_T, rows, columns,
+          temporaryWorkspace);
+      }
+      Float64* work = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_WORK_BUFFER, static_cast<size_t>(lwork));
+      dgels_(&trans, &rows, &columns, &nrhs, aColumnMajor, &rows,
+             bCopy, &ldb, work, &lwork, &info);
+      privateCode::checkInfo(info, "dgels_", "linearLeastSquares()");
+
+      privateCode::prepareOutput(xx, AA.columns());
+      std::copy(bCopy, bCopy + AA.columns(), xx.begin());
+    }
+
+
+    // This function computes the QR factorization of a general
+    // matrix using a caller-supplied workspace.
+    void
+    qrFactorization(Array2D<Float64> const& inputArray,
+                    Array2D<Float64>& qArray,
+                    Array2D<Float64>& rArray,
+                    LinearAlgebraWorkspace& workspace)
+    {
+      // Argument checking.
+      if(inputArray.size() == 0) {
+        qArray.clear();
+        rArray.clear();
+        return;
+      }
+
+      // LAPACK sees the row-major input as transpose(A), which has
+      // inputArray.columns() rows and inputArray.rows() columns.
+      // Its LQ factorization, L * Q', gives A = transpose(Q') *
+      // transpose(L).
+      size_t numberOfRows = inputArray.rows();
+      size_t numberOfColumns = inputArray.columns();
+      size_t numberOfReflectors = std::min(numberOfRows, numberOfColumns);
+      Int32 mm = static_cast<Int32>(numberOfColumns);
+      Int32 nn = static_cast<Int32>(numberOfRows);
+      Int32 kk = static_cast<Int32>(numberOfReflectors);
+      Int32 info;
+
+      Float64* factored = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_MATRIX_BUFFER, inputArray.size());
+      std::copy(inputArray.begin(), inputArray.end(), factored);
+      Float64* tau = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_VECTOR_BUFFER, numberOfReflectors);
+      Float64* qBuffer = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_Q_BUFFER, numberOfRows * numberOfRows);
+
+      // Both LAPACK calls share one work buffer.
+      Int32 lworkLQ = workspace.getWorkSize(
+        privateCode::BRICK_LA_DGELQF, mm, nn);
+      if(lworkLQ < 0) {
+        Float64 temporaryWorkspace;
+        dgelqf_(&mm, &nn, factored, &mm, tau, &temporaryWorkspace,
+                &lworkLQ, &info);
+        privateCode::checkInfo(info, "dgelqf_", "qrFactorization()");
+        lworkLQ = privateCode::recordWorkSize(
+          workspace, privateCode::BRICK_LA_DGELQF, mm, nn,
+          temporaryWorkspace);
+      }
+      Int32 lworkQ = workspace.getWorkSize(
+        privateCode::BRICK_LA_DORGLQ, nn, kk);
+      if(lworkQ < 0) {
+        Float64 temporaryWorkspace;
+        dorglq_(&nn, &nn, &kk, qBuffer, &nn, tau, &temporaryWorkspace,
+                &lworkQ, &info);
+        privateCode::checkInfo(info, "dorglq_", "qrFactorization()");
+        lworkQ = privateCode::recordWorkSize(
+          workspace, privateCode::BRICK_LA_DORGLQ, nn, kk,
+          temporaryWorkspace);
+      }
+      Int32 lwork = std::max(lworkLQ, lworkQ);
+      Float64* work = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_WORK_BUFFER, static_cast<size_t>(lwork));
+
+      dgelqf_(&mm, &nn, factored, &mm, tau, work, &lwork, &info);
+      privateCode::checkInfo(info, "dgelqf_", "qrFactorization()");
+
+      // The elementary reflectors are stored in the rows of the
+      // column-major result, to the right of the diagonal.  Move
+      // them into an nn x nn array so that dorglq_() can expand them
+      // into the full Q'.
+      for(size_t row = 0; row < numberOfReflectors; ++row) {
+        for(size_t column = row + 1; column < numberOfRows; ++column) {
+          qBuffer[row + column * numberOfRows] =
+            factored[row + column * numberOfColumns];
+        }
+      }
+      dorglq_(&nn, &nn, &kk, qBuffer, &nn, tau, work, &lwork, &info);
+      privateCode::checkInfo(info, "dorglq_", "qrFactorization()");
+
+      // Read row-major, the column-major Q' is transpose(Q') == Q,
+      // and the lower trapezoidal L is transpose(L) == R.
+      privateCode::prepareOutput(rArray, numberOfRows, numberOfColumns);
+      privateCode::prepareOutput(qArray, numberOfRows, numberOfRows);
+      std::copy(qBuffer, qBuffer + qArray.size(), qArray.begin());
+      for(size_t row = 0; row < numberOfRows; ++row) {
+        for(size_t column = 0; column < numberOfColumns; ++column) {
+          rArray(row, column) =
+            (column >= row) ? factored[row * numberOfColumns + column] : 0.0;
+        }
+      }
+
+      // Make sure diagonal elements of rArray are non-negative, as
+      // promised.
+      for(size_t ii = 0; ii < numberOfReflectors; ++ii) {
+        if(rArray(ii, ii) < 0.0) {
+          for(size_t jj = ii; jj < numberOfColumns; ++jj) {
+            rArray(ii, jj) *= -1.0;
+          }
+          for(size_t jj = 0; jj < numberOfRows; ++jj) {
+            qArray(jj, ii) *= -1.0;
+          }
+        }
+      }
+    }
+
+
+    // This function computes the singular value decomposition of a
+    // matrix using a caller-supplied workspace.
+    void
+    singularValueDecomposition(Array2D<Float64> const& inputArray,
+                               Array2D<Float64>& uArray,
+                               Array1D<Float64>& sigmaArray,
+                               Array2D<Float64>& vTransposeArray,
+                               LinearAlgebraWorkspace& workspace,
+                               bool isNullSpaceRequired)
+    {
+      // Argument checking.
+      if(inputArray.size() == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "singularValueDecomposition()",
+                    "Argument inputArray cannot have zero size.");
+      }
+
+      // As in the workspace-free version, LAPACK decomposes
+      // transpose(A) == V * S * transpose(U), so its U and VT
+      // outputs are written directly into vTransposeArray and
+      // uArray, respectively.  Copy first, in case inputArray shares
+      // memory with one of the outputs.
+      Float64* aColumnMajor = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_MATRIX_BUFFER, inputArray.size());
+      std::copy(inputArray.begin(), inputArray.end(), aColumnMajor);
+
+      size_t numberOfSingularValues =
+        std::min(inputArray.rows(), inputArray.columns());
+      size_t numberOfVRows =
+        isNullSpaceRequired ? inputArray.columns() : numberOfSingularValues;
+      size_t numberOfUColumns =
+        isNullSpaceRequired ? inputArray.rows() : numberOfSingularValues;
+      privateCode::prepareOutput(
+        vTransposeArray, numberOfVRows, inputArray.columns());
+      privateCode::prepareOutput(
+        uArray, inputArray.rows(), numberOfUColumns);
+      privateCode::prepareOutput(sigmaArray, numberOfSingularValues);
+      Int32* IWORK = workspace.getIntegerBuffer(8 * numberOfSingularValues);
+
+      char JOBZ = isNullSpaceRequired ? 'A' : 'S';
+      Int32 routine = (isNullSpaceRequired
+                       ? privateCode::BRICK_LA_DGESDD_A
+                       : privateCode::BRICK_LA_DGESDD_S);
+      Int32 M = static_cast<Int32>(inputArray.columns());
+      Int32 N = static_cast<Int32>(inputArray.rows());
+      Int32 LDA = M;
+      Int32 LDU = M;
+      Int32 LDVT = static_cast<Int32>(numberOfUColumns);
+      Int32 INFO;
+      Int32 LWORK = workspace.getWorkSize(routine, M, N);
+      if(LWORK < 0) {
+        Float64 WORK;
+        dgesdd_(&JOBZ, &M, &N, aColumnMajor, &LDA,
+                sigmaArray.data(), vTransposeArray.data(), &LDU,
+                uArray.data(), &LDVT, &WORK, &LWORK, IWORK, &INFO);
+        privateCode::checkInfo(
+          INFO, "dgesdd_", "singularValueDecomposition()");
+        LWORK = privateCode::recordWorkSize(workspace, routine, M, N, WORK);
+      }
+      Float64* WORK = workspace.getFloatBuffer(
+        privateCode::BRICK_LA_WORK_BUFFER, static_cast<size_t>(LWORK));
+      dgesdd_(&JOBZ, &M, &N, aColumnMajor, &LDA,
+              sigmaArray.data(), vTransposeArray.data(), &LDU,
+              uArray.data(), &LDVT, WORK, &LWORK, IWORK, &INFO);
+      privateCode::checkInfo(INFO, "dgesdd_", "singularValueDecomposition()");
+    }
+
+
+    // This function calls eigenvectorsSymmetric() for each matrix in
+    // a batch.
+    void
+    eigenvectorsSymmetricBatch(
+      std::vector< Array2D<Float64> > const& inputArrays,
+      std::vector< Array1D<Float64> >& eigenvalues,
+      std::vector< Array2D<Float64> >& eigenvectors,
+      std::size_t numberOfThreads)
+    {
+      eigenvalues.resize(inputArrays.size());
+      eigenvectors.resize(inputArrays.size());
+      privateCode::unshareOutputs(eigenvalues);
+      privateCode::unshareOutputs(eigenvectors);
+      privateCode::executeBatch(
+        inputArrays.size(),
+        [&](std::size_t ii, LinearAlgebraWorkspace& workspace) {
+          eigenvectorsSymmetric(inputArrays[ii], eigenvalues[ii],
+                                eigenvectors[ii], workspace);
+        },
+        numberOfThreads);
+    }
+
+
+    // This function inverts each matrix in a batch.
+    void
+    inverseBatch(std::vector< Array2D<Float64> > const& inputArrays,
+                 std::vector< Array2D<Float64> >& inverses,
+                 std::size_t numberOfThreads)
+    {
+      inverses.resize(inputArrays.size());
+      privateCode::unshareOutputs(inverses);
+      privateCode::executeBatch(
+        inputArrays.size(),
+        [&](std::size_t ii, LinearAlgebraWorkspace& workspace) {
+          inverse(inputArrays[ii], inverses[ii], workspace);
+        },
+        numberOfThreads);
+    }
+
+
+    // This function calls linearLeastSquares() for each system in a
+    // batch.
+    void
+    linearLeastSquaresBatch(std::vector< Array2D<Float64> > const& AArrays,
+                            std::vector< Array1D<Float64> > const& bArrays,
+                            std::vector< Array1D<Float64> >& xArrays,
+                            std::size_t numberOfThreads)
+    {
+      if(AArrays.size() != bArrays.size()) {
+        BRICK_THROW(brick::common::ValueException,
+                    "linearLeastSquaresBatch()",
+                    "Arguments AArrays and bArrays must have the same "
+                    "number of elements.");
+      }
+      xArrays.resize(AArrays.size());
+      privateCode::unshareOutputs(xArrays);
+      privateCode::executeBatch(
+        AArrays.size(),
+        [&](std::size_t ii, LinearAlgebraWorkspace& workspace) {
+          linearLeastSquares(AArrays[ii], bArrays[ii], xArrays[ii],
+                             workspace);
+        },
+        numberOfThreads);
+    }
+
+
+    // This function calls qrFactorization() for each matrix in a
+    // batch.
+    void
+    qrFactorizationBatch(std::vector< Array2D<Float64> > const& inputArrays,
+                         std::vector< Array2D<Float64> >& qArrays,
+                         std::vector< Array2D<Float64> >& rArrays,
+                         std::size_t numberOfThreads)
+    {
+      qArrays.resize(inputArrays.size());
+      rArrays.resize(inputArrays.size());
+      privateCode::unshareOutputs(qArrays);
+      privateCode::unshareOutputs(rArrays);
+      privateCode::executeBatch(
+        inputArrays.size(),
+        [&](std::size_t ii, LinearAlgebraWorkspace& workspace) {
+          qrFactorization(inputArrays[ii], qArrays[ii], rArrays[ii],
+                          workspace);
+        },
+        numberOfThreads);
+    }
+
+
+    // This function calls singularValueDecomposition() for each
+    // matrix in a batch.
+    void
+    singularValueDecompositionBatch(
+      std::vector< Array2D<Float64> > const& inputArrays,
+      std::vector< Array2D<Float64> >& uArrays,
+      std::vector< Array1D<Float64> >& sigmaArrays,
+      std::vector< Array2D<Float64> >& vTransposeArrays,
+      bool isNullSpaceRequired,
+      std::size_t numberOfThreads)
+    {
+      uArrays.resize(inputArrays.size());
+      sigmaArrays.resize(inputArrays.size());
+      vTransposeArrays.resize(inputArrays.size());
+      privateCode::unshareOutputs(uArrays);
+      privateCode::unshareOutputs(sigmaArrays);
+      privateCode::unshareOutputs(vTransposeArrays);
+      privateCode::executeBatch(
+        inputArrays.size(),
+        [&](std::size_t ii, LinearAlgebraWorkspace& workspace) {
+          singularValueDecomposition(
+            inputArrays[ii], uArrays[ii], sigmaArrays[ii],
+            vTransposeArrays[ii], workspace, isNullSpaceRequired);
+        },
+        numberOfThreads);
+    }
+
+  } // namespace linearAlgebra
+
+} // namespace brick
@@ -0,0 +1,519 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/linearAlgebraWorkspace.hh
+*
+* Header file declaring a reusable LAPACK workspace, along with
+* workspace-aware and batched versions of some of the routines in
+* linearAlgebra.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+***************************************************************************
+**/
+
+#ifndef BRICK_LINEARALGEBRA_LINEARALGEBRAWORKSPACE_HH
+#define BRICK_LINEARALGEBRA_LINEARALGEBRAWORKSPACE_HH
+
+#include <cstddef>
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/linearAlgebra/linearAlgebra.hh>
+#include <brick/numeric/array1D.hh>
+#include <brick/numeric/array2D.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    /**
+     ** This class holds the scratch memory that LAPACK needs, so that
+     ** it can be reused from one call to the next.  Each of the
+     ** routines in linearAlgebra.hh allocates a copy of its input,
+     ** queries LAPACK for the optimal workspace size, and then
+     ** allocates that workspace, every time it is called.  For small
+     ** matrices, this bookkeeping can cost as much as the
+     ** factorization itself.  The overloads declared in this file
+     ** accept a LinearAlgebraWorkspace instance instead.  Buffers
+     ** only ever grow, and the answers to LAPACK workspace queries
+     ** are remembered for each problem size, so repeated calls on
+     ** same-sized matrices allocate nothing but (when its size
+     ** changes) the result.
+     **
+     ** These overloads also never transpose their input.  A
+     ** row-major Array2D looks to LAPACK like the column-major
+     ** storage of its own transpose, so each routine is arranged to
+     ** solve the transposed problem directly.
+     **
+     ** Output arguments are written in place when they already have
+     ** the right shape.  Since copies of an Array1D or Array2D share
+     ** their data, an output whose data is shared with any other
+     ** array is first reallocated, so a call never changes the
+     ** contents of some other array that happens to share memory
+     ** with one of its outputs.  This also means that an output
+     ** vector filled with copies of a single array is safe to pass
+     ** to the batched functions.  Arrays that wrap memory they don't
+     ** own are not reference counted, and are always written in
+     ** place.
+     **
+     ** A LinearAlgebraWorkspace may not be used by two threads at
+     ** once.  The batched functions at the bottom of this file
+     ** create one workspace per thread.
+     **
+     ** @code
+     **   LinearAlgebraWorkspace workspace;
+     **   Array2D<double> uArray;
+     **   Array1D<double> sigmaArray;
+     **   Array2D<double> vTransposeArray;
+     **   for(size_t ii = 0; ii < matrices.size(); ++ii) {
+     **     singularValueDecomposition(matrices[ii], uArray, sigmaArray,
+     **                                vTransposeArray, workspace);
+     **     ...
+     **   }
+     ** @endcode
+     **/
+    class LinearAlgebraWorkspace {
+    public:
+
+      /**
+       * The default constructor creates an empty workspace.  Memory
+       * is allocated as it is needed.
+       */
+      LinearAlgebraWorkspace();
+
+
+      /**
+       * This member function releases all memory held by the
+       * workspace, and forgets all remembered workspace sizes.
+       */
+      void
+      clear();
+
+
+      /**
+       * This member function returns a pointer to one of the
+       * workspace's floating point buffers, growing it if necessary.
+       * The contents of the buffer are unspecified.  It is intended
+       * for use by the routines in this file, but is available to
+       * user code that calls LAPACK directly.
+       *
+       * @param bufferIndex This argument selects which buffer is
+       * returned.  Distinct indices give non-overlapping memory.
+       *
+       * @param numberOfElements This argument specifies the minimum
+       * number of elements the returned buffer must hold.
+       *
+       * @return The return value points to the first element of the
+       * buffer.  It remains valid until the next call to
+       * getFloatBuffer() with the same bufferIndex, or to clear().
+       */
+      brick::common::Float64*
+      getFloatBuffer(std::size_t bufferIndex, std::size_t numberOfElements);
+
+
+      /**
+       * This member function returns a pointer to the workspace's
+       * integer buffer, growing it if necessary.  It is otherwise
+       * just like getFloatBuffer().
+       *
+       * @param numberOfElements This argument specifies the minimum
+       * number of elements the returned buffer must hold.
+       *
+       * @return The return value points to the first element of the
+       * buffer.
+       */
+      brick::common::Int32*
+      getIntegerBuffer(std::size_t numberOfElements);
+
+
+      /**
+       * This member function returns the total number of bytes
+       * currently held by the workspace.
+       *
+       * @return The return value is the combined capacity of all
+       * buffers, in bytes.
+       */
+      std::size_t
+      getNumberOfBytes() const;
+
+
+      /**
+       * This member function looks up a LAPACK workspace size
+       * previously recorded by setWorkSize().
+       *
+       * @param routine This argument identifies the LAPACK routine
+       * (and options) that the size applies to.  Any value unique to
+       * the caller will do.
+       *
+       * @param rows This argument is the first size argument passed
+       * to the routine.
+       *
+       * @param columns This argument is the second size argument
+       * passed to the routine.
+       *
+       * @return The return value is the recorded size, or -1 if
+       * there is none.
+       */
+      brick::common::Int32
+      getWorkSize(brick::common::Int32 routine,
+                  brick::common::Int32 rows,
+                  brick::common::Int32 columns) const;
+
+
+      /**
+       * This member function records a LAPACK workspace size, so
+       * that subsequent calls with the same arguments can skip the
+       * workspace query.
+       *
+       * @param routine This argument identifies the LAPACK routine.
+       * See getWorkSize().
+       *
+       * @param rows This argument is the first size argument passed
+       * to the routine.
+       *
+       * @param columns This argument is the second size argument
+       * passed to the routine.
+       *
+       * @param workSize This argument is the size to record.
+       */
+      void
+      setWorkSize(brick::common::Int32 routine,
+                  brick::common::Int32 rows,
+                  brick::common::Int32 columns,
+                  brick::common::Int32 workSize);
+
+    private:
+
+      struct WorkSizeEntry {
+        brick::common::Int32 routine;
+        brick::common::Int32 rows;
+        brick::common::Int32 columns;
+        brick::common::Int32 workSize;
+      };
+
+      std::vector< std::vector<brick::common::Float64> > m_floatBuffers;
+      std::vector<brick::common::Int32> m_integerBuffer;
+      std::vector<WorkSizeEntry> m_workSizes;
+
+    }; // class LinearAlgebraWorkspace
+
+
+    /**
+     * This function computes the eigenvalues and eigenvectors of a
+     * symmetric real matrix, just like
+     * eigenvectorsSymmetric(Array2D<Float64> const&, Array1D<Float64>&,
+     * Array2D<Float64>&), but takes its scratch memory from the
+     * specified workspace.
+     *
+     * @param inputArray This argument is the symmetric matrix.  It
+     * must be square and have non-zero size.
+     *
+     * @param eigenvalues This argument is used to return the
+     * eigenvalues, sorted into descending order.  It is only
+     * reallocated if it has the wrong size or shares its data with
+     * another array.
+     *
+     * @param eigenvectors This argument is used to return the
+     * eigenvectors, one per column, in the same order as the
+     * eigenvalues.  It is only reallocated if it has the wrong size
+     * or shares its data with another array.
+     *
+     * @param workspace This argument supplies the scratch memory.
+     */
+    void
+    eigenvectorsSymmetric(
+      brick::numeric::Array2D<brick::common::Float64> const& inputArray,
+      brick::numeric::Array1D<brick::common::Float64>& eigenvalues,
+      brick::numeric::Array2D<brick::common::Float64>& eigenvectors,
+      LinearAlgebraWorkspace& workspace);
+
+
+    /**
+     * This function computes the inverse of a square matrix using
+     * LAPACK.  The input is copied directly into the result, which
+     * is then factored and inverted in place.  Because the row-major
+     * copy is seen by LAPACK as transpose(A), and the inverse of
+     * transpose(A) is transpose(inverse(A)), no transposing is
+     * required.  If the matrix is singular, a ValueException will
+     * be generated.
+     *
+     * @param AA This argument is the matrix to be inverted.
+     *
+     * @param AInverse This argument is used to return the inverse.
+     * It is only reallocated if it has the wrong size or shares its
+     * data with another array.  AInverse may be the same array as
+     * AA, in which case, if its data isn't shared, the inversion is
+     * done in place.
+     *
+     * @param workspace This argument supplies the scratch memory.
+     */
+    void
+    inverse(brick::numeric::Array2D<brick::common::Float64> const& AA,
+            brick::numeric::Array2D<brick::common::Float64>& AInverse,
+            LinearAlgebraWorkspace& workspace);
+
+
+    /**
+     * This function solves the system of equations A*x = b in the
+     * least squares sense (or, for underconstrained systems, finds
+     * the minimum-norm solution), just like
+     * linearLeastSquares(Array2D<Float64> const&,
+     * Array1D<Float64> const&), but takes its scratch memory from
+     * the specified workspace.
+     *
+     * @param AA This argument specifies the A matrix in the system
+     * "Ax = b."
+     *
+     * @param bb This argument specifies the b vector in the system
+     * "Ax = b."  It must have the same number of elements as argument
+     * AA has rows.
+     *
+     * @param xx This argument is used to return the solution.  It is
+     * only reallocated if it has the wrong size or shares its data
+     * with another array.
+     *
+     * @param workspace This argument supplies the scratch memory.
+     */
+    void
+    linearLeastSquares(
+      brick::numeric::Array2D<brick::common::Float64> const& AA,
+      brick::numeric::Array1D<brick::common::Float64> const& bb,
+      brick::numeric::Array1D<brick::common::Float64>& xx,
+      LinearAlgebraWorkspace& workspace);
+
+
+    /**
+     * This function computes the QR factorization of a general
+     * matrix, with the same conventions as
+     * qrFactorization(Array2D<Float64> const&, Array2D<Float64>&,
+     * Array2D<Float64>&), but takes its scratch memory from the
+     * specified workspace.  Rather than transposing, it computes the
+     * LQ factorization of the transpose, L * Q', which LAPACK sees
+     * in the row-major input.  Then A = transpose(Q') * transpose(L),
+     * and both factors can be read straight out of LAPACK's
+     * column-major output.  Q is formed using dorglq(), rather than
+     * by multiplying out the elementary reflectors one at a time.
+     *
+     * @param inputArray This argument is the matrix to be factored.
+     *
+     * @param qArray This argument will be filled in with the MxM
+     * orthogonal matrix Q.  It is only reallocated if it has the
+     * wrong size or shares its data with another array.
+     *
+     * @param rArray This argument will be filled in with the MxN
+     * upper trapezoidal matrix R, which has non-negative diagonal
+     * elements.  It is only reallocated if it has the wrong size or
+     * shares its data with another array.
+     *
+     * @param workspace This argument supplies the scratch memory.
+     */
+    void
+    qrFactorization(
+      brick::numeric::Array2D<brick::common::Float64> const& inputArray,
+      brick::numeric::Array2D<brick::common::Float64>& qArray,
+      brick::numeric::Array2D<brick::common::Float64>& rArray,
+      LinearAlgebraWorkspace& workspace);
+
+
+    /**
+     * This function computes the singular value decomposition of a
+     * matrix, just like singularValueDecomposition(Array2D<Float64>
+     * const&, Array2D<Float64>&, Array1D<Float64>&, Array2D<Float64>&,
+     * bool, bool), but takes its scratch memory from the specified
+     * workspace.  After a successful call,
+     * matrixMultiply(matrixMultiply(uArray, sigmaArray), vTransposeArray)
+     *  == inputArray.
+     *
+     * @param inputArray This argument is the matrix to be decomposed.
+     *
+     * @param uArray This argument will be filled in with an
+     * orthonormal basis spanning the range of the input matrix, one
+     * basis vector per column.  If inputArray is MxN, it will be
+     * M x min(M, N), or MxM if isNullSpaceRequired is true.
+     *
+     * @param sigmaArray This argument will be filled in with the
+     * min(M, N) singular values, in descending order.
+     *
+     * @param vTransposeArray This argument will be filled in with an
+     * orthonormal basis spanning the domain of the input matrix, one
+     * basis vector per row.  It will be min(M, N) x N, or NxN if
+     * isNullSpaceRequired is true.
+     *
+     * @param workspace This argument supplies the scratch memory.
+     *
+     * @param isNullSpaceRequired This argument specifies whether
+     * full, square U and V matrices should be returned.
+     */
+    void
+    singularValueDecomposition(
+      brick::numeric::Array2D<brick::common::Float64> const& inputArray,
+      brick::numeric::Array2D<brick::common::Float64>& uArray,
+      brick::numeric::Array1D<brick::common::Float64>& sigmaArray,
+      brick::numeric::Array2D<brick::common::Float64>& vTransposeArray,
+      LinearAlgebraWorkspace& workspace,
+      bool isNullSpaceRequired = false);
+
+
+    /**
+     * This function calls eigenvectorsSymmetric() for each matrix in
+     * a batch, spreading the work across threads.  Each thread
+     * handles a contiguous run of the batch with its own
+     * LinearAlgebraWorkspace, so workspace reuse pays off most when
+     * the matrices all have the same size.  Before any thread
+     * starts, output elements that share their data with another
+     * array are replaced by empty arrays, so each thread writes
+     * only to memory that no other array refers to.
+     *
+     * @param inputArrays This argument holds the symmetric matrices.
+     *
+     * @param eigenvalues This argument is resized to match
+     * inputArrays, and element i is used to return the eigenvalues
+     * of inputArrays[i].
+     *
+     * @param eigenvectors This argument is resized to match
+     * inputArrays, and element i is used to return the eigenvectors
+     * of inputArrays[i].
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  If it is zero (the default), a
+     * sensible default is chosen.
+     */
+    void
+    eigenvectorsSymmetricBatch(
+      std::vector< brick::numeric::Array2D<brick::common::Float64> > const&
+        inputArrays,
+      std::vector< brick::numeric::Array1D<brick::common::Float64> >&
+        eigenvalues,
+      std::vector< brick::numeric::Array2D<brick::common::Float64> >&
+        eigenvectors,
+      std::size_t numberOfThreads = 0);
+
+
+    /**
+     * This function inverts each matrix in a batch, spreading the
+     * work across threads.  See eigenvectorsSymmetricBatch() for
+     * details of how the work is divided.
+     *
+     * @param inputArrays This argument holds the matrices to be
+     * inverted.
+     *
+     * @param inverses This argument is resized to match inputArrays,
+     * and element i is used to return the inverse of inputArrays[i].
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  If it is zero (the default), a
+     * sensible default is chosen.
+     */
+    void
+    inverseBatch(
+      std::vector< brick::numeric::Array2D<brick::common::Float64> > const&
+        inputArrays,
+      std::vector< brick::numeric::Array2D<brick::common::Float64> >&
+        inverses,
+      std::size_t numberOfThreads = 0);
+
+
+    /**
+     * This function calls linearLeastSquares() for each system in a
+     * batch, spreading the work across threads.  See
+     * eigenvectorsSymmetricBatch() for details of how the work is
+     * divided.
+     *
+     * @param AArrays This argument holds the A matrices.
+     *
+     * @param bArrays This argument holds the b vectors.  It must
+     * have the same number of elements as AArrays.
+     *
+     * @param xArrays This argument is resized to match AArrays, and
+     * element i is used to return the solution for AArrays[i] and
+     * bArrays[i].
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  If it is zero (the default), a
+     * sensible default is chosen.
+     */
+    void
+    linearLeastSquaresBatch(
+      std::vector< brick::numeric::Array2D<brick::common::Float64> > const&
+        AArrays,
+      std::vector< brick::numeric::Array1D<brick::common::Float64> > const&
+        bArrays,
+      std::vector< brick::numeric::Array1D<brick::common::Float64> >&
+        xArrays,
+      std::size_t numberOfThreads = 0);
+
+
+    /**
+     * This function calls qrFactorization() for each matrix in a
+     * batch, spreading the work across threads.  See
+     * eigenvectorsSymmetricBatch() for details of how the work is
+     * divided.
+     *
+     * @param inputArrays This argument holds the matrices to be
+     * factored.
+     *
+     * @param qArrays This argument is resized to match inputArrays,
+     * and element i is used to return Q for inputArrays[i].
+     *
+     * @param rArrays This argument is resized to match inputArrays,
+     * and element i is used to return R for inputArrays[i].
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  If it is zero (the default), a
+     * sensible default is chosen.
+     */
+    void
+    qrFactorizationBatch(
+      std::vector< brick::numeric::Array2D<brick::common::Float64> > const&
+        inputArrays,
+      std::vector< brick::numeric::Array2D<brick::common::Float64> >&
+        qArrays,
+      std::vector< brick::numeric::Array2D<brick::common::Float64> >&
+        rArrays,
+      std::size_t numberOfThreads = 0);
+
+
+    /**
+     * This function calls singularValueDecomposition() for each
+     * matrix in a batch, spreading the work across threads.  See
+     * eigenvectorsSymmetricBatch() for details of how the work is
+     * divided.
+     *
+     * @param inputArrays This argument holds the matrices to be
+     * decomposed.
+     *
+     * @param uArrays This argument is resized to match inputArrays,
+     * and element i is used to return U for inputArrays[i].
+     *
+     * @param sigmaArrays This argument is resized to match
+     * inputArrays, and element i is used to return the singular
+     * values of inputArrays[i].
+     *
+     * @param vTransposeArrays This argument is resized to match
+     * inputArrays, and element i is used to return transpose(V) for
+     * inputArrays[i].
+     *
+     * @param isNullSpaceRequired This argument specifies whether
+     * full, square U and V matrices should be returned.
+     *
+     * @param numberOfThreads This argument specifies the maximum
+     * number of threads to use.  If it is zero (the default), a
+     * sensible default is chosen.
+     */
+    void
+    singularValueDecompositionBatch(
+      std::vector< brick::numeric::Array2D<brick::common::Float64> > const&
+        inputArrays,
+      std::vector< brick::numeric::Array2D<brick::common::Float64> >&
+        uArrays,
+      std::vector< brick::numeric::Array1D<brick::common::Float64> >&
+        sigmaArrays,
+      std::vector< brick::numeric::Array2D<brick::common::Float64> >&
+        vTransposeArrays,
+      bool isNullSpaceRequired = false,
+      std::size_t numberOfThreads = 0);
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+#endif // #ifndef BRICK_LINEARALGEBRA_LINEARALGEBRAWORKSPACE_HH
@@ -20,6 +20,7 @@
 // #include <brick/linearAlgebra/linearAlgebra.hh>
 
 #include <brick/common/exception.hh>
+#include <brick/linearAlgebra/bandedLU.hh>
 #include <brick/numeric/utilities.hh>
 #include <brick/numeric/numericTraits.hh>
 #include <brick/numeric/maxRecorder.hh>
@@ -320,6 +321,19 @@ namespace brick {
 
 
 
+    // This function solves the system of equations A*x = b, where A
+    // is a known banded (or cyclic banded) matrix.
+    template <class FloatType>
+    brick::numeric::Array1D<FloatType>
+    linearSolveBanded(brick::numeric::Array2D<FloatType> const& bands,
+                      brick::numeric::Array1D<FloatType> const& bVector,
+                      bool isCyclic)
+    {
+      BandedLU<FloatType> factorization(bands, isCyclic);
+      return factorization.solve(bVector);
+    }
+
+
     // This function accepts an Array2D<Float64> instance having at least
     // as many rows as columns, and returns the Moore-Penrose
     // pseudoinverse.
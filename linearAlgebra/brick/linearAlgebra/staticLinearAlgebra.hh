@@ -0,0 +1,227 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/staticLinearAlgebra.hh
+*
+* Header file declaring linear algebra functions that operate on
+* fixed-size StaticArray1D and StaticArray2D instances.  Unlike the
+* routines in linearAlgebra.hh, these do not depend on LAPACK, and
+* do not allocate memory from the heap.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+***************************************************************************
+**/
+
+#ifndef BRICK_LINEARALGEBRA_STATICLINEARALGEBRA_HH
+#define BRICK_LINEARALGEBRA_STATICLINEARALGEBRA_HH
+
+#include <cstddef>
+#include <brick/numeric/staticArray1D.hh>
+#include <brick/numeric/staticArray2D.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    /**
+     * This function computes the eigenvalues and eigenvectors of a
+     * small symmetric real matrix using the cyclic Jacobi method.
+     * It is the fixed-size counterpart of
+     * eigenvectorsSymmetric(Array2D<Float64> const&, ...), and
+     * returns results in the same order.  For 3x3 matrices, the
+     * overload of eigenvectorsSymmetric() below uses a closed form
+     * solution instead, but you can call this function directly if
+     * you prefer the iterative method.
+     *
+     * @param inputArray This argument is the matrix to be
+     * decomposed.  Only the data in the upper triangular portion of
+     * the array (including the diagonal) will be examined.  The
+     * remaining elements are assumed to be symmetric.
+     *
+     * @param eigenvalues This argument is used to return the
+     * eigenvalues, sorted into descending order.
+     *
+     * @param eigenvectors This argument is used to return the
+     * eigenvectors.  On return, the first column contains the unit
+     * eigenvector corresponding to the first eigenvalue, the second
+     * column contains the eigenvector corresponding to the second
+     * eigenvalue, and so on.
+     */
+    template <class FloatType, size_t Size>
+    void
+    eigenvectorsSymmetricJacobi(
+      brick::numeric::StaticArray2D<FloatType, Size, Size> const& inputArray,
+      brick::numeric::StaticArray1D<FloatType, Size>& eigenvalues,
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& eigenvectors);
+
+
+    /**
+     * This function computes the eigenvalues and eigenvectors of a
+     * small symmetric real matrix.  It simply calls
+     * eigenvectorsSymmetricJacobi().  Please see the documentation of
+     * that function for details.
+     *
+     * @param inputArray This argument is the matrix to be
+     * decomposed.  Only the upper triangular portion is examined.
+     *
+     * @param eigenvalues This argument is used to return the
+     * eigenvalues, sorted into descending order.
+     *
+     * @param eigenvectors This argument is used to return the unit
+     * eigenvectors, one per column.
+     */
+    template <class FloatType, size_t Size>
+    inline void
+    eigenvectorsSymmetric(
+      brick::numeric::StaticArray2D<FloatType, Size, Size> const& inputArray,
+      brick::numeric::StaticArray1D<FloatType, Size>& eigenvalues,
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& eigenvectors)
+    {
+      eigenvectorsSymmetricJacobi(inputArray, eigenvalues, eigenvectors);
+    }
+
+
+    /**
+     * This function computes the eigenvalues and eigenvectors of a
+     * 3x3 symmetric real matrix without iterating.  The best
+     * separated eigenvalue is found in closed form using the
+     * trigonometric solution to the characteristic cubic, and its
+     * eigenvector is recovered using cross products, following
+     * D. Eberly, "A Robust Eigensolver for 3x3 Symmetric Matrices,"
+     * Geometric Tools, 2014.  The remaining two eigenpairs come from
+     * a single plane rotation in the orthogonal complement, so
+     * repeated eigenvalues are handled exactly.  The matrix is
+     * scaled internally to avoid overflow.
+     *
+     * @param inputArray This argument is the matrix to be
+     * decomposed.  Only the upper triangular portion is examined.
+     *
+     * @param eigenvalues This argument is used to return the
+     * eigenvalues, sorted into descending order.
+     *
+     * @param eigenvectors This argument is used to return the unit
+     * eigenvectors, one per column.  The columns form a right handed
+     * orthonormal basis.
+     */
+    template <class FloatType>
+    void
+    eigenvectorsSymmetric(
+      brick::numeric::StaticArray2D<FloatType, 3, 3> const& inputArray,
+      brick::numeric::StaticArray1D<FloatType, 3>& eigenvalues,
+      brick::numeric::StaticArray2D<FloatType, 3, 3>& eigenvectors);
+
+
+    /**
+     * This function solves the system of equations A*x = b, where A
+     * is a known square matrix, and b is a known vector.  It uses
+     * Householder QR factorization, and works entirely on the stack.
+     * The contents of both arguments are modified as part of the
+     * process.  If A is singular, a ValueException will be
+     * generated.
+     *
+     * @param AA This argument specifies the A matrix in the system
+     * "Ax = b."  It will be overwritten.
+     *
+     * @param bb This argument specifies the b vector in the system
+     * "Ax = b."  It will be replaced with the recovered value of x.
+     */
+    template <class FloatType, size_t Size>
+    void
+    linearSolveInPlace(
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& AA,
+      brick::numeric::StaticArray1D<FloatType, Size>& bb);
+
+
+    /**
+     * This function is identical to linearSolveInPlace(StaticArray2D&,
+     * StaticArray1D&), except that b (and therefore x) is not
+     * constrained to be a vector.  Each column of b is solved for
+     * independently, so solving with a 10x10 b computes inverse(A) * b
+     * without ever forming the inverse.
+     *
+     * @param AA This argument specifies the A matrix in the system
+     * "Ax = b."  It will be overwritten.
+     *
+     * @param bb This argument specifies the b matrix in the system
+     * "Ax = b."  It will be replaced with the recovered value of x.
+     */
+    template <class FloatType, size_t Size, size_t Columns>
+    void
+    linearSolveInPlace(
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& AA,
+      brick::numeric::StaticArray2D<FloatType, Size, Columns>& bb);
+
+
+    /**
+     * This function computes the QR factorization of a small
+     * matrix using Householder reflections.  That is, for an MxN
+     * matrix A (M rows and N columns), it computes the MxM
+     * orthogonal matrix Q (that is, Q^T * Q == I) and the MxN upper
+     * trapezoidal matrix R such that A = Q*R, and the diagonal
+     * elements of R are non-negative.
+     *
+     * @param inputArray This argument is the matrix to be factored.
+     *
+     * @param qArray This argument will be filled in with the
+     * orthogonal matrix Q.
+     *
+     * @param rArray This argument will be filled in with the upper
+     * trapezoidal matrix R.
+     */
+    template <class FloatType, size_t Rows, size_t Columns>
+    void
+    qrFactorization(
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns> const& inputArray,
+      brick::numeric::StaticArray2D<FloatType, Rows, Rows>& qArray,
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns>& rArray);
+
+
+    /**
+     * This function computes the thin singular value decomposition
+     * of a small matrix using one-sided (Hestenes) Jacobi rotations.
+     * After a successful call,
+     * matrixMultiply(matrixMultiply(uArray, diag(sigmaArray)),
+     * vTransposeArray) == inputArray.  One-sided Jacobi is slower
+     * than the bidiagonalization used by LAPACK for large matrices,
+     * but for the tiny, fixed-size problems that arise in geometric
+     * vision it is fast, and computes small singular values to high
+     * relative accuracy.
+     *
+     * The input must have at least as many rows as columns.  To
+     * decompose a wide matrix, decompose its transpose, or pad it
+     * with rows of zeros, which changes neither the singular values
+     * nor V.
+     *
+     * @param inputArray This argument is the matrix to be decomposed.
+     *
+     * @param uArray This argument will be filled in with an
+     * orthonormal basis for the range of the input matrix, one basis
+     * vector per column.  If the input is rank deficient, the columns
+     * corresponding to zero singular values are filled in with
+     * arbitrary unit vectors that keep the columns orthonormal.
+     *
+     * @param sigmaArray This argument will be filled in with the
+     * singular values of the matrix, in descending order.
+     *
+     * @param vTransposeArray This argument will be filled in with an
+     * orthonormal basis spanning the domain of the input matrix, one
+     * basis vector per row.  Because the input has at least as many
+     * rows as columns, this includes the null space.
+     */
+    template <class FloatType, size_t Rows, size_t Columns>
+    void
+    singularValueDecomposition(
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns> const& inputArray,
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns>& uArray,
+      brick::numeric::StaticArray1D<FloatType, Columns>& sigmaArray,
+      brick::numeric::StaticArray2D<FloatType, Columns, Columns>& vTransposeArray);
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/linearAlgebra/staticLinearAlgebra_impl.hh>
+
+#endif // #ifndef BRICK_LINEARALGEBRA_STATICLINEARALGEBRA_HH
@@ -0,0 +1,715 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/staticLinearAlgebra_impl.hh
+*
+* Header file defining inline and template functions declared in
+* staticLinearAlgebra.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+***************************************************************************
+**/
+
+#ifndef BRICK_LINEARALGEBRA_STATICLINEARALGEBRA_IMPL_HH
+#define BRICK_LINEARALGEBRA_STATICLINEARALGEBRA_IMPL_HH
+
+// This file is included by staticLinearAlgebra.hh, and should not be
+// directly included by user code, so no need to include
+// staticLinearAlgebra.hh here.
+//
+// #include <brick/linearAlgebra/staticLinearAlgebra.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Upper limit on the number of Jacobi sweeps.  Convergence is
+      // quadratic, so well conditioned problems finish in well under
+      // a dozen sweeps.  This just guards against pathological input.
+      const size_t staticJacobiMaximumSweeps = 100;
+
+
+      // Find the tangent of the Jacobi rotation angle that zeros the
+      // off-diagonal element of the 2x2 symmetric matrix [[alpha,
+      // gamma], [gamma, beta]].  Gamma must be non-zero.
+      template <class FloatType>
+      inline FloatType
+      getJacobiTangent(FloatType alpha, FloatType beta, FloatType gamma)
+      {
+        FloatType zeta = (beta - alpha) / (FloatType(2.0) * gamma);
+        FloatType tangent = FloatType(1.0)
+          / (std::fabs(zeta) + std::hypot(zeta, FloatType(1.0)));
+        return (zeta < FloatType(0.0)) ? -tangent : tangent;
+      }
+
+
+      // Apply a plane rotation to two contiguous vectors of length
+      // Size: (xx, yy) <- (c*xx - s*yy, s*xx + c*yy).
+      template <class FloatType, size_t Size>
+      inline void
+      rotateVectors(FloatType* xx, FloatType* yy,
+                    FloatType cosine, FloatType sine)
+      {
+        for(size_t ii = 0; ii < Size; ++ii) {
+          FloatType gg = xx[ii];
+          FloatType hh = yy[ii];
+          xx[ii] = cosine * gg - sine * hh;
+          yy[ii] = sine * gg + cosine * hh;
+        }
+      }
+
+
+      // Dot product of two contiguous vectors of length Size.
+      template <class FloatType, size_t Size>
+      inline FloatType
+      staticDot(FloatType const* xx, FloatType const* yy)
+      {
+        FloatType result = FloatType(0.0);
+        for(size_t ii = 0; ii < Size; ++ii) {
+          result += xx[ii] * yy[ii];
+        }
+        return result;
+      }
+
+
+      // Reduce the upper trapezoid of AA to upper triangular form
+      // using Householder reflections, applying the same reflections
+      // to the rows of BB.  Returns false if a zero pivot is
+      // encountered.
+      template <class FloatType, size_t Size, size_t Columns>
+      bool
+      householderReduce(
+        brick::numeric::StaticArray2D<FloatType, Size, Size>& AA,
+        brick::numeric::StaticArray2D<FloatType, Size, Columns>& BB)
+      {
+        for(size_t kk = 0; kk < Size; ++kk) {
+          // Build the reflector that zeros column kk below the diagonal.
+          FloatType normSquared = FloatType(0.0);
+          for(size_t ii = kk; ii < Size; ++ii) {
+            normSquared += AA(ii, kk) * AA(ii, kk);
+          }
+          if(normSquared == FloatType(0.0)) {
+            return false;
+          }
+          FloatType norm = std::sqrt(normSquared);
+          FloatType alpha = (AA(kk, kk) > FloatType(0.0)) ? -norm : norm;
+          FloatType vv[Size];
+          for(size_t ii = kk; ii < Size; ++ii) {
+            vv[ii] = AA(ii, kk);
+          }
+          vv[kk] -= alpha;
+          FloatType vvNormSquared = normSquared - AA(kk, kk) * AA(kk, kk)
+            + vv[kk] * vv[kk];
+          FloatType scale = FloatType(2.0) / vvNormSquared;
+
+          // Apply it to the remaining columns of AA, and to BB.
+          AA(kk, kk) = alpha;
+          for(size_t ii = kk + 1; ii < Size; ++ii) {
+            AA(ii, kk) = FloatType(0.0);
+          }
+          for(size_t jj = kk + 1; jj < Size; ++jj) {
+            FloatType projection = FloatType(0.0);
+            for(size_t ii = kk; ii < Size; ++ii) {
+              projection += vv[ii] * AA(ii, jj);
+            }
+            projection *= scale;
+            for(size_t ii = kk; ii < Size; ++ii) {
+              AA(ii, jj) -= projection * vv[ii];
+            }
+          }
+          for(size_t jj = 0; jj < Columns; ++jj) {
+            FloatType projection = FloatType(0.0);
+            for(size_t ii = kk; ii < Size; ++ii) {
+              projection += vv[ii] * BB(ii, jj);
+            }
+            projection *= scale;
+            for(size_t ii = kk; ii < Size; ++ii) {
+              BB(ii, jj) -= projection * vv[ii];
+            }
+          }
+        }
+        return true;
+      }
+
+
+      // Back substitution for R * X = B, where R is the upper
+      // triangle of AA.  The result overwrites BB.
+      template <class FloatType, size_t Size, size_t Columns>
+      void
+      backSubstitute(
+        brick::numeric::StaticArray2D<FloatType, Size, Size> const& AA,
+        brick::numeric::StaticArray2D<FloatType, Size, Columns>& BB)
+      {
+        for(size_t ii = Size; ii-- > 0;) {
+          FloatType* bRow = BB.rowBegin(ii);
+          for(size_t kk = ii + 1; kk < Size; ++kk) {
+            FloatType const aa = AA(ii, kk);
+            FloatType const* xRow = BB.rowBegin(kk);
+            for(size_t jj = 0; jj < Columns; ++jj) {
+              bRow[jj] -= aa * xRow[jj];
+            }
+          }
+          FloatType const pivot = AA(ii, ii);
+          for(size_t jj = 0; jj < Columns; ++jj) {
+            bRow[jj] /= pivot;
+          }
+        }
+      }
+
+
+      // Compute a unit vector in the null space of the rows of 3x3
+      // matrix MM, which is assumed to have rank 2.  We take the
+      // longest of the three pairwise cross products of its rows.
+      template <class FloatType>
+      void
+      getEigenvector3x3Rank2(FloatType const* MM, FloatType* result)
+      {
+        FloatType const* r0 = MM;
+        FloatType const* r1 = MM + 3;
+        FloatType const* r2 = MM + 6;
+        FloatType c01[3] = {r0[1] * r1[2] - r0[2] * r1[1],
+                            r0[2] * r1[0] - r0[0] * r1[2],
+                            r0[0] * r1[1] - r0[1] * r1[0]};
+        FloatType c02[3] = {r0[1] * r2[2] - r0[2] * r2[1],
+                            r0[2] * r2[0] - r0[0] * r2[2],
+                            r0[0] * r2[1] - r0[1] * r2[0]};
+        FloatType c12[3] = {r1[1] * r2[2] - r1[2] * r2[1],
+                            r1[2] * r2[0] - r1[0] * r2[2],
+                            r1[0] * r2[1] - r1[1] * r2[0]};
+        FloatType d01 = staticDot<FloatType, 3>(c01, c01);
+        FloatType d02 = staticDot<FloatType, 3>(c02, c02);
+        FloatType d12 = staticDot<FloatType, 3>(c12, c12);
+        FloatType const* best = c01;
+        FloatType bestSquared = d01;
+        if(d02 > bestSquared) {best = c02; bestSquared = d02;}
+        if(d12 > bestSquared) {best = c12; bestSquared = d12;}
+        FloatType scale = FloatType(1.0) / std::sqrt(bestSquared);
+        for(size_t ii = 0; ii < 3; ++ii) {
+          result[ii] = best[ii] * scale;
+        }
+      }
+
+
+      // Given unit vector ww, compute unit vectors uu and vv so that
+      // {uu, vv, ww} is a right handed orthonormal basis.
+      template <class FloatType>
+      void
+      getOrthogonalComplement3D(FloatType const* ww,
+                                FloatType* uu, FloatType* vv)
+      {
+        if(std::fabs(ww[0]) > std::fabs(ww[1])) {
+          FloatType inverseLength = FloatType(1.0)
+            / std::sqrt(ww[0] * ww[0] + ww[2] * ww[2]);
+          uu[0] = -ww[2] * inverseLength;
+          uu[1] = FloatType(0.0);
+          uu[2] = ww[0] * inverseLength;
+        } else {
+          FloatType inverseLength = FloatType(1.0)
+            / std::sqrt(ww[1] * ww[1] + ww[2] * ww[2]);
+          uu[0] = FloatType(0.0);
+          uu[1] = ww[2] * inverseLength;
+          uu[2] = -ww[1] * inverseLength;
+        }
+        vv[0] = ww[1] * uu[2] - ww[2] * uu[1];
+        vv[1] = ww[2] * uu[0] - ww[0] * uu[2];
+        vv[2] = ww[0] * uu[1] - ww[1] * uu[0];
+      }
+
+
+      // Given a unit eigenvector evec0 of symmetric 3x3 matrix AA,
+      // find the other two eigenvectors and their eigenvalues.  We
+      // restrict AA to the 2D orthogonal complement of evec0, and
+      // diagonalize the resulting 2x2 matrix with a single Jacobi
+      // rotation.  This is exact up to rounding, even if the two
+      // remaining eigenvalues are equal or nearly so.
+      template <class FloatType>
+      void
+      getEigenvectors3x3Orthogonal(
+        FloatType const* AA, FloatType const* evec0,
+        FloatType* evec1, FloatType& eigenvalue1,
+        FloatType* evec2, FloatType& eigenvalue2)
+      {
+        FloatType uu[3];
+        FloatType vv[3];
+        getOrthogonalComplement3D(evec0, uu, vv);
+        FloatType Au[3];
+        FloatType Av[3];
+        for(size_t ii = 0; ii < 3; ++ii) {
+          Au[ii] = staticDot<FloatType, 3>(AA + 3 * ii, uu);
+          Av[ii] = staticDot<FloatType, 3>(AA + 3 * ii, vv);
+        }
+        FloatType m00 = staticDot<FloatType, 3>(uu, Au);
+        FloatType m01 = staticDot<FloatType, 3>(uu, Av);
+        FloatType m11 = staticDot<FloatType, 3>(vv, Av);
+
+        FloatType cosine = FloatType(1.0);
+        FloatType sine = FloatType(0.0);
+        eigenvalue1 = m00;
+        eigenvalue2 = m11;
+        if(m01 != FloatType(0.0)) {
+          FloatType tangent = getJacobiTangent(m00, m11, m01);
+          cosine = FloatType(1.0) / std::sqrt(FloatType(1.0) + tangent * tangent);
+          sine = tangent * cosine;
+          eigenvalue1 -= tangent * m01;
+          eigenvalue2 += tangent * m01;
+        }
+        for(size_t ii = 0; ii < 3; ++ii) {
+          evec1[ii] = cosine * uu[ii] - sine * vv[ii];
+          evec2[ii] = sine * uu[ii] + cosine * vv[ii];
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    template <class FloatType, size_t Size>
+    void
+    eigenvectorsSymmetricJacobi(
+      brick::numeric::StaticArray2D<FloatType, Size, Size> const& inputArray,
+      brick::numeric::StaticArray1D<FloatType, Size>& eigenvalues,
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& eigenvectors)
+    {
+      // Symmetrize from the upper triangle, and start with the
+      // identity matrix as our accumulated rotation.  We accumulate
+      // V^T rather than V so that each eigenvector is contiguous in
+      // memory while we're rotating.
+      brick::numeric::StaticArray2D<FloatType, Size, Size> AA;
+      brick::numeric::StaticArray2D<FloatType, Size, Size> vTranspose(
+        static_cast<FloatType>(0.0));
+      for(size_t rr = 0; rr < Size; ++rr) {
+        for(size_t cc = rr; cc < Size; ++cc) {
+          AA(rr, cc) = inputArray(rr, cc);
+          AA(cc, rr) = inputArray(rr, cc);
+        }
+        vTranspose(rr, rr) = static_cast<FloatType>(1.0);
+      }
+
+      // Cyclic Jacobi.  We skip rotations whose off-diagonal element
+      // is negligible relative to the corresponding diagonal
+      // elements, and stop when a full sweep makes no rotations.
+      FloatType const epsilon = std::numeric_limits<FloatType>::epsilon();
+      FloatType const tiny = std::numeric_limits<FloatType>::min();
+      for(size_t sweep = 0; sweep < privateCode::staticJacobiMaximumSweeps;
+          ++sweep) {
+        bool isRotated = false;
+        for(size_t pp = 0; pp + 1 < Size; ++pp) {
+          for(size_t qq = pp + 1; qq < Size; ++qq) {
+            FloatType const gamma = AA(pp, qq);
+            FloatType const absGamma = std::fabs(gamma);
+            if(absGamma <= tiny
+               || absGamma <= epsilon * std::sqrt(
+                 std::fabs(AA(pp, pp)) * std::fabs(AA(qq, qq)))) {
+              continue;
+            }
+            isRotated = true;
+            FloatType const tangent = privateCode::getJacobiTangent(
+              AA(pp, pp), AA(qq, qq), gamma);
+            FloatType const cosine =
+              FloatType(1.0) / std::sqrt(FloatType(1.0) + tangent * tangent);
+            FloatType const sine = tangent * cosine;
+
+            AA(pp, pp) -= tangent * gamma;
+            AA(qq, qq) += tangent * gamma;
+            AA(pp, qq) = FloatType(0.0);
+            AA(qq, pp) = FloatType(0.0);
+            for(size_t kk = 0; kk < Size; ++kk) {
+              if(kk == pp || kk == qq) {
+                continue;
+              }
+              FloatType gg = AA(kk, pp);
+              FloatType hh = AA(kk, qq);
+              AA(kk, pp) = cosine * gg - sine * hh;
+              AA(pp, kk) = AA(kk, pp);
+              AA(kk, qq) = sine * gg + cosine * hh;
+              AA(qq, kk) = AA(kk, qq);
+            }
+            privateCode::rotateVectors<FloatType, Size>(
+              vTranspose.rowBegin(pp), vTranspose.rowBegin(qq), cosine, sine);
+          }
+        }
+        if(!isRotated) {
+          break;
+        }
+      }
+
+      // Sort into descending order of eigenvalue.
+      size_t order[Size];
+      for(size_t ii = 0; ii < Size; ++ii) {
+        order[ii] = ii;
+      }
+      std::sort(order, order + Size,
+                [&AA](size_t aa, size_t bb) {return AA(aa, aa) > AA(bb, bb);});
+      for(size_t ii = 0; ii < Size; ++ii) {
+        eigenvalues[ii] = AA(order[ii], order[ii]);
+        FloatType const* vRow = vTranspose.rowBegin(order[ii]);
+        for(size_t jj = 0; jj < Size; ++jj) {
+          eigenvectors(jj, ii) = vRow[jj];
+        }
+      }
+    }
+
+
+    template <class FloatType>
+    void
+    eigenvectorsSymmetric(
+      brick::numeric::StaticArray2D<FloatType, 3, 3> const& inputArray,
+      brick::numeric::StaticArray1D<FloatType, 3>& eigenvalues,
+      brick::numeric::StaticArray2D<FloatType, 3, 3>& eigenvectors)
+    {
+      FloatType a00 = inputArray(0, 0);
+      FloatType a01 = inputArray(0, 1);
+      FloatType a02 = inputArray(0, 2);
+      FloatType a11 = inputArray(1, 1);
+      FloatType a12 = inputArray(1, 2);
+      FloatType a22 = inputArray(2, 2);
+
+      // Scale so the largest element has magnitude 1.  This guards
+      // against overflow when squaring and cubing below.
+      FloatType maxAbs = std::max(
+        std::max(std::max(std::fabs(a00), std::fabs(a01)),
+                 std::max(std::fabs(a02), std::fabs(a11))),
+        std::max(std::fabs(a12), std::fabs(a22)));
+      eigenvectors = static_cast<FloatType>(0.0);
+      if(maxAbs == FloatType(0.0)) {
+        eigenvalues = static_cast<FloatType>(0.0);
+        eigenvectors(0, 0) = eigenvectors(1, 1) = eigenvectors(2, 2) = 1.0;
+        return;
+      }
+      FloatType inverseMaxAbs = FloatType(1.0) / maxAbs;
+      a00 *= inverseMaxAbs;
+      a01 *= inverseMaxAbs;
+      a02 *= inverseMaxAbs;
+      a11 *= inverseMaxAbs;
+      a12 *= inverseMaxAbs;
+      a22 *= inverseMaxAbs;
+
+      FloatType offDiagonalSquared = a01 * a01 + a02 * a02 + a12 * a12;
+      FloatType values[3];
+      FloatType vectors[3][3];
+      if(offDiagonalSquared == FloatType(0.0)) {
+        // Already diagonal.
+        values[0] = a00;
+        values[1] = a11;
+        values[2] = a22;
+        for(size_t ii = 0; ii < 3; ++ii) {
+          for(size_t jj = 0; jj < 3; ++jj) {
+            vectors[ii][jj] = (ii == jj) ? FloatType(1.0) : FloatType(0.0);
+          }
+        }
+      } else {
+        // Write A = q*I + p*B, where trace(B) == 0 and the Frobenius
+        // norm of B is sqrt(6).  Then the eigenvalues of B are
+        // 2*cos(theta + 2*pi*k/3), where cos(3*theta) = det(B) / 2.
+        FloatType qq = (a00 + a11 + a22) / FloatType(3.0);
+        FloatType b00 = a00 - qq;
+        FloatType b11 = a11 - qq;
+        FloatType b22 = a22 - qq;
+        FloatType pp = std::sqrt(
+          (b00 * b00 + b11 * b11 + b22 * b22
+           + FloatType(2.0) * offDiagonalSquared) / FloatType(6.0));
+        FloatType c00 = b11 * b22 - a12 * a12;
+        FloatType c01 = a01 * b22 - a12 * a02;
+        FloatType c02 = a01 * a12 - b11 * a02;
+        FloatType halfDeterminant =
+          (b00 * c00 - a01 * c01 + a02 * c02) / (FloatType(2.0) * pp * pp * pp);
+        halfDeterminant = std::min(std::max(halfDeterminant, FloatType(-1.0)),
+                                   FloatType(1.0));
+        FloatType angle = std::acos(halfDeterminant) / FloatType(3.0);
+        FloatType const twoThirdsPi = FloatType(2.09439510239319549);
+        FloatType scaledA[9] = {a00, a01, a02, a01, a11, a12, a02, a12, a22};
+        FloatType shifted[9];
+
+        // The trigonometric solution is accurate for the eigenvalue
+        // that is best separated from the other two, but can lose
+        // half its digits on a nearly repeated pair.  So we use it
+        // only to find the well separated eigenvector (the largest
+        // eigenvalue if det(B) >= 0, otherwise the smallest), and
+        // recover the other two by diagonalizing in its orthogonal
+        // complement.
+        FloatType beta = (halfDeterminant >= FloatType(0.0))
+          ? FloatType(2.0) * std::cos(angle)
+          : FloatType(2.0) * std::cos(angle + twoThirdsPi);
+        std::copy(scaledA, scaledA + 9, shifted);
+        shifted[0] -= qq + pp * beta;
+        shifted[4] -= qq + pp * beta;
+        shifted[8] -= qq + pp * beta;
+        privateCode::getEigenvector3x3Rank2(shifted, vectors[0]);
+        FloatType Av[3];
+        for(size_t ii = 0; ii < 3; ++ii) {
+          Av[ii] = privateCode::staticDot<FloatType, 3>(
+            scaledA + 3 * ii, vectors[0]);
+        }
+        values[0] = privateCode::staticDot<FloatType, 3>(vectors[0], Av);
+        privateCode::getEigenvectors3x3Orthogonal(
+          scaledA, vectors[0], vectors[1], values[1], vectors[2], values[2]);
+      }
+
+      // Undo the scaling, sort into descending order, and make the
+      // basis right handed.
+      size_t order[3] = {0, 1, 2};
+      std::sort(order, order + 3,
+                [&values](size_t aa, size_t bb) {
+                  return values[aa] > values[bb];});
+      for(size_t ii = 0; ii < 3; ++ii) {
+        eigenvalues[ii] = values[order[ii]] * maxAbs;
+        for(size_t jj = 0; jj < 3; ++jj) {
+          eigenvectors(jj, ii) = vectors[order[ii]][jj];
+        }
+      }
+      FloatType handedness =
+        eigenvectors(0, 2) * (eigenvectors(1, 0) * eigenvectors(2, 1)
+                              - eigenvectors(2, 0) * eigenvectors(1, 1))
+        + eigenvectors(1, 2) * (eigenvectors(2, 0) * eigenvectors(0, 1)
+                                - eigenvectors(0, 0) * eigenvectors(2, 1))
+        + eigenvectors(2, 2) * (eigenvectors(0, 0) * eigenvectors(1, 1)
+                                - eigenvectors(1, 0) * eigenvectors(0, 1));
+      if(handedness < FloatType(0.0)) {
+        for(size_t jj = 0; jj < 3; ++jj) {
+          eigenvectors(jj, 2) = -eigenvectors(jj, 2);
+        }
+      }
+    }
+
+
+    template <class FloatType, size_t Size>
+    void
+    linearSolveInPlace(
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& AA,
+      brick::numeric::StaticArray1D<FloatType, Size>& bb)
+    {
+      // StaticArray1D and a single column StaticArray2D have the
+      // same layout, but we copy rather than alias to keep things
+      // simple.  The copy is negligible next to the factorization.
+      brick::numeric::StaticArray2D<FloatType, Size, 1> bColumn;
+      std::copy(bb.begin(), bb.end(), bColumn.begin());
+      linearSolveInPlace(AA, bColumn);
+      std::copy(bColumn.begin(), bColumn.end(), bb.begin());
+    }
+
+
+    template <class FloatType, size_t Size, size_t Columns>
+    void
+    linearSolveInPlace(
+      brick::numeric::StaticArray2D<FloatType, Size, Size>& AA,
+      brick::numeric::StaticArray2D<FloatType, Size, Columns>& bb)
+    {
+      if(!privateCode::householderReduce(AA, bb)) {
+        BRICK_THROW(brick::common::ValueException, "linearSolveInPlace()",
+                    "Matrix is singular.");
+      }
+      privateCode::backSubstitute(AA, bb);
+    }
+
+
+    template <class FloatType, size_t Rows, size_t Columns>
+    void
+    qrFactorization(
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns> const& inputArray,
+      brick::numeric::StaticArray2D<FloatType, Rows, Rows>& qArray,
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns>& rArray)
+    {
+      rArray = inputArray;
+      qArray = static_cast<FloatType>(0.0);
+      for(size_t ii = 0; ii < Rows; ++ii) {
+        qArray(ii, ii) = static_cast<FloatType>(1.0);
+      }
+
+      size_t const numberOfReflectors = std::min(Rows, Columns);
+      for(size_t kk = 0; kk < numberOfReflectors; ++kk) {
+        FloatType normSquared = FloatType(0.0);
+        for(size_t ii = kk; ii < Rows; ++ii) {
+          normSquared += rArray(ii, kk) * rArray(ii, kk);
+        }
+        FloatType belowSquared = normSquared - rArray(kk, kk) * rArray(kk, kk);
+        if(belowSquared == FloatType(0.0)) {
+          // Nothing to eliminate.
+          continue;
+        }
+        FloatType norm = std::sqrt(normSquared);
+        FloatType alpha = (rArray(kk, kk) > FloatType(0.0)) ? -norm : norm;
+        FloatType vv[Rows];
+        for(size_t ii = kk; ii < Rows; ++ii) {
+          vv[ii] = rArray(ii, kk);
+        }
+        vv[kk] -= alpha;
+        FloatType scale =
+          FloatType(2.0) / (belowSquared + vv[kk] * vv[kk]);
+
+        // R <- H * R.
+        for(size_t jj = kk; jj < Columns; ++jj) {
+          FloatType projection = FloatType(0.0);
+          for(size_t ii = kk; ii < Rows; ++ii) {
+            projection += vv[ii] * rArray(ii, jj);
+          }
+          projection *= scale;
+          for(size_t ii = kk; ii < Rows; ++ii) {
+            rArray(ii, jj) -= projection * vv[ii];
+          }
+        }
+        for(size_t ii = kk + 1; ii < Rows; ++ii) {
+          rArray(ii, kk) = FloatType(0.0);
+        }
+
+        // Q <- Q * H.
+        for(size_t rr = 0; rr < Rows; ++rr) {
+          FloatType* qRow = qArray.rowBegin(rr);
+          FloatType projection = FloatType(0.0);
+          for(size_t ii = kk; ii < Rows; ++ii) {
+            projection += qRow[ii] * vv[ii];
+          }
+          projection *= scale;
+          for(size_t ii = kk; ii < Rows; ++ii) {
+            qRow[ii] -= projection * vv[ii];
+          }
+        }
+      }
+
+      // Make the diagonal of R non-negative.
+      for(size_t kk = 0; kk < numberOfReflectors; ++kk) {
+        if(rArray(kk, kk) < FloatType(0.0)) {
+          FloatType* rRow = rArray.rowBegin(kk);
+          for(size_t jj = kk; jj < Columns; ++jj) {
+            rRow[jj] = -rRow[jj];
+          }
+          for(size_t rr = 0; rr < Rows; ++rr) {
+            qArray(rr, kk) = -qArray(rr, kk);
+          }
+        }
+      }
+    }
+
+
+    template <class FloatType, size_t Rows, size_t Columns>
+    void
+    singularValueDecomposition(
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns> const& inputArray,
+      brick::numeric::StaticArray2D<FloatType, Rows, Columns>& uArray,
+      brick::numeric::StaticArray1D<FloatType, Columns>& sigmaArray,
+      brick::numeric::StaticArray2D<FloatType, Columns, Columns>& vTransposeArray)
+    {
+      static_assert(Rows >= Columns,
+                    "singularValueDecomposition() requires Rows >= Columns.");
+
+      // We orthogonalize the columns of the input by plane rotations
+      // from the right.  Working on the transpose keeps each column
+      // contiguous in memory.  Similarly, we accumulate V^T directly.
+      brick::numeric::StaticArray2D<FloatType, Columns, Rows> work =
+        inputArray.transpose();
+      brick::numeric::StaticArray2D<FloatType, Columns, Columns> vTranspose(
+        static_cast<FloatType>(0.0));
+      for(size_t ii = 0; ii < Columns; ++ii) {
+        vTranspose(ii, ii) = static_cast<FloatType>(1.0);
+      }
+
+      FloatType const epsilon = std::numeric_limits<FloatType>::epsilon();
+      FloatType const tiny = std::numeric_limits<FloatType>::min();
+      for(size_t sweep = 0; sweep < privateCode::staticJacobiMaximumSweeps;
+          ++sweep) {
+        bool isRotated = false;
+        for(size_t pp = 0; pp + 1 < Columns; ++pp) {
+          for(size_t qq = pp + 1; qq < Columns; ++qq) {
+            FloatType* columnP = work.rowBegin(pp);
+            FloatType* columnQ = work.rowBegin(qq);
+            FloatType alpha =
+              privateCode::staticDot<FloatType, Rows>(columnP, columnP);
+            FloatType beta =
+              privateCode::staticDot<FloatType, Rows>(columnQ, columnQ);
+            FloatType gamma =
+              privateCode::staticDot<FloatType, Rows>(columnP, columnQ);
+            FloatType absGamma = std::fabs(gamma);
+            if(absGamma <= tiny
+               || absGamma <= epsilon * std::sqrt(alpha * beta)) {
+              continue;
+            }
+            isRotated = true;
+            FloatType const tangent =
+              privateCode::getJacobiTangent(alpha, beta, gamma);
+            FloatType const cosine =
+              FloatType(1.0) / std::sqrt(FloatType(1.0) + tangent * tangent);
+            FloatType const sine = tangent * cosine;
+            privateCode::rotateVectors<FloatType, Rows>(
+              columnP, columnQ, cosine, sine);
+            privateCode::rotateVectors<FloatType, Columns>(
+              vTranspose.rowBegin(pp), vTranspose.rowBegin(qq), cosine, sine);
+          }
+        }
+        if(!isRotated) {
+          break;
+        }
+      }
+
+      // The singular values are the lengths of the orthogonalized
+      // columns.  Sort them into descending order.
+      FloatType norms[Columns];
+      size_t order[Columns];
+      for(size_t ii = 0; ii < Columns; ++ii) {
+        FloatType const* column = work.rowBegin(ii);
+        norms[ii] = std::sqrt(
+          privateCode::staticDot<FloatType, Rows>(column, column));
+        order[ii] = ii;
+      }
+      std::sort(order, order + Columns,
+                [&norms](size_t aa, size_t bb) {return norms[aa] > norms[bb];});
+
+      // Normalize to get U.  Columns with zero singular value carry
+      // no information, so we complete the basis with whichever unit
+      // axis is least parallel to the columns we already have.
+      brick::numeric::StaticArray2D<FloatType, Columns, Rows> uTranspose;
+      for(size_t ii = 0; ii < Columns; ++ii) {
+        size_t const source = order[ii];
+        sigmaArray[ii] = norms[source];
+        std::copy(vTranspose.rowBegin(source),
+                  vTranspose.rowBegin(source) + Columns,
+                  vTransposeArray.rowBegin(ii));
+        FloatType* uColumn = uTranspose.rowBegin(ii);
+        if(norms[source] > tiny) {
+          FloatType const* column = work.rowBegin(source);
+          FloatType const scale = FloatType(1.0) / norms[source];
+          for(size_t jj = 0; jj < Rows; ++jj) {
+            uColumn[jj] = column[jj] * scale;
+          }
+          continue;
+        }
+        FloatType bestNormSquared = FloatType(-1.0);
+        FloatType candidate[Rows];
+        for(size_t axis = 0; axis < Rows; ++axis) {
+          std::fill(candidate, candidate + Rows, FloatType(0.0));
+          candidate[axis] = FloatType(1.0);
+          for(size_t pass = 0; pass < 2; ++pass) {
+            for(size_t kk = 0; kk < ii; ++kk) {
+              FloatType const* previous = uTranspose.rowBegin(kk);
+              FloatType projection =
+                privateCode::staticDot<FloatType, Rows>(candidate, previous);
+              for(size_t jj = 0; jj < Rows; ++jj) {
+                candidate[jj] -= projection * previous[jj];
+              }
+            }
+          }
+          FloatType normSquared =
+            privateCode::staticDot<FloatType, Rows>(candidate, candidate);
+          if(normSquared > bestNormSquared) {
+            bestNormSquared = normSquared;
+            FloatType const scale = FloatType(1.0) / std::sqrt(normSquared);
+            for(size_t jj = 0; jj < Rows; ++jj) {
+              uColumn[jj] = candidate[jj] * scale;
+            }
+          }
+        }
+      }
+      uArray = uTranspose.transpose();
+    }
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+#endif // #ifndef BRICK_LINEARALGEBRA_STATICLINEARALGEBRA_IMPL_HH
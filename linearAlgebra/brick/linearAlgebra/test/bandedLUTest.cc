@@ -0,0 +1,333 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/test/bandedLUTest.cc
+* Source file defining BandedLUTest class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <cmath>
+#include <brick/linearAlgebra/bandedLU.hh>
+#include <brick/linearAlgebra/linearAlgebra.hh>
+
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    class BandedLUTest
+      : public test::TestFixture<BandedLUTest> {
+
+    public:
+
+      BandedLUTest();
+      ~BandedLUTest() {}
+
+      void setUp(const std::string& /* testName */) {m_seed = 12345;}
+      void tearDown(const std::string& /* testName */) {}
+
+      void testCyclic();
+      void testExceptions();
+      void testLinearSolveBanded();
+      void testNonCyclic();
+      void testTridiagonal();
+
+    private:
+
+      // Deterministic pseudo-random numbers in [-1, 1).
+      double
+      getRandom();
+
+      // Random diagonally dominant matrix in band form.
+      numeric::Array2D<double>
+      getRandomBands(size_t size, size_t halfBandwidth);
+
+      // Expands band form to a dense matrix.
+      numeric::Array2D<double>
+      getDenseMatrix(numeric::Array2D<double> const& bands, bool isCyclic);
+
+      void
+      checkSolution(numeric::Array2D<double> const& bands, bool isCyclic);
+
+      unsigned int m_seed;
+      double m_defaultTolerance;
+
+    }; // class BandedLUTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    BandedLUTest::
+    BandedLUTest()
+      : brick::test::TestFixture<BandedLUTest>("BandedLUTest"),
+        m_seed(12345),
+        m_defaultTolerance(1.0E-10)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testCyclic);
+      BRICK_TEST_REGISTER_MEMBER(testExceptions);
+      BRICK_TEST_REGISTER_MEMBER(testLinearSolveBanded);
+      BRICK_TEST_REGISTER_MEMBER(testNonCyclic);
+      BRICK_TEST_REGISTER_MEMBER(testTridiagonal);
+    }
+
+
+    void
+    BandedLUTest::
+    testCyclic()
+    {
+      for(size_t halfBandwidth = 0; halfBandwidth < 4; ++halfBandwidth) {
+        // Smallest legal size, and a more typical one.
+        this->checkSolution(
+          this->getRandomBands(2 * halfBandwidth + 1, halfBandwidth), true);
+        this->checkSolution(this->getRandomBands(50, halfBandwidth), true);
+      }
+
+      // A closed-curve (snake) stiffness matrix is symmetric
+      // positive definite, but not diagonally dominant.
+      double const alpha = 0.1;
+      double const beta = 1.0;
+      double const gamma = 0.01;
+      numeric::Array2D<double> bands(40, 5);
+      for(size_t row = 0; row < bands.rows(); ++row) {
+        bands(row, 0) = 2.0 * beta;
+        bands(row, 1) = -2.0 * alpha - 8.0 * beta;
+        bands(row, 2) = 4.0 * alpha + 12.0 * beta + gamma;
+        bands(row, 3) = -2.0 * alpha - 8.0 * beta;
+        bands(row, 4) = 2.0 * beta;
+      }
+      this->checkSolution(bands, true);
+    }
+
+
+    void
+    BandedLUTest::
+    testExceptions()
+    {
+      BandedLU<double> factorization;
+      numeric::Array2D<double> evenBands(10, 4);
+      evenBands = 1.0;
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  factorization.factor(evenBands));
+
+      numeric::Array2D<double> smallBands = this->getRandomBands(4, 2);
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  factorization.factor(smallBands, true));
+      BandedLU<double> nonCyclic(smallBands);
+      BRICK_TEST_ASSERT(nonCyclic.getSize() == 4);
+      BRICK_TEST_ASSERT(nonCyclic.getHalfBandwidth() == 2);
+      BRICK_TEST_ASSERT(!nonCyclic.isCyclic());
+
+      numeric::Array2D<double> zeroPivot = this->getRandomBands(10, 1);
+      zeroPivot(0, 1) = 0.0;
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  factorization.factor(zeroPivot));
+
+      numeric::Array1D<double> wrongSize(9);
+      wrongSize = 0.0;
+      factorization.factor(this->getRandomBands(10, 1));
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  factorization.solve(wrongSize));
+    }
+
+
+    void
+    BandedLUTest::
+    testLinearSolveBanded()
+    {
+      for(int cyclic = 0; cyclic < 2; ++cyclic) {
+        numeric::Array2D<double> bands = this->getRandomBands(30, 2);
+        numeric::Array1D<double> bVector(30);
+        for(size_t ii = 0; ii < bVector.size(); ++ii) {
+          bVector[ii] = this->getRandom();
+        }
+        numeric::Array1D<double> xVector =
+          linearSolveBanded(bands, bVector, cyclic != 0);
+        numeric::Array1D<double> referenceX =
+          BandedLU<double>(bands, cyclic != 0).solve(bVector);
+        BRICK_TEST_ASSERT(xVector.size() == referenceX.size());
+        for(size_t ii = 0; ii < xVector.size(); ++ii) {
+          BRICK_TEST_ASSERT(xVector[ii] == referenceX[ii]);
+        }
+      }
+    }
+
+
+    void
+    BandedLUTest::
+    testNonCyclic()
+    {
+      for(size_t halfBandwidth = 0; halfBandwidth < 4; ++halfBandwidth) {
+        this->checkSolution(this->getRandomBands(1, halfBandwidth), false);
+        this->checkSolution(this->getRandomBands(3, halfBandwidth), false);
+        this->checkSolution(this->getRandomBands(50, halfBandwidth), false);
+      }
+
+      // Float32 should work too.
+      numeric::Array2D<double> bands = this->getRandomBands(20, 2);
+      numeric::Array2D<float> floatBands(bands.rows(), bands.columns());
+      for(size_t ii = 0; ii < bands.size(); ++ii) {
+        floatBands[ii] = static_cast<float>(bands[ii]);
+      }
+      numeric::Array1D<float> bVector(20);
+      bVector = 1.0f;
+      numeric::Array1D<float> xVector =
+        BandedLU<float>(floatBands).solve(bVector);
+      numeric::Array2D<double> AA = this->getDenseMatrix(bands, false);
+      for(size_t row = 0; row < AA.rows(); ++row) {
+        double sum = 0.0;
+        for(size_t column = 0; column < AA.columns(); ++column) {
+          sum += AA(row, column) * xVector[column];
+        }
+        BRICK_TEST_ASSERT(test::approximatelyEqual(sum, 1.0, 1.0E-5));
+      }
+    }
+
+
+    void
+    BandedLUTest::
+    testTridiagonal()
+    {
+      numeric::Array2D<double> bands = this->getRandomBands(25, 1);
+      numeric::Array1D<double> subDiagonal(24);
+      numeric::Array1D<double> centerDiagonal(25);
+      numeric::Array1D<double> superDiagonal(24);
+      numeric::Array1D<double> bVector(25);
+      for(size_t ii = 0; ii < 25; ++ii) {
+        centerDiagonal[ii] = bands(ii, 1);
+        if(ii != 0) {
+          subDiagonal[ii - 1] = bands(ii, 0);
+        }
+        if(ii != 24) {
+          superDiagonal[ii] = bands(ii, 2);
+        }
+        bVector[ii] = this->getRandom();
+      }
+      numeric::Array1D<double> referenceX = linearSolveTridiagonal(
+        subDiagonal, centerDiagonal, superDiagonal, bVector);
+      numeric::Array1D<double> xVector =
+        BandedLU<double>(bands).solve(bVector);
+      for(size_t ii = 0; ii < xVector.size(); ++ii) {
+        BRICK_TEST_ASSERT(
+          test::approximatelyEqual(xVector[ii], referenceX[ii],
+                                   m_defaultTolerance));
+      }
+    }
+
+
+    // ---- Private members below this line. ----
+
+    void
+    BandedLUTest::
+    checkSolution(numeric::Array2D<double> const& bands, bool isCyclic)
+    {
+      size_t const size = bands.rows();
+      numeric::Array2D<double> AA = this->getDenseMatrix(bands, isCyclic);
+      numeric::Array1D<double> xVector(size);
+      for(size_t ii = 0; ii < size; ++ii) {
+        xVector[ii] = this->getRandom();
+      }
+      numeric::Array1D<double> bVector(size);
+      for(size_t row = 0; row < size; ++row) {
+        bVector[row] = 0.0;
+        for(size_t column = 0; column < size; ++column) {
+          bVector[row] += AA(row, column) * xVector[column];
+        }
+      }
+
+      BandedLU<double> factorization(bands, isCyclic);
+      BRICK_TEST_ASSERT(factorization.getSize() == size);
+      BRICK_TEST_ASSERT(factorization.isCyclic() == isCyclic);
+      numeric::Array1D<double> result = factorization.solve(bVector);
+      BRICK_TEST_ASSERT(result.size() == size);
+      for(size_t ii = 0; ii < size; ++ii) {
+        BRICK_TEST_ASSERT(
+          test::approximatelyEqual(result[ii], xVector[ii],
+                                   m_defaultTolerance));
+      }
+
+      // Solving in place should give the same answer, and the
+      // factorization should be reusable.
+      factorization.solveInPlace(bVector);
+      for(size_t ii = 0; ii < size; ++ii) {
+        BRICK_TEST_ASSERT(bVector[ii] == result[ii]);
+      }
+    }
+
+
+    numeric::Array2D<double>
+    BandedLUTest::
+    getDenseMatrix(numeric::Array2D<double> const& bands, bool isCyclic)
+    {
+      size_t const size = bands.rows();
+      long const halfBandwidth = static_cast<long>(bands.columns() / 2);
+      numeric::Array2D<double> AA(size, size);
+      AA = 0.0;
+      for(size_t row = 0; row < size; ++row) {
+        for(size_t kk = 0; kk < bands.columns(); ++kk) {
+          long column = static_cast<long>(row + kk) - halfBandwidth;
+          long const longSize = static_cast<long>(size);
+          if(column < 0 || column >= longSize) {
+            if(!isCyclic) {
+              continue;
+            }
+            column = (column + longSize) % longSize;
+          }
+          AA(row, static_cast<size_t>(column)) = bands(row, kk);
+        }
+      }
+      return AA;
+    }
+
+
+    double
+    BandedLUTest::
+    getRandom()
+    {
+      m_seed = m_seed * 1103515245u + 12345u;
+      return static_cast<double>((m_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+    }
+
+
+    numeric::Array2D<double>
+    BandedLUTest::
+    getRandomBands(size_t size, size_t halfBandwidth)
+    {
+      numeric::Array2D<double> bands(size, 2 * halfBandwidth + 1);
+      for(size_t row = 0; row < size; ++row) {
+        for(size_t kk = 0; kk < bands.columns(); ++kk) {
+          bands(row, kk) = this->getRandom();
+        }
+        bands(row, halfBandwidth) += 2.0 * bands.columns();
+      }
+      return bands;
+    }
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+
+#if 0
+
+int main(int /* argc */, char** /* argv */)
+{
+  brick::linearAlgebra::BandedLUTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::linearAlgebra::BandedLUTest currentTest;
+
+}
+
+#endif
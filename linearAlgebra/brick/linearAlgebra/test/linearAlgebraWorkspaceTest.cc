@@ -0,0 +1,687 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/test/linearAlgebraWorkspaceTest.cc
+* Source file defining LinearAlgebraWorkspaceTest class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <cmath>
+#include <vector>
+#include <brick/linearAlgebra/linearAlgebra.hh>
+#include <brick/linearAlgebra/linearAlgebraWorkspace.hh>
+#include <brick/numeric/utilities.hh>
+
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    class LinearAlgebraWorkspaceTest
+      : public test::TestFixture<LinearAlgebraWorkspaceTest> {
+
+    public:
+
+      LinearAlgebraWorkspaceTest();
+      ~LinearAlgebraWorkspaceTest() {}
+
+      void setUp(const std::string& /* testName */) {m_seed = 12345;}
+      void tearDown(const std::string& /* testName */) {}
+
+      void testBatch();
+      void testEigenvectorsSymmetric();
+      void testInverse();
+      void testLinearLeastSquares();
+      void testQrFactorization();
+      void testSharedOutputs();
+      void testSingularValueDecomposition();
+      void testWorkspaceReuse();
+
+    private:
+
+      bool
+      approximatelyEqual(numeric::Array1D<double> const& array0,
+                         numeric::Array1D<double> const& array1);
+
+      bool
+      approximatelyEqual(numeric::Array2D<double> const& array0,
+                         numeric::Array2D<double> const& array1);
+
+      // Deterministic pseudo-random numbers in [-1, 1).
+      double
+      getRandom();
+
+      numeric::Array2D<double>
+      getRandomMatrix(size_t rows, size_t columns);
+
+      unsigned int m_seed;
+      double m_defaultTolerance;
+
+    }; // class LinearAlgebraWorkspaceTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    LinearAlgebraWorkspaceTest::
+    LinearAlgebraWorkspaceTest()
+      : brick::test::TestFixture<LinearAlgebraWorkspaceTest>(
+          "LinearAlgebraWorkspaceTest"),
+        m_seed(12345),
+        m_defaultTolerance(1.0E-10)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testBatch);
+      BRICK_TEST_REGISTER_MEMBER(testEigenvectorsSymmetric);
+      BRICK_TEST_REGISTER_MEMBER(testInverse);
+      BRICK_TEST_REGISTER_MEMBER(testLinearLeastSquares);
+      BRICK_TEST_REGISTER_MEMBER(testQrFactorization);
+      BRICK_TEST_REGISTER_MEMBER(testSharedOutputs);
+      BRICK_TEST_REGISTER_MEMBER(testSingularValueDecomposition);
+      BRICK_TEST_REGISTER_MEMBER(testWorkspaceReuse);
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testBatch()
+    {
+      size_t const batchSize = 37;
+      std::vector< numeric::Array2D<double> > matrices;
+      std::vector< numeric::Array2D<double> > symmetricMatrices;
+      std::vector< numeric::Array1D<double> > bVectors;
+      for(size_t ii = 0; ii < batchSize; ++ii) {
+        numeric::Array2D<double> matrix = this->getRandomMatrix(4, 4);
+        matrices.push_back(matrix);
+        symmetricMatrices.push_back(matrix + matrix.transpose());
+        numeric::Array1D<double> bVector(4);
+        for(size_t jj = 0; jj < bVector.size(); ++jj) {
+          bVector[jj] = this->getRandom();
+        }
+        bVectors.push_back(bVector);
+      }
+
+      // Every thread count, including "use the default," must give
+      // the same answers as one call per matrix.
+      size_t threadCounts[] = {1, 3, 0};
+      for(size_t tt = 0; tt < 3; ++tt) {
+        std::vector< numeric::Array1D<double> > eigenvalues;
+        std::vector< numeric::Array2D<double> > eigenvectors;
+        eigenvectorsSymmetricBatch(symmetricMatrices, eigenvalues,
+                                   eigenvectors, threadCounts[tt]);
+        std::vector< numeric::Array2D<double> > inverses;
+        inverseBatch(matrices, inverses, threadCounts[tt]);
+        std::vector< numeric::Array1D<double> > xVectors;
+        linearLeastSquaresBatch(matrices, bVectors, xVectors,
+                                threadCounts[tt]);
+        std::vector< numeric::Array2D<double> > qArrays;
+        std::vector< numeric::Array2D<double> > rArrays;
+        qrFactorizationBatch(matrices, qArrays, rArrays, threadCounts[tt]);
+        std::vector< numeric::Array2D<double> > uArrays;
+        std::vector< numeric::Array1D<double> > sigmaArrays;
+        std::vector< numeric::Array2D<double> > vTransposeArrays;
+        singularValueDecompositionBatch(matrices, uArrays, sigmaArrays,
+                                        vTransposeArrays, false,
+                                        threadCounts[tt]);
+
+        BRICK_TEST_ASSERT(eigenvalues.size() == batchSize);
+        BRICK_TEST_ASSERT(inverses.size() == batchSize);
+        BRICK_TEST_ASSERT(xVectors.size() == batchSize);
+        BRICK_TEST_ASSERT(qArrays.size() == batchSize);
+        BRICK_TEST_ASSERT(sigmaArrays.size() == batchSize);
+
+        LinearAlgebraWorkspace workspace;
+        for(size_t ii = 0; ii < batchSize; ++ii) {
+          numeric::Array1D<double> referenceValues;
+          numeric::Array2D<double> referenceVectors;
+          eigenvectorsSymmetric(symmetricMatrices[ii], referenceValues,
+                                referenceVectors, workspace);
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(eigenvalues[ii], referenceValues));
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(eigenvectors[ii], referenceVectors));
+
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(inverses[ii], inverse(matrices[ii])));
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(
+              xVectors[ii], linearLeastSquares(matrices[ii], bVectors[ii])));
+
+          numeric::Array2D<double> referenceQ;
+          numeric::Array2D<double> referenceR;
+          qrFactorization(matrices[ii], referenceQ, referenceR, workspace);
+          BRICK_TEST_ASSERT(this->approximatelyEqual(qArrays[ii], referenceQ));
+          BRICK_TEST_ASSERT(this->approximatelyEqual(rArrays[ii], referenceR));
+
+          numeric::Array2D<double> referenceU;
+          numeric::Array1D<double> referenceSigma;
+          numeric::Array2D<double> referenceVT;
+          singularValueDecomposition(matrices[ii], referenceU, referenceSigma,
+                                     referenceVT, workspace);
+          BRICK_TEST_ASSERT(this->approximatelyEqual(uArrays[ii], referenceU));
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(sigmaArrays[ii], referenceSigma));
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(vTransposeArrays[ii], referenceVT));
+        }
+      }
+
+      // Mismatched batches are an error, and empty batches are not.
+      std::vector< numeric::Array1D<double> > xVectors;
+      bVectors.pop_back();
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        linearLeastSquaresBatch(matrices, bVectors, xVectors));
+      std::vector< numeric::Array2D<double> > emptyBatch;
+      std::vector< numeric::Array2D<double> > inverses(3);
+      inverseBatch(emptyBatch, inverses);
+      BRICK_TEST_ASSERT(inverses.empty());
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testEigenvectorsSymmetric()
+    {
+      LinearAlgebraWorkspace workspace;
+      size_t sizes[] = {1, 5, 3, 5};
+      for(size_t ss = 0; ss < 4; ++ss) {
+        numeric::Array2D<double> matrix =
+          this->getRandomMatrix(sizes[ss], sizes[ss]);
+        matrix += matrix.transpose();
+
+        numeric::Array1D<double> eigenvalues;
+        numeric::Array2D<double> eigenvectors;
+        eigenvectorsSymmetric(matrix, eigenvalues, eigenvectors, workspace);
+
+        numeric::Array1D<double> referenceValues;
+        numeric::Array2D<double> referenceVectors;
+        eigenvectorsSymmetric(matrix, referenceValues, referenceVectors);
+
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(eigenvalues, referenceValues));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(eigenvectors, referenceVectors));
+
+        // A * V == V * diag(eigenvalues).
+        numeric::Array2D<double> product =
+          numeric::matrixMultiply<double>(matrix, eigenvectors);
+        for(size_t column = 0; column < eigenvalues.size(); ++column) {
+          for(size_t row = 0; row < eigenvalues.size(); ++row) {
+            BRICK_TEST_ASSERT(
+              test::approximatelyEqual(
+                product(row, column),
+                eigenvectors(row, column) * eigenvalues[column],
+                m_defaultTolerance));
+          }
+        }
+      }
+
+      numeric::Array2D<double> notSquare(2, 3);
+      numeric::Array1D<double> eigenvalues;
+      numeric::Array2D<double> eigenvectors;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        eigenvectorsSymmetric(notSquare, eigenvalues, eigenvectors,
+                              workspace));
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testInverse()
+    {
+      LinearAlgebraWorkspace workspace;
+      size_t sizes[] = {1, 6, 2, 6};
+      for(size_t ss = 0; ss < 4; ++ss) {
+        numeric::Array2D<double> matrix =
+          this->getRandomMatrix(sizes[ss], sizes[ss]);
+        numeric::Array2D<double> matrixCopy = matrix.copy();
+        numeric::Array2D<double> matrixInverse;
+        inverse(matrix, matrixInverse, workspace);
+
+        BRICK_TEST_ASSERT(this->approximatelyEqual(matrix, matrixCopy));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(matrixInverse, inverse(matrix)));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(
+            numeric::matrixMultiply<double>(matrix, matrixInverse),
+            numeric::identity<double>(sizes[ss], sizes[ss])));
+
+        // Inverting in place should work, too.
+        inverse(matrixCopy, matrixCopy, workspace);
+        BRICK_TEST_ASSERT(this->approximatelyEqual(matrixCopy, matrixInverse));
+      }
+
+      numeric::Array2D<double> singular(3, 3);
+      singular = 1.0;
+      numeric::Array2D<double> singularInverse;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException, inverse(singular, singularInverse, workspace));
+      numeric::Array2D<double> notSquare(2, 3);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        inverse(notSquare, singularInverse, workspace));
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testLinearLeastSquares()
+    {
+      // Overconstrained, square, and underconstrained.
+      LinearAlgebraWorkspace workspace;
+      size_t shapes[][2] = {{8, 3}, {4, 4}, {3, 6}, {8, 3}};
+      for(size_t ss = 0; ss < 4; ++ss) {
+        numeric::Array2D<double> AA =
+          this->getRandomMatrix(shapes[ss][0], shapes[ss][1]);
+        numeric::Array1D<double> bb(shapes[ss][0]);
+        for(size_t ii = 0; ii < bb.size(); ++ii) {
+          bb[ii] = this->getRandom();
+        }
+        numeric::Array2D<double> AACopy = AA.copy();
+        numeric::Array1D<double> bbCopy = bb.copy();
+
+        numeric::Array1D<double> xx;
+        linearLeastSquares(AA, bb, xx, workspace);
+        BRICK_TEST_ASSERT(xx.size() == shapes[ss][1]);
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(xx, linearLeastSquares(AA, bb)));
+        BRICK_TEST_ASSERT(this->approximatelyEqual(AA, AACopy));
+        BRICK_TEST_ASSERT(this->approximatelyEqual(bb, bbCopy));
+      }
+
+      numeric::Array2D<double> AA(3, 2);
+      numeric::Array1D<double> bb(2);
+      numeric::Array1D<double> xx;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException, linearLeastSquares(AA, bb, xx, workspace));
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testQrFactorization()
+    {
+      LinearAlgebraWorkspace workspace;
+      size_t shapes[][2] = {{5, 3}, {3, 5}, {4, 4}, {1, 1}, {5, 3}};
+      for(size_t ss = 0; ss < 5; ++ss) {
+        size_t rows = shapes[ss][0];
+        size_t columns = shapes[ss][1];
+        numeric::Array2D<double> matrix = this->getRandomMatrix(rows, columns);
+        numeric::Array2D<double> qArray;
+        numeric::Array2D<double> rArray;
+        qrFactorization(matrix, qArray, rArray, workspace);
+
+        BRICK_TEST_ASSERT(qArray.rows() == rows);
+        BRICK_TEST_ASSERT(qArray.columns() == rows);
+        BRICK_TEST_ASSERT(rArray.rows() == rows);
+        BRICK_TEST_ASSERT(rArray.columns() == columns);
+
+        // Q is orthogonal, R is upper trapezoidal with non-negative
+        // diagonal, and Q * R == A.
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(
+            numeric::matrixMultiply<double>(qArray.transpose(), qArray),
+            numeric::identity<double>(rows, rows)));
+        for(size_t row = 0; row < rows; ++row) {
+          for(size_t column = 0; column < columns; ++column) {
+            if(column < row) {
+              BRICK_TEST_ASSERT(rArray(row, column) == 0.0);
+            } else if(column == row) {
+              BRICK_TEST_ASSERT(rArray(row, column) >= 0.0);
+            }
+          }
+        }
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(
+            numeric::matrixMultiply<double>(qArray, rArray), matrix));
+
+        // The first min(rows, columns) columns of Q are unique, so
+        // they should agree with the original implementation.
+        numeric::Array2D<double> referenceQ;
+        numeric::Array2D<double> referenceR;
+        qrFactorization(matrix, referenceQ, referenceR);
+        BRICK_TEST_ASSERT(this->approximatelyEqual(rArray, referenceR));
+        for(size_t row = 0; row < rows; ++row) {
+          for(size_t column = 0; column < std::min(rows, columns);
+              ++column) {
+            BRICK_TEST_ASSERT(
+              test::approximatelyEqual(qArray(row, column),
+                                       referenceQ(row, column),
+                                       m_defaultTolerance));
+          }
+        }
+      }
+
+      numeric::Array2D<double> emptyMatrix;
+      numeric::Array2D<double> qArray(2, 2);
+      numeric::Array2D<double> rArray(2, 2);
+      qrFactorization(emptyMatrix, qArray, rArray, workspace);
+      BRICK_TEST_ASSERT(qArray.size() == 0);
+      BRICK_TEST_ASSERT(rArray.size() == 0);
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testSharedOutputs()
+    {
+      size_t const batchSize = 37;
+      std::vector< numeric::Array2D<double> > matrices;
+      std::vector< numeric::Array2D<double> > symmetricMatrices;
+      std::vector< numeric::Array1D<double> > bVectors;
+      for(size_t ii = 0; ii < batchSize; ++ii) {
+        numeric::Array2D<double> matrix = this->getRandomMatrix(4, 4);
+        matrices.push_back(matrix);
+        symmetricMatrices.push_back(matrix + matrix.transpose());
+        numeric::Array1D<double> bVector(4);
+        for(size_t jj = 0; jj < bVector.size(); ++jj) {
+          bVector[jj] = this->getRandom();
+        }
+        bVectors.push_back(bVector);
+      }
+
+      // The std::vector fill constructor makes every element a
+      // shallow copy of the same array, and sharedMatrix and
+      // sharedVector are one more copy each.  Every element already
+      // has the right size, but the batch functions must not write
+      // the results on top of each other, or into sharedMatrix and
+      // sharedVector.
+      numeric::Array2D<double> sharedMatrix(4, 4);
+      numeric::Array1D<double> sharedVector(4);
+      sharedMatrix = 7.0;
+      sharedVector = 7.0;
+      std::vector< numeric::Array1D<double> > eigenvalues(
+        batchSize, sharedVector);
+      std::vector< numeric::Array2D<double> > eigenvectors(
+        batchSize, sharedMatrix);
+      std::vector< numeric::Array2D<double> > inverses(
+        batchSize, sharedMatrix);
+      std::vector< numeric::Array1D<double> > xVectors(
+        batchSize, sharedVector);
+      std::vector< numeric::Array2D<double> > qArrays(
+        batchSize, sharedMatrix);
+      std::vector< numeric::Array2D<double> > rArrays(
+        batchSize, sharedMatrix);
+      std::vector< numeric::Array2D<double> > uArrays(
+        batchSize, sharedMatrix);
+      std::vector< numeric::Array1D<double> > sigmaArrays(
+        batchSize, sharedVector);
+      std::vector< numeric::Array2D<double> > vTransposeArrays(
+        batchSize, sharedMatrix);
+
+      eigenvectorsSymmetricBatch(symmetricMatrices, eigenvalues,
+                                 eigenvectors, 3);
+      inverseBatch(matrices, inverses, 3);
+      linearLeastSquaresBatch(matrices, bVectors, xVectors, 3);
+      qrFactorizationBatch(matrices, qArrays, rArrays, 3);
+      singularValueDecompositionBatch(matrices, uArrays, sigmaArrays,
+                                      vTransposeArrays, false, 3);
+
+      for(size_t ii = 0; ii < sharedMatrix.size(); ++ii) {
+        BRICK_TEST_ASSERT(sharedMatrix[ii] == 7.0);
+      }
+      for(size_t ii = 0; ii < sharedVector.size(); ++ii) {
+        BRICK_TEST_ASSERT(sharedVector[ii] == 7.0);
+      }
+
+      for(size_t ii = 0; ii < batchSize; ++ii) {
+        numeric::Array1D<double> referenceValues;
+        numeric::Array2D<double> referenceVectors;
+        eigenvectorsSymmetric(symmetricMatrices[ii], referenceValues,
+                              referenceVectors);
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(eigenvalues[ii], referenceValues));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(eigenvectors[ii], referenceVectors));
+
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(inverses[ii], inverse(matrices[ii])));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(
+            xVectors[ii], linearLeastSquares(matrices[ii], bVectors[ii])));
+
+        numeric::Array2D<double> referenceQ;
+        numeric::Array2D<double> referenceR;
+        qrFactorization(matrices[ii], referenceQ, referenceR);
+        BRICK_TEST_ASSERT(this->approximatelyEqual(qArrays[ii], referenceQ));
+        BRICK_TEST_ASSERT(this->approximatelyEqual(rArrays[ii], referenceR));
+
+        numeric::Array2D<double> referenceU;
+        numeric::Array1D<double> referenceSigma;
+        numeric::Array2D<double> referenceVT;
+        singularValueDecomposition(matrices[ii], referenceU, referenceSigma,
+                                   referenceVT);
+        BRICK_TEST_ASSERT(this->approximatelyEqual(uArrays[ii], referenceU));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(sigmaArrays[ii], referenceSigma));
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(vTransposeArrays[ii], referenceVT));
+      }
+
+      // The single-call overloads follow the same rule.  Here the
+      // output starts out as a second handle to the input, which
+      // must not be overwritten.
+      LinearAlgebraWorkspace workspace;
+      numeric::Array2D<double> matrix = this->getRandomMatrix(5, 5);
+      numeric::Array2D<double> matrixCopy = matrix.copy();
+      numeric::Array2D<double> matrixInverse = matrix;
+      inverse(matrix, matrixInverse, workspace);
+      BRICK_TEST_ASSERT(matrixInverse.data() != matrix.data());
+      BRICK_TEST_ASSERT(this->approximatelyEqual(matrix, matrixCopy));
+      BRICK_TEST_ASSERT(
+        this->approximatelyEqual(matrixInverse, inverse(matrixCopy)));
+
+      // Inverting a shared array "in place" gives that array fresh
+      // memory, and leaves the other handle alone.
+      numeric::Array2D<double> alias = matrix;
+      inverse(matrix, matrix, workspace);
+      BRICK_TEST_ASSERT(matrix.data() != alias.data());
+      BRICK_TEST_ASSERT(this->approximatelyEqual(alias, matrixCopy));
+      BRICK_TEST_ASSERT(this->approximatelyEqual(matrix, matrixInverse));
+
+      numeric::Array2D<double> uArray = alias;
+      numeric::Array1D<double> sigmaArray;
+      numeric::Array2D<double> vTransposeArray = alias;
+      singularValueDecomposition(alias, uArray, sigmaArray, vTransposeArray,
+                                 workspace);
+      BRICK_TEST_ASSERT(this->approximatelyEqual(alias, matrixCopy));
+      numeric::Array2D<double> qArray = alias;
+      numeric::Array2D<double> rArray = alias;
+      qrFactorization(alias, qArray, rArray, workspace);
+      BRICK_TEST_ASSERT(this->approximatelyEqual(alias, matrixCopy));
+      BRICK_TEST_ASSERT(
+        this->approximatelyEqual(
+          numeric::matrixMultiply<double>(qArray, rArray), matrixCopy));
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testSingularValueDecomposition()
+    {
+      LinearAlgebraWorkspace workspace;
+      size_t shapes[][2] = {{6, 4}, {4, 6}, {5, 5}, {6, 4}};
+      for(size_t ss = 0; ss < 4; ++ss) {
+        size_t rows = shapes[ss][0];
+        size_t columns = shapes[ss][1];
+        size_t rank = std::min(rows, columns);
+        numeric::Array2D<double> matrix = this->getRandomMatrix(rows, columns);
+        numeric::Array2D<double> matrixCopy = matrix.copy();
+
+        for(size_t nn = 0; nn < 2; ++nn) {
+          bool isNullSpaceRequired = (nn != 0);
+          numeric::Array2D<double> uArray;
+          numeric::Array1D<double> sigmaArray;
+          numeric::Array2D<double> vTransposeArray;
+          singularValueDecomposition(matrix, uArray, sigmaArray,
+                                     vTransposeArray, workspace,
+                                     isNullSpaceRequired);
+
+          size_t uColumns = isNullSpaceRequired ? rows : rank;
+          size_t vRows = isNullSpaceRequired ? columns : rank;
+          BRICK_TEST_ASSERT(uArray.rows() == rows);
+          BRICK_TEST_ASSERT(uArray.columns() == uColumns);
+          BRICK_TEST_ASSERT(sigmaArray.size() == rank);
+          BRICK_TEST_ASSERT(vTransposeArray.rows() == vRows);
+          BRICK_TEST_ASSERT(vTransposeArray.columns() == columns);
+          BRICK_TEST_ASSERT(this->approximatelyEqual(matrix, matrixCopy));
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(sigmaArray, singularValues(matrix)));
+
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(
+              numeric::matrixMultiply<double>(uArray.transpose(), uArray),
+              numeric::identity<double>(uColumns, uColumns)));
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(
+              numeric::matrixMultiply<double>(
+                vTransposeArray, vTransposeArray.transpose()),
+              numeric::identity<double>(vRows, vRows)));
+
+          numeric::Array2D<double> sigmaMatrix(uColumns, vRows);
+          sigmaMatrix = 0.0;
+          for(size_t ii = 0; ii < rank; ++ii) {
+            sigmaMatrix(ii, ii) = sigmaArray[ii];
+          }
+          BRICK_TEST_ASSERT(
+            this->approximatelyEqual(
+              numeric::matrixMultiply<double>(
+                numeric::matrixMultiply<double>(uArray, sigmaMatrix),
+                vTransposeArray),
+              matrix));
+        }
+      }
+    }
+
+
+    void
+    LinearAlgebraWorkspaceTest::
+    testWorkspaceReuse()
+    {
+      LinearAlgebraWorkspace workspace;
+      BRICK_TEST_ASSERT(workspace.getNumberOfBytes() == 0);
+      BRICK_TEST_ASSERT(workspace.getWorkSize(7, 3, 4) == -1);
+      workspace.setWorkSize(7, 3, 4, 100);
+      workspace.setWorkSize(7, 4, 3, 200);
+      BRICK_TEST_ASSERT(workspace.getWorkSize(7, 3, 4) == 100);
+      BRICK_TEST_ASSERT(workspace.getWorkSize(7, 4, 3) == 200);
+      workspace.setWorkSize(7, 3, 4, 150);
+      BRICK_TEST_ASSERT(workspace.getWorkSize(7, 3, 4) == 150);
+
+      // Buffers only grow.
+      double* buffer0 = workspace.getFloatBuffer(2, 10);
+      BRICK_TEST_ASSERT(workspace.getFloatBuffer(2, 5) == buffer0);
+      BRICK_TEST_ASSERT(workspace.getFloatBuffer(0, 10) != buffer0);
+
+      // Once warmed up, repeated same-sized calls shouldn't grow the
+      // workspace, or reallocate the outputs.
+      numeric::Array2D<double> matrix = this->getRandomMatrix(7, 5);
+      numeric::Array2D<double> uArray;
+      numeric::Array1D<double> sigmaArray;
+      numeric::Array2D<double> vTransposeArray;
+      singularValueDecomposition(matrix, uArray, sigmaArray,
+                                 vTransposeArray, workspace);
+      size_t numberOfBytes = workspace.getNumberOfBytes();
+      double* uData = uArray.data();
+      for(size_t ii = 0; ii < 5; ++ii) {
+        matrix = this->getRandomMatrix(7, 5);
+        singularValueDecomposition(matrix, uArray, sigmaArray,
+                                   vTransposeArray, workspace);
+        BRICK_TEST_ASSERT(workspace.getNumberOfBytes() == numberOfBytes);
+        BRICK_TEST_ASSERT(uArray.data() == uData);
+        BRICK_TEST_ASSERT(
+          this->approximatelyEqual(sigmaArray, singularValues(matrix)));
+      }
+
+      workspace.clear();
+      BRICK_TEST_ASSERT(workspace.getNumberOfBytes() == 0);
+      BRICK_TEST_ASSERT(workspace.getWorkSize(7, 3, 4) == -1);
+    }
+
+
+    bool
+    LinearAlgebraWorkspaceTest::
+    approximatelyEqual(numeric::Array1D<double> const& array0,
+                       numeric::Array1D<double> const& array1)
+    {
+      if(array0.size() != array1.size()) {
+        return false;
+      }
+      for(size_t ii = 0; ii < array0.size(); ++ii) {
+        if(!test::approximatelyEqual(array0[ii], array1[ii],
+                                     m_defaultTolerance)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    bool
+    LinearAlgebraWorkspaceTest::
+    approximatelyEqual(numeric::Array2D<double> const& array0,
+                       numeric::Array2D<double> const& array1)
+    {
+      if(array0.rows() != array1.rows()
+         || array0.columns() != array1.columns()) {
+        return false;
+      }
+      for(size_t ii = 0; ii < array0.size(); ++ii) {
+        if(!test::approximatelyEqual(array0[ii], array1[ii],
+                                     m_defaultTolerance)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    double
+    LinearAlgebraWorkspaceTest::
+    getRandom()
+    {
+      m_seed = m_seed * 1103515245u + 12345u;
+      return static_cast<double>((m_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+    }
+
+
+    numeric::Array2D<double>
+    LinearAlgebraWorkspaceTest::
+    getRandomMatrix(size_t rows, size_t columns)
+    {
+      numeric::Array2D<double> matrix(rows, columns);
+      for(size_t ii = 0; ii < matrix.size(); ++ii) {
+        matrix[ii] = this->getRandom();
+      }
+      return matrix;
+    }
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+
+#if 0
+
+int main(int /* argc */, char** /* argv */)
+{
+  brick::linearAlgebra::LinearAlgebraWorkspaceTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::linearAlgebra::LinearAlgebraWorkspaceTest currentTest;
+
+}
+
+#endif
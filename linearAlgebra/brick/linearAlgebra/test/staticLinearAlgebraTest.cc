@@ -0,0 +1,426 @@
+/**
+***************************************************************************
+* @file brick/linearAlgebra/test/staticLinearAlgebraTest.cc
+* Source file defining StaticLinearAlgebraTest class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <cmath>
+#include <brick/linearAlgebra/linearAlgebra.hh>
+#include <brick/linearAlgebra/staticLinearAlgebra.hh>
+
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace linearAlgebra {
+
+    class StaticLinearAlgebraTest
+      : public test::TestFixture<StaticLinearAlgebraTest> {
+
+    public:
+
+      StaticLinearAlgebraTest();
+      ~StaticLinearAlgebraTest() {}
+
+      void setUp(const std::string& /* testName */) {m_seed = 12345;}
+      void tearDown(const std::string& /* testName */) {}
+
+      void testEigenvectorsSymmetric3x3();
+      void testEigenvectorsSymmetricJacobi();
+      void testLinearSolveInPlace();
+      void testQrFactorization();
+      void testSingularValueDecomposition();
+
+    private:
+
+      // Deterministic pseudo-random numbers in [-1, 1).
+      double
+      getRandom();
+
+      template <size_t Rows, size_t Columns>
+      void
+      fillRandom(numeric::StaticArray2D<double, Rows, Columns>& array0);
+
+      template <size_t Size>
+      numeric::StaticArray2D<double, Size, Size>
+      makeSymmetric(numeric::StaticArray2D<double, Size, Size> const& array0);
+
+      template <size_t Size>
+      void
+      checkEigenDecomposition(
+        numeric::StaticArray2D<double, Size, Size> const& inputArray,
+        numeric::StaticArray1D<double, Size> const& eigenvalues,
+        numeric::StaticArray2D<double, Size, Size> const& eigenvectors);
+
+      template <size_t Rows, size_t Columns>
+      bool
+      isOrthonormalColumns(
+        numeric::StaticArray2D<double, Rows, Columns> const& array0);
+
+      unsigned int m_seed;
+      double m_defaultTolerance;
+
+    }; // class StaticLinearAlgebraTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    StaticLinearAlgebraTest::
+    StaticLinearAlgebraTest()
+      : brick::test::TestFixture<StaticLinearAlgebraTest>(
+          "StaticLinearAlgebraTest"),
+        m_seed(12345),
+        m_defaultTolerance(1.0E-10)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testEigenvectorsSymmetric3x3);
+      BRICK_TEST_REGISTER_MEMBER(testEigenvectorsSymmetricJacobi);
+      BRICK_TEST_REGISTER_MEMBER(testLinearSolveInPlace);
+      BRICK_TEST_REGISTER_MEMBER(testQrFactorization);
+      BRICK_TEST_REGISTER_MEMBER(testSingularValueDecomposition);
+    }
+
+
+    void
+    StaticLinearAlgebraTest::
+    testEigenvectorsSymmetric3x3()
+    {
+      // Random matrices.
+      for(size_t trial = 0; trial < 100; ++trial) {
+        numeric::StaticArray2D<double, 3, 3> inputArray;
+        this->fillRandom(inputArray);
+        inputArray = this->makeSymmetric(inputArray);
+        numeric::StaticArray1D<double, 3> eigenvalues;
+        numeric::StaticArray2D<double, 3, 3> eigenvectors;
+        eigenvectorsSymmetric(inputArray, eigenvalues, eigenvectors);
+        this->checkEigenDecomposition(inputArray, eigenvalues, eigenvectors);
+      }
+
+      // Repeated eigenvalues, diagonal input, and zero input are the
+      // tricky cases for closed form solvers.
+      numeric::StaticArray2D<double, 3, 3> rotation;
+      this->fillRandom(rotation);
+      numeric::StaticArray2D<double, 3, 3> qArray;
+      numeric::StaticArray2D<double, 3, 3> rArray;
+      qrFactorization(rotation, qArray, rArray);
+      double diagonals[][3] = {{2.0, 2.0, -1.0}, {-1.0, 3.0, 3.0},
+                               {5.0, 5.0, 5.0}, {0.0, 0.0, 0.0},
+                               {1.0E6, 1.0, 1.0E-6}};
+      for(size_t trial = 0; trial < 5; ++trial) {
+        numeric::StaticArray2D<double, 3, 3> lambda(0.0);
+        for(size_t ii = 0; ii < 3; ++ii) {
+          lambda(ii, ii) = diagonals[trial][ii];
+        }
+        for(size_t rotate = 0; rotate < 2; ++rotate) {
+          numeric::StaticArray2D<double, 3, 3> inputArray = lambda;
+          if(rotate) {
+            inputArray = numeric::matrixMultiply(
+              numeric::matrixMultiply(qArray, lambda), qArray.transpose());
+            inputArray = this->makeSymmetric(inputArray);
+          }
+          numeric::StaticArray1D<double, 3> eigenvalues;
+          numeric::StaticArray2D<double, 3, 3> eigenvectors;
+          eigenvectorsSymmetric(inputArray, eigenvalues, eigenvectors);
+          this->checkEigenDecomposition(inputArray, eigenvalues, eigenvectors);
+        }
+      }
+    }
+
+
+    void
+    StaticLinearAlgebraTest::
+    testEigenvectorsSymmetricJacobi()
+    {
+      for(size_t trial = 0; trial < 20; ++trial) {
+        numeric::StaticArray2D<double, 9, 9> inputArray;
+        this->fillRandom(inputArray);
+        inputArray = this->makeSymmetric(inputArray);
+        numeric::StaticArray1D<double, 9> eigenvalues;
+        numeric::StaticArray2D<double, 9, 9> eigenvectors;
+        eigenvectorsSymmetric(inputArray, eigenvalues, eigenvectors);
+        this->checkEigenDecomposition(inputArray, eigenvalues, eigenvectors);
+
+        // Compare with the LAPACK based implementation.
+        numeric::Array2D<double> dynamicArray(9, 9);
+        std::copy(inputArray.begin(), inputArray.end(), dynamicArray.begin());
+        numeric::Array1D<double> referenceEigenvalues;
+        numeric::Array2D<double> referenceEigenvectors;
+        linearAlgebra::eigenvectorsSymmetric(
+          dynamicArray, referenceEigenvalues, referenceEigenvectors);
+        for(size_t ii = 0; ii < 9; ++ii) {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(eigenvalues[ii], referenceEigenvalues[ii],
+                                     m_defaultTolerance));
+        }
+
+        // The 3x3 case should also be reachable explicitly.
+        numeric::StaticArray2D<double, 3, 3> smallArray;
+        this->fillRandom(smallArray);
+        smallArray = this->makeSymmetric(smallArray);
+        numeric::StaticArray1D<double, 3> smallEigenvalues;
+        numeric::StaticArray2D<double, 3, 3> smallEigenvectors;
+        eigenvectorsSymmetricJacobi(
+          smallArray, smallEigenvalues, smallEigenvectors);
+        this->checkEigenDecomposition(
+          smallArray, smallEigenvalues, smallEigenvectors);
+      }
+    }
+
+
+    void
+    StaticLinearAlgebraTest::
+    testLinearSolveInPlace()
+    {
+      for(size_t trial = 0; trial < 20; ++trial) {
+        numeric::StaticArray2D<double, 10, 10> AA;
+        this->fillRandom(AA);
+        numeric::StaticArray2D<double, 10, 3> xx;
+        this->fillRandom(xx);
+        numeric::StaticArray2D<double, 10, 3> bb = numeric::matrixMultiply(
+          AA, xx);
+        numeric::StaticArray2D<double, 10, 10> AACopy = AA;
+        linearSolveInPlace(AACopy, bb);
+        for(size_t ii = 0; ii < bb.size(); ++ii) {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(bb[ii], xx[ii], 1.0E-8));
+        }
+
+        numeric::StaticArray1D<double, 10> xVector;
+        for(size_t ii = 0; ii < 10; ++ii) {
+          xVector[ii] = this->getRandom();
+        }
+        numeric::StaticArray1D<double, 10> bVector =
+          numeric::matrixMultiply(AA, xVector);
+        AACopy = AA;
+        linearSolveInPlace(AACopy, bVector);
+        for(size_t ii = 0; ii < 10; ++ii) {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(bVector[ii], xVector[ii], 1.0E-8));
+        }
+      }
+
+      // Singular input should throw.
+      numeric::StaticArray2D<double, 3, 3> singular(1.0);
+      numeric::StaticArray1D<double, 3> bVector;
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  linearSolveInPlace(singular, bVector));
+    }
+
+
+    void
+    StaticLinearAlgebraTest::
+    testQrFactorization()
+    {
+      for(size_t trial = 0; trial < 20; ++trial) {
+        numeric::StaticArray2D<double, 6, 4> inputArray;
+        this->fillRandom(inputArray);
+        numeric::StaticArray2D<double, 6, 6> qArray;
+        numeric::StaticArray2D<double, 6, 4> rArray;
+        qrFactorization(inputArray, qArray, rArray);
+
+        BRICK_TEST_ASSERT(this->isOrthonormalColumns(qArray));
+        numeric::StaticArray2D<double, 6, 4> product =
+          numeric::matrixMultiply(qArray, rArray);
+        for(size_t ii = 0; ii < product.size(); ++ii) {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(product[ii], inputArray[ii],
+                                     m_defaultTolerance));
+        }
+        for(size_t rr = 0; rr < 6; ++rr) {
+          for(size_t cc = 0; cc < 4; ++cc) {
+            if(rr > cc) {
+              BRICK_TEST_ASSERT(rArray(rr, cc) == 0.0);
+            } else if(rr == cc) {
+              BRICK_TEST_ASSERT(rArray(rr, cc) >= 0.0);
+            }
+          }
+        }
+      }
+    }
+
+
+    void
+    StaticLinearAlgebraTest::
+    testSingularValueDecomposition()
+    {
+      for(size_t trial = 0; trial < 20; ++trial) {
+        // Full rank, tall.
+        numeric::StaticArray2D<double, 7, 4> inputArray;
+        this->fillRandom(inputArray);
+        numeric::StaticArray2D<double, 7, 4> uArray;
+        numeric::StaticArray1D<double, 4> sigmaArray;
+        numeric::StaticArray2D<double, 4, 4> vTransposeArray;
+        singularValueDecomposition(
+          inputArray, uArray, sigmaArray, vTransposeArray);
+
+        BRICK_TEST_ASSERT(this->isOrthonormalColumns(uArray));
+        BRICK_TEST_ASSERT(this->isOrthonormalColumns(vTransposeArray));
+        numeric::StaticArray2D<double, 7, 4> product;
+        for(size_t rr = 0; rr < 7; ++rr) {
+          for(size_t cc = 0; cc < 4; ++cc) {
+            double accumulator = 0.0;
+            for(size_t kk = 0; kk < 4; ++kk) {
+              accumulator +=
+                uArray(rr, kk) * sigmaArray[kk] * vTransposeArray(kk, cc);
+            }
+            product(rr, cc) = accumulator;
+          }
+        }
+        for(size_t ii = 0; ii < product.size(); ++ii) {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(product[ii], inputArray[ii],
+                                     m_defaultTolerance));
+        }
+
+        // Compare with the LAPACK based implementation.
+        numeric::Array2D<double> dynamicArray(7, 4);
+        std::copy(inputArray.begin(), inputArray.end(), dynamicArray.begin());
+        numeric::Array1D<double> referenceSigma = singularValues(dynamicArray);
+        for(size_t ii = 0; ii < 4; ++ii) {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(sigmaArray[ii], referenceSigma[ii],
+                                     m_defaultTolerance));
+        }
+
+        // Rank deficient and zero-padded, the way fivePointAlgorithm()
+        // uses it.  The last rows of V^T must span the null space.
+        numeric::StaticArray2D<double, 9, 9> paddedArray(0.0);
+        for(size_t ii = 0; ii < 5 * 9; ++ii) {
+          paddedArray[ii] = this->getRandom();
+        }
+        numeric::StaticArray2D<double, 9, 9> uPadded;
+        numeric::StaticArray1D<double, 9> sigmaPadded;
+        numeric::StaticArray2D<double, 9, 9> vTransposePadded;
+        singularValueDecomposition(
+          paddedArray, uPadded, sigmaPadded, vTransposePadded);
+        BRICK_TEST_ASSERT(this->isOrthonormalColumns(uPadded));
+        BRICK_TEST_ASSERT(this->isOrthonormalColumns(vTransposePadded));
+        for(size_t ii = 5; ii < 9; ++ii) {
+          BRICK_TEST_ASSERT(std::fabs(sigmaPadded[ii]) < m_defaultTolerance);
+          for(size_t rr = 0; rr < 5; ++rr) {
+            double residual = 0.0;
+            for(size_t cc = 0; cc < 9; ++cc) {
+              residual += paddedArray(rr, cc) * vTransposePadded(ii, cc);
+            }
+            BRICK_TEST_ASSERT(std::fabs(residual) < m_defaultTolerance);
+          }
+        }
+      }
+    }
+
+
+    double
+    StaticLinearAlgebraTest::
+    getRandom()
+    {
+      m_seed = m_seed * 1103515245u + 12345u;
+      return static_cast<double>((m_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+    }
+
+
+    template <size_t Rows, size_t Columns>
+    void
+    StaticLinearAlgebraTest::
+    fillRandom(numeric::StaticArray2D<double, Rows, Columns>& array0)
+    {
+      for(size_t ii = 0; ii < array0.size(); ++ii) {
+        array0[ii] = this->getRandom();
+      }
+    }
+
+
+    template <size_t Size>
+    numeric::StaticArray2D<double, Size, Size>
+    StaticLinearAlgebraTest::
+    makeSymmetric(numeric::StaticArray2D<double, Size, Size> const& array0)
+    {
+      numeric::StaticArray2D<double, Size, Size> result = array0;
+      for(size_t rr = 0; rr < Size; ++rr) {
+        for(size_t cc = 0; cc < rr; ++cc) {
+          result(rr, cc) = result(cc, rr);
+        }
+      }
+      return result;
+    }
+
+
+    template <size_t Size>
+    void
+    StaticLinearAlgebraTest::
+    checkEigenDecomposition(
+      numeric::StaticArray2D<double, Size, Size> const& inputArray,
+      numeric::StaticArray1D<double, Size> const& eigenvalues,
+      numeric::StaticArray2D<double, Size, Size> const& eigenvectors)
+    {
+      double scale = 1.0;
+      for(size_t ii = 0; ii < inputArray.size(); ++ii) {
+        scale = std::max(scale, std::fabs(inputArray[ii]));
+      }
+      BRICK_TEST_ASSERT(this->isOrthonormalColumns(eigenvectors));
+      for(size_t ii = 0; ii < Size; ++ii) {
+        if(ii != 0) {
+          BRICK_TEST_ASSERT(eigenvalues[ii] <= eigenvalues[ii - 1]);
+        }
+        for(size_t rr = 0; rr < Size; ++rr) {
+          double accumulator = 0.0;
+          for(size_t cc = 0; cc < Size; ++cc) {
+            accumulator += inputArray(rr, cc) * eigenvectors(cc, ii);
+          }
+          BRICK_TEST_ASSERT(
+            std::fabs(accumulator - eigenvalues[ii] * eigenvectors(rr, ii))
+            < m_defaultTolerance * scale);
+        }
+      }
+    }
+
+
+    template <size_t Rows, size_t Columns>
+    bool
+    StaticLinearAlgebraTest::
+    isOrthonormalColumns(
+      numeric::StaticArray2D<double, Rows, Columns> const& array0)
+    {
+      for(size_t ii = 0; ii < Columns; ++ii) {
+        for(size_t jj = 0; jj < Columns; ++jj) {
+          double accumulator = 0.0;
+          for(size_t rr = 0; rr < Rows; ++rr) {
+            accumulator += array0(rr, ii) * array0(rr, jj);
+          }
+          double target = (ii == jj) ? 1.0 : 0.0;
+          if(std::fabs(accumulator - target) > m_defaultTolerance) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  } // namespace linearAlgebra
+
+} // namespace brick
+
+
+#if 0
+
+int main(int /* argc */, char** /* argv */)
+{
+  brick::linearAlgebra::StaticLinearAlgebraTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::linearAlgebra::StaticLinearAlgebraTest currentTest;
+
+}
+
+#endif
@@ -0,0 +1,253 @@
+/**
+***************************************************************************
+* @file brick/numeric/amanatidesWoo2DBatch.hh
+*
+* Header file declaring functions for tracing many rays at once
+* through a 2D array using the algorithm of Amanatides and Woo.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_AMANATIDESWOO2DBATCH_HH
+#define BRICK_NUMERIC_AMANATIDESWOO2DBATCH_HH
+
+#include <limits>
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/numeric/amanatidesWooReducers.hh>
+#include <brick/numeric/array1D.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/numeric/transform2D.hh>
+#include <brick/numeric/vector2D.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** This class summarizes which regions of a 2D array are empty,
+     ** so that traceRays() can skip over them without visiting each
+     ** pixel.  Level 0 divides the array into square blocks of
+     ** blockSize pixels on a side, and records which blocks contain
+     ** only empty pixels.  Each subsequent level doubles the block
+     ** size.  During traversal, a ray that enters an empty block
+     ** jumps directly to the far side of the largest empty block
+     ** that contains the current pixel.
+     **
+     ** The pyramid is a snapshot: if the array changes, it must be
+     ** rebuilt.  Note also that skipping is only correct if the
+     ** reduction functor passed to traceRays() ignores empty pixels.
+     ** For example, a pyramid that treats zero as empty is fine for
+     ** RaySum, and for RayFirstHit with a nonnegative threshold.
+     **/
+    class EmptySpacePyramid2D {
+    public:
+
+      /**
+       * The default constructor creates an empty pyramid, which
+       * causes traceRays() to visit every pixel.
+       */
+      EmptySpacePyramid2D()
+        : m_blockShift(0), m_levels() {}
+
+
+      /**
+       * This constructor builds a pyramid for the specified array.
+       *
+       * @param data This argument is the array to be summarized.
+       *
+       * @param isEmpty This argument is a functor that accepts an
+       * array element and returns true if it should be treated as
+       * empty space.
+       *
+       * @param blockSize This argument specifies the side length of
+       * the level 0 blocks.  It must be a power of two.
+       *
+       * @param numberOfLevels This argument specifies how many levels
+       * the pyramid should have.
+       */
+      template <class ARRAY2D, class Predicate>
+      EmptySpacePyramid2D(ARRAY2D const& data,
+                          Predicate isEmpty,
+                          size_t blockSize = 4,
+                          size_t numberOfLevels = 3);
+
+
+      /**
+       * This member function returns the side length of the blocks
+       * at the specified level of the pyramid.
+       *
+       * @param level This argument selects the level.
+       *
+       * @return The return value is the block size, in pixels.
+       */
+      size_t
+      getBlockSize(size_t level) const {
+        return size_t(1) << (m_blockShift + level);
+      }
+
+
+      /**
+       * This member function returns the number of levels in the
+       * pyramid.
+       *
+       * @return The return value is the number of levels, or 0 if
+       * the pyramid has not been built.
+       */
+      size_t
+      getNumberOfLevels() const {return m_levels.size();}
+
+
+      /**
+       * This member function reports whether the block at the
+       * specified level that contains the specified pixel is empty.
+       *
+       * @param level This argument selects the pyramid level.
+       *
+       * @param row This argument is the V coordinate of the pixel.
+       *
+       * @param column This argument is the U coordinate of the pixel.
+       *
+       * @return The return value is true if every pixel in the block
+       * is empty.
+       */
+      bool
+      isEmpty(size_t level, size_t row, size_t column) const {
+        size_t shift = m_blockShift + level;
+        return m_levels[level](row >> shift, column >> shift) != 0;
+      }
+
+    private:
+
+      size_t m_blockShift;
+      std::vector< Array2D<common::UInt8> > m_levels;
+    };
+
+
+    /**
+     * This function traces each of a set of rays through a 2D array,
+     * and reduces the pixels along each ray to a single result using
+     * the specified functor.  Pixels are visited in exactly the
+     * order (and with the same coordinate conventions) as
+     * AmanatidesWoo2D, but without the per-ray object construction
+     * and iterator overhead.  Ray setup is done in packets of
+     * several rays at a time, so that the compiler can vectorize
+     * it, and batches of rays are distributed across threads.
+     *
+     * Here's an example of 2D laser scan simulation:
+     *
+     * @code
+     *   EmptySpacePyramid2D pyramid(
+     *     occupancyGrid, [](float value) {return value <= 0.5f;});
+     *   Array1D<double> hitDistances;
+     *   traceRays(occupancyGrid, pixelFromWorld, sensorOrigin,
+     *             beamDirections, RayFirstHit<float>(0.5f), hitDistances,
+     *             maximumRange, &pyramid, 0);
+     * @endcode
+     *
+     * @param data This argument is the array to be traversed.  If
+     * the reduction functor modifies pixels, the calling context
+     * must ensure that rays assigned to different threads don't
+     * touch the same pixels, or else set numberOfThreads to 1.
+     *
+     * @param pixelTworld This argument takes world coordinates to
+     * pixel coordinates, just as for AmanatidesWoo2D.
+     *
+     * @param rayOrigins This argument specifies the start point of
+     * each ray, in world coordinates.
+     *
+     * @param rayDirections This argument specifies the direction of
+     * each ray, in world coordinates.  It must have the same size as
+     * rayOrigins.
+     *
+     * @param reducer This argument is the reduction functor.  See
+     * RayFirstHit for a description of its interface.
+     *
+     * @param results This argument is used to return one result per
+     * ray.  It will be reinitialized if its size is wrong.
+     *
+     * @param maximumT This argument specifies the value of ray
+     * parameter t at which traversal should stop.  If rayDirections
+     * are unit vectors in world coordinates, this is a range limit.
+     *
+     * @param pyramidPtr If this argument is not null, it is used to
+     * skip empty space.  It must have been built from data.
+     *
+     * @param numberOfThreads This argument specifies how many threads
+     * to use.  Setting it to 0 means "use one thread per core."
+     *
+     * @param downstreamOnly If this argument is true, only pixels at
+     * nonnegative values of ray parameter t will be visited.
+     */
+    template <class ARRAY2D, class FLOAT_TYPE, class Reducer>
+    void
+    traceRays(ARRAY2D& data,
+              Transform2D<FLOAT_TYPE> const& pixelTworld,
+              Array1D< Vector2D<FLOAT_TYPE> > const& rayOrigins,
+              Array1D< Vector2D<FLOAT_TYPE> > const& rayDirections,
+              Reducer const& reducer,
+              Array1D<typename Reducer::result_type>& results,
+              FLOAT_TYPE maximumT = std::numeric_limits<FLOAT_TYPE>::max(),
+              EmptySpacePyramid2D const* pyramidPtr = 0,
+              size_t numberOfThreads = 1,
+              bool downstreamOnly = true);
+
+
+    /**
+     * This function is just like the other version of traceRays(),
+     * except that all rays share a single origin, as is the case
+     * for a planar laser scan.
+     *
+     * @param data This argument is the array to be traversed.
+     *
+     * @param pixelTworld This argument takes world coordinates to
+     * pixel coordinates.
+     *
+     * @param rayOrigin This argument specifies the start point of
+     * every ray, in world coordinates.
+     *
+     * @param rayDirections This argument specifies the direction of
+     * each ray, in world coordinates.
+     *
+     * @param reducer This argument is the reduction functor.
+     *
+     * @param results This argument is used to return one result per
+     * ray.
+     *
+     * @param maximumT This argument specifies the value of ray
+     * parameter t at which traversal should stop.
+     *
+     * @param pyramidPtr If this argument is not null, it is used to
+     * skip empty space.
+     *
+     * @param numberOfThreads This argument specifies how many threads
+     * to use.  Setting it to 0 means "use one thread per core."
+     *
+     * @param downstreamOnly If this argument is true, only pixels at
+     * nonnegative values of ray parameter t will be visited.
+     */
+    template <class ARRAY2D, class FLOAT_TYPE, class Reducer>
+    void
+    traceRays(ARRAY2D& data,
+              Transform2D<FLOAT_TYPE> const& pixelTworld,
+              Vector2D<FLOAT_TYPE> const& rayOrigin,
+              Array1D< Vector2D<FLOAT_TYPE> > const& rayDirections,
+              Reducer const& reducer,
+              Array1D<typename Reducer::result_type>& results,
+              FLOAT_TYPE maximumT = std::numeric_limits<FLOAT_TYPE>::max(),
+              EmptySpacePyramid2D const* pyramidPtr = 0,
+              size_t numberOfThreads = 1,
+              bool downstreamOnly = true);
+
+  } // namespace numeric
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/amanatidesWoo2DBatch_impl.hh>
+
+#endif /* #ifndef BRICK_NUMERIC_AMANATIDESWOO2DBATCH_HH */
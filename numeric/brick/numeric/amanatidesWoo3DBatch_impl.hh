@@ -0,0 +1,456 @@
+/**
+***************************************************************************
+* @file brick/numeric/amanatidesWoo3DBatch_impl.hh
+*
+* Header file defining inline and template functions declared in
+* amanatidesWoo3DBatch.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_AMANATIDESWOO3DBATCH_IMPL_HH
+#define BRICK_NUMERIC_AMANATIDESWOO3DBATCH_IMPL_HH
+
+// This file is included by amanatidesWoo3DBatch.hh, and should not be
+// directly included by user code, so no need to include
+// amanatidesWoo3DBatch.hh here.
+//
+// #include <brick/numeric/amanatidesWoo3DBatch.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <brick/common/exception.hh>
+#include <brick/common/parallel.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Rays are set up this many at a time.  The setup loops are
+      // written over fixed-size arrays so that they vectorize.
+      const size_t amanatidesWoo3DPacketSize = 8;
+
+      // Each thread grabs this many rays at a time.
+      const size_t amanatidesWoo3DRaysPerTask = 1024;
+
+
+      // Compute the values of ray parameter t at which the ray
+      // leaves the current voxel along each axis.
+      template <class FLOAT_TYPE>
+      inline void
+      setAmanatidesWoo3DTMax(long const* index, long const* step,
+                             FLOAT_TYPE const* origin,
+                             FLOAT_TYPE const* direction,
+                             FLOAT_TYPE* tMax)
+      {
+        for(size_t axis = 0; axis < 3; ++axis) {
+          if(step[axis] > 0) {
+            tMax[axis] = ((FLOAT_TYPE(index[axis] + 1) - origin[axis])
+                          / direction[axis]);
+          } else if(step[axis] < 0) {
+            tMax[axis] = ((FLOAT_TYPE(index[axis]) - origin[axis])
+                          / direction[axis]);
+          } else {
+            tMax[axis] = std::numeric_limits<FLOAT_TYPE>::max();
+          }
+        }
+      }
+
+
+      // Trace a single ray, in voxel coordinates, starting at tStart.
+      // Axis 0 is U (columns), axis 1 is V (rows), and axis 2 is W
+      // (slices), matching AmanatidesWoo3D.
+      template <class ARRAY3D, class FLOAT_TYPE, class Reducer>
+      void
+      traceAmanatidesWoo3DRay(ARRAY3D& data,
+                              long const* sizes,
+                              FLOAT_TYPE const* origin,
+                              FLOAT_TYPE const* direction,
+                              FLOAT_TYPE tStart,
+                              FLOAT_TYPE maximumT,
+                              EmptySpacePyramid3D const* pyramidPtr,
+                              Reducer const& reducer,
+                              typename Reducer::result_type& result)
+      {
+        // As in the AmanatidesWoo3D constructor, tMax is measured
+        // from the entry point, rather than from the ray origin.  The
+        // two agree except for roundoff, but roundoff decides which
+        // voxel is visited when a ray passes exactly through a voxel
+        // edge or corner.
+        long index[3];
+        long step[3];
+        FLOAT_TYPE tDelta[3];
+        FLOAT_TYPE tMax[3];
+        for(size_t axis = 0; axis < 3; ++axis) {
+          FLOAT_TYPE entry = origin[axis] + tStart * direction[axis];
+          if(entry < FLOAT_TYPE(0)) {
+            entry = FLOAT_TYPE(0);
+          }
+          long position = static_cast<long>(std::floor(entry));
+          index[axis] = std::max(0L, std::min(position, sizes[axis] - 1));
+          if(direction[axis] > FLOAT_TYPE(0)) {
+            step[axis] = 1;
+            tDelta[axis] = FLOAT_TYPE(1) / direction[axis];
+            tMax[axis] = tStart + ((FLOAT_TYPE(index[axis] + 1) - entry)
+                                   / direction[axis]);
+          } else if(direction[axis] < FLOAT_TYPE(0)) {
+            step[axis] = -1;
+            tDelta[axis] = FLOAT_TYPE(-1) / direction[axis];
+            tMax[axis] = tStart + ((FLOAT_TYPE(index[axis]) - entry)
+                                   / direction[axis]);
+          } else {
+            step[axis] = 0;
+            tDelta[axis] = std::numeric_limits<FLOAT_TYPE>::max();
+            tMax[axis] = std::numeric_limits<FLOAT_TYPE>::max();
+          }
+        }
+
+        size_t const numberOfLevels =
+          (pyramidPtr == 0) ? 0 : pyramidPtr->getNumberOfLevels();
+        FLOAT_TYPE tEntry = tStart;
+        while(true) {
+          if(numberOfLevels != 0
+             && pyramidPtr->isEmpty(0, index[2], index[1], index[0])) {
+
+            // Find the largest empty block containing this voxel.
+            size_t level = 0;
+            while(level + 1 < numberOfLevels
+                  && pyramidPtr->isEmpty(
+                    level + 1, index[2], index[1], index[0])) {
+              ++level;
+            }
+            long const blockSize =
+              static_cast<long>(pyramidPtr->getBlockSize(level));
+
+            // Find where the ray leaves the block.
+            long lowerBound[3];
+            long upperBound[3];
+            FLOAT_TYPE tBlockExit = std::numeric_limits<FLOAT_TYPE>::max();
+            size_t exitAxis = 0;
+            for(size_t axis = 0; axis < 3; ++axis) {
+              lowerBound[axis] = (index[axis] / blockSize) * blockSize;
+              upperBound[axis] = std::min(lowerBound[axis] + blockSize,
+                                          sizes[axis]);
+              FLOAT_TYPE tCandidate = tBlockExit;
+              if(step[axis] > 0) {
+                tCandidate = ((FLOAT_TYPE(upperBound[axis]) - origin[axis])
+                              / direction[axis]);
+              } else if(step[axis] < 0) {
+                tCandidate = ((FLOAT_TYPE(lowerBound[axis]) - origin[axis])
+                              / direction[axis]);
+              }
+              if(tCandidate < tBlockExit) {
+                tBlockExit = tCandidate;
+                exitAxis = axis;
+              }
+            }
+            if(tBlockExit >= maximumT) {
+              return;
+            }
+
+            // Jump to the first voxel past the block.  Only the exit
+            // axis is guaranteed to change, so the other coordinates
+            // are clamped to the block to protect against roundoff.
+            tEntry = std::max(tEntry, tBlockExit);
+            for(size_t axis = 0; axis < 3; ++axis) {
+              if(axis == exitAxis) {
+                index[axis] = ((step[axis] > 0) ? upperBound[axis]
+                               : lowerBound[axis] - 1);
+              } else {
+                long position = static_cast<long>(
+                  std::floor(origin[axis] + tEntry * direction[axis]));
+                index[axis] = std::max(
+                  lowerBound[axis], std::min(position, upperBound[axis] - 1));
+              }
+            }
+            if(index[exitAxis] < 0 || index[exitAxis] >= sizes[exitAxis]) {
+              return;
+            }
+            setAmanatidesWoo3DTMax(index, step, origin, direction, tMax);
+            continue;
+          }
+
+          // Ties are broken exactly as in AmanatidesWoo3DIterator.
+          size_t axis;
+          if(tMax[0] < tMax[1]) {
+            axis = (tMax[2] < tMax[0]) ? 2 : 0;
+          } else {
+            axis = (tMax[2] < tMax[1]) ? 2 : 1;
+          }
+          FLOAT_TYPE tExit = tMax[axis];
+          if(!reducer(result, data(index[2], index[1], index[0]),
+                      tEntry, std::min(tExit, maximumT))) {
+            return;
+          }
+          if(tExit >= maximumT) {
+            return;
+          }
+          index[axis] += step[axis];
+          if(index[axis] < 0 || index[axis] >= sizes[axis]) {
+            return;
+          }
+          tEntry = tExit;
+          tMax[axis] += tDelta[axis];
+        }
+      }
+
+
+      // Trace rays [beginIndex, endIndex).  If originStride is zero,
+      // every ray shares rayOrigins[0].
+      template <class ARRAY3D, class FLOAT_TYPE, class Reducer>
+      void
+      traceAmanatidesWoo3DRange(ARRAY3D& data,
+                                Transform3D<FLOAT_TYPE> const& voxelTworld,
+                                Vector3D<FLOAT_TYPE> const* rayOrigins,
+                                size_t originStride,
+                                Vector3D<FLOAT_TYPE> const* rayDirections,
+                                Reducer const& reducer,
+                                typename Reducer::result_type* results,
+                                FLOAT_TYPE maximumT,
+                                EmptySpacePyramid3D const* pyramidPtr,
+                                bool downstreamOnly,
+                                size_t beginIndex,
+                                size_t endIndex)
+      {
+        size_t const packetSize = amanatidesWoo3DPacketSize;
+        long const sizes[3] = {static_cast<long>(data.shape()[2]),
+                               static_cast<long>(data.shape()[1]),
+                               static_cast<long>(data.shape()[0])};
+
+        FLOAT_TYPE origins[3][packetSize];
+        FLOAT_TYPE directions[3][packetSize];
+        FLOAT_TYPE tEnter[packetSize];
+        FLOAT_TYPE tLeave[packetSize];
+        for(size_t packetBegin = beginIndex; packetBegin < endIndex;
+            packetBegin += packetSize) {
+          size_t const lanes = std::min(packetSize, endIndex - packetBegin);
+
+          // Convert the packet to voxel coordinates.
+          for(size_t lane = 0; lane < lanes; ++lane) {
+            size_t rayIndex = packetBegin + lane;
+            Vector3D<FLOAT_TYPE> const& worldOrigin =
+              rayOrigins[rayIndex * originStride];
+            Vector3D<FLOAT_TYPE> originVoxel = voxelTworld * worldOrigin;
+            Vector3D<FLOAT_TYPE> directionVoxel =
+              (voxelTworld * (worldOrigin + rayDirections[rayIndex]))
+              - originVoxel;
+            origins[0][lane] = originVoxel.x();
+            origins[1][lane] = originVoxel.y();
+            origins[2][lane] = originVoxel.z();
+            directions[0][lane] = directionVoxel.x();
+            directions[1][lane] = directionVoxel.y();
+            directions[2][lane] = directionVoxel.z();
+          }
+
+          // Clip the packet against the array bounds using the slab
+          // method.
+          for(size_t lane = 0; lane < lanes; ++lane) {
+            tEnter[lane] = (downstreamOnly ? FLOAT_TYPE(0)
+                            : -std::numeric_limits<FLOAT_TYPE>::max());
+            tLeave[lane] = maximumT;
+          }
+          for(size_t axis = 0; axis < 3; ++axis) {
+            FLOAT_TYPE const upperLimit = FLOAT_TYPE(sizes[axis]);
+            for(size_t lane = 0; lane < lanes; ++lane) {
+              FLOAT_TYPE const oo = origins[axis][lane];
+              FLOAT_TYPE const dd = directions[axis][lane];
+              if(dd != FLOAT_TYPE(0)) {
+                FLOAT_TYPE t0 = (FLOAT_TYPE(0) - oo) / dd;
+                FLOAT_TYPE t1 = (upperLimit - oo) / dd;
+                tEnter[lane] = std::max(tEnter[lane], std::min(t0, t1));
+                tLeave[lane] = std::min(tLeave[lane], std::max(t0, t1));
+              } else if(oo < FLOAT_TYPE(0) || oo >= upperLimit) {
+                tLeave[lane] = -std::numeric_limits<FLOAT_TYPE>::max();
+              }
+            }
+          }
+
+          // Walk each ray.
+          for(size_t lane = 0; lane < lanes; ++lane) {
+            typename Reducer::result_type& result =
+              results[packetBegin + lane];
+            result = reducer.initialize();
+            if(tEnter[lane] < tLeave[lane]) {
+              FLOAT_TYPE const origin[3] = {
+                origins[0][lane], origins[1][lane], origins[2][lane]};
+              FLOAT_TYPE const direction[3] = {
+                directions[0][lane], directions[1][lane], directions[2][lane]};
+              traceAmanatidesWoo3DRay(
+                data, sizes, origin, direction, tEnter[lane], maximumT,
+                pyramidPtr, reducer, result);
+            }
+          }
+        }
+      }
+
+
+      // Divide rays among threads.
+      template <class ARRAY3D, class FLOAT_TYPE, class Reducer>
+      void
+      traceAmanatidesWoo3DBatch(ARRAY3D& data,
+                                Transform3D<FLOAT_TYPE> const& voxelTworld,
+                                Vector3D<FLOAT_TYPE> const* rayOrigins,
+                                size_t originStride,
+                                Array1D< Vector3D<FLOAT_TYPE> > const&
+                                  rayDirections,
+                                Reducer const& reducer,
+                                Array1D<typename Reducer::result_type>&
+                                  results,
+                                FLOAT_TYPE maximumT,
+                                EmptySpacePyramid3D const* pyramidPtr,
+                                size_t numberOfThreads,
+                                bool downstreamOnly)
+      {
+        size_t const numberOfRays = rayDirections.size();
+        if(results.size() != numberOfRays) {
+          results.reinit(numberOfRays);
+        }
+        if(numberOfRays == 0) {
+          return;
+        }
+        size_t const raysPerTask = amanatidesWoo3DRaysPerTask;
+        size_t const numberOfTasks =
+          (numberOfRays + raysPerTask - 1) / raysPerTask;
+        Vector3D<FLOAT_TYPE> const* directionsPtr = rayDirections.data();
+        typename Reducer::result_type* resultsPtr = results.data();
+        brick::common::executeInParallel(
+          numberOfTasks,
+          [&](size_t taskIndex) {
+            size_t beginIndex = taskIndex * raysPerTask;
+            size_t endIndex = std::min(beginIndex + raysPerTask, numberOfRays);
+            traceAmanatidesWoo3DRange(
+              data, voxelTworld, rayOrigins, originStride, directionsPtr,
+              reducer, resultsPtr, maximumT, pyramidPtr, downstreamOnly,
+              beginIndex, endIndex);
+          },
+          numberOfThreads);
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // This constructor builds a pyramid for the specified array.
+    template <class ARRAY3D, class Predicate>
+    EmptySpacePyramid3D::
+    EmptySpacePyramid3D(ARRAY3D const& data,
+                        Predicate isEmpty,
+                        size_t blockSize,
+                        size_t numberOfLevels)
+      : m_blockShift(0),
+        m_levels()
+    {
+      if(blockSize == 0 || (blockSize & (blockSize - 1)) != 0) {
+        BRICK_THROW(common::ValueException,
+                    "EmptySpacePyramid3D::EmptySpacePyramid3D()",
+                    "Argument blockSize must be a power of two.");
+      }
+      while((size_t(1) << m_blockShift) < blockSize) {
+        ++m_blockShift;
+      }
+
+      // Level 0 is computed directly from the data.
+      size_t const slices = data.shape()[0];
+      size_t const rows = data.shape()[1];
+      size_t const columns = data.shape()[2];
+      if(numberOfLevels == 0) {
+        return;
+      }
+      m_levels.resize(numberOfLevels);
+      Array3D<common::UInt8>& level0 = m_levels[0];
+      level0.reinit((slices + blockSize - 1) >> m_blockShift,
+                    (rows + blockSize - 1) >> m_blockShift,
+                    (columns + blockSize - 1) >> m_blockShift);
+      level0 = common::UInt8(1);
+      for(size_t slice = 0; slice < slices; ++slice) {
+        for(size_t row = 0; row < rows; ++row) {
+          for(size_t column = 0; column < columns; ++column) {
+            if(!isEmpty(data(slice, row, column))) {
+              level0(slice >> m_blockShift, row >> m_blockShift,
+                     column >> m_blockShift) = 0;
+            }
+          }
+        }
+      }
+
+      // Each subsequent level is empty only where all eight of its
+      // children are empty.
+      for(size_t level = 1; level < numberOfLevels; ++level) {
+        Array3D<common::UInt8> const& child = m_levels[level - 1];
+        Array3D<common::UInt8>& parent = m_levels[level];
+        size_t const childSlices = child.shape()[0];
+        size_t const childRows = child.shape()[1];
+        size_t const childColumns = child.shape()[2];
+        parent.reinit((childSlices + 1) >> 1, (childRows + 1) >> 1,
+                      (childColumns + 1) >> 1);
+        parent = common::UInt8(1);
+        for(size_t slice = 0; slice < childSlices; ++slice) {
+          for(size_t row = 0; row < childRows; ++row) {
+            for(size_t column = 0; column < childColumns; ++column) {
+              if(child(slice, row, column) == 0) {
+                parent(slice >> 1, row >> 1, column >> 1) = 0;
+              }
+            }
+          }
+        }
+      }
+    }
+
+
+    // This function traces each of a set of rays through a 3D array.
+    template <class ARRAY3D, class FLOAT_TYPE, class Reducer>
+    void
+    traceRays(ARRAY3D& data,
+              Transform3D<FLOAT_TYPE> const& voxelTworld,
+              Array1D< Vector3D<FLOAT_TYPE> > const& rayOrigins,
+              Array1D< Vector3D<FLOAT_TYPE> > const& rayDirections,
+              Reducer const& reducer,
+              Array1D<typename Reducer::result_type>& results,
+              FLOAT_TYPE maximumT,
+              EmptySpacePyramid3D const* pyramidPtr,
+              size_t numberOfThreads,
+              bool downstreamOnly)
+    {
+      if(rayOrigins.size() != rayDirections.size()) {
+        BRICK_THROW(common::ValueException, "traceRays()",
+                    "Arguments rayOrigins and rayDirections must have "
+                    "the same size.");
+      }
+      privateCode::traceAmanatidesWoo3DBatch(
+        data, voxelTworld, rayOrigins.data(), 1, rayDirections, reducer,
+        results, maximumT, pyramidPtr, numberOfThreads, downstreamOnly);
+    }
+
+
+    // This function traces each of a set of rays, all sharing the
+    // same origin, through a 3D array.
+    template <class ARRAY3D, class FLOAT_TYPE, class Reducer>
+    void
+    traceRays(ARRAY3D& data,
+              Transform3D<FLOAT_TYPE> const& voxelTworld,
+              Vector3D<FLOAT_TYPE> const& rayOrigin,
+              Array1D< Vector3D<FLOAT_TYPE> > const& rayDirections,
+              Reducer const& reducer,
+              Array1D<typename Reducer::result_type>& results,
+              FLOAT_TYPE maximumT,
+              EmptySpacePyramid3D const* pyramidPtr,
+              size_t numberOfThreads,
+              bool downstreamOnly)
+    {
+      privateCode::traceAmanatidesWoo3DBatch(
+        data, voxelTworld, &rayOrigin, 0, rayDirections, reducer,
+        results, maximumT, pyramidPtr, numberOfThreads, downstreamOnly);
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_AMANATIDESWOO3DBATCH_IMPL_HH */
@@ -0,0 +1,190 @@
+/**
+***************************************************************************
+* @file brick/numeric/amanatidesWooReducers.hh
+*
+* Header file declaring reduction functors for use with the batch
+* ray traversal functions declared in amanatidesWoo2DBatch.hh and
+* amanatidesWoo3DBatch.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_AMANATIDESWOOREDUCERS_HH
+#define BRICK_NUMERIC_AMANATIDESWOOREDUCERS_HH
+
+#include <limits>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** This functor is passed to traceRays() to find the first voxel
+     ** (or pixel) along each ray whose value exceeds a threshold.
+     ** The result for each ray is the value of ray parameter t at
+     ** which the ray enters that voxel, or
+     ** std::numeric_limits<FloatType>::max() if there is no such
+     ** voxel.
+     **
+     ** All reduction functors share the same interface: a
+     ** result_type typedef, an initialize() member that returns the
+     ** result for a ray that touches no voxels, and an operator()
+     ** that folds one voxel into the result, returning false if
+     ** traversal of the ray should stop.
+     **/
+    template <class ValueType, class FloatType = double>
+    class RayFirstHit {
+    public:
+
+      typedef FloatType result_type;
+
+      /**
+       * The constructor sets the occupancy threshold.
+       *
+       * @param threshold Voxels with values strictly greater than
+       * this argument count as hits.
+       */
+      explicit
+      RayFirstHit(ValueType const& threshold = ValueType(0))
+        : m_threshold(threshold) {}
+
+      /**
+       * This member function returns the result for a ray that
+       * misses everything.
+       *
+       * @return The return value is
+       * std::numeric_limits<FloatType>::max().
+       */
+      result_type
+      initialize() const {return std::numeric_limits<FloatType>::max();}
+
+      /**
+       * This operator folds one voxel into the result for a ray.
+       *
+       * @param result This argument is the result so far.
+       *
+       * @param value This argument is the value of the current voxel.
+       *
+       * @param tEntry This argument is the value of ray parameter t
+       * at which the ray enters the current voxel.
+       *
+       * @param tExit This argument is the value of ray parameter t
+       * at which the ray leaves the current voxel.
+       *
+       * @return The return value is false if the current voxel is a
+       * hit, indicating that traversal should stop.
+       */
+      bool
+      operator()(result_type& result, ValueType const& value,
+                 FloatType tEntry, FloatType /* tExit */) const {
+        if(value > m_threshold) {
+          result = tEntry;
+          return false;
+        }
+        return true;
+      }
+
+    private:
+      ValueType m_threshold;
+    };
+
+
+    /**
+     ** This functor is passed to traceRays() to find the largest
+     ** voxel value along each ray.
+     **/
+    template <class ValueType, class FloatType = double>
+    class RayMaximum {
+    public:
+
+      typedef ValueType result_type;
+
+      /**
+       * This member function returns the result for a ray that
+       * touches no voxels.
+       *
+       * @return The return value is
+       * std::numeric_limits<ValueType>::lowest().
+       */
+      result_type
+      initialize() const {return std::numeric_limits<ValueType>::lowest();}
+
+      /**
+       * This operator folds one voxel into the result for a ray.
+       * See RayFirstHit::operator()() for argument descriptions.
+       *
+       * @return The return value is always true.
+       */
+      bool
+      operator()(result_type& result, ValueType const& value,
+                 FloatType /* tEntry */, FloatType /* tExit */) const {
+        if(value > result) {
+          result = value;
+        }
+        return true;
+      }
+    };
+
+
+    /**
+     ** This functor is passed to traceRays() to sum voxel values
+     ** along each ray.  Optionally, each voxel value can be weighted
+     ** by the length of the ray segment that lies within the voxel,
+     ** giving a discrete line integral.
+     **/
+    template <class ValueType, class FloatType = double>
+    class RaySum {
+    public:
+
+      typedef ValueType result_type;
+
+      /**
+       * The constructor specifies whether voxel values should be
+       * weighted by path length.
+       *
+       * @param isLengthWeighted If this argument is true, each voxel
+       * value is multiplied by (tExit - tEntry) before being added
+       * to the sum.
+       */
+      explicit
+      RaySum(bool isLengthWeighted = false)
+        : m_isLengthWeighted(isLengthWeighted) {}
+
+      /**
+       * This member function returns the result for a ray that
+       * touches no voxels.
+       *
+       * @return The return value is zero.
+       */
+      result_type
+      initialize() const {return ValueType(0);}
+
+      /**
+       * This operator folds one voxel into the result for a ray.
+       * See RayFirstHit::operator()() for argument descriptions.
+       *
+       * @return The return value is always true.
+       */
+      bool
+      operator()(result_type& result, ValueType const& value,
+                 FloatType tEntry, FloatType tExit) const {
+        if(m_isLengthWeighted) {
+          result += static_cast<ValueType>(value * (tExit - tEntry));
+        } else {
+          result += value;
+        }
+        return true;
+      }
+
+    private:
+      bool m_isLengthWeighted;
+    };
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_AMANATIDESWOOREDUCERS_HH */
@@ -28,6 +28,11 @@ namespace brick {
    **/
   namespace numeric {
 
+    // Forward declaration of the base class for lazy array
+    // expressions.  See arrayExpression.hh.
+    template <class Derived> class ArrayExpression;
+
+
     /**
      ** The Array1D class template represents a 1D array of arbitrary type.
      ** This class has internal reference counting.
@@ -167,6 +172,27 @@ namespace brick {
       Array1D(std::initializer_list<Type> initializer);
 
 
+      /**
+       * Construct an array by evaluating a lazy array expression.
+       * This constructor is deliberately not explicit, so that the
+       * result of an expression built using lazy() can be bound
+       * directly to a named array:
+       *
+       * @code
+       *    Array1D<double> sum = lazy(array0) + array1 * 2.0;
+       * @endCode
+       *
+       * The expression is evaluated in a single pass, into newly
+       * allocated memory.  Please see the documentation of class
+       * ArrayExpression for details.
+       *
+       * @param expression This argument is the expression to be
+       * evaluated.
+       */
+      template <class Derived>
+      Array1D(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Destroys the Array1D instance and deletes the internal data
        * store if no remaining arrays point to it.
@@ -234,6 +260,20 @@ namespace brick {
       copy(const Array1D<Type2>& source);
 
 
+      /**
+       * Evaluates a lazy array expression, writing the result into
+       * the existing storage of *this.  No memory is allocated.  It
+       * is an error if the expression does not have the same size as
+       * *this.
+       *
+       * @param expression The expression to be evaluated.
+       *
+       * @exception ValueException on incompatible array sizes
+       */
+      template <class Derived> void
+      copy(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Copies elements from dataPtr.  There must be valid data at all
        * addresses from dataPtr to (dataPtr + this->size());
@@ -556,6 +596,22 @@ namespace brick {
       operator=(Type value);
 
 
+      /**
+       * Evaluates a lazy array expression into newly allocated
+       * memory, and then makes *this refer to the result.  Consistent
+       * with operator=(const Array1D&), any other arrays that shared
+       * data with *this are unaffected.  If you want to overwrite the
+       * existing data instead, use copy(ArrayExpression const&).
+       *
+       * @param expression The expression to be evaluated.
+       *
+       * @return Reference to *this.
+       */
+      template <class Derived>
+      Array1D<Type>&
+      operator=(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Returns the (index)th element of the array by reference.
        *
@@ -633,6 +689,22 @@ namespace brick {
       operator+=(const Type arg);
 
 
+      /**
+       * Evaluates a lazy array expression, adding each element of
+       * the result to the corresponding element of *this.  No
+       * temporary array is allocated.
+       *
+       * @param expression The expression to be added.
+       *
+       * @exception ValueException on incompatible array sizes
+       *
+       * @return Reference to *this.
+       */
+      template <class Derived>
+      Array1D<Type>&
+      operator+=(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Decrements each element of *this by the value of the
        * corresponding element of arg.
@@ -660,6 +732,22 @@ namespace brick {
       operator-=(const Type arg);
 
 
+      /**
+       * Evaluates a lazy array expression, subtracting each element
+       * of the result from the corresponding element of *this.  No
+       * temporary array is allocated.
+       *
+       * @param expression The expression to be subtracted.
+       *
+       * @exception ValueException on incompatible array sizes
+       *
+       * @return Reference to *this.
+       */
+      template <class Derived>
+      Array1D<Type>&
+      operator-=(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Multiplies each element of *this by the value of the
        * corresponding element of arg.
@@ -188,6 +188,20 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    Array1D<Type>::
+    Array1D(ArrayExpression<Derived> const& expression)
+      : m_size(0),          // This will be set in the call to allocate().
+        m_dataPtr(0),       // This will be set in the call to allocate().
+        m_referenceCount(0) // This will be set in the call to allocate().
+    {
+      static_assert(Derived::dimension == 1,
+                    "Array1D can only be constructed from a 1D expression.");
+      this->allocate(expression.size());
+      expression.assignTo(m_dataPtr, m_size);
+    }
+
+
     template <class Type>
     Array1D<Type>::~Array1D()
     {
@@ -243,6 +257,25 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    void Array1D<Type>::
+    copy(ArrayExpression<Derived> const& expression)
+    {
+      static_assert(Derived::dimension == 1,
+                    "Array1D can only be assigned from a 1D expression.");
+      if(expression.size() != m_size) {
+        std::ostringstream message;
+        message << "Mismatched array sizes. Expression has "
+                << expression.size() << " elements, while destination array has "
+                << m_size << " elements.";
+        BRICK_THROW(common::ValueException,
+                    "Array1D::copy(const ArrayExpression&)",
+                    message.str().c_str());
+      }
+      expression.assignTo(m_dataPtr, m_size);
+    }
+
+
     template <class Type> template <class Type2>
     void
     Array1D<Type>::
@@ -381,6 +414,18 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    Array1D<Type>& Array1D<Type>::
+    operator=(ArrayExpression<Derived> const& expression)
+    {
+      // Evaluate before rebinding, so that expressions which refer to
+      // *this see the original data.
+      Array1D<Type> result(expression);
+      *this = result;
+      return *this;
+    }
+
+
     template <class Type> template <class Type2>
     Array1D<Type>&
     Array1D<Type>::
@@ -442,6 +487,48 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    Array1D<Type>&
+    Array1D<Type>::
+    operator+=(ArrayExpression<Derived> const& expression)
+    {
+      static_assert(Derived::dimension == 1,
+                    "Array1D can only be combined with a 1D expression.");
+      if(m_size != expression.size()) {
+        std::ostringstream message;
+        message << "Mismatched array sizes. Expression has "
+                << expression.size() << " elements, while destination array has "
+                << m_size << " elements.";
+        BRICK_THROW(common::ValueException,
+                    "Array1D::operator+=(const ArrayExpression&)",
+                    message.str().c_str());
+      }
+      expression.addTo(m_dataPtr, m_size);
+      return *this;
+    }
+
+
+    template <class Type> template <class Derived>
+    Array1D<Type>&
+    Array1D<Type>::
+    operator-=(ArrayExpression<Derived> const& expression)
+    {
+      static_assert(Derived::dimension == 1,
+                    "Array1D can only be combined with a 1D expression.");
+      if(m_size != expression.size()) {
+        std::ostringstream message;
+        message << "Mismatched array sizes. Expression has "
+                << expression.size() << " elements, while destination array has "
+                << m_size << " elements.";
+        BRICK_THROW(common::ValueException,
+                    "Array1D::operator-=(const ArrayExpression&)",
+                    message.str().c_str());
+      }
+      expression.subtractFrom(m_dataPtr, m_size);
+      return *this;
+    }
+
+
     template <class Type> template <class Type2>
     Array1D<Type>&
     Array1D<Type>::
@@ -573,13 +660,12 @@ namespace brick {
     void Array1D<Type>::
     deAllocate()
     {
-      // Are we responsible for deallocating the contents of this array?
-      if(m_referenceCount.isCounted()) {
-        // If yes, are we currently the only array pointing to this data?
-        if(!m_referenceCount.isShared()) {
-          // If yes, then delete the data.
-          delete[] m_dataPtr;
-        }
+      // Delete the contents of this array if we're responsible for
+      // them, and no other array is pointing to this data.  Checking
+      // and releasing in one step keeps this safe when copies are
+      // being destroyed in other threads.
+      if(m_referenceCount.release()) {
+        delete[] m_dataPtr;
       }
       // Abandon our pointers to data.  Reference would take care of
       // itself, but it's cleaner conceptually to wipe it here, rather
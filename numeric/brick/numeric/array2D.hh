@@ -25,6 +25,11 @@ namespace brick {
 
   namespace numeric {
 
+    // Forward declaration of the base class for lazy array
+    // expressions.  See arrayExpression.hh.
+    template <class Derived> class ArrayExpression;
+
+
     /**
      ** The Array2D class template represents a 2D array of arbitrary type.
      ** This class has internal reference counting.
@@ -250,6 +255,22 @@ namespace brick {
       Array2D(std::initializer_list< std::initializer_list<Type> > initializer);
 
 
+      /**
+       * Construct an array by evaluating a lazy array expression.
+       * This constructor is deliberately not explicit, so that the
+       * result of an expression built using lazy() can be bound
+       * directly to a named array.  The newly allocated array is
+       * contiguous, regardless of the row steps of the operands.
+       * Please see the documentation of class ArrayExpression for
+       * details.
+       *
+       * @param expression This argument is the expression to be
+       * evaluated.
+       */
+      template <class Derived>
+      Array2D(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Destroys the Array2D instance and deletes the internal data
        * store if no remaining arrays point to it.
@@ -332,6 +353,20 @@ namespace brick {
       copy(const Array2D<Type2>& source);
 
 
+      /**
+       * Evaluates a lazy array expression, writing the result into
+       * the existing storage of *this.  No memory is allocated.
+       * Unlike copy(const Array2D&), the expression must have exactly
+       * the same number of rows and columns as *this.
+       *
+       * @param expression The expression to be evaluated.
+       *
+       * @exception ValueException thrown when array shapes differ.
+       */
+      template <class Derived> void
+      copy(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Copies elements from dataPtr.  There must be valid data at all
        * addresses from dataPtr to (dataPtr + this->size());
@@ -1073,7 +1108,10 @@ namespace brick {
 
       /**
        * Compute matrix transpose.  The resulting array does not
-       * reference the same memory as *this.
+       * reference the same memory as *this.  The copy is done by
+       * recursively dividing the array into blocks small enough to
+       * stay in cache, so large arrays don't thrash the cache or the
+       * TLB.
        *
        * @return Transposed copy of *this.
        */
@@ -1081,6 +1119,19 @@ namespace brick {
       transpose() const;
 
 
+      /**
+       * Transpose a square array in place, without allocating any
+       * memory.  As with transpose(), the work is done in cache-sized
+       * blocks.  Note that other Array2D instances that share data
+       * with *this will also see the transposed values.
+       *
+       * @throw ValueException This exception is thrown if *this is
+       * not square.
+       */
+      void
+      transposeInPlace();
+
+
       /**
        * Assignment operator shallow copies the contents of source.
        * After the copy, both arrays reference the same data.
@@ -1104,6 +1155,22 @@ namespace brick {
       operator=(Type value);
 
 
+      /**
+       * Evaluates a lazy array expression into newly allocated
+       * memory, and then makes *this refer to the result.  Consistent
+       * with operator=(const Array2D&), any other arrays that shared
+       * data with *this are unaffected.  If you want to overwrite the
+       * existing data instead, use copy(ArrayExpression const&).
+       *
+       * @param expression The expression to be evaluated.
+       *
+       * @return Reference to *this.
+       */
+      template <class Derived>
+      Array2D<Type>&
+      operator=(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Returns the (index)th element of the array by reference.
        * Elements are indexed in row-major order.
@@ -1217,6 +1284,36 @@ namespace brick {
       operator-=(const Array2D<Type2>& arg);
 
 
+      /**
+       * Evaluates a lazy array expression, adding each element of
+       * the result to the corresponding element of *this.  No
+       * temporary array is allocated.
+       *
+       * @param expression The expression to be added.
+       *
+       * @exception ValueException thrown when array shapes differ.
+       *
+       * @return Reference to *this.
+       */
+      template <class Derived> Array2D<Type>&
+      operator+=(ArrayExpression<Derived> const& expression);
+
+
+      /**
+       * Evaluates a lazy array expression, subtracting each element
+       * of the result from the corresponding element of *this.  No
+       * temporary array is allocated.
+       *
+       * @param expression The expression to be subtracted.
+       *
+       * @exception ValueException thrown when array shapes differ.
+       *
+       * @return Reference to *this.
+       */
+      template <class Derived> Array2D<Type>&
+      operator-=(ArrayExpression<Derived> const& expression);
+
+
       /**
        * Multiplies each element of *this by the value of the
        * corresponding element of arg.
@@ -0,0 +1,326 @@
+/**
+***************************************************************************
+* @file brick/numeric/array2DView.hh
+*
+* Header file declaring the Array2DView class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_ARRAY2DVIEW_HH
+#define BRICK_NUMERIC_ARRAY2DVIEW_HH
+
+#include <cstddef>
+#include <type_traits>
+#include <brick/numeric/array2D.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** The Array2DView class template provides zero-copy access to a
+     ** 2D block of memory using arbitrary row and column strides.
+     ** Swapping the strides gives a transposed view, and setting the
+     ** number of columns to one gives a view of a single column, all
+     ** without copying any data.  Use Array2DView<Type const> for
+     ** read-only access.
+     **
+     ** Array2DView does not own or reference count the memory it
+     ** refers to, so a view is valid only as long as the underlying
+     ** array is valid.  It is intended to be passed to functions,
+     ** rather than stored.
+     **
+     ** Here's an example of how you might use this class:
+     **
+     ** @code
+     **   Array2D<float> image(rows, columns);
+     **   Array2DView<float> view(image);
+     **   Array2DView<float> transposed = view.transpose();
+     **
+     **   // transposed(cc, rr) refers to the same memory as image(rr, cc).
+     **   Array2DView<float const> column = view.getColumn(5);
+     ** @endcode
+     **/
+    template <class Type>
+    class Array2DView {
+    public:
+
+      /* ======== Public typedefs ======== */
+
+      /**
+       * Typedef for the element type, without any const qualifier.
+       */
+      typedef typename std::remove_const<Type>::type value_type;
+
+
+      /* ======== Public member functions ======== */
+
+      /**
+       * The default constructor creates an empty view.
+       */
+      Array2DView();
+
+
+      /**
+       * This constructor creates a view of arbitrary memory.
+       *
+       * @param dataPtr This argument points to element (0, 0) of the
+       * view.
+       *
+       * @param rows This argument specifies the number of rows in
+       * the view.
+       *
+       * @param columns This argument specifies the number of columns
+       * in the view.
+       *
+       * @param rowStride This argument specifies the distance, in
+       * elements, between element (r, c) and element (r + 1, c).
+       *
+       * @param columnStride This argument specifies the distance, in
+       * elements, between element (r, c) and element (r, c + 1).
+       */
+      Array2DView(Type* dataPtr, std::size_t rows, std::size_t columns,
+                  std::ptrdiff_t rowStride, std::ptrdiff_t columnStride);
+
+
+      /**
+       * This constructor creates a view of an Array2D instance.
+       *
+       * @param array This argument is the array to be viewed.
+       */
+      explicit
+      Array2DView(Array2D<value_type>& array);
+
+
+      /**
+       * This constructor creates a read-only view of an Array2D
+       * instance.  It can only be used if Type is const qualified.
+       *
+       * @param array This argument is the array to be viewed.
+       */
+      explicit
+      Array2DView(Array2D<value_type> const& array);
+
+
+      /**
+       * Converts a mutable view to a read-only view.
+       *
+       * @param other This argument is the view to be copied.
+       */
+      template <class OtherType>
+      Array2DView(Array2DView<OtherType> const& other);
+
+
+      /**
+       * This member function returns the number of columns in the
+       * view.
+       *
+       * @return The return value is the number of columns.
+       */
+      std::size_t
+      columns() const {return m_columns;}
+
+
+      /**
+       * This member function copies the viewed elements into a new,
+       * contiguous Array2D.  Column-major and transposed views are
+       * copied in cache-sized blocks, so this is an efficient way
+       * to materialize a transpose.
+       *
+       * @return The return value is a row-major array with the same
+       * shape and contents as the view.
+       */
+      Array2D<value_type>
+      copy() const;
+
+
+      /**
+       * This member function copies the viewed elements into an
+       * existing Array2D, which must already have the right shape.
+       *
+       * @param destination This argument is the array into which to
+       * copy.
+       */
+      void
+      copyTo(Array2D<value_type>& destination) const;
+
+
+      /**
+       * This member function returns a pointer to element (0, 0).
+       *
+       * @return The return value points to the first element.
+       */
+      Type*
+      data() const {return m_dataPtr;}
+
+
+      /**
+       * This member function returns a view of one column of *this.
+       *
+       * @param index This argument specifies which column.
+       *
+       * @return The return value is a view with one column.
+       */
+      Array2DView<Type>
+      getColumn(std::size_t index) const;
+
+
+      /**
+       * This member function returns the distance, in elements,
+       * between adjacent columns.
+       *
+       * @return The return value is the column stride.
+       */
+      std::ptrdiff_t
+      getColumnStride() const {return m_columnStride;}
+
+
+      /**
+       * This member function returns a view of a rectangular region
+       * of *this.
+       *
+       * @param row This argument is the first row of the region.
+       *
+       * @param column This argument is the first column of the
+       * region.
+       *
+       * @param rows This argument is the number of rows in the
+       * region.
+       *
+       * @param columns This argument is the number of columns in the
+       * region.
+       *
+       * @return The return value is a view of the region.
+       */
+      Array2DView<Type>
+      getRegion(std::size_t row, std::size_t column,
+                std::size_t rows, std::size_t columns) const;
+
+
+      /**
+       * This member function returns a view of one row of *this.
+       *
+       * @param index This argument specifies which row.
+       *
+       * @return The return value is a view with one row.
+       */
+      Array2DView<Type>
+      getRow(std::size_t index) const;
+
+
+      /**
+       * This member function returns the distance, in elements,
+       * between adjacent rows.
+       *
+       * @return The return value is the row stride.
+       */
+      std::ptrdiff_t
+      getRowStride() const {return m_rowStride;}
+
+
+      /**
+       * This member function indicates whether the view is laid out
+       * in column-major order, as expected by LAPACK and BLAS.  That
+       * is, elements in each column are adjacent, and the column
+       * stride is at least the number of rows.  If so,
+       * getColumnStride() is the "leading dimension" argument
+       * LAPACK routines expect.
+       *
+       * @return The return value is true if the view is column-major.
+       */
+      bool
+      isColumnMajor() const {
+        return ((m_rowStride == 1 || m_rows <= 1)
+                && (m_columnStride >= static_cast<std::ptrdiff_t>(m_rows)
+                    || m_columns <= 1));
+      }
+
+
+      /**
+       * This member function indicates whether the view is laid out
+       * in row-major order, like Array2D.  That is, elements in each
+       * row are adjacent, and the row stride is at least the number
+       * of columns.
+       *
+       * @return The return value is true if the view is row-major.
+       */
+      bool
+      isRowMajor() const {
+        return ((m_columnStride == 1 || m_columns <= 1)
+                && (m_rowStride >= static_cast<std::ptrdiff_t>(m_columns)
+                    || m_rows <= 1));
+      }
+
+
+      /**
+       * This member function returns the number of rows in the view.
+       *
+       * @return The return value is the number of rows.
+       */
+      std::size_t
+      rows() const {return m_rows;}
+
+
+      /**
+       * This member function returns the number of elements in the
+       * view.
+       *
+       * @return The return value is rows() * columns().
+       */
+      std::size_t
+      size() const {return m_rows * m_columns;}
+
+
+      /**
+       * This member function returns a transposed view of the same
+       * memory.  No data is copied.
+       *
+       * @return The return value is a view with rows and columns
+       * exchanged.
+       */
+      Array2DView<Type>
+      transpose() const {
+        return Array2DView<Type>(
+          m_dataPtr, m_columns, m_rows, m_columnStride, m_rowStride);
+      }
+
+
+      /**
+       * This operator returns a reference to the specified element.
+       *
+       * @param row This argument specifies the row.
+       *
+       * @param column This argument specifies the column.
+       *
+       * @return The return value is a reference to the element.
+       */
+      Type&
+      operator()(std::size_t row, std::size_t column) const {
+        return m_dataPtr[static_cast<std::ptrdiff_t>(row) * m_rowStride
+                         + static_cast<std::ptrdiff_t>(column)
+                         * m_columnStride];
+      }
+
+    private:
+
+      Type* m_dataPtr;
+      std::size_t m_rows;
+      std::size_t m_columns;
+      std::ptrdiff_t m_rowStride;
+      std::ptrdiff_t m_columnStride;
+
+    };
+
+  } // namespace numeric
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/array2DView_impl.hh>
+
+#endif /* #ifndef BRICK_NUMERIC_ARRAY2DVIEW_HH */
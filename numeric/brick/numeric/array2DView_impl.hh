@@ -0,0 +1,188 @@
+/**
+***************************************************************************
+* @file brick/numeric/array2DView_impl.hh
+*
+* Header file defining inline and template functions declared in
+* array2DView.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_ARRAY2DVIEW_IMPL_HH
+#define BRICK_NUMERIC_ARRAY2DVIEW_IMPL_HH
+
+// This file is included by array2DView.hh, and should not be directly
+// included by user code, so no need to include array2DView.hh here.
+//
+// #include <brick/numeric/array2DView.hh>
+
+#include <sstream>
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    // The default constructor creates an empty view.
+    template <class Type>
+    Array2DView<Type>::
+    Array2DView()
+      : m_dataPtr(0),
+        m_rows(0),
+        m_columns(0),
+        m_rowStride(0),
+        m_columnStride(1)
+    {
+      // Empty.
+    }
+
+
+    // This constructor creates a view of arbitrary memory.
+    template <class Type>
+    Array2DView<Type>::
+    Array2DView(Type* dataPtr, std::size_t rows, std::size_t columns,
+                std::ptrdiff_t rowStride, std::ptrdiff_t columnStride)
+      : m_dataPtr(dataPtr),
+        m_rows(rows),
+        m_columns(columns),
+        m_rowStride(rowStride),
+        m_columnStride(columnStride)
+    {
+      // Empty.
+    }
+
+
+    // This constructor creates a view of an Array2D instance.
+    template <class Type>
+    Array2DView<Type>::
+    Array2DView(Array2D<value_type>& array)
+      : m_dataPtr(array.data()),
+        m_rows(array.rows()),
+        m_columns(array.columns()),
+        m_rowStride(static_cast<std::ptrdiff_t>(array.getRowStep())),
+        m_columnStride(1)
+    {
+      // Empty.
+    }
+
+
+    // This constructor creates a read-only view of an Array2D
+    // instance.
+    template <class Type>
+    Array2DView<Type>::
+    Array2DView(Array2D<value_type> const& array)
+      : m_dataPtr(array.data()),
+        m_rows(array.rows()),
+        m_columns(array.columns()),
+        m_rowStride(static_cast<std::ptrdiff_t>(array.getRowStep())),
+        m_columnStride(1)
+    {
+      static_assert(std::is_const<Type>::value,
+                    "Only Array2DView<Type const> can view a const Array2D.");
+    }
+
+
+    // Converts a mutable view to a read-only view.
+    template <class Type>
+    template <class OtherType>
+    Array2DView<Type>::
+    Array2DView(Array2DView<OtherType> const& other)
+      : m_dataPtr(other.data()),
+        m_rows(other.rows()),
+        m_columns(other.columns()),
+        m_rowStride(other.getRowStride()),
+        m_columnStride(other.getColumnStride())
+    {
+      // Empty.
+    }
+
+
+    // This member function copies the viewed elements into a new,
+    // contiguous Array2D.
+    template <class Type>
+    Array2D<typename Array2DView<Type>::value_type>
+    Array2DView<Type>::
+    copy() const
+    {
+      Array2D<value_type> result(m_rows, m_columns);
+      this->copyTo(result);
+      return result;
+    }
+
+
+    // This member function copies the viewed elements into an
+    // existing Array2D.
+    template <class Type>
+    void
+    Array2DView<Type>::
+    copyTo(Array2D<value_type>& destination) const
+    {
+      if(destination.rows() != m_rows || destination.columns() != m_columns) {
+        std::ostringstream message;
+        message << "Destination array has shape (" << destination.rows()
+                << ", " << destination.columns() << "), but view has shape ("
+                << m_rows << ", " << m_columns << ").";
+        BRICK_THROW(common::ValueException, "Array2DView::copyTo()",
+                    message.str().c_str());
+      }
+      if(this->size() == 0) {
+        return;
+      }
+      privateCode::copyStridedBlock(
+        m_dataPtr, m_rowStride, m_columnStride, destination.data(),
+        static_cast<std::ptrdiff_t>(destination.getRowStep()), 1,
+        m_rows, m_columns);
+    }
+
+
+    // This member function returns a view of one column of *this.
+    template <class Type>
+    Array2DView<Type>
+    Array2DView<Type>::
+    getColumn(std::size_t index) const
+    {
+      return this->getRegion(0, index, m_rows, 1);
+    }
+
+
+    // This member function returns a view of a rectangular region of
+    // *this.
+    template <class Type>
+    Array2DView<Type>
+    Array2DView<Type>::
+    getRegion(std::size_t row, std::size_t column,
+              std::size_t rows, std::size_t columns) const
+    {
+      if(row + rows > m_rows || column + columns > m_columns) {
+        std::ostringstream message;
+        message << "Region (" << row << ", " << column << ") + ("
+                << rows << ", " << columns << ") doesn't fit in a view "
+                << "with shape (" << m_rows << ", " << m_columns << ").";
+        BRICK_THROW(common::IndexException, "Array2DView::getRegion()",
+                    message.str().c_str());
+      }
+      Type* dataPtr = (m_dataPtr
+                       + static_cast<std::ptrdiff_t>(row) * m_rowStride
+                       + static_cast<std::ptrdiff_t>(column) * m_columnStride);
+      return Array2DView<Type>(dataPtr, rows, columns,
+                               m_rowStride, m_columnStride);
+    }
+
+
+    // This member function returns a view of one row of *this.
+    template <class Type>
+    Array2DView<Type>
+    Array2DView<Type>::
+    getRow(std::size_t index) const
+    {
+      return this->getRegion(index, 0, 1, m_columns);
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_ARRAY2DVIEW_IMPL_HH */
@@ -19,6 +19,7 @@
 // #include <brick/numeric/array2D.hh>
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <sstream>
 #include <vector>
@@ -31,6 +32,149 @@ namespace brick {
 
   namespace numeric {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Blocks at or below this many elements on a side are copied
+      // directly.  A 32x32 block of doubles is 8K for the source and
+      // 8K for the destination, which fits comfortably in L1.
+      const size_t transposeBlockSize = 32;
+
+
+      // Copy a rows x columns block, addressing each element of the
+      // source and destination using separate row and column
+      // strides.  Setting the destination strides to (1, N) rather
+      // than (N, 1) makes this a transpose.  We recursively halve the
+      // larger dimension until the block fits in cache, so the access
+      // pattern works well at every level of the memory hierarchy
+      // without any tuning for a particular machine.
+      template <class Type0, class Type1>
+      void
+      copyStridedBlock(Type0 const* source,
+                       std::ptrdiff_t sourceRowStride,
+                       std::ptrdiff_t sourceColumnStride,
+                       Type1* destination,
+                       std::ptrdiff_t destinationRowStride,
+                       std::ptrdiff_t destinationColumnStride,
+                       size_t rows, size_t columns)
+      {
+        if(rows > transposeBlockSize || columns > transposeBlockSize) {
+          if(rows >= columns) {
+            size_t const half = rows / 2;
+            std::ptrdiff_t const offset = static_cast<std::ptrdiff_t>(half);
+            copyStridedBlock(source, sourceRowStride, sourceColumnStride,
+                             destination, destinationRowStride,
+                             destinationColumnStride, half, columns);
+            copyStridedBlock(source + offset * sourceRowStride,
+                             sourceRowStride, sourceColumnStride,
+                             destination + offset * destinationRowStride,
+                             destinationRowStride, destinationColumnStride,
+                             rows - half, columns);
+          } else {
+            size_t const half = columns / 2;
+            std::ptrdiff_t const offset = static_cast<std::ptrdiff_t>(half);
+            copyStridedBlock(source, sourceRowStride, sourceColumnStride,
+                             destination, destinationRowStride,
+                             destinationColumnStride, rows, half);
+            copyStridedBlock(source + offset * sourceColumnStride,
+                             sourceRowStride, sourceColumnStride,
+                             destination + offset * destinationColumnStride,
+                             destinationRowStride, destinationColumnStride,
+                             rows, columns - half);
+          }
+          return;
+        }
+
+        // Within a block, run the inner loop along rows if either
+        // side is contiguous in that direction, and along columns
+        // otherwise.
+        std::ptrdiff_t const numberOfRows = static_cast<std::ptrdiff_t>(rows);
+        std::ptrdiff_t const numberOfColumns =
+          static_cast<std::ptrdiff_t>(columns);
+        if(destinationColumnStride == 1 || sourceColumnStride == 1) {
+          for(std::ptrdiff_t row = 0; row < numberOfRows; ++row) {
+            Type0 const* sourcePtr = source + row * sourceRowStride;
+            Type1* destinationPtr = destination + row * destinationRowStride;
+            for(std::ptrdiff_t column = 0; column < numberOfColumns;
+                ++column) {
+              destinationPtr[column * destinationColumnStride] =
+                static_cast<Type1>(sourcePtr[column * sourceColumnStride]);
+            }
+          }
+        } else {
+          for(std::ptrdiff_t column = 0; column < numberOfColumns; ++column) {
+            Type0 const* sourcePtr = source + column * sourceColumnStride;
+            Type1* destinationPtr =
+              destination + column * destinationColumnStride;
+            for(std::ptrdiff_t row = 0; row < numberOfRows; ++row) {
+              destinationPtr[row * destinationRowStride] =
+                static_cast<Type1>(sourcePtr[row * sourceRowStride]);
+            }
+          }
+        }
+      }
+
+
+      // Exchange the rows x columns block at block0 with the
+      // transpose of the columns x rows block at block1.  Both
+      // blocks are part of the same array, and must not overlap.
+      template <class Type>
+      void
+      swapTransposedBlocks(Type* block0, Type* block1, size_t rowStep,
+                           size_t rows, size_t columns)
+      {
+        if(rows > transposeBlockSize || columns > transposeBlockSize) {
+          if(rows >= columns) {
+            size_t const half = rows / 2;
+            swapTransposedBlocks(block0, block1, rowStep, half, columns);
+            swapTransposedBlocks(block0 + half * rowStep, block1 + half,
+                                 rowStep, rows - half, columns);
+          } else {
+            size_t const half = columns / 2;
+            swapTransposedBlocks(block0, block1, rowStep, rows, half);
+            swapTransposedBlocks(block0 + half, block1 + half * rowStep,
+                                 rowStep, rows, columns - half);
+          }
+          return;
+        }
+        for(size_t row = 0; row < rows; ++row) {
+          Type* ptr0 = block0 + row * rowStep;
+          Type* ptr1 = block1 + row;
+          for(size_t column = 0; column < columns; ++column) {
+            std::swap(ptr0[column], ptr1[column * rowStep]);
+          }
+        }
+      }
+
+
+      // Transpose the size x size block at data in place by
+      // transposing the two diagonal quadrants, and swapping the
+      // off-diagonal quadrants.
+      template <class Type>
+      void
+      transposeSquareBlock(Type* data, size_t rowStep, size_t size)
+      {
+        if(size > transposeBlockSize) {
+          size_t const half = size / 2;
+          transposeSquareBlock(data, rowStep, half);
+          transposeSquareBlock(data + half * rowStep + half, rowStep,
+                               size - half);
+          swapTransposedBlocks(data + half, data + half * rowStep, rowStep,
+                               half, size - half);
+          return;
+        }
+        for(size_t row = 1; row < size; ++row) {
+          Type* rowPtr = data + row * rowStep;
+          for(size_t column = 0; column < row; ++column) {
+            std::swap(rowPtr[column], data[column * rowStep + row]);
+          }
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
     // Static constant describing how the string representation of an
     // Array2D should start.
     template <class Type>
@@ -229,6 +373,25 @@ namespace brick {
     }
 
 
+    // Construct an array by evaluating an expression.
+    template <class Type> template <class Derived>
+    Array2D<Type>::
+    Array2D(ArrayExpression<Derived> const& expression)
+      : m_rows(0),
+        m_columns(0),
+        m_rowStep(0),
+        m_size(0),           // This will be set in the call to allocate().
+        m_storageSize(0),    // This will be set in the call to allocate().
+        m_dataPtr(0),        // This will be set in the call to allocate().
+        m_referenceCount(0)  // This will be set in the call to allocate().
+    {
+      static_assert(Derived::dimension == 2,
+                    "Array2D can only be constructed from a 2D expression.");
+      this->allocate(expression.rows(), expression.columns());
+      expression.assignTo(m_dataPtr, m_rowStep);
+    }
+
+
     // Construct an array using an initializer list.
     template <class Type>
     Array2D<Type>::
@@ -341,6 +504,25 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    void Array2D<Type>::
+    copy(ArrayExpression<Derived> const& expression)
+    {
+      static_assert(Derived::dimension == 2,
+                    "Array2D can only be assigned from a 2D expression.");
+      if(expression.rows() != m_rows || expression.columns() != m_columns) {
+        std::ostringstream message;
+        message << "Mismatched array shapes. Expression is "
+                << expression.rows() << " x " << expression.columns()
+                << ", while destination array is "
+                << m_rows << " x " << m_columns << ".";
+        BRICK_THROW(common::ValueException, "Array2D::copy(const ArrayExpression&)",
+                    message.str().c_str());
+      }
+      expression.assignTo(m_dataPtr, m_rowStep);
+    }
+
+
     template <class Type> template <class Type2>
     void Array2D<Type>::
     copy(const Type2* dataPtr)
@@ -554,8 +736,9 @@ namespace brick {
     void Array2D<Type>::
     reinitIfNecessary(size_t arrayRows, size_t arrayColumns, size_t rowStep)
     {
-      if(this->getStorageSize()
-         != this->getStorageSize(arrayRows, arrayColumns, rowStep)) {
+      size_t requiredStorageSize =
+        arrayRows * (rowStep != 0 ? rowStep : arrayColumns);
+      if(this->getStorageSize() != requiredStorageSize) {
         this->reinit(arrayRows, arrayColumns, rowStep);
       } else {
         if((this->rows() != arrayRows)
@@ -674,6 +857,18 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    Array2D<Type>& Array2D<Type>::
+    operator=(ArrayExpression<Derived> const& expression)
+    {
+      // Evaluate before rebinding, so that expressions which refer to
+      // *this see the original data.
+      Array2D<Type> result(expression);
+      *this = result;
+      return *this;
+    }
+
+
     template <class Type> template <class Type2>
     Array2D<Type>&
     Array2D<Type>::
@@ -726,6 +921,48 @@ namespace brick {
     }
 
 
+    template <class Type> template <class Derived>
+    Array2D<Type>&
+    Array2D<Type>::
+    operator+=(ArrayExpression<Derived> const& expression)
+    {
+      static_assert(Derived::dimension == 2,
+                    "Array2D can only be combined with a 2D expression.");
+      if(expression.rows() != m_rows || expression.columns() != m_columns) {
+        std::ostringstream message;
+        message << "Mismatched array shapes. Expression is "
+                << expression.rows() << " x " << expression.columns()
+                << ", while destination array is "
+                << m_rows << " x " << m_columns << ".";
+        BRICK_THROW(common::ValueException, "Array2D::operator+=(const ArrayExpression&)",
+                    message.str().c_str());
+      }
+      expression.addTo(m_dataPtr, m_rowStep);
+      return *this;
+    }
+
+
+    template <class Type> template <class Derived>
+    Array2D<Type>&
+    Array2D<Type>::
+    operator-=(ArrayExpression<Derived> const& expression)
+    {
+      static_assert(Derived::dimension == 2,
+                    "Array2D can only be combined with a 2D expression.");
+      if(expression.rows() != m_rows || expression.columns() != m_columns) {
+        std::ostringstream message;
+        message << "Mismatched array shapes. Expression is "
+                << expression.rows() << " x " << expression.columns()
+                << ", while destination array is "
+                << m_rows << " x " << m_columns << ".";
+        BRICK_THROW(common::ValueException, "Array2D::operator-=(const ArrayExpression&)",
+                    message.str().c_str());
+      }
+      expression.subtractFrom(m_dataPtr, m_rowStep);
+      return *this;
+    }
+
+
     template <class Type> template <class Type2>
     Array2D<Type>&
     Array2D<Type>::
@@ -875,22 +1112,31 @@ namespace brick {
     transpose() const
     {
       Array2D<Type> newMx(m_columns, m_rows);
-
-      // Waiting for row & column iterators
-      Type *tPtr0 = newMx.m_dataPtr;
-      for(size_t j = 0; j < m_columns; ++j) {
-        // const Type *tPtr1 = this->data(0, j);
-        const Type *tPtr1 = this->data(j);
-        for(size_t ii = 0; ii < m_rows; ++ii) {
-          *tPtr0 = *tPtr1;
-          ++tPtr0;
-          tPtr1 += m_rowStep;
-        }
+      if(newMx.size() != 0) {
+        privateCode::copyStridedBlock(
+          m_dataPtr, static_cast<std::ptrdiff_t>(m_rowStep), 1,
+          newMx.m_dataPtr, 1, static_cast<std::ptrdiff_t>(newMx.m_rowStep),
+          m_rows, m_columns);
       }
       return newMx;
     }
 
 
+    template <class Type>
+    void Array2D<Type>::
+    transposeInPlace()
+    {
+      if(m_rows != m_columns) {
+        std::ostringstream message;
+        message << "Can't transpose a " << m_rows << " x " << m_columns
+                << " array in place.  The array must be square.";
+        BRICK_THROW(common::ValueException, "Array2D::transposeInPlace()",
+                    message.str().c_str());
+      }
+      privateCode::transposeSquareBlock(m_dataPtr, m_rowStep, m_rows);
+    }
+
+
     template <class Type>
     void Array2D<Type>::
     allocate(size_t arrayRows, size_t arrayColumns, size_t rowStep)
@@ -975,13 +1221,12 @@ namespace brick {
     void Array2D<Type>::
     deAllocate()
     {
-      // Are we responsible for deallocating the contents of this array?
-      if(m_referenceCount.isCounted()) {
-        // If yes, are we currently the only array pointing to this data?
-        if(!m_referenceCount.isShared()) {
-          // If yes, then delete the data.
-          delete[] m_dataPtr;
-        }
+      // Delete the contents of this array if we're responsible for
+      // them, and no other array is pointing to this data.  Checking
+      // and releasing in one step keeps this safe when copies are
+      // being destroyed in other threads.
+      if(m_referenceCount.release()) {
+        delete[] m_dataPtr;
       }
       // Abandon our pointers to data.  Reference would take care of
       // itself, but it's cleaner conceptually to wipe it here, rather
@@ -0,0 +1,341 @@
+/**
+***************************************************************************
+* @file brick/numeric/arrayExpression.hh
+*
+* Header file declaring expression templates that let elementwise
+* Array1D and Array2D arithmetic be evaluated lazily, in a single
+* pass, without allocating temporary arrays.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_ARRAYEXPRESSION_HH
+#define BRICK_NUMERIC_ARRAYEXPRESSION_HH
+
+#include <cstddef>
+#include <brick/numeric/array1D.hh>
+#include <brick/numeric/array2D.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** This class template is the common base of all lazily
+     ** evaluated array expressions.  You will rarely name it
+     ** directly.  Instead, wrap an array in a call to lazy(), and
+     ** combine the result with other arrays and scalars using the
+     ** usual arithmetic operators:
+     **
+     ** @code
+     **   Array1D<double> residual = lazy(aa) * scale + bb - cc;
+     ** @endcode
+     **
+     ** The expression on the right hand side of this example builds
+     ** a small tree of nodes that refer to aa, bb, and cc, and
+     ** nothing is computed until the tree is assigned to an array.
+     ** At that point, a single loop allocates one output array and
+     ** fills it, rather than making three temporary arrays and three
+     ** passes through memory the way the eager operators declared in
+     ** array1D.hh do.
+     **
+     ** Expressions may also be evaluated in place using
+     ** Array1D::copy(), Array1D::operator+=(), and
+     ** Array1D::operator-=() (and their Array2D counterparts), which
+     ** allocate no memory at all, or explicitly using eval().
+     **
+     ** Expression nodes hold pointers to the data of the arrays they
+     ** refer to, so an expression must not outlive its operands.  In
+     ** practice, this means you should evaluate an expression in the
+     ** same statement that creates it, and should not store one in
+     ** an "auto" variable.
+     **
+     ** Operands must all have the same shape, and either all be
+     ** Array1D or all be Array2D.  As with the eager operators, a
+     ** ValueException is thrown if the shapes differ.
+     **/
+    template <class Derived>
+    class ArrayExpression {
+    public:
+
+      /**
+       * Returns a reference to the concrete expression, following
+       * the "curiously recurring template pattern."
+       *
+       * @return Reference to *this, cast to the derived type.
+       */
+      Derived const&
+      derived() const {return static_cast<Derived const&>(*this);}
+
+
+      /**
+       * Allocates a new array and evaluates the expression into it.
+       *
+       * @return An Array1D or Array2D, as appropriate, containing the
+       * value of the expression.
+       */
+      // Derived is incomplete when this class is instantiated, so
+      // the lookup of ResultType is deferred using a defaulted
+      // template parameter.
+      template <class Expression = Derived>
+      typename Expression::ResultType
+      eval() const {return typename Expression::ResultType(*this);}
+
+
+      /**
+       * Returns the number of rows in the result of the expression.
+       * For one dimensional expressions, this is always 1.
+       *
+       * @return The number of rows.
+       */
+      size_t
+      rows() const {return this->derived().rows();}
+
+
+      /**
+       * Returns the number of columns in the result of the
+       * expression.  For one dimensional expressions, this is the
+       * number of elements.
+       *
+       * @return The number of columns.
+       */
+      size_t
+      columns() const {return this->derived().columns();}
+
+
+      /**
+       * Returns the number of elements in the result of the
+       * expression.
+       *
+       * @return The number of elements, rows() * columns().
+       */
+      size_t
+      size() const {return this->rows() * this->columns();}
+
+
+      /**
+       * Evaluates the expression, writing the result into
+       * caller-supplied memory.  This is used by Array1D and Array2D,
+       * and there's normally no reason to call it directly.
+       *
+       * @param destination This argument points to the first element
+       * of the output.
+       *
+       * @param rowStep This argument is the distance, in elements,
+       * between the starts of successive output rows.  It is ignored
+       * for one dimensional expressions.
+       */
+      template <class Type>
+      void
+      assignTo(Type* destination, size_t rowStep) const;
+
+
+      /**
+       * Evaluates the expression, adding the result to the contents
+       * of caller-supplied memory.  This is used by
+       * Array1D::operator+=() and Array2D::operator+=().
+       *
+       * @param destination This argument points to the first element
+       * of the output.
+       *
+       * @param rowStep This argument is the distance, in elements,
+       * between the starts of successive output rows.
+       */
+      template <class Type>
+      void
+      addTo(Type* destination, size_t rowStep) const;
+
+
+      /**
+       * Evaluates the expression, subtracting the result from the
+       * contents of caller-supplied memory.  This is used by
+       * Array1D::operator-=() and Array2D::operator-=().
+       *
+       * @param destination This argument points to the first element
+       * of the output.
+       *
+       * @param rowStep This argument is the distance, in elements,
+       * between the starts of successive output rows.
+       */
+      template <class Type>
+      void
+      subtractFrom(Type* destination, size_t rowStep) const;
+
+    protected:
+
+      // Only derived classes may be instantiated.
+      ArrayExpression() {}
+    };
+
+
+    /**
+     ** Leaf node of an expression tree that refers to the elements
+     ** of an Array1D instance.  Created by lazy(Array1D const&).
+     **/
+    template <class Type>
+    class ArrayReference1D
+      : public ArrayExpression< ArrayReference1D<Type> > {
+    public:
+      typedef Type ValueType;
+      typedef Array1D<Type> ResultType;
+      static const size_t dimension = 1;
+
+      explicit
+      ArrayReference1D(Array1D<Type> const& array0)
+        : m_dataPtr(array0.data()), m_size(array0.size()) {}
+
+      size_t rows() const {return 1;}
+      size_t columns() const {return m_size;}
+      Type operator()(size_t /* row */, size_t column) const {
+        return m_dataPtr[column];
+      }
+
+    private:
+      Type const* m_dataPtr;
+      size_t m_size;
+    };
+
+
+    /**
+     ** Leaf node of an expression tree that refers to the elements
+     ** of an Array2D instance.  Created by lazy(Array2D const&).
+     **/
+    template <class Type>
+    class ArrayReference2D
+      : public ArrayExpression< ArrayReference2D<Type> > {
+    public:
+      typedef Type ValueType;
+      typedef Array2D<Type> ResultType;
+      static const size_t dimension = 2;
+
+      explicit
+      ArrayReference2D(Array2D<Type> const& array0)
+        : m_dataPtr(array0.data()), m_rows(array0.rows()),
+          m_columns(array0.columns()), m_rowStep(array0.getRowStep()) {}
+
+      size_t rows() const {return m_rows;}
+      size_t columns() const {return m_columns;}
+      Type operator()(size_t row, size_t column) const {
+        return m_dataPtr[row * m_rowStep + column];
+      }
+
+    private:
+      Type const* m_dataPtr;
+      size_t m_rows;
+      size_t m_columns;
+      size_t m_rowStep;
+    };
+
+
+    /**
+     ** Leaf node of an expression tree that represents a scalar
+     ** broadcast to every element.  Scalars have no shape of their
+     ** own, so this class does not derive from ArrayExpression.
+     **/
+    template <class Type>
+    class ScalarReference {
+    public:
+      typedef Type ValueType;
+
+      explicit
+      ScalarReference(Type value) : m_value(value) {}
+
+      Type operator()(size_t /* row */, size_t /* column */) const {
+        return m_value;
+      }
+
+    private:
+      Type m_value;
+    };
+
+
+    /**
+     ** Interior node of an expression tree that combines two
+     ** operands elementwise.  Operands are held by value, which is
+     ** cheap because every node is just a few pointers and sizes.
+     ** At least one operand must be an ArrayExpression.
+     **/
+    template <class Operation, class Left, class Right>
+    class BinaryArrayExpression
+      : public ArrayExpression< BinaryArrayExpression<Operation, Left, Right> > {
+    public:
+      typedef typename Operation::ValueType ValueType;
+      typedef typename Operation::ResultType ResultType;
+      static const size_t dimension = Operation::dimension;
+
+      BinaryArrayExpression(Left const& left, Right const& right);
+
+      size_t rows() const {return m_rows;}
+      size_t columns() const {return m_columns;}
+      ValueType operator()(size_t row, size_t column) const {
+        return Operation::apply(m_left(row, column), m_right(row, column));
+      }
+
+    private:
+      Left m_left;
+      Right m_right;
+      size_t m_rows;
+      size_t m_columns;
+    };
+
+
+    /**
+     * This function wraps an Array1D instance so that arithmetic
+     * involving it is evaluated lazily.  Please see the documentation
+     * of class ArrayExpression for details.
+     *
+     * @param array0 This argument is the array to be wrapped.  It
+     * must remain valid until the expression is evaluated.
+     *
+     * @return The return value is an expression node referring to
+     * array0.
+     */
+    template <class Type>
+    inline ArrayReference1D<Type>
+    lazy(Array1D<Type> const& array0) {return ArrayReference1D<Type>(array0);}
+
+
+    /**
+     * This function wraps an Array2D instance so that arithmetic
+     * involving it is evaluated lazily.  Please see the documentation
+     * of class ArrayExpression for details.
+     *
+     * @param array0 This argument is the array to be wrapped.  It
+     * must remain valid until the expression is evaluated.
+     *
+     * @return The return value is an expression node referring to
+     * array0.
+     */
+    template <class Type>
+    inline ArrayReference2D<Type>
+    lazy(Array2D<Type> const& array0) {return ArrayReference2D<Type>(array0);}
+
+
+    /**
+     * This function evaluates an array expression into a newly
+     * allocated array.  It is equivalent to expression.eval().
+     *
+     * @param expression This argument is the expression to be
+     * evaluated.
+     *
+     * @return The return value is an Array1D or Array2D, as
+     * appropriate, containing the value of the expression.
+     */
+    template <class Derived>
+    inline typename Derived::ResultType
+    eval(ArrayExpression<Derived> const& expression) {
+      return expression.eval();
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/arrayExpression_impl.hh>
+
+#endif /* #ifndef BRICK_NUMERIC_ARRAYEXPRESSION_HH */
@@ -0,0 +1,289 @@
+/**
+***************************************************************************
+* @file brick/numeric/arrayExpression_impl.hh
+*
+* Header file defining inline and template functions declared in
+* arrayExpression.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_ARRAYEXPRESSION_IMPL_HH
+#define BRICK_NUMERIC_ARRAYEXPRESSION_IMPL_HH
+
+// This file is included by arrayExpression.hh, and should not be
+// directly included by user code, so no need to include
+// arrayExpression.hh here.
+//
+// #include <brick/numeric/arrayExpression.hh>
+
+#include <sstream>
+#include <type_traits>
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Selects the array type that an expression of the specified
+      // dimension evaluates to.
+      template <class Type, size_t Dimension>
+      struct ExpressionResult {};
+
+      template <class Type>
+      struct ExpressionResult<Type, 1> {typedef Array1D<Type> type;};
+
+      template <class Type>
+      struct ExpressionResult<Type, 2> {typedef Array2D<Type> type;};
+
+
+      // Uniform access to the shape of an operand.  Scalars have
+      // dimension 0, and take their shape from the other operand.
+      template <class Operand>
+      struct ExpressionOperandTraits {
+        static const bool isArray = true;
+        static const size_t dimension = Operand::dimension;
+        static size_t rows(Operand const& operand) {return operand.rows();}
+        static size_t columns(Operand const& operand) {
+          return operand.columns();
+        }
+      };
+
+      template <class Type>
+      struct ExpressionOperandTraits< ScalarReference<Type> > {
+        static const bool isArray = false;
+        static const size_t dimension = 0;
+        static size_t rows(ScalarReference<Type> const&) {return 0;}
+        static size_t columns(ScalarReference<Type> const&) {return 0;}
+      };
+
+
+      // Elementwise operations.  Each one also carries the value
+      // type, result type, and dimension of the node it builds.
+#define BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATION(NAME, OPERATOR)        \
+      template <class Type, size_t Dimension>                           \
+      struct NAME {                                                     \
+        typedef Type ValueType;                                         \
+        typedef typename ExpressionResult<Type, Dimension>::type ResultType; \
+        static const size_t dimension = Dimension;                      \
+        static Type apply(Type const& arg0, Type const& arg1) {         \
+          return arg0 OPERATOR arg1;                                    \
+        }                                                               \
+      };
+
+      BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATION(ExpressionPlus, +)
+      BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATION(ExpressionMinus, -)
+      BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATION(ExpressionTimes, *)
+      BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATION(ExpressionDivides, /)
+
+#undef BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATION
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // Member functions of class ArrayExpression.
+
+    template <class Derived> template <class Type>
+    void
+    ArrayExpression<Derived>::
+    assignTo(Type* destination, size_t rowStep) const
+    {
+      Derived const& expression = this->derived();
+      size_t const numberOfRows = expression.rows();
+      size_t const numberOfColumns = expression.columns();
+      for(size_t row = 0; row < numberOfRows; ++row) {
+        Type* outputPtr = destination + row * rowStep;
+        for(size_t column = 0; column < numberOfColumns; ++column) {
+          outputPtr[column] = static_cast<Type>(expression(row, column));
+        }
+      }
+    }
+
+
+    template <class Derived> template <class Type>
+    void
+    ArrayExpression<Derived>::
+    addTo(Type* destination, size_t rowStep) const
+    {
+      Derived const& expression = this->derived();
+      size_t const numberOfRows = expression.rows();
+      size_t const numberOfColumns = expression.columns();
+      for(size_t row = 0; row < numberOfRows; ++row) {
+        Type* outputPtr = destination + row * rowStep;
+        for(size_t column = 0; column < numberOfColumns; ++column) {
+          outputPtr[column] += static_cast<Type>(expression(row, column));
+        }
+      }
+    }
+
+
+    template <class Derived> template <class Type>
+    void
+    ArrayExpression<Derived>::
+    subtractFrom(Type* destination, size_t rowStep) const
+    {
+      Derived const& expression = this->derived();
+      size_t const numberOfRows = expression.rows();
+      size_t const numberOfColumns = expression.columns();
+      for(size_t row = 0; row < numberOfRows; ++row) {
+        Type* outputPtr = destination + row * rowStep;
+        for(size_t column = 0; column < numberOfColumns; ++column) {
+          outputPtr[column] -= static_cast<Type>(expression(row, column));
+        }
+      }
+    }
+
+
+    // Member functions of class BinaryArrayExpression.
+
+    template <class Operation, class Left, class Right>
+    BinaryArrayExpression<Operation, Left, Right>::
+    BinaryArrayExpression(Left const& left, Right const& right)
+      : m_left(left),
+        m_right(right),
+        m_rows(0),
+        m_columns(0)
+    {
+      typedef privateCode::ExpressionOperandTraits<Left> LeftTraits;
+      typedef privateCode::ExpressionOperandTraits<Right> RightTraits;
+      static_assert(LeftTraits::isArray || RightTraits::isArray,
+                    "At least one operand must be an array expression.");
+      static_assert(!(LeftTraits::isArray && RightTraits::isArray)
+                    || (LeftTraits::dimension == RightTraits::dimension),
+                    "Can't mix Array1D and Array2D operands in one expression.");
+
+      if(LeftTraits::isArray) {
+        m_rows = LeftTraits::rows(m_left);
+        m_columns = LeftTraits::columns(m_left);
+        if(RightTraits::isArray
+           && (RightTraits::rows(m_right) != m_rows
+               || RightTraits::columns(m_right) != m_columns)) {
+          std::ostringstream message;
+          message << "Array sizes do not match.  Left operand is "
+                  << m_rows << " x " << m_columns
+                  << ", while right operand is "
+                  << RightTraits::rows(m_right) << " x "
+                  << RightTraits::columns(m_right) << ".";
+          BRICK_THROW(common::ValueException,
+                      "BinaryArrayExpression::BinaryArrayExpression()",
+                      message.str().c_str());
+        }
+      } else {
+        m_rows = RightTraits::rows(m_right);
+        m_columns = RightTraits::columns(m_right);
+      }
+    }
+
+
+    // Arithmetic operators.  For each of +, -, *, and /, we define
+    // overloads that combine two expressions, an expression and an
+    // array (in either order), and an expression and a scalar (in
+    // either order).  Plain array-array arithmetic is untouched, and
+    // continues to use the eager operators declared in array1D.hh
+    // and array2D.hh.  Scalars are taken as the (non-deduced) value
+    // type of the expression, so that "lazy(doubleArray) * 2" works
+    // as expected.
+#define BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATOR(OPERATOR, OPERATION)    \
+                                                                        \
+    template <class Left, class Right>                                  \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<typename Left::ValueType, Left::dimension>, \
+      Left, Right>                                                      \
+    operator OPERATOR(ArrayExpression<Left> const& left,                \
+                      ArrayExpression<Right> const& right)              \
+    {                                                                   \
+      static_assert(std::is_same<typename Left::ValueType,              \
+                                 typename Right::ValueType>::value,     \
+                    "Operands must have the same element type.");       \
+      return BinaryArrayExpression<                                     \
+        privateCode::OPERATION<typename Left::ValueType, Left::dimension>, \
+        Left, Right>(left.derived(), right.derived());                  \
+    }                                                                   \
+                                                                        \
+    template <class Left, class Type>                                   \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<Type, Left::dimension>,                    \
+      Left, ArrayReference1D<Type> >                                    \
+    operator OPERATOR(ArrayExpression<Left> const& left,                \
+                      Array1D<Type> const& right)                       \
+    {                                                                   \
+      return left OPERATOR lazy(right);                                 \
+    }                                                                   \
+                                                                        \
+    template <class Type, class Right>                                  \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<Type, Right::dimension>,                   \
+      ArrayReference1D<Type>, Right>                                    \
+    operator OPERATOR(Array1D<Type> const& left,                        \
+                      ArrayExpression<Right> const& right)              \
+    {                                                                   \
+      return lazy(left) OPERATOR right;                                 \
+    }                                                                   \
+                                                                        \
+    template <class Left, class Type>                                   \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<Type, Left::dimension>,                    \
+      Left, ArrayReference2D<Type> >                                    \
+    operator OPERATOR(ArrayExpression<Left> const& left,                \
+                      Array2D<Type> const& right)                       \
+    {                                                                   \
+      return left OPERATOR lazy(right);                                 \
+    }                                                                   \
+                                                                        \
+    template <class Type, class Right>                                  \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<Type, Right::dimension>,                   \
+      ArrayReference2D<Type>, Right>                                    \
+    operator OPERATOR(Array2D<Type> const& left,                        \
+                      ArrayExpression<Right> const& right)              \
+    {                                                                   \
+      return lazy(left) OPERATOR right;                                 \
+    }                                                                   \
+                                                                        \
+    template <class Left>                                               \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<typename Left::ValueType, Left::dimension>, \
+      Left, ScalarReference<typename Left::ValueType> >                 \
+    operator OPERATOR(ArrayExpression<Left> const& left,                \
+                      typename Left::ValueType right)                   \
+    {                                                                   \
+      typedef typename Left::ValueType ValueType;                       \
+      return BinaryArrayExpression<                                     \
+        privateCode::OPERATION<ValueType, Left::dimension>,             \
+        Left, ScalarReference<ValueType> >(                             \
+          left.derived(), ScalarReference<ValueType>(right));           \
+    }                                                                   \
+                                                                        \
+    template <class Right>                                              \
+    inline BinaryArrayExpression<                                       \
+      privateCode::OPERATION<typename Right::ValueType, Right::dimension>, \
+      ScalarReference<typename Right::ValueType>, Right>                \
+    operator OPERATOR(typename Right::ValueType left,                   \
+                      ArrayExpression<Right> const& right)              \
+    {                                                                   \
+      typedef typename Right::ValueType ValueType;                      \
+      return BinaryArrayExpression<                                     \
+        privateCode::OPERATION<ValueType, Right::dimension>,            \
+        ScalarReference<ValueType>, Right>(                             \
+          ScalarReference<ValueType>(left), right.derived());           \
+    }
+
+    BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATOR(+, ExpressionPlus)
+    BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATOR(-, ExpressionMinus)
+    BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATOR(*, ExpressionTimes)
+    BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATOR(/, ExpressionDivides)
+
+#undef BRICK_NUMERIC_DEFINE_EXPRESSION_OPERATOR
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_ARRAYEXPRESSION_IMPL_HH */
@@ -190,6 +190,64 @@ namespace brick {
                                Vector2D<FloatType> corner1);
 
 
+      /**
+       * This member function evaluates the spline at every point of a
+       * rectilinear grid.  Because the bicubic basis is separable,
+       * basis weights are computed only once for each column and each
+       * row of the grid, rather than once for each output point, and
+       * each output row is computed from a single pre-blended row of
+       * control points.  This is much faster than calling
+       * operator()(FloatType, FloatType) for each grid point.
+       *
+       * @param sValues This argument specifies the S coordinates of
+       * the grid columns.  Each element must lie in the range
+       * reported by getMinimumSAndTValues() and
+       * getMaximumSAndTValues().
+       *
+       * @param tValues This argument specifies the T coordinates of
+       * the grid rows.
+       *
+       * @param outputValues This argument is used to return the
+       * result.  If it does not already have shape (tValues.size(),
+       * sValues.size()), it will be reinitialized.  On return,
+       * outputValues(rr, cc) will be equal to (*this)(sValues[cc],
+       * tValues[rr]), up to floating point roundoff.
+       */
+      void
+      evaluateGrid(Array1D<FloatType> const& sValues,
+                   Array1D<FloatType> const& tValues,
+                   Array2D<Type>& outputValues) const;
+
+
+      /**
+       * This member function evaluates the spline at each of a
+       * sequence of (S, T) points.  The result is the same as calling
+       * operator()(FloatType, FloatType) once for each point, but the
+       * work is divided among the threads specified by
+       * setNumberOfThreads().
+       *
+       * @param sBegin This iterator specifies the beginning of a
+       * sequence of S coordinates.  It must be a random access
+       * iterator.
+       *
+       * @param sEnd This iterator specifies the end of the sequence
+       * of S coordinates.
+       *
+       * @param tBegin This iterator specifies the beginning of the
+       * corresponding sequence of T coordinates.
+       *
+       * @param outputBegin This iterator specifies where to write
+       * the (sEnd - sBegin) results.  It must be a random access
+       * iterator.
+       */
+      template <class CoordIter, class OutputIter>
+      void
+      evaluateMany(CoordIter sBegin,
+                   CoordIter sEnd,
+                   CoordIter tBegin,
+                   OutputIter outputBegin) const;
+
+
       /**
        * Indicates whether the spacing of the spline control grid is
        * the same in both S and T directions.
@@ -218,6 +276,18 @@ namespace brick {
                        size_t& numberOfNodesT) const;
 
 
+      /**
+       * This member function returns the number of threads used by
+       * approximateScatteredData() and evaluateMany().
+       *
+       * @return The return value is the thread count most recently
+       * passed to setNumberOfThreads(), or 1 if it has not been
+       * called.
+       */
+      size_t
+      getNumberOfThreads() const {return this->m_numberOfThreads;}
+
+
       /**
        * This member function returns the maximum value for the spline
        * parameters S and T.  Calling operator()(FloatType, FloatType) with
@@ -276,6 +346,24 @@ namespace brick {
       setControlPoints(Array2D<Type> const& controlPoints);
 
 
+      /**
+       * This member function sets how many threads will be used by
+       * approximateScatteredData() and evaluateMany().  Because
+       * partial sums are accumulated separately for each thread, the
+       * control points computed by approximateScatteredData() may
+       * differ in the last few bits from those computed using a
+       * single thread.
+       *
+       * @param numberOfThreads This argument specifies the number of
+       * threads.  Setting it to 0 means "use one thread per core."
+       * The default is 1.
+       */
+      void
+      setNumberOfThreads(size_t numberOfThreads) {
+        this->m_numberOfThreads = numberOfThreads;
+      }
+
+
       /**
        * This member function both specifies the number of nodes in
        * the spline and sets the node positions so that the spline is
@@ -374,6 +462,37 @@ namespace brick {
                            FloatType* powersOfS, FloatType* powersOfT) const;
 
 
+      /**
+       * This protected member function does the work of
+       * approximateScatteredData() for a subset of the input
+       * observations, accumulating the numerator and denominator of
+       * Equation 5 of [1] into deltaGrid and omegaGrid.
+       */
+      template <class CoordIter, class ObsIter>
+      void
+      accumulateScatteredData(CoordIter sBegin,
+                              CoordIter sEnd,
+                              CoordIter tBegin,
+                              ObsIter observationsBegin,
+                              Array2D<Type>& deltaGrid,
+                              Array2D<FloatType>& omegaGrid) const;
+
+
+      /**
+       * This protected member function evaluates the four cubic
+       * basis functions at the offset whose powers are passed in
+       * powers (as computed by decomposeSamplePoint()).
+       *
+       * @param powers This argument must point to the four powers
+       * of the offset.
+       *
+       * @param weights This argument must point to a four-element
+       * array, into which the basis function values will be written.
+       */
+      void
+      computeBasisWeights(FloatType const* powers, FloatType* weights) const;
+
+
       Array1D< Array1D<FloatType> > m_basisArray;
       Array2D<Type> m_controlGrid;
       bool m_isIsotropic;
@@ -381,6 +500,7 @@ namespace brick {
       Vector2D<FloatType> m_maximumXY;
       Vector2D<FloatType> m_xyCellOrigin;
       Vector2D<FloatType> m_xyCellSize;
+      size_t m_numberOfThreads;
     };
 
   } // namespace numeric
@@ -20,6 +20,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <brick/common/parallel.hh>
 #include <brick/numeric/functional.hh>
 #include <brick/numeric/utilities.hh>
 
@@ -38,7 +39,8 @@ namespace brick {
         m_minimumXY(0.0, 0.0),
         m_maximumXY(0.0, 0.0),
         m_xyCellOrigin(0.0, 0.0),
-        m_xyCellSize(0.0, 0.0)
+        m_xyCellSize(0.0, 0.0),
+        m_numberOfThreads(1)
     {
       // Temporary storage for polynomial coefficients.
       Array1D<FloatType> basisCoefficients(4);
@@ -101,7 +103,8 @@ namespace brick {
         m_minimumXY(other.m_minimumXY),
         m_maximumXY(other.m_maximumXY),
         m_xyCellOrigin(other.m_xyCellOrigin),
-        m_xyCellSize(other.m_xyCellSize)
+        m_xyCellSize(other.m_xyCellSize),
+        m_numberOfThreads(other.m_numberOfThreads)
     {
       // Deep copy basis coefficients.
       for(size_t index0 = 0; index0 < m_basisArray.size(); ++index0) {
@@ -192,114 +195,183 @@ namespace brick {
       deltaGrid = static_cast<Type>(0.0);
       omegaGrid = static_cast<FloatType>(0.0);
 
-      // This code implements the algorithm on page 231 of the paper.
+      // Observations are independent until they are summed into
+      // deltaGrid and omegaGrid, so each thread accumulates its share
+      // into private grids, and the results are added together
+      // afterward.
+      size_t numberOfObservations = sEnd - sBegin;
+      size_t numberOfThreads = this->m_numberOfThreads;
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
+      }
+      numberOfThreads = std::min(numberOfThreads, numberOfObservations);
+      if(numberOfThreads <= 1) {
+        this->accumulateScatteredData(sBegin, sEnd, tBegin, observationsBegin,
+                                      deltaGrid, omegaGrid);
+      } else {
+        std::vector< Array2D<Type> > deltaGrids(numberOfThreads);
+        std::vector< Array2D<FloatType> > omegaGrids(numberOfThreads);
+        deltaGrids[0] = deltaGrid;
+        omegaGrids[0] = omegaGrid;
+        brick::common::executeInParallel(
+          numberOfThreads,
+          [&](size_t taskIndex) {
+            size_t firstIndex =
+              (taskIndex * numberOfObservations) / numberOfThreads;
+            size_t endIndex =
+              ((taskIndex + 1) * numberOfObservations) / numberOfThreads;
+            if(taskIndex != 0) {
+              deltaGrids[taskIndex].reinit(deltaGrid.rows(),
+                                           deltaGrid.columns());
+              omegaGrids[taskIndex].reinit(omegaGrid.rows(),
+                                           omegaGrid.columns());
+              deltaGrids[taskIndex] = static_cast<Type>(0.0);
+              omegaGrids[taskIndex] = static_cast<FloatType>(0.0);
+            }
+            this->accumulateScatteredData(
+              sBegin + firstIndex, sBegin + endIndex, tBegin + firstIndex,
+              observationsBegin + firstIndex,
+              deltaGrids[taskIndex], omegaGrids[taskIndex]);
+          },
+          numberOfThreads);
+        for(size_t taskIndex = 1; taskIndex < numberOfThreads; ++taskIndex) {
+          deltaGrid += deltaGrids[taskIndex];
+          omegaGrid += omegaGrids[taskIndex];
+        }
+      }
+
+      // Final averaging step in case neighboring input points want
+      // different control grid values.
+      for(size_t index0 = 0; index0 < m_controlGrid.size(); ++index0) {
+        if(omegaGrid[index0] == static_cast<FloatType>(0.0)) {
+          this->m_controlGrid[index0] = static_cast<Type>(0.0);
+        } else {
+          this->m_controlGrid[index0] = deltaGrid[index0] / omegaGrid[index0];
+        }
+      }
+    }
+
+
+    // This member function evaluates the spline at every point of a
+    // rectilinear grid.
+    template <class Type, class FloatType>
+    void
+    BSpline2D<Type, FloatType>::
+    evaluateGrid(Array1D<FloatType> const& sValues,
+                 Array1D<FloatType> const& tValues,
+                 Array2D<Type>& outputValues) const
+    {
+      size_t const numberOfNodesS = this->m_controlGrid.columns();
+      size_t const numberOfNodesT = this->m_controlGrid.rows();
+      if(outputValues.rows() != tValues.size()
+         || outputValues.columns() != sValues.size()) {
+        outputValues.reinit(tValues.size(), sValues.size());
+      }
+
+      // Basis weights for each column of the output grid are
+      // computed once, and reused for every row.
+      Array1D<size_t> firstNodeS(sValues.size());
+      Array2D<FloatType> weightsS(sValues.size(), 4);
       size_t iIndex;
       size_t jIndex;
-      Array2D<FloatType> weightArray(4, 4);
       FloatType powersOfS[4];
       FloatType powersOfT[4];
-
-      // Iterate over each observation (each scattered data point).
-      while(sBegin != sEnd) {
-        FloatType weightSquaredSum = 0.0;
-
-        // Sanity check input data.
-        if(*sBegin < this->m_minimumXY.x()
-           || *sBegin >= this->m_maximumXY.x()
-           || *tBegin < this->m_minimumXY.y()
-           || *tBegin >= this->m_maximumXY.y()) {
-
+      for(size_t column = 0; column < sValues.size(); ++column) {
+        // Check bounds before decomposeSamplePoint() converts the
+        // cell coordinate to size_t, so that points just below the
+        // minimum can't wrap around to a valid looking index.
+        int const iCoord = static_cast<int>(roundToFloor(
+          (sValues[column] - m_xyCellOrigin.x()) / m_xyCellSize.x()));
+        if(iCoord < 1 || iCoord + 3 > static_cast<int>(numberOfNodesS)) {
           BRICK_THROW(brick::common::ValueException,
-                      "BSpline2D::approximateScatteredData()",
-                      "Input datum is out of bounds.");
+                      "BSpline2D::evaluateGrid()",
+                      "S value is out of bounds.");
         }
+        this->decomposeSamplePoint(sValues[column], this->m_minimumXY.y(),
+                                   iIndex, jIndex, powersOfS, powersOfT);
+        firstNodeS[column] = iIndex - 1;
+        this->computeBasisWeights(powersOfS, weightsS.getData(column * 4));
+      }
 
-        // This call sets the value of powersOfS and powersOfT,
-        // and returns by reference the indices of the control grid
-        // cell into which (s, t) falls.
-        this->decomposeSamplePoint(*sBegin, *tBegin, iIndex, jIndex,
-                                   powersOfS, powersOfT);
-
-        // Now on with Lee, Wolberg, and Shin's algorithm.  The four
-        // basis polynomials define the weights with which each
-        // control point in the neighborhood will affect the BSpline
-        // value at the position of the currently selected
-        // observation.  Here we compute the values of the basis
-        // polynomials, and multiply them to get those weights.  Later
-        // we will use the weights to solve for the most appropriate
-        // control point values.
-        for(size_t kIndex = 0; kIndex < 4; ++kIndex) {
-
-          // Compute one basis function value.
-          FloatType B_k = std::inner_product(
-            powersOfS, powersOfS + 4, (this->m_basisArray)[kIndex].data(),
-            static_cast<FloatType>(0));
-
-          for(size_t lIndex = 0; lIndex < 4; ++lIndex) {
-
-            // Compute the second basis function value.
-            FloatType B_l = std::inner_product(
-              powersOfT, powersOfT + 4, (this->m_basisArray)[lIndex].data(),
-              static_cast<FloatType>(0));
-
-            // Multiply to get the relevant weight.  Indexing into
-            // weightArray is (row, column), not (k, l).
-            FloatType weight = B_k * B_l;
-            weightArray(lIndex, kIndex) = weight;
-            weightSquaredSum += weight * weight;
-          }
+      // For each output row, blend the four relevant rows of control
+      // points into one, so that each output point requires only
+      // four multiplies.
+      Array1D<Type> blendedRow(numberOfNodesS);
+      FloatType weightsT[4];
+      for(size_t row = 0; row < tValues.size(); ++row) {
+        int const jCoord = static_cast<int>(roundToFloor(
+          (tValues[row] - m_xyCellOrigin.y()) / m_xyCellSize.y()));
+        if(jCoord < 1 || jCoord + 3 > static_cast<int>(numberOfNodesT)) {
+          BRICK_THROW(brick::common::ValueException,
+                      "BSpline2D::evaluateGrid()",
+                      "T value is out of bounds.");
+        }
+        this->decomposeSamplePoint(this->m_minimumXY.x(), tValues[row],
+                                   iIndex, jIndex, powersOfS, powersOfT);
+        this->computeBasisWeights(powersOfT, weightsT);
+        Type const* controlRow0 = this->m_controlGrid.getData(jIndex - 1, 0);
+        Type const* controlRow1 = controlRow0 + numberOfNodesS;
+        Type const* controlRow2 = controlRow1 + numberOfNodesS;
+        Type const* controlRow3 = controlRow2 + numberOfNodesS;
+        for(size_t node = 0; node < numberOfNodesS; ++node) {
+          blendedRow[node] = (weightsT[0] * controlRow0[node]
+                              + weightsT[1] * controlRow1[node]
+                              + weightsT[2] * controlRow2[node]
+                              + weightsT[3] * controlRow3[node]);
         }
 
-        // Here we solve for control point values, assuming that each
-        // control point is within range of at most one of the
-        // scattered data points.  We also keep some statistics that
-        // will be used later to resolve control points for which this
-        // assumption is not true.
-        for(size_t kIndex = 0; kIndex < 4; ++kIndex) {
-          for(size_t lIndex = 0; lIndex < 4; ++lIndex) {
-            size_t index0 = iIndex + kIndex - 1;
-            size_t index1 = jIndex + lIndex - 1;
+        Type* outputPtr = outputValues.getData(row, 0);
+        for(size_t column = 0; column < sValues.size(); ++column) {
+          FloatType const* weightsPtr = weightsS.getData(column * 4);
+          Type const* blendedPtr = &(blendedRow[firstNodeS[column]]);
+          outputPtr[column] = (weightsPtr[0] * blendedPtr[0]
+                               + weightsPtr[1] * blendedPtr[1]
+                               + weightsPtr[2] * blendedPtr[2]
+                               + weightsPtr[3] * blendedPtr[3]);
+        }
+      }
+    }
 
-            // Solve directly for the control point value (phi)
-            // following Equation 3 of [1].  Indexing into
-            // weightArray is (row, column), not (k, l).
-            FloatType weight = weightArray(lIndex, kIndex);
-            Type phi = (weight / weightSquaredSum) * (*observationsBegin);
 
-            // Sanity check.  This test should not pass because the
-            // extent of the spline was set based on calls to
-            // std::min_element() and std::max_element() at the
-            // beginning of this function.
-            if(index0 >= deltaGrid.columns() || index1 >= deltaGrid.rows()) {
-              BRICK_THROW(brick::common::LogicException,
-                          "BSpline2D::approximateScatteredData()",
-                          "Spline bounds appear to have been set incorrectly.");
-            }
+    // This member function evaluates the spline at each of a
+    // sequence of (S, T) points.
+    template <class Type, class FloatType>
+    template <class CoordIter, class OutputIter>
+    void
+    BSpline2D<Type, FloatType>::
+    evaluateMany(CoordIter sBegin,
+                 CoordIter sEnd,
+                 CoordIter tBegin,
+                 OutputIter outputBegin) const
+    {
+      size_t const numberOfPoints = sEnd - sBegin;
 
-            // Delta and omega are the numerator and denominator of
-            // Equation 5 of [1].  Essentially, these keep a weighted
-            // average of the phi values from each scattered data
-            // observation that affects each control point.  Next, we
-            // will use these to compute a final value of phi.
-            FloatType weightSquared = weight * weight;
-            deltaGrid(index1, index0) += phi * weightSquared;
-            omegaGrid(index1, index0) += weightSquared;
-          }
-        }
-        ++sBegin;
-        ++tBegin;
-        ++observationsBegin;
+      // Tasks are coarse, so that thread startup cost is amortized.
+      size_t numberOfThreads = this->m_numberOfThreads;
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
       }
-
-      // Final averaging step in case neighboring input points want
-      // different control grid values.
-      for(size_t index0 = 0; index0 < m_controlGrid.size(); ++index0) {
-        if(omegaGrid[index0] == static_cast<FloatType>(0.0)) {
-          this->m_controlGrid[index0] = static_cast<Type>(0.0);
-        } else {
-          this->m_controlGrid[index0] = deltaGrid[index0] / omegaGrid[index0];
-        }
+      numberOfThreads = std::min(numberOfThreads, numberOfPoints);
+      if(numberOfThreads == 0) {
+        return;
       }
+      brick::common::executeInParallel(
+        numberOfThreads,
+        [&](size_t taskIndex) {
+          size_t index = (taskIndex * numberOfPoints) / numberOfThreads;
+          size_t endIndex = ((taskIndex + 1) * numberOfPoints) / numberOfThreads;
+          CoordIter sIter = sBegin + index;
+          CoordIter tIter = tBegin + index;
+          OutputIter outputIter = outputBegin + index;
+          while(index != endIndex) {
+            *outputIter = (*this)(*sIter, *tIter);
+            ++sIter;
+            ++tIter;
+            ++outputIter;
+            ++index;
+          }
+        },
+        numberOfThreads);
     }
 
 
@@ -518,6 +590,7 @@ namespace brick {
         this->m_maximumXY = other.m_maximumXY;
         this->m_xyCellOrigin = other.m_xyCellOrigin;
         this->m_xyCellSize = other.m_xyCellSize;
+        this->m_numberOfThreads = other.m_numberOfThreads;
 
         // Deep copy basis coefficients.
         for(size_t index0 = 0; index0 < this->m_basisArray.size(); ++index0) {
@@ -572,35 +645,149 @@ namespace brick {
 
       // Interpolate by adding spline basis functions from the
       // surrounding control points.
-      int index0 = iIndex - 1;
-      int index1 = jIndex - 1;
-      FloatType functionValue = 0.0;
+      FloatType basisWeightsS[4];
+      FloatType basisWeightsT[4];
+      this->computeBasisWeights(powersOfS, basisWeightsS);
+      this->computeBasisWeights(powersOfT, basisWeightsT);
+      size_t index0 = iIndex - 1;
+      size_t index1 = jIndex - 1;
+      Type functionValue = static_cast<Type>(0.0);
       for(size_t kIndex = 0; kIndex < 4; ++kIndex) {
-
         size_t i0PlusK = index0 + kIndex;
-
-        //  FloatType B_k = dot<FloatType>((this->m_basisArray)[kIndex], powersOfS);
-        FloatType B_k = std::inner_product(
-          powersOfS, powersOfS + 4, (this->m_basisArray)[kIndex].data(),
-          static_cast<FloatType>(0));
-
         for(size_t lIndex = 0; lIndex < 4; ++lIndex) {
-
           size_t i1PlusL = index1 + lIndex;
 
-          // FloatType B_l = dot<FloatType>((this->m_basisArray)[lIndex], powersOfT);
-          FloatType B_l = std::inner_product(
-            powersOfT, powersOfT + 4, (this->m_basisArray)[lIndex].data(),
-            static_cast<FloatType>(0));
-
           // Indexing into control grid is (row, column), not (k, l).
-          functionValue += (B_k * B_l * m_controlGrid(i1PlusL, i0PlusK));
+          functionValue += (basisWeightsS[kIndex] * basisWeightsT[lIndex]
+                            * m_controlGrid(i1PlusL, i0PlusK));
         }
       }
       return functionValue;
     }
 
 
+    // This protected member function does the work of
+    // approximateScatteredData() for a subset of the input
+    // observations.
+    template <class Type, class FloatType>
+    template <class CoordIter, class ObsIter>
+    void
+    BSpline2D<Type, FloatType>::
+    accumulateScatteredData(CoordIter sBegin,
+                            CoordIter sEnd,
+                            CoordIter tBegin,
+                            ObsIter observationsBegin,
+                            Array2D<Type>& deltaGrid,
+                            Array2D<FloatType>& omegaGrid) const
+    {
+      // This code implements the algorithm on page 231 of the paper.
+      size_t iIndex;
+      size_t jIndex;
+      FloatType weightArray[4][4];
+      FloatType powersOfS[4];
+      FloatType powersOfT[4];
+      FloatType basisWeightsS[4];
+      FloatType basisWeightsT[4];
+
+      // Iterate over each observation (each scattered data point).
+      while(sBegin != sEnd) {
+        FloatType weightSquaredSum = 0.0;
+
+        // Sanity check input data.
+        if(*sBegin < this->m_minimumXY.x()
+           || *sBegin >= this->m_maximumXY.x()
+           || *tBegin < this->m_minimumXY.y()
+           || *tBegin >= this->m_maximumXY.y()) {
+
+          BRICK_THROW(brick::common::ValueException,
+                      "BSpline2D::approximateScatteredData()",
+                      "Input datum is out of bounds.");
+        }
+
+        // This call sets the value of powersOfS and powersOfT,
+        // and returns by reference the indices of the control grid
+        // cell into which (s, t) falls.
+        this->decomposeSamplePoint(*sBegin, *tBegin, iIndex, jIndex,
+                                   powersOfS, powersOfT);
+
+        // Now on with Lee, Wolberg, and Shin's algorithm.  The four
+        // basis polynomials define the weights with which each
+        // control point in the neighborhood will affect the BSpline
+        // value at the position of the currently selected
+        // observation.  Here we compute the values of the basis
+        // polynomials, and multiply them to get those weights.  Later
+        // we will use the weights to solve for the most appropriate
+        // control point values.
+        this->computeBasisWeights(powersOfS, basisWeightsS);
+        this->computeBasisWeights(powersOfT, basisWeightsT);
+        for(size_t kIndex = 0; kIndex < 4; ++kIndex) {
+          for(size_t lIndex = 0; lIndex < 4; ++lIndex) {
+            // Multiply to get the relevant weight.  Indexing into
+            // weightArray is (row, column), not (k, l).
+            FloatType weight = basisWeightsS[kIndex] * basisWeightsT[lIndex];
+            weightArray[lIndex][kIndex] = weight;
+            weightSquaredSum += weight * weight;
+          }
+        }
+
+        // Here we solve for control point values, assuming that each
+        // control point is within range of at most one of the
+        // scattered data points.  We also keep some statistics that
+        // will be used later to resolve control points for which this
+        // assumption is not true.
+        for(size_t kIndex = 0; kIndex < 4; ++kIndex) {
+          for(size_t lIndex = 0; lIndex < 4; ++lIndex) {
+            size_t index0 = iIndex + kIndex - 1;
+            size_t index1 = jIndex + lIndex - 1;
+
+            // Solve directly for the control point value (phi)
+            // following Equation 3 of [1].  Indexing into
+            // weightArray is (row, column), not (k, l).
+            FloatType weight = weightArray[lIndex][kIndex];
+            Type phi = (weight / weightSquaredSum) * (*observationsBegin);
+
+            // Sanity check.  This test should not pass because the
+            // extent of the spline was set based on calls to
+            // std::min_element() and std::max_element() at the
+            // beginning of this function.
+            if(index0 >= deltaGrid.columns() || index1 >= deltaGrid.rows()) {
+              BRICK_THROW(brick::common::LogicException,
+                          "BSpline2D::approximateScatteredData()",
+                          "Spline bounds appear to have been set incorrectly.");
+            }
+
+            // Delta and omega are the numerator and denominator of
+            // Equation 5 of [1].  Essentially, these keep a weighted
+            // average of the phi values from each scattered data
+            // observation that affects each control point.  Next, we
+            // will use these to compute a final value of phi.
+            FloatType weightSquared = weight * weight;
+            deltaGrid(index1, index0) += phi * weightSquared;
+            omegaGrid(index1, index0) += weightSquared;
+          }
+        }
+        ++sBegin;
+        ++tBegin;
+        ++observationsBegin;
+      }
+    }
+
+
+    // This protected member function evaluates the four cubic basis
+    // functions at a particular offset.
+    template <class Type, class FloatType>
+    void
+    BSpline2D<Type, FloatType>::
+    computeBasisWeights(FloatType const* powers, FloatType* weights) const
+    {
+      for(size_t kIndex = 0; kIndex < 4; ++kIndex) {
+        weights[kIndex] = std::inner_product(
+          powers, powers + 4, (this->m_basisArray)[kIndex].data(),
+          static_cast<FloatType>(0));
+      }
+    }
+
+
     template <class Type, class FloatType>
     void
     BSpline2D<Type, FloatType>::
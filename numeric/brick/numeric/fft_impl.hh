@@ -45,7 +45,7 @@ namespace brick {
       }
 
 
-      bool
+      inline bool
       isPowerOfTwo(std::size_t signalLength)
       {
         double exponent = std::log(double(signalLength)) / std::log(2.0);
@@ -0,0 +1,111 @@
+/**
+***************************************************************************
+* @file brick/numeric/matchTemplate2D.hh
+*
+* Header file declaring functions for dense normalized
+* cross-correlation of a template against an image.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_MATCHTEMPLATE2D_HH
+#define BRICK_NUMERIC_MATCHTEMPLATE2D_HH
+
+#include <brick/numeric/array2D.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** This enum selects how matchTemplate2D() computes the
+     ** correlation between the template and each image window.
+     **/
+    enum TemplateMatchStrategy {
+      /// Choose between direct and FFT evaluation based on template
+      /// size.
+      BRICK_TEMPLATE_MATCH_AUTO,
+
+      /// Sum over template pixels directly.  Best for small templates.
+      BRICK_TEMPLATE_MATCH_DIRECT,
+
+      /// Multiply in the frequency domain.  Best for large templates.
+      BRICK_TEMPLATE_MATCH_FFT
+    };
+
+
+    /**
+     * This function computes the normalized cross-correlation
+     * (correlation coefficient) of a template with every
+     * template-sized window of an image.  That is, element (row,
+     * column) of the result is the value that NormalizedCorrelator
+     * would report for the template and the image window whose upper
+     * left corner is at (row, column).
+     *
+     * Window means and variances come from integral images (see
+     * BoxIntegrator2D), so their cost doesn't depend on the template
+     * size.  The remaining term, the correlation of the image with
+     * the mean-subtracted template, is computed either directly or
+     * by FFT, as selected by argument strategy.
+     *
+     * Windows (or templates) with zero variance have no well-defined
+     * correlation coefficient.  The corresponding elements of the
+     * result are set to zero.
+     *
+     * @param image This argument is the image to be searched.
+     *
+     * @param templateArray This argument is the pattern to search
+     * for.  It must not be larger than image in either dimension.
+     *
+     * @param result This argument is used to return the correlation
+     * coefficients.  It will be reinitialized to have (image.rows() -
+     * templateArray.rows() + 1) rows and (image.columns() -
+     * templateArray.columns() + 1) columns, unless it already has
+     * that shape.
+     *
+     * @param strategy This argument specifies how to compute the
+     * correlation.
+     */
+    template <class OutputType, class ImageType, class TemplateType>
+    void
+    matchTemplate2D(Array2D<ImageType> const& image,
+                    Array2D<TemplateType> const& templateArray,
+                    Array2D<OutputType>& result,
+                    TemplateMatchStrategy strategy = BRICK_TEMPLATE_MATCH_AUTO);
+
+
+    /**
+     * This function is just like the three-argument version of
+     * matchTemplate2D(), except that it returns the result rather
+     * than filling in an argument.
+     *
+     * @param image This argument is the image to be searched.
+     *
+     * @param templateArray This argument is the pattern to search
+     * for.
+     *
+     * @param strategy This argument specifies how to compute the
+     * correlation.
+     *
+     * @return The return value is an array of correlation
+     * coefficients.
+     */
+    template <class OutputType, class ImageType, class TemplateType>
+    Array2D<OutputType>
+    matchTemplate2D(Array2D<ImageType> const& image,
+                    Array2D<TemplateType> const& templateArray,
+                    TemplateMatchStrategy strategy = BRICK_TEMPLATE_MATCH_AUTO);
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/matchTemplate2D_impl.hh>
+
+#endif /* #ifndef BRICK_NUMERIC_MATCHTEMPLATE2D_HH */
@@ -0,0 +1,289 @@
+/**
+***************************************************************************
+* @file brick/numeric/matchTemplate2D_impl.hh
+*
+* Header file defining inline and template functions declared in
+* matchTemplate2D.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_MATCHTEMPLATE2D_IMPL_HH
+#define BRICK_NUMERIC_MATCHTEMPLATE2D_IMPL_HH
+
+// This file is included by matchTemplate2D.hh, and should not be
+// directly included by user code, so no need to include
+// matchTemplate2D.hh here.
+//
+// #include <brick/numeric/matchTemplate2D.hh>
+
+#include <cmath>
+#include <complex>
+#include <brick/common/exception.hh>
+#include <brick/numeric/boxIntegrator2D.hh>
+#include <brick/numeric/fft.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Smallest power of two that is >= value.
+      inline size_t
+      getTemplateMatchFFTSize(size_t value)
+      {
+        size_t result = 1;
+        while(result < value) {
+          result <<= 1;
+        }
+        return result;
+      }
+
+
+      // Replace each row and then each column of data with its DFT.
+      inline void
+      computeTemplateMatchFFT2D(Array2D< std::complex<double> >& data)
+      {
+        Array1D< std::complex<double> > rowSignal(data.columns());
+        for(size_t row = 0; row < data.rows(); ++row) {
+          for(size_t column = 0; column < data.columns(); ++column) {
+            rowSignal[column] = data(row, column);
+          }
+          Array1D< std::complex<double> > spectrum = computeFFT(rowSignal);
+          for(size_t column = 0; column < data.columns(); ++column) {
+            data(row, column) = spectrum[column];
+          }
+        }
+        Array1D< std::complex<double> > columnSignal(data.rows());
+        for(size_t column = 0; column < data.columns(); ++column) {
+          for(size_t row = 0; row < data.rows(); ++row) {
+            columnSignal[row] = data(row, column);
+          }
+          Array1D< std::complex<double> > spectrum = computeFFT(columnSignal);
+          for(size_t row = 0; row < data.rows(); ++row) {
+            data(row, column) = spectrum[row];
+          }
+        }
+      }
+
+
+      // Correlate image with a (zero mean) template by summing over
+      // template pixels.  The inner loop runs along a row of the
+      // output, reading contiguous image memory with a single
+      // template weight, so the compiler can vectorize it.
+      template <class ImageType>
+      void
+      correlateTemplateDirect(Array2D<ImageType> const& image,
+                              Array2D<double> const& zeroMeanTemplate,
+                              Array2D<double>& numerator)
+      {
+        size_t const outputColumns = numerator.columns();
+        numerator = 0.0;
+        for(size_t row = 0; row < numerator.rows(); ++row) {
+          double* outputRow = numerator.getData(row, 0);
+          for(size_t tRow = 0; tRow < zeroMeanTemplate.rows(); ++tRow) {
+            ImageType const* imageRow = image.getData(row + tRow, 0);
+            for(size_t tColumn = 0; tColumn < zeroMeanTemplate.columns();
+                ++tColumn) {
+              double const weight = zeroMeanTemplate(tRow, tColumn);
+              if(weight == 0.0) {
+                continue;
+              }
+              ImageType const* inputPtr = imageRow + tColumn;
+              for(size_t column = 0; column < outputColumns; ++column) {
+                outputRow[column] += weight * inputPtr[column];
+              }
+            }
+          }
+        }
+      }
+
+
+      // Correlate image with a (zero mean) template by multiplying
+      // their spectra.  The arrays are zero padded to at least the
+      // size of the image, so wrap-around never reaches the valid
+      // region of the output.
+      template <class ImageType>
+      void
+      correlateTemplateFFT(Array2D<ImageType> const& image,
+                           Array2D<double> const& zeroMeanTemplate,
+                           Array2D<double>& numerator)
+      {
+        size_t const fftRows = getTemplateMatchFFTSize(image.rows());
+        size_t const fftColumns = getTemplateMatchFFTSize(image.columns());
+
+        Array2D< std::complex<double> > imageSpectrum(fftRows, fftColumns);
+        Array2D< std::complex<double> > templateSpectrum(fftRows, fftColumns);
+        imageSpectrum = std::complex<double>(0.0, 0.0);
+        templateSpectrum = std::complex<double>(0.0, 0.0);
+        for(size_t row = 0; row < image.rows(); ++row) {
+          for(size_t column = 0; column < image.columns(); ++column) {
+            imageSpectrum(row, column) = static_cast<double>(image(row, column));
+          }
+        }
+        for(size_t row = 0; row < zeroMeanTemplate.rows(); ++row) {
+          for(size_t column = 0; column < zeroMeanTemplate.columns();
+              ++column) {
+            templateSpectrum(row, column) = zeroMeanTemplate(row, column);
+          }
+        }
+        computeTemplateMatchFFT2D(imageSpectrum);
+        computeTemplateMatchFFT2D(templateSpectrum);
+
+        // Cross-correlation is the inverse transform of
+        // F(image) * conj(F(template)).  We compute the inverse
+        // transform as conj(F(conj(x))) / N, so conjugate here.
+        for(size_t index0 = 0; index0 < imageSpectrum.size(); ++index0) {
+          imageSpectrum[index0] =
+            std::conj(imageSpectrum[index0] * std::conj(templateSpectrum[index0]));
+        }
+        computeTemplateMatchFFT2D(imageSpectrum);
+
+        double const scale = 1.0 / static_cast<double>(fftRows * fftColumns);
+        for(size_t row = 0; row < numerator.rows(); ++row) {
+          for(size_t column = 0; column < numerator.columns(); ++column) {
+            numerator(row, column) = imageSpectrum(row, column).real() * scale;
+          }
+        }
+      }
+
+
+      // Decide whether direct or FFT correlation is likely to be
+      // faster.  The FFT cost includes a generous constant, since
+      // computeFFT() is not heavily optimized.
+      inline bool
+      isTemplateMatchFFTFaster(size_t imageRows, size_t imageColumns,
+                               size_t templateRows, size_t templateColumns)
+      {
+        double directCost =
+          (double(imageRows - templateRows + 1)
+           * double(imageColumns - templateColumns + 1)
+           * double(templateRows) * double(templateColumns));
+        double fftSize = (double(getTemplateMatchFFTSize(imageRows))
+                          * double(getTemplateMatchFFTSize(imageColumns)));
+        double fftCost = 24.0 * fftSize * std::log(fftSize) / std::log(2.0);
+        return directCost > fftCost;
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // This function computes the normalized cross-correlation of a
+    // template with every template-sized window of an image.
+    template <class OutputType, class ImageType, class TemplateType>
+    void
+    matchTemplate2D(Array2D<ImageType> const& image,
+                    Array2D<TemplateType> const& templateArray,
+                    Array2D<OutputType>& result,
+                    TemplateMatchStrategy strategy)
+    {
+      size_t const templateRows = templateArray.rows();
+      size_t const templateColumns = templateArray.columns();
+      if(templateRows == 0 || templateColumns == 0) {
+        BRICK_THROW(common::ValueException, "matchTemplate2D()",
+                    "Argument templateArray must not be empty.");
+      }
+      if(templateRows > image.rows() || templateColumns > image.columns()) {
+        BRICK_THROW(common::ValueException, "matchTemplate2D()",
+                    "Argument templateArray must not be larger than "
+                    "argument image.");
+      }
+      size_t const outputRows = image.rows() - templateRows + 1;
+      size_t const outputColumns = image.columns() - templateColumns + 1;
+      if(result.rows() != outputRows || result.columns() != outputColumns) {
+        result.reinit(outputRows, outputColumns);
+      }
+
+      // Subtract the template mean, so that the numerator doesn't
+      // need a correction term.
+      double const count = double(templateRows * templateColumns);
+      double templateSum = 0.0;
+      for(size_t index0 = 0; index0 < templateArray.size(); ++index0) {
+        templateSum += static_cast<double>(templateArray[index0]);
+      }
+      double const templateMean = templateSum / count;
+      Array2D<double> zeroMeanTemplate(templateRows, templateColumns);
+      double templateSumOfSquares = 0.0;
+      for(size_t index0 = 0; index0 < templateArray.size(); ++index0) {
+        double value =
+          static_cast<double>(templateArray[index0]) - templateMean;
+        zeroMeanTemplate[index0] = value;
+        templateSumOfSquares += value * value;
+      }
+      if(templateSumOfSquares <= 0.0) {
+        result = static_cast<OutputType>(0);
+        return;
+      }
+
+      // Compute sum(image * (template - templateMean)) at every
+      // offset.
+      if(strategy == BRICK_TEMPLATE_MATCH_AUTO) {
+        strategy = (privateCode::isTemplateMatchFFTFaster(
+                      image.rows(), image.columns(),
+                      templateRows, templateColumns)
+                    ? BRICK_TEMPLATE_MATCH_FFT : BRICK_TEMPLATE_MATCH_DIRECT);
+      }
+      Array2D<double> numerator(outputRows, outputColumns);
+      if(strategy == BRICK_TEMPLATE_MATCH_FFT) {
+        privateCode::correlateTemplateFFT(image, zeroMeanTemplate, numerator);
+      } else {
+        privateCode::correlateTemplateDirect(
+          image, zeroMeanTemplate, numerator);
+      }
+
+      // Window variances come from integral images of the image
+      // and its square.
+      BoxIntegrator2D<ImageType, double> sumIntegrator(image);
+      BoxIntegrator2D<ImageType, double> squareIntegrator(
+        image, [](ImageType const& value) {
+          return static_cast<double>(value) * static_cast<double>(value);
+        });
+      for(size_t row = 0; row < outputRows; ++row) {
+        for(size_t column = 0; column < outputColumns; ++column) {
+          Index2D corner0(static_cast<int>(row), static_cast<int>(column));
+          Index2D corner1(static_cast<int>(row + templateRows),
+                          static_cast<int>(column + templateColumns));
+          double windowSum = sumIntegrator.getIntegral(corner0, corner1);
+          double windowSumOfSquares =
+            squareIntegrator.getIntegral(corner0, corner1);
+          double windowVariance =
+            windowSumOfSquares - windowSum * windowSum / count;
+
+          // Integral images lose precision on large, flat windows, so
+          // treat tiny variances as zero.
+          if(windowVariance <= 1.0E-12 * windowSumOfSquares) {
+            result(row, column) = static_cast<OutputType>(0);
+          } else {
+            result(row, column) = static_cast<OutputType>(
+              numerator(row, column)
+              / std::sqrt(windowVariance * templateSumOfSquares));
+          }
+        }
+      }
+    }
+
+
+    // This function is just like the three-argument version of
+    // matchTemplate2D(), except that it returns the result.
+    template <class OutputType, class ImageType, class TemplateType>
+    Array2D<OutputType>
+    matchTemplate2D(Array2D<ImageType> const& image,
+                    Array2D<TemplateType> const& templateArray,
+                    TemplateMatchStrategy strategy)
+    {
+      Array2D<OutputType> result;
+      matchTemplate2D(image, templateArray, result, strategy);
+      return result;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_MATCHTEMPLATE2D_IMPL_HH */
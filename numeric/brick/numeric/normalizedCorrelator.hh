@@ -14,7 +14,7 @@
 #define BRICK_NUMERIC_NORMALIZEDCORRELATOR_HH
 
 #include <cmath>
-#include <deque>
+#include <vector>
 #include <brick/numeric/array2D.hh>
 
 namespace brick {
@@ -265,6 +265,11 @@ namespace brick {
        * updated normalized correlation by calling
        * getNormalizedCorrelation().
        *
+       * Tracked samples are kept in a ring buffer that grows as
+       * needed, so once the window has reached its steady-state size,
+       * adding and removing samples doesn't allocate.  Use argument
+       * windowSize to size the buffer in advance.
+       *
        * Note that even if input tracking is disabled, you can still
        * remove samples explicitly by calling removeSample() or
        * removeSamples().
@@ -281,9 +286,12 @@ namespace brick {
        * @param trackInput Setting this argument to true enables input
        * tracking. Setting this argument false disabled input
        * tracking.
+       *
+       * @param windowSize If trackInput is true, this argument
+       * specifies how many sample pairs to make room for.
        */
       void
-      enableInputTracking(bool trackInput = true);
+      enableInputTracking(bool trackInput = true, size_t windowSize = 0);
 
 
       /**
@@ -321,7 +329,7 @@ namespace brick {
        * enabled, false otherwise.
        */
       inline bool
-      isInputTrackingEnabled() const {return m_inputTracker0Ptr != 0;}
+      isInputTrackingEnabled() const {return m_isTrackingInput;}
 
 
       /**
@@ -401,9 +409,15 @@ namespace brick {
 
     private:
 
+      void
+      pushTrackedSample(Type sample0, Type sample1);
+
       size_t m_count;
-      std::deque<Type>* m_inputTracker0Ptr;
-      std::deque<Type>* m_inputTracker1Ptr;
+      size_t m_inputHead;
+      std::vector<Type> m_inputRing0;
+      std::vector<Type> m_inputRing1;
+      size_t m_inputSize;
+      bool m_isTrackingInput;
       Type m_sum0;
       Type m_sum1;
       Type m_sum00;
@@ -30,8 +30,11 @@ namespace brick {
     NormalizedCorrelator<Type>::
     NormalizedCorrelator(bool trackInput)
       : m_count(0),
-        m_inputTracker0Ptr(0),
-        m_inputTracker1Ptr(0),
+        m_inputHead(0),
+        m_inputRing0(),
+        m_inputRing1(),
+        m_inputSize(0),
+        m_isTrackingInput(false),
         m_sum0(static_cast<Type>(0)),
         m_sum1(static_cast<Type>(0)),
         m_sum00(static_cast<Type>(0)),
@@ -53,8 +56,11 @@ namespace brick {
     NormalizedCorrelator(IterType0 begin0, IterType0 end0, IterType1 begin1,
                          bool trackInput)
       : m_count(0),
-        m_inputTracker0Ptr(0),
-        m_inputTracker1Ptr(0),
+        m_inputHead(0),
+        m_inputRing0(),
+        m_inputRing1(),
+        m_inputSize(0),
+        m_isTrackingInput(false),
         m_sum0(static_cast<Type>(0)),
         m_sum1(static_cast<Type>(0)),
         m_sum00(static_cast<Type>(0)),
@@ -88,8 +94,7 @@ namespace brick {
     {
       // Copy input, if required to do so.
       if(this->isInputTrackingEnabled()) {
-        m_inputTracker0Ptr->push_back(sample0);
-        m_inputTracker1Ptr->push_back(sample1);
+        this->pushTrackedSample(sample0, sample1);
       }
       this->addSampleWithoutTracking(sample0, sample1);
     }
@@ -125,8 +130,7 @@ namespace brick {
         IterType0 begin0Copy = begin0;
         IterType1 begin1Copy = begin1;
         while(begin0Copy != end0) {
-          m_inputTracker0Ptr->push_back(*begin0Copy);
-          m_inputTracker1Ptr->push_back(*begin1Copy);
+          this->pushTrackedSample(*begin0Copy, *begin1Copy);
           ++begin0Copy;
           ++begin1Copy;
         }
@@ -148,7 +152,7 @@ namespace brick {
     NormalizedCorrelator<Type>::
     clear()
     {
-      if(this->isInputTrackingEnabled) {
+      if(this->isInputTrackingEnabled()) {
         // Clear input tracking cache by re-enabling.  The
         // documentation above says this has undefined result, but
         // because we control the implementation, it's ok for us to
@@ -171,28 +175,19 @@ namespace brick {
     template <class Type>
     void
     NormalizedCorrelator<Type>::
-    enableInputTracking(bool trackInput)
+    enableInputTracking(bool trackInput, size_t windowSize)
     {
+      m_inputHead = 0;
+      m_inputSize = 0;
+      m_isTrackingInput = trackInput;
       if(trackInput) {
-        if(m_inputTracker0Ptr == 0) {
-          m_inputTracker0Ptr = new std::deque<Type>;
-        } else {
-          m_inputTracker0Ptr->clear();
-        }
-        if(m_inputTracker1Ptr == 0) {
-          m_inputTracker1Ptr = new std::deque<Type>;
-        } else {
-          m_inputTracker1Ptr->clear();
+        if(m_inputRing0.size() < windowSize) {
+          m_inputRing0.resize(windowSize);
+          m_inputRing1.resize(windowSize);
         }
       } else {
-        if(m_inputTracker0Ptr != 0) {
-          delete m_inputTracker0Ptr;
-          m_inputTracker0Ptr = 0;
-        }
-        if(m_inputTracker1Ptr != 0) {
-          delete m_inputTracker1Ptr;
-          m_inputTracker1Ptr = 0;
-        }
+        std::vector<Type>().swap(m_inputRing0);
+        std::vector<Type>().swap(m_inputRing1);
       }
     }
 
@@ -241,7 +236,7 @@ namespace brick {
                     "NormalizedCorrelator instance that does not have "
                     "input tracking enabled.");
       }
-      if(count > (m_inputTracker0Ptr->size())) {
+      if(count > m_inputSize) {
         BRICK_THROW(brick::common::ValueException,
                     "NormalizedCorrelator::removeInputSamples()",
                     "Trying to remove more samples than have been added.");
@@ -250,10 +245,12 @@ namespace brick {
         // Warning(xxx): if this call is changed to removeSample(),
         // then no tests fail, but calls to removeOldestSamples() will
         // throw.
-        this->removeSampleWithoutTracking(m_inputTracker0Ptr->front(),
-                                          m_inputTracker1Ptr->front());
-        m_inputTracker0Ptr->pop_front();
-        m_inputTracker1Ptr->pop_front();
+        this->removeSampleWithoutTracking(m_inputRing0[m_inputHead],
+                                          m_inputRing1[m_inputHead]);
+        if(++m_inputHead == m_inputRing0.size()) {
+          m_inputHead = 0;
+        }
+        --m_inputSize;
         --count;
       }
     }
@@ -317,6 +314,39 @@ namespace brick {
     }
 
 
+    // This private member function appends a pair of samples to the
+    // input tracking ring buffer, growing the buffer if it is full.
+    template <class Type>
+    void
+    NormalizedCorrelator<Type>::
+    pushTrackedSample(Type sample0, Type sample1)
+    {
+      size_t capacity = m_inputRing0.size();
+      if(m_inputSize == capacity) {
+        // Unroll the ring into larger buffers, oldest sample first.
+        size_t newCapacity = (capacity < 8) ? 16 : 2 * capacity;
+        std::vector<Type> newRing0(newCapacity);
+        std::vector<Type> newRing1(newCapacity);
+        for(size_t ii = 0; ii < m_inputSize; ++ii) {
+          size_t index = (m_inputHead + ii) % capacity;
+          newRing0[ii] = m_inputRing0[index];
+          newRing1[ii] = m_inputRing1[index];
+        }
+        m_inputRing0.swap(newRing0);
+        m_inputRing1.swap(newRing1);
+        m_inputHead = 0;
+        capacity = newCapacity;
+      }
+      size_t tail = m_inputHead + m_inputSize;
+      if(tail >= capacity) {
+        tail -= capacity;
+      }
+      m_inputRing0[tail] = sample0;
+      m_inputRing1[tail] = sample1;
+      ++m_inputSize;
+    }
+
+
   } // namespace numeric
 
 } // namespace brick
@@ -200,6 +200,53 @@ namespace brick {
                   Vector2D<FloatType> const& corner1);
 
 
+      /**
+       * This member function evaluates the interpolating function at
+       * every point of a rectilinear grid.  It is much faster than
+       * calling operator()(FloatType, FloatType) for each grid point.
+       * See BSpline2D::evaluateGrid() for details.
+       *
+       * @param sValues This argument specifies the S coordinates of
+       * the grid columns.
+       *
+       * @param tValues This argument specifies the T coordinates of
+       * the grid rows.
+       *
+       * @param outputValues This argument is used to return the
+       * result, with shape (tValues.size(), sValues.size()).
+       */
+      void
+      evaluateGrid(Array1D<FloatType> const& sValues,
+                   Array1D<FloatType> const& tValues,
+                   Array2D<Type>& outputValues) const;
+
+
+      /**
+       * This member function evaluates the interpolating function at
+       * each of a sequence of (S, T) points, using the number of
+       * threads specified by setNumberOfThreads().
+       *
+       * @param sBegin This iterator specifies the beginning of a
+       * sequence of S coordinates.  It must be a random access
+       * iterator.
+       *
+       * @param sEnd This iterator specifies the end of the sequence
+       * of S coordinates.
+       *
+       * @param tBegin This iterator specifies the beginning of the
+       * corresponding sequence of T coordinates.
+       *
+       * @param outputBegin This iterator specifies where to write
+       * the (sEnd - sBegin) results.  It must be a random access
+       * iterator.
+       */
+      template <class CoordIter, class OutputIter>
+      void
+      evaluateMany(CoordIter sBegin, CoordIter sEnd,
+                   CoordIter tBegin,
+                   OutputIter outputBegin) const;
+
+
       /**
        * This member function returns the maximum value for the
        * interpolating function parameters S and T.  Calling
@@ -233,6 +280,23 @@ namespace brick {
       getMinimumSAndTValues(FloatType& minimumS, FloatType& minimumT) const;
 
 
+      /**
+       * This member function sets how many threads will be used to
+       * fit the B-spline at each level of refinement, to compute
+       * residuals between levels, and by evaluateMany().  Levels
+       * themselves are refined one after another, since each depends
+       * on the residuals of the last.
+       *
+       * @param numberOfThreads This argument specifies the number of
+       * threads.  Setting it to 0 means "use one thread per core."
+       * The default is 1.
+       */
+      void
+      setNumberOfThreads(size_t numberOfThreads) {
+        this->m_bSpline2D.setNumberOfThreads(numberOfThreads);
+      }
+
+
       /**
        * This member function specifies a functor that is used to
        * test the quality of the approximation.  At each iteration (up
@@ -130,22 +130,12 @@ namespace brick {
 
         // Subtract the best-so-far interpolation from the observations
         // to get a residual, which will be interpolated below.
-        CoordIter sIter = sBegin;
-        CoordIter tIter = tBegin;
-        typename Array1D<Type>::const_iterator obsIter =
-          shiftedObservations.begin();
-        typename Array1D<Type>::iterator residualsIter =
-          residuals.begin();
-
+        this->m_bSpline2D.evaluateMany(sBegin, sEnd, tBegin, residuals.begin());
         bool isTerminationOk = true;
-        while(sIter != sEnd) {
-          *residualsIter = *obsIter - this->m_bSpline2D(*sIter, *tIter);
+        for(size_t index0 = 0; index0 < residuals.size(); ++index0) {
+          residuals[index0] = shiftedObservations[index0] - residuals[index0];
           isTerminationOk = (isTerminationOk
-                             && this->m_testFunctor(*residualsIter));
-          ++residualsIter;
-          ++obsIter;
-          ++sIter;
-          ++tIter;
+                             && this->m_testFunctor(residuals[index0]));
         }
 
         // If all residuals are acceptable, then there's no sense in
@@ -168,6 +158,8 @@ namespace brick {
           this->m_bSpline2D.getIsIsotropic());
         residualInterpolator.setNumberOfNodes(numberOfNodesS,
                                               numberOfNodesT);
+        residualInterpolator.setNumberOfThreads(
+          this->m_bSpline2D.getNumberOfThreads());
         residualInterpolator.approximateScatteredData(
           sBegin, sEnd, tBegin, residuals.begin(), corner0, corner1);
 
@@ -178,6 +170,39 @@ namespace brick {
     }
 
 
+    // This member function evaluates the interpolating function at
+    // every point of a rectilinear grid.
+    template <class Type, class FloatType, class TestType>
+    void
+    ScatteredDataInterpolator2D<Type, FloatType, TestType>::
+    evaluateGrid(Array1D<FloatType> const& sValues,
+                 Array1D<FloatType> const& tValues,
+                 Array2D<Type>& outputValues) const
+    {
+      this->m_bSpline2D.evaluateGrid(sValues, tValues, outputValues);
+      outputValues += this->m_meanValue;
+    }
+
+
+    // This member function evaluates the interpolating function at
+    // each of a sequence of (S, T) points.
+    template <class Type, class FloatType, class TestType>
+    template <class CoordIter, class OutputIter>
+    void
+    ScatteredDataInterpolator2D<Type, FloatType, TestType>::
+    evaluateMany(CoordIter sBegin, CoordIter sEnd,
+                 CoordIter tBegin,
+                 OutputIter outputBegin) const
+    {
+      this->m_bSpline2D.evaluateMany(sBegin, sEnd, tBegin, outputBegin);
+      size_t const numberOfPoints = sEnd - sBegin;
+      for(size_t index0 = 0; index0 < numberOfPoints; ++index0) {
+        *outputBegin += this->m_meanValue;
+        ++outputBegin;
+      }
+    }
+
+
     // This member function returns the maximum values for the spline
     // parameters S and T.
     template <class Type, class FloatType, class TestType>
@@ -210,9 +235,10 @@ namespace brick {
         this->m_bSpline2D = other.m_bSpline2D;
         this->m_isMeanCentered = other.m_isMeanCentered;
         this->m_meanValue = other.m_meanValue;
-        this->m_numerOfLevels = other.m_numberOfLevels;
+        this->m_numberOfLevels = other.m_numberOfLevels;
         this->m_testFunctor = other.m_testFunctor;
       }
+      return *this;
     }
 
 
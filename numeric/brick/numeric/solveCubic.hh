@@ -14,6 +14,7 @@
 #ifndef BRICK_NUMERIC_SOLVECUBIC_HH
 #define BRICK_NUMERIC_SOLVECUBIC_HH
 
+#include <cstddef>
 #include <brick/common/complexNumber.hh>
 
 namespace brick {
@@ -85,6 +86,48 @@ namespace brick {
                brick::common::ComplexNumber<Type>& root2);
 
 
+    /**
+     * This function is a batched version of the real-valued
+     * solveCubic().  It solves many cubics of the form x^3 + c0*x^2 +
+     * c1*x + c2 = 0 at once, with coefficients and roots stored in
+     * separate arrays (structure-of-arrays layout).  The loop body
+     * has no data-dependent branches, so compilers that provide
+     * vectorized versions of acos(), cos(), and cbrt() can process
+     * several equations per SIMD register.
+     *
+     * @param numberOfEquations This argument specifies how many
+     * equations to solve.  Each of the remaining arguments must point
+     * to at least this many elements.
+     *
+     * @param c0 This argument points to the quadratic coefficients.
+     *
+     * @param c1 This argument points to the linear coefficients.
+     *
+     * @param c2 This argument points to the constant coefficients.
+     *
+     * @param root0 This argument is used to return the first real
+     * root of each equation.
+     *
+     * @param root1 This argument is used to return the second real
+     * root of each equation.  If the equation has only one real
+     * root, the corresponding element is set equal to root0.
+     *
+     * @param root2 This argument is used to return the third real
+     * root of each equation.  If the equation has only one real
+     * root, the corresponding element is set equal to root0.
+     *
+     * @param hasThreeRealRoots This argument is used to return, for
+     * each equation, the value that the real-valued solveCubic()
+     * would have returned.
+     */
+    template <class Type>
+    void
+    solveCubicBatch(std::size_t numberOfEquations,
+                    Type const* c0, Type const* c1, Type const* c2,
+                    Type* root0, Type* root1, Type* root2,
+                    bool* hasThreeRealRoots);
+
+
   } // namespace numeric
 
 } // namespace brick
@@ -20,6 +20,7 @@
 //
 // #include <brick/numeric/solveCubic.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <brick/common/constants.hh>
 #include <brick/numeric/mathFunctions.hh>
@@ -137,6 +138,68 @@ namespace brick {
       }
     }
 
+
+    // This function is a batched version of the real-valued
+    // solveCubic().
+    template <class Type>
+    void
+    solveCubicBatch(std::size_t numberOfEquations,
+                    Type const* c0, Type const* c1, Type const* c2,
+                    Type* root0, Type* root1, Type* root2,
+                    bool* hasThreeRealRoots)
+    {
+      // Same formulation as the scalar version, above, except that
+      // we compute both the three-root and one-root answers for every
+      // equation and select between them, rather than branching.
+      // Arguments to acos() and sqrt() are clamped so that the
+      // discarded answer never generates NaNs.
+      Type const twoPiOverThree =
+        Type(2.0 * brick::common::constants::pi / 3.0);
+      for(std::size_t ii = 0; ii < numberOfEquations; ++ii) {
+        Type const c0Squared = c0[ii] * c0[ii];
+        Type const qq = ((c0Squared - (Type(3.0) * c1[ii])) / Type(9.0));
+        Type const rr = ((Type(2.0) * c0Squared * c0[ii]
+                          - Type(9.0) * c0[ii] * c1[ii]
+                          + Type(27.0) * c2[ii])
+                         / Type(54.0));
+        Type const rrSquared = rr * rr;
+        Type const qqCubed = qq * qq * qq;
+        Type const c0OverThree = c0[ii] / Type(3.0);
+        bool const isThreeRoot = rrSquared < qqCubed;
+
+        // Three real roots.
+        Type const safeQq = isThreeRoot ? qq : Type(1.0);
+        Type const rootQq = std::sqrt(safeQq);
+        Type cosine = rr / (safeQq * rootQq);
+        cosine = std::max(Type(-1.0), std::min(Type(1.0), cosine));
+        Type const thetaOverThree = std::acos(cosine) / Type(3.0);
+        Type const minusTwoRootQq = Type(-2.0) * rootQq;
+        Type const trigRoot0 =
+          minusTwoRootQq * std::cos(thetaOverThree) - c0OverThree;
+        Type const trigRoot1 =
+          (minusTwoRootQq * std::cos(thetaOverThree + twoPiOverThree)
+           - c0OverThree);
+        Type const trigRoot2 =
+          (minusTwoRootQq * std::cos(thetaOverThree - twoPiOverThree)
+           - c0OverThree);
+
+        // One real root.
+        Type const discriminant =
+          std::max(rrSquared - qqCubed, Type(0.0));
+        Type const absRr = std::abs(rr);
+        Type aa = std::cbrt(absRr + std::sqrt(discriminant));
+        aa = (rr > Type(0.0)) ? -aa : aa;
+        Type const safeAa = (aa == Type(0.0)) ? Type(1.0) : aa;
+        Type const bb = (aa == Type(0.0)) ? Type(0.0) : (qq / safeAa);
+        Type const cardanoRoot = (aa + bb) - c0OverThree;
+
+        root0[ii] = isThreeRoot ? trigRoot0 : cardanoRoot;
+        root1[ii] = isThreeRoot ? trigRoot1 : cardanoRoot;
+        root2[ii] = isThreeRoot ? trigRoot2 : cardanoRoot;
+        hasThreeRealRoots[ii] = isThreeRoot;
+      }
+    }
+
   } // namespace numeric
 
 } // namespace brick
@@ -0,0 +1,65 @@
+/**
+***************************************************************************
+* @file brick/numeric/solvePolynomial.hh
+*
+* Header file declaring a function for finding the real roots of
+* fixed-order polynomials.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_SOLVEPOLYNOMIAL_HH
+#define BRICK_NUMERIC_SOLVEPOLYNOMIAL_HH
+
+#include <cstddef>
+#include <brick/numeric/staticArray1D.hh>
+#include <brick/numeric/staticPolynomial.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     * This function computes the distinct real roots of a polynomial,
+     * such as the degree 10 polynomial that arises in the five-point
+     * relative pose problem.  Complex roots are not computed.
+     *
+     * The roots are isolated by bisection using a Sturm sequence,
+     * and each isolated root is then polished using a safeguarded
+     * Newton iteration.  Unlike the companion matrix approach, this
+     * involves no eigenvalue decomposition and no heap allocation,
+     * and it never wastes effort on complex roots.
+     *
+     * Leading coefficients of the polynomial may be zero, in which
+     * case the polynomial is treated as having lower order.  A
+     * polynomial that is zero everywhere is reported as having no
+     * roots.  Repeated roots are reported only once.  Note that a
+     * root of multiplicity m is only determined to a relative
+     * accuracy of about epsilon^(1/m).
+     *
+     * @param polynomial This argument is the polynomial to be solved.
+     *
+     * @param roots This argument is used to return the real roots,
+     * sorted in ascending order.  Only the first N elements, where N
+     * is the return value, are set.
+     *
+     * @return The return value is the number of distinct real roots
+     * found.
+     */
+    template <class Type, std::size_t Order>
+    std::size_t
+    solvePolynomial(StaticPolynomial<Type, Order> const& polynomial,
+                    StaticArray1D<Type, Order>& roots);
+
+  } // namespace numeric
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/solvePolynomial_impl.hh>
+
+#endif /* #ifndef BRICK_NUMERIC_SOLVEPOLYNOMIAL_HH */
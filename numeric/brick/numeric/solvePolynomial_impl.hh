@@ -0,0 +1,386 @@
+/**
+***************************************************************************
+* @file brick/numeric/solvePolynomial_impl.hh
+*
+* Header file defining inline and template functions declared in
+* solvePolynomial.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_SOLVEPOLYNOMIAL_IMPL_HH
+#define BRICK_NUMERIC_SOLVEPOLYNOMIAL_IMPL_HH
+
+// This file is included by solvePolynomial.hh, and should not be
+// directly included by user code, so no need to include
+// solvePolynomial.hh here.
+//
+// #include <brick/numeric/solvePolynomial.hh>
+
+#include <algorithm>
+#include <brick/numeric/mathFunctions.hh>
+#include <brick/numeric/numericTraits.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // A Sturm sequence for a polynomial of order at most Order.
+      // The first element of the sequence is the (monic) polynomial
+      // itself, the second is its derivative, and each subsequent
+      // element is the negated remainder of dividing the previous
+      // two.  All storage is on the stack.
+      template <class Type, std::size_t Order>
+      class SturmSequence {
+      public:
+
+        // Build the sequence.  Returns false if polynomial is
+        // constant (including identically zero).
+        bool
+        initialize(StaticPolynomial<Type, Order> const& polynomial);
+
+        // Count the sign changes in the sequence at xValue.  By
+        // Sturm's theorem, (countSignChanges(a) - countSignChanges(b))
+        // is the number of distinct real roots in (a, b].
+        std::size_t
+        countSignChanges(Type xValue) const;
+
+        // Evaluate the first element of the sequence.
+        Type
+        evaluate(Type xValue) const {
+          return this->evaluateElement(0, xValue);
+        }
+
+        // Evaluate the first element of the sequence and its
+        // derivative.
+        Type
+        evaluate(Type xValue, Type& derivative) const;
+
+        // Return a bound, B, such that all real roots lie in (-B, B).
+        Type
+        getRootBound() const;
+
+      private:
+
+        // Evaluate the specified element of the sequence.
+        Type
+        evaluateElement(std::size_t index, Type xValue) const;
+
+        Type m_coefficients[Order + 1][Order + 1];
+        std::size_t m_orders[Order + 1];
+        std::size_t m_length;
+      };
+
+
+      template <class Type, std::size_t Order>
+      bool
+      SturmSequence<Type, Order>::
+      initialize(StaticPolynomial<Type, Order> const& polynomial)
+      {
+        // Find the true order of the polynomial.
+        std::size_t order = Order;
+        while(order > 0 && polynomial.getCoefficient(order) == Type(0)) {
+          --order;
+        }
+        if(order == 0) {
+          return false;
+        }
+
+        // The first element is the polynomial itself, scaled to be
+        // monic.  This doesn't move the roots, and the rest of the
+        // sequence is built from the scaled version.  Later elements
+        // are only ever scaled by positive constants, which doesn't
+        // change any signs.
+        Type const leadingCoefficient = polynomial.getCoefficient(order);
+        for(std::size_t ii = 0; ii <= order; ++ii) {
+          m_coefficients[0][ii] =
+            polynomial.getCoefficient(ii) / leadingCoefficient;
+        }
+        m_orders[0] = order;
+
+        // The second element is the derivative, also scaled to be
+        // monic.
+        for(std::size_t ii = 1; ii <= order; ++ii) {
+          m_coefficients[1][ii - 1] =
+            (static_cast<Type>(ii) * m_coefficients[0][ii]
+             / static_cast<Type>(order));
+        }
+        m_orders[1] = order - 1;
+        m_length = 2;
+
+        // Remaining elements are negated remainders.
+        Type remainder[Order + 1];
+        Type const epsilon = NumericTraits<Type>::epsilon();
+        while(m_orders[m_length - 1] > 0) {
+          Type const* dividend = m_coefficients[m_length - 2];
+          Type const* divisor = m_coefficients[m_length - 1];
+          std::size_t const dividendOrder = m_orders[m_length - 2];
+          std::size_t const divisorOrder = m_orders[m_length - 1];
+
+          // Long division.  The leading coefficient of the divisor
+          // is +/-1, so dividing by it is exact, but we can't skip
+          // it: if it's -1, skipping it would flip the sign of each
+          // quotient term.  We keep track of the largest term we see
+          // so that we can recognize remainder coefficients that are
+          // just roundoff.
+          Type magnitude(0);
+          for(std::size_t ii = 0; ii <= dividendOrder; ++ii) {
+            remainder[ii] = dividend[ii];
+            magnitude = std::max(magnitude, absoluteValue(dividend[ii]));
+          }
+          for(std::size_t jj = dividendOrder - divisorOrder + 1; jj > 0; --jj) {
+            Type const factor = (remainder[jj - 1 + divisorOrder]
+                                 / divisor[divisorOrder]);
+            for(std::size_t ii = 0; ii <= divisorOrder; ++ii) {
+              Type const term = factor * divisor[ii];
+              remainder[jj - 1 + ii] -= term;
+              magnitude = std::max(magnitude, absoluteValue(term));
+            }
+          }
+
+          // Find the order of the remainder.  If it's zero
+          // everywhere, the polynomial has repeated roots, and the
+          // last element of the sequence is the GCD of the polynomial
+          // and its derivative.  The sequence is complete.
+          Type const threshold = (
+            magnitude * Type(32) * epsilon
+            * static_cast<Type>(dividendOrder + 1));
+          std::size_t remainderOrder = divisorOrder;
+          while(remainderOrder > 0
+                && absoluteValue(remainder[remainderOrder - 1]) <= threshold) {
+            --remainderOrder;
+          }
+          if(remainderOrder == 0) {
+            break;
+          }
+          --remainderOrder;
+
+          // Negate, and normalize so that the leading coefficient is
+          // +/-1.  The scale factor must be negative, rather than
+          // chosen to make the result monic, or the sign changes
+          // that Sturm's theorem counts would be wrong.
+          Type const scale =
+            Type(-1) / absoluteValue(remainder[remainderOrder]);
+          for(std::size_t ii = 0; ii <= remainderOrder; ++ii) {
+            m_coefficients[m_length][ii] = remainder[ii] * scale;
+          }
+          m_orders[m_length] = remainderOrder;
+          ++m_length;
+        }
+        return true;
+      }
+
+
+      template <class Type, std::size_t Order>
+      std::size_t
+      SturmSequence<Type, Order>::
+      countSignChanges(Type xValue) const
+      {
+        std::size_t count = 0;
+        int previousSign = 0;
+        for(std::size_t ii = 0; ii < m_length; ++ii) {
+          Type value = this->evaluateElement(ii, xValue);
+          if(value != Type(0)) {
+            int sign = (value > Type(0)) ? 1 : -1;
+            if(previousSign != 0 && sign != previousSign) {
+              ++count;
+            }
+            previousSign = sign;
+          }
+        }
+        return count;
+      }
+
+
+      template <class Type, std::size_t Order>
+      Type
+      SturmSequence<Type, Order>::
+      evaluate(Type xValue, Type& derivative) const
+      {
+        Type const* coefficients = m_coefficients[0];
+        Type result = coefficients[m_orders[0]];
+        derivative = Type(0);
+        for(std::size_t ii = m_orders[0]; ii > 0; --ii) {
+          derivative = derivative * xValue + result;
+          result = result * xValue + coefficients[ii - 1];
+        }
+        return result;
+      }
+
+
+      template <class Type, std::size_t Order>
+      Type
+      SturmSequence<Type, Order>::
+      getRootBound() const
+      {
+        // Cauchy's bound for a monic polynomial.
+        Type bound(0);
+        for(std::size_t ii = 0; ii < m_orders[0]; ++ii) {
+          bound = std::max(bound, absoluteValue(m_coefficients[0][ii]));
+        }
+        return bound + Type(1);
+      }
+
+
+      template <class Type, std::size_t Order>
+      Type
+      SturmSequence<Type, Order>::
+      evaluateElement(std::size_t index, Type xValue) const
+      {
+        Type const* coefficients = m_coefficients[index];
+        Type result = coefficients[m_orders[index]];
+        for(std::size_t ii = m_orders[index]; ii > 0; --ii) {
+          result = result * xValue + coefficients[ii - 1];
+        }
+        return result;
+      }
+
+
+      // Polish the single root known to lie in (lowerBound,
+      // upperBound].  Where the polynomial changes sign across the
+      // interval, we use Newton's method, falling back to bisection
+      // whenever a Newton step would leave the bracket or converge
+      // too slowly (see "rtsafe" in Press et al., "Numerical
+      // Recipes").  Roots of even multiplicity don't give a sign
+      // change, so for those we bisect on the Sturm count instead.
+      template <class Type, std::size_t Order>
+      Type
+      refineSturmRoot(SturmSequence<Type, Order> const& sequence,
+                      Type lowerBound, Type upperBound,
+                      std::size_t lowerCount)
+      {
+        Type const epsilon = NumericTraits<Type>::epsilon();
+        Type lowerValue = sequence.evaluate(lowerBound);
+        Type upperValue = sequence.evaluate(upperBound);
+        if(upperValue == Type(0)) {
+          return upperBound;
+        }
+
+        if((lowerValue < Type(0)) == (upperValue < Type(0))) {
+          while(1) {
+            Type middle = (lowerBound + upperBound) / Type(2);
+            if(middle <= lowerBound || middle >= upperBound) {
+              return middle;
+            }
+            if(sequence.countSignChanges(middle) < lowerCount) {
+              upperBound = middle;
+            } else {
+              lowerBound = middle;
+            }
+          }
+        }
+
+        Type xValue = (lowerBound + upperBound) / Type(2);
+        Type stepSize = upperBound - lowerBound;
+        Type previousStepSize = stepSize;
+        Type derivative;
+        Type value = sequence.evaluate(xValue, derivative);
+        for(std::size_t iteration = 0; iteration < 200; ++iteration) {
+          if((((xValue - upperBound) * derivative - value)
+              * ((xValue - lowerBound) * derivative - value)) > Type(0)
+             || (absoluteValue(Type(2) * value)
+                 > absoluteValue(previousStepSize * derivative))) {
+            previousStepSize = stepSize;
+            stepSize = (upperBound - lowerBound) / Type(2);
+            xValue = lowerBound + stepSize;
+          } else {
+            previousStepSize = stepSize;
+            stepSize = value / derivative;
+            xValue -= stepSize;
+          }
+          if(absoluteValue(stepSize)
+             <= epsilon * (absoluteValue(xValue) + epsilon)) {
+            break;
+          }
+          value = sequence.evaluate(xValue, derivative);
+          if(value == Type(0)) {
+            break;
+          }
+          if((value < Type(0)) == (lowerValue < Type(0))) {
+            lowerBound = xValue;
+          } else {
+            upperBound = xValue;
+          }
+        }
+        return xValue;
+      }
+
+
+      // Recursively bisect (lowerBound, upperBound] until each piece
+      // contains at most one distinct root, then polish the roots.
+      template <class Type, std::size_t Order>
+      void
+      isolateSturmRoots(SturmSequence<Type, Order> const& sequence,
+                        Type lowerBound, Type upperBound,
+                        std::size_t lowerCount, std::size_t upperCount,
+                        StaticArray1D<Type, Order>& roots,
+                        std::size_t& numberOfRoots)
+      {
+        // The count can only decrease from left to right, but guard
+        // against roundoff in the sequence anyway, and never report
+        // more roots than the polynomial can have.
+        if(lowerCount <= upperCount || numberOfRoots >= Order) {
+          return;
+        }
+        std::size_t const rootsInInterval = lowerCount - upperCount;
+        if(rootsInInterval == 1) {
+          roots[numberOfRoots] = refineSturmRoot(
+            sequence, lowerBound, upperBound, lowerCount);
+          ++numberOfRoots;
+          return;
+        }
+
+        Type middle = (lowerBound + upperBound) / Type(2);
+        if(middle <= lowerBound || middle >= upperBound) {
+          // The roots are closer together than we can resolve.
+          for(std::size_t ii = 0;
+              ii < rootsInInterval && numberOfRoots < Order; ++ii) {
+            roots[numberOfRoots] = middle;
+            ++numberOfRoots;
+          }
+          return;
+        }
+        std::size_t const middleCount = sequence.countSignChanges(middle);
+        isolateSturmRoots(sequence, lowerBound, middle,
+                          lowerCount, middleCount, roots, numberOfRoots);
+        isolateSturmRoots(sequence, middle, upperBound,
+                          middleCount, upperCount, roots, numberOfRoots);
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // This function computes the distinct real roots of a
+    // polynomial.
+    template <class Type, std::size_t Order>
+    std::size_t
+    solvePolynomial(StaticPolynomial<Type, Order> const& polynomial,
+                    StaticArray1D<Type, Order>& roots)
+    {
+      static_assert(Order > 0, "solvePolynomial() requires Order > 0.");
+
+      privateCode::SturmSequence<Type, Order> sequence;
+      if(!sequence.initialize(polynomial)) {
+        return 0;
+      }
+
+      Type const bound = sequence.getRootBound();
+      std::size_t numberOfRoots = 0;
+      privateCode::isolateSturmRoots(
+        sequence, -bound, bound, sequence.countSignChanges(-bound),
+        sequence.countSignChanges(bound), roots, numberOfRoots);
+      return numberOfRoots;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_SOLVEPOLYNOMIAL_IMPL_HH */
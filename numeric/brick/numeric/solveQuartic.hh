@@ -14,6 +14,7 @@
 #ifndef BRICK_NUMERIC_SOLVEQUARTIC_HH
 #define BRICK_NUMERIC_SOLVEQUARTIC_HH
 
+#include <cstddef>
 #include <brick/common/complexNumber.hh>
 
 namespace brick {
@@ -57,6 +58,49 @@ namespace brick {
                  brick::common::ComplexNumber<Type>& root3);
 
 
+    /**
+     * This function is a batched version of solveQuartic().  It
+     * solves many quartics of the form x^4 + c0*x^3 + c1*x^2 + c2*x +
+     * c3 = 0 at once, with coefficients and roots stored in separate
+     * arrays (structure-of-arrays layout), and without using complex
+     * arithmetic.  The main loop has no data-dependent branches, so
+     * compilers that provide vectorized math functions can process
+     * several equations per SIMD register.  Nearly biquadratic
+     * equations, for which this formulation is inaccurate, are
+     * re-solved using solveQuartic() in a separate pass.
+     *
+     * @param numberOfEquations This argument specifies how many
+     * equations to solve.  Each of the coefficient arguments must
+     * point to at least this many elements.
+     *
+     * @param c0 This argument points to the cubic coefficients.
+     *
+     * @param c1 This argument points to the quadratic coefficients.
+     *
+     * @param c2 This argument points to the linear coefficients.
+     *
+     * @param c3 This argument points to the constant coefficients.
+     *
+     * @param realParts This argument must point to (4 *
+     * numberOfEquations) elements, and is used to return the real
+     * parts of the roots.  The real part of the k-th root of the i-th
+     * equation is returned in element (k * numberOfEquations + i),
+     * so that each root occupies its own contiguous block.
+     *
+     * @param imaginaryParts This argument must point to (4 *
+     * numberOfEquations) elements, and is used to return the
+     * imaginary parts of the roots, arranged in the same way as
+     * argument realParts.  Real roots have imaginary part exactly
+     * zero.
+     */
+    template <class Type>
+    void
+    solveQuarticBatch(std::size_t numberOfEquations,
+                      Type const* c0, Type const* c1,
+                      Type const* c2, Type const* c3,
+                      Type* realParts, Type* imaginaryParts);
+
+
   } // namespace numeric
 
 } // namespace brick
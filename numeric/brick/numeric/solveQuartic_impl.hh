@@ -20,7 +20,9 @@
 //
 // #include <brick/numeric/solveQuartic.hh>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <brick/common/constants.hh>
 #include <brick/numeric/solveCubic.hh>
 #include <brick/numeric/solveQuadratic.hh>
@@ -150,6 +152,163 @@ namespace brick {
       root3 = r1 - c0 / Type(4.0);
     }
 
+
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Solve x^2 + bb*x + cc = 0 for real bb and cc, without
+      // branching, returning the roots as real and imaginary parts.
+      template <class Type>
+      inline void
+      solveRealQuadraticBranchless(Type bb, Type cc,
+                                   Type& real0, Type& imaginary0,
+                                   Type& real1, Type& imaginary1)
+      {
+        Type const discriminant = bb * bb - Type(4.0) * cc;
+        bool const isReal = discriminant >= Type(0.0);
+        Type const rootDiscriminant = std::sqrt(std::abs(discriminant));
+
+        // Real roots, computed in the numerically stable way (see
+        // Press et al, "Numerical Recipes").
+        Type const tt = Type(-0.5) * (bb + std::copysign(rootDiscriminant, bb));
+        Type const safeTt = (tt == Type(0.0)) ? Type(1.0) : tt;
+        Type const otherRoot = (tt == Type(0.0)) ? Type(0.0) : (cc / safeTt);
+
+        // Complex conjugate roots.
+        Type const realPart = Type(-0.5) * bb;
+        Type const imaginaryPart = Type(0.5) * rootDiscriminant;
+
+        real0 = isReal ? tt : realPart;
+        real1 = isReal ? otherRoot : realPart;
+        imaginary0 = isReal ? Type(0.0) : imaginaryPart;
+        imaginary1 = isReal ? Type(0.0) : -imaginaryPart;
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // This function is a batched version of solveQuartic().
+    template <class Type>
+    void
+    solveQuarticBatch(std::size_t numberOfEquations,
+                      Type const* c0, Type const* c1,
+                      Type const* c2, Type const* c3,
+                      Type* realParts, Type* imaginaryParts)
+    {
+      Type const twoPiOverThree =
+        Type(2.0 * brick::common::constants::pi / 3.0);
+      Type const tolerance = std::sqrt(std::numeric_limits<Type>::epsilon());
+      Type const notANumber = std::numeric_limits<Type>::quiet_NaN();
+      Type* real0 = realParts;
+      Type* real1 = real0 + numberOfEquations;
+      Type* real2 = real1 + numberOfEquations;
+      Type* real3 = real2 + numberOfEquations;
+      Type* imaginary0 = imaginaryParts;
+      Type* imaginary1 = imaginary0 + numberOfEquations;
+      Type* imaginary2 = imaginary1 + numberOfEquations;
+      Type* imaginary3 = imaginary2 + numberOfEquations;
+
+      for(std::size_t ii = 0; ii < numberOfEquations; ++ii) {
+        // Depressed quartic, exactly as in solveQuartic().
+        Type const c0Squared = c0[ii] * c0[ii];
+        Type const c0Cubed = c0Squared * c0[ii];
+        Type const minus3C0Squared = Type(-3.0) * c0Squared;
+        Type const alpha = (minus3C0Squared / Type(8.0)) + c1[ii];
+        Type const beta = ((c0Cubed / Type(8.0))
+                           - ((c0[ii] * c1[ii]) / Type(2.0)) + c2[ii]);
+        Type const gamma = (((minus3C0Squared * c0Squared) / Type(256.0))
+                            + ((c0Squared * c1[ii]) / Type(16.0))
+                            - ((c0[ii] * c2[ii]) / Type(4.0))
+                            + c3[ii]);
+
+        // The resolvent cubic P^3 + 2*alpha*P^2 + (alpha^2 -
+        // 4*gamma)*P - beta^2 = 0 is negative at P = 0 and positive
+        // for large P, so it always has a non-negative real root.
+        // Where solveQuartic() picks the root of largest magnitude
+        // (which may be complex), we pick the largest real root,
+        // which keeps everything below in real arithmetic.
+        Type const k0 = Type(2.0) * alpha;
+        Type const k1 = alpha * alpha - Type(4.0) * gamma;
+        Type const k2 = -(beta * beta);
+        Type const k0Squared = k0 * k0;
+        Type const qq = (k0Squared - Type(3.0) * k1) / Type(9.0);
+        Type const rr = ((Type(2.0) * k0Squared * k0 - Type(9.0) * k0 * k1
+                          + Type(27.0) * k2) / Type(54.0));
+        Type const rrSquared = rr * rr;
+        Type const qqCubed = qq * qq * qq;
+        bool const isThreeRoot = rrSquared < qqCubed;
+
+        // With three real roots, the largest is the one that uses
+        // (theta + 2*pi) / 3.  See solveCubicBatch().
+        Type const safeQq = isThreeRoot ? qq : Type(1.0);
+        Type const rootQq = std::sqrt(safeQq);
+        Type cosine = rr / (safeQq * rootQq);
+        cosine = std::max(Type(-1.0), std::min(Type(1.0), cosine));
+        Type const trigRoot =
+          (Type(-2.0) * rootQq
+           * std::cos(std::acos(cosine) / Type(3.0) + twoPiOverThree)
+           - k0 / Type(3.0));
+
+        Type const discriminant = std::max(rrSquared - qqCubed, Type(0.0));
+        Type aa = std::cbrt(std::abs(rr) + std::sqrt(discriminant));
+        aa = (rr > Type(0.0)) ? -aa : aa;
+        Type const safeAa = (aa == Type(0.0)) ? Type(1.0) : aa;
+        Type const bb = (aa == Type(0.0)) ? Type(0.0) : (qq / safeAa);
+        Type const cardanoRoot = (aa + bb) - k0 / Type(3.0);
+
+        Type const pSquared =
+          std::max(isThreeRoot ? trigRoot : cardanoRoot, Type(0.0));
+
+        // If the resolvent root is (nearly) zero, then beta is
+        // (nearly) zero, and beta / p below is inaccurate.  These
+        // equations are rare, so rather than branch here, we flag
+        // them with a NaN and hand them to the scalar solver in a
+        // second pass.
+        Type const scale = std::abs(alpha) + std::sqrt(std::abs(gamma));
+        bool const isDegenerate = pSquared <= tolerance * scale;
+
+        // Recover p, s, and q as in solveQuartic(), and solve the
+        // two quadratic factors.
+        Type const pp = isDegenerate ? Type(1.0) : std::sqrt(pSquared);
+        Type const alphaPlusPpSquared = alpha + pSquared;
+        Type const betaOverPp = beta / pp;
+        Type const ss = (alphaPlusPpSquared + betaOverPp) / Type(2.0);
+        Type const qqFactor = (alphaPlusPpSquared - betaOverPp) / Type(2.0);
+        privateCode::solveRealQuadraticBranchless(
+          pp, qqFactor, real0[ii], imaginary0[ii], real1[ii], imaginary1[ii]);
+        privateCode::solveRealQuadraticBranchless(
+          -pp, ss, real2[ii], imaginary2[ii], real3[ii], imaginary3[ii]);
+
+        Type const shift = c0[ii] / Type(4.0);
+        real0[ii] = isDegenerate ? notANumber : (real0[ii] - shift);
+        real1[ii] -= shift;
+        real2[ii] -= shift;
+        real3[ii] -= shift;
+      }
+
+      // Second pass picks up the equations flagged above.
+      for(std::size_t ii = 0; ii < numberOfEquations; ++ii) {
+        if(std::isnan(real0[ii])) {
+          brick::common::ComplexNumber<Type> root0;
+          brick::common::ComplexNumber<Type> root1;
+          brick::common::ComplexNumber<Type> root2;
+          brick::common::ComplexNumber<Type> root3;
+          solveQuartic(c0[ii], c1[ii], c2[ii], c3[ii],
+                       root0, root1, root2, root3);
+          real0[ii] = root0.getRealPart();
+          real1[ii] = root1.getRealPart();
+          real2[ii] = root2.getRealPart();
+          real3[ii] = root3.getRealPart();
+          imaginary0[ii] = root0.getImaginaryPart();
+          imaginary1[ii] = root1.getImaginaryPart();
+          imaginary2[ii] = root2.getImaginaryPart();
+          imaginary3[ii] = root3.getImaginaryPart();
+        }
+      }
+    }
+
   } // namespace numeric
 
 } // namespace brick
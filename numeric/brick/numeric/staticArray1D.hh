@@ -13,6 +13,7 @@
 #ifndef BRICK_NUMERIC_STATICARRAY1D_HH
 #define BRICK_NUMERIC_STATICARRAY1D_HH
 
+#include <cstddef>
 #include <iostream>
 #include <string>
 #include <brick/common/exception.hh>
@@ -119,7 +120,7 @@ namespace brick {
        * the staticArray.
        */
       iterator
-      end() {this->begin() + Size;}
+      end() {return this->begin() + Size;}
 
 
       /**
@@ -129,7 +130,25 @@ namespace brick {
        * the staticArray.
        */
       const_iterator
-      end() const {this->begin() + Size;}
+      end() const {return this->begin() + Size;}
+
+
+      /**
+       * Returns a pointer to the internal data store.
+       *
+       * @return Pointer to the first element of the staticArray.
+       */
+      Type*
+      data() {return &(m_dataArray[0]);}
+
+
+      /**
+       * Returns a const pointer to the internal data store.
+       *
+       * @return Const pointer to the first element of the staticArray.
+       */
+      const Type*
+      data() const {return &(m_dataArray[0]);}
 
 
       /**
@@ -142,6 +161,20 @@ namespace brick {
       length() const {return this->size();}
 
 
+      /**
+       * Sets the value of the staticArray from a std::istream.  The
+       * input format is as described for operator<<(std::ostream&,
+       * const StaticArray1D<Type, Size>&).  On failure, the stream
+       * failbit is set, and the staticArray is unchanged.
+       *
+       * @param inputStream Reference to the the input stream.
+       *
+       * @return Reference to inputStream.
+       */
+      std::istream&
+      readFromStream(std::istream& inputStream);
+
+
       /**
        * Returns the number of elements in the staticArray.  This is a synonym
        * for length().
@@ -451,7 +484,7 @@ namespace brick {
      * the sum of the values of the corresponding elements of the two
      * StaticArray1D arguments.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator+(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1);
@@ -470,7 +503,7 @@ namespace brick {
      * the difference of the values of the corresponding elements of the two
      * StaticArray1D arguments.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator-(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1);
@@ -489,7 +522,7 @@ namespace brick {
      * the product of the values of the corresponding elements of the two
      * StaticArray1D arguments.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator*(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1);
@@ -508,7 +541,7 @@ namespace brick {
      * the dividend of the values of the corresponding elements of the two
      * StaticArray1D arguments.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator/(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1);
@@ -525,7 +558,7 @@ namespace brick {
      * the sum of the corresponding element of the StaticArray1D argument and
      * the scalar argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator+(const StaticArray1D<Type, Size>& staticArray, Type scalar);
 
@@ -541,7 +574,7 @@ namespace brick {
      * the difference of the corresponding element of the StaticArray1D
      * argument and the scalar argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator-(const StaticArray1D<Type, Size>& staticArray0, Type scalar);
 
@@ -557,7 +590,7 @@ namespace brick {
      * the product of the corresponding element of the StaticArray1D argument
      * and the scalar argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator*(const StaticArray1D<Type, Size>& staticArray0, Type scalar);
 
@@ -573,7 +606,7 @@ namespace brick {
      * the difference of the corresponding element of the StaticArray1D
      * argument and the scalar argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator/(const StaticArray1D<Type, Size>& staticArray0, Type scalar);
 
@@ -589,7 +622,7 @@ namespace brick {
      * the sum of the scalar argument and the corresponding element of
      * the StaticArray1D argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     inline StaticArray1D<Type, Size>
     operator+(Type scalar, const StaticArray1D<Type, Size>& staticArray0);
 
@@ -605,7 +638,7 @@ namespace brick {
      * the difference of the scalar argument and the corresponding
      * element of the StaticArray1D argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     inline StaticArray1D<Type, Size>
     operator-(Type scalar, const StaticArray1D<Type, Size>& staticArray0);
 
@@ -621,7 +654,7 @@ namespace brick {
      * the product of the scalar argument and the corresponding element
      * of the StaticArray1D argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     inline StaticArray1D<Type, Size>
     operator*(Type scalar, const StaticArray1D<Type, Size>& staticArray0);
 
@@ -637,7 +670,7 @@ namespace brick {
      * the dividend of the scalar argument and the corresponding element
      * of the StaticArray1D argument.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     inline StaticArray1D<Type, Size>
     operator/(Type scalar, const StaticArray1D<Type, Size>& staticArray0);
 
@@ -661,7 +694,7 @@ namespace brick {
      *
      * @return Reference to output stream.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     std::ostream&
     operator<<(std::ostream& stream,
                const StaticArray1D<Type, Size>& staticArray0);
@@ -679,7 +712,7 @@ namespace brick {
      *
      * @return Reference to input stream.
      */
-    template <class Type>
+    template <class Type, size_t Size>
     std::istream&
     operator>>(std::istream& stream,
                StaticArray1D<Type, Size>& staticArray0);
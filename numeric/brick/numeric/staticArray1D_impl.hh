@@ -22,7 +22,6 @@
 
 #include <algorithm>
 #include <sstream>
-#include <vector>
 #include <brick/common/expect.hh>
 #include <brick/numeric/numericTraits.hh>
 
@@ -32,7 +31,7 @@ namespace brick {
 
     // Static constant describing how the string representation of an
     // StaticArray1D should start.
-    template <class Type>
+    template <class Type, size_t Size>
     const std::string&
     StaticArray1D<Type, Size>::
     ioIntro()
@@ -44,7 +43,7 @@ namespace brick {
 
     // Static constant describing how the string representation of an
     // StaticArray1D should end.
-    template <class Type>
+    template <class Type, size_t Size>
     const std::string&
     StaticArray1D<Type, Size>::
     ioOutro()
@@ -56,7 +55,7 @@ namespace brick {
 
     // Non-static member functions below.
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>::
     StaticArray1D()
       : m_dataArray()
@@ -66,41 +65,35 @@ namespace brick {
 
 
     // Construct from an initialization string.
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>::
     StaticArray1D(const std::string& inputString)
       : m_dataArray()
     {
       // We'll use the stream input operator to parse the string.
       std::istringstream inputStream(inputString);
-
-      // Now read the string into a staticArray.
-      StaticArray1D<Type, Size> inputStaticArray;
-      inputStream >> inputStaticArray;
+      this->readFromStream(inputStream);
       if(!inputStream) {
         std::ostringstream message;
         message << "Couldn't parse input string: \"" << inputString << "\".";
-        BRICK_THROW3(ValueException,
-                   "StaticArray1D::StaticArray1D(const std::string&)",
-                   message.str().c_str());
+        BRICK_THROW(brick::common::ValueException,
+                    "StaticArray1D::StaticArray1D(const std::string&)",
+                    message.str().c_str());
       }
-
-      // If all went well, copy into *this.
-      *this = inputStaticArray;
     }
 
 
     // When copying from a StaticArray1D do a deep copy.
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>::
     StaticArray1D(const StaticArray1D<Type, Size>& source)
       : m_dataArray()
     {
-      std::copy(source.begin(), source.end(), m_dataArray);
+      std::copy(source.begin(), source.end(), this->begin());
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>::
     ~StaticArray1D()
     {
@@ -108,7 +101,7 @@ namespace brick {
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>& StaticArray1D<Type, Size>::
     operator=(Type val)
     {
@@ -117,7 +110,7 @@ namespace brick {
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>& StaticArray1D<Type, Size>::
     operator=(const StaticArray1D<Type, Size>& source)
     {
@@ -126,257 +119,361 @@ namespace brick {
     }
 
 
-    template <class Type> template <class Type2>
+    template <class Type, size_t Size> template <class Type2>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator+=(const StaticArray1D<Type2, Size>& arg)
     {
-      std::transform(this->begin, this->end(), arg.begin(), this->begin(),
-                     std::plus<Type>());
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] += arg[index0];
+      }
       return *this;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator+=(const Type arg)
     {
-      std::transform(this->begin(), this->end(), this->begin(),
-                     std::bind2nd(std::plus<Type>(), arg));
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] += arg;
+      }
       return *this;
     }
 
 
-    template <class Type> template <class Type2>
+    template <class Type, size_t Size> template <class Type2>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator-=(const StaticArray1D<Type2, Size>& arg)
     {
-      std::transform(this->begin(), this->end(), arg.begin(), this->begin(),
-                     std::minus<Type>());
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] -= arg[index0];
+      }
       return *this;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator-=(const Type arg)
     {
-      std::transform(this->begin(), this->end(), this->begin(),
-                     std::bind2nd(std::minus<Type>(), arg));
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] -= arg;
+      }
       return *this;
     }
 
 
-    template <class Type> template <class Type2>
+    template <class Type, size_t Size> template <class Type2>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator*=(const StaticArray1D<Type2, Size>& arg)
     {
-      std::transform(this->begin(), this->end(), arg.begin(), this->begin(),
-                     std::multiplies<Type>());
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] *= arg[index0];
+      }
       return *this;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator*=(const Type arg)
     {
-      std::transform(this->begin(), this->end(), this->begin(),
-                     std::bind2nd(std::multiplies<Type>(), arg));
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] *= arg;
+      }
       return *this;
     }
 
 
-    template <class Type> template <class Type2>
+    template <class Type, size_t Size> template <class Type2>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator/=(const StaticArray1D<Type2, Size>& arg)
     {
-      std::transform(this->begin(), this->end(), arg.begin(), this->begin(),
-                     std::divides<Type>());
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] /= arg[index0];
+      }
       return *this;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>&
     StaticArray1D<Type, Size>::
     operator/=(const Type arg)
     {
-      std::transform(this->begin(), this->end(), this->begin(),
-                     std::bind2nd(std::divides<Type>(), arg));
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        m_dataArray[index0] /= arg;
+      }
       return *this;
     }
 
 
-    template <class Type>
-    StaticArray1D<bool, Size> StaticArray1D<Type, Size>::
+    template <class Type, size_t Size>
+    StaticArray1D<bool, Size>
+    StaticArray1D<Type, Size>::
     operator>(const Type arg)
       const
     {
-      StaticArray1D<bool, Size> result(m_size);
-      std::transform(this->begin(), this->end(), result.begin(),
-                     std::bind2nd(std::greater<Type>(), arg));
+      StaticArray1D<bool, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = m_dataArray[index0] > arg;
+      }
       return result;
     }
 
 
-    template <class Type>
-    StaticArray1D<bool, Size> StaticArray1D<Type, Size>::
+    template <class Type, size_t Size>
+    StaticArray1D<bool, Size>
+    StaticArray1D<Type, Size>::
     operator>=(const Type arg)
       const
     {
-      StaticArray1D<bool, Size> result(m_size);
-      std::transform(this->begin(), this->end(), result.begin(),
-                     std::bind2nd(std::greater_equal<Type>(), arg));
+      StaticArray1D<bool, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = m_dataArray[index0] >= arg;
+      }
       return result;
     }
 
 
-    template <class Type>
-    StaticArray1D<bool, Size> StaticArray1D<Type, Size>::
+    template <class Type, size_t Size>
+    StaticArray1D<bool, Size>
+    StaticArray1D<Type, Size>::
     operator<(const Type arg)
       const
     {
-      StaticArray1D<bool, Size> result(m_size);
-      std::transform(this->begin(), this->end(), result.begin(),
-                     std::bind2nd(std::less<Type>(), arg));
+      StaticArray1D<bool, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = m_dataArray[index0] < arg;
+      }
       return result;
     }
 
 
-    template <class Type>
-    StaticArray1D<bool, Size> StaticArray1D<Type, Size>::
+    template <class Type, size_t Size>
+    StaticArray1D<bool, Size>
+    StaticArray1D<Type, Size>::
     operator<=(const Type arg)
       const
     {
-      StaticArray1D<bool, Size> result(m_size);
-      std::transform(this->begin(), this->end(), result.begin(),
-                     std::bind2nd(std::less_equal<Type>(), arg));
+      StaticArray1D<bool, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = m_dataArray[index0] <= arg;
+      }
       return result;
     }
 
 
-    template <class Type>
+    // Sets the value of the staticArray from a std::istream.
+    template <class Type, size_t Size>
+    std::istream&
+    StaticArray1D<Type, Size>::
+    readFromStream(std::istream& inputStream)
+    {
+      // Most of the time, InputType will be the same as Type.
+      // TextOutputType is the type one would use to write out a value
+      // of Type.  Not surprisingly, this is the type you need to use
+      // when reading those values back in.
+      typedef typename NumericTraits<Type>::TextOutputType InputType;
+
+      // If stream is in a bad state, we can't read from it.
+      if (!inputStream){
+        return inputStream;
+      }
+
+      // It's a lot easier to use a try block than to be constantly
+      // testing whether the IO has succeeded, so we tell inputStream to
+      // complain if anything goes wrong.
+      std::ios_base::iostate oldExceptionState = inputStream.exceptions();
+      inputStream.exceptions(
+        std::ios_base::badbit | std::ios_base::failbit | std::ios_base::eofbit);
+
+      // Now on with the show.
+      try{
+        common::Expect::FormatFlag flags = common::Expect::SkipWhitespace();
+
+        // Skip any preceding whitespace.
+        inputStream >> common::Expect("", flags);
+
+        // We won't require the input format to start with
+        // "StaticArray1D(", but if it does we read it here.
+        bool foundIntro = false;
+        if(inputStream.peek() == ioIntro()[0]) {
+          foundIntro = true;
+          inputStream >> common::Expect(ioIntro(), flags);
+        }
+
+        // OK.  We've dispensed with the intro.  What's left should be of
+        // the format "[#, #, #, ...]".  We require the square brackets to
+        // be there.
+        char inChar = 0;
+        inputStream >> inChar;
+        if(inChar != ioOpening) {
+          inputStream.clear(std::ios_base::failbit);
+        }
+
+        // Read the data.
+        InputType inputValue;
+        Type inputBuffer[Size];
+        for(size_t index0 = 0; index0 < Size; ++index0) {
+          // Read the next value.
+          inputStream >> inputValue;
+          inputBuffer[index0] = static_cast<Type>(inputValue);
+
+          // Read the separator, or the closing character if this is
+          // the last element.
+          inChar = 0;
+          inputStream >> inChar;
+          if(inChar != ((index0 + 1 == Size) ? ioClosing : ioSeparator)) {
+            inputStream.clear(std::ios_base::failbit);
+          }
+        }
+
+        // If we found an intro, we expect the corresponding outro.
+        if(foundIntro) {
+          inputStream >> common::Expect(ioOutro(), flags);
+        }
+
+        // Now we're done with all of the parsing.  Copy the data to *this.
+        std::copy(inputBuffer, inputBuffer + Size, this->begin());
+
+      } catch(std::ios_base::failure &) {
+        // Empty
+      }
+      inputStream.exceptions(oldExceptionState);
+      return inputStream;
+    }
+
+
+    template <class Type, size_t Size>
     inline void StaticArray1D<Type, Size>::
     checkBounds(size_t index) const
     {
 #ifdef BRICK_NUMERIC_CHECKBOUNDS
-      if(index < 0 || index >= Size) {
+      if(index >= Size) {
         std::ostringstream message;
-        message << "Index " << index << " is invalid for a(n) " << m_size
+        message << "Index " << index << " is invalid for a(n) " << Size
                 << " element staticArray.";
-        BRICK_THROW(IndexException, "StaticArray1D::checkBounds()",
-                  message.str().c_str());
+        BRICK_THROW(brick::common::IndexException,
+                    "StaticArray1D::checkBounds()",
+                    message.str().c_str());
       }
+#else
+      static_cast<void>(index);
 #endif
     }
 
 
     /* ========== Non-member functions =========== */
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator+(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(),
-                     staticArray1.begin(),
-                     result.begin(), std::plus<Type>());
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] + staticArray1[index0];
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator-(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(),
-                     staticArray1.begin(),
-                     result.begin(), std::minus<Type>());
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] - staticArray1[index0];
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator*(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(),
-                     staticArray1.begin(),
-                     result.begin(), std::multiplies<Type>());
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] * staticArray1[index0];
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator/(const StaticArray1D<Type, Size>& staticArray0,
               const StaticArray1D<Type, Size>& staticArray1)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(),
-                     staticArray1.begin(),
-                     result.begin(), std::divides<Type>());
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] / staticArray1[index0];
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator+(const StaticArray1D<Type, Size>& staticArray0, Type scalar)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(), result.begin(),
-                     std::bind2nd(std::plus<Type>(), scalar));
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] + scalar;
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator-(const StaticArray1D<Type, Size>& staticArray0, Type scalar)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(), result.begin(),
-                     std::bind2nd(std::minus<Type>(), scalar));
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] - scalar;
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator*(const StaticArray1D<Type, Size>& staticArray0, Type scalar)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(), result.begin(),
-                     std::bind2nd(std::multiplies<Type>(), scalar));
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] * scalar;
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator/(const StaticArray1D<Type, Size>& staticArray0, Type scalar)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(), result.begin(),
-                     std::bind2nd(std::divides<Type>(), scalar));
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = staticArray0[index0] / scalar;
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     inline StaticArray1D<Type, Size>
     operator+(Type scalar, const StaticArray1D<Type, Size>& staticArray0)
     {
@@ -384,18 +481,19 @@ namespace brick {
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator-(Type scalar, const StaticArray1D<Type, Size>& staticArray0)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(), result.begin(),
-                     std::bind1st(std::minus<Type>(), scalar));
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = scalar - staticArray0[index0];
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     inline StaticArray1D<Type, Size>
     operator*(Type scalar, const StaticArray1D<Type, Size>& staticArray0)
     {
@@ -403,18 +501,19 @@ namespace brick {
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     StaticArray1D<Type, Size>
     operator/(Type scalar, const StaticArray1D<Type, Size>& staticArray0)
     {
-      StaticArray1D<Type, Size> result(staticArray0.size());
-      std::transform(staticArray0.begin(), staticArray0.end(), result.begin(),
-                     std::bind1st(std::divides<Type>(), scalar));
+      StaticArray1D<Type, Size> result;
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result[index0] = scalar / staticArray0[index0];
+      }
       return result;
     }
 
 
-    template <class Type>
+    template <class Type, size_t Size>
     std::ostream&
     operator<<(std::ostream& stream,
                const StaticArray1D<Type, Size>& staticArray0)
@@ -423,8 +522,9 @@ namespace brick {
       typedef typename NumericTraits<Type>::TextOutputType OutputType;
 
       if (!stream){
-        BRICK_THROW(IOException, "operator<<(std::ostream&, const StaticArray1D&)",
-                  "Invalid stream\n");
+        BRICK_THROW(brick::common::IOException,
+                    "operator<<(std::ostream&, const StaticArray1D&)",
+                    "Invalid stream\n");
       }
 
       size_t index;
@@ -441,91 +541,12 @@ namespace brick {
 
 
     // Sets the value of an StaticArray1D instance from a std::istream.
-    template <class Type>
+    template <class Type, size_t Size>
     std::istream&
     operator>>(std::istream& inputStream,
                StaticArray1D<Type, Size>& staticArray0)
     {
-      // Most of the time, InputType will be the same as Type.
-      // TextOutputType is the type one would use to write out a value
-      // of Type.  Not surprisingly, this is the type you need to use
-      // when reading those values back in.
-      typedef typename NumericTraits<Type>::TextOutputType InputType;
-
-      // If stream is in a bad state, we can't read from it.
-      if (!inputStream){
-        return inputStream;
-      }
-
-      // It's a lot easier to use a try block than to be constantly
-      // testing whether the IO has succeeded, so we tell inputStream to
-      // complain if anything goes wrong.
-      std::ios_base::iostate oldExceptionState = inputStream.exceptions();
-      inputStream.exceptions(
-        std::ios_base::badbit | std::ios_base::failbit | std::ios_base::eofbit);
-
-      // Now on with the show.
-      try{
-        common::Expect::FormatFlag flags = common::Expect::SkipWhitespace;
-
-        // Skip any preceding whitespace.
-        inputStream >> common::Expect("", flags);
-
-        // We won't require the input format to start with
-        // "StaticArray1D(", but if it does we read it here.
-        bool foundIntro = false;
-        if(inputStream.peek() == ioIntro()[0]) {
-          foundIntro = true;
-          inputStream >> common::Expect(ioIntro(), flags);
-        }
-
-        // OK.  We've dispensed with the intro.  What's left should be of
-        // the format "[#, #, #, ...]".  We require the square brackets to
-        // be there.
-        inputStream >> common::Expect(&(ioOpening()), 1, flags);
-
-        // Read the data.
-        InputType inputValue;
-        std::vector<Type> inputBuffer(Size);
-        for(size_t index0 = 0; index0 < Size - 1; ++index0) {
-          // Read the next value.
-          inputStream >> inputValue;
-          inputBuffer[index0] = static_cast<Type>(inputValue);
-
-          // Read the separator.
-          char inChar = 0;
-          inputStream >> inChar;
-          if(inChar != ioSeparator) {
-            // Missing separator.  Fail here.
-            inputStream.clear(std::ios_base::failbit);
-          }
-        }
-
-        // Read the final value.
-        inputStream >> inputValue;
-        inputBuffer[Size - 1] = static_cast<Type>(inputValue);
-
-        // Read the closing character.
-        char inChar = 0;
-        inputStream >> inChar;
-        if(inChar != ioClosing) {
-          // Missing Closing.  Fail here.
-          inputStream.clear(std::ios_base::failbit);
-        }
-
-        // If we found an intro, we expect the corresponding outro.
-        if(foundIntro) {
-          inputStream >> common::Expect(&(ioOutro()), 1, flags);
-        }
-
-        // Now we're done with all of the parsing.  Copy the data to *this.
-        std::copy(inputBuffer.begin(), inputBuffer.end(), this->begin());
-
-      } catch(std::ios_base::failure &) {
-        // Empty
-      }
-      inputStream.exceptions(oldExceptionState);
-      return inputStream;
+      return staticArray0.readFromStream(inputStream);
     }
 
   } // namespace numeric
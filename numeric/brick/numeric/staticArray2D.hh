@@ -0,0 +1,518 @@
+/**
+***************************************************************************
+* @file brick/numeric/staticArray2D.hh
+*
+* Header file declaring StaticArray2D class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_STATICARRAY2D_HH
+#define BRICK_NUMERIC_STATICARRAY2D_HH
+
+#include <cstddef>
+#include <iostream>
+#include <brick/common/exception.hh>
+#include <brick/numeric/staticArray1D.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** The StaticArray2D class template represents a 2D array of
+     ** arbitrary type.  It is the two dimensional counterpart of
+     ** StaticArray1D: all memory is obtained from the stack, the
+     ** shape is fixed at compile time, and copying is deep, so that
+     ** if you write:
+     **
+     **       staticArray1 = staticArray2;
+     **
+     ** then the data from staticArray2 will be deep copied into
+     ** staticArray1.  Elements are stored in row major order.
+     **
+     ** StaticArray2D is intended for small matrices (3x3 rotations,
+     ** 9x9 normal equations, Kalman filter covariances, etc.) in
+     ** inner loops where the heap allocation and reference counting
+     ** done by Array2D would dominate the run time.
+     **/
+    template <class Type, size_t Rows, size_t Columns>
+    class StaticArray2D {
+    public:
+      /* ======== Public typedefs ======== */
+
+      /**
+       ** Typedef for value_type describes the contents of the staticArray.
+       **/
+      typedef Type value_type;
+
+
+      /**
+       ** Typedef for iterator type helps with standard library interface.
+       **/
+      typedef Type* iterator;
+
+
+      /**
+       ** Typedef for const_iterator type helps with standard library
+       ** interface.
+       **/
+      typedef const Type* const_iterator;
+
+
+      /* ======== Public member functions ======== */
+
+      /**
+       * Default constructor initializes all elements to Type().
+       */
+      StaticArray2D() : m_dataArray() {}
+
+
+      /**
+       * This constructor initializes every element to the specified
+       * value.
+       *
+       * @param value This argument will be copied into each element.
+       */
+      explicit
+      StaticArray2D(Type value) : m_dataArray() {*this = value;}
+
+
+      /**
+       * Return begin() iterator for Standard Library algorithms.
+       *
+       * @return Iterator pointing to the first element of the staticArray.
+       */
+      iterator
+      begin() {return &(m_dataArray[0]);}
+
+
+      /**
+       * Return begin() const_iterator for Standard Library algorithms.
+       *
+       * @return Const iterator pointing to the first element of the
+       * staticArray.
+       */
+      const_iterator
+      begin() const {return &(m_dataArray[0]);}
+
+
+      /**
+       * Returns the number of columns in the staticArray.
+       *
+       * @return The number of columns.
+       */
+      size_t
+      columns() const {return Columns;}
+
+
+      /**
+       * Returns a pointer to the internal data store.
+       *
+       * @return Pointer to the first element of the staticArray.
+       */
+      Type*
+      data() {return &(m_dataArray[0]);}
+
+
+      /**
+       * Returns a const pointer to the internal data store.
+       *
+       * @return Const pointer to the first element of the staticArray.
+       */
+      const Type*
+      data() const {return &(m_dataArray[0]);}
+
+
+      /**
+       * Return end() iterator for Standard Library algorithms.
+       *
+       * @return Iterator pointing just past the last element of
+       * the staticArray.
+       */
+      iterator
+      end() {return this->begin() + Rows * Columns;}
+
+
+      /**
+       * Return end() const_iterator for Standard Library algorithms.
+       *
+       * @return Const iterator pointing just past the last element of
+       * the staticArray.
+       */
+      const_iterator
+      end() const {return this->begin() + Rows * Columns;}
+
+
+      /**
+       * Returns a pointer to the first element of the specified row.
+       *
+       * @param rowIndex This argument selects the row.
+       *
+       * @return Pointer to the first element of row rowIndex.
+       */
+      Type*
+      rowBegin(size_t rowIndex) {
+        this->checkBounds(rowIndex, 0);
+        return this->begin() + rowIndex * Columns;
+      }
+
+
+      /**
+       * Returns a const pointer to the first element of the specified row.
+       *
+       * @param rowIndex This argument selects the row.
+       *
+       * @return Const pointer to the first element of row rowIndex.
+       */
+      const Type*
+      rowBegin(size_t rowIndex) const {
+        this->checkBounds(rowIndex, 0);
+        return this->begin() + rowIndex * Columns;
+      }
+
+
+      /**
+       * Returns the number of rows in the staticArray.
+       *
+       * @return The number of rows.
+       */
+      size_t
+      rows() const {return Rows;}
+
+
+      /**
+       * Returns the total number of elements in the staticArray.
+       *
+       * @return The number of elements, rows() * columns().
+       */
+      size_t
+      size() const {return Rows * Columns;}
+
+
+      /**
+       * Returns a transposed copy of the staticArray.
+       *
+       * @return A StaticArray2D in which element (i, j) is equal to
+       * element (j, i) of *this.
+       */
+      StaticArray2D<Type, Columns, Rows>
+      transpose() const;
+
+
+      /**
+       * Assign value to every element in the staticArray.
+       *
+       * @param value The value to be copied.
+       *
+       * @return Reference to *this.
+       */
+      StaticArray2D<Type, Rows, Columns>&
+      operator=(Type value);
+
+
+      /**
+       * Returns the (index)th element of the staticArray by
+       * reference, where elements are numbered in row major order.
+       *
+       * @param index Indicates the selected element.
+       *
+       * @return Reference to the (index)th element of the staticArray.
+       */
+      Type&
+      operator()(size_t index) {
+        this->checkBounds(index);
+        return m_dataArray[index];
+      }
+
+
+      /**
+       * Returns the (index)th element of the staticArray by value,
+       * where elements are numbered in row major order.
+       *
+       * @param index Indicates the selected element.
+       *
+       * @return Value of the (index)th element of the staticArray.
+       */
+      Type
+      operator()(size_t index) const {
+        this->checkBounds(index);
+        return m_dataArray[index];
+      }
+
+
+      /**
+       * Returns the specified element of the staticArray by reference.
+       *
+       * @param rowIndex Indicates the row of the selected element.
+       *
+       * @param columnIndex Indicates the column of the selected element.
+       *
+       * @return Reference to the selected element.
+       */
+      Type&
+      operator()(size_t rowIndex, size_t columnIndex) {
+        this->checkBounds(rowIndex, columnIndex);
+        return m_dataArray[rowIndex * Columns + columnIndex];
+      }
+
+
+      /**
+       * Returns the specified element of the staticArray by value.
+       *
+       * @param rowIndex Indicates the row of the selected element.
+       *
+       * @param columnIndex Indicates the column of the selected element.
+       *
+       * @return Value of the selected element.
+       */
+      Type
+      operator()(size_t rowIndex, size_t columnIndex) const {
+        this->checkBounds(rowIndex, columnIndex);
+        return m_dataArray[rowIndex * Columns + columnIndex];
+      }
+
+
+      /**
+       * Returns the (index)th element of the staticArray by reference.
+       * Synonymous with operator()(size_t).
+       *
+       * @param index Indicates the selected element.
+       *
+       * @return Reference to the (index)th element of the staticArray.
+       */
+      Type& operator[](size_t index) {return this->operator()(index);}
+
+
+      /**
+       * Returns the (index)th element of the staticArray by value.
+       * Synonymous with operator()(size_t) const.
+       *
+       * @param index Indicates the selected element.
+       *
+       * @return Value of the (index)th element of the staticArray.
+       */
+      Type operator[](size_t index) const {return this->operator()(index);}
+
+
+      /**
+       * Increments each element of *this by the value of the
+       * corresponding element of arg.
+       *
+       * @param arg StaticArray2D of values to be added to the elements of
+       * *this.
+       *
+       * @return Reference to *this.
+       */
+      StaticArray2D<Type, Rows, Columns>&
+      operator+=(const StaticArray2D<Type, Rows, Columns>& arg);
+
+
+      /**
+       * Decrements each element of *this by the value of the
+       * corresponding element of arg.
+       *
+       * @param arg StaticArray2D of values to be subtracted from the
+       * elements of *this.
+       *
+       * @return Reference to *this.
+       */
+      StaticArray2D<Type, Rows, Columns>&
+      operator-=(const StaticArray2D<Type, Rows, Columns>& arg);
+
+
+      /**
+       * Multiplies each element of *this by a constant.
+       *
+       * @param arg Value by which staticArray elements will be multiplied.
+       *
+       * @return Reference to *this.
+       */
+      StaticArray2D<Type, Rows, Columns>&
+      operator*=(const Type arg);
+
+
+      /**
+       * Divides each element of *this by a constant.
+       *
+       * @param arg Value by which staticArray elements will be divided.
+       *
+       * @return Reference to *this.
+       */
+      StaticArray2D<Type, Rows, Columns>&
+      operator/=(const Type arg);
+
+    private:
+      /* ======== Private member functions ======== */
+
+      /**
+       * Optionally throw an exception if index is beyond the range of
+       * this staticArray.
+       *
+       * @param index The index to check.
+       */
+      inline void
+      checkBounds(size_t index) const;
+
+
+      /**
+       * Optionally throw an exception if either index is beyond the
+       * range of this staticArray.
+       *
+       * @param rowIndex The row index to check.
+       *
+       * @param columnIndex The column index to check.
+       */
+      inline void
+      checkBounds(size_t rowIndex, size_t columnIndex) const;
+
+
+      /* ======== Private data members ======== */
+      Type m_dataArray[Rows * Columns];
+
+    };
+
+
+    /* ================= Non-member functions ================= */
+
+    /**
+     * This function returns a StaticArray2D representing the
+     * identity matrix of the specified size.
+     *
+     * @return The return value is a square StaticArray2D with ones on
+     * the diagonal and zeros everywhere else.
+     */
+    template <class Type, size_t Size>
+    StaticArray2D<Type, Size, Size>
+    identityStatic();
+
+
+    /**
+     * This function computes the matrix product of two StaticArray2D
+     * instances.
+     *
+     * @param A This argument is the left operand of the product.
+     *
+     * @param B This argument is the right operand of the product.
+     *
+     * @return The return value is the matrix product A * B.
+     */
+    template <class Type, size_t Rows, size_t Inner, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    matrixMultiply(StaticArray2D<Type, Rows, Inner> const& A,
+                   StaticArray2D<Type, Inner, Columns> const& B);
+
+
+    /**
+     * This function computes the matrix product of a StaticArray2D
+     * and a column vector.
+     *
+     * @param A This argument is the left operand of the product.
+     *
+     * @param x This argument is the right operand of the product.
+     *
+     * @return The return value is the vector A * x.
+     */
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray1D<Type, Rows>
+    matrixMultiply(StaticArray2D<Type, Rows, Columns> const& A,
+                   StaticArray1D<Type, Columns> const& x);
+
+
+    /**
+     * Elementwise addition of StaticArray2D instances.
+     *
+     * @param staticArray0 First argument for addition.
+     *
+     * @param staticArray1 Second argument for addition.
+     *
+     * @return StaticArray2D instance in which the value of each
+     * element is the sum of the values of the corresponding elements
+     * of the two arguments.
+     */
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    operator+(const StaticArray2D<Type, Rows, Columns>& staticArray0,
+              const StaticArray2D<Type, Rows, Columns>& staticArray1);
+
+
+    /**
+     * Elementwise subtraction of StaticArray2D instances.
+     *
+     * @param staticArray0 First argument for subtraction.
+     *
+     * @param staticArray1 Second argument for subtraction.
+     *
+     * @return StaticArray2D instance in which the value of each
+     * element is the difference of the values of the corresponding
+     * elements of the two arguments.
+     */
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    operator-(const StaticArray2D<Type, Rows, Columns>& staticArray0,
+              const StaticArray2D<Type, Rows, Columns>& staticArray1);
+
+
+    /**
+     * Multiplication of a StaticArray2D instance by a scalar.
+     *
+     * @param staticArray0 This argument is the array to be scaled.
+     *
+     * @param scalar This argument is the scale factor.
+     *
+     * @return StaticArray2D instance in which each element is the
+     * product of the corresponding element of staticArray0 and scalar.
+     */
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    operator*(const StaticArray2D<Type, Rows, Columns>& staticArray0,
+              Type scalar);
+
+
+    /**
+     * Multiplication of a StaticArray2D instance by a scalar.
+     *
+     * @param scalar This argument is the scale factor.
+     *
+     * @param staticArray0 This argument is the array to be scaled.
+     *
+     * @return StaticArray2D instance in which each element is the
+     * product of the corresponding element of staticArray0 and scalar.
+     */
+    template <class Type, size_t Rows, size_t Columns>
+    inline StaticArray2D<Type, Rows, Columns>
+    operator*(Type scalar,
+              const StaticArray2D<Type, Rows, Columns>& staticArray0) {
+      return staticArray0 * scalar;
+    }
+
+
+    /**
+     * Outputs a text representation of a StaticArray2D instance to a
+     * std::ostream.  The output format looks like this:
+     *
+     * StaticArray2D([[1, 2], [3, 4]])
+     *
+     * @param stream Reference to the the output stream.
+     *
+     * @param staticArray0 const Reference to the StaticArray2D to be output.
+     *
+     * @return Reference to output stream.
+     */
+    template <class Type, size_t Rows, size_t Columns>
+    std::ostream&
+    operator<<(std::ostream& stream,
+               const StaticArray2D<Type, Rows, Columns>& staticArray0);
+
+  } // namespace numeric
+
+} // namespace brick
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/staticArray2D_impl.hh>
+
+#endif /* #ifdef BRICK_NUMERIC_STATICARRAY2D_HH */
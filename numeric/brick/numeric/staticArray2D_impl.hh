@@ -0,0 +1,268 @@
+/**
+***************************************************************************
+* @file brick/numeric/staticArray2D_impl.hh
+*
+* Header file defining inline and template functions declared in
+* staticArray2D.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_STATICARRAY2D_IMPL_HH
+#define BRICK_NUMERIC_STATICARRAY2D_IMPL_HH
+
+// This file is included by staticArray2D.hh, and should not be
+// directly included by user code, so no need to include
+// staticArray2D.hh here.
+//
+// #include <brick/numeric/staticArray2D.hh>
+
+#include <sstream>
+#include <brick/numeric/numericTraits.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Columns, Rows>
+    StaticArray2D<Type, Rows, Columns>::
+    transpose() const
+    {
+      StaticArray2D<Type, Columns, Rows> result;
+      for(size_t rr = 0; rr < Rows; ++rr) {
+        for(size_t cc = 0; cc < Columns; ++cc) {
+          result(cc, rr) = (*this)(rr, cc);
+        }
+      }
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>&
+    StaticArray2D<Type, Rows, Columns>::
+    operator=(Type value)
+    {
+      for(size_t index0 = 0; index0 < Rows * Columns; ++index0) {
+        m_dataArray[index0] = value;
+      }
+      return *this;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>&
+    StaticArray2D<Type, Rows, Columns>::
+    operator+=(const StaticArray2D<Type, Rows, Columns>& arg)
+    {
+      for(size_t index0 = 0; index0 < Rows * Columns; ++index0) {
+        m_dataArray[index0] += arg[index0];
+      }
+      return *this;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>&
+    StaticArray2D<Type, Rows, Columns>::
+    operator-=(const StaticArray2D<Type, Rows, Columns>& arg)
+    {
+      for(size_t index0 = 0; index0 < Rows * Columns; ++index0) {
+        m_dataArray[index0] -= arg[index0];
+      }
+      return *this;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>&
+    StaticArray2D<Type, Rows, Columns>::
+    operator*=(const Type arg)
+    {
+      for(size_t index0 = 0; index0 < Rows * Columns; ++index0) {
+        m_dataArray[index0] *= arg;
+      }
+      return *this;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>&
+    StaticArray2D<Type, Rows, Columns>::
+    operator/=(const Type arg)
+    {
+      for(size_t index0 = 0; index0 < Rows * Columns; ++index0) {
+        m_dataArray[index0] /= arg;
+      }
+      return *this;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    inline void
+    StaticArray2D<Type, Rows, Columns>::
+    checkBounds(size_t index) const
+    {
+#ifdef BRICK_NUMERIC_CHECKBOUNDS
+      if(index >= Rows * Columns) {
+        std::ostringstream message;
+        message << "Index " << index << " is invalid for a(n) "
+                << Rows << " x " << Columns << " staticArray.";
+        BRICK_THROW(brick::common::IndexException,
+                    "StaticArray2D::checkBounds()",
+                    message.str().c_str());
+      }
+#else
+      static_cast<void>(index);
+#endif
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    inline void
+    StaticArray2D<Type, Rows, Columns>::
+    checkBounds(size_t rowIndex, size_t columnIndex) const
+    {
+#ifdef BRICK_NUMERIC_CHECKBOUNDS
+      if(rowIndex >= Rows || columnIndex >= Columns) {
+        std::ostringstream message;
+        message << "Index (" << rowIndex << ", " << columnIndex
+                << ") is invalid for a(n) "
+                << Rows << " x " << Columns << " staticArray.";
+        BRICK_THROW(brick::common::IndexException,
+                    "StaticArray2D::checkBounds()",
+                    message.str().c_str());
+      }
+#else
+      static_cast<void>(rowIndex);
+      static_cast<void>(columnIndex);
+#endif
+    }
+
+
+    /* ========== Non-member functions =========== */
+
+    template <class Type, size_t Size>
+    StaticArray2D<Type, Size, Size>
+    identityStatic()
+    {
+      StaticArray2D<Type, Size, Size> result(static_cast<Type>(0));
+      for(size_t index0 = 0; index0 < Size; ++index0) {
+        result(index0, index0) = static_cast<Type>(1);
+      }
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Inner, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    matrixMultiply(StaticArray2D<Type, Rows, Inner> const& A,
+                   StaticArray2D<Type, Inner, Columns> const& B)
+    {
+      StaticArray2D<Type, Rows, Columns> result(static_cast<Type>(0));
+      for(size_t rr = 0; rr < Rows; ++rr) {
+        Type* resultRow = result.rowBegin(rr);
+        for(size_t kk = 0; kk < Inner; ++kk) {
+          Type const aa = A(rr, kk);
+          Type const* bRow = B.rowBegin(kk);
+          for(size_t cc = 0; cc < Columns; ++cc) {
+            resultRow[cc] += aa * bRow[cc];
+          }
+        }
+      }
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray1D<Type, Rows>
+    matrixMultiply(StaticArray2D<Type, Rows, Columns> const& A,
+                   StaticArray1D<Type, Columns> const& x)
+    {
+      StaticArray1D<Type, Rows> result;
+      for(size_t rr = 0; rr < Rows; ++rr) {
+        Type const* aRow = A.rowBegin(rr);
+        Type accumulator = static_cast<Type>(0);
+        for(size_t cc = 0; cc < Columns; ++cc) {
+          accumulator += aRow[cc] * x[cc];
+        }
+        result[rr] = accumulator;
+      }
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    operator+(const StaticArray2D<Type, Rows, Columns>& staticArray0,
+              const StaticArray2D<Type, Rows, Columns>& staticArray1)
+    {
+      StaticArray2D<Type, Rows, Columns> result(staticArray0);
+      result += staticArray1;
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    operator-(const StaticArray2D<Type, Rows, Columns>& staticArray0,
+              const StaticArray2D<Type, Rows, Columns>& staticArray1)
+    {
+      StaticArray2D<Type, Rows, Columns> result(staticArray0);
+      result -= staticArray1;
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    StaticArray2D<Type, Rows, Columns>
+    operator*(const StaticArray2D<Type, Rows, Columns>& staticArray0,
+              Type scalar)
+    {
+      StaticArray2D<Type, Rows, Columns> result(staticArray0);
+      result *= scalar;
+      return result;
+    }
+
+
+    template <class Type, size_t Rows, size_t Columns>
+    std::ostream&
+    operator<<(std::ostream& stream,
+               const StaticArray2D<Type, Rows, Columns>& staticArray0)
+    {
+      // Most of the time, OutputType will be the same as Type.
+      typedef typename NumericTraits<Type>::TextOutputType OutputType;
+
+      if (!stream){
+        BRICK_THROW(brick::common::IOException,
+                    "operator<<(std::ostream&, const StaticArray2D&)",
+                    "Invalid stream\n");
+      }
+
+      stream << "StaticArray2D([";
+      for(size_t rr = 0; rr < Rows; ++rr) {
+        stream << "[";
+        for(size_t cc = 0; cc < Columns; ++cc) {
+          stream << static_cast<OutputType>(staticArray0(rr, cc));
+          if(cc + 1 < Columns) {
+            stream << ", ";
+          }
+        }
+        stream << "]";
+        if(rr + 1 < Rows) {
+          stream << ",\n               ";
+        }
+      }
+      stream << "])";
+      return stream;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifdef BRICK_NUMERIC_STATICARRAY2D_IMPL_HH */
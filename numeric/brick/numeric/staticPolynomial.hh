@@ -0,0 +1,310 @@
+/**
+***************************************************************************
+* @file brick/numeric/staticPolynomial.hh
+*
+* Header file declaring a class for representing fixed-order
+* polynomials without heap allocation.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_STATICPOLYNOMIAL_HH
+#define BRICK_NUMERIC_STATICPOLYNOMIAL_HH
+
+#include <cstddef>
+#include <brick/numeric/staticArray1D.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    /**
+     ** This class represents polynomials of the form
+     **
+     **   p(x) = k0 + (k1 * x) + (k2 * x^2) + ... + (kN * x^N)
+     **
+     ** where the maximum order, N, is fixed at compile time.  It is
+     ** the stack-allocated counterpart of Polynomial: coefficients
+     ** live in a StaticArray1D, so construction, copying, and
+     ** arithmetic never touch the heap.  This makes it suitable for
+     ** use in inner loops, such as the minimal solvers run inside
+     ** RANSAC.
+     **
+     ** Note that Order is the maximum order of the polynomial.  Its
+     ** highest coefficients may be zero, so that, for example, a
+     ** StaticPolynomial<double, 3> can represent a quadratic.
+     **/
+    template <class Type, std::size_t Order>
+    class StaticPolynomial {
+    public:
+
+      /**
+       * The default constructor makes a polynomial whose
+       * coefficients are all zero: p(x) = 0.  Note that this differs
+       * from Polynomial, whose default constructor makes p(x) = 1.
+       */
+      StaticPolynomial();
+
+
+      /**
+       * This constructor copies coefficients from a C-style array.
+       *
+       *   p(x) = coefficients[0] + (coefficients[1] * x)
+       *          + (coefficients[2] * x^2) + ...
+       *          + (coefficients[Order] * x^Order)
+       *
+       * @param coefficients This argument must point to (Order + 1)
+       * coefficients, arranged as described above.
+       */
+      explicit
+      StaticPolynomial(Type const* coefficients);
+
+
+      /**
+       * This constructor copies coefficients from a StaticArray1D,
+       * arranged as described in the documentation for constructor
+       * StaticPolynomial(Type const*).
+       *
+       * @param coefficients This argument is the array of
+       * coefficients.
+       */
+      explicit
+      StaticPolynomial(StaticArray1D<Type, Order + 1> const& coefficients);
+
+
+      /**
+       * This constructor promotes a lower-order polynomial, setting
+       * the extra high-order coefficients to zero.
+       *
+       * @param other This argument is the polynomial to be copied.
+       * Its order must not be greater than Order.
+       */
+      template <std::size_t OtherOrder>
+      explicit
+      StaticPolynomial(StaticPolynomial<Type, OtherOrder> const& other);
+
+
+      /**
+       * This member function returns one coefficient of the
+       * polynomial.
+       *
+       * @param power This argument specifies which coefficient to
+       * return.  Setting it to 0 returns the constant term, 1 the
+       * linear term, and so on.
+       *
+       * @return The return value is the requested coefficient.
+       */
+      Type
+      getCoefficient(std::size_t power) const {
+        return m_coefficientArray[power];
+      }
+
+
+      /**
+       * This member function returns the coefficients of the
+       * polynomial, arranged as described in the documentation for
+       * constructor StaticPolynomial(Type const*).
+       *
+       * @return The return value is an array of coefficients.
+       */
+      StaticArray1D<Type, Order + 1> const&
+      getCoefficientArray() const {return m_coefficientArray;}
+
+
+      /**
+       * This member function returns the derivative of the
+       * polynomial.  The derivative of a constant is a constant
+       * polynomial with value zero.
+       *
+       * @return The return value is the derivative polynomial.
+       */
+      StaticPolynomial<Type, (Order > 0 ? Order - 1 : 0)>
+      getDerivative() const;
+
+
+      /**
+       * This member function returns the order of the polynomial, as
+       * fixed at compile time.  Leading coefficients may be zero, so
+       * the "true" order may be lower.
+       *
+       * @return The return value is template parameter Order.
+       */
+      static constexpr std::size_t
+      getOrder() {return Order;}
+
+
+      /**
+       * This member function evaluates both the polynomial and its
+       * first derivative, which is cheaper than calling operator()()
+       * and getDerivative() separately.
+       *
+       * @param xValue This argument specifies the value of x at which
+       * to evaluate the polynomial.
+       *
+       * @param derivative This argument is used to return the value
+       * of the first derivative at xValue.
+       *
+       * @return The return value is the value of the polynomial at
+       * xValue.
+       */
+      Type
+      evaluate(Type xValue, Type& derivative) const;
+
+
+      /**
+       * This member function sets one coefficient of the polynomial.
+       *
+       * @param power This argument specifies which coefficient to
+       * set.  Setting it to 0 selects the constant term, 1 the linear
+       * term, and so on.
+       *
+       * @param value This argument is the new value of the
+       * coefficient.
+       */
+      void
+      setCoefficient(std::size_t power, Type value) {
+        m_coefficientArray[power] = value;
+      }
+
+
+      /**
+       * This operator evaluates the polynomial using Horner's rule.
+       *
+       * @param xValue This argument specifies the value of x at which
+       * to evaluate the polynomial.
+       *
+       * @return The return value is the result of the evaluation.
+       */
+      Type
+      operator()(Type xValue) const;
+
+
+      /**
+       * This operator adds another polynomial of the same order to
+       * *this.
+       *
+       * @param other This argument is the the polynomial to be added
+       * to *this.
+       *
+       * @return The return value is a reference to *this.
+       */
+      StaticPolynomial<Type, Order>&
+      operator+=(StaticPolynomial<Type, Order> const& other);
+
+
+      /**
+       * This operator subtracts another polynomial of the same order
+       * from *this.
+       *
+       * @param other This argument is the the polynomial to be
+       * subtracted from *this.
+       *
+       * @return The return value is a reference to *this.
+       */
+      StaticPolynomial<Type, Order>&
+      operator-=(StaticPolynomial<Type, Order> const& other);
+
+
+      /**
+       * This operator multiplies every coefficient of the polynomial
+       * by a scalar.
+       *
+       * @param scalar This argument is the value by which to
+       * multiply.
+       *
+       * @return The return value is a reference to *this.
+       */
+      StaticPolynomial<Type, Order>&
+      operator*=(Type scalar);
+
+    private:
+
+      StaticArray1D<Type, Order + 1> m_coefficientArray;
+
+    };
+
+
+    /* ============ Non-member function declarations ============ */
+
+
+    /**
+     * This operator multiplies two StaticPolynomial instances.  The
+     * order of the result is the sum of the orders of the arguments,
+     * so no heap allocation is needed.
+     *
+     * @param arg0 This argument is one of the StaticPolynomial
+     * instances to be multiplied.
+     *
+     * @param arg1 This argument is one of the StaticPolynomial
+     * instances to be multiplied.
+     *
+     * @return The return value is the result of the multiplication.
+     */
+    template <class Type, std::size_t Order0, std::size_t Order1>
+    StaticPolynomial<Type, Order0 + Order1>
+    operator*(StaticPolynomial<Type, Order0> const& arg0,
+              StaticPolynomial<Type, Order1> const& arg1);
+
+
+    /**
+     * This operator adds two StaticPolynomial instances of the same
+     * order.
+     *
+     * @param arg0 This argument is one of the StaticPolynomial
+     * instances to be added.
+     *
+     * @param arg1 This argument is one of the StaticPolynomial
+     * instances to be added.
+     *
+     * @return The return value is the result of the addition.
+     */
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>
+    operator+(StaticPolynomial<Type, Order> const& arg0,
+              StaticPolynomial<Type, Order> const& arg1);
+
+
+    /**
+     * This operator subtracts two StaticPolynomial instances of the
+     * same order.
+     *
+     * @param arg0 This argument is the StaticPolynomial instance from
+     * which arg1 is to be subtracted.
+     *
+     * @param arg1 This argument is the StaticPolynomial instance to
+     * be subtracted from arg0.
+     *
+     * @return The return value is the result of the subtraction.
+     */
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>
+    operator-(StaticPolynomial<Type, Order> const& arg0,
+              StaticPolynomial<Type, Order> const& arg1);
+
+
+    /**
+     * This operator multiplies a StaticPolynomial by a scalar.
+     *
+     * @param arg0 This argument is the polynomial to be scaled.
+     *
+     * @param scalar This argument is the value by which to multiply.
+     *
+     * @return The return value is the result of the multiplication.
+     */
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>
+    operator*(StaticPolynomial<Type, Order> const& arg0, Type scalar);
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+// Include file containing definitions of inline and template
+// functions.
+#include <brick/numeric/staticPolynomial_impl.hh>
+
+#endif /* #ifndef BRICK_NUMERIC_STATICPOLYNOMIAL_HH */
@@ -0,0 +1,219 @@
+/**
+***************************************************************************
+* @file brick/numeric/staticPolynomial_impl.hh
+*
+* Header file defining inline and template functions declared in
+* staticPolynomial.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_NUMERIC_STATICPOLYNOMIAL_IMPL_HH
+#define BRICK_NUMERIC_STATICPOLYNOMIAL_IMPL_HH
+
+// This file is included by staticPolynomial.hh, and should not be
+// directly included by user code, so no need to include
+// staticPolynomial.hh here.
+//
+// #include <brick/numeric/staticPolynomial.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    // The default constructor makes a polynomial whose coefficients
+    // are all zero.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>::
+    StaticPolynomial()
+      : m_coefficientArray()
+    {
+      m_coefficientArray = Type(0);
+    }
+
+
+    // This constructor copies coefficients from a C-style array.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>::
+    StaticPolynomial(Type const* coefficients)
+      : m_coefficientArray()
+    {
+      for(std::size_t ii = 0; ii <= Order; ++ii) {
+        m_coefficientArray[ii] = coefficients[ii];
+      }
+    }
+
+
+    // This constructor copies coefficients from a StaticArray1D.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>::
+    StaticPolynomial(StaticArray1D<Type, Order + 1> const& coefficients)
+      : m_coefficientArray(coefficients)
+    {
+      // Empty.
+    }
+
+
+    // This constructor promotes a lower-order polynomial.
+    template <class Type, std::size_t Order>
+    template <std::size_t OtherOrder>
+    StaticPolynomial<Type, Order>::
+    StaticPolynomial(StaticPolynomial<Type, OtherOrder> const& other)
+      : m_coefficientArray()
+    {
+      static_assert(OtherOrder <= Order,
+                    "StaticPolynomial can't be narrowed to a lower order.");
+      m_coefficientArray = Type(0);
+      for(std::size_t ii = 0; ii <= OtherOrder; ++ii) {
+        m_coefficientArray[ii] = other.getCoefficient(ii);
+      }
+    }
+
+
+    // This member function returns the derivative of the
+    // polynomial.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, (Order > 0 ? Order - 1 : 0)>
+    StaticPolynomial<Type, Order>::
+    getDerivative() const
+    {
+      StaticPolynomial<Type, (Order > 0 ? Order - 1 : 0)> result;
+      for(std::size_t ii = 1; ii <= Order; ++ii) {
+        result.setCoefficient(
+          ii - 1, static_cast<Type>(ii) * m_coefficientArray[ii]);
+      }
+      return result;
+    }
+
+
+    // This member function evaluates both the polynomial and its
+    // first derivative.
+    template <class Type, std::size_t Order>
+    Type
+    StaticPolynomial<Type, Order>::
+    evaluate(Type xValue, Type& derivative) const
+    {
+      // Horner's rule, carrying the derivative along.
+      Type result = m_coefficientArray[Order];
+      derivative = Type(0);
+      for(std::size_t ii = Order; ii > 0; --ii) {
+        derivative = derivative * xValue + result;
+        result = result * xValue + m_coefficientArray[ii - 1];
+      }
+      return result;
+    }
+
+
+    // This operator evaluates the polynomial.
+    template <class Type, std::size_t Order>
+    Type
+    StaticPolynomial<Type, Order>::
+    operator()(Type xValue) const
+    {
+      Type result = m_coefficientArray[Order];
+      for(std::size_t ii = Order; ii > 0; --ii) {
+        result = result * xValue + m_coefficientArray[ii - 1];
+      }
+      return result;
+    }
+
+
+    // This operator adds another polynomial of the same order to
+    // *this.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>&
+    StaticPolynomial<Type, Order>::
+    operator+=(StaticPolynomial<Type, Order> const& other)
+    {
+      m_coefficientArray += other.m_coefficientArray;
+      return *this;
+    }
+
+
+    // This operator subtracts another polynomial of the same order
+    // from *this.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>&
+    StaticPolynomial<Type, Order>::
+    operator-=(StaticPolynomial<Type, Order> const& other)
+    {
+      m_coefficientArray -= other.m_coefficientArray;
+      return *this;
+    }
+
+
+    // This operator multiplies every coefficient of the polynomial
+    // by a scalar.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>&
+    StaticPolynomial<Type, Order>::
+    operator*=(Type scalar)
+    {
+      m_coefficientArray *= scalar;
+      return *this;
+    }
+
+
+    /* ============ Non-member function definitions ============ */
+
+
+    // This operator multiplies two StaticPolynomial instances.
+    template <class Type, std::size_t Order0, std::size_t Order1>
+    StaticPolynomial<Type, Order0 + Order1>
+    operator*(StaticPolynomial<Type, Order0> const& arg0,
+              StaticPolynomial<Type, Order1> const& arg1)
+    {
+      StaticArray1D<Type, Order0 + Order1 + 1> coefficients;
+      coefficients = Type(0);
+      for(std::size_t ii = 0; ii <= Order0; ++ii) {
+        Type const coefficient0 = arg0.getCoefficient(ii);
+        for(std::size_t jj = 0; jj <= Order1; ++jj) {
+          coefficients[ii + jj] += coefficient0 * arg1.getCoefficient(jj);
+        }
+      }
+      return StaticPolynomial<Type, Order0 + Order1>(coefficients);
+    }
+
+
+    // This operator adds two StaticPolynomial instances.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>
+    operator+(StaticPolynomial<Type, Order> const& arg0,
+              StaticPolynomial<Type, Order> const& arg1)
+    {
+      StaticPolynomial<Type, Order> result(arg0);
+      result += arg1;
+      return result;
+    }
+
+
+    // This operator subtracts two StaticPolynomial instances.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>
+    operator-(StaticPolynomial<Type, Order> const& arg0,
+              StaticPolynomial<Type, Order> const& arg1)
+    {
+      StaticPolynomial<Type, Order> result(arg0);
+      result -= arg1;
+      return result;
+    }
+
+
+    // This operator multiplies a StaticPolynomial by a scalar.
+    template <class Type, std::size_t Order>
+    StaticPolynomial<Type, Order>
+    operator*(StaticPolynomial<Type, Order> const& arg0, Type scalar)
+    {
+      StaticPolynomial<Type, Order> result(arg0);
+      result *= scalar;
+      return result;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_NUMERIC_STATICPOLYNOMIAL_IMPL_HH */
@@ -0,0 +1,363 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/amanatidesWoo2DBatchTest.cc
+*
+* Source file defining tests for traceRays() and EmptySpacePyramid2D.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <limits>
+#include <brick/numeric/amanatidesWoo2D.hh>
+#include <brick/numeric/amanatidesWoo2DBatch.hh>
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    class AmanatidesWoo2DBatchTest
+      : public brick::test::TestFixture<AmanatidesWoo2DBatchTest> {
+
+    public:
+
+      AmanatidesWoo2DBatchTest();
+      ~AmanatidesWoo2DBatchTest() {}
+
+      void setUp(const std::string& /* testName */);
+      void tearDown(const std::string& /* testName */) {}
+
+      void testTraceRaysFirstHit();
+      void testTraceRaysMaximum();
+      void testTraceRaysSharedOrigin();
+      void testTraceRaysSum();
+      void testTraceRaysThreaded();
+      void testEmptySpacePyramid();
+
+    private:
+
+      // Deterministic pseudo-random numbers in [0, 1).
+      double
+      getRandom();
+
+      // Trace a single ray with AmanatidesWoo2D, stopping at maximumT.
+      template <class Reducer>
+      typename Reducer::result_type
+      traceReference(Vector2D<double> const& origin,
+                     Vector2D<double> const& direction,
+                     Reducer const& reducer,
+                     double maximumT);
+
+      Array2D<double> m_data;
+      double m_defaultTolerance;
+      Array1D< Vector2D<double> > m_directions;
+      Array1D< Vector2D<double> > m_origins;
+      unsigned long m_seed;
+      Transform2D<double> m_pixelTworld;
+
+    }; // class AmanatidesWoo2DBatchTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    AmanatidesWoo2DBatchTest::
+    AmanatidesWoo2DBatchTest()
+      : brick::test::TestFixture<AmanatidesWoo2DBatchTest>(
+          "AmanatidesWoo2DBatchTest"),
+        m_data(),
+        m_defaultTolerance(1.0E-9),
+        m_directions(),
+        m_origins(),
+        m_seed(1),
+        m_pixelTworld()
+    {
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysFirstHit);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysMaximum);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysSharedOrigin);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysSum);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysThreaded);
+      BRICK_TEST_REGISTER_MEMBER(testEmptySpacePyramid);
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    setUp(const std::string& /* testName */)
+    {
+      m_seed = 1;
+
+      // Mostly empty image with a few occupied clusters, so that the
+      // pyramid has something to skip.
+      m_data.reinit(40, 56);
+      m_data = 0.0;
+      for(size_t ii = 0; ii < 30; ++ii) {
+        size_t row = static_cast<size_t>(this->getRandom() * 38);
+        size_t column = static_cast<size_t>(this->getRandom() * 54);
+        double value = 1.0 + static_cast<int>(this->getRandom() * 9);
+        m_data(row, column) = value;
+        m_data(row + 1, column + 1) = value + 1.0;
+      }
+
+      m_pixelTworld = Transform2D<double>(2.0, 0.0, 28.0,
+                                          0.0, 2.0, 20.0,
+                                          0.0, 0.0, 1.0);
+
+      // Some rays start inside the image, some outside, and some
+      // are parallel to an axis.  Axis-parallel rays are kept inside
+      // the image's extent in the other axis, since AmanatidesWoo2D,
+      // which we use as ground truth, doesn't reliably reject ones
+      // that miss.
+      size_t const numberOfRays = 500;
+      m_origins.reinit(numberOfRays);
+      m_directions.reinit(numberOfRays);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        m_origins[ii].setValue(this->getRandom() * 40.0 - 20.0,
+                               this->getRandom() * 30.0 - 15.0);
+        m_directions[ii].setValue(this->getRandom() * 2.0 - 1.0,
+                                  this->getRandom() * 2.0 - 1.0);
+        if(ii % 17 == 0) {
+          m_origins[ii].setValue(m_origins[ii].x() * 0.5, m_origins[ii].y());
+          m_directions[ii].setValue(0.0, m_directions[ii].y());
+        }
+      }
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    testTraceRaysFirstHit()
+    {
+      RayFirstHit<double> reducer(0.0);
+      Array1D<double> results;
+      traceRays(m_data, m_pixelTworld, m_origins, m_directions,
+                reducer, results);
+      BRICK_TEST_ASSERT(results.size() == m_origins.size());
+      size_t numberOfHits = 0;
+      for(size_t ii = 0; ii < m_origins.size(); ++ii) {
+        double reference = this->traceReference(
+          m_origins[ii], m_directions[ii], reducer,
+          std::numeric_limits<double>::max());
+        if(reference == std::numeric_limits<double>::max()) {
+          BRICK_TEST_ASSERT(results[ii] == reference);
+        } else {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(results[ii], reference,
+                                     m_defaultTolerance));
+          ++numberOfHits;
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfHits > 0);
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    testTraceRaysMaximum()
+    {
+      RayMaximum<double> reducer;
+      Array1D<double> results;
+      traceRays(m_data, m_pixelTworld, m_origins, m_directions,
+                reducer, results, 4.0);
+      for(size_t ii = 0; ii < m_origins.size(); ++ii) {
+        double reference = this->traceReference(
+          m_origins[ii], m_directions[ii], reducer, 4.0);
+        BRICK_TEST_ASSERT(results[ii] == reference);
+      }
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    testTraceRaysSharedOrigin()
+    {
+      Vector2D<double> origin(-0.5, 0.25);
+      Array1D< Vector2D<double> > origins(m_directions.size());
+      origins = origin;
+
+      RaySum<double> reducer;
+      Array1D<double> results0;
+      Array1D<double> results1;
+      traceRays(m_data, m_pixelTworld, origin, m_directions,
+                reducer, results0);
+      traceRays(m_data, m_pixelTworld, origins, m_directions,
+                reducer, results1);
+      for(size_t ii = 0; ii < m_directions.size(); ++ii) {
+        BRICK_TEST_ASSERT(results0[ii] == results1[ii]);
+        BRICK_TEST_ASSERT(
+          results0[ii] == this->traceReference(
+            origin, m_directions[ii], reducer,
+            std::numeric_limits<double>::max()));
+      }
+
+      // Mismatched array sizes should be rejected.
+      Array1D< Vector2D<double> > shortOrigins(origins.size() - 1);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        traceRays(m_data, m_pixelTworld, shortOrigins, m_directions,
+                  reducer, results1));
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    testTraceRaysSum()
+    {
+      // Integer-valued pixels make the sums exact, so the skipping
+      // and non-skipping paths must agree to the last bit.
+      EmptySpacePyramid2D pyramid(
+        m_data, [](double value) {return value == 0.0;}, 2, 3);
+      RaySum<double> reducer;
+      double const maximumTs[] = {std::numeric_limits<double>::max(), 3.0};
+      for(size_t jj = 0; jj < 2; ++jj) {
+        Array1D<double> results0;
+        Array1D<double> results1;
+        traceRays(m_data, m_pixelTworld, m_origins, m_directions,
+                  reducer, results0, maximumTs[jj]);
+        traceRays(m_data, m_pixelTworld, m_origins, m_directions,
+                  reducer, results1, maximumTs[jj], &pyramid);
+        for(size_t ii = 0; ii < m_origins.size(); ++ii) {
+          double reference = this->traceReference(
+            m_origins[ii], m_directions[ii], reducer, maximumTs[jj]);
+          BRICK_TEST_ASSERT(results0[ii] == reference);
+          BRICK_TEST_ASSERT(results1[ii] == reference);
+        }
+      }
+
+      // Length-weighted sums along an axis-aligned ray through a
+      // constant image are just path length.
+      Array2D<double> ones(5, 6);
+      ones = 1.0;
+      Array1D< Vector2D<double> > origins(1);
+      Array1D< Vector2D<double> > directions(1);
+      origins[0].setValue(-2.0, 2.5);
+      directions[0].setValue(1.0, 0.0);
+      Array1D<double> results;
+      traceRays(ones, Transform2D<double>(), origins, directions,
+                RaySum<double>(true), results);
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(results[0], 6.0, m_defaultTolerance));
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    testTraceRaysThreaded()
+    {
+      // Enough rays to span several tasks.
+      size_t const numberOfRays = 5000;
+      Array1D< Vector2D<double> > origins(numberOfRays);
+      Array1D< Vector2D<double> > directions(numberOfRays);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        origins[ii] = m_origins[ii % m_origins.size()];
+        directions[ii] = m_directions[(ii * 7) % m_directions.size()];
+      }
+      EmptySpacePyramid2D pyramid(
+        m_data, [](double value) {return value == 0.0;});
+      RayFirstHit<double> reducer(0.0);
+      Array1D<double> results0;
+      Array1D<double> results1;
+      traceRays(m_data, m_pixelTworld, origins, directions,
+                reducer, results0, std::numeric_limits<double>::max(),
+                &pyramid, 1);
+      traceRays(m_data, m_pixelTworld, origins, directions,
+                reducer, results1, std::numeric_limits<double>::max(),
+                &pyramid, 4);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        BRICK_TEST_ASSERT(results0[ii] == results1[ii]);
+      }
+    }
+
+
+    void
+    AmanatidesWoo2DBatchTest::
+    testEmptySpacePyramid()
+    {
+      EmptySpacePyramid2D pyramid0;
+      BRICK_TEST_ASSERT(pyramid0.getNumberOfLevels() == 0);
+
+      Array2D<double> data(9, 8);
+      data = 0.0;
+      data(8, 6) = 1.0;
+      EmptySpacePyramid2D pyramid1(
+        data, [](double value) {return value == 0.0;}, 2, 3);
+      BRICK_TEST_ASSERT(pyramid1.getNumberOfLevels() == 3);
+      BRICK_TEST_ASSERT(pyramid1.getBlockSize(0) == 2);
+      BRICK_TEST_ASSERT(pyramid1.getBlockSize(2) == 8);
+      BRICK_TEST_ASSERT(pyramid1.isEmpty(0, 0, 0));
+      BRICK_TEST_ASSERT(!pyramid1.isEmpty(0, 8, 7));
+      BRICK_TEST_ASSERT(pyramid1.isEmpty(0, 8, 5));
+      BRICK_TEST_ASSERT(pyramid1.isEmpty(2, 7, 7));
+      BRICK_TEST_ASSERT(!pyramid1.isEmpty(2, 8, 7));
+
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        EmptySpacePyramid2D(data, [](double value) {return value == 0.0;}, 3));
+    }
+
+
+    double
+    AmanatidesWoo2DBatchTest::
+    getRandom()
+    {
+      m_seed = (m_seed * 1103515245UL + 12345UL) % 2147483648UL;
+      return static_cast<double>(m_seed) / 2147483648.0;
+    }
+
+
+    template <class Reducer>
+    typename Reducer::result_type
+    AmanatidesWoo2DBatchTest::
+    traceReference(Vector2D<double> const& origin,
+                   Vector2D<double> const& direction,
+                   Reducer const& reducer,
+                   double maximumT)
+    {
+      typename Reducer::result_type result = reducer.initialize();
+      AmanatidesWoo2D< Array2D<double> > tracer(
+        m_data, m_pixelTworld, origin, direction, true);
+      if(!tracer.validIntersection()) {
+        return result;
+      }
+      typedef AmanatidesWoo2D< Array2D<double> >::iterator awIterator;
+      for(awIterator iter = tracer.begin(); iter != tracer.end(); ++iter) {
+        if(iter.tEntry() >= maximumT) {
+          break;
+        }
+        double tExit = iter.tExit();
+        if(!reducer(result, *iter, iter.tEntry(), std::min(tExit, maximumT))) {
+          break;
+        }
+        if(tExit >= maximumT) {
+          break;
+        }
+      }
+      return result;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::AmanatidesWoo2DBatchTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::AmanatidesWoo2DBatchTest currentTest;
+
+}
+
+#endif
@@ -0,0 +1,446 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/amanatidesWoo3DBatchTest.cc
+*
+* Source file defining tests for traceRays() and EmptySpacePyramid3D.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <limits>
+#include <brick/numeric/utilities.hh>
+#include <brick/numeric/amanatidesWoo3D.hh>
+#include <brick/numeric/amanatidesWoo3DBatch.hh>
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace numeric {
+
+    // Reduction functor that summarizes the sequence of voxels a ray
+    // visits, so that two traversals can be compared.  Each voxel of
+    // the traversed array must hold a distinct value.
+    class VoxelSequenceHash {
+    public:
+      typedef unsigned long result_type;
+
+      result_type
+      initialize() const {return 0UL;}
+
+      bool
+      operator()(result_type& result, double const& value,
+                 double /* tEntry */, double /* tExit */) const {
+        result = result * 1000003UL + static_cast<unsigned long>(value);
+        return true;
+      }
+    };
+
+
+    class AmanatidesWoo3DBatchTest
+      : public brick::test::TestFixture<AmanatidesWoo3DBatchTest> {
+
+    public:
+
+      AmanatidesWoo3DBatchTest();
+      ~AmanatidesWoo3DBatchTest() {}
+
+      void setUp(const std::string& /* testName */);
+      void tearDown(const std::string& /* testName */) {}
+
+      void testTraceRaysEdgesAndCorners();
+      void testTraceRaysFirstHit();
+      void testTraceRaysMaximum();
+      void testTraceRaysSharedOrigin();
+      void testTraceRaysSum();
+      void testTraceRaysThreaded();
+      void testEmptySpacePyramid();
+
+    private:
+
+      // Deterministic pseudo-random numbers in [0, 1).
+      double
+      getRandom();
+
+      // Trace a single ray with AmanatidesWoo3D, stopping at maximumT.
+      template <class Reducer>
+      typename Reducer::result_type
+      traceReference(Vector3D<double> const& origin,
+                     Vector3D<double> const& direction,
+                     Reducer const& reducer,
+                     double maximumT);
+
+      Array3D<double> m_data;
+      double m_defaultTolerance;
+      Array1D< Vector3D<double> > m_directions;
+      Array1D< Vector3D<double> > m_origins;
+      unsigned long m_seed;
+      Transform3D<double> m_voxelTworld;
+
+    }; // class AmanatidesWoo3DBatchTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    AmanatidesWoo3DBatchTest::
+    AmanatidesWoo3DBatchTest()
+      : brick::test::TestFixture<AmanatidesWoo3DBatchTest>(
+          "AmanatidesWoo3DBatchTest"),
+        m_data(),
+        m_defaultTolerance(1.0E-9),
+        m_directions(),
+        m_origins(),
+        m_seed(1),
+        m_voxelTworld()
+    {
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysEdgesAndCorners);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysFirstHit);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysMaximum);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysSharedOrigin);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysSum);
+      BRICK_TEST_REGISTER_MEMBER(testTraceRaysThreaded);
+      BRICK_TEST_REGISTER_MEMBER(testEmptySpacePyramid);
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    setUp(const std::string& /* testName */)
+    {
+      m_seed = 1;
+
+      // Mostly empty volume with a few occupied clusters, so that the
+      // pyramid has something to skip.
+      m_data.reinit(20, 24, 28);
+      m_data = 0.0;
+      for(size_t ii = 0; ii < 40; ++ii) {
+        size_t slice = static_cast<size_t>(this->getRandom() * 18);
+        size_t row = static_cast<size_t>(this->getRandom() * 22);
+        size_t column = static_cast<size_t>(this->getRandom() * 26);
+        double value = 1.0 + static_cast<int>(this->getRandom() * 9);
+        m_data(slice, row, column) = value;
+        m_data(slice + 1, row, column) = value + 1.0;
+        m_data(slice, row + 1, column + 1) = value + 2.0;
+      }
+
+      m_voxelTworld = Transform3D<double>(2.0, 0.0, 0.0, 14.0,
+                                          0.0, 2.0, 0.0, 12.0,
+                                          0.0, 0.0, 2.0, 10.0,
+                                          0.0, 0.0, 0.0, 1.0);
+
+      // Some rays start inside the volume, some outside, and some
+      // are parallel to an axis.  Axis-parallel rays are kept inside
+      // the volume's extent in the other two axes, since
+      // AmanatidesWoo3D, which we use as ground truth, doesn't
+      // reliably reject ones that miss.
+      size_t const numberOfRays = 500;
+      m_origins.reinit(numberOfRays);
+      m_directions.reinit(numberOfRays);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        m_origins[ii].setValue(this->getRandom() * 24.0 - 12.0,
+                               this->getRandom() * 24.0 - 12.0,
+                               this->getRandom() * 24.0 - 12.0);
+        m_directions[ii].setValue(this->getRandom() * 2.0 - 1.0,
+                                  this->getRandom() * 2.0 - 1.0,
+                                  this->getRandom() * 2.0 - 1.0);
+        if(ii % 17 == 0) {
+          m_origins[ii].setValue(m_origins[ii].x() * 0.4, m_origins[ii].y(),
+                                 m_origins[ii].z() * 0.4);
+          m_directions[ii].setValue(0.0, m_directions[ii].y(), 0.0);
+        }
+      }
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testTraceRaysEdgesAndCorners()
+    {
+      // Give each voxel a distinct value so that the reducer can
+      // tell which voxels were visited, and in what order.
+      for(size_t ii = 0; ii < m_data.size(); ++ii) {
+        m_data[ii] = static_cast<double>(ii + 1);
+      }
+
+      // Rays aimed exactly at voxel corners (and, for every third
+      // ray, at a point on a voxel edge), starting from an arbitrary
+      // distance back along the ray, so that roundoff in computing
+      // the entry point decides which neighboring voxel comes next.
+      size_t const numberOfRays = 3000;
+      Array1D< Vector3D<double> > origins(numberOfRays);
+      Array1D< Vector3D<double> > directions(numberOfRays);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        Vector3D<double> target(
+          static_cast<double>(1 + static_cast<int>(this->getRandom() * 26)),
+          static_cast<double>(1 + static_cast<int>(this->getRandom() * 22)),
+          static_cast<double>(1 + static_cast<int>(this->getRandom() * 18)));
+        if(ii % 3 == 0) {
+          target.setZ(target.z() + this->getRandom());
+        }
+        Vector3D<double> direction(this->getRandom() * 2.0 - 1.0,
+                                   this->getRandom() * 2.0 - 1.0,
+                                   this->getRandom() * 2.0 - 1.0);
+        if(ii % 5 == 0) {
+          // Diagonal rays pass through a whole line of corners.
+          direction.setValue(1.0, -1.0, 1.0);
+        }
+        double distance = 1.0 + this->getRandom() * 40.0;
+
+        // Convert to world coordinates.  m_voxelTworld scales by 2
+        // and offsets by (14, 12, 10).
+        Vector3D<double> voxelOrigin = target - distance * direction;
+        origins[ii].setValue((voxelOrigin.x() - 14.0) / 2.0,
+                             (voxelOrigin.y() - 12.0) / 2.0,
+                             (voxelOrigin.z() - 10.0) / 2.0);
+        directions[ii] = direction / 2.0;
+      }
+
+      VoxelSequenceHash reducer;
+      Array1D<unsigned long> results;
+      traceRays(m_data, m_voxelTworld, origins, directions, reducer, results);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        unsigned long reference = this->traceReference(
+          origins[ii], directions[ii], reducer,
+          std::numeric_limits<double>::max());
+        BRICK_TEST_ASSERT(results[ii] == reference);
+      }
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testTraceRaysFirstHit()
+    {
+      RayFirstHit<double> reducer(0.0);
+      Array1D<double> results;
+      traceRays(m_data, m_voxelTworld, m_origins, m_directions,
+                reducer, results);
+      BRICK_TEST_ASSERT(results.size() == m_origins.size());
+      size_t numberOfHits = 0;
+      for(size_t ii = 0; ii < m_origins.size(); ++ii) {
+        double reference = this->traceReference(
+          m_origins[ii], m_directions[ii], reducer,
+          std::numeric_limits<double>::max());
+        if(reference == std::numeric_limits<double>::max()) {
+          BRICK_TEST_ASSERT(results[ii] == reference);
+        } else {
+          BRICK_TEST_ASSERT(
+            test::approximatelyEqual(results[ii], reference,
+                                     m_defaultTolerance));
+          ++numberOfHits;
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfHits > 0);
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testTraceRaysMaximum()
+    {
+      RayMaximum<double> reducer;
+      Array1D<double> results;
+      traceRays(m_data, m_voxelTworld, m_origins, m_directions,
+                reducer, results, 4.0);
+      for(size_t ii = 0; ii < m_origins.size(); ++ii) {
+        double reference = this->traceReference(
+          m_origins[ii], m_directions[ii], reducer, 4.0);
+        BRICK_TEST_ASSERT(results[ii] == reference);
+      }
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testTraceRaysSharedOrigin()
+    {
+      Vector3D<double> origin(-0.5, 0.25, 0.75);
+      Array1D< Vector3D<double> > origins(m_directions.size());
+      origins = origin;
+
+      RaySum<double> reducer;
+      Array1D<double> results0;
+      Array1D<double> results1;
+      traceRays(m_data, m_voxelTworld, origin, m_directions,
+                reducer, results0);
+      traceRays(m_data, m_voxelTworld, origins, m_directions,
+                reducer, results1);
+      for(size_t ii = 0; ii < m_directions.size(); ++ii) {
+        BRICK_TEST_ASSERT(results0[ii] == results1[ii]);
+        BRICK_TEST_ASSERT(
+          results0[ii] == this->traceReference(
+            origin, m_directions[ii], reducer,
+            std::numeric_limits<double>::max()));
+      }
+
+      // Mismatched array sizes should be rejected.
+      Array1D< Vector3D<double> > shortOrigins(origins.size() - 1);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        traceRays(m_data, m_voxelTworld, shortOrigins, m_directions,
+                  reducer, results1));
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testTraceRaysSum()
+    {
+      // Integer-valued voxels make the sums exact, so the skipping
+      // and non-skipping paths must agree to the last bit.
+      EmptySpacePyramid3D pyramid(
+        m_data, [](double value) {return value == 0.0;}, 2, 3);
+      RaySum<double> reducer;
+      double const maximumTs[] = {std::numeric_limits<double>::max(), 3.0};
+      for(size_t jj = 0; jj < 2; ++jj) {
+        Array1D<double> results0;
+        Array1D<double> results1;
+        traceRays(m_data, m_voxelTworld, m_origins, m_directions,
+                  reducer, results0, maximumTs[jj]);
+        traceRays(m_data, m_voxelTworld, m_origins, m_directions,
+                  reducer, results1, maximumTs[jj], &pyramid);
+        for(size_t ii = 0; ii < m_origins.size(); ++ii) {
+          double reference = this->traceReference(
+            m_origins[ii], m_directions[ii], reducer, maximumTs[jj]);
+          BRICK_TEST_ASSERT(results0[ii] == reference);
+          BRICK_TEST_ASSERT(results1[ii] == reference);
+        }
+      }
+
+      // Length-weighted sums along an axis-aligned ray through a
+      // constant volume are just path length.
+      Array3D<double> ones(4, 5, 6);
+      ones = 1.0;
+      Array1D< Vector3D<double> > origins(1);
+      Array1D< Vector3D<double> > directions(1);
+      origins[0].setValue(-2.0, 2.5, 1.5);
+      directions[0].setValue(1.0, 0.0, 0.0);
+      Array1D<double> results;
+      traceRays(ones, Transform3D<double>(), origins, directions,
+                RaySum<double>(true), results);
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(results[0], 6.0, m_defaultTolerance));
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testTraceRaysThreaded()
+    {
+      // Enough rays to span several tasks.
+      size_t const numberOfRays = 5000;
+      Array1D< Vector3D<double> > origins(numberOfRays);
+      Array1D< Vector3D<double> > directions(numberOfRays);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        origins[ii] = m_origins[ii % m_origins.size()];
+        directions[ii] = m_directions[(ii * 7) % m_directions.size()];
+      }
+      EmptySpacePyramid3D pyramid(
+        m_data, [](double value) {return value == 0.0;});
+      RayFirstHit<double> reducer(0.0);
+      Array1D<double> results0;
+      Array1D<double> results1;
+      traceRays(m_data, m_voxelTworld, origins, directions,
+                reducer, results0, std::numeric_limits<double>::max(),
+                &pyramid, 1);
+      traceRays(m_data, m_voxelTworld, origins, directions,
+                reducer, results1, std::numeric_limits<double>::max(),
+                &pyramid, 4);
+      for(size_t ii = 0; ii < numberOfRays; ++ii) {
+        BRICK_TEST_ASSERT(results0[ii] == results1[ii]);
+      }
+    }
+
+
+    void
+    AmanatidesWoo3DBatchTest::
+    testEmptySpacePyramid()
+    {
+      EmptySpacePyramid3D pyramid0;
+      BRICK_TEST_ASSERT(pyramid0.getNumberOfLevels() == 0);
+
+      Array3D<double> data(9, 8, 8);
+      data = 0.0;
+      data(8, 1, 6) = 1.0;
+      EmptySpacePyramid3D pyramid1(
+        data, [](double value) {return value == 0.0;}, 2, 3);
+      BRICK_TEST_ASSERT(pyramid1.getNumberOfLevels() == 3);
+      BRICK_TEST_ASSERT(pyramid1.getBlockSize(0) == 2);
+      BRICK_TEST_ASSERT(pyramid1.getBlockSize(2) == 8);
+      BRICK_TEST_ASSERT(pyramid1.isEmpty(0, 0, 0, 0));
+      BRICK_TEST_ASSERT(!pyramid1.isEmpty(0, 8, 0, 7));
+      BRICK_TEST_ASSERT(pyramid1.isEmpty(0, 8, 2, 7));
+      BRICK_TEST_ASSERT(pyramid1.isEmpty(2, 7, 7, 7));
+      BRICK_TEST_ASSERT(!pyramid1.isEmpty(2, 8, 7, 7));
+
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        EmptySpacePyramid3D(data, [](double value) {return value == 0.0;}, 3));
+    }
+
+
+    double
+    AmanatidesWoo3DBatchTest::
+    getRandom()
+    {
+      m_seed = (m_seed * 1103515245UL + 12345UL) % 2147483648UL;
+      return static_cast<double>(m_seed) / 2147483648.0;
+    }
+
+
+    template <class Reducer>
+    typename Reducer::result_type
+    AmanatidesWoo3DBatchTest::
+    traceReference(Vector3D<double> const& origin,
+                   Vector3D<double> const& direction,
+                   Reducer const& reducer,
+                   double maximumT)
+    {
+      typename Reducer::result_type result = reducer.initialize();
+      AmanatidesWoo3D< Array3D<double> > tracer(
+        m_data, m_voxelTworld, origin, direction, true);
+      if(!tracer.validIntersection()) {
+        return result;
+      }
+      typedef AmanatidesWoo3D< Array3D<double> >::iterator awIterator;
+      for(awIterator iter = tracer.begin(); iter != tracer.end(); ++iter) {
+        if(iter.tEntry() >= maximumT) {
+          break;
+        }
+        double tExit = iter.tExit();
+        if(!reducer(result, *iter, iter.tEntry(), std::min(tExit, maximumT))) {
+          break;
+        }
+        if(tExit >= maximumT) {
+          break;
+        }
+      }
+      return result;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::AmanatidesWoo3DBatchTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::AmanatidesWoo3DBatchTest currentTest;
+
+}
+
+#endif
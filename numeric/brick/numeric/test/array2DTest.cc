@@ -121,6 +121,7 @@ namespace brick {
       void testShape__size_t();
       void testSize();
       void testTranspose();
+      void testTransposeInPlace();
       void testAssignmentOperator__Array2D();
       void testAssignmentOperator__Type();
       void testApplicationOperator__size_t();
@@ -213,6 +214,7 @@ namespace brick {
       BRICK_TEST_REGISTER_MEMBER(testShape__size_t);
       BRICK_TEST_REGISTER_MEMBER(testSize);
       BRICK_TEST_REGISTER_MEMBER(testTranspose);
+      BRICK_TEST_REGISTER_MEMBER(testTransposeInPlace);
       BRICK_TEST_REGISTER_MEMBER(testAssignmentOperator__Array2D);
       BRICK_TEST_REGISTER_MEMBER(testAssignmentOperator__Type);
       BRICK_TEST_REGISTER_MEMBER(testApplicationOperator__size_t);
@@ -1023,6 +1025,58 @@ namespace brick {
           ++index0;
         }
       }
+
+      // Transpose is done in blocks, so check a large, non-square
+      // array whose rows aren't contiguous.
+      Array2D<Type> array2(300, 517);
+      for(size_t row = 0; row < array2.rows(); ++row) {
+        for(size_t column = 0; column < array2.columns(); ++column) {
+          array2(row, column) = static_cast<Type>(row * 7 + column * 3);
+        }
+      }
+      Array2D<Type> array3 = array2.getRegion(
+        Index2D(5, 11), Index2D(290, 500));
+      Array2D<Type> array4 = array3.transpose();
+      BRICK_TEST_ASSERT(array4.rows() == array3.columns());
+      BRICK_TEST_ASSERT(array4.columns() == array3.rows());
+      for(size_t row = 0; row < array3.rows(); ++row) {
+        for(size_t column = 0; column < array3.columns(); ++column) {
+          BRICK_TEST_ASSERT(array4(column, row) == array3(row, column));
+        }
+      }
+    }
+
+
+    template <class Type>
+    void
+    Array2DTest<Type>::
+    testTransposeInPlace()
+    {
+      // Try sizes that are smaller than, equal to, and not a
+      // multiple of the block size.
+      size_t const sizes[] = {0, 1, 3, 32, 100};
+      for(size_t ii = 0; ii < sizeof(sizes) / sizeof(size_t); ++ii) {
+        Array2D<Type> array0(sizes[ii], sizes[ii]);
+        for(size_t row = 0; row < array0.rows(); ++row) {
+          for(size_t column = 0; column < array0.columns(); ++column) {
+            array0(row, column) = static_cast<Type>(row * 1000 + column);
+          }
+        }
+        Array2D<Type> array1 = array0.transpose();
+        array0.transposeInPlace();
+        BRICK_TEST_ASSERT(array0.rows() == sizes[ii]);
+        BRICK_TEST_ASSERT(array0.columns() == sizes[ii]);
+        for(size_t row = 0; row < array0.rows(); ++row) {
+          for(size_t column = 0; column < array0.columns(); ++column) {
+            BRICK_TEST_ASSERT(array0(row, column) == array1(row, column));
+          }
+        }
+      }
+
+      // Non-square arrays can't be transposed in place.
+      Array2D<Type> array2(3, 4);
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  array2.transposeInPlace());
     }
 
 
@@ -0,0 +1,268 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/array2DViewTest.cc
+*
+* Source file defining tests for Array2DView.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <brick/numeric/array2DView.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace numeric {
+
+    class Array2DViewTest
+      : public brick::test::TestFixture<Array2DViewTest> {
+
+    public:
+
+      Array2DViewTest();
+      ~Array2DViewTest() {};
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testConstructors();
+      void testCopy();
+      void testGetRegion();
+      void testLayout();
+      void testTranspose();
+
+    private:
+
+      Array2D<int> getTestArray(std::size_t rows, std::size_t columns);
+
+    }; // class Array2DViewTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    Array2DViewTest::
+    Array2DViewTest()
+      : brick::test::TestFixture<Array2DViewTest>("Array2DViewTest")
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testConstructors);
+      BRICK_TEST_REGISTER_MEMBER(testCopy);
+      BRICK_TEST_REGISTER_MEMBER(testGetRegion);
+      BRICK_TEST_REGISTER_MEMBER(testLayout);
+      BRICK_TEST_REGISTER_MEMBER(testTranspose);
+    }
+
+
+    void
+    Array2DViewTest::
+    testConstructors()
+    {
+      Array2DView<int> view0;
+      BRICK_TEST_ASSERT(view0.rows() == 0);
+      BRICK_TEST_ASSERT(view0.columns() == 0);
+      BRICK_TEST_ASSERT(view0.size() == 0);
+
+      Array2D<int> array0 = this->getTestArray(4, 6);
+      Array2DView<int> view1(array0);
+      BRICK_TEST_ASSERT(view1.rows() == 4);
+      BRICK_TEST_ASSERT(view1.columns() == 6);
+      BRICK_TEST_ASSERT(view1.data() == array0.data());
+      BRICK_TEST_ASSERT(view1.getRowStride() == 6);
+      BRICK_TEST_ASSERT(view1.getColumnStride() == 1);
+      for(std::size_t rr = 0; rr < array0.rows(); ++rr) {
+        for(std::size_t cc = 0; cc < array0.columns(); ++cc) {
+          BRICK_TEST_ASSERT(view1(rr, cc) == array0(rr, cc));
+        }
+      }
+
+      // Views share memory with the array.
+      view1(2, 3) = -1;
+      BRICK_TEST_ASSERT(array0(2, 3) == -1);
+
+      // Read-only views.
+      Array2D<int> const& constArray = array0;
+      Array2DView<int const> view2(constArray);
+      Array2DView<int const> view3(view1);
+      BRICK_TEST_ASSERT(view2(2, 3) == -1);
+      BRICK_TEST_ASSERT(view3(2, 3) == -1);
+
+      // Arbitrary memory, here a column-major 3x2 array.
+      int buffer[] = {0, 1, 2, 10, 11, 12};
+      Array2DView<int> view4(buffer, 3, 2, 1, 3);
+      for(std::size_t rr = 0; rr < 3; ++rr) {
+        for(std::size_t cc = 0; cc < 2; ++cc) {
+          BRICK_TEST_ASSERT(view4(rr, cc) == static_cast<int>(10 * cc + rr));
+        }
+      }
+    }
+
+
+    void
+    Array2DViewTest::
+    testCopy()
+    {
+      Array2D<int> array0 = this->getTestArray(70, 45);
+      Array2DView<int> view0 = Array2DView<int>(array0).transpose();
+
+      Array2D<int> array1 = view0.copy();
+      BRICK_TEST_ASSERT(array1.rows() == 45);
+      BRICK_TEST_ASSERT(array1.columns() == 70);
+      for(std::size_t rr = 0; rr < array1.rows(); ++rr) {
+        for(std::size_t cc = 0; cc < array1.columns(); ++cc) {
+          BRICK_TEST_ASSERT(array1(rr, cc) == array0(cc, rr));
+        }
+      }
+
+      // The copy doesn't share memory with the original.
+      array1(0, 0) = -1;
+      BRICK_TEST_ASSERT(array0(0, 0) == 0);
+
+      Array2D<int> array2(45, 70);
+      view0.copyTo(array2);
+      for(std::size_t rr = 0; rr < array2.rows(); ++rr) {
+        for(std::size_t cc = 0; cc < array2.columns(); ++cc) {
+          BRICK_TEST_ASSERT(array2(rr, cc) == array0(cc, rr));
+        }
+      }
+
+      Array2D<int> array3(70, 45);
+      BRICK_TEST_ASSERT_EXCEPTION(common::ValueException,
+                                  view0.copyTo(array3));
+    }
+
+
+    void
+    Array2DViewTest::
+    testGetRegion()
+    {
+      Array2D<int> array0 = this->getTestArray(8, 10);
+      Array2DView<int> view0(array0);
+
+      Array2DView<int> region = view0.getRegion(2, 3, 4, 5);
+      BRICK_TEST_ASSERT(region.rows() == 4);
+      BRICK_TEST_ASSERT(region.columns() == 5);
+      for(std::size_t rr = 0; rr < region.rows(); ++rr) {
+        for(std::size_t cc = 0; cc < region.columns(); ++cc) {
+          BRICK_TEST_ASSERT(region(rr, cc) == array0(rr + 2, cc + 3));
+        }
+      }
+
+      Array2DView<int> row = view0.getRow(5);
+      BRICK_TEST_ASSERT(row.rows() == 1);
+      BRICK_TEST_ASSERT(row.columns() == 10);
+      for(std::size_t cc = 0; cc < row.columns(); ++cc) {
+        BRICK_TEST_ASSERT(row(0, cc) == array0(5, cc));
+      }
+
+      Array2DView<int> column = view0.getColumn(7);
+      BRICK_TEST_ASSERT(column.rows() == 8);
+      BRICK_TEST_ASSERT(column.columns() == 1);
+      for(std::size_t rr = 0; rr < column.rows(); ++rr) {
+        BRICK_TEST_ASSERT(column(rr, 0) == array0(rr, 7));
+      }
+
+      BRICK_TEST_ASSERT_EXCEPTION(common::IndexException,
+                                  view0.getRegion(5, 0, 4, 1));
+      BRICK_TEST_ASSERT_EXCEPTION(common::IndexException,
+                                  view0.getColumn(10));
+    }
+
+
+    void
+    Array2DViewTest::
+    testLayout()
+    {
+      Array2D<int> array0 = this->getTestArray(5, 7);
+      Array2DView<int> view0(array0);
+      BRICK_TEST_ASSERT(view0.isRowMajor());
+      BRICK_TEST_ASSERT(!view0.isColumnMajor());
+      BRICK_TEST_ASSERT(!view0.transpose().isRowMajor());
+      BRICK_TEST_ASSERT(view0.transpose().isColumnMajor());
+
+      // A region keeps the stride of the full array.
+      Array2DView<int> region = view0.getRegion(1, 1, 3, 3);
+      BRICK_TEST_ASSERT(region.isRowMajor());
+      BRICK_TEST_ASSERT(region.getRowStride() == 7);
+      BRICK_TEST_ASSERT(region.transpose().isColumnMajor());
+
+      // A single row is contiguous either way, but a single column
+      // of a row-major array is not.
+      BRICK_TEST_ASSERT(view0.getRow(2).isColumnMajor());
+      BRICK_TEST_ASSERT(view0.getRow(2).isRowMajor());
+      BRICK_TEST_ASSERT(!view0.getColumn(2).isColumnMajor());
+      BRICK_TEST_ASSERT(view0.getColumn(2).transpose().isColumnMajor());
+    }
+
+
+    void
+    Array2DViewTest::
+    testTranspose()
+    {
+      Array2D<int> array0 = this->getTestArray(3, 5);
+      Array2DView<int> view0(array0);
+      Array2DView<int> view1 = view0.transpose();
+      BRICK_TEST_ASSERT(view1.rows() == 5);
+      BRICK_TEST_ASSERT(view1.columns() == 3);
+      BRICK_TEST_ASSERT(view1.data() == array0.data());
+      BRICK_TEST_ASSERT(view1.getRowStride() == 1);
+      BRICK_TEST_ASSERT(view1.getColumnStride() == 5);
+      for(std::size_t rr = 0; rr < view1.rows(); ++rr) {
+        for(std::size_t cc = 0; cc < view1.columns(); ++cc) {
+          BRICK_TEST_ASSERT(view1(rr, cc) == array0(cc, rr));
+        }
+      }
+
+      // Transposing twice gets back to the original.
+      Array2DView<int> view2 = view1.transpose();
+      BRICK_TEST_ASSERT(view2.rows() == 3);
+      BRICK_TEST_ASSERT(view2.columns() == 5);
+      BRICK_TEST_ASSERT(view2.getRowStride() == view0.getRowStride());
+      BRICK_TEST_ASSERT(view2.getColumnStride() == view0.getColumnStride());
+
+      // Writes through a transposed view land in the right place.
+      view1(4, 1) = -1;
+      BRICK_TEST_ASSERT(array0(1, 4) == -1);
+    }
+
+
+    Array2D<int>
+    Array2DViewTest::
+    getTestArray(std::size_t rows, std::size_t columns)
+    {
+      Array2D<int> result(rows, columns);
+      for(std::size_t rr = 0; rr < rows; ++rr) {
+        for(std::size_t cc = 0; cc < columns; ++cc) {
+          result(rr, cc) = static_cast<int>(rr * 100 + cc);
+        }
+      }
+      return result;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::Array2DViewTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::Array2DViewTest currentTest;
+
+}
+
+#endif
@@ -0,0 +1,279 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/arrayExpressionTest.cc
+*
+* Source file defining tests for lazy array expressions.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <brick/common/exception.hh>
+#include <brick/numeric/arrayExpression.hh>
+#include <brick/numeric/index2D.hh>
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace numeric {
+
+    class ArrayExpressionTest
+      : public brick::test::TestFixture<ArrayExpressionTest> {
+
+    public:
+
+      ArrayExpressionTest();
+      ~ArrayExpressionTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testArray1DExpression();
+      void testArray2DExpression();
+      void testArray2DExpressionNonContiguous();
+      void testInPlaceEvaluation();
+      void testSizeMismatch();
+
+    private:
+
+      bool
+      isEqual(Array1D<double> const& array0, Array1D<double> const& array1);
+
+      bool
+      isEqual(Array2D<double> const& array0, Array2D<double> const& array1);
+
+      Array1D<double> m_array1D0;
+      Array1D<double> m_array1D1;
+      Array1D<double> m_array1D2;
+      Array2D<double> m_array2D0;
+      Array2D<double> m_array2D1;
+      double m_defaultTolerance;
+
+    }; // class ArrayExpressionTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    ArrayExpressionTest::
+    ArrayExpressionTest()
+      : brick::test::TestFixture<ArrayExpressionTest>("ArrayExpressionTest"),
+        m_array1D0("[1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0]"),
+        m_array1D1("[0.5, -1.0, 2.5, 8.0, -3.0, 1.5, 11.0]"),
+        m_array1D2("[2.0, 4.0, 0.5, -1.0, 3.0, 6.0, 0.25]"),
+        m_array2D0("[[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]]"),
+        m_array2D1("[[0.5, -1.0, 2.0], [7.0, 0.25, -6.0]]"),
+        m_defaultTolerance(1.0E-12)
+    {
+      BRICK_TEST_REGISTER_MEMBER(testArray1DExpression);
+      BRICK_TEST_REGISTER_MEMBER(testArray2DExpression);
+      BRICK_TEST_REGISTER_MEMBER(testArray2DExpressionNonContiguous);
+      BRICK_TEST_REGISTER_MEMBER(testInPlaceEvaluation);
+      BRICK_TEST_REGISTER_MEMBER(testSizeMismatch);
+    }
+
+
+    void
+    ArrayExpressionTest::
+    testArray1DExpression()
+    {
+      // Results should match the eager operators exactly.
+      Array1D<double> reference =
+        (m_array1D0 * 3.0 + m_array1D1) - m_array1D0 / m_array1D2;
+      Array1D<double> result =
+        (lazy(m_array1D0) * 3.0 + m_array1D1) - m_array1D0 / lazy(m_array1D2);
+      BRICK_TEST_ASSERT(this->isEqual(result, reference));
+
+      reference = 2.0 - m_array1D0 * m_array1D1;
+      result = 2.0 - lazy(m_array1D0) * lazy(m_array1D1);
+      BRICK_TEST_ASSERT(this->isEqual(result, reference));
+
+      // Explicit evaluation.
+      reference = m_array1D0 + m_array1D1;
+      result = (lazy(m_array1D0) + m_array1D1).eval();
+      BRICK_TEST_ASSERT(this->isEqual(result, reference));
+      result = eval(m_array1D0 - lazy(m_array1D1));
+      BRICK_TEST_ASSERT(this->isEqual(result, m_array1D0 - m_array1D1));
+
+      // Assignment should rebind, not overwrite shared data.
+      Array1D<double> original = m_array1D0.copy();
+      Array1D<double> alias = original;
+      alias = lazy(original) * 2.0;
+      BRICK_TEST_ASSERT(this->isEqual(original, m_array1D0));
+      BRICK_TEST_ASSERT(this->isEqual(alias, m_array1D0 * 2.0));
+      BRICK_TEST_ASSERT(alias.data() != original.data());
+    }
+
+
+    void
+    ArrayExpressionTest::
+    testArray2DExpression()
+    {
+      Array2D<double> reference =
+        m_array2D0 * m_array2D1 - m_array2D0 / 4.0 + 1.0;
+      Array2D<double> result =
+        lazy(m_array2D0) * m_array2D1 - lazy(m_array2D0) / 4.0 + 1.0;
+      BRICK_TEST_ASSERT(result.rows() == m_array2D0.rows());
+      BRICK_TEST_ASSERT(result.columns() == m_array2D0.columns());
+      BRICK_TEST_ASSERT(this->isEqual(result, reference));
+    }
+
+
+    void
+    ArrayExpressionTest::
+    testArray2DExpressionNonContiguous()
+    {
+      // Build two arrays that are views into the interiors of larger
+      // arrays, so that rowStep != columns.
+      Array2D<double> big0(5, 6);
+      Array2D<double> big1(5, 6);
+      for(size_t ii = 0; ii < big0.size(); ++ii) {
+        big0[ii] = 0.5 * ii;
+        big1[ii] = 10.0 - ii;
+      }
+      Array2D<double> view0 = big0.getRegion(Index2D(1, 1), Index2D(4, 5));
+      Array2D<double> view1 = big1.getRegion(Index2D(2, 0), Index2D(5, 4));
+      BRICK_TEST_ASSERT(!view0.isContiguous());
+
+      Array2D<double> reference = view0 * 2.0 + view1;
+      Array2D<double> result = lazy(view0) * 2.0 + view1;
+      BRICK_TEST_ASSERT(result.isContiguous());
+      BRICK_TEST_ASSERT(this->isEqual(result, reference));
+
+      // In-place evaluation into a view must not touch the border.
+      Array2D<double> bigCopy = big0.copy();
+      view0.copy(lazy(view1) - 1.0);
+      for(size_t row = 0; row < big0.rows(); ++row) {
+        for(size_t column = 0; column < big0.columns(); ++column) {
+          if(row >= 1 && row < 4 && column >= 1 && column < 5) {
+            BRICK_TEST_ASSERT(
+              test::approximatelyEqual(
+                big0(row, column), view1(row - 1, column - 1) - 1.0,
+                m_defaultTolerance));
+          } else {
+            BRICK_TEST_ASSERT(big0(row, column) == bigCopy(row, column));
+          }
+        }
+      }
+    }
+
+
+    void
+    ArrayExpressionTest::
+    testInPlaceEvaluation()
+    {
+      Array1D<double> target = m_array1D0.copy();
+      double* dataPtr = target.data();
+      target.copy(lazy(m_array1D1) * m_array1D2);
+      BRICK_TEST_ASSERT(target.data() == dataPtr);
+      BRICK_TEST_ASSERT(this->isEqual(target, m_array1D1 * m_array1D2));
+
+      target += lazy(m_array1D0) * 2.0;
+      BRICK_TEST_ASSERT(target.data() == dataPtr);
+      BRICK_TEST_ASSERT(
+        this->isEqual(target, m_array1D1 * m_array1D2 + m_array1D0 * 2.0));
+
+      target -= lazy(m_array1D0) * 2.0;
+      BRICK_TEST_ASSERT(this->isEqual(target, m_array1D1 * m_array1D2));
+
+      // Expressions may refer to the array being updated.
+      target.copy(lazy(target) + target);
+      BRICK_TEST_ASSERT(
+        this->isEqual(target, (m_array1D1 * m_array1D2) * 2.0));
+
+      Array2D<double> target2D = m_array2D0.copy();
+      target2D += lazy(m_array2D1) / 2.0;
+      BRICK_TEST_ASSERT(this->isEqual(target2D, m_array2D0 + m_array2D1 / 2.0));
+      target2D -= lazy(m_array2D1) / 2.0;
+      BRICK_TEST_ASSERT(this->isEqual(target2D, m_array2D0));
+    }
+
+
+    void
+    ArrayExpressionTest::
+    testSizeMismatch()
+    {
+      Array1D<double> shortArray(3);
+      shortArray = 1.0;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException, lazy(m_array1D0) + shortArray);
+
+      Array1D<double> target(3);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException, target.copy(lazy(m_array1D0) * 2.0));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException, target += lazy(m_array1D0));
+
+      // For 2D expressions, the shapes must match, not just the sizes.
+      Array2D<double> transposed = m_array2D1.transpose();
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException, lazy(m_array2D0) - transposed);
+      Array2D<double> target2D(3, 2);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException, target2D.copy(lazy(m_array2D0) + 1.0));
+    }
+
+
+    bool
+    ArrayExpressionTest::
+    isEqual(Array1D<double> const& array0, Array1D<double> const& array1)
+    {
+      if(array0.size() != array1.size()) {
+        return false;
+      }
+      for(size_t ii = 0; ii < array0.size(); ++ii) {
+        if(!test::approximatelyEqual(array0[ii], array1[ii],
+                                     m_defaultTolerance)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    bool
+    ArrayExpressionTest::
+    isEqual(Array2D<double> const& array0, Array2D<double> const& array1)
+    {
+      if(array0.rows() != array1.rows()
+         || array0.columns() != array1.columns()) {
+        return false;
+      }
+      for(size_t row = 0; row < array0.rows(); ++row) {
+        for(size_t column = 0; column < array0.columns(); ++column) {
+          if(!test::approximatelyEqual(array0(row, column), array1(row, column),
+                                       m_defaultTolerance)) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::ArrayExpressionTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::ArrayExpressionTest currentTest;
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 ***************************************************************************
 **/
 
+#include <cmath>
 #include <limits>
 
 #include <brick/common/functional.hh>
@@ -35,6 +36,9 @@ namespace brick {
 
       // Tests of member functions.
       void testApproximateScatteredData();
+      void testApproximateScatteredDataThreaded();
+      void testEvaluateGrid();
+      void testEvaluateMany();
       void testPromote();
       void testOperatorPlusEquals();
 
@@ -54,6 +58,9 @@ namespace brick {
     {
       // Register all tests.
       BRICK_TEST_REGISTER_MEMBER(testApproximateScatteredData);
+      BRICK_TEST_REGISTER_MEMBER(testApproximateScatteredDataThreaded);
+      BRICK_TEST_REGISTER_MEMBER(testEvaluateGrid);
+      BRICK_TEST_REGISTER_MEMBER(testEvaluateMany);
       BRICK_TEST_REGISTER_MEMBER(testPromote);
       BRICK_TEST_REGISTER_MEMBER(testOperatorPlusEquals);
     }
@@ -120,6 +127,142 @@ namespace brick {
     } // testApproximateScatteredData.
 
 
+    void
+    BSpline2DTest::
+    testApproximateScatteredDataThreaded()
+    {
+      // Lots of made up scattered data, so that each thread gets
+      // plenty to do.
+      size_t const numberOfPoints = 5000;
+      Array1D<double> sCoords(numberOfPoints);
+      Array1D<double> tCoords(numberOfPoints);
+      Array1D<double> zCoords(numberOfPoints);
+      for(size_t index0 = 0; index0 < numberOfPoints; ++index0) {
+        sCoords[index0] = 6.0 * std::fmod(0.6180339887 * index0, 1.0);
+        tCoords[index0] = 4.0 * std::fmod(0.7548776662 * index0, 1.0);
+        zCoords[index0] = std::sin(sCoords[index0]) * tCoords[index0];
+      }
+
+      BSpline2D<double> serialSpline;
+      serialSpline.setNumberOfNodes(20, 15);
+      serialSpline.approximateScatteredData(
+        sCoords.begin(), sCoords.end(), tCoords.begin(), zCoords.begin());
+
+      for(size_t numberOfThreads = 0; numberOfThreads < 5; ++numberOfThreads) {
+        BSpline2D<double> threadedSpline;
+        threadedSpline.setNumberOfNodes(20, 15);
+        threadedSpline.setNumberOfThreads(numberOfThreads);
+        BRICK_TEST_ASSERT(threadedSpline.getNumberOfThreads()
+                          == numberOfThreads);
+        threadedSpline.approximateScatteredData(
+          sCoords.begin(), sCoords.end(), tCoords.begin(), zCoords.begin());
+        for(double ss = 0.0; ss < 5.9; ss += 0.3) {
+          for(double tt = 0.0; tt < 3.9; tt += 0.3) {
+            BRICK_TEST_ASSERT(
+              approximatelyEqual(threadedSpline(ss, tt), serialSpline(ss, tt),
+                                 this->m_defaultTolerance));
+          }
+        }
+      }
+    }
+
+
+    void
+    BSpline2DTest::
+    testEvaluateGrid()
+    {
+      // Arbitrary, made up control points.
+      Array2D<double> controlPoints(7, 9);
+      for(size_t index0 = 0; index0 < controlPoints.size(); ++index0) {
+        controlPoints[index0] = std::cos(0.37 * index0) * (index0 % 5);
+      }
+      BSpline2D<double> bSpline;
+      bSpline.setControlPoints(controlPoints);
+
+      // Valid range is [0, 6) in S, and [0, 4) in T.
+      Array1D<double> sValues(31);
+      for(size_t index0 = 0; index0 < sValues.size(); ++index0) {
+        sValues[index0] = 0.19 * index0;
+      }
+      Array1D<double> tValues(17);
+      for(size_t index0 = 0; index0 < tValues.size(); ++index0) {
+        tValues[index0] = 3.99 - 0.23 * index0;
+      }
+
+      Array2D<double> gridValues;
+      bSpline.evaluateGrid(sValues, tValues, gridValues);
+      BRICK_TEST_ASSERT(gridValues.rows() == tValues.size());
+      BRICK_TEST_ASSERT(gridValues.columns() == sValues.size());
+      for(size_t row = 0; row < tValues.size(); ++row) {
+        for(size_t column = 0; column < sValues.size(); ++column) {
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(gridValues(row, column),
+                               bSpline(sValues[column], tValues[row]),
+                               this->m_defaultTolerance));
+        }
+      }
+
+      // Out of range coordinates should be rejected.
+      double const validS = sValues[3];
+      sValues[3] = 6.5;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        bSpline.evaluateGrid(sValues, tValues, gridValues));
+
+      // Including those one to three cells below the minimum, whose
+      // cell indices are negative.
+      double const belowMinimum[] = {-0.5, -1.5, -2.5, -3.5};
+      for(size_t index0 = 0; index0 < 4; ++index0) {
+        sValues[3] = belowMinimum[index0];
+        BRICK_TEST_ASSERT_EXCEPTION(
+          common::ValueException,
+          bSpline.evaluateGrid(sValues, tValues, gridValues));
+      }
+      sValues[3] = validS;
+      double const validT = tValues[5];
+      for(size_t index0 = 0; index0 < 4; ++index0) {
+        tValues[5] = belowMinimum[index0];
+        BRICK_TEST_ASSERT_EXCEPTION(
+          common::ValueException,
+          bSpline.evaluateGrid(sValues, tValues, gridValues));
+      }
+      tValues[5] = validT;
+      bSpline.evaluateGrid(sValues, tValues, gridValues);
+    }
+
+
+    void
+    BSpline2DTest::
+    testEvaluateMany()
+    {
+      Array2D<double> controlPoints(6, 8);
+      for(size_t index0 = 0; index0 < controlPoints.size(); ++index0) {
+        controlPoints[index0] = std::sin(0.61 * index0) + 0.1 * index0;
+      }
+      BSpline2D<double> bSpline;
+      bSpline.setControlPoints(controlPoints);
+
+      size_t const numberOfPoints = 1001;
+      Array1D<double> sValues(numberOfPoints);
+      Array1D<double> tValues(numberOfPoints);
+      for(size_t index0 = 0; index0 < numberOfPoints; ++index0) {
+        sValues[index0] = 5.0 * std::fmod(0.318 * index0, 1.0);
+        tValues[index0] = 3.0 * std::fmod(0.577 * index0, 1.0);
+      }
+
+      for(size_t numberOfThreads = 0; numberOfThreads < 4; ++numberOfThreads) {
+        bSpline.setNumberOfThreads(numberOfThreads);
+        Array1D<double> results(numberOfPoints);
+        bSpline.evaluateMany(sValues.begin(), sValues.end(), tValues.begin(),
+                             results.begin());
+        for(size_t index0 = 0; index0 < numberOfPoints; ++index0) {
+          BRICK_TEST_ASSERT(
+            results[index0] == bSpline(sValues[index0], tValues[index0]));
+        }
+      }
+    }
+
+
     void
     BSpline2DTest::
     testPromote()
@@ -0,0 +1,243 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/matchTemplate2DTest.cc
+*
+* Source file defining tests for matchTemplate2D().
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <brick/numeric/matchTemplate2D.hh>
+#include <brick/numeric/normalizedCorrelator.hh>
+#include <brick/numeric/utilities.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace numeric {
+
+    class MatchTemplate2DTest
+      : public brick::test::TestFixture<MatchTemplate2DTest> {
+
+    public:
+
+      MatchTemplate2DTest();
+      ~MatchTemplate2DTest() {};
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testMatchTemplate2D();
+      void testMatchTemplate2DExactMatch();
+      void testMatchTemplate2DFlatRegions();
+      void testMatchTemplate2DErrors();
+
+    private:
+
+      Array2D<double>
+      getImage(size_t rows, size_t columns);
+
+      double m_defaultTolerance;
+
+    }; // class MatchTemplate2DTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    MatchTemplate2DTest::
+    MatchTemplate2DTest()
+      : brick::test::TestFixture<MatchTemplate2DTest>("MatchTemplate2DTest"),
+        m_defaultTolerance(1.0E-9)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testMatchTemplate2D);
+      BRICK_TEST_REGISTER_MEMBER(testMatchTemplate2DExactMatch);
+      BRICK_TEST_REGISTER_MEMBER(testMatchTemplate2DFlatRegions);
+      BRICK_TEST_REGISTER_MEMBER(testMatchTemplate2DErrors);
+    }
+
+
+    void
+    MatchTemplate2DTest::
+    testMatchTemplate2D()
+    {
+      Array2D<double> image = this->getImage(23, 29);
+      Array2D<double> templateArray(5, 7);
+      for(size_t row = 0; row < templateArray.rows(); ++row) {
+        for(size_t column = 0; column < templateArray.columns(); ++column) {
+          templateArray(row, column) =
+            std::cos(0.9 * row) + 0.5 * std::sin(0.4 * column * column);
+        }
+      }
+
+      Array2D<double> directResult;
+      Array2D<double> fftResult;
+      matchTemplate2D(image, templateArray, directResult,
+                      BRICK_TEMPLATE_MATCH_DIRECT);
+      matchTemplate2D(image, templateArray, fftResult,
+                      BRICK_TEMPLATE_MATCH_FFT);
+      Array2D<double> autoResult =
+        matchTemplate2D<double>(image, templateArray);
+
+      BRICK_TEST_ASSERT(directResult.rows() == 19);
+      BRICK_TEST_ASSERT(directResult.columns() == 23);
+      BRICK_TEST_ASSERT(fftResult.rows() == 19);
+      BRICK_TEST_ASSERT(fftResult.columns() == 23);
+      BRICK_TEST_ASSERT(autoResult.rows() == 19);
+      BRICK_TEST_ASSERT(autoResult.columns() == 23);
+
+      // Compare against NormalizedCorrelator at every offset.
+      for(size_t row = 0; row < directResult.rows(); ++row) {
+        for(size_t column = 0; column < directResult.columns(); ++column) {
+          NormalizedCorrelator<double> correlator;
+          for(size_t tRow = 0; tRow < templateArray.rows(); ++tRow) {
+            for(size_t tColumn = 0; tColumn < templateArray.columns();
+                ++tColumn) {
+              correlator.addSample(image(row + tRow, column + tColumn),
+                                   templateArray(tRow, tColumn));
+            }
+          }
+          double referenceValue = correlator.getNormalizedCorrelation();
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(directResult(row, column), referenceValue,
+                               m_defaultTolerance));
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(fftResult(row, column), referenceValue,
+                               m_defaultTolerance));
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(autoResult(row, column), referenceValue,
+                               m_defaultTolerance));
+        }
+      }
+    }
+
+
+    void
+    MatchTemplate2DTest::
+    testMatchTemplate2DExactMatch()
+    {
+      // A template cut from the image, scaled and offset, should
+      // match perfectly at its original location.
+      Array2D<double> image = this->getImage(40, 36);
+      Array2D<float> templateArray(12, 10);
+      for(size_t row = 0; row < templateArray.rows(); ++row) {
+        for(size_t column = 0; column < templateArray.columns(); ++column) {
+          templateArray(row, column) =
+            static_cast<float>(3.0 * image(row + 17, column + 8) + 2.0);
+        }
+      }
+      for(int strategy = BRICK_TEMPLATE_MATCH_DIRECT;
+          strategy <= BRICK_TEMPLATE_MATCH_FFT; ++strategy) {
+        Array2D<double> result = matchTemplate2D<double>(
+          image, templateArray, TemplateMatchStrategy(strategy));
+        Index2D bestIndex(0, 0);
+        double bestValue = -2.0;
+        for(size_t row = 0; row < result.rows(); ++row) {
+          for(size_t column = 0; column < result.columns(); ++column) {
+            BRICK_TEST_ASSERT(result(row, column) <= 1.0 + 1.0E-6);
+            if(result(row, column) > bestValue) {
+              bestValue = result(row, column);
+              bestIndex.setValue(static_cast<int>(row),
+                                 static_cast<int>(column));
+            }
+          }
+        }
+        BRICK_TEST_ASSERT(bestIndex.getRow() == 17);
+        BRICK_TEST_ASSERT(bestIndex.getColumn() == 8);
+        BRICK_TEST_ASSERT(approximatelyEqual(bestValue, 1.0, 1.0E-6));
+      }
+    }
+
+
+    void
+    MatchTemplate2DTest::
+    testMatchTemplate2DFlatRegions()
+    {
+      Array2D<double> image = this->getImage(10, 12);
+      for(size_t row = 0; row < 5; ++row) {
+        for(size_t column = 0; column < 6; ++column) {
+          image(row, column) = 4.0;
+        }
+      }
+      Array2D<double> templateArray = this->getImage(3, 3);
+      Array2D<double> result = matchTemplate2D<double>(image, templateArray);
+      BRICK_TEST_ASSERT(result(0, 0) == 0.0);
+      BRICK_TEST_ASSERT(result(2, 3) == 0.0);
+      BRICK_TEST_ASSERT(result(5, 5) != 0.0);
+
+      Array2D<double> flatTemplate(3, 3);
+      flatTemplate = 2.0;
+      result = matchTemplate2D<double>(image, flatTemplate);
+      for(size_t index0 = 0; index0 < result.size(); ++index0) {
+        BRICK_TEST_ASSERT(result[index0] == 0.0);
+      }
+    }
+
+
+    void
+    MatchTemplate2DTest::
+    testMatchTemplate2DErrors()
+    {
+      Array2D<double> image = this->getImage(10, 12);
+      Array2D<double> result;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        matchTemplate2D(image, Array2D<double>(), result));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        matchTemplate2D(image, Array2D<double>(11, 3), result));
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        matchTemplate2D(image, Array2D<double>(3, 13), result));
+
+      // A template the same size as the image gives a single result.
+      matchTemplate2D(image, image, result);
+      BRICK_TEST_ASSERT(result.rows() == 1);
+      BRICK_TEST_ASSERT(result.columns() == 1);
+      BRICK_TEST_ASSERT(approximatelyEqual(result(0, 0), 1.0, 1.0E-9));
+    }
+
+
+    Array2D<double>
+    MatchTemplate2DTest::
+    getImage(size_t rows, size_t columns)
+    {
+      // Deterministic, but with enough texture that each window is
+      // distinct.
+      Array2D<double> image(rows, columns);
+      unsigned long seed = 7;
+      for(size_t index0 = 0; index0 < image.size(); ++index0) {
+        seed = (seed * 1103515245UL + 12345UL) % 2147483648UL;
+        image[index0] = 100.0 + 50.0 * (double(seed) / 2147483648.0);
+      }
+      return image;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::MatchTemplate2DTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::MatchTemplate2DTest currentTest;
+
+}
+
+#endif
@@ -36,6 +36,7 @@ namespace brick {
       void testAddSamples();
       void testGetCount();
       void testGetNormalizedCorrelation();
+      void testRemoveOldestSamples();
       void testRemoveSamples();
 
     private:
@@ -59,6 +60,7 @@ namespace brick {
       BRICK_TEST_REGISTER_MEMBER(testAddSamples);
       BRICK_TEST_REGISTER_MEMBER(testGetCount);
       BRICK_TEST_REGISTER_MEMBER(testGetNormalizedCorrelation);
+      BRICK_TEST_REGISTER_MEMBER(testRemoveOldestSamples);
       BRICK_TEST_REGISTER_MEMBER(testRemoveSamples);
     }
 
@@ -138,6 +140,58 @@ namespace brick {
     }
 
 
+    void
+    NormalizedCorrelatorTest::
+    testRemoveOldestSamples()
+    {
+      Array1D<double> inputArray0(
+        "[1, 2, 0, 4, 0, 5, -1, 0, 3, -1, -1, 11, 18, 2, 7, -4, 9, 1]");
+      Array1D<double> inputArray1(
+        "[7, 9, 2, 4, 0, 3, 6, 7, 6, 10, -2, -9, 12, 5, 1, 8, -3, 2]");
+
+      // Slide a window of six samples along the signals.  The small
+      // initial buffer forces the ring to grow while it's wrapped.
+      size_t const windowSize = 6;
+      NormalizedCorrelator<double> normalizedCorrelator(true);
+      normalizedCorrelator.enableInputTracking(true, 4);
+      normalizedCorrelator.addSamples(
+        inputArray0.begin(), inputArray0.begin() + windowSize,
+        inputArray1.begin());
+      for(size_t ii = windowSize; ii < inputArray0.size(); ++ii) {
+        normalizedCorrelator.removeOldestSamples(1);
+        normalizedCorrelator.addSample(inputArray0[ii], inputArray1[ii]);
+
+        size_t first = ii + 1 - windowSize;
+        Array1D<double> window0(windowSize);
+        Array1D<double> window1(windowSize);
+        std::copy(inputArray0.begin() + first, inputArray0.begin() + ii + 1,
+                  window0.begin());
+        std::copy(inputArray1.begin() + first, inputArray1.begin() + ii + 1,
+                  window1.begin());
+        double referenceValue = normalizedCorrelation<double>(
+          window0, window1);
+        BRICK_TEST_ASSERT(normalizedCorrelator.getCount() == windowSize);
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(normalizedCorrelator.getNormalizedCorrelation(),
+                             referenceValue, 1.0E-10));
+      }
+
+      // Copies must track input independently.
+      NormalizedCorrelator<double> copy0(normalizedCorrelator);
+      copy0.removeOldestSamples(windowSize);
+      BRICK_TEST_ASSERT(copy0.getCount() == 0);
+      BRICK_TEST_ASSERT(normalizedCorrelator.getCount() == windowSize);
+      normalizedCorrelator.removeOldestSamples(windowSize);
+      BRICK_TEST_ASSERT(normalizedCorrelator.getCount() == 0);
+
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException, normalizedCorrelator.removeOldestSamples(1));
+      normalizedCorrelator.enableInputTracking(false);
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::LogicException, normalizedCorrelator.removeOldestSamples(1));
+    }
+
+
     void
     NormalizedCorrelatorTest::
     testRemoveSamples()
@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 
+#include <cmath>
 #include <limits>
 
 #include <brick/common/functional.hh>
@@ -37,6 +38,7 @@ namespace brick {
 
       // Tests of member functions.
       void testApproximate();
+      void testEvaluateGrid();
 
     private:
 
@@ -54,6 +56,7 @@ namespace brick {
     {
       // Register all tests.
       BRICK_TEST_REGISTER_MEMBER(testApproximate);
+      BRICK_TEST_REGISTER_MEMBER(testEvaluateGrid);
     }
 
 
@@ -140,6 +143,69 @@ namespace brick {
 
     } // testApproximate()
 
+
+    void
+    ScatteredDataInterpolator2DTest::
+    testEvaluateGrid()
+    {
+      // Made up scattered data.
+      size_t const numberOfPoints = 2000;
+      Array1D<double> sCoords(numberOfPoints);
+      Array1D<double> tCoords(numberOfPoints);
+      Array1D<double> zCoords(numberOfPoints);
+      for(size_t index0 = 0; index0 < numberOfPoints; ++index0) {
+        sCoords[index0] = 6.0 * std::fmod(0.6180339887 * index0, 1.0);
+        tCoords[index0] = 5.0 * std::fmod(0.7548776662 * index0, 1.0);
+        zCoords[index0] = std::cos(sCoords[index0]) + tCoords[index0];
+      }
+      Vector2D<double> corner0(0.0, 0.0);
+      Vector2D<double> corner1(6.0, 5.0);
+
+      ScatteredDataInterpolator2D<double> serialInterpolator(5);
+      serialInterpolator.approximate(
+        sCoords.begin(), sCoords.end(), tCoords.begin(), zCoords.begin(),
+        corner0, corner1);
+
+      // Threaded fitting should give the same function, up to
+      // roundoff.
+      ScatteredDataInterpolator2D<double> threadedInterpolator(5);
+      threadedInterpolator.setNumberOfThreads(0);
+      threadedInterpolator.approximate(
+        sCoords.begin(), sCoords.end(), tCoords.begin(), zCoords.begin(),
+        corner0, corner1);
+
+      Array1D<double> sValues(40);
+      for(size_t index0 = 0; index0 < sValues.size(); ++index0) {
+        sValues[index0] = 0.15 * index0;
+      }
+      Array1D<double> tValues(25);
+      for(size_t index0 = 0; index0 < tValues.size(); ++index0) {
+        tValues[index0] = 0.2 * index0;
+      }
+      Array2D<double> gridValues;
+      threadedInterpolator.evaluateGrid(sValues, tValues, gridValues);
+      for(size_t row = 0; row < tValues.size(); ++row) {
+        for(size_t column = 0; column < sValues.size(); ++column) {
+          double referenceValue =
+            serialInterpolator(sValues[column], tValues[row]);
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(gridValues(row, column), referenceValue,
+                               this->m_defaultTolerance));
+        }
+      }
+
+      Array1D<double> manyValues(numberOfPoints);
+      threadedInterpolator.evaluateMany(
+        sCoords.begin(), sCoords.end(), tCoords.begin(), manyValues.begin());
+      for(size_t index0 = 0; index0 < numberOfPoints; ++index0) {
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(
+            manyValues[index0],
+            serialInterpolator(sCoords[index0], tCoords[index0]),
+            this->m_defaultTolerance));
+      }
+    }
+
   } // namespace numeric
 
 } // namespace brick
@@ -11,6 +11,8 @@
 **/
 
 #include <stdlib.h>
+#include <memory>
+#include <vector>
 #include <brick/common/functional.hh>
 #include <brick/numeric/solveCubic.hh>
 #include <brick/test/testFixture.hh>
@@ -33,6 +35,7 @@ namespace brick {
 
       void testSolveCubic__Type_Type_Type_Type_Type_Type();
       void testSolveCubic__Type_Type_Type_complex_complex_complex();
+      void testSolveCubicBatch();
 
     private:
 
@@ -53,6 +56,7 @@ namespace brick {
         testSolveCubic__Type_Type_Type_Type_Type_Type);
       BRICK_TEST_REGISTER_MEMBER(
         testSolveCubic__Type_Type_Type_complex_complex_complex);
+      BRICK_TEST_REGISTER_MEMBER(testSolveCubicBatch);
     }
 
 
@@ -212,6 +216,56 @@ namespace brick {
       }
     }
 
+
+    void
+    SolveCubicTest::
+    testSolveCubicBatch()
+    {
+      // Build a batch of equations covering both the one-root and
+      // three-root cases, including some with repeated roots.
+      std::vector<double> c0Vector;
+      std::vector<double> c1Vector;
+      std::vector<double> c2Vector;
+      for(double c0 = -3.0; c0 < 3.25; c0 += 0.5) {
+        for(double c1 = -3.0; c1 < 3.25; c1 += 0.5) {
+          for(double c2 = -3.0; c2 < 3.25; c2 += 0.5) {
+            c0Vector.push_back(c0);
+            c1Vector.push_back(c1);
+            c2Vector.push_back(c2);
+          }
+        }
+      }
+      std::size_t const count = c0Vector.size();
+      std::vector<double> root0Vector(count);
+      std::vector<double> root1Vector(count);
+      std::vector<double> root2Vector(count);
+      std::unique_ptr<bool[]> flags(new bool[count]);
+      solveCubicBatch(count, &(c0Vector[0]), &(c1Vector[0]), &(c2Vector[0]),
+                      &(root0Vector[0]), &(root1Vector[0]), &(root2Vector[0]),
+                      flags.get());
+
+      // Results should match the scalar version.
+      for(std::size_t ii = 0; ii < count; ++ii) {
+        double root0 = 0.0;
+        double root1 = 0.0;
+        double root2 = 0.0;
+        bool valid = solveCubic(c0Vector[ii], c1Vector[ii], c2Vector[ii],
+                                root0, root1, root2);
+        BRICK_TEST_ASSERT(flags[ii] == valid);
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(root0Vector[ii], root0, 1.0E-9));
+        if(valid) {
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(root1Vector[ii], root1, 1.0E-9));
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(root2Vector[ii], root2, 1.0E-9));
+        } else {
+          BRICK_TEST_ASSERT(root1Vector[ii] == root0Vector[ii]);
+          BRICK_TEST_ASSERT(root2Vector[ii] == root0Vector[ii]);
+        }
+      }
+    }
+
   } // namespace numeric
 
 } // namespace brick
@@ -0,0 +1,374 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/solvePolynomialTest.cc
+*
+* Source file defining tests for solvePolynomial().
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <brick/common/functional.hh>
+#include <brick/numeric/solvePolynomial.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace numeric {
+
+    class SolvePolynomialTest
+      : public brick::test::TestFixture<SolvePolynomialTest> {
+
+    public:
+
+      SolvePolynomialTest();
+      ~SolvePolynomialTest() {};
+
+      void setUp(const std::string& /* testName */) {m_seed = 1u;}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testSolvePolynomial();
+      void testSolvePolynomialComplexRoots();
+      void testSolvePolynomialMixedRoots();
+      void testSolvePolynomialMixedRootsRandom();
+      void testSolvePolynomialRepeatedRoots();
+      void testSolvePolynomialDegenerate();
+
+    private:
+
+      // Build the polynomial with the specified real roots and
+      // numberOfComplexPairs pairs of complex roots, times scale.
+      template <std::size_t Order>
+      StaticPolynomial<double, Order>
+      buildPolynomial(double const* realRoots, std::size_t numberOfRealRoots,
+                      std::size_t numberOfComplexPairs, double scale);
+
+      // Build the polynomial with the specified real roots and
+      // complex roots (complexCenters[ii] +/- complexOffsets[ii] * i),
+      // times scale.
+      template <std::size_t Order>
+      StaticPolynomial<double, Order>
+      buildPolynomial(double const* realRoots, std::size_t numberOfRealRoots,
+                      double const* complexCenters,
+                      double const* complexOffsets,
+                      std::size_t numberOfComplexPairs, double scale);
+
+      double
+      getRandom();
+
+      double m_defaultTolerance;
+      unsigned int m_seed;
+
+    }; // class SolvePolynomialTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    SolvePolynomialTest::
+    SolvePolynomialTest()
+      : brick::test::TestFixture<SolvePolynomialTest>("SolvePolynomialTest"),
+        m_defaultTolerance(1.0E-9),
+        m_seed(1u)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testSolvePolynomial);
+      BRICK_TEST_REGISTER_MEMBER(testSolvePolynomialComplexRoots);
+      BRICK_TEST_REGISTER_MEMBER(testSolvePolynomialMixedRoots);
+      BRICK_TEST_REGISTER_MEMBER(testSolvePolynomialMixedRootsRandom);
+      BRICK_TEST_REGISTER_MEMBER(testSolvePolynomialRepeatedRoots);
+      BRICK_TEST_REGISTER_MEMBER(testSolvePolynomialDegenerate);
+    }
+
+
+    void
+    SolvePolynomialTest::
+    testSolvePolynomial()
+    {
+      // Degree 10, as in the five-point algorithm.  Scale by a
+      // negative number to make sure the sign of the leading
+      // coefficient doesn't matter.
+      double realRoots[] = {-4.5, -3.0, -1.0, -0.1, 0.25,
+                            0.5, 1.0, 2.0, 3.5, 6.0};
+      StaticPolynomial<double, 10> polynomial =
+        this->buildPolynomial<10>(realRoots, 10, 0, -0.3);
+      StaticArray1D<double, 10> roots;
+      std::size_t numberOfRoots = solvePolynomial(polynomial, roots);
+      BRICK_TEST_ASSERT(numberOfRoots == 10);
+      for(std::size_t ii = 0; ii < numberOfRoots; ++ii) {
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(roots[ii], realRoots[ii], m_defaultTolerance));
+      }
+
+      // Closely spaced roots.
+      double closeRoots[] = {1.0, 1.001, 1.002};
+      StaticPolynomial<double, 3> cubic =
+        this->buildPolynomial<3>(closeRoots, 3, 0, 1.0);
+      StaticArray1D<double, 3> cubicRoots;
+      BRICK_TEST_ASSERT(solvePolynomial(cubic, cubicRoots) == 3);
+      for(std::size_t ii = 0; ii < 3; ++ii) {
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(cubicRoots[ii], closeRoots[ii], 1.0E-7));
+      }
+    }
+
+
+    void
+    SolvePolynomialTest::
+    testSolvePolynomialComplexRoots()
+    {
+      // Four real roots and three complex pairs.
+      double realRoots[] = {-2.0, 0.0, 1.5, 8.0};
+      StaticPolynomial<double, 10> polynomial =
+        this->buildPolynomial<10>(realRoots, 4, 3, 2.0);
+      StaticArray1D<double, 10> roots;
+      std::size_t numberOfRoots = solvePolynomial(polynomial, roots);
+      BRICK_TEST_ASSERT(numberOfRoots == 4);
+      for(std::size_t ii = 0; ii < numberOfRoots; ++ii) {
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(roots[ii], realRoots[ii], m_defaultTolerance));
+      }
+
+      // No real roots at all.
+      polynomial = this->buildPolynomial<10>(realRoots, 0, 5, 1.0);
+      BRICK_TEST_ASSERT(solvePolynomial(polynomial, roots) == 0);
+    }
+
+
+    void
+    SolvePolynomialTest::
+    testSolvePolynomialMixedRoots()
+    {
+      // (x^2 + 1)(x - 1)(x - 2).  The Sturm sequence for this one
+      // includes a remainder with a negative leading coefficient.
+      double realRoots[] = {1.0, 2.0};
+      StaticPolynomial<double, 4> polynomial =
+        this->buildPolynomial<4>(realRoots, 2, 1, 1.0);
+      StaticArray1D<double, 4> roots;
+      std::size_t numberOfRoots = solvePolynomial(polynomial, roots);
+      BRICK_TEST_ASSERT(numberOfRoots == 2);
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(roots[0], 1.0, m_defaultTolerance));
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(roots[1], 2.0, m_defaultTolerance));
+
+      // Same thing, with the complex pair off the imaginary axis, and
+      // a negative scale.
+      double complexCenters[] = {-0.7};
+      double complexOffsets[] = {0.4};
+      StaticPolynomial<double, 6> sextic = this->buildPolynomial<6>(
+        realRoots, 2, complexCenters, complexOffsets, 1, -3.0);
+      StaticArray1D<double, 6> sexticRoots;
+      BRICK_TEST_ASSERT(solvePolynomial(sextic, sexticRoots) == 2);
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(sexticRoots[0], 1.0, m_defaultTolerance));
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(sexticRoots[1], 2.0, m_defaultTolerance));
+    }
+
+
+    void
+    SolvePolynomialTest::
+    testSolvePolynomialMixedRootsRandom()
+    {
+      // Degree 6 and degree 10 polynomials with a random mix of real
+      // roots and complex pairs.  The real roots are spread out so
+      // that the tolerance can be reasonably tight.
+      for(std::size_t trial = 0; trial < 200; ++trial) {
+        std::size_t const numberOfComplexPairs = 1 + trial % 3;
+        std::size_t const order = (trial % 2 == 0) ? 6 : 10;
+        std::size_t const numberOfRealRoots =
+          order - 2 * numberOfComplexPairs;
+        double realRoots[10];
+        double const spacing = 10.0 / static_cast<double>(numberOfRealRoots);
+        for(std::size_t ii = 0; ii < numberOfRealRoots; ++ii) {
+          realRoots[ii] = (-5.0 + spacing * static_cast<double>(ii)
+                           + 0.25 * spacing * (this->getRandom() + 1.0));
+        }
+        double complexCenters[3];
+        double complexOffsets[3];
+        for(std::size_t ii = 0; ii < numberOfComplexPairs; ++ii) {
+          complexCenters[ii] = 5.0 * this->getRandom();
+          complexOffsets[ii] = 1.0 + 0.7 * this->getRandom();
+        }
+        double const scale = (((trial % 4 < 2) ? -1.0 : 1.0)
+                              * (1.0 + 0.5 * this->getRandom()));
+
+        std::size_t numberOfRoots;
+        double roots[10];
+        if(order == 6) {
+          StaticArray1D<double, 6> staticRoots;
+          numberOfRoots = solvePolynomial(
+            this->buildPolynomial<6>(
+              realRoots, numberOfRealRoots, complexCenters, complexOffsets,
+              numberOfComplexPairs, scale),
+            staticRoots);
+          std::copy(staticRoots.begin(), staticRoots.end(), roots);
+        } else {
+          StaticArray1D<double, 10> staticRoots;
+          numberOfRoots = solvePolynomial(
+            this->buildPolynomial<10>(
+              realRoots, numberOfRealRoots, complexCenters, complexOffsets,
+              numberOfComplexPairs, scale),
+            staticRoots);
+          std::copy(staticRoots.begin(), staticRoots.end(), roots);
+        }
+        BRICK_TEST_ASSERT(numberOfRoots == numberOfRealRoots);
+        for(std::size_t ii = 0; ii < numberOfRoots; ++ii) {
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(roots[ii], realRoots[ii], 1.0E-7));
+        }
+      }
+    }
+
+
+    void
+    SolvePolynomialTest::
+    testSolvePolynomialRepeatedRoots()
+    {
+      // (x - 1)^2 * (x + 2)^3 * (x - 3): distinct roots are -2, 1, 3.
+      double realRoots[] = {-2.0, -2.0, -2.0, 1.0, 1.0, 3.0};
+      StaticPolynomial<double, 6> polynomial =
+        this->buildPolynomial<6>(realRoots, 6, 0, 1.0);
+      StaticArray1D<double, 6> roots;
+      std::size_t numberOfRoots = solvePolynomial(polynomial, roots);
+      BRICK_TEST_ASSERT(numberOfRoots == 3);
+
+      // A root of multiplicity m is only determined to about
+      // epsilon^(1/m), so the triple root gets a looser tolerance.
+      BRICK_TEST_ASSERT(approximatelyEqual(roots[0], -2.0, 1.0E-4));
+      BRICK_TEST_ASSERT(approximatelyEqual(roots[1], 1.0, 1.0E-6));
+      BRICK_TEST_ASSERT(approximatelyEqual(roots[2], 3.0, 1.0E-6));
+    }
+
+
+    void
+    SolvePolynomialTest::
+    testSolvePolynomialDegenerate()
+    {
+      // Leading coefficients of zero reduce the order.
+      double realRoots[] = {-1.0, 4.0};
+      StaticPolynomial<double, 2> quadratic =
+        this->buildPolynomial<2>(realRoots, 2, 0, 1.0);
+      StaticPolynomial<double, 5> polynomial(quadratic);
+      StaticArray1D<double, 5> roots;
+      BRICK_TEST_ASSERT(solvePolynomial(polynomial, roots) == 2);
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(roots[0], -1.0, m_defaultTolerance));
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(roots[1], 4.0, m_defaultTolerance));
+
+      // Linear.
+      double linearCoefficients[] = {3.0, -2.0};
+      StaticPolynomial<double, 1> linear(linearCoefficients);
+      StaticArray1D<double, 1> linearRoots;
+      BRICK_TEST_ASSERT(solvePolynomial(linear, linearRoots) == 1);
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(linearRoots[0], 1.5, m_defaultTolerance));
+
+      // Constants have no roots, even zero.
+      StaticPolynomial<double, 5> constant;
+      BRICK_TEST_ASSERT(solvePolynomial(constant, roots) == 0);
+      constant.setCoefficient(0, 2.0);
+      BRICK_TEST_ASSERT(solvePolynomial(constant, roots) == 0);
+    }
+
+
+    template <std::size_t Order>
+    StaticPolynomial<double, Order>
+    SolvePolynomialTest::
+    buildPolynomial(double const* realRoots, std::size_t numberOfRealRoots,
+                    std::size_t numberOfComplexPairs, double scale)
+    {
+      // Roots at (0.5 * ii) +/- i.
+      double complexCenters[Order / 2 + 1];
+      double complexOffsets[Order / 2 + 1];
+      for(std::size_t ii = 0; ii < numberOfComplexPairs; ++ii) {
+        complexCenters[ii] = 0.5 * static_cast<double>(ii);
+        complexOffsets[ii] = 1.0;
+      }
+      return this->buildPolynomial<Order>(
+        realRoots, numberOfRealRoots, complexCenters, complexOffsets,
+        numberOfComplexPairs, scale);
+    }
+
+
+    template <std::size_t Order>
+    StaticPolynomial<double, Order>
+    SolvePolynomialTest::
+    buildPolynomial(double const* realRoots, std::size_t numberOfRealRoots,
+                    double const* complexCenters,
+                    double const* complexOffsets,
+                    std::size_t numberOfComplexPairs, double scale)
+    {
+      // Multiply out the factors one at a time.  Each factor is of
+      // the form (x - root), so multiplying shifts the coefficients
+      // up by one and subtracts root times the old coefficients.
+      double coefficients[Order + 1] = {};
+      coefficients[0] = scale;
+      std::size_t order = 0;
+      for(std::size_t ii = 0; ii < numberOfRealRoots; ++ii) {
+        ++order;
+        for(std::size_t jj = order; jj > 0; --jj) {
+          coefficients[jj] = (coefficients[jj - 1]
+                              - realRoots[ii] * coefficients[jj]);
+        }
+        coefficients[0] *= -realRoots[ii];
+      }
+      for(std::size_t ii = 0; ii < numberOfComplexPairs; ++ii) {
+        // Roots at center +/- offset * i, so the factor is
+        // x^2 - 2 * center * x + (center^2 + offset^2).
+        double center = complexCenters[ii];
+        double linear = -2.0 * center;
+        double constant = (center * center
+                           + complexOffsets[ii] * complexOffsets[ii]);
+        order += 2;
+        for(std::size_t jj = order; jj > 1; --jj) {
+          coefficients[jj] = (coefficients[jj - 2]
+                              + linear * coefficients[jj - 1]
+                              + constant * coefficients[jj]);
+        }
+        coefficients[1] = (linear * coefficients[0]
+                           + constant * coefficients[1]);
+        coefficients[0] *= constant;
+      }
+      StaticPolynomial<double, Order> result(coefficients);
+      return result;
+    }
+
+
+    double
+    SolvePolynomialTest::
+    getRandom()
+    {
+      m_seed = m_seed * 1103515245u + 12345u;
+      return static_cast<double>((m_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::SolvePolynomialTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::SolvePolynomialTest currentTest;
+
+}
+
+#endif
@@ -11,6 +11,8 @@
 **/
 
 #include <stdlib.h>
+#include <algorithm>
+#include <vector>
 #include <brick/common/functional.hh>
 #include <brick/numeric/solveQuartic.hh>
 #include <brick/test/testFixture.hh>
@@ -32,6 +34,7 @@ namespace brick {
       void tearDown(const std::string&) {}
 
       void testSolveQuartic();
+      void testSolveQuarticBatch();
 
     private:
 
@@ -49,6 +52,7 @@ namespace brick {
     {
       // Register all tests.
       BRICK_TEST_REGISTER_MEMBER(testSolveQuartic);
+      BRICK_TEST_REGISTER_MEMBER(testSolveQuarticBatch);
     }
 
 
@@ -198,6 +202,73 @@ namespace brick {
       }
     }
 
+
+    void
+    SolveQuarticTest::
+    testSolveQuarticBatch()
+    {
+      // Same grid of equations as testSolveQuartic(), which includes
+      // plenty of biquadratics (c0 == c2 == 0) to exercise the
+      // fallback path, plus the two hand-worked examples.
+      std::vector<double> c0Vector(1, -29.0 / 3.0);
+      std::vector<double> c1Vector(1, 43.0 / 3.0);
+      std::vector<double> c2Vector(1, 121.0 / 3.0);
+      std::vector<double> c3Vector(1, -70.0);
+      c0Vector.push_back(0.0);
+      c1Vector.push_back(-5.0);
+      c2Vector.push_back(0.0);
+      c3Vector.push_back(-36.0);
+      for(double c0 = -3.0; c0 < 3.5; c0 += 1.0) {
+        for(double c1 = -3.0; c1 < 3.5; c1 += 1.0) {
+          for(double c2 = -3.0; c2 < 3.5; c2 += 1.0) {
+            for(double c3 = -3.0; c3 < 3.5; c3 += 1.0) {
+              c0Vector.push_back(c0);
+              c1Vector.push_back(c1);
+              c2Vector.push_back(c2);
+              c3Vector.push_back(c3);
+            }
+          }
+        }
+      }
+      std::size_t const count = c0Vector.size();
+      std::vector<double> realParts(4 * count);
+      std::vector<double> imaginaryParts(4 * count);
+      solveQuarticBatch(count, &(c0Vector[0]), &(c1Vector[0]),
+                        &(c2Vector[0]), &(c3Vector[0]),
+                        &(realParts[0]), &(imaginaryParts[0]));
+
+      // Every root should satisfy its equation.
+      for(std::size_t ii = 0; ii < count; ++ii) {
+        for(std::size_t kk = 0; kk < 4; ++kk) {
+          brick::common::ComplexNumber<double> root(
+            realParts[kk * count + ii], imaginaryParts[kk * count + ii]);
+          brick::common::ComplexNumber<double> result =
+            (root * root * root * root + c0Vector[ii] * root * root * root
+             + c1Vector[ii] * root * root + c2Vector[ii] * root
+             + c3Vector[ii]);
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(result.getRealPart(), 0.0, 1.0E-9));
+          BRICK_TEST_ASSERT(
+            approximatelyEqual(result.getImaginaryPart(), 0.0, 1.0E-9));
+        }
+      }
+
+      // And the four roots should be distinct solutions, not the
+      // same root reported several times.  Check this using the
+      // first example, (2x + 4)(-x + 7)(3x - 5)(x - 3) = 0.
+      std::vector<double> roots;
+      for(std::size_t kk = 0; kk < 4; ++kk) {
+        BRICK_TEST_ASSERT(imaginaryParts[kk * count] == 0.0);
+        roots.push_back(realParts[kk * count]);
+      }
+      std::sort(roots.begin(), roots.end());
+      BRICK_TEST_ASSERT(approximatelyEqual(roots[0], -2.0, m_defaultTolerance));
+      BRICK_TEST_ASSERT(
+        approximatelyEqual(roots[1], 5.0 / 3.0, m_defaultTolerance));
+      BRICK_TEST_ASSERT(approximatelyEqual(roots[2], 3.0, m_defaultTolerance));
+      BRICK_TEST_ASSERT(approximatelyEqual(roots[3], 7.0, m_defaultTolerance));
+    }
+
   } // namespace numeric
 
 } // namespace brick
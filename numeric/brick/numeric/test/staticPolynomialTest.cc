@@ -0,0 +1,207 @@
+/**
+***************************************************************************
+* @file brick/numeric/test/staticPolynomialTest.cc
+*
+* Source file defining tests for StaticPolynomial.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <brick/common/functional.hh>
+#include <brick/numeric/polynomial.hh>
+#include <brick/numeric/staticPolynomial.hh>
+#include <brick/test/testFixture.hh>
+
+
+namespace brick {
+
+  namespace numeric {
+
+    class StaticPolynomialTest
+      : public brick::test::TestFixture<StaticPolynomialTest> {
+
+    public:
+
+      StaticPolynomialTest();
+      ~StaticPolynomialTest() {};
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testConstructors();
+      void testEvaluate();
+      void testGetDerivative();
+      void testArithmetic();
+
+    private:
+
+      double m_defaultTolerance;
+
+    }; // class StaticPolynomialTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    StaticPolynomialTest::
+    StaticPolynomialTest()
+      : brick::test::TestFixture<StaticPolynomialTest>("StaticPolynomialTest"),
+        m_defaultTolerance(1.0E-11)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testConstructors);
+      BRICK_TEST_REGISTER_MEMBER(testEvaluate);
+      BRICK_TEST_REGISTER_MEMBER(testGetDerivative);
+      BRICK_TEST_REGISTER_MEMBER(testArithmetic);
+    }
+
+
+    void
+    StaticPolynomialTest::
+    testConstructors()
+    {
+      StaticPolynomial<double, 3> zeroPolynomial;
+      BRICK_TEST_ASSERT(zeroPolynomial.getOrder() == 3);
+      for(std::size_t ii = 0; ii <= 3; ++ii) {
+        BRICK_TEST_ASSERT(zeroPolynomial.getCoefficient(ii) == 0.0);
+      }
+
+      double coefficients[] = {1.0, -2.0, 3.0, -4.0};
+      StaticPolynomial<double, 3> polynomial0(coefficients);
+      StaticPolynomial<double, 3> polynomial1(
+        StaticArray1D<double, 4>("[1.0, -2.0, 3.0, -4.0]"));
+      for(std::size_t ii = 0; ii <= 3; ++ii) {
+        BRICK_TEST_ASSERT(polynomial0.getCoefficient(ii) == coefficients[ii]);
+        BRICK_TEST_ASSERT(polynomial1.getCoefficient(ii) == coefficients[ii]);
+        BRICK_TEST_ASSERT(
+          polynomial0.getCoefficientArray()[ii] == coefficients[ii]);
+      }
+
+      StaticPolynomial<double, 5> promoted(polynomial0);
+      for(std::size_t ii = 0; ii <= 3; ++ii) {
+        BRICK_TEST_ASSERT(promoted.getCoefficient(ii) == coefficients[ii]);
+      }
+      BRICK_TEST_ASSERT(promoted.getCoefficient(4) == 0.0);
+      BRICK_TEST_ASSERT(promoted.getCoefficient(5) == 0.0);
+
+      promoted.setCoefficient(5, 7.0);
+      BRICK_TEST_ASSERT(promoted.getCoefficient(5) == 7.0);
+    }
+
+
+    void
+    StaticPolynomialTest::
+    testEvaluate()
+    {
+      double coefficients[] = {1.0, -2.0, 3.0, -4.0, 0.5};
+      StaticPolynomial<double, 4> polynomial(coefficients);
+      Polynomial<double> reference(
+        Array1D<double>("[1.0, -2.0, 3.0, -4.0, 0.5]"));
+      for(double xValue = -3.0; xValue < 3.0; xValue += 0.37) {
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(polynomial(xValue), reference(xValue),
+                             m_defaultTolerance));
+
+        double derivative;
+        double value = polynomial.evaluate(xValue, derivative);
+        double referenceDerivative = (-2.0 + 6.0 * xValue
+                                      - 12.0 * xValue * xValue
+                                      + 2.0 * xValue * xValue * xValue);
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(value, reference(xValue), m_defaultTolerance));
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(derivative, referenceDerivative,
+                             m_defaultTolerance));
+      }
+    }
+
+
+    void
+    StaticPolynomialTest::
+    testGetDerivative()
+    {
+      double coefficients[] = {1.0, -2.0, 3.0, -4.0, 0.5};
+      StaticPolynomial<double, 4> polynomial(coefficients);
+      StaticPolynomial<double, 3> derivative = polynomial.getDerivative();
+      BRICK_TEST_ASSERT(derivative.getCoefficient(0) == -2.0);
+      BRICK_TEST_ASSERT(derivative.getCoefficient(1) == 6.0);
+      BRICK_TEST_ASSERT(derivative.getCoefficient(2) == -12.0);
+      BRICK_TEST_ASSERT(derivative.getCoefficient(3) == 2.0);
+
+      // Derivative of a constant is zero.
+      StaticPolynomial<double, 0> constant(coefficients);
+      StaticPolynomial<double, 0> zero = constant.getDerivative();
+      BRICK_TEST_ASSERT(zero.getCoefficient(0) == 0.0);
+    }
+
+
+    void
+    StaticPolynomialTest::
+    testArithmetic()
+    {
+      double coefficients0[] = {1.0, -2.0, 3.0};
+      double coefficients1[] = {-0.5, 4.0, 0.25, 2.0};
+      StaticPolynomial<double, 2> polynomial0(coefficients0);
+      StaticPolynomial<double, 3> polynomial1(coefficients1);
+      Polynomial<double> reference0(Array1D<double>("[1.0, -2.0, 3.0]"));
+      Polynomial<double> reference1(
+        Array1D<double>("[-0.5, 4.0, 0.25, 2.0]"));
+
+      StaticPolynomial<double, 5> product = polynomial0 * polynomial1;
+      StaticPolynomial<double, 3> promoted0(polynomial0);
+      StaticPolynomial<double, 3> sum = promoted0 + polynomial1;
+      StaticPolynomial<double, 3> difference = promoted0 - polynomial1;
+      StaticPolynomial<double, 3> scaled = polynomial1 * 3.0;
+
+      StaticPolynomial<double, 3> accumulator(promoted0);
+      accumulator += polynomial1;
+      accumulator -= promoted0;
+      accumulator *= 2.0;
+
+      for(double xValue = -3.0; xValue < 3.0; xValue += 0.37) {
+        double value0 = reference0(xValue);
+        double value1 = reference1(xValue);
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(product(xValue), value0 * value1,
+                             m_defaultTolerance));
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(sum(xValue), value0 + value1,
+                             m_defaultTolerance));
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(difference(xValue), value0 - value1,
+                             m_defaultTolerance));
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(scaled(xValue), 3.0 * value1,
+                             m_defaultTolerance));
+        BRICK_TEST_ASSERT(
+          approximatelyEqual(accumulator(xValue), 2.0 * value1,
+                             m_defaultTolerance));
+      }
+    }
+
+  } // namespace numeric
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::numeric::StaticPolynomialTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::numeric::StaticPolynomialTest currentTest;
+
+}
+
+#endif
@@ -11,6 +11,7 @@
 **/
 
 #include <brick/numeric/transform3D.hh>
+#include <brick/numeric/transform3DTo2D.hh>
 #include <brick/test/testFixture.hh>
 
 namespace brick {
@@ -29,9 +30,19 @@ namespace brick {
 
       // Tests of member functions.
       void testInvert();
+      void testTransformPointColumns();
+      void testTransformPointRows();
+      void testTransformPoints();
+      void testTransform3DTo2DTransformPoints();
 
     private:
 
+      Array1D< Vector3D<double> >
+      getPoints(size_t count);
+
+      Transform3D<double> m_affineTransform;
+      Transform3D<double> m_projectiveTransform;
+
     }; // class Transform3DTest
 
 
@@ -39,10 +50,22 @@ namespace brick {
 
     Transform3DTest::
     Transform3DTest()
-      : brick::test::TestFixture<Transform3DTest>("Transform3DTest")
+      : brick::test::TestFixture<Transform3DTest>("Transform3DTest"),
+        m_affineTransform(0.36, 0.48, -0.8, 4.0,
+                          -0.8, 0.6, 0.0, -2.0,
+                          0.48, 0.64, 0.6, 7.5,
+                          0.0, 0.0, 0.0, 1.0),
+        m_projectiveTransform(1.0, 2.0, 3.0, 4.0,
+                              0.0, 3.2, -1.4, 11.0,
+                              -5.0, 0.0, 4.0, 6.0,
+                              0.02, -0.01, 0.02, 1.5)
     {
       // Register all tests.
       BRICK_TEST_REGISTER_MEMBER(testInvert);
+      BRICK_TEST_REGISTER_MEMBER(testTransformPointColumns);
+      BRICK_TEST_REGISTER_MEMBER(testTransformPointRows);
+      BRICK_TEST_REGISTER_MEMBER(testTransformPoints);
+      BRICK_TEST_REGISTER_MEMBER(testTransform3DTo2DTransformPoints);
     }
 
 
@@ -72,6 +95,184 @@ namespace brick {
       }
     }
 
+
+
+    void
+    Transform3DTest::
+    testTransformPointColumns()
+    {
+      double testEpsilon = 1.0e-12;
+      Array1D< Vector3D<double> > points = this->getPoints(40000);
+      Array2D<double> inputPoints(3, points.size());
+      for(size_t ii = 0; ii < points.size(); ++ii) {
+        inputPoints(0, ii) = points[ii].x();
+        inputPoints(1, ii) = points[ii].y();
+        inputPoints(2, ii) = points[ii].z();
+      }
+      Transform3D<double> const* transforms[] = {
+        &m_affineTransform, &m_projectiveTransform};
+      for(size_t jj = 0; jj < 2; ++jj) {
+        Array2D<double> outputPoints;
+        transforms[jj]->transformPointColumns(inputPoints, outputPoints, 3);
+        BRICK_TEST_ASSERT(outputPoints.rows() == 3);
+        BRICK_TEST_ASSERT(outputPoints.columns() == points.size());
+
+        // In-place operation should give the same answer.
+        Array2D<double> inPlacePoints = inputPoints.copy();
+        transforms[jj]->transformPointColumns(inPlacePoints, inPlacePoints);
+        for(size_t ii = 0; ii < points.size(); ++ii) {
+          Vector3D<double> reference = (*transforms[jj]) * points[ii];
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints(0, ii), reference.x(), testEpsilon));
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints(1, ii), reference.y(), testEpsilon));
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints(2, ii), reference.z(), testEpsilon));
+          BRICK_TEST_ASSERT(inPlacePoints(0, ii) == outputPoints(0, ii));
+          BRICK_TEST_ASSERT(inPlacePoints(1, ii) == outputPoints(1, ii));
+          BRICK_TEST_ASSERT(inPlacePoints(2, ii) == outputPoints(2, ii));
+        }
+      }
+
+      Array2D<double> badPoints(4, 10);
+      Array2D<double> outputPoints;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        m_affineTransform.transformPointColumns(badPoints, outputPoints));
+    }
+
+
+    void
+    Transform3DTest::
+    testTransformPointRows()
+    {
+      double testEpsilon = 1.0e-12;
+      Array1D< Vector3D<double> > points = this->getPoints(1000);
+      Array2D<double> inputPoints(points.size(), 3);
+      for(size_t ii = 0; ii < points.size(); ++ii) {
+        inputPoints(ii, 0) = points[ii].x();
+        inputPoints(ii, 1) = points[ii].y();
+        inputPoints(ii, 2) = points[ii].z();
+      }
+      Transform3D<double> const* transforms[] = {
+        &m_affineTransform, &m_projectiveTransform};
+      for(size_t jj = 0; jj < 2; ++jj) {
+        Array2D<double> outputPoints;
+        transforms[jj]->transformPointRows(inputPoints, outputPoints);
+        BRICK_TEST_ASSERT(outputPoints.rows() == points.size());
+        BRICK_TEST_ASSERT(outputPoints.columns() == 3);
+        for(size_t ii = 0; ii < points.size(); ++ii) {
+          Vector3D<double> reference = (*transforms[jj]) * points[ii];
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints(ii, 0), reference.x(), testEpsilon));
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints(ii, 1), reference.y(), testEpsilon));
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints(ii, 2), reference.z(), testEpsilon));
+        }
+      }
+
+      Array2D<double> badPoints(10, 4);
+      Array2D<double> outputPoints;
+      BRICK_TEST_ASSERT_EXCEPTION(
+        common::ValueException,
+        m_affineTransform.transformPointRows(badPoints, outputPoints));
+    }
+
+
+    void
+    Transform3DTest::
+    testTransformPoints()
+    {
+      double testEpsilon = 1.0e-12;
+      BRICK_TEST_ASSERT(m_affineTransform.isAffine());
+      BRICK_TEST_ASSERT(!m_projectiveTransform.isAffine());
+
+      Array1D< Vector3D<double> > points = this->getPoints(40000);
+      Transform3D<double> const* transforms[] = {
+        &m_affineTransform, &m_projectiveTransform};
+      for(size_t jj = 0; jj < 2; ++jj) {
+        Array1D< Vector3D<double> > outputPoints(points.size());
+        transforms[jj]->transformPoints(
+          points.data(), points.data() + points.size(), outputPoints.data(), 0);
+        Array1D< Vector3D<double> > inPlacePoints = points.copy();
+        transforms[jj]->transformPoints(
+          inPlacePoints.data(), inPlacePoints.data() + inPlacePoints.size(),
+          inPlacePoints.data());
+        for(size_t ii = 0; ii < points.size(); ++ii) {
+          Vector3D<double> reference = (*transforms[jj]) * points[ii];
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints[ii].x(), reference.x(), testEpsilon));
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints[ii].y(), reference.y(), testEpsilon));
+          BRICK_TEST_ASSERT(approximatelyEqual(
+                              outputPoints[ii].z(), reference.z(), testEpsilon));
+          BRICK_TEST_ASSERT(inPlacePoints[ii] == outputPoints[ii]);
+        }
+      }
+    }
+
+
+    void
+    Transform3DTest::
+    testTransform3DTo2DTransformPoints()
+    {
+      double testEpsilon = 1.0e-12;
+      Transform3DTo2D<double> projection(500.0, 0.0, 320.0, 0.0,
+                                         0.0, 500.0, 240.0, 0.0,
+                                         0.0, 0.0, 1.0, 0.0);
+      projection = projection * m_affineTransform;
+      Array1D< Vector3D<double> > points = this->getPoints(20000);
+      Array2D<double> columnPoints(3, points.size());
+      Array2D<double> rowPoints(points.size(), 3);
+      for(size_t ii = 0; ii < points.size(); ++ii) {
+        columnPoints(0, ii) = rowPoints(ii, 0) = points[ii].x();
+        columnPoints(1, ii) = rowPoints(ii, 1) = points[ii].y();
+        columnPoints(2, ii) = rowPoints(ii, 2) = points[ii].z();
+      }
+
+      Array1D< Vector2D<double> > outputPoints(points.size());
+      Array2D<double> outputColumns;
+      Array2D<double> outputRows;
+      projection.transformPoints(
+        points.data(), points.data() + points.size(), outputPoints.data(), 2);
+      projection.transformPointColumns(columnPoints, outputColumns, 2);
+      projection.transformPointRows(rowPoints, outputRows);
+      BRICK_TEST_ASSERT(outputColumns.rows() == 2);
+      BRICK_TEST_ASSERT(outputColumns.columns() == points.size());
+      BRICK_TEST_ASSERT(outputRows.rows() == points.size());
+      BRICK_TEST_ASSERT(outputRows.columns() == 2);
+      for(size_t ii = 0; ii < points.size(); ++ii) {
+        Vector2D<double> reference = projection * points[ii];
+        BRICK_TEST_ASSERT(approximatelyEqual(
+                            outputPoints[ii].x(), reference.x(), testEpsilon));
+        BRICK_TEST_ASSERT(approximatelyEqual(
+                            outputPoints[ii].y(), reference.y(), testEpsilon));
+        BRICK_TEST_ASSERT(approximatelyEqual(
+                            outputColumns(0, ii), reference.x(), testEpsilon));
+        BRICK_TEST_ASSERT(approximatelyEqual(
+                            outputColumns(1, ii), reference.y(), testEpsilon));
+        BRICK_TEST_ASSERT(approximatelyEqual(
+                            outputRows(ii, 0), reference.x(), testEpsilon));
+        BRICK_TEST_ASSERT(approximatelyEqual(
+                            outputRows(ii, 1), reference.y(), testEpsilon));
+      }
+    }
+
+
+    Array1D< Vector3D<double> >
+    Transform3DTest::
+    getPoints(size_t count)
+    {
+      Array1D< Vector3D<double> > points(count);
+      for(size_t ii = 0; ii < count; ++ii) {
+        points[ii].setValue(std::sin(0.37 * ii) * 3.0,
+                            std::cos(0.11 * ii) * 2.0 + 1.0,
+                            std::sin(0.05 * ii + 1.0) + 4.0);
+      }
+      return points;
+    }
+
   } // namespace numeric
 
 } // namespace brick
@@ -170,6 +170,18 @@ namespace brick {
       invert() const;
 
 
+      /**
+       * This member function returns true if the bottom row of the
+       * matrix representation of *this is [0, 0, 0, 1], so that
+       * transforming a point doesn't require a homogeneous divide.
+       * Rigid and affine transforms have this property.
+       *
+       * @return The return value is true if *this is affine.
+       */
+      bool
+      isAffine() const;
+
+
       /**
        * Assuming the *this represents a rigid body transformation,
        * this member function takes a point and applies only the
@@ -325,6 +337,79 @@ namespace brick {
       operator*(const Vector3D<Type>& vector0) const;
 
 
+      /**
+       * This member function applies the coordinate transform to
+       * each point in a contiguous range.  It gives the same result
+       * as calling operator*() on each point, but loads the matrix
+       * only once, skips the homogeneous divide if isAffine() is
+       * true, and can split the work across threads.
+       *
+       * @param inputBegin This argument points to the first point to
+       * be transformed.
+       *
+       * @param inputEnd This argument points one past the last point
+       * to be transformed.
+       *
+       * @param outputBegin This argument points to the first element
+       * of the output range.  It may be equal to inputBegin, in
+       * which case the points are transformed in place, but the
+       * ranges must not otherwise overlap.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.  Setting it to 0 means "use one thread per
+       * core."
+       */
+      void
+      transformPoints(Vector3D<Type> const* inputBegin,
+                      Vector3D<Type> const* inputEnd,
+                      Vector3D<Type>* outputBegin,
+                      size_t numberOfThreads = 1) const;
+
+
+      /**
+       * This member function is just like transformPoints(), except
+       * that points are stored in the columns of a 3xN array.  This
+       * layout keeps each coordinate contiguous, which is the fastest
+       * option for large point clouds.
+       *
+       * @param inputPoints This argument is the array of points to be
+       * transformed, one point per column.  It must have 3 rows.
+       *
+       * @param outputPoints This argument is used to return the
+       * transformed points.  It will be reinitialized if its shape
+       * doesn't match inputPoints.  It may be the same array as
+       * inputPoints.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.
+       */
+      void
+      transformPointColumns(Array2D<Type> const& inputPoints,
+                            Array2D<Type>& outputPoints,
+                            size_t numberOfThreads = 1) const;
+
+
+      /**
+       * This member function is just like transformPointColumns(),
+       * except that points are stored in the rows of an Nx3 array.
+       *
+       * @param inputPoints This argument is the array of points to be
+       * transformed, one point per row.  It must have 3 columns.
+       *
+       * @param outputPoints This argument is used to return the
+       * transformed points.  It will be reinitialized if its shape
+       * doesn't match inputPoints.  It may be the same array as
+       * inputPoints.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.
+       */
+      void
+      transformPointRows(Array2D<Type> const& inputPoints,
+                         Array2D<Type>& outputPoints,
+                         size_t numberOfThreads = 1) const;
+
+
       /**
        * The assignment operator simply duplicates its argument.
        *
@@ -338,6 +423,12 @@ namespace brick {
     private:
       void normalize();
 
+      void
+      transformStrided(Type const* xInput, Type const* yInput,
+                       Type const* zInput, size_t inputStride,
+                       Type* xOutput, Type* yOutput, Type* zOutput,
+                       size_t outputStride, size_t count) const;
+
       Type m_00, m_01, m_02, m_03;
       Type m_10, m_11, m_12, m_13;
       Type m_20, m_21, m_22, m_23;
@@ -190,6 +190,69 @@ namespace brick {
       Vector2D<Type>
       operator*(const Vector3D<Type>& vector0) const;
 
+      /**
+       * Applies the coordinate transformation to each point in a
+       * contiguous range.  This gives the same result as calling
+       * operator*() on each point, but loads the matrix only once and
+       * can split the work across threads.
+       *
+       * @param inputBegin This argument points to the first point to
+       * be transformed.
+       *
+       * @param inputEnd This argument points one past the last point
+       * to be transformed.
+       *
+       * @param outputBegin This argument points to the first element
+       * of the output range.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.  Setting it to 0 means "use one thread per
+       * core."
+       */
+      void
+      transformPoints(Vector3D<Type> const* inputBegin,
+                      Vector3D<Type> const* inputEnd,
+                      Vector2D<Type>* outputBegin,
+                      size_t numberOfThreads = 1) const;
+
+      /**
+       * Applies the coordinate transformation to each column of a 3xN
+       * array, filling in the corresponding column of a 2xN array.
+       *
+       * @param inputPoints This argument is the array of points to be
+       * transformed, one point per column.  It must have 3 rows.
+       *
+       * @param outputPoints This argument is used to return the
+       * transformed points.  It will be reinitialized if it doesn't
+       * have 2 rows and the same number of columns as inputPoints.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.
+       */
+      void
+      transformPointColumns(Array2D<Type> const& inputPoints,
+                            Array2D<Type>& outputPoints,
+                            size_t numberOfThreads = 1) const;
+
+      /**
+       * Applies the coordinate transformation to each row of an Nx3
+       * array, filling in the corresponding row of an Nx2 array.
+       *
+       * @param inputPoints This argument is the array of points to be
+       * transformed, one point per row.  It must have 3 columns.
+       *
+       * @param outputPoints This argument is used to return the
+       * transformed points.  It will be reinitialized if it doesn't
+       * have 2 columns and the same number of rows as inputPoints.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.
+       */
+      void
+      transformPointRows(Array2D<Type> const& inputPoints,
+                         Array2D<Type>& outputPoints,
+                         size_t numberOfThreads = 1) const;
+
       /**
        * The assignment operator simply duplicates its argument.
        *
@@ -201,6 +264,12 @@ namespace brick {
 
     private:
 
+      void
+      transformStrided(Type const* xInput, Type const* yInput,
+                       Type const* zInput, size_t inputStride,
+                       Type* uOutput, Type* vOutput, size_t outputStride,
+                       size_t count) const;
+
       Type m_00, m_01, m_02, m_03;
       Type m_10, m_11, m_12, m_13;
       Type m_20, m_21, m_22, m_23;
@@ -264,6 +264,99 @@ namespace brick {
     }
 
 
+    // Applies the coordinate transformation to each point in a
+    // contiguous range.
+    template <class Type>
+    void
+    Transform3DTo2D<Type>::
+    transformPoints(Vector3D<Type> const* inputBegin,
+                    Vector3D<Type> const* inputEnd,
+                    Vector2D<Type>* outputBegin,
+                    size_t numberOfThreads) const
+    {
+      privateCode::executeTransformBlocks(
+        static_cast<size_t>(inputEnd - inputBegin), numberOfThreads,
+        [&](size_t beginIndex, size_t endIndex) {
+          for(size_t ii = beginIndex; ii < endIndex; ++ii) {
+            Type const xx = inputBegin[ii].x();
+            Type const yy = inputBegin[ii].y();
+            Type const zz = inputBegin[ii].z();
+            Type const scale =
+              Type(1) / (m_20 * xx + m_21 * yy + m_22 * zz + m_23);
+            outputBegin[ii].setValue(
+              (m_00 * xx + m_01 * yy + m_02 * zz + m_03) * scale,
+              (m_10 * xx + m_11 * yy + m_12 * zz + m_13) * scale);
+          }
+        });
+    }
+
+
+    // Applies the coordinate transformation to each column of a 3xN
+    // array.
+    template <class Type>
+    void
+    Transform3DTo2D<Type>::
+    transformPointColumns(Array2D<Type> const& inputPoints,
+                          Array2D<Type>& outputPoints,
+                          size_t numberOfThreads) const
+    {
+      if(inputPoints.rows() != 3) {
+        BRICK_THROW(common::ValueException,
+                    "Transform3DTo2D::transformPointColumns()",
+                    "Argument inputPoints must have exactly three rows.");
+      }
+      if(outputPoints.rows() != 2
+         || outputPoints.columns() != inputPoints.columns()) {
+        outputPoints.reinit(2, inputPoints.columns());
+      }
+      Type const* xInput = inputPoints.getData(0, 0);
+      Type const* yInput = inputPoints.getData(1, 0);
+      Type const* zInput = inputPoints.getData(2, 0);
+      Type* uOutput = outputPoints.getData(0, 0);
+      Type* vOutput = outputPoints.getData(1, 0);
+      privateCode::executeTransformBlocks(
+        inputPoints.columns(), numberOfThreads,
+        [&](size_t beginIndex, size_t endIndex) {
+          this->transformStrided(
+            xInput + beginIndex, yInput + beginIndex, zInput + beginIndex, 1,
+            uOutput + beginIndex, vOutput + beginIndex, 1,
+            endIndex - beginIndex);
+        });
+    }
+
+
+    // Applies the coordinate transformation to each row of an Nx3
+    // array.
+    template <class Type>
+    void
+    Transform3DTo2D<Type>::
+    transformPointRows(Array2D<Type> const& inputPoints,
+                       Array2D<Type>& outputPoints,
+                       size_t numberOfThreads) const
+    {
+      if(inputPoints.columns() != 3) {
+        BRICK_THROW(common::ValueException,
+                    "Transform3DTo2D::transformPointRows()",
+                    "Argument inputPoints must have exactly three columns.");
+      }
+      if(outputPoints.rows() != inputPoints.rows()
+         || outputPoints.columns() != 2) {
+        outputPoints.reinit(inputPoints.rows(), 2);
+      }
+      Type const* inputPtr = inputPoints.data();
+      Type* outputPtr = outputPoints.data();
+      privateCode::executeTransformBlocks(
+        inputPoints.rows(), numberOfThreads,
+        [&](size_t beginIndex, size_t endIndex) {
+          Type const* blockInput = inputPtr + 3 * beginIndex;
+          Type* blockOutput = outputPtr + 2 * beginIndex;
+          this->transformStrided(
+            blockInput, blockInput + 1, blockInput + 2, 3,
+            blockOutput, blockOutput + 1, 2, endIndex - beginIndex);
+        });
+    }
+
+
     // The assignment operator simply duplicates its argument.
     template <class Type>
     Transform3DTo2D<Type>&
@@ -282,6 +375,36 @@ namespace brick {
     }
 
 
+    // This private member function does the work of the batch
+    // transform functions.
+    template <class Type>
+    void
+    Transform3DTo2D<Type>::
+    transformStrided(Type const* xInput, Type const* yInput,
+                     Type const* zInput, size_t inputStride,
+                     Type* uOutput, Type* vOutput, size_t outputStride,
+                     size_t count) const
+    {
+      // Copy the matrix into locals so the compiler knows they
+      // can't be modified by writes to the output arrays.
+      Type const a00 = m_00, a01 = m_01, a02 = m_02, a03 = m_03;
+      Type const a10 = m_10, a11 = m_11, a12 = m_12, a13 = m_13;
+      Type const a20 = m_20, a21 = m_21, a22 = m_22, a23 = m_23;
+      size_t inputIndex = 0;
+      size_t outputIndex = 0;
+      for(size_t ii = 0; ii < count; ++ii) {
+        Type const xx = xInput[inputIndex];
+        Type const yy = yInput[inputIndex];
+        Type const zz = zInput[inputIndex];
+        Type const scale = Type(1) / (a20 * xx + a21 * yy + a22 * zz + a23);
+        uOutput[outputIndex] = (a00 * xx + a01 * yy + a02 * zz + a03) * scale;
+        vOutput[outputIndex] = (a10 * xx + a11 * yy + a12 * zz + a13) * scale;
+        inputIndex += inputStride;
+        outputIndex += outputStride;
+      }
+    }
+
+
     /* ================ Non member functions below ================ */
 
 
@@ -19,10 +19,47 @@
 //
 // #include <brick/numeric/transform3D.hh>
 
+#include <algorithm>
+#include <brick/common/parallel.hh>
+
 namespace brick {
 
   namespace numeric {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Batch point transforms hand each thread this many points at
+      // a time.
+      const size_t transformPointsBlockSize = 16384;
+
+
+      // Call functor(beginIndex, endIndex) for consecutive blocks of
+      // [0, count), possibly in parallel.
+      template <class Functor>
+      void
+      executeTransformBlocks(size_t count, size_t numberOfThreads,
+                             Functor functor)
+      {
+        size_t const blockSize = transformPointsBlockSize;
+        size_t const numberOfBlocks = (count + blockSize - 1) / blockSize;
+        if(numberOfBlocks <= 1) {
+          functor(size_t(0), count);
+          return;
+        }
+        brick::common::executeInParallel(
+          numberOfBlocks,
+          [&](size_t blockIndex) {
+            size_t beginIndex = blockIndex * blockSize;
+            functor(beginIndex, std::min(beginIndex + blockSize, count));
+          },
+          numberOfThreads);
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
     // Default constructor.  Initializes to identity.
     template <class Type>
     inline
@@ -208,6 +245,18 @@ namespace brick {
     }
 
 
+    // This member function returns true if the bottom row of the
+    // matrix representation of *this is [0, 0, 0, 1].
+    template <class Type>
+    inline bool
+    Transform3D<Type>::
+    isAffine() const
+    {
+      return (m_30 == Type(0) && m_31 == Type(0) && m_32 == Type(0)
+              && m_33 == Type(1));
+    }
+
+
     // This member function returns the inverse of *this.
     template <class Type>
     Transform3D<Type>
@@ -537,6 +586,108 @@ namespace brick {
     }
 
 
+    // This member function applies the coordinate transform to each
+    // point in a contiguous range.
+    template <class Type>
+    void
+    Transform3D<Type>::
+    transformPoints(Vector3D<Type> const* inputBegin,
+                    Vector3D<Type> const* inputEnd,
+                    Vector3D<Type>* outputBegin,
+                    size_t numberOfThreads) const
+    {
+      bool const isAffineFlag = this->isAffine();
+      privateCode::executeTransformBlocks(
+        static_cast<size_t>(inputEnd - inputBegin), numberOfThreads,
+        [&](size_t beginIndex, size_t endIndex) {
+          for(size_t ii = beginIndex; ii < endIndex; ++ii) {
+            Type const xx = inputBegin[ii].x();
+            Type const yy = inputBegin[ii].y();
+            Type const zz = inputBegin[ii].z();
+            Type const xOut = m_00 * xx + m_01 * yy + m_02 * zz + m_03;
+            Type const yOut = m_10 * xx + m_11 * yy + m_12 * zz + m_13;
+            Type const zOut = m_20 * xx + m_21 * yy + m_22 * zz + m_23;
+            if(isAffineFlag) {
+              outputBegin[ii].setValue(xOut, yOut, zOut);
+            } else {
+              Type const scale =
+                Type(1) / (m_30 * xx + m_31 * yy + m_32 * zz + m_33);
+              outputBegin[ii].setValue(
+                xOut * scale, yOut * scale, zOut * scale);
+            }
+          }
+        });
+    }
+
+
+    // This member function applies the coordinate transform to each
+    // column of a 3xN array.
+    template <class Type>
+    void
+    Transform3D<Type>::
+    transformPointColumns(Array2D<Type> const& inputPoints,
+                          Array2D<Type>& outputPoints,
+                          size_t numberOfThreads) const
+    {
+      if(inputPoints.rows() != 3) {
+        BRICK_THROW(common::ValueException,
+                    "Transform3D::transformPointColumns()",
+                    "Argument inputPoints must have exactly three rows.");
+      }
+      if(outputPoints.rows() != inputPoints.rows()
+         || outputPoints.columns() != inputPoints.columns()) {
+        outputPoints.reinit(inputPoints.rows(), inputPoints.columns());
+      }
+      Type const* xInput = inputPoints.getData(0, 0);
+      Type const* yInput = inputPoints.getData(1, 0);
+      Type const* zInput = inputPoints.getData(2, 0);
+      Type* xOutput = outputPoints.getData(0, 0);
+      Type* yOutput = outputPoints.getData(1, 0);
+      Type* zOutput = outputPoints.getData(2, 0);
+      privateCode::executeTransformBlocks(
+        inputPoints.columns(), numberOfThreads,
+        [&](size_t beginIndex, size_t endIndex) {
+          this->transformStrided(
+            xInput + beginIndex, yInput + beginIndex, zInput + beginIndex, 1,
+            xOutput + beginIndex, yOutput + beginIndex, zOutput + beginIndex,
+            1, endIndex - beginIndex);
+        });
+    }
+
+
+    // This member function applies the coordinate transform to each
+    // row of an Nx3 array.
+    template <class Type>
+    void
+    Transform3D<Type>::
+    transformPointRows(Array2D<Type> const& inputPoints,
+                       Array2D<Type>& outputPoints,
+                       size_t numberOfThreads) const
+    {
+      if(inputPoints.columns() != 3) {
+        BRICK_THROW(common::ValueException,
+                    "Transform3D::transformPointRows()",
+                    "Argument inputPoints must have exactly three columns.");
+      }
+      if(outputPoints.rows() != inputPoints.rows()
+         || outputPoints.columns() != inputPoints.columns()) {
+        outputPoints.reinit(inputPoints.rows(), inputPoints.columns());
+      }
+      Type const* inputPtr = inputPoints.data();
+      Type* outputPtr = outputPoints.data();
+      privateCode::executeTransformBlocks(
+        inputPoints.rows(), numberOfThreads,
+        [&](size_t beginIndex, size_t endIndex) {
+          Type const* blockInput = inputPtr + 3 * beginIndex;
+          Type* blockOutput = outputPtr + 3 * beginIndex;
+          this->transformStrided(
+            blockInput, blockInput + 1, blockInput + 2, 3,
+            blockOutput, blockOutput + 1, blockOutput + 2, 3,
+            endIndex - beginIndex);
+        });
+    }
+
+
     // The assignment operator simply duplicates its argument.
     template <class Type>
     Transform3D<Type>&
@@ -557,6 +708,52 @@ namespace brick {
     }
 
 
+    // This private member function does the work of the batch
+    // transform functions.  Each point is read completely before it
+    // is written, so input and output may alias exactly.
+    template <class Type>
+    void
+    Transform3D<Type>::
+    transformStrided(Type const* xInput, Type const* yInput,
+                     Type const* zInput, size_t inputStride,
+                     Type* xOutput, Type* yOutput, Type* zOutput,
+                     size_t outputStride, size_t count) const
+    {
+      // Copy the matrix into locals so the compiler knows they
+      // can't be modified by writes to the output arrays.
+      Type const a00 = m_00, a01 = m_01, a02 = m_02, a03 = m_03;
+      Type const a10 = m_10, a11 = m_11, a12 = m_12, a13 = m_13;
+      Type const a20 = m_20, a21 = m_21, a22 = m_22, a23 = m_23;
+      Type const a30 = m_30, a31 = m_31, a32 = m_32, a33 = m_33;
+      size_t inputIndex = 0;
+      size_t outputIndex = 0;
+      if(this->isAffine()) {
+        for(size_t ii = 0; ii < count; ++ii) {
+          Type const xx = xInput[inputIndex];
+          Type const yy = yInput[inputIndex];
+          Type const zz = zInput[inputIndex];
+          xOutput[outputIndex] = a00 * xx + a01 * yy + a02 * zz + a03;
+          yOutput[outputIndex] = a10 * xx + a11 * yy + a12 * zz + a13;
+          zOutput[outputIndex] = a20 * xx + a21 * yy + a22 * zz + a23;
+          inputIndex += inputStride;
+          outputIndex += outputStride;
+        }
+      } else {
+        for(size_t ii = 0; ii < count; ++ii) {
+          Type const xx = xInput[inputIndex];
+          Type const yy = yInput[inputIndex];
+          Type const zz = zInput[inputIndex];
+          Type const scale = Type(1) / (a30 * xx + a31 * yy + a32 * zz + a33);
+          xOutput[outputIndex] = (a00 * xx + a01 * yy + a02 * zz + a03) * scale;
+          yOutput[outputIndex] = (a10 * xx + a11 * yy + a12 * zz + a13) * scale;
+          zOutput[outputIndex] = (a20 * xx + a21 * yy + a22 * zz + a23) * scale;
+          inputIndex += inputStride;
+          outputIndex += outputStride;
+        }
+      }
+    }
+
+
     template <class Type>
     void
     Transform3D<Type>::
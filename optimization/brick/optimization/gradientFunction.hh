@@ -13,7 +13,9 @@
 #ifndef BRICK_OPTIMIZATION_GRADIENTFUNCTION_HH
 #define BRICK_OPTIMIZATION_GRADIENTFUNCTION_HH
 
+#include <algorithm>
 #include <functional>
+#include <brick/common/parallel.hh>
 #include <brick/numeric/derivativeRidders.hh>
 
 namespace brick {
@@ -48,6 +50,13 @@ namespace brick {
      ** Template argument Scalar specifies the precision with which
      ** internal calculations will be conducted.
      **
+     ** For expensive objective functions with many parameters, the
+     ** 2N function evaluations needed by gradient() can be spread
+     ** across several threads using setNumberOfThreads().  In this
+     ** mode, each thread evaluates its own copy of the function
+     ** object, so Functor must be copyable, and copies must be safe
+     ** to evaluate concurrently.
+     **
      ** Here's a usage example:
      **
      ** @code
@@ -74,9 +83,14 @@ namespace brick {
        * @param epsilon If the gradient() method is not overridden in a
        * subclass, the gradient will be computed by using symmetric
        * divided differences with a total step size of 2 * epsilon.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads gradient() should use.  See setNumberOfThreads().
        */
-      GradientFunction(const Functor& functor, Scalar epsilon=1.0e-6) :
-        m_functor(functor), m_epsilon(epsilon) {
+      GradientFunction(const Functor& functor, Scalar epsilon=1.0e-6,
+                       size_t numberOfThreads = 1) :
+        m_functor(functor), m_epsilon(epsilon),
+        m_numberOfThreads(numberOfThreads) {
         if(epsilon == 0.0) {
           BRICK_THROW(brick::common::ValueException,
 		      "GradientFunction::GradientFunction()",
@@ -118,9 +132,37 @@ namespace brick {
         return m_functor(theta);
       }
 
+
+      /**
+       * This method sets how many threads the default implementation
+       * of gradient() uses to evaluate divided differences.  The
+       * parameters are split into contiguous blocks, one per thread,
+       * and each thread works on its own copy of the function object.
+       * Results are identical to the single threaded computation.
+       *
+       * @param numberOfThreads This argument specifies the maximum
+       * number of threads to use.  Setting it to 1 (the default)
+       * evaluates everything in the calling thread, and setting it to
+       * zero selects brick::common::getDefaultNumberOfThreads().
+       */
+      void
+      setNumberOfThreads(size_t numberOfThreads) {
+        m_numberOfThreads = numberOfThreads;
+      }
+
     private:
+
+      // Computes elements [beginIndex, endIndex) of the divided
+      // difference gradient, using the specified function object.
+      void
+      computeDividedDifferences(Functor& functor,
+                                const typename Functor::argument_type& theta,
+                                size_t beginIndex, size_t endIndex,
+                                typename Functor::argument_type& result);
+
       Functor m_functor;
       Scalar m_epsilon;
+      size_t m_numberOfThreads;
 
     }; // class GradientFunction
 
@@ -216,27 +258,70 @@ namespace brick {
     typename Functor::argument_type
     GradientFunction<Functor, Scalar>::
     gradient(const typename Functor::argument_type& theta)
+    {
+      // Return value must be a vector, so use argument_type.
+      typename Functor::argument_type result(theta.size());
+
+      size_t numberOfThreads = m_numberOfThreads;
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
+      }
+      if(numberOfThreads > theta.size()) {
+        numberOfThreads = theta.size();
+      }
+      if(numberOfThreads <= 1) {
+        this->computeDividedDifferences(
+          m_functor, theta, 0, theta.size(), result);
+        return result;
+      }
+
+      // One contiguous block of parameters per task.  Each task
+      // copies the function object, so that no two threads share
+      // any mutable state.
+      size_t const blockSize =
+        (theta.size() + numberOfThreads - 1) / numberOfThreads;
+      brick::common::executeInParallel(
+        numberOfThreads,
+        [&](size_t taskIndex) {
+          size_t beginIndex = taskIndex * blockSize;
+          size_t endIndex = std::min(beginIndex + blockSize, theta.size());
+          if(beginIndex < endIndex) {
+            Functor functor(m_functor);
+            this->computeDividedDifferences(
+              functor, theta, beginIndex, endIndex, result);
+          }
+        },
+        numberOfThreads);
+      return result;
+    }
+
+
+    template <class Functor, class Scalar>
+    void
+    GradientFunction<Functor, Scalar>::
+    computeDividedDifferences(Functor& functor,
+                              const typename Functor::argument_type& theta,
+                              size_t beginIndex, size_t endIndex,
+                              typename Functor::argument_type& result)
     {
       // Create some vectors to use as input to operator()().
       typename Functor::argument_type thetaMinus(theta.size());
       typename Functor::argument_type thetaPlus(theta.size());
-      // Return value must be a vector, too, so use argument_type.
-      typename Functor::argument_type result(theta.size());
       // Initialize arguments.
       for(size_t index = 0; index < theta.size(); ++index) {
         thetaMinus[index] = theta[index];
         thetaPlus[index] = theta[index];
       }
       // Now compute each partial derivative.
-      for(size_t index = 0; index < theta.size(); ++index) {
+      for(size_t index = beginIndex; index < endIndex; ++index) {
         // Set up the difference.
         thetaMinus[index] = theta[index] - m_epsilon;
         thetaPlus[index] = theta[index] + m_epsilon;
         // Compute divided difference.
         typename Functor::result_type valueMinus =
-          m_functor.operator()(thetaMinus);
+          functor.operator()(thetaMinus);
         typename Functor::result_type valuePlus =
-          m_functor.operator()(thetaPlus);
+          functor.operator()(thetaPlus);
 
         // Dodge some roundoff error by finding out precisely what the
         // difference in arguments turned out to be.
@@ -253,7 +338,6 @@ namespace brick {
         thetaMinus[index] = theta[index];
         thetaPlus[index] = theta[index];
       }
-      return result;
     }
 
 
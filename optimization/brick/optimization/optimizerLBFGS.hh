@@ -0,0 +1,1034 @@
+/**
+***************************************************************************
+* @file brick/optimization/optimizerLBFGS.hh
+*
+* Header file declaring OptimizerLBFGS class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_OPTIMIZATION_OPTIMIZERLBFGS_HH
+#define BRICK_OPTIMIZATION_OPTIMIZERLBFGS_HH
+
+#include <limits>
+#include <vector>
+#include <brick/common/mathFunctions.hh>
+#include <brick/common/triple.hh>
+#include <brick/optimization/optimizer.hh>
+#include <brick/optimization/optimizerLineSearchMoreThuente.hh>
+
+namespace brick {
+
+  namespace optimization {
+
+    /**
+     ** OptimizerLBFGS implements the limited memory BFGS method
+     ** described in [1].  Rather than maintaining a dense N x N
+     ** estimate of the inverse Hessian, as OptimizerBFGS does, it
+     ** keeps only the most recent few step and gradient change
+     ** vectors, and applies the implied inverse Hessian estimate
+     ** using the two-loop recursion.  Memory use and work per
+     ** iteration are therefore O(M * N), where M is the history
+     ** length, which makes this class practical for problems with
+     ** thousands or tens of thousands of parameters.  Line searches
+     ** are performed by OptimizerLineSearchMoreThuente.
+     **
+     ** Like OptimizerBFGS, this algorithm seeks the parameter value
+     ** which minimizes the objective function.  The template parameter
+     ** (Functor) defines the type to use as the objective function of
+     ** the minimization, and must support the GradientFunction
+     ** interface.  If Functor computes its gradient by finite
+     ** differences, consider using GradientFunction::setNumberOfThreads()
+     ** to spread the function evaluations across several threads.
+     **
+     ** [1] J. Nocedal, Updating Quasi-Newton Matrices with Limited
+     ** Storage, Mathematics of Computation, 35(151):773-782, 1980.
+     **/
+    template <class Functor, class FloatType = double>
+    class OptimizerLBFGS
+      : public Optimizer<Functor>
+    {
+    public:
+      // Typedefs for convenience
+      typedef typename Functor::argument_type argument_type;
+      typedef typename Functor::result_type result_type;
+
+      /**
+       * The default constructor sets parameters to reasonable values
+       * for functions which take values and arguments in the "normal"
+       * range of 0 to 100 or so.
+       */
+      OptimizerLBFGS();
+
+      /**
+       * This constructor specifies the specific Functor instance to
+       * use.  Using this constructor exclusively avoids the danger of
+       * calling optimalValue() or optimum() before a Functor instance
+       * has been specified.
+       *
+       * @param functor A copy of this argument will be stored
+       * internally for use in optimization.
+       */
+      explicit OptimizerLBFGS(const Functor& functor);
+
+      /**
+       * Copy constructor.  This constructor simply copies the source
+       * argument.
+       *
+       * @param source The OptimizerLBFGS instance to be copied.
+       */
+      OptimizerLBFGS(const OptimizerLBFGS& source);
+
+      /**
+       * The destructor destroys the class instance and deallocates any
+       * associated storage.
+       */
+      virtual
+      ~OptimizerLBFGS();
+
+      /**
+       * This method returns the number of function calls required to
+       * complete the previous minimization.  See
+       * OptimizerBFGS::getNumberOfFunctionCalls() for details.
+       *
+       * @return a vector of function call counts.
+       */
+      virtual std::vector<size_t>
+      getNumberOfFunctionCalls() {return this->m_functionCallCount;}
+
+      /**
+       * This method returns the number of gradient calls required to
+       * complete the previous minimization.  See
+       * OptimizerBFGS::getNumberOfGradientCalls() for details.
+       *
+       * @return a vector of gradient call counts.
+       */
+      virtual std::vector<size_t>
+      getNumberOfGradientCalls() {return this->m_gradientCallCount;}
+
+      /**
+       * This method returns the number of iterations required to
+       * complete the previous minimization.  See
+       * OptimizerBFGS::getNumberOfIterations() for details.
+       *
+       * @return a vector of iteration counts.
+       */
+      virtual std::vector<size_t>
+      getNumberOfIterations() {return this->m_iterationCount;}
+
+      /**
+       * This method sets minimization parameters.  Default values are
+       * reasonable for functions which take values and arguments in the
+       * "normal" range of 0 to 100 or so.
+       *
+       * @param historyLength This argument specifies how many of the
+       * most recent steps are used to estimate the inverse Hessian.
+       * Values between 3 and 20 are typical.  Larger values use more
+       * memory, and more work per iteration, but may reduce the
+       * number of iterations.
+       *
+       * @param iterationLimit Each minimization will terminate after
+       * this many iterations.
+       *
+       * @param numberOfRestarts Following successful termination, the
+       * minimization will be re-run this many times, discarding the
+       * step history each time.
+       *
+       * @param argumentTolerance Iteration will terminate when a
+       * minimization step moves, along every axis, a distance less than
+       * this factor times the corresponding element of the argument
+       * vector.
+       *
+       * @param gradientTolerance Iteration will terminate when the
+       * magnitude of the gradient times the magnitude of the parameter
+       * vector becomes smaller than the function value by this factor.
+       *
+       * @param lineSearchAlpha This argument is passed to the line
+       * search, and controls how much decrease in function value is
+       * required for a step to be accepted.
+       *
+       * @param lineSearchCurvatureTolerance This argument is passed to
+       * the line search, and controls how much reduction in the
+       * directional derivative is required for a step to be accepted.
+       *
+       * @param lineSearchArgumentTolerance This argument is passed to
+       * the line search, and controls its termination.
+       *
+       * @param maximumStepMagnitudeFactor Sets the maximum step
+       * distance for each line minimization in the algorithm.
+       *
+       * @param minimumFunctionValue Iteration will terminate if the
+       * objective function value falls to or below this value.
+       */
+      virtual void
+      setParameters(size_t historyLength = 8,
+                    size_t iterationLimit = 500,
+                    size_t numberOfRestarts = 0,
+                    FloatType argumentTolerance = 1.2E-7,
+                    FloatType gradientTolerance = 0.00001,
+                    FloatType lineSearchAlpha = 1.0E-4,
+                    FloatType lineSearchCurvatureTolerance = 0.9,
+                    FloatType lineSearchArgumentTolerance = 1.0e-7,
+                    FloatType maximumStepMagnitudeFactor = 100.0,
+                    FloatType minimumFunctionValue =
+                      -std::numeric_limits<FloatType>::max());
+
+
+      /**
+       * This method sets the number of steps used to estimate the
+       * inverse Hessian, without affecting any other optimization
+       * parameters.
+       *
+       * @param historyLength This argument specifies how many of the
+       * most recent steps to remember.
+       */
+      virtual void
+      setHistoryLength(size_t historyLength) {
+        this->m_historyLength = (historyLength == 0) ? 1 : historyLength;
+        Optimizer<Functor>::m_needsOptimization = true;
+      }
+
+
+      /**
+       * This method sets the optimization parameter controlling the
+       * maximum number of iterations, without affecting any other
+       * optimization parameters.
+       *
+       * @param iterationLimit Each minimization will terminate after
+       * this many iterations.
+       */
+      virtual void
+      setIterationLimit(size_t iterationLimit) {
+        this->m_iterationLimit = iterationLimit;
+      }
+
+
+      /**
+       * This method sets the optimization parameter controlling the
+       * number of restarts, without affecting any other optimization
+       * parameters.
+       *
+       * @param numberOfRestarts Following successful termination, the
+       * minimization will be re-run this many times.
+       */
+      virtual void
+      setNumberOfRestarts(size_t numberOfRestarts) {
+        this->m_numberOfRestarts = numberOfRestarts;
+      }
+
+
+      /**
+       * This method sets the optimization parameter controlling the
+       * function value at which the optimization will be considered
+       * "close enough."
+       *
+       * @param minimumFunctionValue Iteration will terminate if the
+       * objective function value falls to or below this value.
+       */
+      virtual void
+      setMinimumFunctionValue(FloatType minimumFunctionValue) {
+        this->m_minimumFunctionValue = minimumFunctionValue;
+      }
+
+
+      /**
+       * This method sets the initial conditions for the minimization.
+       * Gradient based search will start at this location in parameter
+       * space.
+       *
+       * @param startPoint Indicates a point in the parameter space of
+       * the objective function.
+       */
+      virtual void
+      setStartPoint(const typename Functor::argument_type& startPoint);
+
+
+      /**
+       * This method sets the amount of text printed to the standard
+       * output during the optimization.
+       *
+       * @param verbosity This argument indicates the desired output
+       * level.  Setting verbosity to zero mean that no standard output
+       * should be generated.  Higher numbers indicate increasingly more
+       * output.
+       */
+      virtual void
+      setVerbosity(int verbosity) {this->m_verbosity = verbosity;}
+
+
+      /**
+       * Assignment operator.
+       *
+       * @param source The OptimizerLBFGS instance to be copied.
+       *
+       * @return Reference to *this.
+       */
+      virtual OptimizerLBFGS&
+      operator=(const OptimizerLBFGS& source);
+
+    protected:
+
+      /**
+       * This protected member function is used to asses whether the
+       * algorithm has reached convergence.  It is identical to
+       * OptimizerBFGS::gradientConvergenceMetric().
+       *
+       * @param theta This argument specifies the parameter values
+       * (arguments to the objective function) being assessed.
+       *
+       * @param value This argument specifies the function value at the
+       * point described by theta.
+       *
+       * @param gradient This argument specifies the function gradient
+       * at the point described by theta.
+       *
+       * @return The return value gets progressively smaller as we
+       * approach a local minimum.
+       */
+      FloatType
+      gradientConvergenceMetric(const argument_type& theta,
+                                const result_type& value,
+                                const argument_type& gradient);
+
+      /**
+       * Perform the optimization.  This virtual function overrides the
+       * definition in Optimizer.
+       *
+       * @return A std::pair of the vector parameter which brings the
+       * specified Functor to an optimum, and the corresponding optimal
+       * Functor value.
+       */
+      virtual
+      std::pair<typename Functor::argument_type, typename Functor::result_type>
+      run();
+
+      /**
+       * Perform one complete L-BFGS minimization, starting from the
+       * specified position.  Arguments and return value are as for
+       * OptimizerBFGS::doBfgs().
+       */
+      brick::common::Triple<typename Functor::argument_type,
+                            typename Functor::result_type,
+                            typename Functor::argument_type>
+      doLbfgs(const argument_type& theta,
+              const result_type& startValue,
+              const argument_type& startGradient,
+              size_t& numberOfFunctionCalls,
+              size_t& numberOfGradientCalls,
+              size_t& numberOfIterations);
+
+      // Data members.
+      FloatType m_argumentTolerance;
+      FloatType m_gradientTolerance;
+      size_t m_historyLength;
+      size_t m_iterationLimit;
+      FloatType m_lineSearchAlpha;
+      FloatType m_lineSearchArgumentTolerance;
+      FloatType m_lineSearchCurvatureTolerance;
+      FloatType m_maximumStepMagnitudeFactor;
+      FloatType m_minimumFunctionValue;
+      size_t m_numberOfRestarts;
+      OptimizerLineSearchMoreThuente<Functor, FloatType> m_optimizerLineSearch;
+      argument_type m_startPoint;
+      int m_verbosity;
+
+      // Data members used for bookkeeping.
+      std::vector<size_t> m_functionCallCount;
+      std::vector<size_t> m_gradientCallCount;
+      std::vector<size_t> m_iterationCount;
+
+    }; // class OptimizerLBFGS
+
+  } // namespace optimization
+
+} // namespace brick
+
+
+/*******************************************************************
+ * Member function definitions follow.  This would be a .cpp file
+ * if it weren't templated.
+ *******************************************************************/
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <brick/numeric/array1D.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/optimization/optimizerCommon.hh>
+
+namespace brick {
+
+  namespace optimization {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      /**
+       ** This class template holds the circular history of steps (s),
+       ** gradient changes (y), and 1 / (y . s) used by
+       ** OptimizerLBFGS, and applies the implied inverse Hessian
+       ** estimate using the two-loop recursion.
+       **/
+      template <class FloatType>
+      class LBFGSHistory {
+      public:
+
+        LBFGSHistory(size_t historyLength, size_t dimensionality);
+
+        // Adds the pair (step, newGradient - oldGradient) to the
+        // history, discarding the oldest pair if the history is
+        // full.  If the curvature along step is not positive, the
+        // update would spoil the positive definiteness of the
+        // inverse Hessian estimate, so the pair is rejected and the
+        // history is left untouched.  Returns true if the pair was
+        // accepted.
+        template <class ArgumentType>
+        bool
+        addPair(ArgumentType const& step, ArgumentType const& newGradient,
+                ArgumentType const& oldGradient);
+
+        // Sets direction to H * gradient, where H is the inverse
+        // Hessian estimate.  If the history is empty, direction is
+        // simply gradient, scaled to unit length.
+        template <class ArgumentType>
+        void
+        applyInverseHessian(ArgumentType const& gradient,
+                            brick::numeric::Array1D<FloatType>& direction);
+
+        void
+        clear() {m_historySize = 0;}
+
+        size_t
+        size() const {return m_historySize;}
+
+      private:
+
+        size_t m_dimensionality;
+        size_t m_historyLength;
+        size_t m_historySize;
+        size_t m_newestIndex;
+        brick::numeric::Array2D<FloatType> m_stepHistory;
+        brick::numeric::Array2D<FloatType> m_gradientChangeHistory;
+        brick::numeric::Array1D<FloatType> m_rhoHistory;
+        brick::numeric::Array1D<FloatType> m_alphaBuffer;
+      };
+
+
+      template <class FloatType>
+      LBFGSHistory<FloatType>::
+      LBFGSHistory(size_t historyLength, size_t dimensionality)
+        : m_dimensionality(dimensionality),
+          m_historyLength(historyLength),
+          m_historySize(0),
+          m_newestIndex(historyLength - 1),
+          m_stepHistory(historyLength, dimensionality),
+          m_gradientChangeHistory(historyLength, dimensionality),
+          m_rhoHistory(historyLength),
+          m_alphaBuffer(historyLength)
+      {
+        // Empty.
+      }
+
+
+      template <class FloatType>
+      template <class ArgumentType>
+      bool
+      LBFGSHistory<FloatType>::
+      addPair(ArgumentType const& step, ArgumentType const& newGradient,
+              ArgumentType const& oldGradient)
+      {
+        // Test the curvature before touching the history.  When the
+        // history is full, the candidate slot still holds the oldest
+        // live pair, which must survive a rejection.
+        FloatType stepDotGradientChange = 0.0;
+        FloatType gradientChangeMagnitude2 = 0.0;
+        for(size_t index = 0; index < m_dimensionality; ++index) {
+          FloatType gradientChange =
+            static_cast<FloatType>(newGradient[index] - oldGradient[index]);
+          stepDotGradientChange +=
+            static_cast<FloatType>(step[index]) * gradientChange;
+          gradientChangeMagnitude2 += gradientChange * gradientChange;
+        }
+        if(!(stepDotGradientChange
+             > std::numeric_limits<FloatType>::epsilon()
+             * gradientChangeMagnitude2)) {
+          return false;
+        }
+
+        m_newestIndex = (m_newestIndex + 1) % m_historyLength;
+        FloatType* stepPtr = m_stepHistory.rowBegin(m_newestIndex);
+        FloatType* gradientChangePtr =
+          m_gradientChangeHistory.rowBegin(m_newestIndex);
+        for(size_t index = 0; index < m_dimensionality; ++index) {
+          stepPtr[index] = static_cast<FloatType>(step[index]);
+          gradientChangePtr[index] =
+            static_cast<FloatType>(newGradient[index] - oldGradient[index]);
+        }
+        m_rhoHistory[m_newestIndex] =
+          static_cast<FloatType>(1.0) / stepDotGradientChange;
+        if(m_historySize < m_historyLength) {
+          ++m_historySize;
+        }
+        return true;
+      }
+
+
+      template <class FloatType>
+      template <class ArgumentType>
+      void
+      LBFGSHistory<FloatType>::
+      applyInverseHessian(ArgumentType const& gradient,
+                          brick::numeric::Array1D<FloatType>& direction)
+      {
+        if(direction.size() != m_dimensionality) {
+          direction.reinit(m_dimensionality);
+        }
+        for(size_t index = 0; index < m_dimensionality; ++index) {
+          direction[index] = static_cast<FloatType>(gradient[index]);
+        }
+        for(size_t ii = 0; ii < m_historySize; ++ii) {
+          size_t slot =
+            (m_newestIndex + m_historyLength - ii) % m_historyLength;
+          FloatType const* sPtr = m_stepHistory.rowBegin(slot);
+          FloatType const* yPtr = m_gradientChangeHistory.rowBegin(slot);
+          FloatType dotProduct = 0.0;
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            dotProduct += sPtr[index] * direction[index];
+          }
+          m_alphaBuffer[slot] = m_rhoHistory[slot] * dotProduct;
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            direction[index] -= m_alphaBuffer[slot] * yPtr[index];
+          }
+        }
+        if(m_historySize != 0) {
+          // Scale by s.y / y.y of the newest pair, as suggested in
+          // Nocedal & Wright, so that the initial step is usually
+          // accepted by the line search.
+          FloatType const* yPtr =
+            m_gradientChangeHistory.rowBegin(m_newestIndex);
+          FloatType yDotY = 0.0;
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            yDotY += yPtr[index] * yPtr[index];
+          }
+          FloatType gamma = 1.0 / (m_rhoHistory[m_newestIndex] * yDotY);
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            direction[index] *= gamma;
+          }
+        } else {
+          // No usable curvature information.  Fall back to a unit
+          // length steepest descent step.
+          FloatType directionMagnitude2 = 0.0;
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            directionMagnitude2 += direction[index] * direction[index];
+          }
+          FloatType directionMagnitude =
+            brick::common::squareRoot(directionMagnitude2);
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            direction[index] /= directionMagnitude;
+          }
+        }
+        for(size_t ii = m_historySize; ii > 0; --ii) {
+          size_t slot = (m_newestIndex + m_historyLength - (ii - 1))
+            % m_historyLength;
+          FloatType const* sPtr = m_stepHistory.rowBegin(slot);
+          FloatType const* yPtr = m_gradientChangeHistory.rowBegin(slot);
+          FloatType dotProduct = 0.0;
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            dotProduct += yPtr[index] * direction[index];
+          }
+          FloatType beta = m_rhoHistory[slot] * dotProduct;
+          for(size_t index = 0; index < m_dimensionality; ++index) {
+            direction[index] += (m_alphaBuffer[slot] - beta) * sPtr[index];
+          }
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    template <class Functor, class FloatType>
+    OptimizerLBFGS<Functor, FloatType>::
+    OptimizerLBFGS()
+      : Optimizer<Functor>(),
+        m_argumentTolerance(),
+        m_gradientTolerance(),
+        m_historyLength(),
+        m_iterationLimit(),
+        m_lineSearchAlpha(),
+        m_lineSearchArgumentTolerance(),
+        m_lineSearchCurvatureTolerance(),
+        m_maximumStepMagnitudeFactor(),
+        m_minimumFunctionValue(),
+        m_numberOfRestarts(),
+        m_optimizerLineSearch(),
+        m_startPoint(),
+        m_verbosity(0),
+        m_functionCallCount(),
+        m_gradientCallCount(),
+        m_iterationCount()
+    {
+      this->setParameters();
+    }
+
+
+    template <class Functor, class FloatType>
+    OptimizerLBFGS<Functor, FloatType>::
+    OptimizerLBFGS(const Functor& functor)
+      : Optimizer<Functor>(functor),
+        m_argumentTolerance(),
+        m_gradientTolerance(),
+        m_historyLength(),
+        m_iterationLimit(),
+        m_lineSearchAlpha(),
+        m_lineSearchArgumentTolerance(),
+        m_lineSearchCurvatureTolerance(),
+        m_maximumStepMagnitudeFactor(),
+        m_minimumFunctionValue(),
+        m_numberOfRestarts(),
+        m_optimizerLineSearch(functor),
+        m_startPoint(),
+        m_verbosity(0),
+        m_functionCallCount(),
+        m_gradientCallCount(),
+        m_iterationCount()
+    {
+      this->setParameters();
+    }
+
+
+    template<class Functor, class FloatType>
+    OptimizerLBFGS<Functor, FloatType>::
+    OptimizerLBFGS(const OptimizerLBFGS& source)
+      : Optimizer<Functor>(source),
+        m_argumentTolerance(source.m_argumentTolerance),
+        m_gradientTolerance(source.m_gradientTolerance),
+        m_historyLength(source.m_historyLength),
+        m_iterationLimit(source.m_iterationLimit),
+        m_lineSearchAlpha(source.m_lineSearchAlpha),
+        m_lineSearchArgumentTolerance(source.m_lineSearchArgumentTolerance),
+        m_lineSearchCurvatureTolerance(source.m_lineSearchCurvatureTolerance),
+        m_maximumStepMagnitudeFactor(source.m_maximumStepMagnitudeFactor),
+        m_minimumFunctionValue(source.m_minimumFunctionValue),
+        m_numberOfRestarts(source.m_numberOfRestarts),
+        m_optimizerLineSearch(source.m_optimizerLineSearch),
+        m_startPoint(source.m_startPoint.size()),
+        m_verbosity(source.m_verbosity),
+        m_functionCallCount(source.m_functionCallCount),
+        m_gradientCallCount(source.m_gradientCallCount),
+        m_iterationCount(source.m_iterationCount)
+    {
+      copyArgumentType(source.m_startPoint, this->m_startPoint);
+    }
+
+
+    template <class Functor, class FloatType>
+    OptimizerLBFGS<Functor, FloatType>::
+    ~OptimizerLBFGS()
+    {
+      // Empty
+    }
+
+
+    template<class Functor, class FloatType>
+    void
+    OptimizerLBFGS<Functor, FloatType>::
+    setParameters(size_t historyLength,
+                  size_t iterationLimit,
+                  size_t numberOfRestarts,
+                  FloatType argumentTolerance,
+                  FloatType gradientTolerance,
+                  FloatType lineSearchAlpha,
+                  FloatType lineSearchCurvatureTolerance,
+                  FloatType lineSearchArgumentTolerance,
+                  FloatType maximumStepMagnitudeFactor,
+                  FloatType minimumFunctionValue)
+    {
+      // Copy input arguments.
+      this->m_historyLength = (historyLength == 0) ? 1 : historyLength;
+      this->m_iterationLimit = iterationLimit;
+      this->m_numberOfRestarts = numberOfRestarts;
+      this->m_argumentTolerance = argumentTolerance;
+      this->m_gradientTolerance = gradientTolerance;
+      this->m_lineSearchAlpha = lineSearchAlpha;
+      this->m_lineSearchCurvatureTolerance = lineSearchCurvatureTolerance;
+      this->m_lineSearchArgumentTolerance = lineSearchArgumentTolerance;
+      this->m_maximumStepMagnitudeFactor = maximumStepMagnitudeFactor;
+      this->m_minimumFunctionValue = minimumFunctionValue;
+
+      // Reset memory of previous minimization.
+      this->m_functionCallCount.clear();
+      this->m_gradientCallCount.clear();
+      this->m_iterationCount.clear();
+
+      // We've changed the parameters, so we'll have to rerun the
+      // optimization.  Indicate this by setting the inherited member
+      // m_needsOptimization.
+      Optimizer<Functor>::m_needsOptimization = true;
+    }
+
+
+    template<class Functor, class FloatType>
+    void
+    OptimizerLBFGS<Functor, FloatType>::
+    setStartPoint(const typename Functor::argument_type& startPoint)
+    {
+      copyArgumentType(startPoint, this->m_startPoint);
+
+      // Reset memory of previous minimization.
+      this->m_functionCallCount.clear();
+      this->m_gradientCallCount.clear();
+      this->m_iterationCount.clear();
+
+      // We've changed the parameters, so we'll have to rerun the
+      // optimization.  Indicate this by setting the inherited member
+      // m_needsOptimization.
+      Optimizer<Functor>::m_needsOptimization = true;
+    }
+
+
+    template<class Functor, class FloatType>
+    OptimizerLBFGS<Functor, FloatType>&
+    OptimizerLBFGS<Functor, FloatType>::
+    operator=(const OptimizerLBFGS<Functor, FloatType>& source)
+    {
+      Optimizer<Functor>::operator=(source);
+      this->m_argumentTolerance = source.m_argumentTolerance;
+      this->m_gradientTolerance = source.m_gradientTolerance;
+      this->m_historyLength = source.m_historyLength;
+      this->m_iterationLimit = source.m_iterationLimit;
+      this->m_lineSearchAlpha = source.m_lineSearchAlpha;
+      this->m_lineSearchArgumentTolerance = source.m_lineSearchArgumentTolerance;
+      this->m_lineSearchCurvatureTolerance =
+        source.m_lineSearchCurvatureTolerance;
+      this->m_maximumStepMagnitudeFactor = source.m_maximumStepMagnitudeFactor;
+      this->m_minimumFunctionValue = source.m_minimumFunctionValue;
+      this->m_numberOfRestarts = source.m_numberOfRestarts;
+      this->m_optimizerLineSearch = source.m_optimizerLineSearch;
+      copyArgumentType(source.m_startPoint, this->m_startPoint);
+      this->m_verbosity = source.m_verbosity;
+
+      this->m_functionCallCount = source.m_functionCallCount;
+      this->m_gradientCallCount = source.m_gradientCallCount;
+      this->m_iterationCount = source.m_iterationCount;
+
+      return *this;
+    }
+
+
+    // =============== Protected member functions below =============== //
+
+    template <class Functor, class FloatType>
+    FloatType
+    OptimizerLBFGS<Functor, FloatType>::
+    gradientConvergenceMetric(const argument_type& theta,
+                              const result_type& value,
+                              const argument_type& gradient)
+    {
+      FloatType returnValue = 0.0;
+      FloatType denominator = static_cast<FloatType>(
+        std::max(value, static_cast<result_type>(1.0)));
+      for(size_t index = 0; index < theta.size(); ++index) {
+        FloatType thetaAbsValue = brick::common::absoluteValue(theta[index]);
+        FloatType gradientAbsValue =
+          brick::common::absoluteValue(gradient[index]);
+        FloatType candidate =
+          gradientAbsValue
+          * std::max(thetaAbsValue, static_cast<FloatType>(1.0))
+          / denominator;
+
+        if(candidate > returnValue) {
+          returnValue = candidate;
+        }
+      }
+      return returnValue;
+    }
+
+
+    template <class Functor, class FloatType>
+    std::pair<typename Functor::argument_type, typename Functor::result_type>
+    OptimizerLBFGS<Functor, FloatType>::
+    run()
+    {
+      // Check that we have a valid startPoint.
+      if(this->m_startPoint.size() == 0) {
+        BRICK_THROW(brick::common::StateException,
+                    "OptimizerLBFGS<Functor, FloatType>::run()",
+                    "startPoint has not been initialized.");
+      }
+
+      // Initialize working location so that we start at the right place.
+      argument_type theta(this->m_startPoint.size());
+      copyArgumentType(this->m_startPoint, theta);
+
+      // Compute initial values of function and its gradient.
+      result_type startValue = this->m_functor(theta);
+      argument_type startGradient = this->m_functor.gradient(theta);
+
+      // Now run the optimization.
+      this->m_functionCallCount.clear();
+      this->m_gradientCallCount.clear();
+      this->m_iterationCount.clear();
+      size_t functionCallCount;
+      size_t gradientCallCount;
+      size_t iterationCount;
+      brick::common::Triple<argument_type, result_type, argument_type>
+        optimum_optimalValue_gradient =
+        this->doLbfgs(theta, startValue, startGradient, functionCallCount,
+                      gradientCallCount, iterationCount);
+      // When accounting function calls, don't forget to add the initial
+      // function and gradient evaluations above.
+      this->m_functionCallCount.push_back(functionCallCount + 1);
+      this->m_gradientCallCount.push_back(gradientCallCount + 1);
+      this->m_iterationCount.push_back(iterationCount);
+
+      // Restart as many times as requested.
+      for(size_t index = 0; index < this->m_numberOfRestarts; ++index) {
+        copyArgumentType(optimum_optimalValue_gradient.first, theta);
+        startValue = optimum_optimalValue_gradient.second;
+        copyArgumentType(optimum_optimalValue_gradient.third,
+                         startGradient);
+        optimum_optimalValue_gradient =
+          this->doLbfgs(theta, startValue, startGradient, functionCallCount,
+                        gradientCallCount, iterationCount);
+        this->m_functionCallCount.push_back(functionCallCount);
+        this->m_gradientCallCount.push_back(gradientCallCount);
+        this->m_iterationCount.push_back(iterationCount);
+      }
+
+      return std::make_pair(optimum_optimalValue_gradient.first,
+                            optimum_optimalValue_gradient.second);
+    }
+
+
+    template <class Functor, class FloatType>
+    brick::common::Triple<typename Functor::argument_type,
+                          typename Functor::result_type,
+                          typename Functor::argument_type>
+    OptimizerLBFGS<Functor, FloatType>::
+    doLbfgs(const argument_type& theta,
+            const result_type& startValue,
+            const argument_type& startGradient,
+            size_t& numberOfFunctionCalls,
+            size_t& numberOfGradientCalls,
+            size_t& numberOfIterations)
+    {
+      // Basic initializations.
+      size_t dimensionality = theta.size();
+      numberOfFunctionCalls = 0;
+      numberOfGradientCalls = 0;
+      numberOfIterations = 0;
+
+      // We'll need non-const versions of the input arguments.
+      argument_type thetaLocal(theta.size());
+      copyArgumentType(theta, thetaLocal);
+      result_type currentValue = startValue;
+      argument_type currentGradient;
+      if(startGradient.size() != 0) {
+        copyArgumentType(startGradient, currentGradient);
+      } else {
+        currentGradient = this->m_functor.gradient(thetaLocal);
+        ++numberOfGradientCalls;
+      }
+      if(currentValue <= this->m_minimumFunctionValue) {
+        return brick::common::makeTriple(
+          thetaLocal, currentValue, currentGradient);
+      }
+
+      // Check that gradient dimension is correct.
+      if(currentGradient.size() != dimensionality) {
+        std::ostringstream message;
+        message << "startPoint has dimensionality " << dimensionality
+                << " but objective function returns gradient with "
+                << "dimensionality " << currentGradient.size() << ".";
+        BRICK_THROW(brick::common::ValueException,
+                    "OptimizerLBFGS<Functor, FloatType>::doLbfgs()",
+                    message.str().c_str());
+      }
+
+      // If gradient magnitude is zero, we're already at an extremum or
+      // a saddle point.  In either case, we don't know which way to go.
+      FloatType gradientMagnitude = brick::common::squareRoot(
+        dotArgumentType<argument_type, FloatType>(
+          currentGradient, currentGradient));
+      if(gradientMagnitude == static_cast<FloatType>(0)) {
+        if(this->m_verbosity > 0) {
+          std::cout << "\nTerminating OptimizerLBFGS::doLbfgs() with "
+                    << "zero gradient" << std::endl;
+        }
+        return brick::common::makeTriple(
+          thetaLocal, currentValue, currentGradient);
+      }
+
+      // Circular history of the most recent steps (s), the
+      // corresponding changes in gradient (y), and 1 / (y . s).
+      privateCode::LBFGSHistory<FloatType> history(
+        this->m_historyLength, dimensionality);
+      brick::numeric::Array1D<FloatType> direction(dimensionality);
+
+      // The first step is along the negative gradient, with unit
+      // length.  The line search will stretch or shrink it as needed.
+      argument_type searchStep(dimensionality);
+      for(size_t index = 0; index < dimensionality; ++index) {
+        searchStep[index] = -(currentGradient[index]) / gradientMagnitude;
+      }
+
+      // Compute maximum allowable step size, allowing for numerical issues.
+      FloatType thetaMagnitude = brick::common::squareRoot(
+        dotArgumentType<argument_type, FloatType>(thetaLocal, thetaLocal));
+      FloatType maximumStepMagnitude =
+        (this->m_maximumStepMagnitudeFactor
+         * std::max(thetaMagnitude, static_cast<FloatType>(dimensionality)));
+
+      // Make sure line search optimizer has the right objective
+      // function, since optimizer::setObjectiveFunction() doesn't
+      // update m_optimizerLineSearch.
+      this->m_optimizerLineSearch.setObjectiveFunction(this->m_functor);
+      this->m_optimizerLineSearch.setParameters(
+        this->m_lineSearchArgumentTolerance, this->m_lineSearchAlpha,
+        maximumStepMagnitude, this->m_lineSearchCurvatureTolerance);
+
+      // Perform the L-BFGS iteration.
+      while(1) {
+        // Perform line search.
+        this->m_optimizerLineSearch.setStartPoint(thetaLocal, currentValue,
+                                                  currentGradient);
+        this->m_optimizerLineSearch.setInitialStep(searchStep);
+        argument_type thetaNew = this->m_optimizerLineSearch.optimum();
+        result_type newValue = this->m_optimizerLineSearch.optimalValue();
+        argument_type newGradient =
+          this->m_optimizerLineSearch.getOptimalGradient();
+        numberOfFunctionCalls +=
+          this->m_optimizerLineSearch.getNumberOfFunctionCalls();
+        numberOfGradientCalls +=
+          this->m_optimizerLineSearch.getNumberOfGradientCalls();
+
+        if(this->m_verbosity > 1) {
+          std::cout << "\rCalls: " << std::setw(10) << numberOfFunctionCalls
+                    << ", " << std::setw(10) << numberOfGradientCalls
+                    << "     Current value: "
+                    << std::setw(15) << newValue << std::flush;
+        }
+
+        // Record the step, and update current position in parameter
+        // space.
+        for(size_t index = 0; index < dimensionality; ++index) {
+          searchStep[index] = thetaNew[index] - thetaLocal[index];
+          thetaLocal[index] = thetaNew[index];
+        }
+        currentValue = newValue;
+
+        // Test for adequately small objective value.
+        if(currentValue <= this->m_minimumFunctionValue) {
+          if(this->m_verbosity > 0) {
+            std::cout << "\nTerminating OptimizerLBFGS::doLbfgs() with "
+                      << "objective value (" << currentValue
+                      << ") less than or equal to threshold ("
+                      << this->m_minimumFunctionValue
+                      << ")." << std::endl;
+          }
+          return brick::common::makeTriple(
+            thetaLocal, currentValue, newGradient);
+        }
+
+        // Test for "insufficient parameter change" convergence.  If
+        // the step history led us astray, try once more using
+        // steepest descent before giving up.
+        if(contextSensitiveScale<argument_type, FloatType>(
+             searchStep, thetaLocal) < this->m_argumentTolerance) {
+          if(history.size() != 0) {
+            history.clear();
+            copyArgumentType(newGradient, currentGradient);
+            gradientMagnitude = brick::common::squareRoot(
+              dotArgumentType<argument_type, FloatType>(
+                currentGradient, currentGradient));
+            if(gradientMagnitude == static_cast<FloatType>(0)) {
+              if(this->m_verbosity > 0) {
+                std::cout << "\nTerminating OptimizerLBFGS::doLbfgs() with "
+                          << "zero gradient" << std::endl;
+              }
+              return brick::common::makeTriple(
+                thetaLocal, currentValue, currentGradient);
+            }
+            for(size_t index = 0; index < dimensionality; ++index) {
+              searchStep[index] =
+                -(currentGradient[index]) / gradientMagnitude;
+            }
+            continue;
+          }
+          if(this->m_verbosity > 0) {
+            std::cout << "\nTerminating OptimizerLBFGS::doLbfgs() with "
+                      << "search step magnitude ("
+                      << dotArgumentType<argument_type, FloatType>(
+                        searchStep, searchStep)
+                      << ") small compared to argument magnitude ("
+                      << dotArgumentType<argument_type, FloatType>(
+                        thetaLocal, thetaLocal)
+                      << ")." << std::endl;
+          }
+          return brick::common::makeTriple(
+            thetaLocal, currentValue, newGradient);
+        }
+
+        // Sanity check
+        if(newGradient.size() != dimensionality) {
+          std::ostringstream message;
+          message << "dimensionality of gradient changed mid-stream from "
+                  << dimensionality << " to " << newGradient.size() << ".";
+          BRICK_THROW(brick::common::RunTimeException,
+                      "OptimizerLBFGS<Functor, FloatType>::doLbfgs()",
+                      message.str().c_str());
+        }
+
+        // Test for "small gradient" convergence.  An exactly zero
+        // gradient counts even if m_gradientTolerance is zero, since
+        // it would leave us with no search direction.
+        FloatType gradientMetric = this->gradientConvergenceMetric(
+          thetaLocal, currentValue, newGradient);
+        if(gradientMetric < this->m_gradientTolerance
+           || gradientMetric == static_cast<FloatType>(0)) {
+          if(this->m_verbosity > 0) {
+            std::cout << "\nTerminating OptimizerLBFGS::doLbfgs() with "
+                      << "small gradient." << std::endl;
+          }
+          return brick::common::makeTriple(
+            thetaLocal, currentValue, newGradient);
+        }
+
+        // Add the new step to the history (unless its curvature is
+        // not positive), then compute -H * gradient, where H is the
+        // limited memory inverse Hessian estimate.
+        history.addPair(searchStep, newGradient, currentGradient);
+        copyArgumentType(newGradient, currentGradient);
+        history.applyInverseHessian(currentGradient, direction);
+        for(size_t index = 0; index < dimensionality; ++index) {
+          searchStep[index] = -(direction[index]);
+        }
+
+        // Check for convergence failure.
+        ++numberOfIterations;
+        if(numberOfIterations > this->m_iterationLimit) {
+          // We're going to bail out, but save the result anyway, just
+          // in case someone cares.
+          this->setOptimum(thetaLocal, currentValue, false);
+
+          // Now throw the exception.
+          std::ostringstream message;
+          message << "Iteration limit of " << this->m_iterationLimit
+                  << " exceeded.";
+          BRICK_THROW(brick::common::RunTimeException,
+                      "OptimizerLBFGS<Functor, FloatType>::doLbfgs()",
+                      message.str().c_str());
+        }
+      }
+    }
+
+  } // namespace optimization
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_OPTIMIZATION_OPTIMIZERLBFGS_HH */
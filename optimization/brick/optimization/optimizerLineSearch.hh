@@ -279,10 +279,10 @@ namespace brick {
     OptimizerLineSearch(const OptimizerLineSearch& source)
       : Optimizer<Functor>(source),
         m_alpha(source.m_alpha),
-        m_argumentTolerance(source.argumentTolerance),
+        m_argumentTolerance(source.m_argumentTolerance),
         m_functionCallCount(source.m_functionCallCount),
         m_initialStep(source.m_initialStep.size()),
-        m_initialStepMagnitude(source.initialStepMagnitude),
+        m_initialStepMagnitude(source.m_initialStepMagnitude),
         m_maximumStepMagnitude(source.m_maximumStepMagnitude),
         m_startGradient(source.m_startGradient.size()),
         m_startPoint(source.m_startPoint.size()),
@@ -0,0 +1,605 @@
+/**
+***************************************************************************
+* @file brick/optimization/optimizerLineSearchMoreThuente.hh
+*
+* Header file declaring OptimizerLineSearchMoreThuente class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_OPTIMIZATION_OPTIMIZERLINESEARCHMORETHUENTE_HH
+#define BRICK_OPTIMIZATION_OPTIMIZERLINESEARCHMORETHUENTE_HH
+
+#include <brick/optimization/optimizerLineSearch.hh>
+
+namespace brick {
+
+  namespace optimization {
+
+    /**
+     ** OptimizerLineSearchMoreThuente implements the line search
+     ** algorithm of Moré and Thuente [1], which finds a step along the
+     ** search direction that satisfies the strong Wolfe conditions:
+     ** sufficient decrease (controlled by the alpha parameter, just
+     ** as in OptimizerLineSearch), and a reduction in the magnitude of
+     ** the directional derivative (controlled by the
+     ** curvatureTolerance parameter).  The second condition is what
+     ** quasi-Newton methods need to keep their curvature estimates
+     ** positive definite, so this line search is the one used by
+     ** OptimizerLBFGS.
+     **
+     ** Unlike OptimizerLineSearch, this class evaluates the gradient
+     ** at each trial point.  The gradient at the accepted point is
+     ** kept, and can be retrieved using getOptimalGradient(), so the
+     ** caller need not recompute it.
+     **
+     ** The start point and initial step are set exactly as for
+     ** OptimizerLineSearch.  The first trial point is startPoint +
+     ** initialStep (after limiting the step to maximumStepMagnitude),
+     ** and the search will never step further than
+     ** maximumStepMagnitude from the start point.
+     **
+     ** [1] J. J. Moré and D. J. Thuente, Line Search Algorithms with
+     ** Guaranteed Sufficient Decrease, ACM Transactions on
+     ** Mathematical Software, 20(3):286-307, 1994.
+     **/
+    template <class Functor, class FloatType = double>
+    class OptimizerLineSearchMoreThuente
+      : public OptimizerLineSearch<Functor, FloatType>
+    {
+    public:
+      // Typedefs for convenience
+      typedef typename Functor::argument_type argument_type;
+      typedef typename Functor::result_type result_type;
+
+      /**
+       * Default constructor sets parameters to reasonable values for
+       * functions which take values and arguments in the "normal" range
+       * of 0 to 100 or so.
+       */
+      OptimizerLineSearchMoreThuente();
+
+      /**
+       * Constructor which specifies the specific Functor instance to
+       * use.
+       *
+       * @param functor A copy of this argument will be stored
+       * internally for use in optimization.
+       */
+      explicit OptimizerLineSearchMoreThuente(const Functor& functor);
+
+      /**
+       * Destructor.
+       */
+      virtual
+      ~OptimizerLineSearchMoreThuente() {}
+
+      /**
+       * If a valid minimization result is available, this method
+       * returns the number of gradient calls required to produce that
+       * result.  If no valid minimization result is available, the
+       * return value is 0.
+       *
+       * @return The number of gradient calls spent in the last
+       * minimization, or 0.
+       */
+      size_t
+      getNumberOfGradientCalls() {return this->m_gradientCallCount;}
+
+      /**
+       * This method runs the line search, if necessary, and returns
+       * the objective function gradient at the point returned by
+       * optimum().
+       *
+       * @return The gradient at the accepted point.
+       */
+      argument_type
+      getOptimalGradient();
+
+      /**
+       * Sets the line search parameters.  Default values are
+       * reasonable for functions which take values and arguments in
+       * the "normal" range of 0 to 100 or so.
+       *
+       * @param argumentTolerance The search will terminate when the
+       * interval of uncertainty becomes smaller than this fraction of
+       * the current step, or when the step would become smaller than
+       * a threshold which is linearly related to this factor.
+       *
+       * @param alpha This argument specifies how much the function
+       * value must decrease, relative to the initial slope, for a step
+       * to be accepted.
+       *
+       * @param maximumStepMagnitude Sets the maximum distance the
+       * search may move from the start point.
+       *
+       * @param curvatureTolerance This argument specifies how much the
+       * magnitude of the directional derivative must decrease for a
+       * step to be accepted.  It must be larger than alpha.  Values
+       * near 0.9 are appropriate for quasi-Newton methods, and values
+       * near 0.1 give a more exact line search.
+       *
+       * @param iterationLimit The search will terminate after this
+       * many function evaluations, returning the best point found so
+       * far.
+       */
+      void
+      setParameters(FloatType argumentTolerance = 1.0e-7,
+                    FloatType alpha = 1.0e-4,
+                    FloatType maximumStepMagnitude = 100.0,
+                    FloatType curvatureTolerance = 0.9,
+                    size_t iterationLimit = 20);
+
+    protected:
+
+      /**
+       * Perform the minimization.  This overrides
+       * OptimizerLineSearch<Functor>::run().
+       *
+       * @return A std::pair of the vector parameter which brings the
+       * specified Functor to a point satisfying the strong Wolfe
+       * conditions, and the corresponding Functor value.
+       */
+      std::pair<typename Functor::argument_type, typename Functor::result_type>
+      run();
+
+      /**
+       * This protected member function computes one safeguarded step
+       * of the Moré-Thuente search, updating the interval of
+       * uncertainty [stepX, stepY] and choosing a new trial step.
+       * Arguments are named as in the reference implementation.
+       */
+      void
+      updateStep(FloatType& stepX, FloatType& valueX, FloatType& slopeX,
+                 FloatType& stepY, FloatType& valueY, FloatType& slopeY,
+                 FloatType& step, FloatType value, FloatType slope,
+                 bool& isBracketed, FloatType stepMinimum,
+                 FloatType stepMaximum);
+
+      // Data members
+      FloatType m_curvatureTolerance;
+      size_t m_gradientCallCount;
+      size_t m_iterationLimit;
+      argument_type m_optimalGradient;
+
+    }; // class OptimizerLineSearchMoreThuente
+
+  } // namespace optimization
+
+} // namespace brick
+
+
+/*******************************************************************
+ * Member function definitions follow.  This would be a .cpp file
+ * if it weren't templated.
+ *******************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <brick/common/exception.hh>
+#include <brick/optimization/optimizerCommon.hh>
+
+namespace brick {
+
+  namespace optimization {
+
+    template <class Functor, class FloatType>
+    OptimizerLineSearchMoreThuente<Functor, FloatType>::
+    OptimizerLineSearchMoreThuente()
+      : OptimizerLineSearch<Functor, FloatType>(),
+        m_curvatureTolerance(0.0),
+        m_gradientCallCount(0),
+        m_iterationLimit(0),
+        m_optimalGradient()
+    {
+      this->setParameters();
+    }
+
+
+    template <class Functor, class FloatType>
+    OptimizerLineSearchMoreThuente<Functor, FloatType>::
+    OptimizerLineSearchMoreThuente(const Functor& functor)
+      : OptimizerLineSearch<Functor, FloatType>(functor),
+        m_curvatureTolerance(0.0),
+        m_gradientCallCount(0),
+        m_iterationLimit(0),
+        m_optimalGradient()
+    {
+      this->setParameters();
+    }
+
+
+    template <class Functor, class FloatType>
+    typename OptimizerLineSearchMoreThuente<Functor, FloatType>::argument_type
+    OptimizerLineSearchMoreThuente<Functor, FloatType>::
+    getOptimalGradient()
+    {
+      // Make sure the search has been run.
+      this->getOptimum();
+      return this->m_optimalGradient;
+    }
+
+
+    template <class Functor, class FloatType>
+    void
+    OptimizerLineSearchMoreThuente<Functor, FloatType>::
+    setParameters(FloatType argumentTolerance,
+                  FloatType alpha,
+                  FloatType maximumStepMagnitude,
+                  FloatType curvatureTolerance,
+                  size_t iterationLimit)
+    {
+      if(alpha <= static_cast<FloatType>(0.0)
+         || curvatureTolerance <= alpha
+         || curvatureTolerance >= static_cast<FloatType>(1.0)) {
+        BRICK_THROW(brick::common::ValueException,
+                    "OptimizerLineSearchMoreThuente::setParameters()",
+                    "Arguments must satisfy "
+                    "0 < alpha < curvatureTolerance < 1.");
+      }
+      OptimizerLineSearch<Functor, FloatType>::setParameters(
+        argumentTolerance, alpha, maximumStepMagnitude);
+      this->m_curvatureTolerance = curvatureTolerance;
+      this->m_iterationLimit = iterationLimit;
+      this->m_gradientCallCount = 0;
+    }
+
+
+    template <class Functor, class FloatType>
+    std::pair<typename Functor::argument_type, typename Functor::result_type>
+    OptimizerLineSearchMoreThuente<Functor, FloatType>::
+    run()
+    {
+      // Constants from the reference implementation.
+      FloatType const extrapolationLower = 1.1;
+      FloatType const extrapolationUpper = 4.0;
+
+      this->checkState();
+      this->m_functionCallCount = 0;
+      this->m_gradientCallCount = 0;
+
+      // Restrict length of initial step, just as OptimizerLineSearch
+      // does.
+      argument_type direction;
+      copyArgumentType(this->m_initialStep, direction);
+      FloatType directionMagnitude = this->m_initialStepMagnitude;
+      if(directionMagnitude > this->m_maximumStepMagnitude) {
+        for(size_t index = 0; index < direction.size(); ++index) {
+          direction[index] *=
+            this->m_maximumStepMagnitude / this->m_initialStepMagnitude;
+        }
+        directionMagnitude = this->m_maximumStepMagnitude;
+      }
+
+      FloatType initialSlope = dotArgumentType<argument_type, FloatType>(
+        this->m_startGradient, direction);
+      if(initialSlope >= static_cast<FloatType>(0.0)) {
+        std::ostringstream message;
+        message << "Initial search direction: " << direction << " "
+                << "is not downhill with respect to initial gradient: "
+                << this->m_startGradient << ".";
+        BRICK_THROW(brick::common::StateException,
+                    "OptimizerLineSearchMoreThuente::run()",
+                    message.str().c_str());
+      }
+
+      FloatType scale = contextSensitiveScale<argument_type, FloatType>(
+        direction, this->m_startPoint);
+      if(scale == static_cast<FloatType>(0.0)) {
+        BRICK_THROW(brick::common::RunTimeException,
+                    "OptimizerLineSearchMoreThuente::run()",
+                    "Invalid initial scale.  "
+                    "Perhaps initialStep is the zero vector.");
+      }
+      FloatType const stepMinimum = this->m_argumentTolerance / scale;
+      FloatType const stepMaximum =
+        this->m_maximumStepMagnitude / directionMagnitude;
+      FloatType const initialValue =
+        static_cast<FloatType>(this->m_startValue);
+      FloatType const sufficientSlope = this->m_alpha * initialSlope;
+
+      // The best point found so far.  If nothing better turns up,
+      // we'll return the start point, just as OptimizerLineSearch
+      // does.
+      argument_type bestPoint;
+      copyArgumentType(this->m_startPoint, bestPoint);
+      result_type bestValue = this->m_startValue;
+      copyArgumentType(this->m_startGradient, this->m_optimalGradient);
+
+      // State of the search.  Variables with suffix X describe the
+      // best step so far, and those with suffix Y describe the other
+      // end of the interval of uncertainty.
+      bool isBracketed = false;
+      bool isFirstStage = true;
+      FloatType width = stepMaximum - stepMinimum;
+      FloatType previousWidth = 2.0 * width;
+      FloatType stepX = 0.0;
+      FloatType valueX = initialValue;
+      FloatType slopeX = initialSlope;
+      FloatType stepY = 0.0;
+      FloatType valueY = initialValue;
+      FloatType slopeY = initialSlope;
+      FloatType intervalMinimum = 0.0;
+      FloatType intervalMaximum = 1.0 + extrapolationUpper;
+      FloatType step = std::min(static_cast<FloatType>(1.0), stepMaximum);
+
+      argument_type trialPoint(direction.size());
+      for(size_t iteration = 0; iteration < this->m_iterationLimit;
+          ++iteration) {
+        // Evaluate the function and its directional derivative at
+        // the trial step.
+        for(size_t index = 0; index < direction.size(); ++index) {
+          trialPoint[index] =
+            this->m_startPoint[index] + step * direction[index];
+        }
+        result_type trialValue = this->m_functor(trialPoint);
+        ++(this->m_functionCallCount);
+        argument_type trialGradient = this->m_functor.gradient(trialPoint);
+        ++(this->m_gradientCallCount);
+        FloatType value = static_cast<FloatType>(trialValue);
+        FloatType slope = dotArgumentType<argument_type, FloatType>(
+          trialGradient, direction);
+
+        if(trialValue < bestValue) {
+          copyArgumentType(trialPoint, bestPoint);
+          bestValue = trialValue;
+          copyArgumentType(trialGradient, this->m_optimalGradient);
+        }
+
+        // Test for convergence, and for the various ways the search
+        // can stall.
+        FloatType sufficientValue = initialValue + step * sufficientSlope;
+        if(isFirstStage && value <= sufficientValue
+           && slope >= static_cast<FloatType>(0.0)) {
+          isFirstStage = false;
+        }
+        bool isSufficientDecrease = (value <= sufficientValue);
+        if(isSufficientDecrease
+           && (brick::common::absoluteValue(slope)
+               <= -(this->m_curvatureTolerance * initialSlope))) {
+          // Strong Wolfe conditions hold.
+          copyArgumentType(trialGradient, this->m_optimalGradient);
+          return std::make_pair(trialPoint, trialValue);
+        }
+        if((isBracketed
+            && (step <= intervalMinimum || step >= intervalMaximum
+                || (intervalMaximum - intervalMinimum
+                    <= this->m_argumentTolerance * intervalMaximum)))
+           || (step == stepMaximum && isSufficientDecrease
+               && slope <= sufficientSlope)
+           || (step == stepMinimum
+               && (!isSufficientDecrease || slope >= sufficientSlope))) {
+          break;
+        }
+
+        // Choose the next trial step.  In the first stage, the
+        // search works on a modified function that is shifted so that
+        // the sufficient decrease line is horizontal.
+        if(isFirstStage && value <= valueX && value > sufficientValue) {
+          FloatType modifiedValueX = valueX - stepX * sufficientSlope;
+          FloatType modifiedSlopeX = slopeX - sufficientSlope;
+          FloatType modifiedValueY = valueY - stepY * sufficientSlope;
+          FloatType modifiedSlopeY = slopeY - sufficientSlope;
+          this->updateStep(stepX, modifiedValueX, modifiedSlopeX,
+                           stepY, modifiedValueY, modifiedSlopeY,
+                           step, value - step * sufficientSlope,
+                           slope - sufficientSlope,
+                           isBracketed, intervalMinimum, intervalMaximum);
+          valueX = modifiedValueX + stepX * sufficientSlope;
+          slopeX = modifiedSlopeX + sufficientSlope;
+          valueY = modifiedValueY + stepY * sufficientSlope;
+          slopeY = modifiedSlopeY + sufficientSlope;
+        } else {
+          this->updateStep(stepX, valueX, slopeX, stepY, valueY, slopeY,
+                           step, value, slope,
+                           isBracketed, intervalMinimum, intervalMaximum);
+        }
+
+        // Force a sufficient reduction in the size of the interval.
+        if(isBracketed) {
+          FloatType newWidth = brick::common::absoluteValue(stepY - stepX);
+          if(newWidth >= 0.66 * previousWidth) {
+            step = stepX + 0.5 * (stepY - stepX);
+          }
+          previousWidth = width;
+          width = newWidth;
+        }
+
+        // Update the bounds on the next step.
+        if(isBracketed) {
+          intervalMinimum = std::min(stepX, stepY);
+          intervalMaximum = std::max(stepX, stepY);
+        } else {
+          intervalMinimum = step + extrapolationLower * (step - stepX);
+          intervalMaximum = step + extrapolationUpper * (step - stepX);
+        }
+        step = std::max(step, stepMinimum);
+        step = std::min(step, stepMaximum);
+
+        // If no further progress can be made, go back to the best
+        // step so far.
+        if(isBracketed
+           && (step <= intervalMinimum || step >= intervalMaximum
+               || (intervalMaximum - intervalMinimum
+                   <= this->m_argumentTolerance * intervalMaximum))) {
+          step = stepX;
+        }
+      }
+
+      // Didn't converge.  Return the best point we found.
+      return std::make_pair(bestPoint, bestValue);
+    }
+
+
+    template <class Functor, class FloatType>
+    void
+    OptimizerLineSearchMoreThuente<Functor, FloatType>::
+    updateStep(FloatType& stepX, FloatType& valueX, FloatType& slopeX,
+               FloatType& stepY, FloatType& valueY, FloatType& slopeY,
+               FloatType& step, FloatType value, FloatType slope,
+               bool& isBracketed, FloatType stepMinimum,
+               FloatType stepMaximum)
+    {
+      FloatType signTest =
+        slope * ((slopeX < static_cast<FloatType>(0.0)) ? -1.0 : 1.0);
+      FloatType newStep;
+
+      if(value > valueX) {
+        // Case 1: higher function value.  The minimum is bracketed.
+        // Take the cubic step if it's closer to stepX than the
+        // quadratic step, otherwise take the average.
+        FloatType theta =
+          3.0 * (valueX - value) / (step - stepX) + slopeX + slope;
+        FloatType ss = std::max(
+          brick::common::absoluteValue(theta),
+          std::max(brick::common::absoluteValue(slopeX),
+                   brick::common::absoluteValue(slope)));
+        FloatType gamma = ss * brick::common::squareRoot(
+          std::max(static_cast<FloatType>(0.0),
+                   (theta / ss) * (theta / ss) - (slopeX / ss) * (slope / ss)));
+        if(step < stepX) {gamma = -gamma;}
+        FloatType pp = (gamma - slopeX) + theta;
+        FloatType qq = ((gamma - slopeX) + gamma) + slope;
+        FloatType cubicStep = stepX + (pp / qq) * (step - stepX);
+        FloatType quadraticStep =
+          stepX + ((slopeX / ((valueX - value) / (step - stepX) + slopeX))
+                   / 2.0) * (step - stepX);
+        if(brick::common::absoluteValue(cubicStep - stepX)
+           < brick::common::absoluteValue(quadraticStep - stepX)) {
+          newStep = cubicStep;
+        } else {
+          newStep = cubicStep + (quadraticStep - cubicStep) / 2.0;
+        }
+        isBracketed = true;
+      } else if(signTest < static_cast<FloatType>(0.0)) {
+        // Case 2: lower function value and derivatives of opposite
+        // sign.  The minimum is bracketed.  Take whichever of the
+        // cubic and secant steps is farther from step.
+        FloatType theta =
+          3.0 * (valueX - value) / (step - stepX) + slopeX + slope;
+        FloatType ss = std::max(
+          brick::common::absoluteValue(theta),
+          std::max(brick::common::absoluteValue(slopeX),
+                   brick::common::absoluteValue(slope)));
+        FloatType gamma = ss * brick::common::squareRoot(
+          std::max(static_cast<FloatType>(0.0),
+                   (theta / ss) * (theta / ss) - (slopeX / ss) * (slope / ss)));
+        if(step > stepX) {gamma = -gamma;}
+        FloatType pp = (gamma - slope) + theta;
+        FloatType qq = ((gamma - slope) + gamma) + slopeX;
+        FloatType cubicStep = step + (pp / qq) * (stepX - step);
+        FloatType secantStep = step + (slope / (slope - slopeX)) * (stepX - step);
+        if(brick::common::absoluteValue(cubicStep - step)
+           > brick::common::absoluteValue(secantStep - step)) {
+          newStep = cubicStep;
+        } else {
+          newStep = secantStep;
+        }
+        isBracketed = true;
+      } else if(brick::common::absoluteValue(slope)
+                < brick::common::absoluteValue(slopeX)) {
+        // Case 3: lower function value, derivatives of the same sign,
+        // and the magnitude of the derivative decreases.  The cubic
+        // step is used only if it heads in the right direction.
+        FloatType theta =
+          3.0 * (valueX - value) / (step - stepX) + slopeX + slope;
+        FloatType ss = std::max(
+          brick::common::absoluteValue(theta),
+          std::max(brick::common::absoluteValue(slopeX),
+                   brick::common::absoluteValue(slope)));
+        FloatType gamma = ss * brick::common::squareRoot(
+          std::max(static_cast<FloatType>(0.0),
+                   (theta / ss) * (theta / ss) - (slopeX / ss) * (slope / ss)));
+        if(step > stepX) {gamma = -gamma;}
+        FloatType pp = (gamma - slope) + theta;
+        FloatType qq = (gamma + (slopeX - slope)) + gamma;
+        FloatType ratio = pp / qq;
+        FloatType cubicStep;
+        if(ratio < static_cast<FloatType>(0.0)
+           && gamma != static_cast<FloatType>(0.0)) {
+          cubicStep = step + ratio * (stepX - step);
+        } else if(step > stepX) {
+          cubicStep = stepMaximum;
+        } else {
+          cubicStep = stepMinimum;
+        }
+        FloatType secantStep = step + (slope / (slope - slopeX)) * (stepX - step);
+        if(isBracketed) {
+          // Take the step closest to step, but don't go too close to
+          // stepY.
+          if(brick::common::absoluteValue(cubicStep - step)
+             < brick::common::absoluteValue(secantStep - step)) {
+            newStep = cubicStep;
+          } else {
+            newStep = secantStep;
+          }
+          if(step > stepX) {
+            newStep = std::min(step + 0.66 * (stepY - step), newStep);
+          } else {
+            newStep = std::max(step + 0.66 * (stepY - step), newStep);
+          }
+        } else {
+          // Take the step farthest from step.
+          if(brick::common::absoluteValue(cubicStep - step)
+             > brick::common::absoluteValue(secantStep - step)) {
+            newStep = cubicStep;
+          } else {
+            newStep = secantStep;
+          }
+          newStep = std::min(stepMaximum, newStep);
+          newStep = std::max(stepMinimum, newStep);
+        }
+      } else {
+        // Case 4: lower function value, derivatives of the same sign,
+        // and the magnitude of the derivative does not decrease.  If
+        // the minimum is not bracketed, step to the end of the
+        // allowed interval.
+        if(isBracketed) {
+          FloatType theta =
+            3.0 * (value - valueY) / (stepY - step) + slopeY + slope;
+          FloatType ss = std::max(
+            brick::common::absoluteValue(theta),
+            std::max(brick::common::absoluteValue(slopeY),
+                     brick::common::absoluteValue(slope)));
+          FloatType gamma = ss * brick::common::squareRoot(
+            std::max(static_cast<FloatType>(0.0),
+                     (theta / ss) * (theta / ss)
+                     - (slopeY / ss) * (slope / ss)));
+          if(step > stepY) {gamma = -gamma;}
+          FloatType pp = (gamma - slope) + theta;
+          FloatType qq = ((gamma - slope) + gamma) + slopeY;
+          newStep = step + (pp / qq) * (stepY - step);
+        } else if(step > stepX) {
+          newStep = stepMaximum;
+        } else {
+          newStep = stepMinimum;
+        }
+      }
+
+      // Update the interval of uncertainty.
+      if(value > valueX) {
+        stepY = step;
+        valueY = value;
+        slopeY = slope;
+      } else {
+        if(signTest < static_cast<FloatType>(0.0)) {
+          stepY = stepX;
+          valueY = valueX;
+          slopeY = slopeX;
+        }
+        stepX = step;
+        valueX = value;
+        slopeX = slope;
+      }
+      step = newStep;
+    }
+
+  } // namespace optimization
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_OPTIMIZATION_OPTIMIZERLINESEARCHMORETHUENTE_HH */
@@ -0,0 +1,427 @@
+/**
+***************************************************************************
+* @file brick/optimization/test/optimizerLBFGSTest.cc
+*
+* Source file defining tests for OptimizerLBFGS,
+* OptimizerLineSearchMoreThuente, and threaded GradientFunction.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <cmath>
+
+#include <brick/optimization/gradientFunction.hh>
+#include <brick/optimization/optimizerLBFGS.hh>
+#include <brick/optimization/optimizerLineSearchMoreThuente.hh>
+
+#include <brick/numeric/array1D.hh>
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace optimization {
+
+    class OptimizerLBFGSTest
+      : public brick::test::TestFixture<OptimizerLBFGSTest> {
+
+    public:
+
+      OptimizerLBFGSTest();
+      ~OptimizerLBFGSTest() {}
+
+      void setUp(const std::string& /* testName */) {}
+      void tearDown(const std::string& /* testName */) {}
+
+      void testGradientFunctionThreaded();
+      void testLBFGSHistoryRejectedPair();
+      void testLineSearchMoreThuente();
+      void testOptimizerLBFGSQuadratic();
+      void testOptimizerLBFGSRosenbrock();
+      void testOptimizerLBFGSZeroGradient();
+
+    private:
+
+      typedef brick::numeric::Array1D<double> VectorType;
+
+      // Implements the extended Rosenbrock function, which has its
+      // minimum (zero) at [1, 1, ..., 1].
+      struct Rosenbrock {
+        typedef VectorType argument_type;
+        typedef double result_type;
+
+        double operator()(VectorType const& theta) {
+          double result = 0.0;
+          for(size_t ii = 0; ii + 1 < theta.size(); ii += 2) {
+            double t0 = theta[ii + 1] - theta[ii] * theta[ii];
+            double t1 = 1.0 - theta[ii];
+            result += 100.0 * t0 * t0 + t1 * t1;
+          }
+          return result;
+        }
+
+        VectorType gradient(VectorType const& theta) {
+          VectorType result(theta.size());
+          result = 0.0;
+          for(size_t ii = 0; ii + 1 < theta.size(); ii += 2) {
+            double t0 = theta[ii + 1] - theta[ii] * theta[ii];
+            result[ii] = -400.0 * theta[ii] * t0 - 2.0 * (1.0 - theta[ii]);
+            result[ii + 1] = 200.0 * t0;
+          }
+          return result;
+        }
+      };
+
+      // Implements sum_i (i + 1) * (x_i - 1)^2, plus a weak coupling
+      // term, with no gradient() member.
+      struct Quadratic {
+        typedef VectorType argument_type;
+        typedef double result_type;
+
+        double operator()(VectorType const& theta) {
+          double result = 0.0;
+          for(size_t ii = 0; ii < theta.size(); ++ii) {
+            double delta = theta[ii] - 1.0;
+            result += (ii % 10 + 1) * delta * delta;
+            if(ii != 0) {
+              double coupling = theta[ii] - theta[ii - 1];
+              result += 0.5 * coupling * coupling;
+            }
+          }
+          return result;
+        }
+      };
+
+      // Implements sum_i max(|x_i| - 1, 0)^2, which is zero, with
+      // exactly zero gradient, everywhere inside the unit cube.
+      struct Plateau {
+        typedef VectorType argument_type;
+        typedef double result_type;
+
+        double operator()(VectorType const& theta) {
+          double result = 0.0;
+          for(size_t ii = 0; ii < theta.size(); ++ii) {
+            double excess = std::max(std::fabs(theta[ii]) - 1.0, 0.0);
+            result += excess * excess;
+          }
+          return result;
+        }
+
+        VectorType gradient(VectorType const& theta) {
+          VectorType result(theta.size());
+          for(size_t ii = 0; ii < theta.size(); ++ii) {
+            double excess = std::max(std::fabs(theta[ii]) - 1.0, 0.0);
+            result[ii] = (theta[ii] < 0.0) ? -2.0 * excess : 2.0 * excess;
+          }
+          return result;
+        }
+      };
+
+      // Builds a 3-element vector.
+      VectorType
+      makeVector(double x0, double x1, double x2) {
+        VectorType result(3);
+        result[0] = x0;
+        result[1] = x1;
+        result[2] = x2;
+        return result;
+      }
+
+      double m_defaultTolerance;
+
+    }; // class OptimizerLBFGSTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    OptimizerLBFGSTest::
+    OptimizerLBFGSTest()
+      : brick::test::TestFixture<OptimizerLBFGSTest>("OptimizerLBFGSTest"),
+        m_defaultTolerance(1.0E-6)
+    {
+      // Register all tests.
+      BRICK_TEST_REGISTER_MEMBER(testGradientFunctionThreaded);
+      BRICK_TEST_REGISTER_MEMBER(testLBFGSHistoryRejectedPair);
+      BRICK_TEST_REGISTER_MEMBER(testLineSearchMoreThuente);
+      BRICK_TEST_REGISTER_MEMBER(testOptimizerLBFGSQuadratic);
+      BRICK_TEST_REGISTER_MEMBER(testOptimizerLBFGSRosenbrock);
+      BRICK_TEST_REGISTER_MEMBER(testOptimizerLBFGSZeroGradient);
+    }
+
+
+    void
+    OptimizerLBFGSTest::
+    testGradientFunctionThreaded()
+    {
+      VectorType theta(37);
+      for(size_t ii = 0; ii < theta.size(); ++ii) {
+        theta[ii] = 0.1 * ii - 1.0;
+      }
+      GradientFunction<Quadratic> serialFunction(Quadratic(), 1.0E-5);
+      VectorType referenceGradient = serialFunction.gradient(theta);
+
+      for(size_t numberOfThreads = 0; numberOfThreads < 5; ++numberOfThreads) {
+        GradientFunction<Quadratic> threadedFunction(
+          Quadratic(), 1.0E-5, numberOfThreads);
+        VectorType gradient = threadedFunction.gradient(theta);
+        BRICK_TEST_ASSERT(gradient.size() == theta.size());
+        for(size_t ii = 0; ii < theta.size(); ++ii) {
+          BRICK_TEST_ASSERT(gradient[ii] == referenceGradient[ii]);
+        }
+      }
+
+      // More threads than parameters should be harmless.
+      VectorType shortTheta(2);
+      shortTheta[0] = 3.0;
+      shortTheta[1] = -2.0;
+      GradientFunction<Quadratic> threadedFunction(Quadratic(), 1.0E-5, 8);
+      VectorType shortGradient = threadedFunction.gradient(shortTheta);
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(shortGradient[0], 2.0 * 2.0 + 5.0, 1.0E-4));
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(shortGradient[1], -2.0 * 6.0 - 5.0, 1.0E-4));
+    }
+
+
+    void
+    OptimizerLBFGSTest::
+    testLBFGSHistoryRejectedPair()
+    {
+      // Fill a short history with two pairs of positive curvature.
+      VectorType zero = this->makeVector(0.0, 0.0, 0.0);
+      privateCode::LBFGSHistory<double> history(2, 3);
+      privateCode::LBFGSHistory<double> referenceHistory(2, 3);
+      VectorType step0 = this->makeVector(1.0, 0.0, 0.0);
+      VectorType gradientChange0 = this->makeVector(2.0, 0.1, 0.0);
+      VectorType step1 = this->makeVector(0.0, 1.0, 0.0);
+      VectorType gradientChange1 = this->makeVector(0.1, 3.0, 0.5);
+      BRICK_TEST_ASSERT(history.addPair(step0, gradientChange0, zero));
+      BRICK_TEST_ASSERT(history.addPair(step1, gradientChange1, zero));
+      referenceHistory.addPair(step0, gradientChange0, zero);
+      referenceHistory.addPair(step1, gradientChange1, zero);
+      BRICK_TEST_ASSERT(history.size() == 2);
+
+      // A step across a non-convex stretch has negative curvature,
+      // and must be rejected without disturbing the oldest pair,
+      // which shares the slot it would have been written to.
+      VectorType step2 = this->makeVector(0.0, 0.0, 1.0);
+      VectorType gradientChange2 = this->makeVector(0.3, 0.2, -1.0);
+      BRICK_TEST_ASSERT(!history.addPair(step2, gradientChange2, zero));
+      BRICK_TEST_ASSERT(history.size() == 2);
+
+      VectorType gradient = this->makeVector(0.5, -1.0, 2.0);
+      brick::numeric::Array1D<double> direction;
+      brick::numeric::Array1D<double> referenceDirection;
+      history.applyInverseHessian(gradient, direction);
+      referenceHistory.applyInverseHessian(gradient, referenceDirection);
+      BRICK_TEST_ASSERT(direction.size() == 3);
+      for(size_t ii = 0; ii < 3; ++ii) {
+        BRICK_TEST_ASSERT(direction[ii] == referenceDirection[ii]);
+      }
+
+      // The next accepted pair should displace the oldest pair, just
+      // as if the rejected pair had never been offered.
+      VectorType step3 = this->makeVector(0.5, 0.5, 1.0);
+      VectorType gradientChange3 = this->makeVector(1.0, 1.0, 2.0);
+      BRICK_TEST_ASSERT(history.addPair(step3, gradientChange3, zero));
+      referenceHistory.addPair(step3, gradientChange3, zero);
+      history.applyInverseHessian(gradient, direction);
+      referenceHistory.applyInverseHessian(gradient, referenceDirection);
+      for(size_t ii = 0; ii < 3; ++ii) {
+        BRICK_TEST_ASSERT(direction[ii] == referenceDirection[ii]);
+      }
+
+      // With no history, the result is a unit steepest descent
+      // direction.
+      history.clear();
+      history.applyInverseHessian(gradient, direction);
+      double norm = std::sqrt(0.25 + 1.0 + 4.0);
+      for(size_t ii = 0; ii < 3; ++ii) {
+        BRICK_TEST_ASSERT(
+          test::approximatelyEqual(direction[ii], gradient[ii] / norm,
+                                   m_defaultTolerance));
+      }
+    }
+
+
+    void
+    OptimizerLBFGSTest::
+    testLineSearchMoreThuente()
+    {
+      VectorType startPoint(2);
+      startPoint[0] = -1.2;
+      startPoint[1] = 1.0;
+      Rosenbrock function;
+      double startValue = function(startPoint);
+      VectorType startGradient = function.gradient(startPoint);
+
+      // Try a range of initial step lengths, from far too short to
+      // far too long.  The result should satisfy the strong Wolfe
+      // conditions every time.
+      double const alpha = 1.0E-4;
+      double const curvatureTolerance = 0.1;
+      double const stepScales[] = {1.0E-4, 1.0E-2, 1.0, 100.0};
+      for(size_t ii = 0; ii < 4; ++ii) {
+        VectorType initialStep(2);
+        for(size_t jj = 0; jj < 2; ++jj) {
+          initialStep[jj] = -stepScales[ii] * startGradient[jj];
+        }
+        OptimizerLineSearchMoreThuente<Rosenbrock> lineSearch(function);
+        lineSearch.setParameters(1.0E-10, alpha, 100.0, curvatureTolerance);
+        lineSearch.setStartPoint(startPoint, startValue, startGradient);
+        lineSearch.setInitialStep(initialStep);
+        VectorType optimum = lineSearch.optimum();
+        double optimalValue = lineSearch.optimalValue();
+        VectorType optimalGradient = lineSearch.getOptimalGradient();
+
+        // Recover the step length along initialStep.
+        double step = (optimum[0] - startPoint[0]) / initialStep[0];
+        double initialSlope = (startGradient[0] * initialStep[0]
+                               + startGradient[1] * initialStep[1]);
+        double slope = (optimalGradient[0] * initialStep[0]
+                        + optimalGradient[1] * initialStep[1]);
+        BRICK_TEST_ASSERT(step > 0.0);
+        BRICK_TEST_ASSERT(
+          test::approximatelyEqual(optimalValue, function(optimum), 1.0E-12));
+        BRICK_TEST_ASSERT(
+          optimalValue <= startValue + alpha * step * initialSlope);
+        BRICK_TEST_ASSERT(
+          std::fabs(slope) <= -curvatureTolerance * initialSlope);
+        BRICK_TEST_ASSERT(lineSearch.getNumberOfFunctionCalls() > 0);
+        BRICK_TEST_ASSERT(lineSearch.getNumberOfGradientCalls()
+                          == lineSearch.getNumberOfFunctionCalls());
+      }
+
+      // Uphill directions should be rejected.
+      VectorType uphillStep(2);
+      uphillStep[0] = startGradient[0];
+      uphillStep[1] = startGradient[1];
+      OptimizerLineSearchMoreThuente<Rosenbrock> lineSearch(function);
+      lineSearch.setStartPoint(startPoint, startValue, startGradient);
+      lineSearch.setInitialStep(uphillStep);
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::StateException,
+                                  lineSearch.optimum());
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException,
+        lineSearch.setParameters(1.0E-7, 0.5, 100.0, 0.1));
+    }
+
+
+    void
+    OptimizerLBFGSTest::
+    testOptimizerLBFGSQuadratic()
+    {
+      // A moderately large problem with finite difference gradients
+      // computed in parallel.
+      size_t const dimensionality = 1000;
+      VectorType startPoint(dimensionality);
+      startPoint = 0.0;
+
+      typedef GradientFunction<Quadratic> FunctorType;
+      FunctorType functor(Quadratic(), 1.0E-6, 0);
+      OptimizerLBFGS<FunctorType> optimizer(functor);
+      optimizer.setParameters(5);
+      optimizer.setStartPoint(startPoint);
+      VectorType optimum = optimizer.optimum();
+      BRICK_TEST_ASSERT(optimum.size() == dimensionality);
+      for(size_t ii = 0; ii < dimensionality; ++ii) {
+        BRICK_TEST_ASSERT(
+          test::approximatelyEqual(optimum[ii], 1.0, 1.0E-4));
+      }
+      BRICK_TEST_ASSERT(optimizer.optimalValue() < 1.0E-6);
+      BRICK_TEST_ASSERT(optimizer.getNumberOfIterations().size() == 1);
+      BRICK_TEST_ASSERT(optimizer.getNumberOfIterations()[0] < 200);
+    }
+
+
+    void
+    OptimizerLBFGSTest::
+    testOptimizerLBFGSRosenbrock()
+    {
+      size_t const dimensionality = 100;
+      VectorType startPoint(dimensionality);
+      for(size_t ii = 0; ii < dimensionality; ii += 2) {
+        startPoint[ii] = -1.2;
+        startPoint[ii + 1] = 1.0;
+      }
+
+      OptimizerLBFGS<Rosenbrock> optimizer((Rosenbrock()));
+      optimizer.setParameters(8, 2000, 1, 1.0E-12, 1.0E-10);
+      optimizer.setStartPoint(startPoint);
+      VectorType optimum = optimizer.optimum();
+      for(size_t ii = 0; ii < dimensionality; ++ii) {
+        BRICK_TEST_ASSERT(
+          test::approximatelyEqual(optimum[ii], 1.0, m_defaultTolerance));
+      }
+      BRICK_TEST_ASSERT(optimizer.optimalValue() < 1.0E-10);
+      BRICK_TEST_ASSERT(optimizer.getNumberOfIterations().size() == 2);
+      BRICK_TEST_ASSERT(optimizer.getNumberOfFunctionCalls()[0] > 0);
+
+      // Copies should give the same answer.
+      OptimizerLBFGS<Rosenbrock> optimizer2(optimizer);
+      optimizer2.setStartPoint(startPoint);
+      VectorType optimum2 = optimizer2.optimum();
+      for(size_t ii = 0; ii < dimensionality; ++ii) {
+        BRICK_TEST_ASSERT(optimum2[ii] == optimum[ii]);
+      }
+
+      // Calling optimum() before setStartPoint() is an error.
+      OptimizerLBFGS<Rosenbrock> optimizer3((Rosenbrock()));
+      BRICK_TEST_ASSERT_EXCEPTION(brick::common::StateException,
+                                  optimizer3.optimum());
+    }
+
+
+    void
+    OptimizerLBFGSTest::
+    testOptimizerLBFGSZeroGradient()
+    {
+      // With gradientTolerance set to zero, only an exactly zero
+      // gradient ends the search.  From the first start point, the
+      // search lands on the plateau with a long step, and is stopped
+      // by the "small gradient" test.  From the second, its last step
+      // onto the plateau is short, so it is stopped by the
+      // "insufficient parameter change" test, whose steepest descent
+      // retry must not divide by the zero gradient.
+      VectorType startPoints[] = {this->makeVector(3.0, -2.0, 4.0),
+                                  this->makeVector(2.0, 2.0, 3.0)};
+      for(size_t jj = 0; jj < 2; ++jj) {
+        OptimizerLBFGS<Plateau> optimizer((Plateau()));
+        optimizer.setParameters(5, 100, 0, 1.2E-7, 0.0);
+        optimizer.setStartPoint(startPoints[jj]);
+        VectorType optimum = optimizer.optimum();
+        BRICK_TEST_ASSERT(optimum.size() == 3);
+        for(size_t ii = 0; ii < optimum.size(); ++ii) {
+          BRICK_TEST_ASSERT(std::fabs(optimum[ii]) <= 1.0);
+        }
+        BRICK_TEST_ASSERT(optimizer.optimalValue() == 0.0);
+      }
+    }
+
+  } // namespace optimization
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::optimization::OptimizerLBFGSTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::optimization::OptimizerLBFGSTest currentTest;
+
+}
+
+#endif
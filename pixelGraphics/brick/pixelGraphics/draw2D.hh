@@ -14,7 +14,9 @@
 #ifndef BRICK_PIXELGRAPHICS_DRAW2D_HH
 #define BRICK_PIXELGRAPHICS_DRAW2D_HH
 
+#include <vector>
 #include <brick/geometry/lineSegment2D.hh>
+#include <brick/numeric/transform2D.hh>
 
 namespace brick {
 
@@ -28,6 +30,33 @@ namespace brick {
            brick::numeric::Transform2D<double> const& pixelFromWorld =
              brick::numeric::Transform2D<double>());
 
+
+    /**
+     * This function draws many line segments at once.  It produces
+     * the same pixels as calling the single-segment version of
+     * draw2D() once per segment, but sets up the segments in
+     * batches, and avoids constructing a ray tracer for each one.
+     *
+     * @param canvas This argument is the array into which to draw.
+     *
+     * @param lineSegments This argument specifies the segments to be
+     * drawn, in world coordinates.
+     *
+     * @param color This argument is the value to be written into each
+     * pixel touched by a segment.
+     *
+     * @param pixelFromWorld This argument takes world coordinates to
+     * pixel coordinates.
+     */
+    template <class ArrayType, class CoordinateType>
+    void
+    draw2D(ArrayType& canvas,
+           std::vector< brick::geometry::LineSegment2D<CoordinateType> > const&
+             lineSegments,
+           typename ArrayType::value_type const& color,
+           brick::numeric::Transform2D<double> const& pixelFromWorld =
+             brick::numeric::Transform2D<double>());
+
   } // namespace pixelGraphics
 
 } // namespace brick
@@ -21,11 +21,43 @@
 // #include <brick/pixelGraphics/draw2D.hh>
 
 #include <brick/numeric/amanatidesWoo2D.hh>
+#include <brick/numeric/amanatidesWoo2DBatch.hh>
 
 namespace brick {
 
   namespace pixelGraphics {
 
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Reduction functor for brick::numeric::traceRays() that
+      // simply paints every pixel it visits.
+      template <class ValueType>
+      class PaintPixel {
+      public:
+        typedef int result_type;
+
+        explicit
+        PaintPixel(ValueType const& color) : m_color(color) {}
+
+        result_type
+        initialize() const {return 0;}
+
+        bool
+        operator()(result_type& /* result */, ValueType& pixel,
+                   double /* tEntry */, double /* tExit */) const {
+          pixel = m_color;
+          return true;
+        }
+
+      private:
+        ValueType m_color;
+      };
+
+    } // namespace privateCode
+    /// @endcond
+
+
     template <class ArrayType, class CoordinateType>
     void
     draw2D(ArrayType& canvas,
@@ -33,7 +65,8 @@ namespace brick {
            typename ArrayType::value_type const& color,
            brick::numeric::Transform2D<double> const& pixelFromWorld)
     {
-      typedef typename AmanatidesWoo2D<ArrayType>::iterator awIterator;
+      typedef typename brick::numeric::AmanatidesWoo2D<ArrayType>::iterator
+        awIterator;
 
       // Figure out in which direction to draw the line.
       brick::numeric::Vector2D<CoordinateType> direction =
@@ -41,7 +74,7 @@ namespace brick {
 
       // Use the fast voxel traversal algorithm of Amanatides & Woo to
       // draw the line.
-      AmanatidesWoo2D<ArrayType> rayTracer(
+      brick::numeric::AmanatidesWoo2D<ArrayType> rayTracer(
         canvas, pixelFromWorld, lineSegment.getVertex0(), direction, true);
       awIterator iterator0 = rayTracer.begin();
       awIterator iterator1 = rayTracer.end();
@@ -51,6 +84,13 @@ namespace brick {
       // of the line segment.
       for(; iterator0 != iterator1; ++iterator0) {
 
+        // If the segment ends before it reaches the image, the ray
+        // tracer still reports the point where the extended line
+        // enters, so we have to check for that here.
+        if(iterator0.tEntry() >= 1.0) {
+          break;
+        }
+
         // Do the actual drawing.
         *iterator0 = color;
 
@@ -68,6 +108,39 @@ namespace brick {
     }
 
 
+    template <class ArrayType, class CoordinateType>
+    void
+    draw2D(ArrayType& canvas,
+           std::vector< brick::geometry::LineSegment2D<CoordinateType> > const&
+             lineSegments,
+           typename ArrayType::value_type const& color,
+           brick::numeric::Transform2D<double> const& pixelFromWorld)
+    {
+      brick::numeric::Array1D< brick::numeric::Vector2D<double> >
+        startPoints(lineSegments.size());
+      brick::numeric::Array1D< brick::numeric::Vector2D<double> >
+        directions(lineSegments.size());
+      for(size_t ii = 0; ii < lineSegments.size(); ++ii) {
+        brick::numeric::Vector2D<CoordinateType> const& vertex0 =
+          lineSegments[ii].getVertex0();
+        brick::numeric::Vector2D<CoordinateType> const& vertex1 =
+          lineSegments[ii].getVertex1();
+        startPoints[ii].setValue(vertex0.x(), vertex0.y());
+        directions[ii].setValue(vertex1.x() - vertex0.x(),
+                                vertex1.y() - vertex0.y());
+      }
+
+      // As in the single-segment version, direction is chosen so
+      // that each segment ends at t == 1.0.  Overlapping segments
+      // write to the same pixels, so we trace in a single thread.
+      brick::numeric::Array1D<int> dummyResults(lineSegments.size());
+      brick::numeric::traceRays(
+        canvas, pixelFromWorld, startPoints, directions,
+        privateCode::PaintPixel<typename ArrayType::value_type>(color),
+        dummyResults, 1.0, 0, 1, true);
+    }
+
+
   } // namespace pixelGraphics
 
 } // namespace brick
@@ -0,0 +1,397 @@
+/**
+***************************************************************************
+* @file brick/pixelGraphics/rasterizer2D.hh
+*
+* Header file declaring a tiled, multithreaded rasterizer for drawing
+* large numbers of simple 2D primitives into user-defined arrays.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_PIXELGRAPHICS_RASTERIZER2D_HH
+#define BRICK_PIXELGRAPHICS_RASTERIZER2D_HH
+
+#include <cstddef>
+#include <vector>
+#include <brick/geometry/bullseye2D.hh>
+#include <brick/geometry/circle2D.hh>
+#include <brick/geometry/ellipse2D.hh>
+#include <brick/geometry/lineSegment2D.hh>
+#include <brick/geometry/triangle2D.hh>
+#include <brick/numeric/vector2D.hh>
+
+namespace brick {
+
+  // Forward declarations so that we can provide blending for the
+  // computerVision pixel types without making brickPixelGraphics
+  // depend on brickComputerVision.
+  namespace computerVision {
+    template <class Type> struct PixelBGRA;
+    template <class Type> struct PixelRGB;
+    template <class Type> struct PixelRGBA;
+  } // namespace computerVision
+
+
+  namespace pixelGraphics {
+
+    /**
+     ** The Rasterizer2D class template collects lines, polygons,
+     ** circles, and ellipses, and then draws them all at once into
+     ** a 2D array, such as a brick::computerVision::Image instance.
+     ** It is intended for drawing overlays and debugging
+     ** visualizations containing many thousands of primitives.
+     **
+     ** Each primitive has a color and an opacity, and is alpha
+     ** blended into the array using blendPixel().  Lines may be
+     ** aliased (one pixel per step along the major axis, as
+     ** Bresenham's algorithm would draw them) or anti-aliased
+     ** (Wu's algorithm).  Circles and ellipses are anti-aliased,
+     ** and may be filled or drawn as outlines of a specified width.
+     ** Triangles and polygons are filled using a scanline algorithm
+     ** with the even-odd rule, and are not anti-aliased.
+     **
+     ** Coordinates are pixel coordinates, with x increasing along
+     ** each row and y increasing down the columns.  Pixel (row,
+     ** column) covers the square [column, column + 1) x [row,
+     ** row + 1), so its center is at (column + 0.5, row + 0.5).
+     **
+     ** When render() is called, the array is divided into square
+     ** tiles, each primitive is assigned to the tiles its bounding
+     ** box overlaps, and tiles are drawn in parallel, with each
+     ** primitive clipped to the tile.  Within each tile, primitives
+     ** are drawn in the order in which they were added, so the
+     ** result doesn't depend on the number of threads.
+     **
+     ** Here's an example of how you might use this class:
+     **
+     ** @code
+     **   Rasterizer2D<PixelRGB8> rasterizer;
+     **   for(size_t ii = 0; ii < keypoints.size(); ++ii) {
+     **     rasterizer.addCircle(
+     **       Circle2D<double>(keypoints[ii], 3.0), red, 0.75, 1.0);
+     **   }
+     **   rasterizer.addPolygon(boundary, green, 0.25);
+     **   rasterizer.render(image);
+     ** @endcode
+     **/
+    template <class PixelType>
+    class Rasterizer2D {
+    public:
+
+      /**
+       * The constructor makes an empty Rasterizer2D instance.
+       *
+       * @param tileSize This argument specifies the width and height
+       * of the tiles into which the array is divided when rendering.
+       */
+      explicit
+      Rasterizer2D(std::size_t tileSize = 64);
+
+
+      /**
+       * Destructor.
+       */
+      ~Rasterizer2D() {}
+
+
+      /**
+       * This member function adds a bullseye to the list of things to
+       * be drawn.  Each ring of the bullseye is drawn as an ellipse
+       * outline.
+       *
+       * @param bullseye This argument is the bullseye to be drawn.
+       *
+       * @param color This argument specifies the color of the rings.
+       *
+       * @param alpha This argument specifies the opacity of the
+       * rings, from 0.0 (transparent) to 1.0 (opaque).
+       *
+       * @param lineWidth This argument specifies the width of each
+       * ring, in pixels.
+       */
+      template <class Type>
+      void
+      addBullseye(brick::geometry::Bullseye2D<Type> const& bullseye,
+                  PixelType const& color, double alpha = 1.0,
+                  double lineWidth = 1.0);
+
+
+      /**
+       * This member function adds a circle to the list of things to
+       * be drawn.
+       *
+       * @param circle This argument is the circle to be drawn.
+       *
+       * @param color This argument specifies the color of the circle.
+       *
+       * @param alpha This argument specifies the opacity of the
+       * circle, from 0.0 (transparent) to 1.0 (opaque).
+       *
+       * @param lineWidth If this argument is greater than zero, only
+       * the outline of the circle is drawn, with the specified width
+       * in pixels.  Otherwise, the circle is filled.
+       */
+      template <class Type>
+      void
+      addCircle(brick::geometry::Circle2D<Type> const& circle,
+                PixelType const& color, double alpha = 1.0,
+                double lineWidth = 0.0);
+
+
+      /**
+       * This member function adds an ellipse to the list of things to
+       * be drawn.
+       *
+       * @param ellipse This argument is the ellipse to be drawn.
+       *
+       * @param color This argument specifies the color of the
+       * ellipse.
+       *
+       * @param alpha This argument specifies the opacity of the
+       * ellipse, from 0.0 (transparent) to 1.0 (opaque).
+       *
+       * @param lineWidth If this argument is greater than zero, only
+       * the outline of the ellipse is drawn, with the specified
+       * width in pixels.  Otherwise, the ellipse is filled.
+       */
+      template <class Type>
+      void
+      addEllipse(brick::geometry::Ellipse2D<Type> const& ellipse,
+                 PixelType const& color, double alpha = 1.0,
+                 double lineWidth = 0.0);
+
+
+      /**
+       * This member function adds a one pixel wide line segment to
+       * the list of things to be drawn.
+       *
+       * @param lineSegment This argument is the segment to be drawn.
+       *
+       * @param color This argument specifies the color of the line.
+       *
+       * @param alpha This argument specifies the opacity of the line,
+       * from 0.0 (transparent) to 1.0 (opaque).
+       *
+       * @param antialias If this argument is true, the line will be
+       * drawn using Wu's algorithm, which spreads each step of the
+       * line across the two nearest pixels.  Otherwise, exactly one
+       * pixel is drawn for each step along the major axis of the
+       * line.
+       */
+      template <class Type>
+      void
+      addLine(brick::geometry::LineSegment2D<Type> const& lineSegment,
+              PixelType const& color, double alpha = 1.0,
+              bool antialias = true);
+
+
+      /**
+       * This member function adds a filled polygon to the list of
+       * things to be drawn.  The polygon may be concave or
+       * self-intersecting, in which case it is filled according to
+       * the even-odd rule.
+       *
+       * @param vertices This argument lists the vertices of the
+       * polygon in order.  The last vertex is implicitly connected
+       * to the first.
+       *
+       * @param color This argument specifies the fill color.
+       *
+       * @param alpha This argument specifies the opacity of the
+       * polygon, from 0.0 (transparent) to 1.0 (opaque).
+       */
+      template <class Type>
+      void
+      addPolygon(
+        std::vector< brick::numeric::Vector2D<Type> > const& vertices,
+        PixelType const& color, double alpha = 1.0);
+
+
+      /**
+       * This member function adds a filled triangle to the list of
+       * things to be drawn.
+       *
+       * @param triangle This argument is the triangle to be drawn.
+       *
+       * @param color This argument specifies the fill color.
+       *
+       * @param alpha This argument specifies the opacity of the
+       * triangle, from 0.0 (transparent) to 1.0 (opaque).
+       */
+      template <class Type>
+      void
+      addTriangle(brick::geometry::Triangle2D<Type> const& triangle,
+                  PixelType const& color, double alpha = 1.0);
+
+
+      /**
+       * This member function discards all of the primitives that have
+       * been added so far, without releasing their storage, so that
+       * *this can be efficiently reused for the next frame.
+       */
+      void
+      clear();
+
+
+      /**
+       * This member function returns how many primitives have been
+       * added since construction or the last call to clear().  Each
+       * ring of a bullseye counts as one primitive.
+       *
+       * @return The return value is the number of primitives.
+       */
+      std::size_t
+      getNumberOfPrimitives() const {return m_primitives.size();}
+
+
+      /**
+       * This member function draws all of the primitives into an
+       * array.  Primitives are not discarded, so calling render()
+       * repeatedly will draw the same thing each time.
+       *
+       * @param canvas This argument is the array into which to
+       * draw.  It must provide rows(), columns(), and
+       * operator()(row, column), returning a reference to PixelType,
+       * as brick::numeric::Array2D does.
+       *
+       * @param numberOfThreads This argument specifies how many
+       * threads to use.  If it is zero, the number of threads is
+       * chosen automatically.
+       */
+      template <class ArrayType>
+      void
+      render(ArrayType& canvas, std::size_t numberOfThreads = 0) const;
+
+    private:
+
+      enum PrimitiveType {
+        BRICK_RASTER_ALIASED_LINE,
+        BRICK_RASTER_ANTIALIASED_LINE,
+        BRICK_RASTER_ELLIPSE,
+        BRICK_RASTER_POLYGON
+      };
+
+      // Lines store their two endpoints in m_vertices, polygons
+      // store all of their vertices, and ellipses store their
+      // center followed by their two semi-axes.
+      struct Primitive {
+        PrimitiveType type;
+        std::size_t firstVertex;
+        std::size_t numberOfVertices;
+        PixelType color;
+        double alpha;
+        double lineWidth;
+        double minX;
+        double maxX;
+        double minY;
+        double maxY;
+      };
+
+      void
+      addEllipseVertices(double centerX, double centerY,
+                         double axis0X, double axis0Y,
+                         double axis1X, double axis1Y,
+                         PixelType const& color, double alpha,
+                         double lineWidth);
+
+      template <class ArrayType>
+      void
+      drawEllipse(ArrayType& canvas, Primitive const& primitive,
+                  int row0, int row1, int column0, int column1) const;
+
+      template <class ArrayType>
+      void
+      drawLine(ArrayType& canvas, Primitive const& primitive,
+               int row0, int row1, int column0, int column1) const;
+
+      template <class ArrayType>
+      void
+      drawPolygon(ArrayType& canvas, Primitive const& primitive,
+                  int row0, int row1, int column0, int column1,
+                  std::vector<double>& crossings) const;
+
+      std::vector<Primitive> m_primitives;
+      std::size_t m_tileSize;
+      std::vector< brick::numeric::Vector2D<double> > m_vertices;
+    };
+
+
+    /**
+     * This function blends a color into a pixel.  The generic
+     * version works for scalar pixel types, such as UInt8 or float,
+     * and integer results are rounded to the nearest value.  You can
+     * overload it for your own pixel types to use them with
+     * Rasterizer2D.
+     *
+     * @param pixel This argument is the pixel to be modified.
+     *
+     * @param color This argument is the color to be blended in.
+     *
+     * @param weight This argument specifies how much of color to
+     * use.  Setting it to 0.0 leaves pixel unchanged, and setting it
+     * to 1.0 replaces pixel with color.
+     */
+    template <class PixelType>
+    inline void
+    blendPixel(PixelType& pixel, PixelType const& color, double weight);
+
+
+    /**
+     * This function blends a color into a PixelBGRA instance.  All
+     * four channels, including alpha, are interpolated.
+     *
+     * @param pixel This argument is the pixel to be modified.
+     *
+     * @param color This argument is the color to be blended in.
+     *
+     * @param weight This argument specifies how much of color to use.
+     */
+    template <class Type>
+    inline void
+    blendPixel(brick::computerVision::PixelBGRA<Type>& pixel,
+               brick::computerVision::PixelBGRA<Type> const& color,
+               double weight);
+
+
+    /**
+     * This function blends a color into a PixelRGB instance.
+     *
+     * @param pixel This argument is the pixel to be modified.
+     *
+     * @param color This argument is the color to be blended in.
+     *
+     * @param weight This argument specifies how much of color to use.
+     */
+    template <class Type>
+    inline void
+    blendPixel(brick::computerVision::PixelRGB<Type>& pixel,
+               brick::computerVision::PixelRGB<Type> const& color,
+               double weight);
+
+
+    /**
+     * This function blends a color into a PixelRGBA instance.  All
+     * four channels, including alpha, are interpolated.
+     *
+     * @param pixel This argument is the pixel to be modified.
+     *
+     * @param color This argument is the color to be blended in.
+     *
+     * @param weight This argument specifies how much of color to use.
+     */
+    template <class Type>
+    inline void
+    blendPixel(brick::computerVision::PixelRGBA<Type>& pixel,
+               brick::computerVision::PixelRGBA<Type> const& color,
+               double weight);
+
+  } // namespace pixelGraphics
+
+} // namespace brick
+
+#include <brick/pixelGraphics/rasterizer2D_impl.hh>
+
+#endif /* #ifdef BRICK_PIXELGRAPHICS_RASTERIZER2D_HH */
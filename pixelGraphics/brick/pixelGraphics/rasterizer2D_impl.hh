@@ -0,0 +1,707 @@
+/**
+***************************************************************************
+* @file brick/pixelGraphics/rasterizer2D_impl.hh
+*
+* Implementation file defining templates declared in rasterizer2D.hh.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_PIXELGRAPHICS_RASTERIZER2D_IMPL_HH
+#define BRICK_PIXELGRAPHICS_RASTERIZER2D_IMPL_HH
+
+// This file is included by rasterizer2D.hh, and should not be
+// directly included by user code, so no need to include
+// rasterizer2D.hh here.
+//
+// #include <brick/pixelGraphics/rasterizer2D.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <brick/common/parallel.hh>
+#include <brick/numeric/numericTraits.hh>
+
+namespace brick {
+
+  namespace pixelGraphics {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      // Blend a single channel, rounding if the channel type is an
+      // integer type.
+      template <class Type>
+      inline Type
+      blendChannel(Type const& pixel, Type const& color, double weight)
+      {
+        double value = (static_cast<double>(pixel)
+                        + weight * (static_cast<double>(color)
+                                    - static_cast<double>(pixel)));
+        if(brick::numeric::NumericTraits<Type>::isIntegral()) {
+          value = std::floor(value + 0.5);
+        }
+        return static_cast<Type>(value);
+      }
+
+
+      // Blend a primitive's color into a pixel, skipping pixels that
+      // aren't covered at all, and skipping the arithmetic for pixels
+      // that are completely covered by an opaque primitive.
+      template <class PixelType>
+      inline void
+      paintPixel(PixelType& pixel, PixelType const& color, double weight)
+      {
+        if(weight >= 1.0) {
+          pixel = color;
+        } else if(weight > 0.0) {
+          blendPixel(pixel, color, weight);
+        }
+      }
+
+
+      inline int
+      roundToInt(double value)
+      {
+        return static_cast<int>(std::floor(value + 0.5));
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    // The constructor makes an empty Rasterizer2D instance.
+    template <class PixelType>
+    Rasterizer2D<PixelType>::
+    Rasterizer2D(std::size_t tileSize)
+      : m_primitives(),
+        m_tileSize(tileSize == 0 ? 1 : tileSize),
+        m_vertices()
+    {
+      // Empty.
+    }
+
+
+    // This member function adds each ring of a bullseye to the list
+    // of things to be drawn.
+    template <class PixelType>
+    template <class Type>
+    void
+    Rasterizer2D<PixelType>::
+    addBullseye(brick::geometry::Bullseye2D<Type> const& bullseye,
+                PixelType const& color, double alpha, double lineWidth)
+    {
+      brick::numeric::Vector2D<Type> const& origin = bullseye.getOrigin();
+      for(unsigned int ii = 0; ii < bullseye.getNumberOfRings(); ++ii) {
+        brick::numeric::Vector2D<Type> axis0 = bullseye.getSemimajorAxis(ii);
+        brick::numeric::Vector2D<Type> axis1 = bullseye.getSemiminorAxis(ii);
+        this->addEllipseVertices(origin.x(), origin.y(),
+                                 axis0.x(), axis0.y(), axis1.x(), axis1.y(),
+                                 color, alpha, lineWidth);
+      }
+    }
+
+
+    // This member function adds a circle to the list of things to be
+    // drawn.
+    template <class PixelType>
+    template <class Type>
+    void
+    Rasterizer2D<PixelType>::
+    addCircle(brick::geometry::Circle2D<Type> const& circle,
+              PixelType const& color, double alpha, double lineWidth)
+    {
+      double radius = static_cast<double>(circle.getRadius());
+      this->addEllipseVertices(circle.getOrigin().x(), circle.getOrigin().y(),
+                               radius, 0.0, 0.0, radius,
+                               color, alpha, lineWidth);
+    }
+
+
+    // This member function adds an ellipse to the list of things to
+    // be drawn.
+    template <class PixelType>
+    template <class Type>
+    void
+    Rasterizer2D<PixelType>::
+    addEllipse(brick::geometry::Ellipse2D<Type> const& ellipse,
+               PixelType const& color, double alpha, double lineWidth)
+    {
+      brick::numeric::Vector2D<Type> const& origin = ellipse.getOrigin();
+      brick::numeric::Vector2D<Type> const& axis0 =
+        ellipse.getSemimajorAxis();
+      brick::numeric::Vector2D<Type> const& axis1 =
+        ellipse.getSemiminorAxis();
+      this->addEllipseVertices(origin.x(), origin.y(),
+                               axis0.x(), axis0.y(), axis1.x(), axis1.y(),
+                               color, alpha, lineWidth);
+    }
+
+
+    // This member function adds a line segment to the list of things
+    // to be drawn.
+    template <class PixelType>
+    template <class Type>
+    void
+    Rasterizer2D<PixelType>::
+    addLine(brick::geometry::LineSegment2D<Type> const& lineSegment,
+            PixelType const& color, double alpha, bool antialias)
+    {
+      brick::numeric::Vector2D<double> vertex0(
+        lineSegment.getVertex0().x(), lineSegment.getVertex0().y());
+      brick::numeric::Vector2D<double> vertex1(
+        lineSegment.getVertex1().x(), lineSegment.getVertex1().y());
+
+      // Anti-aliased lines touch one extra pixel on either side.
+      Primitive primitive;
+      primitive.type = (antialias ? BRICK_RASTER_ANTIALIASED_LINE
+                        : BRICK_RASTER_ALIASED_LINE);
+      primitive.firstVertex = m_vertices.size();
+      primitive.numberOfVertices = 2;
+      primitive.color = color;
+      primitive.alpha = alpha;
+      primitive.lineWidth = 1.0;
+      primitive.minX = std::min(vertex0.x(), vertex1.x()) - 1.0;
+      primitive.maxX = std::max(vertex0.x(), vertex1.x()) + 1.0;
+      primitive.minY = std::min(vertex0.y(), vertex1.y()) - 1.0;
+      primitive.maxY = std::max(vertex0.y(), vertex1.y()) + 1.0;
+      m_vertices.push_back(vertex0);
+      m_vertices.push_back(vertex1);
+      m_primitives.push_back(primitive);
+    }
+
+
+    // This member function adds a filled polygon to the list of
+    // things to be drawn.
+    template <class PixelType>
+    template <class Type>
+    void
+    Rasterizer2D<PixelType>::
+    addPolygon(std::vector< brick::numeric::Vector2D<Type> > const& vertices,
+               PixelType const& color, double alpha)
+    {
+      if(vertices.size() < 3) {
+        return;
+      }
+      Primitive primitive;
+      primitive.type = BRICK_RASTER_POLYGON;
+      primitive.firstVertex = m_vertices.size();
+      primitive.numberOfVertices = vertices.size();
+      primitive.color = color;
+      primitive.alpha = alpha;
+      primitive.lineWidth = 0.0;
+      primitive.minX = primitive.maxX = vertices[0].x();
+      primitive.minY = primitive.maxY = vertices[0].y();
+      for(std::size_t ii = 0; ii < vertices.size(); ++ii) {
+        double xValue = static_cast<double>(vertices[ii].x());
+        double yValue = static_cast<double>(vertices[ii].y());
+        primitive.minX = std::min(primitive.minX, xValue);
+        primitive.maxX = std::max(primitive.maxX, xValue);
+        primitive.minY = std::min(primitive.minY, yValue);
+        primitive.maxY = std::max(primitive.maxY, yValue);
+        m_vertices.push_back(
+          brick::numeric::Vector2D<double>(xValue, yValue));
+      }
+      m_primitives.push_back(primitive);
+    }
+
+
+    // This member function adds a filled triangle to the list of
+    // things to be drawn.
+    template <class PixelType>
+    template <class Type>
+    void
+    Rasterizer2D<PixelType>::
+    addTriangle(brick::geometry::Triangle2D<Type> const& triangle,
+                PixelType const& color, double alpha)
+    {
+      std::vector< brick::numeric::Vector2D<Type> > vertices(3);
+      vertices[0] = triangle.getVertex0();
+      vertices[1] = triangle.getVertex1();
+      vertices[2] = triangle.getVertex2();
+      this->addPolygon(vertices, color, alpha);
+    }
+
+
+    // This member function discards all primitives.
+    template <class PixelType>
+    void
+    Rasterizer2D<PixelType>::
+    clear()
+    {
+      m_primitives.clear();
+      m_vertices.clear();
+    }
+
+
+    // This member function draws all of the primitives into an
+    // array, one tile at a time.
+    template <class PixelType>
+    template <class ArrayType>
+    void
+    Rasterizer2D<PixelType>::
+    render(ArrayType& canvas, std::size_t numberOfThreads) const
+    {
+      int const rows = static_cast<int>(canvas.rows());
+      int const columns = static_cast<int>(canvas.columns());
+      if(rows == 0 || columns == 0 || m_primitives.empty()) {
+        return;
+      }
+      int const tileSize = static_cast<int>(m_tileSize);
+      std::size_t const tilesPerRow = (columns + tileSize - 1) / tileSize;
+      std::size_t const tilesPerColumn = (rows + tileSize - 1) / tileSize;
+      std::size_t const numberOfTiles = tilesPerRow * tilesPerColumn;
+
+      // Bin the primitives by tile.  This is a counting sort, so
+      // each tile's list stays in the order the primitives were
+      // added.  First find the range of tiles each primitive
+      // overlaps.
+      std::vector<int> tileRanges(4 * m_primitives.size());
+      std::vector<std::size_t> tileOffsets(numberOfTiles + 1, 0);
+      for(std::size_t ii = 0; ii < m_primitives.size(); ++ii) {
+        Primitive const& primitive = m_primitives[ii];
+        int* range = &(tileRanges[4 * ii]);
+        int const firstColumn = std::max(
+          0, static_cast<int>(std::floor(primitive.minX)));
+        int const lastColumn = std::min(
+          columns - 1, static_cast<int>(std::floor(primitive.maxX)));
+        int const firstRow = std::max(
+          0, static_cast<int>(std::floor(primitive.minY)));
+        int const lastRow = std::min(
+          rows - 1, static_cast<int>(std::floor(primitive.maxY)));
+        if(primitive.maxX < 0.0 || primitive.maxY < 0.0
+           || firstColumn > lastColumn || firstRow > lastRow) {
+          range[0] = range[1] = range[2] = range[3] = 0;
+          continue;
+        }
+        range[0] = firstRow / tileSize;
+        range[1] = lastRow / tileSize + 1;
+        range[2] = firstColumn / tileSize;
+        range[3] = lastColumn / tileSize + 1;
+        for(int tileRow = range[0]; tileRow < range[1]; ++tileRow) {
+          for(int tileColumn = range[2]; tileColumn < range[3];
+              ++tileColumn) {
+            ++tileOffsets[tileRow * tilesPerRow + tileColumn + 1];
+          }
+        }
+      }
+      for(std::size_t ii = 0; ii < numberOfTiles; ++ii) {
+        tileOffsets[ii + 1] += tileOffsets[ii];
+      }
+      std::vector<std::size_t> binnedPrimitives(tileOffsets[numberOfTiles]);
+      std::vector<std::size_t> fillPositions(
+        tileOffsets.begin(), tileOffsets.end() - 1);
+      for(std::size_t ii = 0; ii < m_primitives.size(); ++ii) {
+        int const* range = &(tileRanges[4 * ii]);
+        for(int tileRow = range[0]; tileRow < range[1]; ++tileRow) {
+          for(int tileColumn = range[2]; tileColumn < range[3];
+              ++tileColumn) {
+            binnedPrimitives[
+              fillPositions[tileRow * tilesPerRow + tileColumn]++] = ii;
+          }
+        }
+      }
+
+      // Now draw the tiles.  No two tiles share a pixel, so threads
+      // never write to the same place.
+      if(numberOfThreads == 0) {
+        numberOfThreads = brick::common::getDefaultNumberOfThreads();
+      }
+      std::atomic<std::size_t> nextTile(0);
+      brick::common::executeInParallel(
+        std::min(numberOfThreads, numberOfTiles),
+        [&](std::size_t /* taskIndex */) {
+          std::vector<double> crossings;
+          std::size_t tileIndex;
+          while((tileIndex = nextTile++) < numberOfTiles) {
+            int const row0 = static_cast<int>(tileIndex / tilesPerRow)
+              * tileSize;
+            int const column0 = static_cast<int>(tileIndex % tilesPerRow)
+              * tileSize;
+            int const row1 = std::min(rows, row0 + tileSize);
+            int const column1 = std::min(columns, column0 + tileSize);
+            for(std::size_t jj = tileOffsets[tileIndex];
+                jj < tileOffsets[tileIndex + 1]; ++jj) {
+              Primitive const& primitive =
+                m_primitives[binnedPrimitives[jj]];
+              switch(primitive.type) {
+              case BRICK_RASTER_ALIASED_LINE:
+              case BRICK_RASTER_ANTIALIASED_LINE:
+                this->drawLine(canvas, primitive,
+                               row0, row1, column0, column1);
+                break;
+              case BRICK_RASTER_ELLIPSE:
+                this->drawEllipse(canvas, primitive,
+                                  row0, row1, column0, column1);
+                break;
+              case BRICK_RASTER_POLYGON:
+                this->drawPolygon(canvas, primitive,
+                                  row0, row1, column0, column1, crossings);
+                break;
+              }
+            }
+          }
+        },
+        numberOfThreads);
+    }
+
+
+    // This member function records an ellipse in terms of its center
+    // and semi-axes.
+    template <class PixelType>
+    void
+    Rasterizer2D<PixelType>::
+    addEllipseVertices(double centerX, double centerY,
+                       double axis0X, double axis0Y,
+                       double axis1X, double axis1Y,
+                       PixelType const& color, double alpha,
+                       double lineWidth)
+    {
+      double const halfWidth = std::sqrt(axis0X * axis0X + axis1X * axis1X);
+      double const halfHeight = std::sqrt(axis0Y * axis0Y + axis1Y * axis1Y);
+      double const margin = std::max(lineWidth, 0.0) / 2.0 + 1.0;
+      if(axis0X * axis0X + axis0Y * axis0Y == 0.0
+         || axis1X * axis1X + axis1Y * axis1Y == 0.0) {
+        return;
+      }
+      Primitive primitive;
+      primitive.type = BRICK_RASTER_ELLIPSE;
+      primitive.firstVertex = m_vertices.size();
+      primitive.numberOfVertices = 3;
+      primitive.color = color;
+      primitive.alpha = alpha;
+      primitive.lineWidth = lineWidth;
+      primitive.minX = centerX - halfWidth - margin;
+      primitive.maxX = centerX + halfWidth + margin;
+      primitive.minY = centerY - halfHeight - margin;
+      primitive.maxY = centerY + halfHeight + margin;
+      m_vertices.push_back(brick::numeric::Vector2D<double>(centerX, centerY));
+      m_vertices.push_back(brick::numeric::Vector2D<double>(axis0X, axis0Y));
+      m_vertices.push_back(brick::numeric::Vector2D<double>(axis1X, axis1Y));
+      m_primitives.push_back(primitive);
+    }
+
+
+    // This member function draws the part of an ellipse that falls
+    // within [row0, row1) x [column0, column1).  Coverage is
+    // estimated from a first order approximation of the signed
+    // distance to the boundary, which is exact for circles.
+    template <class PixelType>
+    template <class ArrayType>
+    void
+    Rasterizer2D<PixelType>::
+    drawEllipse(ArrayType& canvas, Primitive const& primitive,
+                int row0, int row1, int column0, int column1) const
+    {
+      brick::numeric::Vector2D<double> const& center =
+        m_vertices[primitive.firstVertex];
+      brick::numeric::Vector2D<double> const& axis0 =
+        m_vertices[primitive.firstVertex + 1];
+      brick::numeric::Vector2D<double> const& axis1 =
+        m_vertices[primitive.firstVertex + 2];
+
+      // For a point p, we compute normalized coordinates u = (d .
+      // axis0) / |axis0|^2, v = (d . axis1) / |axis1|^2, where d = p
+      // - center.  Points with g = sqrt(u^2 + v^2) equal to 1 are on
+      // the ellipse.  Dividing (g - 1) by the magnitude of the
+      // gradient of g estimates the signed distance.  These are the
+      // vectors that take d to u and v.
+      double const axis0Squared = (axis0.x() * axis0.x()
+                                   + axis0.y() * axis0.y());
+      double const axis1Squared = (axis1.x() * axis1.x()
+                                   + axis1.y() * axis1.y());
+      double const u0 = axis0.x() / axis0Squared;
+      double const u1 = axis0.y() / axis0Squared;
+      double const v0 = axis1.x() / axis1Squared;
+      double const v1 = axis1.y() / axis1Squared;
+      double const minorLength = std::sqrt(
+        std::min(axis0Squared, axis1Squared));
+
+      // Pixels farther than this from the boundary get no coverage.
+      bool const isFilled = (primitive.lineWidth <= 0.0);
+      double const halfWidth = isFilled ? 0.0 : primitive.lineWidth / 2.0;
+      double const margin = halfWidth + 0.5;
+
+      // The magnitude of the gradient of g never exceeds 1 /
+      // minorLength, so the approximate distance is at least
+      // |g - 1| * minorLength.  This lets us bound the span of
+      // columns in each row that might be covered, and for outlines,
+      // the span in the middle of each row that can't be.
+      double const outerScale = 1.0 + margin / minorLength;
+      double const innerScale = 1.0 - margin / minorLength;
+      double const quadraticA = u0 * u0 + v0 * v0;
+
+      for(int row = row0; row < row1; ++row) {
+        double const dy = (row + 0.5) - center.y();
+        double const quadraticB = 2.0 * dy * (u0 * u1 + v0 * v1);
+        double const quadraticC = dy * dy * (u1 * u1 + v1 * v1);
+
+        // Solve quadraticA * dx^2 + quadraticB * dx + quadraticC =
+        // scale^2 for the outer span.
+        double discriminant = (
+          quadraticB * quadraticB
+          - 4.0 * quadraticA * (quadraticC - outerScale * outerScale));
+        if(discriminant < 0.0) {
+          continue;
+        }
+        double root = std::sqrt(discriminant);
+        int firstColumn = std::max(
+          column0, static_cast<int>(std::ceil(
+            center.x() + (-quadraticB - root) / (2.0 * quadraticA) - 0.5)));
+        int lastColumn = std::min(
+          column1 - 1, static_cast<int>(std::floor(
+            center.x() + (-quadraticB + root) / (2.0 * quadraticA) - 0.5)));
+
+        // Outlines skip the inner span.
+        int skipBegin = lastColumn + 1;
+        int skipEnd = lastColumn + 1;
+        if(!isFilled && innerScale > 0.0) {
+          discriminant = (
+            quadraticB * quadraticB
+            - 4.0 * quadraticA * (quadraticC - innerScale * innerScale));
+          if(discriminant > 0.0) {
+            root = std::sqrt(discriminant);
+            skipBegin = static_cast<int>(std::floor(
+              center.x() + (-quadraticB - root) / (2.0 * quadraticA)
+              - 0.5)) + 1;
+            skipEnd = static_cast<int>(std::ceil(
+              center.x() + (-quadraticB + root) / (2.0 * quadraticA)
+              - 0.5));
+          }
+        }
+
+        for(int column = firstColumn; column <= lastColumn; ++column) {
+          if(column >= skipBegin && column < skipEnd) {
+            column = skipEnd - 1;
+            continue;
+          }
+          double const dx = (column + 0.5) - center.x();
+          double const uValue = dx * u0 + dy * u1;
+          double const vValue = dx * v0 + dy * v1;
+          double const gValue = std::sqrt(uValue * uValue + vValue * vValue);
+          double distance;
+          if(gValue == 0.0) {
+            distance = -minorLength;
+          } else {
+            double const gradientMagnitude = std::sqrt(
+              uValue * uValue / axis0Squared
+              + vValue * vValue / axis1Squared) / gValue;
+            distance = (gValue - 1.0) / gradientMagnitude;
+          }
+          double coverage = (isFilled ? 0.5 - distance
+                             : margin - std::fabs(distance));
+          coverage = std::min(std::max(coverage, 0.0), 1.0);
+          privateCode::paintPixel(canvas(row, column), primitive.color,
+                                  coverage * primitive.alpha);
+        }
+      }
+    }
+
+
+    // This member function draws the part of a line segment that
+    // falls within [row0, row1) x [column0, column1).  Rather than
+    // stepping incrementally from one end, as Bresenham's algorithm
+    // does, we compute the minor coordinate directly at each step
+    // along the major axis.  This gives the same pixels, but lets
+    // each tile start partway along the line.
+    template <class PixelType>
+    template <class ArrayType>
+    void
+    Rasterizer2D<PixelType>::
+    drawLine(ArrayType& canvas, Primitive const& primitive,
+             int row0, int row1, int column0, int column1) const
+    {
+      // Shift so that pixel centers have integer coordinates.
+      brick::numeric::Vector2D<double> const& vertex0 =
+        m_vertices[primitive.firstVertex];
+      brick::numeric::Vector2D<double> const& vertex1 =
+        m_vertices[primitive.firstVertex + 1];
+      double x0 = vertex0.x() - 0.5;
+      double y0 = vertex0.y() - 0.5;
+      double x1 = vertex1.x() - 0.5;
+      double y1 = vertex1.y() - 0.5;
+
+      // Arrange to step along x, swapping coordinates for steep
+      // lines, and always stepping in the positive direction.
+      bool const isSteep = std::fabs(y1 - y0) > std::fabs(x1 - x0);
+      int majorBegin = column0;
+      int majorEnd = column1;
+      int minorBegin = row0;
+      int minorEnd = row1;
+      if(isSteep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+        std::swap(majorBegin, minorBegin);
+        std::swap(majorEnd, minorEnd);
+      }
+      if(x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+      }
+      double const slope = (x1 > x0) ? (y1 - y0) / (x1 - x0) : 0.0;
+
+      int const firstStep = privateCode::roundToInt(x0);
+      int const lastStep = privateCode::roundToInt(x1);
+      int const stepBegin = std::max(firstStep, majorBegin);
+      int const stepEnd = std::min(lastStep + 1, majorEnd);
+      bool const isAntialiased =
+        (primitive.type == BRICK_RASTER_ANTIALIASED_LINE);
+
+      for(int step = stepBegin; step < stepEnd; ++step) {
+        double const minor = y0 + (step - x0) * slope;
+        if(!isAntialiased) {
+          int const minorIndex = privateCode::roundToInt(minor);
+          if(minorIndex >= minorBegin && minorIndex < minorEnd) {
+            PixelType& pixel = (isSteep ? canvas(step, minorIndex)
+                                : canvas(minorIndex, step));
+            privateCode::paintPixel(pixel, primitive.color, primitive.alpha);
+          }
+          continue;
+        }
+
+        // Wu's algorithm.  The end pixels are weighted by how much
+        // of the step they actually cover along the major axis.
+        double weight = primitive.alpha;
+        if(firstStep == lastStep) {
+          weight *= x1 - x0;
+        } else if(step == firstStep) {
+          weight *= (firstStep + 0.5) - x0;
+        } else if(step == lastStep) {
+          weight *= x1 - (lastStep - 0.5);
+        }
+        int const minorIndex = static_cast<int>(std::floor(minor));
+        double const fraction = minor - minorIndex;
+        if(minorIndex >= minorBegin && minorIndex < minorEnd) {
+          PixelType& pixel = (isSteep ? canvas(step, minorIndex)
+                              : canvas(minorIndex, step));
+          privateCode::paintPixel(
+            pixel, primitive.color, weight * (1.0 - fraction));
+        }
+        if(minorIndex + 1 >= minorBegin && minorIndex + 1 < minorEnd) {
+          PixelType& pixel = (isSteep ? canvas(step, minorIndex + 1)
+                              : canvas(minorIndex + 1, step));
+          privateCode::paintPixel(
+            pixel, primitive.color, weight * fraction);
+        }
+      }
+    }
+
+
+    // This member function fills the part of a polygon that falls
+    // within [row0, row1) x [column0, column1).  A pixel is filled
+    // if its center is inside the polygon.  Edges are treated as
+    // half-open so that polygons sharing an edge never both paint
+    // the pixels along it.
+    template <class PixelType>
+    template <class ArrayType>
+    void
+    Rasterizer2D<PixelType>::
+    drawPolygon(ArrayType& canvas, Primitive const& primitive,
+                int row0, int row1, int column0, int column1,
+                std::vector<double>& crossings) const
+    {
+      brick::numeric::Vector2D<double> const* vertices =
+        &(m_vertices[primitive.firstVertex]);
+      std::size_t const numberOfVertices = primitive.numberOfVertices;
+      int const firstRow = std::max(
+        row0, static_cast<int>(std::ceil(primitive.minY - 0.5)));
+      int const lastRow = std::min(
+        row1 - 1, static_cast<int>(std::floor(primitive.maxY - 0.5)));
+
+      for(int row = firstRow; row <= lastRow; ++row) {
+        double const yValue = row + 0.5;
+
+        // Find where this scanline crosses the edges of the polygon.
+        crossings.clear();
+        for(std::size_t ii = 0; ii < numberOfVertices; ++ii) {
+          brick::numeric::Vector2D<double> const& start = vertices[ii];
+          brick::numeric::Vector2D<double> const& end =
+            vertices[(ii + 1 == numberOfVertices) ? 0 : ii + 1];
+          if((start.y() <= yValue) != (end.y() <= yValue)) {
+            crossings.push_back(
+              start.x() + ((yValue - start.y()) * (end.x() - start.x())
+                           / (end.y() - start.y())));
+          }
+        }
+        std::sort(crossings.begin(), crossings.end());
+
+        // Fill between alternate pairs of crossings.
+        for(std::size_t ii = 0; ii + 1 < crossings.size(); ii += 2) {
+          int const spanBegin = std::max(
+            column0, static_cast<int>(std::ceil(crossings[ii] - 0.5)));
+          int const spanEnd = std::min(
+            column1, static_cast<int>(std::ceil(crossings[ii + 1] - 0.5)));
+          for(int column = spanBegin; column < spanEnd; ++column) {
+            privateCode::paintPixel(canvas(row, column), primitive.color,
+                                    primitive.alpha);
+          }
+        }
+      }
+    }
+
+
+    /* ============ Non-member function definitions ============ */
+
+
+    // This function blends a color into a scalar pixel.
+    template <class PixelType>
+    inline void
+    blendPixel(PixelType& pixel, PixelType const& color, double weight)
+    {
+      pixel = privateCode::blendChannel(pixel, color, weight);
+    }
+
+
+    // This function blends a color into a PixelBGRA instance.
+    template <class Type>
+    inline void
+    blendPixel(brick::computerVision::PixelBGRA<Type>& pixel,
+               brick::computerVision::PixelBGRA<Type> const& color,
+               double weight)
+    {
+      pixel.blue = privateCode::blendChannel(pixel.blue, color.blue, weight);
+      pixel.green = privateCode::blendChannel(
+        pixel.green, color.green, weight);
+      pixel.red = privateCode::blendChannel(pixel.red, color.red, weight);
+      pixel.alpha = privateCode::blendChannel(
+        pixel.alpha, color.alpha, weight);
+    }
+
+
+    // This function blends a color into a PixelRGB instance.
+    template <class Type>
+    inline void
+    blendPixel(brick::computerVision::PixelRGB<Type>& pixel,
+               brick::computerVision::PixelRGB<Type> const& color,
+               double weight)
+    {
+      pixel.red = privateCode::blendChannel(pixel.red, color.red, weight);
+      pixel.green = privateCode::blendChannel(
+        pixel.green, color.green, weight);
+      pixel.blue = privateCode::blendChannel(pixel.blue, color.blue, weight);
+    }
+
+
+    // This function blends a color into a PixelRGBA instance.
+    template <class Type>
+    inline void
+    blendPixel(brick::computerVision::PixelRGBA<Type>& pixel,
+               brick::computerVision::PixelRGBA<Type> const& color,
+               double weight)
+    {
+      pixel.red = privateCode::blendChannel(pixel.red, color.red, weight);
+      pixel.green = privateCode::blendChannel(
+        pixel.green, color.green, weight);
+      pixel.blue = privateCode::blendChannel(pixel.blue, color.blue, weight);
+      pixel.alpha = privateCode::blendChannel(
+        pixel.alpha, color.alpha, weight);
+    }
+
+  } // namespace pixelGraphics
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_PIXELGRAPHICS_RASTERIZER2D_IMPL_HH */
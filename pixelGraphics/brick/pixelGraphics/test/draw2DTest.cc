@@ -0,0 +1,249 @@
+/**
+***************************************************************************
+* @file brick/pixelGraphics/test/draw2DTest.cc
+*
+* Source file defining tests for the draw2D() functions.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/pixelGraphics/draw2D.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace pixelGraphics {
+
+    class Draw2DTest : public brick::test::TestFixture<Draw2DTest> {
+
+    public:
+
+      Draw2DTest();
+      ~Draw2DTest() {}
+
+      void setUp(const std::string& /* testName */) {m_seed = 1u;}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testDraw2D();
+      void testDraw2DBatch();
+      void testDraw2DBatchTransformed();
+
+    private:
+
+      // Draw segments into a fresh canvas one at a time, then again
+      // using the batch version of draw2D(), and make sure the two
+      // results are the same.
+      bool
+      compareBatch(
+        std::vector< brick::geometry::LineSegment2D<double> > const& segments,
+        brick::numeric::Transform2D<double> const& pixelFromWorld);
+
+      std::vector< brick::geometry::LineSegment2D<double> >
+      getTestSegments();
+
+      double
+      getRandom();
+
+      unsigned int m_seed;
+
+    }; // class Draw2DTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    Draw2DTest::
+    Draw2DTest()
+      : brick::test::TestFixture<Draw2DTest>("Draw2DTest"),
+        m_seed(1u)
+    {
+      BRICK_TEST_REGISTER_MEMBER(testDraw2D);
+      BRICK_TEST_REGISTER_MEMBER(testDraw2DBatch);
+      BRICK_TEST_REGISTER_MEMBER(testDraw2DBatchTransformed);
+    }
+
+
+    void
+    Draw2DTest::
+    testDraw2D()
+    {
+      brick::common::UInt8 const color = 255;
+      brick::numeric::Array2D<brick::common::UInt8> canvas(20, 30);
+
+      // A horizontal segment visits each pixel it passes through,
+      // and stops at its end point.
+      canvas = brick::common::UInt8(0);
+      draw2D(canvas,
+             brick::geometry::LineSegment2D<double>(2.2, 5.5, 9.7, 5.5),
+             color);
+      for(std::size_t row = 0; row < canvas.rows(); ++row) {
+        for(std::size_t column = 0; column < canvas.columns(); ++column) {
+          bool isOn = (row == 5 && column >= 2 && column <= 9);
+          BRICK_TEST_ASSERT(canvas(row, column) == (isOn ? color : 0));
+        }
+      }
+
+      // A segment that starts off the canvas is clipped.
+      canvas = brick::common::UInt8(0);
+      draw2D(canvas,
+             brick::geometry::LineSegment2D<double>(12.5, -10.0, 12.5, 3.5),
+             color);
+      for(std::size_t row = 0; row < canvas.rows(); ++row) {
+        for(std::size_t column = 0; column < canvas.columns(); ++column) {
+          bool isOn = (column == 12 && row <= 3);
+          BRICK_TEST_ASSERT(canvas(row, column) == (isOn ? color : 0));
+        }
+      }
+
+      // A segment that ends before it reaches the canvas draws
+      // nothing, even though the line it lies on crosses the canvas.
+      canvas = brick::common::UInt8(0);
+      draw2D(canvas,
+             brick::geometry::LineSegment2D<double>(-8.0, -2.0, 10.0, -1.0),
+             color);
+      for(std::size_t ii = 0; ii < canvas.size(); ++ii) {
+        BRICK_TEST_ASSERT(canvas[ii] == 0);
+      }
+    }
+
+
+    void
+    Draw2DTest::
+    testDraw2DBatch()
+    {
+      BRICK_TEST_ASSERT(
+        this->compareBatch(this->getTestSegments(),
+                           brick::numeric::Transform2D<double>()));
+    }
+
+
+    void
+    Draw2DTest::
+    testDraw2DBatchTransformed()
+    {
+      // Scaling up pushes more of the segments off the canvas.
+      brick::numeric::Transform2D<double> pixelFromWorld(
+        2.0, 0.0, -3.0,
+        0.0, 2.0, 1.0,
+        0.0, 0.0, 1.0);
+      BRICK_TEST_ASSERT(
+        this->compareBatch(this->getTestSegments(), pixelFromWorld));
+    }
+
+
+    bool
+    Draw2DTest::
+    compareBatch(
+      std::vector< brick::geometry::LineSegment2D<double> > const& segments,
+      brick::numeric::Transform2D<double> const& pixelFromWorld)
+    {
+      brick::common::UInt8 const color = 255;
+      brick::numeric::Array2D<brick::common::UInt8> singleCanvas(20, 30);
+      brick::numeric::Array2D<brick::common::UInt8> batchCanvas(20, 30);
+      singleCanvas = brick::common::UInt8(0);
+      batchCanvas = brick::common::UInt8(0);
+
+      for(std::size_t ii = 0; ii < segments.size(); ++ii) {
+        draw2D(singleCanvas, segments[ii], color, pixelFromWorld);
+      }
+      draw2D(batchCanvas, segments, color, pixelFromWorld);
+
+      // Make sure the comparison isn't trivial.
+      std::size_t numberOfPaintedPixels = 0;
+      for(std::size_t ii = 0; ii < singleCanvas.size(); ++ii) {
+        if(singleCanvas[ii] != 0) {
+          ++numberOfPaintedPixels;
+        }
+      }
+      if(numberOfPaintedPixels < 50) {
+        return false;
+      }
+
+      for(std::size_t ii = 0; ii < singleCanvas.size(); ++ii) {
+        if(singleCanvas[ii] != batchCanvas[ii]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    std::vector< brick::geometry::LineSegment2D<double> >
+    Draw2DTest::
+    getTestSegments()
+    {
+      // These coordinates assume a 20 row by 30 column canvas.
+      typedef brick::geometry::LineSegment2D<double> Segment;
+      std::vector<Segment> segments;
+
+      // Entirely inside the canvas.
+      segments.push_back(Segment(3.2, 4.7, 17.9, 12.3));
+
+      // Clipped by one or two edges of the canvas.
+      segments.push_back(Segment(-5.0, 3.5, 10.2, 8.1));
+      segments.push_back(Segment(25.3, -4.0, 35.0, 15.0));
+      segments.push_back(Segment(12.5, 25.0, 14.5, -3.0));
+      segments.push_back(Segment(29.0, 19.0, 35.0, 25.0));
+
+      // Entirely outside the canvas.
+      segments.push_back(Segment(40.0, 5.0, 50.0, 10.0));
+      segments.push_back(Segment(-8.0, -2.0, 10.0, -1.0));
+
+      // Touching or running along the edges of the canvas.
+      segments.push_back(Segment(0.0, 0.0, 30.0, 20.0));
+      segments.push_back(Segment(0.0, 0.5, 29.9, 0.5));
+      segments.push_back(Segment(29.5, 0.0, 29.5, 20.0));
+      segments.push_back(Segment(30.0, 10.0, 15.0, 19.9));
+      segments.push_back(Segment(5.0, 20.0, 15.0, 10.0));
+      segments.push_back(Segment(0.0, 19.5, 8.0, 19.5));
+
+      // And a bunch of arbitrary segments, many of which overlap
+      // the ones above.
+      for(int ii = 0; ii < 40; ++ii) {
+        segments.push_back(
+          Segment(15.0 + 25.0 * this->getRandom(),
+                  10.0 + 20.0 * this->getRandom(),
+                  15.0 + 25.0 * this->getRandom(),
+                  10.0 + 20.0 * this->getRandom()));
+      }
+      return segments;
+    }
+
+
+    double
+    Draw2DTest::
+    getRandom()
+    {
+      m_seed = m_seed * 1103515245u + 12345u;
+      return static_cast<double>((m_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+    }
+
+  } // namespace pixelGraphics
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::pixelGraphics::Draw2DTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::pixelGraphics::Draw2DTest currentTest;
+
+}
+
+#endif
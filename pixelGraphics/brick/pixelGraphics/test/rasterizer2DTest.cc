@@ -0,0 +1,618 @@
+/**
+***************************************************************************
+* @file brick/pixelGraphics/test/rasterizer2DTest.cc
+*
+* Source file defining tests for the Rasterizer2D class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <brick/common/types.hh>
+#include <brick/computerVision/pixelRGB.hh>
+#include <brick/computerVision/pixelRGBA.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/pixelGraphics/rasterizer2D.hh>
+#include <brick/test/testFixture.hh>
+
+namespace brick {
+
+  namespace pixelGraphics {
+
+    class Rasterizer2DTest
+      : public brick::test::TestFixture<Rasterizer2DTest> {
+
+    public:
+
+      typedef brick::common::UInt8 Gray8;
+      typedef brick::computerVision::PixelRGB8 RGB8;
+      typedef brick::computerVision::PixelRGBA8 RGBA8;
+
+      Rasterizer2DTest();
+      ~Rasterizer2DTest() {}
+
+      void setUp(const std::string& /* testName */) {m_seed = 1u;}
+      void tearDown(const std::string& /* testName */) {}
+
+      // Tests.
+      void testAliasedLine();
+      void testAntialiasedLine();
+      void testBlendPixel();
+      void testBullseye();
+      void testCircle();
+      void testClear();
+      void testEllipse();
+      void testPolygonEvenOdd();
+      void testRenderAlpha();
+      void testRenderNumberOfThreads();
+
+    private:
+
+      // Make sure every pixel of canvas is within tolerance of the
+      // rendering of a circle of the specified radius, either filled
+      // (lineWidth == 0) or outlined.
+      bool
+      checkCircle(brick::numeric::Array2D<Gray8> const& canvas,
+                  double centerX, double centerY, double radius,
+                  double lineWidth, Gray8 color);
+
+      template <class PixelType>
+      bool
+      isEqual(brick::numeric::Array2D<PixelType> const& array0,
+              brick::numeric::Array2D<PixelType> const& array1);
+
+      double
+      getRandom();
+
+      unsigned int m_seed;
+
+    }; // class Rasterizer2DTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    Rasterizer2DTest::
+    Rasterizer2DTest()
+      : brick::test::TestFixture<Rasterizer2DTest>("Rasterizer2DTest"),
+        m_seed(1u)
+    {
+      BRICK_TEST_REGISTER_MEMBER(testAliasedLine);
+      BRICK_TEST_REGISTER_MEMBER(testAntialiasedLine);
+      BRICK_TEST_REGISTER_MEMBER(testBlendPixel);
+      BRICK_TEST_REGISTER_MEMBER(testBullseye);
+      BRICK_TEST_REGISTER_MEMBER(testCircle);
+      BRICK_TEST_REGISTER_MEMBER(testClear);
+      BRICK_TEST_REGISTER_MEMBER(testEllipse);
+      BRICK_TEST_REGISTER_MEMBER(testPolygonEvenOdd);
+      BRICK_TEST_REGISTER_MEMBER(testRenderAlpha);
+      BRICK_TEST_REGISTER_MEMBER(testRenderNumberOfThreads);
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testAliasedLine()
+    {
+      Gray8 const color = 200;
+      Rasterizer2D<Gray8> rasterizer(8);
+
+      // A horizontal line through pixel centers, a diagonal line
+      // specified from its far end, and a steep line that has to
+      // step over one column halfway down.
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(2.5, 3.5, 10.5, 3.5),
+        color, 1.0, false);
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(6.5, 6.5, 1.5, 1.5),
+        color, 1.0, false);
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(14.5, 0.5, 15.5, 10.5),
+        color, 1.0, false);
+
+      brick::numeric::Array2D<Gray8> canvas(16, 20);
+      canvas = Gray8(0);
+      rasterizer.render(canvas, 1);
+
+      brick::numeric::Array2D<Gray8> referenceCanvas(16, 20);
+      referenceCanvas = Gray8(0);
+      for(int column = 2; column <= 10; ++column) {
+        referenceCanvas(3, column) = color;
+      }
+      for(int ii = 1; ii <= 6; ++ii) {
+        referenceCanvas(ii, ii) = color;
+      }
+      for(int row = 0; row <= 10; ++row) {
+        referenceCanvas(row, (row < 5) ? 14 : 15) = color;
+      }
+      BRICK_TEST_ASSERT(this->isEqual(canvas, referenceCanvas));
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testAntialiasedLine()
+    {
+      Gray8 const color = 200;
+      Rasterizer2D<Gray8> rasterizer(8);
+
+      // A horizontal line through pixel centers covers exactly one
+      // row.  One that runs between two rows of pixel centers is
+      // split evenly between them.  Either way, the end pixels are
+      // only half covered along the line.
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(2.5, 3.5, 10.5, 3.5),
+        color, 1.0, true);
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(10.5, 8.0, 2.5, 8.0),
+        color, 1.0, true);
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(14.5, 0.5, 14.5, 10.5),
+        color, 1.0, true);
+
+      brick::numeric::Array2D<Gray8> canvas(16, 20);
+      canvas = Gray8(0);
+      rasterizer.render(canvas, 1);
+
+      brick::numeric::Array2D<Gray8> referenceCanvas(16, 20);
+      referenceCanvas = Gray8(0);
+      for(int column = 2; column <= 10; ++column) {
+        bool isEnd = (column == 2 || column == 10);
+        referenceCanvas(3, column) = isEnd ? 100 : 200;
+        referenceCanvas(7, column) = isEnd ? 50 : 100;
+        referenceCanvas(8, column) = isEnd ? 50 : 100;
+      }
+      for(int row = 0; row <= 10; ++row) {
+        referenceCanvas(row, 14) = (row == 0 || row == 10) ? 100 : 200;
+      }
+      BRICK_TEST_ASSERT(this->isEqual(canvas, referenceCanvas));
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testBlendPixel()
+    {
+      // Integer channels are rounded, not truncated.
+      Gray8 gray = 100;
+      blendPixel(gray, Gray8(200), 0.25);
+      BRICK_TEST_ASSERT(gray == 125);
+      gray = 0;
+      blendPixel(gray, Gray8(255), 0.5);
+      BRICK_TEST_ASSERT(gray == 128);
+
+      RGB8 rgb(0, 100, 255);
+      blendPixel(rgb, RGB8(255, 0, 255), 0.5);
+      BRICK_TEST_ASSERT(rgb == RGB8(128, 50, 255));
+
+      RGBA8 rgba(10, 20, 30, 0);
+      blendPixel(rgba, RGBA8(110, 220, 30, 255), 0.1);
+      BRICK_TEST_ASSERT(rgba == RGBA8(20, 40, 30, 26));
+
+      // Floating point channels are not rounded.
+      float grayFloat = 1.0f;
+      blendPixel(grayFloat, 2.0f, 0.25);
+      BRICK_TEST_ASSERT(grayFloat == 1.25f);
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testBullseye()
+    {
+      Gray8 const color = 200;
+      std::vector<double> scales;
+      scales.push_back(0.5);
+      scales.push_back(1.0);
+      brick::geometry::Ellipse2D<double> ellipse(
+        brick::numeric::Vector2D<double>(16.0, 16.0),
+        brick::numeric::Vector2D<double>(8.0, 0.0), 1.0);
+      brick::geometry::Bullseye2D<double> bullseye(
+        ellipse, scales.begin(), scales.end());
+
+      Rasterizer2D<Gray8> rasterizer(8);
+      rasterizer.addBullseye(bullseye, color, 1.0, 1.0);
+      BRICK_TEST_ASSERT(rasterizer.getNumberOfPrimitives() == 2);
+
+      brick::numeric::Array2D<Gray8> canvas(32, 32);
+      canvas = Gray8(0);
+      rasterizer.render(canvas, 1);
+
+      // The rings are far enough apart that they don't overlap, so
+      // each pixel should match one ring or the other.
+      brick::numeric::Array2D<Gray8> innerCanvas(32, 32);
+      brick::numeric::Array2D<Gray8> outerCanvas(32, 32);
+      for(std::size_t ii = 0; ii < canvas.size(); ++ii) {
+        bool isOuter = std::sqrt(
+          (ii / 32 + 0.5 - 16.0) * (ii / 32 + 0.5 - 16.0)
+          + (ii % 32 + 0.5 - 16.0) * (ii % 32 + 0.5 - 16.0)) > 6.0;
+        innerCanvas[ii] = isOuter ? Gray8(0) : canvas[ii];
+        outerCanvas[ii] = isOuter ? canvas[ii] : Gray8(0);
+      }
+      BRICK_TEST_ASSERT(
+        this->checkCircle(innerCanvas, 16.0, 16.0, 4.0, 1.0, color));
+      BRICK_TEST_ASSERT(
+        this->checkCircle(outerCanvas, 16.0, 16.0, 8.0, 1.0, color));
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testCircle()
+    {
+      Gray8 const color = 200;
+      brick::geometry::Circle2D<double> circle(
+        brick::numeric::Vector2D<double>(16.0, 15.0), 6.0);
+
+      Rasterizer2D<Gray8> filledRasterizer(8);
+      filledRasterizer.addCircle(circle, color, 1.0, 0.0);
+      brick::numeric::Array2D<Gray8> canvas(32, 32);
+      canvas = Gray8(0);
+      filledRasterizer.render(canvas, 1);
+      BRICK_TEST_ASSERT(
+        this->checkCircle(canvas, 16.0, 15.0, 6.0, 0.0, color));
+      BRICK_TEST_ASSERT(canvas(15, 16) == color);
+      BRICK_TEST_ASSERT(canvas(15, 24) == 0);
+
+      Rasterizer2D<Gray8> outlineRasterizer(8);
+      outlineRasterizer.addCircle(circle, color, 1.0, 2.0);
+      canvas = Gray8(0);
+      outlineRasterizer.render(canvas, 1);
+      BRICK_TEST_ASSERT(
+        this->checkCircle(canvas, 16.0, 15.0, 6.0, 2.0, color));
+      BRICK_TEST_ASSERT(canvas(15, 16) == 0);
+      BRICK_TEST_ASSERT(canvas(15, 24) == 0);
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testClear()
+    {
+      Rasterizer2D<Gray8> rasterizer(8);
+      rasterizer.addCircle(
+        brick::geometry::Circle2D<double>(
+          brick::numeric::Vector2D<double>(8.0, 8.0), 4.0),
+        Gray8(200));
+      rasterizer.addLine(
+        brick::geometry::LineSegment2D<double>(0.0, 0.0, 10.0, 5.0),
+        Gray8(200));
+      BRICK_TEST_ASSERT(rasterizer.getNumberOfPrimitives() == 2);
+
+      rasterizer.clear();
+      BRICK_TEST_ASSERT(rasterizer.getNumberOfPrimitives() == 0);
+
+      brick::numeric::Array2D<Gray8> canvas(16, 16);
+      canvas = Gray8(7);
+      rasterizer.render(canvas, 1);
+      for(std::size_t ii = 0; ii < canvas.size(); ++ii) {
+        BRICK_TEST_ASSERT(canvas[ii] == 7);
+      }
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testEllipse()
+    {
+      // Center the ellipse on pixel (16, 20), with semi-axes of
+      // length 8 along the columns and 4 along the rows.  Along the
+      // axes, the estimated distance to the boundary is exact.
+      Gray8 const color = 200;
+      brick::geometry::Ellipse2D<double> ellipse(
+        brick::numeric::Vector2D<double>(20.5, 16.5),
+        brick::numeric::Vector2D<double>(8.0, 0.0), 0.5);
+
+      Rasterizer2D<Gray8> filledRasterizer(8);
+      filledRasterizer.addEllipse(ellipse, color, 1.0, 0.0);
+      brick::numeric::Array2D<Gray8> canvas(32, 40);
+      canvas = Gray8(0);
+      filledRasterizer.render(canvas, 1);
+      for(int offset = -10; offset <= 10; ++offset) {
+        int absOffset = (offset < 0) ? -offset : offset;
+        Gray8 expected = (absOffset < 8) ? 200 : ((absOffset == 8) ? 100 : 0);
+        BRICK_TEST_ASSERT(canvas(16, 20 + offset) == expected);
+        if(absOffset <= 6) {
+          expected = (absOffset < 4) ? 200 : ((absOffset == 4) ? 100 : 0);
+          BRICK_TEST_ASSERT(canvas(16 + offset, 20) == expected);
+        }
+      }
+
+      // Filled ellipses are symmetric about their centers.
+      for(int row = 1; row < 32; ++row) {
+        for(int column = 1; column < 40; ++column) {
+          BRICK_TEST_ASSERT(
+            canvas(row, column) == canvas(32 - row, 40 - column));
+        }
+      }
+
+      Rasterizer2D<Gray8> outlineRasterizer(8);
+      outlineRasterizer.addEllipse(ellipse, color, 1.0, 1.0);
+      canvas = Gray8(0);
+      outlineRasterizer.render(canvas, 1);
+      for(int offset = -10; offset <= 10; ++offset) {
+        int absOffset = (offset < 0) ? -offset : offset;
+        Gray8 expected = (absOffset == 8) ? 200 : 0;
+        BRICK_TEST_ASSERT(canvas(16, 20 + offset) == expected);
+        if(absOffset <= 6) {
+          expected = (absOffset == 4) ? 200 : 0;
+          BRICK_TEST_ASSERT(canvas(16 + offset, 20) == expected);
+        }
+      }
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testPolygonEvenOdd()
+    {
+      // A square with a square hole, drawn as a single polygon by
+      // tracing out to the inner square and back along the same
+      // diagonal.  The even-odd rule leaves the hole empty.
+      std::vector< brick::numeric::Vector2D<double> > vertices;
+      vertices.push_back(brick::numeric::Vector2D<double>(2.0, 2.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(12.0, 2.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(12.0, 12.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(2.0, 12.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(2.0, 2.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(5.0, 5.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(9.0, 5.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(9.0, 9.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(5.0, 9.0));
+      vertices.push_back(brick::numeric::Vector2D<double>(5.0, 5.0));
+
+      // A self-intersecting bowtie, whose two lobes are filled.
+      std::vector< brick::numeric::Vector2D<double> > bowtie;
+      bowtie.push_back(brick::numeric::Vector2D<double>(14.0, 2.0));
+      bowtie.push_back(brick::numeric::Vector2D<double>(22.0, 10.0));
+      bowtie.push_back(brick::numeric::Vector2D<double>(22.0, 2.0));
+      bowtie.push_back(brick::numeric::Vector2D<double>(14.0, 10.0));
+
+      Gray8 const color = 200;
+      Rasterizer2D<Gray8> rasterizer(8);
+      rasterizer.addPolygon(vertices, color);
+      rasterizer.addPolygon(bowtie, color);
+      brick::numeric::Array2D<Gray8> canvas(16, 24);
+      canvas = Gray8(0);
+      rasterizer.render(canvas, 1);
+
+      for(int row = 0; row < 16; ++row) {
+        for(int column = 0; column < 14; ++column) {
+          bool isInside = (row >= 2 && row <= 11
+                           && column >= 2 && column <= 11);
+          bool isInHole = (row >= 5 && row <= 8
+                           && column >= 5 && column <= 8);
+          Gray8 expected = (isInside && !isInHole) ? color : 0;
+          BRICK_TEST_ASSERT(canvas(row, column) == expected);
+        }
+      }
+      for(int row = 0; row < 16; ++row) {
+        for(int column = 14; column < 24; ++column) {
+          // The bowtie's lobes lie between its diagonals, to the
+          // left and right of the crossing at (18, 6).  As with the
+          // square, pixel centers on a left edge are inside, and
+          // those on a right edge are outside.
+          double dx = column + 0.5 - 18.0;
+          double dy = row + 0.5 - 6.0;
+          bool isInside = (row >= 2 && row <= 9
+                           && ((dx >= -4.0 && dx < -std::fabs(dy))
+                               || (dx >= std::fabs(dy) && dx < 4.0)));
+          Gray8 expected = isInside ? color : 0;
+          BRICK_TEST_ASSERT(canvas(row, column) == expected);
+        }
+      }
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testRenderAlpha()
+    {
+      std::vector< brick::numeric::Vector2D<double> > square;
+      square.push_back(brick::numeric::Vector2D<double>(2.0, 2.0));
+      square.push_back(brick::numeric::Vector2D<double>(6.0, 2.0));
+      square.push_back(brick::numeric::Vector2D<double>(6.0, 6.0));
+      square.push_back(brick::numeric::Vector2D<double>(2.0, 6.0));
+
+      // Primitives are blended in the order they were added.
+      Rasterizer2D<Gray8> grayRasterizer(4);
+      grayRasterizer.addPolygon(square, Gray8(200), 0.5);
+      grayRasterizer.addPolygon(square, Gray8(0), 0.5);
+      brick::numeric::Array2D<Gray8> grayCanvas(8, 8);
+      grayCanvas = Gray8(0);
+      grayRasterizer.render(grayCanvas, 1);
+      BRICK_TEST_ASSERT(grayCanvas(3, 3) == 50);
+      BRICK_TEST_ASSERT(grayCanvas(1, 1) == 0);
+
+      Rasterizer2D<RGB8> rgbRasterizer(4);
+      rgbRasterizer.addPolygon(square, RGB8(255, 0, 255), 0.5);
+      brick::numeric::Array2D<RGB8> rgbCanvas(8, 8);
+      rgbCanvas = RGB8(0, 100, 255);
+      rgbRasterizer.render(rgbCanvas, 1);
+      BRICK_TEST_ASSERT(rgbCanvas(3, 3) == RGB8(128, 50, 255));
+      BRICK_TEST_ASSERT(rgbCanvas(1, 1) == RGB8(0, 100, 255));
+
+      Rasterizer2D<RGBA8> rgbaRasterizer(4);
+      rgbaRasterizer.addPolygon(square, RGBA8(110, 220, 30, 255), 0.1);
+      brick::numeric::Array2D<RGBA8> rgbaCanvas(8, 8);
+      rgbaCanvas = RGBA8(10, 20, 30, 0);
+      rgbaRasterizer.render(rgbaCanvas, 1);
+      BRICK_TEST_ASSERT(rgbaCanvas(3, 3) == RGBA8(20, 40, 30, 26));
+      BRICK_TEST_ASSERT(rgbaCanvas(1, 1) == RGBA8(10, 20, 30, 0));
+    }
+
+
+    void
+    Rasterizer2DTest::
+    testRenderNumberOfThreads()
+    {
+      // Lots of overlapping, translucent primitives, some of which
+      // hang off the edges of the canvas.  The tiles are small so
+      // that most primitives span several of them.
+      std::size_t const rows = 70;
+      std::size_t const columns = 90;
+      Rasterizer2D<RGB8> rasterizer(16);
+      Rasterizer2D<RGB8> oneTileRasterizer(1000);
+      for(int ii = 0; ii < 60; ++ii) {
+        RGB8 color(static_cast<brick::common::UInt8>(128 + 127 * getRandom()),
+                   static_cast<brick::common::UInt8>(128 + 127 * getRandom()),
+                   static_cast<brick::common::UInt8>(128 + 127 * getRandom()));
+        double alpha = 0.65 + 0.35 * getRandom();
+        brick::numeric::Vector2D<double> point0(
+          45.0 + 55.0 * getRandom(), 35.0 + 45.0 * getRandom());
+        brick::numeric::Vector2D<double> point1(
+          45.0 + 55.0 * getRandom(), 35.0 + 45.0 * getRandom());
+        brick::numeric::Vector2D<double> point2(
+          45.0 + 55.0 * getRandom(), 35.0 + 45.0 * getRandom());
+        double size = 12.0 + 10.0 * getRandom();
+        for(int jj = 0; jj < 2; ++jj) {
+          Rasterizer2D<RGB8>& target = (jj == 0) ? rasterizer
+            : oneTileRasterizer;
+          switch(ii % 6) {
+          case 0:
+            target.addLine(brick::geometry::LineSegment2D<double>(
+                             point0, point1), color, alpha, false);
+            break;
+          case 1:
+            target.addLine(brick::geometry::LineSegment2D<double>(
+                             point0, point1), color, alpha, true);
+            break;
+          case 2:
+            target.addCircle(
+              brick::geometry::Circle2D<double>(point0, size), color,
+              alpha, (ii % 4 == 0) ? 0.0 : 3.0);
+            break;
+          case 3:
+            target.addEllipse(
+              brick::geometry::Ellipse2D<double>(
+                point0, point1 - point2, 0.7), color, alpha,
+              (ii % 4 == 1) ? 0.0 : 2.0);
+            break;
+          case 4:
+            target.addTriangle(
+              brick::geometry::Triangle2D<double>(point0, point1, point2),
+              color, alpha);
+            break;
+          default: {
+            std::vector< brick::numeric::Vector2D<double> > vertices;
+            vertices.push_back(point0);
+            vertices.push_back(point1);
+            vertices.push_back(point2);
+            vertices.push_back(point0 + brick::numeric::Vector2D<double>(
+                                 size, 0.0));
+            target.addPolygon(vertices, color, alpha);
+            break;
+          }
+          }
+        }
+      }
+
+      brick::numeric::Array2D<RGB8> referenceCanvas(rows, columns);
+      referenceCanvas = RGB8(10, 20, 30);
+      rasterizer.render(referenceCanvas, 1);
+
+      // Make sure the primitives actually drew something.
+      std::size_t numberOfPaintedPixels = 0;
+      for(std::size_t ii = 0; ii < referenceCanvas.size(); ++ii) {
+        if(!(referenceCanvas[ii] == RGB8(10, 20, 30))) {
+          ++numberOfPaintedPixels;
+        }
+      }
+      BRICK_TEST_ASSERT(numberOfPaintedPixels > referenceCanvas.size() / 4);
+
+      std::size_t const threadCounts[] = {2, 3, 4, 8, 0};
+      for(std::size_t ii = 0; ii < 5; ++ii) {
+        brick::numeric::Array2D<RGB8> canvas(rows, columns);
+        canvas = RGB8(10, 20, 30);
+        rasterizer.render(canvas, threadCounts[ii]);
+        BRICK_TEST_ASSERT(this->isEqual(canvas, referenceCanvas));
+      }
+
+      // Splitting into tiles shouldn't change anything either.
+      brick::numeric::Array2D<RGB8> canvas(rows, columns);
+      canvas = RGB8(10, 20, 30);
+      oneTileRasterizer.render(canvas, 1);
+      BRICK_TEST_ASSERT(this->isEqual(canvas, referenceCanvas));
+    }
+
+
+    bool
+    Rasterizer2DTest::
+    checkCircle(brick::numeric::Array2D<Gray8> const& canvas,
+                double centerX, double centerY, double radius,
+                double lineWidth, Gray8 color)
+    {
+      for(std::size_t row = 0; row < canvas.rows(); ++row) {
+        for(std::size_t column = 0; column < canvas.columns(); ++column) {
+          double dx = column + 0.5 - centerX;
+          double dy = row + 0.5 - centerY;
+          double distance = std::sqrt(dx * dx + dy * dy) - radius;
+          double coverage = ((lineWidth <= 0.0) ? 0.5 - distance
+                             : lineWidth / 2.0 + 0.5 - std::fabs(distance));
+          coverage = std::min(std::max(coverage, 0.0), 1.0);
+          double expected = coverage * color;
+
+          // Allow for rounding in either direction.
+          if(std::fabs(canvas(row, column) - expected) > 1.0) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+
+    template <class PixelType>
+    bool
+    Rasterizer2DTest::
+    isEqual(brick::numeric::Array2D<PixelType> const& array0,
+            brick::numeric::Array2D<PixelType> const& array1)
+    {
+      if(array0.rows() != array1.rows()
+         || array0.columns() != array1.columns()) {
+        return false;
+      }
+      for(std::size_t ii = 0; ii < array0.size(); ++ii) {
+        if(!(array0[ii] == array1[ii])) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    double
+    Rasterizer2DTest::
+    getRandom()
+    {
+      m_seed = m_seed * 1103515245u + 12345u;
+      return static_cast<double>((m_seed >> 8) & 0xffff) / 32768.0 - 1.0;
+    }
+
+  } // namespace pixelGraphics
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::pixelGraphics::Rasterizer2DTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::pixelGraphics::Rasterizer2DTest currentTest;
+
+}
+
+#endif
@@ -0,0 +1,198 @@
+/**
+***************************************************************************
+* @file brick/utilities/framePool.hh
+*
+* Header file declaring the FramePool class template.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_UTILITIES_FRAMEPOOL_HH
+#define BRICK_UTILITIES_FRAMEPOOL_HH
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace brick {
+
+  namespace utilities {
+
+    /**
+     ** The FramePool class template preallocates a fixed number of
+     ** reference counted frame buffers (typically
+     ** brick::computerVision::Image or brick::numeric::Array2D
+     ** instances) and hands them out for reuse.  A frame is available
+     ** again as soon as every handle to it other than the pool's own
+     ** has been destroyed or reassigned, so there is no explicit
+     ** release call.  Once the pool is built, a pipeline that gets its
+     ** buffers from acquire() and passes them between threads using
+     ** RingBufferSPSC or RingBufferMPMC runs without allocating
+     ** memory.
+     **
+     ** Stages must write into acquired frames in place (for example,
+     ** using copy(), or functions that accept an output image
+     ** argument).  Assigning a newly allocated image to an acquired
+     ** handle simply detaches that handle from the pool.
+     **
+     ** FrameType must be constructible from (rows, columns), and must
+     ** provide getReferenceCount(), as Array2D does.  Acquiring is
+     ** protected by a mutex, so any thread may call acquire().
+     **/
+    template <class FrameType>
+    class FramePool {
+    public:
+
+      /**
+       * The constructor allocates all of the frames in the pool.
+       *
+       * @param numberOfFrames This argument specifies how many frames
+       * to allocate.  It should be at least the total capacity of the
+       * queues in the pipeline, plus the number of frames each stage
+       * holds at once.
+       *
+       * @param rows This argument specifies the number of rows in
+       * each frame.
+       *
+       * @param columns This argument specifies the number of columns
+       * in each frame.
+       */
+      FramePool(size_t numberOfFrames, size_t rows, size_t columns);
+
+
+      /**
+       * This member function finds a frame that is not in use, and
+       * returns a handle to it.  It never blocks waiting for a frame
+       * to become available.
+       *
+       * @param frame This argument is used to return the frame.  It
+       * is left unchanged if no frame is available.  The contents of
+       * the frame are whatever the previous user left there.
+       *
+       * @return true if a frame was acquired, false if all frames are
+       * in use.
+       */
+      bool
+      acquire(FrameType& frame);
+
+
+      /**
+       * This member function returns the number of frames that are
+       * not currently in use.  If other threads are active, the
+       * answer may be stale by the time it is returned.
+       *
+       * @return The number of frames acquire() could hand out.
+       */
+      size_t
+      getNumberOfAvailableFrames() const;
+
+
+      /**
+       * This member function returns the total number of frames
+       * managed by the pool.
+       *
+       * @return The number of frames allocated by the constructor.
+       */
+      size_t
+      getNumberOfFrames() const {return m_frames.size();}
+
+
+      /**
+       * This member function returns the number of calls to
+       * acquire() that failed because every frame was in use.  A
+       * nonzero value suggests the pool is too small, or that a
+       * downstream stage is falling behind.
+       *
+       * @return The number of failed acquisitions.
+       */
+      size_t
+      getNumberOfStarvations() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numberOfStarvations;
+      }
+
+    private:
+
+      // The pool owns its frames, so it must not be copied.
+      FramePool(FramePool const&);
+      FramePool& operator=(FramePool const&);
+
+      std::vector<FrameType> m_frames;
+      mutable std::mutex m_mutex;
+      size_t m_nextIndex;
+      size_t m_numberOfStarvations;
+    };
+
+  } // namespace utilities
+
+} // namespace brick
+
+
+/* ========= Definitions of inline and template functions below. ========== */
+
+namespace brick {
+
+  namespace utilities {
+
+    template <class FrameType>
+    FramePool<FrameType>::
+    FramePool(size_t numberOfFrames, size_t rows, size_t columns)
+      : m_frames(),
+        m_mutex(),
+        m_nextIndex(0),
+        m_numberOfStarvations(0)
+    {
+      m_frames.reserve(numberOfFrames);
+      for(size_t ii = 0; ii < numberOfFrames; ++ii) {
+        m_frames.push_back(FrameType(rows, columns));
+      }
+    }
+
+
+    template <class FrameType>
+    bool
+    FramePool<FrameType>::
+    acquire(FrameType& frame)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      // A count of 1 means the pool holds the only handle.  Nobody
+      // else can make a new copy of a handle they don't have, so the
+      // count can't go back up between this test and our copy.
+      size_t const numberOfFrames = m_frames.size();
+      for(size_t ii = 0; ii < numberOfFrames; ++ii) {
+        size_t index = (m_nextIndex + ii) % numberOfFrames;
+        if(m_frames[index].getReferenceCount().getCount() == 1) {
+          frame = m_frames[index];
+          m_nextIndex = (index + 1) % numberOfFrames;
+          return true;
+        }
+      }
+      ++m_numberOfStarvations;
+      return false;
+    }
+
+
+    template <class FrameType>
+    size_t
+    FramePool<FrameType>::
+    getNumberOfAvailableFrames() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      size_t count = 0;
+      for(size_t ii = 0; ii < m_frames.size(); ++ii) {
+        if(m_frames[ii].getReferenceCount().getCount() == 1) {
+          ++count;
+        }
+      }
+      return count;
+    }
+
+  } // namespace utilities
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_UTILITIES_FRAMEPOOL_HH */
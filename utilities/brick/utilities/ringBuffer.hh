@@ -0,0 +1,521 @@
+/**
+***************************************************************************
+* @file brick/utilities/ringBuffer.hh
+*
+* Header file declaring fixed-capacity, lock-free queues for passing
+* values (typically reference counted image handles) between threads.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_UTILITIES_RINGBUFFER_HH
+#define BRICK_UTILITIES_RINGBUFFER_HH
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace brick {
+
+  namespace utilities {
+
+    /**
+     ** The RingBufferSPSC class template is a bounded, lock-free queue
+     ** connecting exactly one producer thread to exactly one consumer
+     ** thread.  All storage is allocated by the constructor, so
+     ** pushing and popping never touch the heap.  It is intended for
+     ** moving frames between the stages of a streaming pipeline:
+     **
+     ** @code
+     **   RingBufferSPSC< Image<GRAY8> > queue(8);
+     **
+     **   // Producer thread.
+     **   Image<GRAY8> frame;
+     **   if(pool.acquire(frame)) {
+     **     camera.grab(frame);
+     **     while(!queue.tryPush(frame)) {std::this_thread::yield();}
+     **   }
+     **
+     **   // Consumer thread.
+     **   Image<GRAY8> frame;
+     **   if(queue.tryPop(frame)) {
+     **     process(frame);
+     **   }
+     ** @endcode
+     **
+     ** Popping clears the slot by assigning Type(), so that a popped
+     ** reference counted handle is held only by the consumer.  This
+     ** is what allows FramePool to recycle it as soon as the
+     ** consumer is finished.
+     **
+     ** Type must be default constructible and copy assignable.
+     **/
+    template <class Type>
+    class RingBufferSPSC {
+    public:
+
+      /**
+       * The constructor allocates all of the storage the queue will
+       * ever use.
+       *
+       * @param capacity This argument specifies the minimum number of
+       * elements the queue must be able to hold.  It is rounded up to
+       * the next power of two.
+       */
+      explicit
+      RingBufferSPSC(size_t capacity);
+
+
+      /**
+       * This member function returns the number of elements the
+       * queue can hold.
+       *
+       * @return The capacity, after rounding up.
+       */
+      size_t
+      capacity() const {return m_slots.size();}
+
+
+      /**
+       * This member function returns the largest number of elements
+       * that has been waiting in the queue at any time since
+       * construction, or since the last call to resetStatistics().
+       *
+       * @return The high water mark of the queue depth.
+       */
+      size_t
+      getMaximumDepth() const {return m_maximumDepth.load();}
+
+
+      /**
+       * This member function returns the number of calls to tryPush()
+       * that failed because the queue was full.
+       *
+       * @return The number of rejected pushes.
+       */
+      size_t
+      getNumberOfOverflows() const {return m_numberOfOverflows.load();}
+
+
+      /**
+       * This member function returns true if the queue is empty.  If
+       * the other thread is active, the answer may be stale by the
+       * time it is returned.
+       *
+       * @return true if there are no elements waiting.
+       */
+      bool
+      isEmpty() const {return this->size() == 0;}
+
+
+      /**
+       * This member function resets the counters returned by
+       * getMaximumDepth() and getNumberOfOverflows().
+       */
+      void
+      resetStatistics() {m_maximumDepth = 0; m_numberOfOverflows = 0;}
+
+
+      /**
+       * This member function returns the number of elements waiting
+       * in the queue.  If the other thread is active, the answer may
+       * be stale by the time it is returned.
+       *
+       * @return The current queue depth.
+       */
+      size_t
+      size() const {
+        // Read head first.  Tail never falls behind head, so this
+        // ordering can't produce a negative depth.
+        size_t head = m_head.load();
+        return m_tail.load() - head;
+      }
+
+
+      /**
+       * This member function removes the oldest element from the
+       * queue.  It must only be called from the consumer thread.
+       *
+       * @param value This argument is used to return the element.
+       * It is left unchanged if the queue is empty.
+       *
+       * @return true if an element was removed, false if the queue
+       * was empty.
+       */
+      bool
+      tryPop(Type& value);
+
+
+      /**
+       * This member function adds a copy of its argument to the
+       * queue.  It must only be called from the producer thread.
+       *
+       * @param value This argument is the element to be added.
+       *
+       * @return true if the element was added, false if the queue
+       * was full.
+       */
+      bool
+      tryPush(Type const& value);
+
+    private:
+
+      // The producer and consumer indices are written by different
+      // threads, so we keep them on separate cache lines to avoid
+      // false sharing.
+      static const size_t s_cacheLineSize = 64;
+
+      std::vector<Type> m_slots;
+      size_t m_mask;
+      std::atomic<size_t> m_maximumDepth;
+      std::atomic<size_t> m_numberOfOverflows;
+      char m_padding0[s_cacheLineSize];
+      std::atomic<size_t> m_head;
+      char m_padding1[s_cacheLineSize];
+      std::atomic<size_t> m_tail;
+      char m_padding2[s_cacheLineSize];
+    };
+
+
+    /**
+     ** The RingBufferMPMC class template is a bounded, lock-free queue
+     ** that may be shared by any number of producer and consumer
+     ** threads, for example to fan frames out to a pool of worker
+     ** threads.  It uses a sequence number per slot, following
+     ** D. Vyukov's bounded MPMC queue.  Like RingBufferSPSC, it
+     ** allocates all storage in its constructor, and clears slots as
+     ** they are popped.  When there is only one producer and one
+     ** consumer, prefer RingBufferSPSC, which is cheaper.
+     **
+     ** Type must be default constructible and copy assignable.
+     **/
+    template <class Type>
+    class RingBufferMPMC {
+    public:
+
+      /**
+       * The constructor allocates all of the storage the queue will
+       * ever use.
+       *
+       * @param capacity This argument specifies the minimum number of
+       * elements the queue must be able to hold.  It is rounded up to
+       * the next power of two.
+       */
+      explicit
+      RingBufferMPMC(size_t capacity);
+
+
+      /**
+       * This member function returns the number of elements the
+       * queue can hold.
+       *
+       * @return The capacity, after rounding up.
+       */
+      size_t
+      capacity() const {return m_cells.size();}
+
+
+      /**
+       * This member function returns the largest number of elements
+       * that has been waiting in the queue at any time since
+       * construction, or since the last call to resetStatistics().
+       *
+       * @return The high water mark of the queue depth.
+       */
+      size_t
+      getMaximumDepth() const {return m_maximumDepth.load();}
+
+
+      /**
+       * This member function returns the number of calls to tryPush()
+       * that failed because the queue was full.
+       *
+       * @return The number of rejected pushes.
+       */
+      size_t
+      getNumberOfOverflows() const {return m_numberOfOverflows.load();}
+
+
+      /**
+       * This member function returns true if the queue is empty.  If
+       * other threads are active, the answer may be stale by the
+       * time it is returned.
+       *
+       * @return true if there are no elements waiting.
+       */
+      bool
+      isEmpty() const {return this->size() == 0;}
+
+
+      /**
+       * This member function resets the counters returned by
+       * getMaximumDepth() and getNumberOfOverflows().
+       */
+      void
+      resetStatistics() {m_maximumDepth = 0; m_numberOfOverflows = 0;}
+
+
+      /**
+       * This member function returns the approximate number of
+       * elements waiting in the queue.
+       *
+       * @return The current queue depth.
+       */
+      size_t
+      size() const;
+
+
+      /**
+       * This member function removes the oldest available element
+       * from the queue.  It may be called from any thread.
+       *
+       * @param value This argument is used to return the element.
+       * It is left unchanged if the queue is empty.
+       *
+       * @return true if an element was removed, false if the queue
+       * was empty.
+       */
+      bool
+      tryPop(Type& value);
+
+
+      /**
+       * This member function adds a copy of its argument to the
+       * queue.  It may be called from any thread.
+       *
+       * @param value This argument is the element to be added.
+       *
+       * @return true if the element was added, false if the queue
+       * was full.
+       */
+      bool
+      tryPush(Type const& value);
+
+    private:
+
+      struct Cell {
+        Cell() : sequence(0), value() {}
+        std::atomic<size_t> sequence;
+        Type value;
+      };
+
+      static const size_t s_cacheLineSize = 64;
+
+      std::vector<Cell> m_cells;
+      size_t m_mask;
+      std::atomic<size_t> m_maximumDepth;
+      std::atomic<size_t> m_numberOfOverflows;
+      char m_padding0[s_cacheLineSize];
+      std::atomic<size_t> m_enqueuePosition;
+      char m_padding1[s_cacheLineSize];
+      std::atomic<size_t> m_dequeuePosition;
+      char m_padding2[s_cacheLineSize];
+    };
+
+  } // namespace utilities
+
+} // namespace brick
+
+
+/* ========= Definitions of inline and template functions below. ========== */
+
+
+#include <brick/common/exception.hh>
+
+namespace brick {
+
+  namespace utilities {
+
+    /// @cond privateCode
+    namespace privateCode {
+
+      inline size_t
+      getRingBufferCapacity(size_t requestedCapacity)
+      {
+        size_t capacity = 2;
+        while(capacity < requestedCapacity) {
+          capacity <<= 1;
+        }
+        return capacity;
+      }
+
+
+      inline void
+      updateMaximumDepth(std::atomic<size_t>& maximumDepth, size_t depth)
+      {
+        size_t previous = maximumDepth.load(std::memory_order_relaxed);
+        while(depth > previous
+              && !maximumDepth.compare_exchange_weak(
+                previous, depth, std::memory_order_relaxed)) {
+          // Empty.  compare_exchange_weak() updates previous.
+        }
+      }
+
+    } // namespace privateCode
+    /// @endcond
+
+
+    template <class Type>
+    RingBufferSPSC<Type>::
+    RingBufferSPSC(size_t capacity)
+      : m_slots(privateCode::getRingBufferCapacity(capacity)),
+        m_mask(m_slots.size() - 1),
+        m_maximumDepth(0),
+        m_numberOfOverflows(0),
+        m_head(0),
+        m_tail(0)
+    {
+      if(capacity == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "RingBufferSPSC::RingBufferSPSC()",
+                    "Argument capacity must be nonzero.");
+      }
+    }
+
+
+    template <class Type>
+    bool
+    RingBufferSPSC<Type>::
+    tryPop(Type& value)
+    {
+      size_t head = m_head.load(std::memory_order_relaxed);
+      if(head == m_tail.load(std::memory_order_acquire)) {
+        return false;
+      }
+      Type& slot = m_slots[head & m_mask];
+      value = slot;
+      slot = Type();
+      m_head.store(head + 1, std::memory_order_release);
+      return true;
+    }
+
+
+    template <class Type>
+    bool
+    RingBufferSPSC<Type>::
+    tryPush(Type const& value)
+    {
+      size_t tail = m_tail.load(std::memory_order_relaxed);
+      size_t head = m_head.load(std::memory_order_acquire);
+      if(tail - head >= m_slots.size()) {
+        m_numberOfOverflows.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      m_slots[tail & m_mask] = value;
+      m_tail.store(tail + 1, std::memory_order_release);
+      privateCode::updateMaximumDepth(m_maximumDepth, tail + 1 - head);
+      return true;
+    }
+
+
+    template <class Type>
+    RingBufferMPMC<Type>::
+    RingBufferMPMC(size_t capacity)
+      : m_cells(privateCode::getRingBufferCapacity(capacity)),
+        m_mask(m_cells.size() - 1),
+        m_maximumDepth(0),
+        m_numberOfOverflows(0),
+        m_enqueuePosition(0),
+        m_dequeuePosition(0)
+    {
+      if(capacity == 0) {
+        BRICK_THROW(brick::common::ValueException,
+                    "RingBufferMPMC::RingBufferMPMC()",
+                    "Argument capacity must be nonzero.");
+      }
+      for(size_t ii = 0; ii < m_cells.size(); ++ii) {
+        m_cells[ii].sequence.store(ii, std::memory_order_relaxed);
+      }
+    }
+
+
+    template <class Type>
+    size_t
+    RingBufferMPMC<Type>::
+    size() const
+    {
+      size_t dequeuePosition = m_dequeuePosition.load();
+      size_t enqueuePosition = m_enqueuePosition.load();
+      return (enqueuePosition > dequeuePosition)
+        ? (enqueuePosition - dequeuePosition) : 0;
+    }
+
+
+    template <class Type>
+    bool
+    RingBufferMPMC<Type>::
+    tryPop(Type& value)
+    {
+      Cell* cellPtr = 0;
+      size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+      while(true) {
+        cellPtr = &(m_cells[position & m_mask]);
+        size_t sequence = cellPtr->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t difference =
+          static_cast<std::ptrdiff_t>(sequence)
+          - static_cast<std::ptrdiff_t>(position + 1);
+        if(difference == 0) {
+          if(m_dequeuePosition.compare_exchange_weak(
+               position, position + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if(difference < 0) {
+          return false;
+        } else {
+          position = m_dequeuePosition.load(std::memory_order_relaxed);
+        }
+      }
+      value = cellPtr->value;
+      cellPtr->value = Type();
+      cellPtr->sequence.store(position + m_mask + 1,
+                              std::memory_order_release);
+      return true;
+    }
+
+
+    template <class Type>
+    bool
+    RingBufferMPMC<Type>::
+    tryPush(Type const& value)
+    {
+      Cell* cellPtr = 0;
+      size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+      while(true) {
+        cellPtr = &(m_cells[position & m_mask]);
+        size_t sequence = cellPtr->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t difference =
+          static_cast<std::ptrdiff_t>(sequence)
+          - static_cast<std::ptrdiff_t>(position);
+        if(difference == 0) {
+          if(m_enqueuePosition.compare_exchange_weak(
+               position, position + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if(difference < 0) {
+          m_numberOfOverflows.fetch_add(1, std::memory_order_relaxed);
+          return false;
+        } else {
+          position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+      }
+      cellPtr->value = value;
+      cellPtr->sequence.store(position + 1, std::memory_order_release);
+      // Consumers may already have passed this element, so guard
+      // against wrapping around when computing the depth.
+      size_t dequeuePosition =
+        m_dequeuePosition.load(std::memory_order_relaxed);
+      if(position + 1 > dequeuePosition) {
+        privateCode::updateMaximumDepth(
+          m_maximumDepth, position + 1 - dequeuePosition);
+      }
+      return true;
+    }
+
+  } // namespace utilities
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_UTILITIES_RINGBUFFER_HH */
@@ -0,0 +1,235 @@
+/**
+***************************************************************************
+* @file brick/utilities/stageStatistics.hh
+*
+* Header file declaring the StageStatistics class.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#ifndef BRICK_UTILITIES_STAGESTATISTICS_HH
+#define BRICK_UTILITIES_STAGESTATISTICS_HH
+
+#include <atomic>
+#include <cstddef>
+#include <brick/common/types.hh>
+#include <brick/utilities/timeUtilities.hh>
+
+namespace brick {
+
+  namespace utilities {
+
+    /**
+     ** The StageStatistics class accumulates latency and queue depth
+     ** counters for one stage of a streaming pipeline.  All counters
+     ** are atomic, so any thread may record samples while another
+     ** thread reads them, and recording never allocates memory.
+     ** Here's an example of how it might be used:
+     **
+     ** @code
+     **   StageStatistics warpStatistics;
+     **   while(running) {
+     **     Image<GRAY8> frame;
+     **     if(inputQueue.tryPop(frame)) {
+     **       warpStatistics.recordQueueDepth(inputQueue.size());
+     **       StageStatistics::Timer timer(warpStatistics);
+     **       warper.warpImage(frame, outputFrame);
+     **     }
+     **   }
+     **   std::cout << "Mean warp latency: "
+     **             << warpStatistics.getMeanLatency() << std::endl;
+     ** @endcode
+     **/
+    class StageStatistics {
+    public:
+
+      /**
+       ** This class records the time between its construction and
+       ** its destruction as a single latency sample.
+       **/
+      class Timer {
+      public:
+
+        /**
+         * The constructor starts the timer.
+         *
+         * @param statistics This argument is the StageStatistics
+         * instance to which the sample will be added.  It must
+         * outlive the Timer.
+         */
+        explicit
+        Timer(StageStatistics& statistics)
+          : m_statistics(statistics), m_startTime(getCurrentTime()) {}
+
+
+        /**
+         * The destructor records the elapsed time.
+         */
+        ~Timer() {
+          m_statistics.recordLatency(getCurrentTime() - m_startTime);
+        }
+
+      private:
+
+        // Timers are not meant to be copied.
+        Timer(Timer const&);
+        Timer& operator=(Timer const&);
+
+        StageStatistics& m_statistics;
+        double m_startTime;
+      };
+
+
+      /**
+       * The default constructor zeros all counters.
+       */
+      StageStatistics()
+        : m_latencyCount(0), m_latencyTotal(0), m_latencyMaximum(0),
+          m_queueDepthCount(0), m_queueDepthTotal(0),
+          m_queueDepthMaximum(0) {}
+
+
+      /**
+       * This member function returns the largest latency recorded.
+       *
+       * @return The maximum latency, in seconds.
+       */
+      double
+      getMaximumLatency() const {
+        return this->toSeconds(m_latencyMaximum.load());
+      }
+
+
+      /**
+       * This member function returns the largest queue depth
+       * recorded.
+       *
+       * @return The maximum queue depth.
+       */
+      size_t
+      getMaximumQueueDepth() const {
+        return static_cast<size_t>(m_queueDepthMaximum.load());
+      }
+
+
+      /**
+       * This member function returns the average of all recorded
+       * latencies.
+       *
+       * @return The mean latency, in seconds, or zero if no latencies
+       * have been recorded.
+       */
+      double
+      getMeanLatency() const {
+        common::UInt64 count = m_latencyCount.load();
+        if(count == 0) {return 0.0;}
+        return this->toSeconds(m_latencyTotal.load()) / count;
+      }
+
+
+      /**
+       * This member function returns the average of all recorded
+       * queue depths.
+       *
+       * @return The mean queue depth, or zero if no depths have been
+       * recorded.
+       */
+      double
+      getMeanQueueDepth() const {
+        common::UInt64 count = m_queueDepthCount.load();
+        if(count == 0) {return 0.0;}
+        return static_cast<double>(m_queueDepthTotal.load()) / count;
+      }
+
+
+      /**
+       * This member function returns the number of latency samples
+       * recorded so far.
+       *
+       * @return The number of calls to recordLatency().
+       */
+      size_t
+      getNumberOfSamples() const {
+        return static_cast<size_t>(m_latencyCount.load());
+      }
+
+
+      /**
+       * This member function adds one latency sample.
+       *
+       * @param seconds This argument is the time taken by one pass
+       * through the stage.
+       */
+      void
+      recordLatency(double seconds) {
+        common::UInt64 nanoseconds = static_cast<common::UInt64>(
+          (seconds > 0.0 ? seconds : 0.0) * 1.0E9 + 0.5);
+        m_latencyCount.fetch_add(1, std::memory_order_relaxed);
+        m_latencyTotal.fetch_add(nanoseconds, std::memory_order_relaxed);
+        this->updateMaximum(m_latencyMaximum, nanoseconds);
+      }
+
+
+      /**
+       * This member function adds one queue depth sample.
+       *
+       * @param depth This argument is the number of items waiting in
+       * the stage's input queue.
+       */
+      void
+      recordQueueDepth(size_t depth) {
+        m_queueDepthCount.fetch_add(1, std::memory_order_relaxed);
+        m_queueDepthTotal.fetch_add(depth, std::memory_order_relaxed);
+        this->updateMaximum(m_queueDepthMaximum, depth);
+      }
+
+
+      /**
+       * This member function zeros all counters.
+       */
+      void
+      reset() {
+        m_latencyCount = 0;
+        m_latencyTotal = 0;
+        m_latencyMaximum = 0;
+        m_queueDepthCount = 0;
+        m_queueDepthTotal = 0;
+        m_queueDepthMaximum = 0;
+      }
+
+    private:
+
+      double
+      toSeconds(common::UInt64 nanoseconds) const {
+        return static_cast<double>(nanoseconds) * 1.0E-9;
+      }
+
+
+      void
+      updateMaximum(std::atomic<common::UInt64>& maximum,
+                    common::UInt64 value) {
+        common::UInt64 previous = maximum.load(std::memory_order_relaxed);
+        while(value > previous
+              && !maximum.compare_exchange_weak(
+                previous, value, std::memory_order_relaxed)) {
+          // Empty.  compare_exchange_weak() updates previous.
+        }
+      }
+
+
+      std::atomic<common::UInt64> m_latencyCount;
+      std::atomic<common::UInt64> m_latencyTotal;
+      std::atomic<common::UInt64> m_latencyMaximum;
+      std::atomic<common::UInt64> m_queueDepthCount;
+      std::atomic<common::UInt64> m_queueDepthTotal;
+      std::atomic<common::UInt64> m_queueDepthMaximum;
+    };
+
+  } // namespace utilities
+
+} // namespace brick
+
+#endif /* #ifndef BRICK_UTILITIES_STAGESTATISTICS_HH */
@@ -0,0 +1,239 @@
+/**
+***************************************************************************
+* @file brick/utilities/test/framePoolTest.cc
+*
+* Source file defining tests for FramePool and StageStatistics.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <thread>
+#include <vector>
+
+#include <brick/common/types.hh>
+#include <brick/numeric/array2D.hh>
+#include <brick/utilities/framePool.hh>
+#include <brick/utilities/ringBuffer.hh>
+#include <brick/utilities/stageStatistics.hh>
+#include <brick/test/functors.hh>
+#include <brick/test/testFixture.hh>
+
+using brick::test::TestFixture;
+
+namespace brick {
+
+  namespace utilities {
+
+    class FramePoolTest : public TestFixture<FramePoolTest> {
+
+    public:
+
+      typedef brick::numeric::Array2D<brick::common::UInt8> FrameType;
+
+      FramePoolTest();
+      ~FramePoolTest() {}
+
+      void setUp(const std::string&) {}
+      void tearDown(const std::string&) {}
+
+      // Tests of member functions.
+      void testAcquire();
+      void testPipeline();
+      void testStageStatistics();
+
+    }; // class FramePoolTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    FramePoolTest::
+    FramePoolTest()
+      : TestFixture<FramePoolTest>("FramePoolTest")
+    {
+      BRICK_TEST_REGISTER_MEMBER(testAcquire);
+      BRICK_TEST_REGISTER_MEMBER(testPipeline);
+      BRICK_TEST_REGISTER_MEMBER(testStageStatistics);
+    }
+
+
+    void
+    FramePoolTest::
+    testAcquire()
+    {
+      FramePool<FrameType> pool(3, 4, 5);
+      BRICK_TEST_ASSERT(pool.getNumberOfFrames() == 3);
+      BRICK_TEST_ASSERT(pool.getNumberOfAvailableFrames() == 3);
+
+      FrameType frame0;
+      FrameType frame1;
+      FrameType frame2;
+      FrameType frame3;
+      BRICK_TEST_ASSERT(pool.acquire(frame0));
+      BRICK_TEST_ASSERT(pool.acquire(frame1));
+      BRICK_TEST_ASSERT(pool.acquire(frame2));
+      BRICK_TEST_ASSERT(frame0.rows() == 4 && frame0.columns() == 5);
+      BRICK_TEST_ASSERT(frame0.data() != frame1.data());
+      BRICK_TEST_ASSERT(frame1.data() != frame2.data());
+      BRICK_TEST_ASSERT(frame0.data() != frame2.data());
+      BRICK_TEST_ASSERT(pool.getNumberOfAvailableFrames() == 0);
+
+      // The pool is exhausted.
+      BRICK_TEST_ASSERT(!pool.acquire(frame3));
+      BRICK_TEST_ASSERT(frame3.size() == 0);
+      BRICK_TEST_ASSERT(pool.getNumberOfStarvations() == 1);
+
+      // Extra handles keep a frame in use.
+      brick::common::UInt8* dataPtr1 = frame1.data();
+      FrameType alias = frame1;
+      frame1 = FrameType();
+      BRICK_TEST_ASSERT(!pool.acquire(frame3));
+
+      // Dropping the last outside handle recycles the buffer.
+      alias = FrameType();
+      BRICK_TEST_ASSERT(pool.getNumberOfAvailableFrames() == 1);
+      BRICK_TEST_ASSERT(pool.acquire(frame3));
+      BRICK_TEST_ASSERT(frame3.data() == dataPtr1);
+    }
+
+
+    void
+    FramePoolTest::
+    testPipeline()
+    {
+      // Producer -> worker -> consumer, with each frame stamped by the
+      // producer and checked by the consumer.
+      const size_t numberOfFrames = 2000;
+      FramePool<FrameType> pool(8, 16, 16);
+      RingBufferSPSC<FrameType> stage0Queue(2);
+      RingBufferSPSC<FrameType> stage1Queue(2);
+      StageStatistics workerStatistics;
+
+      std::vector<brick::common::UInt8*> buffers;
+      for(size_t ii = 0; ii < pool.getNumberOfFrames(); ++ii) {
+        FrameType frame;
+        pool.acquire(frame);
+        buffers.push_back(frame.data());
+      }
+
+      std::thread producer([&]() {
+          for(size_t ii = 0; ii < numberOfFrames; ++ii) {
+            FrameType frame;
+            while(!pool.acquire(frame)) {
+              std::this_thread::yield();
+            }
+            frame = static_cast<brick::common::UInt8>(ii % 251);
+            while(!stage0Queue.tryPush(frame)) {
+              std::this_thread::yield();
+            }
+          }
+        });
+
+      std::thread worker([&]() {
+          FrameType frame;
+          for(size_t ii = 0; ii < numberOfFrames; ++ii) {
+            while(!stage0Queue.tryPop(frame)) {
+              std::this_thread::yield();
+            }
+            workerStatistics.recordQueueDepth(stage0Queue.size());
+            {
+              StageStatistics::Timer timer(workerStatistics);
+              for(size_t jj = 0; jj < frame.size(); ++jj) {
+                frame[jj] += 1;
+              }
+            }
+            while(!stage1Queue.tryPush(frame)) {
+              std::this_thread::yield();
+            }
+            frame = FrameType();
+          }
+        });
+
+      bool isCorrect = true;
+      bool isFromPool = true;
+      FrameType frame;
+      for(size_t ii = 0; ii < numberOfFrames; ++ii) {
+        while(!stage1Queue.tryPop(frame)) {
+          std::this_thread::yield();
+        }
+        brick::common::UInt8 expected =
+          static_cast<brick::common::UInt8>(ii % 251 + 1);
+        for(size_t jj = 0; jj < frame.size(); ++jj) {
+          isCorrect = isCorrect && (frame[jj] == expected);
+        }
+        bool isKnownBuffer = false;
+        for(size_t kk = 0; kk < buffers.size(); ++kk) {
+          isKnownBuffer = isKnownBuffer || (frame.data() == buffers[kk]);
+        }
+        isFromPool = isFromPool && isKnownBuffer;
+        frame = FrameType();
+      }
+      producer.join();
+      worker.join();
+
+      BRICK_TEST_ASSERT(isCorrect);
+      BRICK_TEST_ASSERT(isFromPool);
+      BRICK_TEST_ASSERT(pool.getNumberOfAvailableFrames()
+                        == pool.getNumberOfFrames());
+      BRICK_TEST_ASSERT(workerStatistics.getNumberOfSamples()
+                        == numberOfFrames);
+      BRICK_TEST_ASSERT(workerStatistics.getMaximumQueueDepth()
+                        <= stage0Queue.capacity());
+    }
+
+
+    void
+    FramePoolTest::
+    testStageStatistics()
+    {
+      StageStatistics statistics;
+      BRICK_TEST_ASSERT(statistics.getNumberOfSamples() == 0);
+      BRICK_TEST_ASSERT(statistics.getMeanLatency() == 0.0);
+      BRICK_TEST_ASSERT(statistics.getMeanQueueDepth() == 0.0);
+
+      statistics.recordLatency(0.001);
+      statistics.recordLatency(0.003);
+      statistics.recordLatency(0.002);
+      statistics.recordQueueDepth(1);
+      statistics.recordQueueDepth(4);
+
+      BRICK_TEST_ASSERT(statistics.getNumberOfSamples() == 3);
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(statistics.getMeanLatency(), 0.002, 1.0E-9));
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(statistics.getMaximumLatency(), 0.003,
+                                 1.0E-9));
+      BRICK_TEST_ASSERT(
+        test::approximatelyEqual(statistics.getMeanQueueDepth(), 2.5, 1.0E-12));
+      BRICK_TEST_ASSERT(statistics.getMaximumQueueDepth() == 4);
+
+      statistics.reset();
+      BRICK_TEST_ASSERT(statistics.getNumberOfSamples() == 0);
+      BRICK_TEST_ASSERT(statistics.getMaximumQueueDepth() == 0);
+    }
+
+  } // namespace utilities
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::utilities::FramePoolTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::utilities::FramePoolTest currentTest;
+
+}
+
+#endif
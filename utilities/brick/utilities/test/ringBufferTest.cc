@@ -0,0 +1,248 @@
+/**
+***************************************************************************
+* @file brick/utilities/test/ringBufferTest.cc
+*
+* Source file defining tests for RingBufferSPSC and RingBufferMPMC.
+*
+* Copyright (C) 2026 David LaRose, dlr@cs.cmu.edu
+* See accompanying file, LICENSE.TXT, for details.
+*
+***************************************************************************
+**/
+
+#include <thread>
+#include <vector>
+
+#include <brick/common/exception.hh>
+#include <brick/utilities/ringBuffer.hh>
+#include <brick/test/testFixture.hh>
+
+using brick::test::TestFixture;
+
+namespace brick {
+
+  namespace utilities {
+
+    class RingBufferTest : public TestFixture<RingBufferTest> {
+
+    public:
+
+      RingBufferTest();
+      ~RingBufferTest() {}
+
+      void setUp(const std::string&) {}
+      void tearDown(const std::string&) {}
+
+      // Tests of member functions.
+      void testRingBufferSPSC();
+      void testRingBufferSPSCThreaded();
+      void testRingBufferMPMC();
+      void testRingBufferMPMCThreaded();
+
+    }; // class RingBufferTest
+
+
+    /* ============== Member Function Definititions ============== */
+
+    RingBufferTest::
+    RingBufferTest()
+      : TestFixture<RingBufferTest>("RingBufferTest")
+    {
+      BRICK_TEST_REGISTER_MEMBER(testRingBufferSPSC);
+      BRICK_TEST_REGISTER_MEMBER(testRingBufferSPSCThreaded);
+      BRICK_TEST_REGISTER_MEMBER(testRingBufferMPMC);
+      BRICK_TEST_REGISTER_MEMBER(testRingBufferMPMCThreaded);
+    }
+
+
+    void
+    RingBufferTest::
+    testRingBufferSPSC()
+    {
+      BRICK_TEST_ASSERT_EXCEPTION(
+        brick::common::ValueException, RingBufferSPSC<int> badBuffer(0));
+
+      RingBufferSPSC<int> ringBuffer(5);
+      BRICK_TEST_ASSERT(ringBuffer.capacity() == 8);
+      BRICK_TEST_ASSERT(ringBuffer.isEmpty());
+
+      int value = -1;
+      BRICK_TEST_ASSERT(!ringBuffer.tryPop(value));
+      BRICK_TEST_ASSERT(value == -1);
+
+      // Fill the buffer, wrapping around a few times.
+      for(int pass = 0; pass < 3; ++pass) {
+        for(int ii = 0; ii < 8; ++ii) {
+          BRICK_TEST_ASSERT(ringBuffer.tryPush(100 * pass + ii));
+          BRICK_TEST_ASSERT(ringBuffer.size() == static_cast<size_t>(ii + 1));
+        }
+        BRICK_TEST_ASSERT(!ringBuffer.tryPush(999));
+        for(int ii = 0; ii < 8; ++ii) {
+          BRICK_TEST_ASSERT(ringBuffer.tryPop(value));
+          BRICK_TEST_ASSERT(value == 100 * pass + ii);
+        }
+        BRICK_TEST_ASSERT(!ringBuffer.tryPop(value));
+      }
+      BRICK_TEST_ASSERT(ringBuffer.getMaximumDepth() == 8);
+      BRICK_TEST_ASSERT(ringBuffer.getNumberOfOverflows() == 3);
+
+      ringBuffer.resetStatistics();
+      BRICK_TEST_ASSERT(ringBuffer.getMaximumDepth() == 0);
+      BRICK_TEST_ASSERT(ringBuffer.getNumberOfOverflows() == 0);
+    }
+
+
+    void
+    RingBufferTest::
+    testRingBufferSPSCThreaded()
+    {
+      const size_t numberOfValues = 200000;
+      RingBufferSPSC<size_t> ringBuffer(16);
+      std::vector<size_t> received;
+      received.reserve(numberOfValues);
+
+      std::thread consumer([&]() {
+          size_t value = 0;
+          while(received.size() < numberOfValues) {
+            if(ringBuffer.tryPop(value)) {
+              received.push_back(value);
+            } else {
+              std::this_thread::yield();
+            }
+          }
+        });
+      for(size_t ii = 0; ii < numberOfValues; ++ii) {
+        while(!ringBuffer.tryPush(ii)) {
+          std::this_thread::yield();
+        }
+      }
+      consumer.join();
+
+      // Everything must arrive, in order.
+      BRICK_TEST_ASSERT(received.size() == numberOfValues);
+      bool isInOrder = true;
+      for(size_t ii = 0; ii < received.size(); ++ii) {
+        isInOrder = isInOrder && (received[ii] == ii);
+      }
+      BRICK_TEST_ASSERT(isInOrder);
+      BRICK_TEST_ASSERT(ringBuffer.isEmpty());
+      BRICK_TEST_ASSERT(ringBuffer.getMaximumDepth() <= 16);
+    }
+
+
+    void
+    RingBufferTest::
+    testRingBufferMPMC()
+    {
+      RingBufferMPMC<int> ringBuffer(4);
+      BRICK_TEST_ASSERT(ringBuffer.capacity() == 4);
+
+      int value = -1;
+      BRICK_TEST_ASSERT(!ringBuffer.tryPop(value));
+      for(int pass = 0; pass < 3; ++pass) {
+        for(int ii = 0; ii < 4; ++ii) {
+          BRICK_TEST_ASSERT(ringBuffer.tryPush(10 * pass + ii));
+        }
+        BRICK_TEST_ASSERT(!ringBuffer.tryPush(999));
+        BRICK_TEST_ASSERT(ringBuffer.size() == 4);
+        for(int ii = 0; ii < 4; ++ii) {
+          BRICK_TEST_ASSERT(ringBuffer.tryPop(value));
+          BRICK_TEST_ASSERT(value == 10 * pass + ii);
+        }
+        BRICK_TEST_ASSERT(ringBuffer.isEmpty());
+      }
+      BRICK_TEST_ASSERT(ringBuffer.getMaximumDepth() == 4);
+      BRICK_TEST_ASSERT(ringBuffer.getNumberOfOverflows() == 3);
+    }
+
+
+    void
+    RingBufferTest::
+    testRingBufferMPMCThreaded()
+    {
+      const size_t numberOfProducers = 3;
+      const size_t numberOfConsumers = 3;
+      const size_t valuesPerProducer = 50000;
+      const size_t numberOfValues = numberOfProducers * valuesPerProducer;
+
+      RingBufferMPMC<size_t> ringBuffer(32);
+      std::vector< std::vector<size_t> > received(numberOfConsumers);
+      std::atomic<size_t> numberReceived(0);
+
+      std::vector<std::thread> threads;
+      for(size_t cc = 0; cc < numberOfConsumers; ++cc) {
+        threads.push_back(std::thread([&, cc]() {
+              size_t value = 0;
+              while(numberReceived.load() < numberOfValues) {
+                if(ringBuffer.tryPop(value)) {
+                  received[cc].push_back(value);
+                  ++numberReceived;
+                } else {
+                  std::this_thread::yield();
+                }
+              }
+            }));
+      }
+      for(size_t pp = 0; pp < numberOfProducers; ++pp) {
+        threads.push_back(std::thread([&, pp]() {
+              for(size_t ii = 0; ii < valuesPerProducer; ++ii) {
+                while(!ringBuffer.tryPush(pp * valuesPerProducer + ii)) {
+                  std::this_thread::yield();
+                }
+              }
+            }));
+      }
+      for(size_t ii = 0; ii < threads.size(); ++ii) {
+        threads[ii].join();
+      }
+
+      // Every value must arrive exactly once, and each consumer must
+      // see the values from any one producer in order.
+      std::vector<size_t> timesSeen(numberOfValues, 0);
+      bool isInOrder = true;
+      for(size_t cc = 0; cc < numberOfConsumers; ++cc) {
+        std::vector<size_t> lastSeen(numberOfProducers, 0);
+        std::vector<bool> isFirst(numberOfProducers, true);
+        for(size_t ii = 0; ii < received[cc].size(); ++ii) {
+          size_t value = received[cc][ii];
+          ++(timesSeen[value]);
+          size_t producer = value / valuesPerProducer;
+          if(!isFirst[producer] && value <= lastSeen[producer]) {
+            isInOrder = false;
+          }
+          isFirst[producer] = false;
+          lastSeen[producer] = value;
+        }
+      }
+      bool isExactlyOnce = true;
+      for(size_t ii = 0; ii < numberOfValues; ++ii) {
+        isExactlyOnce = isExactlyOnce && (timesSeen[ii] == 1);
+      }
+      BRICK_TEST_ASSERT(isExactlyOnce);
+      BRICK_TEST_ASSERT(isInOrder);
+      BRICK_TEST_ASSERT(ringBuffer.isEmpty());
+    }
+
+  } // namespace utilities
+
+} // namespace brick
+
+
+#if 0
+
+int main(int argc, char** argv)
+{
+  brick::utilities::RingBufferTest currentTest;
+  bool result = currentTest.run();
+  return (result ? 0 : 1);
+}
+
+#else
+
+namespace {
+
+  brick::utilities::RingBufferTest currentTest;
+
+}
+
+#endif